@@ -40,7 +40,7 @@ binit(void)
 {
   struct buf *b;
 
-  initlock(&bcache.lock, "bcache");
+  initlockkind(&bcache.lock, "bcache", LK_MCS);
 
 //PAGEBREAK!
   // Create linked list of buffers
@@ -105,6 +105,20 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for a block whose old contents don't
+// matter, such as one that was just allocated, with its data
+// zero-filled. Unlike bread(), never reads the disk.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  memset(b->data, 0, BSIZE);
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
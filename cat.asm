@@ -0,0 +1,1579 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c6 04             	add    $0x4,%esi
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7e 6f                	jle    98 <main+0x98>
+  29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	6a 00                	push   $0x0
+  35:	ff 36                	push   (%esi)
+  37:	e8 e9 04 00 00       	call   525 <open>
+  3c:	83 c4 10             	add    $0x10,%esp
+  3f:	89 c3                	mov    %eax,%ebx
+  41:	85 c0                	test   %eax,%eax
+  43:	78 3f                	js     84 <main+0x84>
+  45:	8d 76 00             	lea    0x0(%esi),%esi
+  while((n = splice(fd, 1, 4096)) > 0)
+  48:	83 ec 04             	sub    $0x4,%esp
+  4b:	68 00 10 00 00       	push   $0x1000
+  50:	6a 01                	push   $0x1
+  52:	53                   	push   %ebx
+  53:	e8 ae 05 00 00       	call   606 <splice>
+  58:	83 c4 10             	add    $0x10,%esp
+  5b:	85 c0                	test   %eax,%eax
+  5d:	7f e9                	jg     48 <main+0x48>
+  if(n == 0)
+  5f:	74 07                	je     68 <main+0x68>
+  61:	89 d8                	mov    %ebx,%eax
+  63:	e8 48 00 00 00       	call   b0 <cat.part.0>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+    close(fd);
+  68:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  6b:	83 c7 01             	add    $0x1,%edi
+  6e:	83 c6 04             	add    $0x4,%esi
+    close(fd);
+  71:	53                   	push   %ebx
+  72:	e8 81 04 00 00       	call   4f8 <close>
+  for(i = 1; i < argc; i++){
+  77:	83 c4 10             	add    $0x10,%esp
+  7a:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  7d:	75 b1                	jne    30 <main+0x30>
+  }
+  exit();
+  7f:	e8 29 04 00 00       	call   4ad <exit>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  84:	50                   	push   %eax
+  85:	ff 36                	push   (%esi)
+  87:	68 9b 0a 00 00       	push   $0xa9b
+  8c:	6a 01                	push   $0x1
+  8e:	e8 bd 06 00 00       	call   750 <printf>
+      exit();
+  93:	e8 15 04 00 00       	call   4ad <exit>
+    cat(0);
+  98:	83 ec 0c             	sub    $0xc,%esp
+  9b:	6a 00                	push   $0x0
+  9d:	e8 8e 00 00 00       	call   130 <cat>
+    exit();
+  a2:	e8 06 04 00 00       	call   4ad <exit>
+  a7:	66 90                	xchg   %ax,%ax
+  a9:	66 90                	xchg   %ax,%ax
+  ab:	66 90                	xchg   %ax,%ax
+  ad:	66 90                	xchg   %ax,%ax
+  af:	90                   	nop
+
+000000b0 <cat.part.0>:
+cat(int fd)
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	56                   	push   %esi
+  b4:	89 c6                	mov    %eax,%esi
+  b6:	53                   	push   %ebx
+  b7:	eb 1e                	jmp    d7 <cat.part.0+0x27>
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (write(1, buf, n) != n) {
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	53                   	push   %ebx
+  c4:	68 c0 0e 00 00       	push   $0xec0
+  c9:	6a 01                	push   $0x1
+  cb:	e8 19 04 00 00       	call   4e9 <write>
+  d0:	83 c4 10             	add    $0x10,%esp
+  d3:	39 c3                	cmp    %eax,%ebx
+  d5:	75 25                	jne    fc <cat.part.0+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  d7:	83 ec 04             	sub    $0x4,%esp
+  da:	68 00 02 00 00       	push   $0x200
+  df:	68 c0 0e 00 00       	push   $0xec0
+  e4:	56                   	push   %esi
+  e5:	e8 f0 03 00 00       	call   4da <read>
+  ea:	83 c4 10             	add    $0x10,%esp
+  ed:	89 c3                	mov    %eax,%ebx
+  ef:	85 c0                	test   %eax,%eax
+  f1:	7f cd                	jg     c0 <cat.part.0+0x10>
+  if(n < 0){
+  f3:	75 1b                	jne    110 <cat.part.0+0x60>
+}
+  f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  f8:	5b                   	pop    %ebx
+  f9:	5e                   	pop    %esi
+  fa:	5d                   	pop    %ebp
+  fb:	c3                   	ret
+      printf(1, "cat: write error\n");
+  fc:	83 ec 08             	sub    $0x8,%esp
+  ff:	68 78 0a 00 00       	push   $0xa78
+ 104:	6a 01                	push   $0x1
+ 106:	e8 45 06 00 00       	call   750 <printf>
+      exit();
+ 10b:	e8 9d 03 00 00       	call   4ad <exit>
+    printf(1, "cat: read error\n");
+ 110:	50                   	push   %eax
+ 111:	50                   	push   %eax
+ 112:	68 8a 0a 00 00       	push   $0xa8a
+ 117:	6a 01                	push   $0x1
+ 119:	e8 32 06 00 00       	call   750 <printf>
+    exit();
+ 11e:	e8 8a 03 00 00       	call   4ad <exit>
+ 123:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000130 <cat>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	53                   	push   %ebx
+ 134:	83 ec 04             	sub    $0x4,%esp
+ 137:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  while((n = splice(fd, 1, 4096)) > 0)
+ 13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 140:	83 ec 04             	sub    $0x4,%esp
+ 143:	68 00 10 00 00       	push   $0x1000
+ 148:	6a 01                	push   $0x1
+ 14a:	53                   	push   %ebx
+ 14b:	e8 b6 04 00 00       	call   606 <splice>
+ 150:	83 c4 10             	add    $0x10,%esp
+ 153:	85 c0                	test   %eax,%eax
+ 155:	7f e9                	jg     140 <cat+0x10>
+  if(n == 0)
+ 157:	74 0f                	je     168 <cat+0x38>
+ 159:	89 d8                	mov    %ebx,%eax
+}
+ 15b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15e:	c9                   	leave
+ 15f:	e9 4c ff ff ff       	jmp    b0 <cat.part.0>
+ 164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+ 16d:	66 90                	xchg   %ax,%ax
+ 16f:	90                   	nop
+
+00000170 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 170:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 171:	31 c0                	xor    %eax,%eax
+{
+ 173:	89 e5                	mov    %esp,%ebp
+ 175:	53                   	push   %ebx
+ 176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 180:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 184:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 187:	83 c0 01             	add    $0x1,%eax
+ 18a:	84 d2                	test   %dl,%dl
+ 18c:	75 f2                	jne    180 <strcpy+0x10>
+    ;
+  return os;
+}
+ 18e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 191:	89 c8                	mov    %ecx,%eax
+ 193:	c9                   	leave
+ 194:	c3                   	ret
+ 195:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	53                   	push   %ebx
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1aa:	0f b6 02             	movzbl (%edx),%eax
+ 1ad:	84 c0                	test   %al,%al
+ 1af:	75 17                	jne    1c8 <strcmp+0x28>
+ 1b1:	eb 3a                	jmp    1ed <strcmp+0x4d>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1bc:	83 c2 01             	add    $0x1,%edx
+ 1bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	74 1a                	je     1e0 <strcmp+0x40>
+    p++, q++;
+ 1c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1cb:	38 c3                	cmp    %al,%bl
+ 1cd:	74 e9                	je     1b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	29 d8                	sub    %ebx,%eax
+}
+ 1d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d4:	c9                   	leave
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1e4:	31 c0                	xor    %eax,%eax
+ 1e6:	29 d8                	sub    %ebx,%eax
+}
+ 1e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1eb:	c9                   	leave
+ 1ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 1f0:	31 c0                	xor    %eax,%eax
+ 1f2:	eb db                	jmp    1cf <strcmp+0x2f>
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 206:	80 3a 00             	cmpb   $0x0,(%edx)
+ 209:	74 15                	je     220 <strlen+0x20>
+ 20b:	31 c0                	xor    %eax,%eax
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+ 210:	83 c0 01             	add    $0x1,%eax
+ 213:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 217:	89 c1                	mov    %eax,%ecx
+ 219:	75 f5                	jne    210 <strlen+0x10>
+    ;
+  return n;
+}
+ 21b:	89 c8                	mov    %ecx,%eax
+ 21d:	5d                   	pop    %ebp
+ 21e:	c3                   	ret
+ 21f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 220:	31 c9                	xor    %ecx,%ecx
+}
+ 222:	5d                   	pop    %ebp
+ 223:	89 c8                	mov    %ecx,%eax
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000230 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 237:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 23a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 23d:	89 d7                	mov    %edx,%edi
+ 23f:	fc                   	cld
+ 240:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 242:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 245:	89 d0                	mov    %edx,%eax
+ 247:	c9                   	leave
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 25a:	0f b6 10             	movzbl (%eax),%edx
+ 25d:	84 d2                	test   %dl,%dl
+ 25f:	75 12                	jne    273 <strchr+0x23>
+ 261:	eb 1d                	jmp    280 <strchr+0x30>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	84 d2                	test   %dl,%dl
+ 271:	74 0d                	je     280 <strchr+0x30>
+    if(*s == c)
+ 273:	38 d1                	cmp    %dl,%cl
+ 275:	75 f1                	jne    268 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 277:	5d                   	pop    %ebp
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 280:	31 c0                	xor    %eax,%eax
+}
+ 282:	5d                   	pop    %ebp
+ 283:	c3                   	ret
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 295:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 298:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 299:	31 db                	xor    %ebx,%ebx
+{
+ 29b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 29e:	eb 27                	jmp    2c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2a0:	83 ec 04             	sub    $0x4,%esp
+ 2a3:	6a 01                	push   $0x1
+ 2a5:	56                   	push   %esi
+ 2a6:	6a 00                	push   $0x0
+ 2a8:	e8 2d 02 00 00       	call   4da <read>
+    if(cc < 1)
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	85 c0                	test   %eax,%eax
+ 2b2:	7e 1d                	jle    2d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2bf:	3c 0a                	cmp    $0xa,%al
+ 2c1:	74 10                	je     2d3 <gets+0x43>
+ 2c3:	3c 0d                	cmp    $0xd,%al
+ 2c5:	74 0c                	je     2d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2c7:	89 df                	mov    %ebx,%edi
+ 2c9:	83 c3 01             	add    $0x1,%ebx
+ 2cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2cf:	7c cf                	jl     2a0 <gets+0x10>
+ 2d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2dd:	5b                   	pop    %ebx
+ 2de:	5e                   	pop    %esi
+ 2df:	5f                   	pop    %edi
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	56                   	push   %esi
+ 2f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	6a 00                	push   $0x0
+ 2fa:	ff 75 08             	push   0x8(%ebp)
+ 2fd:	e8 23 02 00 00       	call   525 <open>
+  if(fd < 0)
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	78 27                	js     330 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 309:	83 ec 08             	sub    $0x8,%esp
+ 30c:	ff 75 0c             	push   0xc(%ebp)
+ 30f:	89 c3                	mov    %eax,%ebx
+ 311:	50                   	push   %eax
+ 312:	e8 3b 02 00 00       	call   552 <fstat>
+  close(fd);
+ 317:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 31a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 31c:	e8 d7 01 00 00       	call   4f8 <close>
+  return r;
+ 321:	83 c4 10             	add    $0x10,%esp
+}
+ 324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 327:	89 f0                	mov    %esi,%eax
+ 329:	5b                   	pop    %ebx
+ 32a:	5e                   	pop    %esi
+ 32b:	5d                   	pop    %ebp
+ 32c:	c3                   	ret
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 330:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 335:	eb ed                	jmp    324 <stat+0x34>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	53                   	push   %ebx
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 347:	0f be 02             	movsbl (%edx),%eax
+ 34a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 34d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 355:	77 1e                	ja     375 <atoi+0x35>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 360:	83 c2 01             	add    $0x1,%edx
+ 363:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 366:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 36a:	0f be 02             	movsbl (%edx),%eax
+ 36d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 370:	80 fb 09             	cmp    $0x9,%bl
+ 373:	76 eb                	jbe    360 <atoi+0x20>
+  return n;
+}
+ 375:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 378:	89 c8                	mov    %ecx,%eax
+ 37a:	c9                   	leave
+ 37b:	c3                   	ret
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	56                   	push   %esi
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	8b 55 08             	mov    0x8(%ebp),%edx
+ 38b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 38e:	85 c0                	test   %eax,%eax
+ 390:	7e 13                	jle    3a5 <memmove+0x25>
+ 392:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 394:	89 d7                	mov    %edx,%edi
+ 396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3a1:	39 f8                	cmp    %edi,%eax
+ 3a3:	75 fb                	jne    3a0 <memmove+0x20>
+  return vdst;
+}
+ 3a5:	5e                   	pop    %esi
+ 3a6:	89 d0                	mov    %edx,%eax
+ 3a8:	5f                   	pop    %edi
+ 3a9:	5d                   	pop    %ebp
+ 3aa:	c3                   	ret
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+ 3b5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 3be:	85 f6                	test   %esi,%esi
+ 3c0:	74 2e                	je     3f0 <memcmp+0x40>
+ 3c2:	01 c6                	add    %eax,%esi
+ 3c4:	eb 14                	jmp    3da <memcmp+0x2a>
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 3d0:	83 c0 01             	add    $0x1,%eax
+ 3d3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 3d6:	39 f0                	cmp    %esi,%eax
+ 3d8:	74 16                	je     3f0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 3da:	0f b6 0a             	movzbl (%edx),%ecx
+ 3dd:	0f b6 18             	movzbl (%eax),%ebx
+ 3e0:	38 d9                	cmp    %bl,%cl
+ 3e2:	74 ec                	je     3d0 <memcmp+0x20>
+      return *s1 - *s2;
+ 3e4:	0f b6 c1             	movzbl %cl,%eax
+ 3e7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	5b                   	pop    %ebx
+  return 0;
+ 3f1:	31 c0                	xor    %eax,%eax
+}
+ 3f3:	5e                   	pop    %esi
+ 3f4:	5d                   	pop    %ebp
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 400:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 410:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 412:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 418:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 41e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 424:	c3                   	ret
+ 425:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 430:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 432:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 438:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 43e:	c3                   	ret
+ 43f:	90                   	nop
+
+00000440 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 448:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 44d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 453:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 459:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 45f:	89 c6                	mov    %eax,%esi
+ 461:	f7 f7                	div    %edi
+ 463:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 465:	f7 e3                	mul    %ebx
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 46a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 46d:	89 d3                	mov    %edx,%ebx
+ 46f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 472:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 474:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 476:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 47c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 481:	f7 e6                	mul    %esi
+ 483:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 489:	29 d9                	sub    %ebx,%ecx
+ 48b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 491:	01 c1                	add    %eax,%ecx
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 499:	5b                   	pop    %ebx
+ 49a:	5e                   	pop    %esi
+ 49b:	5f                   	pop    %edi
+ 49c:	5d                   	pop    %ebp
+ 49d:	c3                   	ret
+
+0000049e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 49e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4a3:	89 e1                	mov    %esp,%ecx
+ 4a5:	ba ac 04 00 00       	mov    $0x4ac,%edx
+ 4aa:	0f 34                	sysenter
+ 4ac:	c3                   	ret
+
+000004ad <exit>:
+SYSCALL(exit)
+ 4ad:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4b2:	89 e1                	mov    %esp,%ecx
+ 4b4:	ba bb 04 00 00       	mov    $0x4bb,%edx
+ 4b9:	0f 34                	sysenter
+ 4bb:	c3                   	ret
+
+000004bc <wait>:
+SYSCALL(wait)
+ 4bc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4c1:	89 e1                	mov    %esp,%ecx
+ 4c3:	ba ca 04 00 00       	mov    $0x4ca,%edx
+ 4c8:	0f 34                	sysenter
+ 4ca:	c3                   	ret
+
+000004cb <pipe>:
+SYSCALL(pipe)
+ 4cb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d0:	89 e1                	mov    %esp,%ecx
+ 4d2:	ba d9 04 00 00       	mov    $0x4d9,%edx
+ 4d7:	0f 34                	sysenter
+ 4d9:	c3                   	ret
+
+000004da <read>:
+SYSCALL(read)
+ 4da:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4df:	89 e1                	mov    %esp,%ecx
+ 4e1:	ba e8 04 00 00       	mov    $0x4e8,%edx
+ 4e6:	0f 34                	sysenter
+ 4e8:	c3                   	ret
+
+000004e9 <write>:
+SYSCALL(write)
+ 4e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4ee:	89 e1                	mov    %esp,%ecx
+ 4f0:	ba f7 04 00 00       	mov    $0x4f7,%edx
+ 4f5:	0f 34                	sysenter
+ 4f7:	c3                   	ret
+
+000004f8 <close>:
+SYSCALL(close)
+ 4f8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4fd:	89 e1                	mov    %esp,%ecx
+ 4ff:	ba 06 05 00 00       	mov    $0x506,%edx
+ 504:	0f 34                	sysenter
+ 506:	c3                   	ret
+
+00000507 <kill>:
+SYSCALL(kill)
+ 507:	b8 06 00 00 00       	mov    $0x6,%eax
+ 50c:	89 e1                	mov    %esp,%ecx
+ 50e:	ba 15 05 00 00       	mov    $0x515,%edx
+ 513:	0f 34                	sysenter
+ 515:	c3                   	ret
+
+00000516 <exec>:
+SYSCALL(exec)
+ 516:	b8 07 00 00 00       	mov    $0x7,%eax
+ 51b:	89 e1                	mov    %esp,%ecx
+ 51d:	ba 24 05 00 00       	mov    $0x524,%edx
+ 522:	0f 34                	sysenter
+ 524:	c3                   	ret
+
+00000525 <open>:
+SYSCALL(open)
+ 525:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 52a:	89 e1                	mov    %esp,%ecx
+ 52c:	ba 33 05 00 00       	mov    $0x533,%edx
+ 531:	0f 34                	sysenter
+ 533:	c3                   	ret
+
+00000534 <mknod>:
+SYSCALL(mknod)
+ 534:	b8 11 00 00 00       	mov    $0x11,%eax
+ 539:	89 e1                	mov    %esp,%ecx
+ 53b:	ba 42 05 00 00       	mov    $0x542,%edx
+ 540:	0f 34                	sysenter
+ 542:	c3                   	ret
+
+00000543 <unlink>:
+SYSCALL(unlink)
+ 543:	b8 12 00 00 00       	mov    $0x12,%eax
+ 548:	89 e1                	mov    %esp,%ecx
+ 54a:	ba 51 05 00 00       	mov    $0x551,%edx
+ 54f:	0f 34                	sysenter
+ 551:	c3                   	ret
+
+00000552 <fstat>:
+SYSCALL(fstat)
+ 552:	b8 08 00 00 00       	mov    $0x8,%eax
+ 557:	89 e1                	mov    %esp,%ecx
+ 559:	ba 60 05 00 00       	mov    $0x560,%edx
+ 55e:	0f 34                	sysenter
+ 560:	c3                   	ret
+
+00000561 <link>:
+SYSCALL(link)
+ 561:	b8 13 00 00 00       	mov    $0x13,%eax
+ 566:	89 e1                	mov    %esp,%ecx
+ 568:	ba 6f 05 00 00       	mov    $0x56f,%edx
+ 56d:	0f 34                	sysenter
+ 56f:	c3                   	ret
+
+00000570 <mkdir>:
+SYSCALL(mkdir)
+ 570:	b8 14 00 00 00       	mov    $0x14,%eax
+ 575:	89 e1                	mov    %esp,%ecx
+ 577:	ba 7e 05 00 00       	mov    $0x57e,%edx
+ 57c:	0f 34                	sysenter
+ 57e:	c3                   	ret
+
+0000057f <chdir>:
+SYSCALL(chdir)
+ 57f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 584:	89 e1                	mov    %esp,%ecx
+ 586:	ba 8d 05 00 00       	mov    $0x58d,%edx
+ 58b:	0f 34                	sysenter
+ 58d:	c3                   	ret
+
+0000058e <dup>:
+SYSCALL(dup)
+ 58e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 593:	89 e1                	mov    %esp,%ecx
+ 595:	ba 9c 05 00 00       	mov    $0x59c,%edx
+ 59a:	0f 34                	sysenter
+ 59c:	c3                   	ret
+
+0000059d <sbrk>:
+SYSCALL(sbrk)
+ 59d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a2:	89 e1                	mov    %esp,%ecx
+ 5a4:	ba ab 05 00 00       	mov    $0x5ab,%edx
+ 5a9:	0f 34                	sysenter
+ 5ab:	c3                   	ret
+
+000005ac <sleep>:
+SYSCALL(sleep)
+ 5ac:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b1:	89 e1                	mov    %esp,%ecx
+ 5b3:	ba ba 05 00 00       	mov    $0x5ba,%edx
+ 5b8:	0f 34                	sysenter
+ 5ba:	c3                   	ret
+
+000005bb <fallocate>:
+SYSCALL(fallocate)
+ 5bb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c0:	89 e1                	mov    %esp,%ecx
+ 5c2:	ba c9 05 00 00       	mov    $0x5c9,%edx
+ 5c7:	0f 34                	sysenter
+ 5c9:	c3                   	ret
+
+000005ca <pread>:
+SYSCALL(pread)
+ 5ca:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5cf:	89 e1                	mov    %esp,%ecx
+ 5d1:	ba d8 05 00 00       	mov    $0x5d8,%edx
+ 5d6:	0f 34                	sysenter
+ 5d8:	c3                   	ret
+
+000005d9 <pwrite>:
+SYSCALL(pwrite)
+ 5d9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5de:	89 e1                	mov    %esp,%ecx
+ 5e0:	ba e7 05 00 00       	mov    $0x5e7,%edx
+ 5e5:	0f 34                	sysenter
+ 5e7:	c3                   	ret
+
+000005e8 <readv>:
+SYSCALL(readv)
+ 5e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5ed:	89 e1                	mov    %esp,%ecx
+ 5ef:	ba f6 05 00 00       	mov    $0x5f6,%edx
+ 5f4:	0f 34                	sysenter
+ 5f6:	c3                   	ret
+
+000005f7 <writev>:
+SYSCALL(writev)
+ 5f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5fc:	89 e1                	mov    %esp,%ecx
+ 5fe:	ba 05 06 00 00       	mov    $0x605,%edx
+ 603:	0f 34                	sysenter
+ 605:	c3                   	ret
+
+00000606 <splice>:
+SYSCALL(splice)
+ 606:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 60b:	89 e1                	mov    %esp,%ecx
+ 60d:	ba 14 06 00 00       	mov    $0x614,%edx
+ 612:	0f 34                	sysenter
+ 614:	c3                   	ret
+
+00000615 <setpriority>:
+SYSCALL(setpriority)
+ 615:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 61a:	89 e1                	mov    %esp,%ecx
+ 61c:	ba 23 06 00 00       	mov    $0x623,%edx
+ 621:	0f 34                	sysenter
+ 623:	c3                   	ret
+
+00000624 <setaffinity>:
+SYSCALL(setaffinity)
+ 624:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 629:	89 e1                	mov    %esp,%ecx
+ 62b:	ba 32 06 00 00       	mov    $0x632,%edx
+ 630:	0f 34                	sysenter
+ 632:	c3                   	ret
+
+00000633 <lockstress>:
+SYSCALL(lockstress)
+ 633:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 638:	89 e1                	mov    %esp,%ecx
+ 63a:	ba 41 06 00 00       	mov    $0x641,%edx
+ 63f:	0f 34                	sysenter
+ 641:	c3                   	ret
+
+00000642 <lockstat>:
+SYSCALL(lockstat)
+ 642:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 647:	89 e1                	mov    %esp,%ecx
+ 649:	ba 50 06 00 00       	mov    $0x650,%edx
+ 64e:	0f 34                	sysenter
+ 650:	c3                   	ret
+
+00000651 <profctl>:
+SYSCALL(profctl)
+ 651:	b8 20 00 00 00       	mov    $0x20,%eax
+ 656:	89 e1                	mov    %esp,%ecx
+ 658:	ba 5f 06 00 00       	mov    $0x65f,%edx
+ 65d:	0f 34                	sysenter
+ 65f:	c3                   	ret
+
+00000660 <profread>:
+SYSCALL(profread)
+ 660:	b8 21 00 00 00       	mov    $0x21,%eax
+ 665:	89 e1                	mov    %esp,%ecx
+ 667:	ba 6e 06 00 00       	mov    $0x66e,%edx
+ 66c:	0f 34                	sysenter
+ 66e:	c3                   	ret
+
+0000066f <getrusage>:
+SYSCALL(getrusage)
+ 66f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 674:	89 e1                	mov    %esp,%ecx
+ 676:	ba 7d 06 00 00       	mov    $0x67d,%edx
+ 67b:	0f 34                	sysenter
+ 67d:	c3                   	ret
+
+0000067e <tracectl>:
+SYSCALL(tracectl)
+ 67e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 683:	89 e1                	mov    %esp,%ecx
+ 685:	ba 8c 06 00 00       	mov    $0x68c,%edx
+ 68a:	0f 34                	sysenter
+ 68c:	c3                   	ret
+
+0000068d <traceread>:
+SYSCALL(traceread)
+ 68d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 692:	89 e1                	mov    %esp,%ecx
+ 694:	ba 9b 06 00 00       	mov    $0x69b,%edx
+ 699:	0f 34                	sysenter
+ 69b:	c3                   	ret
+
+0000069c <nanosleep>:
+SYSCALL(nanosleep)
+ 69c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6a1:	89 e1                	mov    %esp,%ecx
+ 6a3:	ba aa 06 00 00       	mov    $0x6aa,%edx
+ 6a8:	0f 34                	sysenter
+ 6aa:	c3                   	ret
+ 6ab:	66 90                	xchg   %ax,%ax
+ 6ad:	66 90                	xchg   %ax,%ax
+ 6af:	90                   	nop
+
+000006b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6b0:	55                   	push   %ebp
+ 6b1:	89 e5                	mov    %esp,%ebp
+ 6b3:	57                   	push   %edi
+ 6b4:	56                   	push   %esi
+ 6b5:	53                   	push   %ebx
+ 6b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6b8:	89 d1                	mov    %edx,%ecx
+{
+ 6ba:	83 ec 3c             	sub    $0x3c,%esp
+ 6bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6c0:	85 d2                	test   %edx,%edx
+ 6c2:	0f 89 80 00 00 00    	jns    748 <printint+0x98>
+ 6c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6cc:	74 7a                	je     748 <printint+0x98>
+    x = -xx;
+ 6ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6d8:	31 f6                	xor    %esi,%esi
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6e0:	89 c8                	mov    %ecx,%eax
+ 6e2:	31 d2                	xor    %edx,%edx
+ 6e4:	89 f7                	mov    %esi,%edi
+ 6e6:	f7 f3                	div    %ebx
+ 6e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6eb:	0f b6 92 10 0b 00 00 	movzbl 0xb10(%edx),%edx
+ 6f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6f6:	89 ca                	mov    %ecx,%edx
+ 6f8:	89 c1                	mov    %eax,%ecx
+ 6fa:	39 da                	cmp    %ebx,%edx
+ 6fc:	73 e2                	jae    6e0 <printint+0x30>
+  if(neg)
+ 6fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 701:	85 c0                	test   %eax,%eax
+ 703:	74 07                	je     70c <printint+0x5c>
+    buf[i++] = '-';
+ 705:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 70a:	89 f7                	mov    %esi,%edi
+ 70c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 70f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 712:	01 df                	add    %ebx,%edi
+ 714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 718:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 71b:	83 ec 04             	sub    $0x4,%esp
+ 71e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 721:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 724:	6a 01                	push   $0x1
+ 726:	50                   	push   %eax
+ 727:	56                   	push   %esi
+ 728:	e8 bc fd ff ff       	call   4e9 <write>
+  while(--i >= 0)
+ 72d:	89 f8                	mov    %edi,%eax
+ 72f:	83 c4 10             	add    $0x10,%esp
+ 732:	83 ef 01             	sub    $0x1,%edi
+ 735:	39 d8                	cmp    %ebx,%eax
+ 737:	75 df                	jne    718 <printint+0x68>
+}
+ 739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 73c:	5b                   	pop    %ebx
+ 73d:	5e                   	pop    %esi
+ 73e:	5f                   	pop    %edi
+ 73f:	5d                   	pop    %ebp
+ 740:	c3                   	ret
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 748:	31 c0                	xor    %eax,%eax
+ 74a:	eb 89                	jmp    6d5 <printint+0x25>
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 759:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 75c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 75f:	0f b6 1e             	movzbl (%esi),%ebx
+ 762:	83 c6 01             	add    $0x1,%esi
+ 765:	84 db                	test   %bl,%bl
+ 767:	74 67                	je     7d0 <printf+0x80>
+ 769:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 76c:	31 d2                	xor    %edx,%edx
+ 76e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 771:	eb 34                	jmp    7a7 <printf+0x57>
+ 773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 777:	90                   	nop
+ 778:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 77b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 780:	83 f8 25             	cmp    $0x25,%eax
+ 783:	74 18                	je     79d <printf+0x4d>
+  write(fd, &c, 1);
+ 785:	83 ec 04             	sub    $0x4,%esp
+ 788:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 78b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78e:	6a 01                	push   $0x1
+ 790:	50                   	push   %eax
+ 791:	57                   	push   %edi
+ 792:	e8 52 fd ff ff       	call   4e9 <write>
+ 797:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 79a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 79d:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a0:	83 c6 01             	add    $0x1,%esi
+ 7a3:	84 db                	test   %bl,%bl
+ 7a5:	74 29                	je     7d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7aa:	85 d2                	test   %edx,%edx
+ 7ac:	74 ca                	je     778 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ae:	83 fa 25             	cmp    $0x25,%edx
+ 7b1:	75 ea                	jne    79d <printf+0x4d>
+      if(c == 'd'){
+ 7b3:	83 f8 25             	cmp    $0x25,%eax
+ 7b6:	0f 84 24 01 00 00    	je     8e0 <printf+0x190>
+ 7bc:	83 e8 63             	sub    $0x63,%eax
+ 7bf:	83 f8 15             	cmp    $0x15,%eax
+ 7c2:	77 1c                	ja     7e0 <printf+0x90>
+ 7c4:	ff 24 85 b8 0a 00 00 	jmp    *0xab8(,%eax,4)
+ 7cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7d3:	5b                   	pop    %ebx
+ 7d4:	5e                   	pop    %esi
+ 7d5:	5f                   	pop    %edi
+ 7d6:	5d                   	pop    %ebp
+ 7d7:	c3                   	ret
+ 7d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7ea:	6a 01                	push   $0x1
+ 7ec:	52                   	push   %edx
+ 7ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7f0:	57                   	push   %edi
+ 7f1:	e8 f3 fc ff ff       	call   4e9 <write>
+ 7f6:	83 c4 0c             	add    $0xc,%esp
+ 7f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fc:	6a 01                	push   $0x1
+ 7fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 801:	52                   	push   %edx
+ 802:	57                   	push   %edi
+ 803:	e8 e1 fc ff ff       	call   4e9 <write>
+        putc(fd, c);
+ 808:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 80b:	31 d2                	xor    %edx,%edx
+ 80d:	eb 8e                	jmp    79d <printf+0x4d>
+ 80f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 00                	push   $0x0
+ 81f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 821:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 824:	e8 87 fe ff ff       	call   6b0 <printint>
+        ap++;
+ 829:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 82c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82f:	31 d2                	xor    %edx,%edx
+ 831:	e9 67 ff ff ff       	jmp    79d <printf+0x4d>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 840:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 843:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 845:	83 c0 04             	add    $0x4,%eax
+ 848:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 84b:	85 db                	test   %ebx,%ebx
+ 84d:	0f 84 9d 00 00 00    	je     8f0 <printf+0x1a0>
+        while(*s != 0){
+ 853:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 856:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 858:	84 c0                	test   %al,%al
+ 85a:	0f 84 3d ff ff ff    	je     79d <printf+0x4d>
+ 860:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 863:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 866:	89 de                	mov    %ebx,%esi
+ 868:	89 d3                	mov    %edx,%ebx
+ 86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 876:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 879:	6a 01                	push   $0x1
+ 87b:	53                   	push   %ebx
+ 87c:	57                   	push   %edi
+ 87d:	e8 67 fc ff ff       	call   4e9 <write>
+        while(*s != 0){
+ 882:	0f b6 06             	movzbl (%esi),%eax
+ 885:	83 c4 10             	add    $0x10,%esp
+ 888:	84 c0                	test   %al,%al
+ 88a:	75 e4                	jne    870 <printf+0x120>
+      state = 0;
+ 88c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 88f:	31 d2                	xor    %edx,%edx
+ 891:	e9 07 ff ff ff       	jmp    79d <printf+0x4d>
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8ab:	8b 13                	mov    (%ebx),%edx
+ 8ad:	6a 01                	push   $0x1
+ 8af:	e9 6b ff ff ff       	jmp    81f <printf+0xcf>
+ 8b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8bb:	83 ec 04             	sub    $0x4,%esp
+ 8be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	52                   	push   %edx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 17 fc ff ff       	call   4e9 <write>
+        ap++;
+ 8d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8d8:	31 d2                	xor    %edx,%edx
+ 8da:	e9 be fe ff ff       	jmp    79d <printf+0x4d>
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	e9 11 ff ff ff       	jmp    801 <printf+0xb1>
+ 8f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8f5:	bb b0 0a 00 00       	mov    $0xab0,%ebx
+ 8fa:	e9 61 ff ff ff       	jmp    860 <printf+0x110>
+ 8ff:	90                   	nop
+
+00000900 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 900:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 901:	a1 c0 10 00 00       	mov    0x10c0,%eax
+{
+ 906:	89 e5                	mov    %esp,%ebp
+ 908:	57                   	push   %edi
+ 909:	56                   	push   %esi
+ 90a:	53                   	push   %ebx
+ 90b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 90e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 918:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 91a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 91c:	39 ca                	cmp    %ecx,%edx
+ 91e:	73 30                	jae    950 <free+0x50>
+ 920:	39 c1                	cmp    %eax,%ecx
+ 922:	72 04                	jb     928 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 924:	39 c2                	cmp    %eax,%edx
+ 926:	72 f0                	jb     918 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 928:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 92b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 92e:	39 f8                	cmp    %edi,%eax
+ 930:	74 2e                	je     960 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 932:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 935:	8b 42 04             	mov    0x4(%edx),%eax
+ 938:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 93b:	39 f1                	cmp    %esi,%ecx
+ 93d:	74 38                	je     977 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 93f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 941:	5b                   	pop    %ebx
+  freep = p;
+ 942:	89 15 c0 10 00 00    	mov    %edx,0x10c0
+}
+ 948:	5e                   	pop    %esi
+ 949:	5f                   	pop    %edi
+ 94a:	5d                   	pop    %ebp
+ 94b:	c3                   	ret
+ 94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 950:	39 c1                	cmp    %eax,%ecx
+ 952:	72 d0                	jb     924 <free+0x24>
+ 954:	eb c2                	jmp    918 <free+0x18>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 960:	03 70 04             	add    0x4(%eax),%esi
+ 963:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 966:	8b 02                	mov    (%edx),%eax
+ 968:	8b 00                	mov    (%eax),%eax
+ 96a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 96d:	8b 42 04             	mov    0x4(%edx),%eax
+ 970:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 973:	39 f1                	cmp    %esi,%ecx
+ 975:	75 c8                	jne    93f <free+0x3f>
+    p->s.size += bp->s.size;
+ 977:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 97a:	89 15 c0 10 00 00    	mov    %edx,0x10c0
+    p->s.size += bp->s.size;
+ 980:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 983:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 986:	89 0a                	mov    %ecx,(%edx)
+}
+ 988:	5b                   	pop    %ebx
+ 989:	5e                   	pop    %esi
+ 98a:	5f                   	pop    %edi
+ 98b:	5d                   	pop    %ebp
+ 98c:	c3                   	ret
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000990 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 999:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 99c:	8b 15 c0 10 00 00    	mov    0x10c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9a5:	c1 ef 03             	shr    $0x3,%edi
+ 9a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9ab:	85 d2                	test   %edx,%edx
+ 9ad:	0f 84 8d 00 00 00    	je     a40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9b8:	39 f9                	cmp    %edi,%ecx
+ 9ba:	73 64                	jae    a20 <malloc+0x90>
+  if(nu < 4096)
+ 9bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9c1:	39 df                	cmp    %ebx,%edi
+ 9c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9cd:	eb 0a                	jmp    9d9 <malloc+0x49>
+ 9cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d5:	39 f9                	cmp    %edi,%ecx
+ 9d7:	73 47                	jae    a20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9d9:	89 c2                	mov    %eax,%edx
+ 9db:	39 05 c0 10 00 00    	cmp    %eax,0x10c0
+ 9e1:	75 ed                	jne    9d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	56                   	push   %esi
+ 9e7:	e8 b1 fb ff ff       	call   59d <sbrk>
+  if(p == (char*)-1)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+ 9ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9f2:	74 1c                	je     a10 <malloc+0x80>
+  hp->s.size = nu;
+ 9f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9f7:	83 ec 0c             	sub    $0xc,%esp
+ 9fa:	83 c0 08             	add    $0x8,%eax
+ 9fd:	50                   	push   %eax
+ 9fe:	e8 fd fe ff ff       	call   900 <free>
+  return freep;
+ a03:	8b 15 c0 10 00 00    	mov    0x10c0,%edx
+      if((p = morecore(nunits)) == 0)
+ a09:	83 c4 10             	add    $0x10,%esp
+ a0c:	85 d2                	test   %edx,%edx
+ a0e:	75 c0                	jne    9d0 <malloc+0x40>
+        return 0;
+  }
+}
+ a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a13:	31 c0                	xor    %eax,%eax
+}
+ a15:	5b                   	pop    %ebx
+ a16:	5e                   	pop    %esi
+ a17:	5f                   	pop    %edi
+ a18:	5d                   	pop    %ebp
+ a19:	c3                   	ret
+ a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a20:	39 cf                	cmp    %ecx,%edi
+ a22:	74 4c                	je     a70 <malloc+0xe0>
+        p->s.size -= nunits;
+ a24:	29 f9                	sub    %edi,%ecx
+ a26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a2f:	89 15 c0 10 00 00    	mov    %edx,0x10c0
+}
+ a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a38:	83 c0 08             	add    $0x8,%eax
+}
+ a3b:	5b                   	pop    %ebx
+ a3c:	5e                   	pop    %esi
+ a3d:	5f                   	pop    %edi
+ a3e:	5d                   	pop    %ebp
+ a3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a40:	c7 05 c0 10 00 00 c4 	movl   $0x10c4,0x10c0
+ a47:	10 00 00 
+    base.s.size = 0;
+ a4a:	b8 c4 10 00 00       	mov    $0x10c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a4f:	c7 05 c4 10 00 00 c4 	movl   $0x10c4,0x10c4
+ a56:	10 00 00 
+    base.s.size = 0;
+ a59:	c7 05 c8 10 00 00 00 	movl   $0x0,0x10c8
+ a60:	00 00 00 
+    if(p->s.size >= nunits){
+ a63:	e9 54 ff ff ff       	jmp    9bc <malloc+0x2c>
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a70:	8b 08                	mov    (%eax),%ecx
+ a72:	89 0a                	mov    %ecx,(%edx)
+ a74:	eb b9                	jmp    a2f <malloc+0x9f>
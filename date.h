@@ -6,3 +6,9 @@ struct rtcdate {
   uint month;
   uint year;
 };
+
+// A length of time, for nanosleep().
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;  // 0 to 999999999
+};
@@ -2,16 +2,25 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct iovec;
+struct lockstat;
 struct pipe;
 struct proc;
+struct profsample;
 struct rtcdate;
+struct rusage;
+struct rwlock;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct traceev;
+struct trapframe;
+struct vdso;
 
 // bio.c
 void            binit(void);
+struct buf*     bnew(uint, uint);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
@@ -30,9 +39,14 @@ struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
+int             filepread(struct file*, char*, int n, uint off);
+int             filepwrite(struct file*, char*, int n, uint off);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int);
+int             filesplice(struct file*, struct file*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -50,6 +64,7 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+int             reservei(struct inode*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
@@ -78,6 +93,10 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(uchar, int);
+uint            lapiccalibrate(void);
+void            lapiconeshot(uint64);
+void            lapictimer(int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -97,15 +116,27 @@ void            picinit(void);
 
 // pipe.c
 int             pipealloc(struct file**, struct file**);
+int             pipebeginread(struct pipe*, char**, int);
+int             pipebeginwrite(struct pipe*, char**, int);
 void            pipeclose(struct pipe*, int);
+int             pipeendread(struct pipe*, int);
+void            pipeendwrite(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
+// prof.c
+void            profinit(void);
+int             profctl(int);
+void            profintr(struct trapframe*);
+int             profiling(void);
+int             profread(struct profsample*, int);
+
 // proc.c
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getrusage(int, struct rusage*, int);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
@@ -113,9 +144,14 @@ struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
+void            boost(void);
 void            sched(void);
+int             setaffinity(int, uint);
+int             setpriority(int, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             quantum(void);
+int             timeslice(int);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
@@ -129,10 +165,22 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            initlockkind(struct spinlock*, char*, int);
+int             lockclass(char*);
+int             lockstatread(struct lockstat*, int, int);
+void            lockstatsleep(int, int, uint64);
+int             lockstress(int, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// rwlock.c
+void            acquireread(struct rwlock*);
+void            acquirewrite(struct rwlock*);
+void            initrwlock(struct rwlock*, char*);
+void            releaseread(struct rwlock*);
+void            releasewrite(struct rwlock*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -150,6 +198,7 @@ char*           strncpy(char*, const char*, int);
 
 // syscall.c
 int             argint(int, int*);
+int             argarray(int, void**, int, int, int);
 int             argptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
@@ -157,13 +206,29 @@ int             fetchstr(uint, char**);
 void            syscall(void);
 
 // timer.c
+extern uint     ticks;
+extern struct spinlock tickslock;
+uint            readticks(void);
+int             sleepns(uint, uint);
+int             sleepticks(uint);
+int             sleepuntil(uint64);
+void            tickupdate(void);
+void            timerarm(void);
 void            timerinit(void);
+int             timerintr(struct trapframe*);
+void            timervdso(struct vdso*);
+
+// trace.c
+void            trace(int, uint, uint);
+int             tracectl(int);
+void            traceinit(void);
+int             traceread(struct traceev*, int);
 
 // trap.c
 void            idtinit(void);
-extern uint     ticks;
+void            sysenterinit(void);
+void            systrap(struct trapframe*);
 void            tvinit(void);
-extern struct spinlock tickslock;
 
 // uart.c
 void            uartinit(void);
@@ -185,6 +250,7 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             mapvdso(pde_t*, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
@@ -0,0 +1,1452 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 78 09 00 00       	push   $0x978
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 7a 09 00 00       	push   $0x97a
+  3e:	6a 01                	push   $0x1
+  40:	e8 0b 06 00 00       	call   650 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 7f 09 00 00       	push   $0x97f
+  55:	50                   	push   %eax
+  56:	68 7a 09 00 00       	push   $0x97a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 ee 05 00 00       	call   650 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 43 03 00 00       	call   3ad <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 2d 02 00 00       	call   3da <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 23 02 00 00       	call   425 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 3b 02 00 00       	call   452 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 d7 01 00 00       	call   3f8 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	56                   	push   %esi
+ 2b4:	53                   	push   %ebx
+ 2b5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 2be:	85 f6                	test   %esi,%esi
+ 2c0:	74 2e                	je     2f0 <memcmp+0x40>
+ 2c2:	01 c6                	add    %eax,%esi
+ 2c4:	eb 14                	jmp    2da <memcmp+0x2a>
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 2d6:	39 f0                	cmp    %esi,%eax
+ 2d8:	74 16                	je     2f0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 2da:	0f b6 0a             	movzbl (%edx),%ecx
+ 2dd:	0f b6 18             	movzbl (%eax),%ebx
+ 2e0:	38 d9                	cmp    %bl,%cl
+ 2e2:	74 ec                	je     2d0 <memcmp+0x20>
+      return *s1 - *s2;
+ 2e4:	0f b6 c1             	movzbl %cl,%eax
+ 2e7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 2e9:	5b                   	pop    %ebx
+ 2ea:	5e                   	pop    %esi
+ 2eb:	5d                   	pop    %ebp
+ 2ec:	c3                   	ret
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	5b                   	pop    %ebx
+  return 0;
+ 2f1:	31 c0                	xor    %eax,%eax
+}
+ 2f3:	5e                   	pop    %esi
+ 2f4:	5d                   	pop    %ebp
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 300:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 310:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 312:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 318:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 31e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 324:	c3                   	ret
+ 325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 330:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 332:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 338:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 33e:	c3                   	ret
+ 33f:	90                   	nop
+
+00000340 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 348:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 34d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 353:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 359:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 35f:	89 c6                	mov    %eax,%esi
+ 361:	f7 f7                	div    %edi
+ 363:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 365:	f7 e3                	mul    %ebx
+ 367:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 36a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 36d:	89 d3                	mov    %edx,%ebx
+ 36f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 372:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 374:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 376:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 37c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 381:	f7 e6                	mul    %esi
+ 383:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 389:	29 d9                	sub    %ebx,%ecx
+ 38b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 391:	01 c1                	add    %eax,%ecx
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5f                   	pop    %edi
+ 39c:	5d                   	pop    %ebp
+ 39d:	c3                   	ret
+
+0000039e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 39e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a3:	89 e1                	mov    %esp,%ecx
+ 3a5:	ba ac 03 00 00       	mov    $0x3ac,%edx
+ 3aa:	0f 34                	sysenter
+ 3ac:	c3                   	ret
+
+000003ad <exit>:
+SYSCALL(exit)
+ 3ad:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3b2:	89 e1                	mov    %esp,%ecx
+ 3b4:	ba bb 03 00 00       	mov    $0x3bb,%edx
+ 3b9:	0f 34                	sysenter
+ 3bb:	c3                   	ret
+
+000003bc <wait>:
+SYSCALL(wait)
+ 3bc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3c1:	89 e1                	mov    %esp,%ecx
+ 3c3:	ba ca 03 00 00       	mov    $0x3ca,%edx
+ 3c8:	0f 34                	sysenter
+ 3ca:	c3                   	ret
+
+000003cb <pipe>:
+SYSCALL(pipe)
+ 3cb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3d0:	89 e1                	mov    %esp,%ecx
+ 3d2:	ba d9 03 00 00       	mov    $0x3d9,%edx
+ 3d7:	0f 34                	sysenter
+ 3d9:	c3                   	ret
+
+000003da <read>:
+SYSCALL(read)
+ 3da:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3df:	89 e1                	mov    %esp,%ecx
+ 3e1:	ba e8 03 00 00       	mov    $0x3e8,%edx
+ 3e6:	0f 34                	sysenter
+ 3e8:	c3                   	ret
+
+000003e9 <write>:
+SYSCALL(write)
+ 3e9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ee:	89 e1                	mov    %esp,%ecx
+ 3f0:	ba f7 03 00 00       	mov    $0x3f7,%edx
+ 3f5:	0f 34                	sysenter
+ 3f7:	c3                   	ret
+
+000003f8 <close>:
+SYSCALL(close)
+ 3f8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3fd:	89 e1                	mov    %esp,%ecx
+ 3ff:	ba 06 04 00 00       	mov    $0x406,%edx
+ 404:	0f 34                	sysenter
+ 406:	c3                   	ret
+
+00000407 <kill>:
+SYSCALL(kill)
+ 407:	b8 06 00 00 00       	mov    $0x6,%eax
+ 40c:	89 e1                	mov    %esp,%ecx
+ 40e:	ba 15 04 00 00       	mov    $0x415,%edx
+ 413:	0f 34                	sysenter
+ 415:	c3                   	ret
+
+00000416 <exec>:
+SYSCALL(exec)
+ 416:	b8 07 00 00 00       	mov    $0x7,%eax
+ 41b:	89 e1                	mov    %esp,%ecx
+ 41d:	ba 24 04 00 00       	mov    $0x424,%edx
+ 422:	0f 34                	sysenter
+ 424:	c3                   	ret
+
+00000425 <open>:
+SYSCALL(open)
+ 425:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 42a:	89 e1                	mov    %esp,%ecx
+ 42c:	ba 33 04 00 00       	mov    $0x433,%edx
+ 431:	0f 34                	sysenter
+ 433:	c3                   	ret
+
+00000434 <mknod>:
+SYSCALL(mknod)
+ 434:	b8 11 00 00 00       	mov    $0x11,%eax
+ 439:	89 e1                	mov    %esp,%ecx
+ 43b:	ba 42 04 00 00       	mov    $0x442,%edx
+ 440:	0f 34                	sysenter
+ 442:	c3                   	ret
+
+00000443 <unlink>:
+SYSCALL(unlink)
+ 443:	b8 12 00 00 00       	mov    $0x12,%eax
+ 448:	89 e1                	mov    %esp,%ecx
+ 44a:	ba 51 04 00 00       	mov    $0x451,%edx
+ 44f:	0f 34                	sysenter
+ 451:	c3                   	ret
+
+00000452 <fstat>:
+SYSCALL(fstat)
+ 452:	b8 08 00 00 00       	mov    $0x8,%eax
+ 457:	89 e1                	mov    %esp,%ecx
+ 459:	ba 60 04 00 00       	mov    $0x460,%edx
+ 45e:	0f 34                	sysenter
+ 460:	c3                   	ret
+
+00000461 <link>:
+SYSCALL(link)
+ 461:	b8 13 00 00 00       	mov    $0x13,%eax
+ 466:	89 e1                	mov    %esp,%ecx
+ 468:	ba 6f 04 00 00       	mov    $0x46f,%edx
+ 46d:	0f 34                	sysenter
+ 46f:	c3                   	ret
+
+00000470 <mkdir>:
+SYSCALL(mkdir)
+ 470:	b8 14 00 00 00       	mov    $0x14,%eax
+ 475:	89 e1                	mov    %esp,%ecx
+ 477:	ba 7e 04 00 00       	mov    $0x47e,%edx
+ 47c:	0f 34                	sysenter
+ 47e:	c3                   	ret
+
+0000047f <chdir>:
+SYSCALL(chdir)
+ 47f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 484:	89 e1                	mov    %esp,%ecx
+ 486:	ba 8d 04 00 00       	mov    $0x48d,%edx
+ 48b:	0f 34                	sysenter
+ 48d:	c3                   	ret
+
+0000048e <dup>:
+SYSCALL(dup)
+ 48e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 493:	89 e1                	mov    %esp,%ecx
+ 495:	ba 9c 04 00 00       	mov    $0x49c,%edx
+ 49a:	0f 34                	sysenter
+ 49c:	c3                   	ret
+
+0000049d <sbrk>:
+SYSCALL(sbrk)
+ 49d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a2:	89 e1                	mov    %esp,%ecx
+ 4a4:	ba ab 04 00 00       	mov    $0x4ab,%edx
+ 4a9:	0f 34                	sysenter
+ 4ab:	c3                   	ret
+
+000004ac <sleep>:
+SYSCALL(sleep)
+ 4ac:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b1:	89 e1                	mov    %esp,%ecx
+ 4b3:	ba ba 04 00 00       	mov    $0x4ba,%edx
+ 4b8:	0f 34                	sysenter
+ 4ba:	c3                   	ret
+
+000004bb <fallocate>:
+SYSCALL(fallocate)
+ 4bb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c0:	89 e1                	mov    %esp,%ecx
+ 4c2:	ba c9 04 00 00       	mov    $0x4c9,%edx
+ 4c7:	0f 34                	sysenter
+ 4c9:	c3                   	ret
+
+000004ca <pread>:
+SYSCALL(pread)
+ 4ca:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4cf:	89 e1                	mov    %esp,%ecx
+ 4d1:	ba d8 04 00 00       	mov    $0x4d8,%edx
+ 4d6:	0f 34                	sysenter
+ 4d8:	c3                   	ret
+
+000004d9 <pwrite>:
+SYSCALL(pwrite)
+ 4d9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4de:	89 e1                	mov    %esp,%ecx
+ 4e0:	ba e7 04 00 00       	mov    $0x4e7,%edx
+ 4e5:	0f 34                	sysenter
+ 4e7:	c3                   	ret
+
+000004e8 <readv>:
+SYSCALL(readv)
+ 4e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4ed:	89 e1                	mov    %esp,%ecx
+ 4ef:	ba f6 04 00 00       	mov    $0x4f6,%edx
+ 4f4:	0f 34                	sysenter
+ 4f6:	c3                   	ret
+
+000004f7 <writev>:
+SYSCALL(writev)
+ 4f7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4fc:	89 e1                	mov    %esp,%ecx
+ 4fe:	ba 05 05 00 00       	mov    $0x505,%edx
+ 503:	0f 34                	sysenter
+ 505:	c3                   	ret
+
+00000506 <splice>:
+SYSCALL(splice)
+ 506:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 50b:	89 e1                	mov    %esp,%ecx
+ 50d:	ba 14 05 00 00       	mov    $0x514,%edx
+ 512:	0f 34                	sysenter
+ 514:	c3                   	ret
+
+00000515 <setpriority>:
+SYSCALL(setpriority)
+ 515:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 51a:	89 e1                	mov    %esp,%ecx
+ 51c:	ba 23 05 00 00       	mov    $0x523,%edx
+ 521:	0f 34                	sysenter
+ 523:	c3                   	ret
+
+00000524 <setaffinity>:
+SYSCALL(setaffinity)
+ 524:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 529:	89 e1                	mov    %esp,%ecx
+ 52b:	ba 32 05 00 00       	mov    $0x532,%edx
+ 530:	0f 34                	sysenter
+ 532:	c3                   	ret
+
+00000533 <lockstress>:
+SYSCALL(lockstress)
+ 533:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 538:	89 e1                	mov    %esp,%ecx
+ 53a:	ba 41 05 00 00       	mov    $0x541,%edx
+ 53f:	0f 34                	sysenter
+ 541:	c3                   	ret
+
+00000542 <lockstat>:
+SYSCALL(lockstat)
+ 542:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 547:	89 e1                	mov    %esp,%ecx
+ 549:	ba 50 05 00 00       	mov    $0x550,%edx
+ 54e:	0f 34                	sysenter
+ 550:	c3                   	ret
+
+00000551 <profctl>:
+SYSCALL(profctl)
+ 551:	b8 20 00 00 00       	mov    $0x20,%eax
+ 556:	89 e1                	mov    %esp,%ecx
+ 558:	ba 5f 05 00 00       	mov    $0x55f,%edx
+ 55d:	0f 34                	sysenter
+ 55f:	c3                   	ret
+
+00000560 <profread>:
+SYSCALL(profread)
+ 560:	b8 21 00 00 00       	mov    $0x21,%eax
+ 565:	89 e1                	mov    %esp,%ecx
+ 567:	ba 6e 05 00 00       	mov    $0x56e,%edx
+ 56c:	0f 34                	sysenter
+ 56e:	c3                   	ret
+
+0000056f <getrusage>:
+SYSCALL(getrusage)
+ 56f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 574:	89 e1                	mov    %esp,%ecx
+ 576:	ba 7d 05 00 00       	mov    $0x57d,%edx
+ 57b:	0f 34                	sysenter
+ 57d:	c3                   	ret
+
+0000057e <tracectl>:
+SYSCALL(tracectl)
+ 57e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 583:	89 e1                	mov    %esp,%ecx
+ 585:	ba 8c 05 00 00       	mov    $0x58c,%edx
+ 58a:	0f 34                	sysenter
+ 58c:	c3                   	ret
+
+0000058d <traceread>:
+SYSCALL(traceread)
+ 58d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 592:	89 e1                	mov    %esp,%ecx
+ 594:	ba 9b 05 00 00       	mov    $0x59b,%edx
+ 599:	0f 34                	sysenter
+ 59b:	c3                   	ret
+
+0000059c <nanosleep>:
+SYSCALL(nanosleep)
+ 59c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5a1:	89 e1                	mov    %esp,%ecx
+ 5a3:	ba aa 05 00 00       	mov    $0x5aa,%edx
+ 5a8:	0f 34                	sysenter
+ 5aa:	c3                   	ret
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 e0 09 00 00 	movzbl 0x9e0(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 bc fd ff ff       	call   3e9 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 52 fd ff ff       	call   3e9 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 88 09 00 00 	jmp    *0x988(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 f3 fc ff ff       	call   3e9 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 e1 fc ff ff       	call   3e9 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 67 fc ff ff       	call   3e9 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 17 fc ff ff       	call   3e9 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb 81 09 00 00       	mov    $0x981,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 800:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	a1 24 0d 00 00       	mov    0xd24,%eax
+{
+ 806:	89 e5                	mov    %esp,%ebp
+ 808:	57                   	push   %edi
+ 809:	56                   	push   %esi
+ 80a:	53                   	push   %ebx
+ 80b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 80e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 818:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 81a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 81c:	39 ca                	cmp    %ecx,%edx
+ 81e:	73 30                	jae    850 <free+0x50>
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 04                	jb     828 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 824:	39 c2                	cmp    %eax,%edx
+ 826:	72 f0                	jb     818 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 828:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 82b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 82e:	39 f8                	cmp    %edi,%eax
+ 830:	74 2e                	je     860 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 832:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 835:	8b 42 04             	mov    0x4(%edx),%eax
+ 838:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 83b:	39 f1                	cmp    %esi,%ecx
+ 83d:	74 38                	je     877 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 83f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 841:	5b                   	pop    %ebx
+  freep = p;
+ 842:	89 15 24 0d 00 00    	mov    %edx,0xd24
+}
+ 848:	5e                   	pop    %esi
+ 849:	5f                   	pop    %edi
+ 84a:	5d                   	pop    %ebp
+ 84b:	c3                   	ret
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 d0                	jb     824 <free+0x24>
+ 854:	eb c2                	jmp    818 <free+0x18>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 860:	03 70 04             	add    0x4(%eax),%esi
+ 863:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 866:	8b 02                	mov    (%edx),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 86d:	8b 42 04             	mov    0x4(%edx),%eax
+ 870:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 873:	39 f1                	cmp    %esi,%ecx
+ 875:	75 c8                	jne    83f <free+0x3f>
+    p->s.size += bp->s.size;
+ 877:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 87a:	89 15 24 0d 00 00    	mov    %edx,0xd24
+    p->s.size += bp->s.size;
+ 880:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 883:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 886:	89 0a                	mov    %ecx,(%edx)
+}
+ 888:	5b                   	pop    %ebx
+ 889:	5e                   	pop    %esi
+ 88a:	5f                   	pop    %edi
+ 88b:	5d                   	pop    %ebp
+ 88c:	c3                   	ret
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000890 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 899:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 89c:	8b 15 24 0d 00 00    	mov    0xd24,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8a5:	c1 ef 03             	shr    $0x3,%edi
+ 8a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8ab:	85 d2                	test   %edx,%edx
+ 8ad:	0f 84 8d 00 00 00    	je     940 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b8:	39 f9                	cmp    %edi,%ecx
+ 8ba:	73 64                	jae    920 <malloc+0x90>
+  if(nu < 4096)
+ 8bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8c1:	39 df                	cmp    %ebx,%edi
+ 8c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8cd:	eb 0a                	jmp    8d9 <malloc+0x49>
+ 8cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d5:	39 f9                	cmp    %edi,%ecx
+ 8d7:	73 47                	jae    920 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8d9:	89 c2                	mov    %eax,%edx
+ 8db:	39 05 24 0d 00 00    	cmp    %eax,0xd24
+ 8e1:	75 ed                	jne    8d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	56                   	push   %esi
+ 8e7:	e8 b1 fb ff ff       	call   49d <sbrk>
+  if(p == (char*)-1)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+ 8ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8f2:	74 1c                	je     910 <malloc+0x80>
+  hp->s.size = nu;
+ 8f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8f7:	83 ec 0c             	sub    $0xc,%esp
+ 8fa:	83 c0 08             	add    $0x8,%eax
+ 8fd:	50                   	push   %eax
+ 8fe:	e8 fd fe ff ff       	call   800 <free>
+  return freep;
+ 903:	8b 15 24 0d 00 00    	mov    0xd24,%edx
+      if((p = morecore(nunits)) == 0)
+ 909:	83 c4 10             	add    $0x10,%esp
+ 90c:	85 d2                	test   %edx,%edx
+ 90e:	75 c0                	jne    8d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 913:	31 c0                	xor    %eax,%eax
+}
+ 915:	5b                   	pop    %ebx
+ 916:	5e                   	pop    %esi
+ 917:	5f                   	pop    %edi
+ 918:	5d                   	pop    %ebp
+ 919:	c3                   	ret
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 920:	39 cf                	cmp    %ecx,%edi
+ 922:	74 4c                	je     970 <malloc+0xe0>
+        p->s.size -= nunits;
+ 924:	29 f9                	sub    %edi,%ecx
+ 926:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 929:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 92c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 92f:	89 15 24 0d 00 00    	mov    %edx,0xd24
+}
+ 935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 938:	83 c0 08             	add    $0x8,%eax
+}
+ 93b:	5b                   	pop    %ebx
+ 93c:	5e                   	pop    %esi
+ 93d:	5f                   	pop    %edi
+ 93e:	5d                   	pop    %ebp
+ 93f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 940:	c7 05 24 0d 00 00 28 	movl   $0xd28,0xd24
+ 947:	0d 00 00 
+    base.s.size = 0;
+ 94a:	b8 28 0d 00 00       	mov    $0xd28,%eax
+    base.s.ptr = freep = prevp = &base;
+ 94f:	c7 05 28 0d 00 00 28 	movl   $0xd28,0xd28
+ 956:	0d 00 00 
+    base.s.size = 0;
+ 959:	c7 05 2c 0d 00 00 00 	movl   $0x0,0xd2c
+ 960:	00 00 00 
+    if(p->s.size >= nunits){
+ 963:	e9 54 ff ff ff       	jmp    8bc <malloc+0x2c>
+ 968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 970:	8b 08                	mov    (%eax),%ecx
+ 972:	89 0a                	mov    %ecx,(%edx)
+ 974:	eb b9                	jmp    92f <malloc+0x9f>
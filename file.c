@@ -5,21 +5,56 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "x86.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "uio.h"
+
+// Unused file structures are kept on a free list, so allocating
+// one doesn't scan the table. The list starts out with the NFILE
+// static entries and grows a page of entries at a time when they
+// run out. ftable.lock protects only the free list: f->ref is
+// updated with atomic instructions, so filedup() and the common
+// case of fileclose() take no lock at all.
 
 struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
   struct file file[NFILE];
+  struct file *free;  // unused files, linked through f->next
 } ftable;
 
 void
 fileinit(void)
 {
+  struct file *f;
+
   initlock(&ftable.lock, "ftable");
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+    f->next = ftable.free;
+    ftable.free = f;
+  }
+}
+
+// Add a page of new file structures to the free list.
+// The page is never given back.
+// Caller must hold ftable.lock.
+static void
+filegrow(void)
+{
+  char *mem;
+  struct file *f;
+
+  if((mem = kalloc()) == 0)
+    return;
+  memset(mem, 0, PGSIZE);
+  for(f = (struct file*)mem; f + 1 <= (struct file*)(mem + PGSIZE); f++){
+    f->next = ftable.free;
+    ftable.free = f;
+  }
 }
 
 // Allocate a file structure.
@@ -29,26 +64,22 @@ filealloc(void)
   struct file *f;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(ftable.free == 0)
+    filegrow();
+  if((f = ftable.free) != 0){
+    ftable.free = f->next;
+    f->ref = 1;
   }
   release(&ftable.lock);
-  return 0;
+  return f;
 }
 
 // Increment ref count for file f.
 struct file*
 filedup(struct file *f)
 {
-  acquire(&ftable.lock);
-  if(f->ref < 1)
+  if(xadd(&f->ref, 1) < 1)
     panic("filedup");
-  f->ref++;
-  release(&ftable.lock);
   return f;
 }
 
@@ -57,17 +88,20 @@ void
 fileclose(struct file *f)
 {
   struct file ff;
+  int ref;
 
-  acquire(&ftable.lock);
-  if(f->ref < 1)
+  ref = xadd(&f->ref, -1);
+  if(ref < 1)
     panic("fileclose");
-  if(--f->ref > 0){
-    release(&ftable.lock);
+  if(ref > 1)
     return;
-  }
+
+  // That was the last reference, so nobody else can see f.
   ff = *f;
-  f->ref = 0;
   f->type = FD_NONE;
+  acquire(&ftable.lock);
+  f->next = ftable.free;
+  ftable.free = f;
   release(&ftable.lock);
 
   if(ff.type == FD_PIPE)
@@ -92,24 +126,110 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// Read n bytes from inode file f at *poff, advancing *poff.
+static int
+readat(struct file *f, char *addr, int n, uint *poff)
+{
+  int r;
+
+  ilock(f->ip);
+  if((r = readi(f->ip, addr, *poff, n)) > 0)
+    *poff += r;
+  iunlock(f->ip);
+  return r;
+}
+
+// Write n bytes to inode file f at *poff, advancing *poff.
+static int
+writeat(struct file *f, char *addr, int n, uint *poff)
+{
+  int r;
+
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size, including
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int i = 0;
+  while(i < n){
+    int n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *poff, n1)) > 0)
+      *poff += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    if(r != n1)
+      panic("short filewrite");
+    i += r;
+  }
+  return i == n ? n : -1;
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
-  if(f->type == FD_INODE){
+  if(f->type == FD_INODE)
+    return readat(f, addr, n, &f->off);
+  panic("fileread");
+}
+
+// Read from file f at offset off, leaving f->off alone.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  return readat(f, addr, n, &off);
+}
+
+// Read from file f into each of the cnt buffers in iov in turn,
+// stopping early at a short read. An inode is locked only once
+// for the whole request. A pipe is read only until some data
+// arrives, as read() would, rather than wait to fill every buffer.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, r, tot;
+
+  if(f->readable == 0)
+    return -1;
+  if(f->type != FD_PIPE && f->type != FD_INODE)
+    panic("filereadv");
+
+  tot = 0;
+  if(f->type == FD_INODE)
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+  for(i = 0; i < cnt; i++){
+    if(f->type == FD_PIPE)
+      r = piperead(f->pipe, iov[i].iov_base, iov[i].iov_len);
+    else if((r = readi(f->ip, iov[i].iov_base, f->off, iov[i].iov_len)) > 0)
       f->off += r;
-    iunlock(f->ip);
-    return r;
+    if(r < 0){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    tot += r;
+    if(r < iov[i].iov_len || f->type == FD_PIPE)
+      break;
   }
-  panic("fileread");
+  if(f->type == FD_INODE)
+    iunlock(f->ip);
+  return tot;
 }
 
 //PAGEBREAK!
@@ -117,41 +237,131 @@ fileread(struct file *f, char *addr, int n)
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+  if(f->type == FD_INODE)
+    return writeat(f, addr, n, &f->off);
+  panic("filewrite");
+}
+
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  return writeat(f, addr, n, &off);
+}
+
+// Write each of the cnt buffers in iov to file f in turn.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+  int i, tot;
+
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+    if(filewrite(f, iov[i].iov_base, iov[i].iov_len) < 0)
+      return tot > 0 ? tot : -1;
+    tot += iov[i].iov_len;
+  }
+  return tot;
+}
+
+//PAGEBREAK!
+// Move data from an inode into a pipe: readi() copies it from the
+// buffer cache straight into the pipe's ring.
+static int
+splicetopipe(struct file *in, struct pipe *p, int n)
+{
+  int m, r, tot;
+  char *dst;
+
+  for(tot = 0; tot < n; tot += r){
+    if((m = pipebeginwrite(p, &dst, n - tot)) < 0)
+      return tot > 0 ? tot : -1;
+    r = readat(in, dst, m, &in->off);
+    pipeendwrite(p, r > 0 ? r : 0);
+    if(r < 0)
+      return tot > 0 ? tot : -1;
+    if(r < m){
+      tot += r;
+      break;
     }
-    return i == n ? n : -1;
   }
-  panic("filewrite");
+  return tot;
 }
 
+// Move data from a pipe into an inode: writei() copies it from
+// the pipe's ring straight into the buffer cache. Like read(),
+// stops once the pipe is empty rather than waiting for more.
+static int
+splicefrompipe(struct pipe *p, struct file *out, int n)
+{
+  int m, r, tot;
+  char *src;
+
+  for(tot = 0; tot < n; tot += r){
+    if((m = pipebeginread(p, &src, n - tot)) <= 0){
+      if(m < 0 && tot == 0)
+        return -1;
+      break;
+    }
+    r = writeat(out, src, m, &out->off);
+    if(pipeendread(p, r > 0 ? r : 0) == 0 && r > 0){
+      tot += r;
+      break;
+    }
+    if(r < 0)
+      return tot > 0 ? tot : -1;
+  }
+  return tot;
+}
+
+// Move data between any other pair of files through a kernel
+// page, which still saves the copies to and from user space.
+static int
+splicecopy(struct file *in, struct file *out, int n)
+{
+  int m, r, tot;
+  char *buf;
+
+  if((buf = kalloc()) == 0)
+    return -1;
+  for(tot = 0; tot < n; tot += r){
+    m = n - tot < PGSIZE ? n - tot : PGSIZE;
+    if((r = fileread(in, buf, m)) <= 0){
+      if(r < 0 && tot == 0)
+        tot = -1;
+      break;
+    }
+    if(filewrite(out, buf, r) != r){
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    if(r < m || in->type == FD_PIPE){
+      tot += r;
+      break;
+    }
+  }
+  kfree(buf);
+  return tot;
+}
+
+// Move up to n bytes from file in to file out without passing
+// them through user space. Returns the number of bytes moved,
+// 0 at end of file, or -1 on error.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+  if(in->readable == 0 || out->writable == 0)
+    return -1;
+  if(in->type == FD_INODE && out->type == FD_PIPE)
+    return splicetopipe(in, out->pipe, n);
+  if(in->type == FD_PIPE && out->type == FD_INODE)
+    return splicefrompipe(in->pipe, out, n);
+  return splicecopy(in, out, n);
+}
@@ -0,0 +1,1579 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nother, CYCLES, ticks, CYCLES * HZ / ticks);
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  for(i = 0; i < sizeof(others)/sizeof(others[0]); i++)
+    bench(others[i]);
+  11:	ff 35 f4 0e 00 00    	push   0xef4
+  17:	e8 24 00 00 00       	call   40 <bench>
+  1c:	58                   	pop    %eax
+  1d:	ff 35 f8 0e 00 00    	push   0xef8
+  23:	e8 18 00 00 00       	call   40 <bench>
+  28:	5a                   	pop    %edx
+  29:	ff 35 fc 0e 00 00    	push   0xefc
+  2f:	e8 0c 00 00 00       	call   40 <bench>
+  exit();
+  34:	e8 94 04 00 00       	call   4cd <exit>
+  39:	66 90                	xchg   %ax,%ax
+  3b:	66 90                	xchg   %ax,%ax
+  3d:	66 90                	xchg   %ax,%ax
+  3f:	90                   	nop
+
+00000040 <bench>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  if(pipe(hold) < 0){
+  45:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+  48:	53                   	push   %ebx
+  49:	83 ec 38             	sub    $0x38,%esp
+  4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(pipe(hold) < 0){
+  4f:	50                   	push   %eax
+  50:	e8 96 04 00 00       	call   4eb <pipe>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	0f 88 15 01 00 00    	js     175 <bench+0x135>
+  for(i = 0; i < nother; i++){
+  60:	31 db                	xor    %ebx,%ebx
+  62:	85 f6                	test   %esi,%esi
+  64:	7e 24                	jle    8a <bench+0x4a>
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) < 0){
+  70:	e8 49 04 00 00       	call   4be <fork>
+  75:	85 c0                	test   %eax,%eax
+  77:	0f 88 aa 00 00 00    	js     127 <bench+0xe7>
+    if(pid == 0){
+  7d:	0f 84 d1 00 00 00    	je     154 <bench+0x114>
+  for(i = 0; i < nother; i++){
+  83:	83 c3 01             	add    $0x1,%ebx
+  86:	39 de                	cmp    %ebx,%esi
+  88:	75 e6                	jne    70 <bench+0x30>
+  close(hold[0]);
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 e0             	push   -0x20(%ebp)
+  start = uptime();
+  90:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  close(hold[0]);
+  95:	e8 7e 04 00 00       	call   518 <close>
+  start = uptime();
+  9a:	e8 91 03 00 00       	call   430 <uptime>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < CYCLES; i++){
+  a5:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) < 0){
+  a8:	e8 11 04 00 00       	call   4be <fork>
+  ad:	89 c7                	mov    %eax,%edi
+  af:	85 c0                	test   %eax,%eax
+  b1:	78 74                	js     127 <bench+0xe7>
+    if(pid == 0)
+  b3:	0f 84 96 00 00 00    	je     14f <bench+0x10f>
+    if(wait() != pid){
+  b9:	e8 1e 04 00 00       	call   4dc <wait>
+  be:	39 f8                	cmp    %edi,%eax
+  c0:	75 79                	jne    13b <bench+0xfb>
+  for(i = 0; i < CYCLES; i++){
+  c2:	83 eb 01             	sub    $0x1,%ebx
+  c5:	75 e1                	jne    a8 <bench+0x68>
+  ticks = uptime() - start;
+  c7:	e8 64 03 00 00       	call   430 <uptime>
+    ticks = 1;
+  cc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  cf:	29 c8                	sub    %ecx,%eax
+  d1:	89 c3                	mov    %eax,%ebx
+  d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  d8:	0f 44 d8             	cmove  %eax,%ebx
+  close(hold[1]);
+  db:	83 ec 0c             	sub    $0xc,%esp
+  de:	ff 75 e4             	push   -0x1c(%ebp)
+  e1:	e8 32 04 00 00       	call   518 <close>
+  for(i = 0; i < nother; i++)
+  e6:	83 c4 10             	add    $0x10,%esp
+  e9:	85 f6                	test   %esi,%esi
+  eb:	7e 0f                	jle    fc <bench+0xbc>
+  ed:	31 ff                	xor    %edi,%edi
+  ef:	90                   	nop
+    wait();
+  f0:	e8 e7 03 00 00       	call   4dc <wait>
+  for(i = 0; i < nother; i++)
+  f5:	83 c7 01             	add    $0x1,%edi
+  f8:	39 fe                	cmp    %edi,%esi
+  fa:	75 f4                	jne    f0 <bench+0xb0>
+  printf(1, "%d other children: %d cycles in %d ticks, %d cycles/s\n",
+  fc:	b8 a0 86 01 00       	mov    $0x186a0,%eax
+ 101:	31 d2                	xor    %edx,%edx
+ 103:	83 ec 08             	sub    $0x8,%esp
+ 106:	f7 fb                	idiv   %ebx
+ 108:	50                   	push   %eax
+ 109:	53                   	push   %ebx
+ 10a:	68 e8 03 00 00       	push   $0x3e8
+ 10f:	56                   	push   %esi
+ 110:	68 f4 0a 00 00       	push   $0xaf4
+ 115:	6a 01                	push   $0x1
+ 117:	e8 54 06 00 00       	call   770 <printf>
+}
+ 11c:	83 c4 20             	add    $0x20,%esp
+ 11f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 122:	5b                   	pop    %ebx
+ 123:	5e                   	pop    %esi
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+      printf(2, "forkbench: fork failed\n");
+ 127:	83 ec 08             	sub    $0x8,%esp
+ 12a:	68 b0 0a 00 00       	push   $0xab0
+ 12f:	6a 02                	push   $0x2
+ 131:	e8 3a 06 00 00       	call   770 <printf>
+      exit();
+ 136:	e8 92 03 00 00       	call   4cd <exit>
+      printf(2, "forkbench: wait returned the wrong child\n");
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	68 c8 0a 00 00       	push   $0xac8
+ 143:	6a 02                	push   $0x2
+ 145:	e8 26 06 00 00       	call   770 <printf>
+      exit();
+ 14a:	e8 7e 03 00 00       	call   4cd <exit>
+      exit();
+ 14f:	e8 79 03 00 00       	call   4cd <exit>
+      close(hold[1]);
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	ff 75 e4             	push   -0x1c(%ebp)
+ 15a:	e8 b9 03 00 00       	call   518 <close>
+      read(hold[0], &c, 1);
+ 15f:	83 c4 0c             	add    $0xc,%esp
+ 162:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 165:	6a 01                	push   $0x1
+ 167:	50                   	push   %eax
+ 168:	ff 75 e0             	push   -0x20(%ebp)
+ 16b:	e8 8a 03 00 00       	call   4fa <read>
+      exit();
+ 170:	e8 58 03 00 00       	call   4cd <exit>
+    printf(2, "forkbench: pipe failed\n");
+ 175:	50                   	push   %eax
+ 176:	50                   	push   %eax
+ 177:	68 98 0a 00 00       	push   $0xa98
+ 17c:	6a 02                	push   $0x2
+ 17e:	e8 ed 05 00 00       	call   770 <printf>
+    exit();
+ 183:	e8 45 03 00 00       	call   4cd <exit>
+ 188:	66 90                	xchg   %ax,%ax
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 190:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 191:	31 c0                	xor    %eax,%eax
+{
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	53                   	push   %ebx
+ 196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 199:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1a7:	83 c0 01             	add    $0x1,%eax
+ 1aa:	84 d2                	test   %dl,%dl
+ 1ac:	75 f2                	jne    1a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b1:	89 c8                	mov    %ecx,%eax
+ 1b3:	c9                   	leave
+ 1b4:	c3                   	ret
+ 1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	53                   	push   %ebx
+ 1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ca:	0f b6 02             	movzbl (%edx),%eax
+ 1cd:	84 c0                	test   %al,%al
+ 1cf:	75 17                	jne    1e8 <strcmp+0x28>
+ 1d1:	eb 3a                	jmp    20d <strcmp+0x4d>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1dc:	83 c2 01             	add    $0x1,%edx
+ 1df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1e2:	84 c0                	test   %al,%al
+ 1e4:	74 1a                	je     200 <strcmp+0x40>
+    p++, q++;
+ 1e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1eb:	38 c3                	cmp    %al,%bl
+ 1ed:	74 e9                	je     1d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ef:	29 d8                	sub    %ebx,%eax
+}
+ 1f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f4:	c9                   	leave
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 200:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 204:	31 c0                	xor    %eax,%eax
+ 206:	29 d8                	sub    %ebx,%eax
+}
+ 208:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 20b:	c9                   	leave
+ 20c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 20d:	0f b6 19             	movzbl (%ecx),%ebx
+ 210:	31 c0                	xor    %eax,%eax
+ 212:	eb db                	jmp    1ef <strcmp+0x2f>
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 226:	80 3a 00             	cmpb   $0x0,(%edx)
+ 229:	74 15                	je     240 <strlen+0x20>
+ 22b:	31 c0                	xor    %eax,%eax
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+ 230:	83 c0 01             	add    $0x1,%eax
+ 233:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 237:	89 c1                	mov    %eax,%ecx
+ 239:	75 f5                	jne    230 <strlen+0x10>
+    ;
+  return n;
+}
+ 23b:	89 c8                	mov    %ecx,%eax
+ 23d:	5d                   	pop    %ebp
+ 23e:	c3                   	ret
+ 23f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 240:	31 c9                	xor    %ecx,%ecx
+}
+ 242:	5d                   	pop    %ebp
+ 243:	89 c8                	mov    %ecx,%eax
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 257:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25d:	89 d7                	mov    %edx,%edi
+ 25f:	fc                   	cld
+ 260:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 262:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 265:	89 d0                	mov    %edx,%eax
+ 267:	c9                   	leave
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 27a:	0f b6 10             	movzbl (%eax),%edx
+ 27d:	84 d2                	test   %dl,%dl
+ 27f:	75 12                	jne    293 <strchr+0x23>
+ 281:	eb 1d                	jmp    2a0 <strchr+0x30>
+ 283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 287:	90                   	nop
+ 288:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 28c:	83 c0 01             	add    $0x1,%eax
+ 28f:	84 d2                	test   %dl,%dl
+ 291:	74 0d                	je     2a0 <strchr+0x30>
+    if(*s == c)
+ 293:	38 d1                	cmp    %dl,%cl
+ 295:	75 f1                	jne    288 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 297:	5d                   	pop    %ebp
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2a0:	31 c0                	xor    %eax,%eax
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	c3                   	ret
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2b9:	31 db                	xor    %ebx,%ebx
+{
+ 2bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2be:	eb 27                	jmp    2e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	6a 01                	push   $0x1
+ 2c5:	56                   	push   %esi
+ 2c6:	6a 00                	push   $0x0
+ 2c8:	e8 2d 02 00 00       	call   4fa <read>
+    if(cc < 1)
+ 2cd:	83 c4 10             	add    $0x10,%esp
+ 2d0:	85 c0                	test   %eax,%eax
+ 2d2:	7e 1d                	jle    2f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2df:	3c 0a                	cmp    $0xa,%al
+ 2e1:	74 10                	je     2f3 <gets+0x43>
+ 2e3:	3c 0d                	cmp    $0xd,%al
+ 2e5:	74 0c                	je     2f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2e7:	89 df                	mov    %ebx,%edi
+ 2e9:	83 c3 01             	add    $0x1,%ebx
+ 2ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ef:	7c cf                	jl     2c0 <gets+0x10>
+ 2f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2fd:	5b                   	pop    %ebx
+ 2fe:	5e                   	pop    %esi
+ 2ff:	5f                   	pop    %edi
+ 300:	5d                   	pop    %ebp
+ 301:	c3                   	ret
+ 302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+ 314:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	6a 00                	push   $0x0
+ 31a:	ff 75 08             	push   0x8(%ebp)
+ 31d:	e8 23 02 00 00       	call   545 <open>
+  if(fd < 0)
+ 322:	83 c4 10             	add    $0x10,%esp
+ 325:	85 c0                	test   %eax,%eax
+ 327:	78 27                	js     350 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 329:	83 ec 08             	sub    $0x8,%esp
+ 32c:	ff 75 0c             	push   0xc(%ebp)
+ 32f:	89 c3                	mov    %eax,%ebx
+ 331:	50                   	push   %eax
+ 332:	e8 3b 02 00 00       	call   572 <fstat>
+  close(fd);
+ 337:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 33a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 33c:	e8 d7 01 00 00       	call   518 <close>
+  return r;
+ 341:	83 c4 10             	add    $0x10,%esp
+}
+ 344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 347:	89 f0                	mov    %esi,%eax
+ 349:	5b                   	pop    %ebx
+ 34a:	5e                   	pop    %esi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 355:	eb ed                	jmp    344 <stat+0x34>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 367:	0f be 02             	movsbl (%edx),%eax
+ 36a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 36d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 375:	77 1e                	ja     395 <atoi+0x35>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 386:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 38a:	0f be 02             	movsbl (%edx),%eax
+ 38d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 390:	80 fb 09             	cmp    $0x9,%bl
+ 393:	76 eb                	jbe    380 <atoi+0x20>
+  return n;
+}
+ 395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 398:	89 c8                	mov    %ecx,%eax
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	7e 13                	jle    3c5 <memmove+0x25>
+ 3b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3b4:	89 d7                	mov    %edx,%edi
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3c1:	39 f8                	cmp    %edi,%eax
+ 3c3:	75 fb                	jne    3c0 <memmove+0x20>
+  return vdst;
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	89 d0                	mov    %edx,%eax
+ 3c8:	5f                   	pop    %edi
+ 3c9:	5d                   	pop    %ebp
+ 3ca:	c3                   	ret
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+ 3d5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 3de:	85 f6                	test   %esi,%esi
+ 3e0:	74 2e                	je     410 <memcmp+0x40>
+ 3e2:	01 c6                	add    %eax,%esi
+ 3e4:	eb 14                	jmp    3fa <memcmp+0x2a>
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 3f6:	39 f0                	cmp    %esi,%eax
+ 3f8:	74 16                	je     410 <memcmp+0x40>
+    if(*s1 != *s2)
+ 3fa:	0f b6 0a             	movzbl (%edx),%ecx
+ 3fd:	0f b6 18             	movzbl (%eax),%ebx
+ 400:	38 d9                	cmp    %bl,%cl
+ 402:	74 ec                	je     3f0 <memcmp+0x20>
+      return *s1 - *s2;
+ 404:	0f b6 c1             	movzbl %cl,%eax
+ 407:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	5b                   	pop    %ebx
+  return 0;
+ 411:	31 c0                	xor    %eax,%eax
+}
+ 413:	5e                   	pop    %esi
+ 414:	5d                   	pop    %ebp
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 420:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 430:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 432:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 438:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 43e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 444:	c3                   	ret
+ 445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 450:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 452:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 458:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+
+00000460 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	53                   	push   %ebx
+ 466:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 468:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 46d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 473:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 479:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 47f:	89 c6                	mov    %eax,%esi
+ 481:	f7 f7                	div    %edi
+ 483:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 485:	f7 e3                	mul    %ebx
+ 487:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 48a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 48d:	89 d3                	mov    %edx,%ebx
+ 48f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 492:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 494:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 496:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 49c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 4a1:	f7 e6                	mul    %esi
+ 4a3:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 4a9:	29 d9                	sub    %ebx,%ecx
+ 4ab:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 4b1:	01 c1                	add    %eax,%ecx
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5f                   	pop    %edi
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+
+000004be <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 4be:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c3:	89 e1                	mov    %esp,%ecx
+ 4c5:	ba cc 04 00 00       	mov    $0x4cc,%edx
+ 4ca:	0f 34                	sysenter
+ 4cc:	c3                   	ret
+
+000004cd <exit>:
+SYSCALL(exit)
+ 4cd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d2:	89 e1                	mov    %esp,%ecx
+ 4d4:	ba db 04 00 00       	mov    $0x4db,%edx
+ 4d9:	0f 34                	sysenter
+ 4db:	c3                   	ret
+
+000004dc <wait>:
+SYSCALL(wait)
+ 4dc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4e1:	89 e1                	mov    %esp,%ecx
+ 4e3:	ba ea 04 00 00       	mov    $0x4ea,%edx
+ 4e8:	0f 34                	sysenter
+ 4ea:	c3                   	ret
+
+000004eb <pipe>:
+SYSCALL(pipe)
+ 4eb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f0:	89 e1                	mov    %esp,%ecx
+ 4f2:	ba f9 04 00 00       	mov    $0x4f9,%edx
+ 4f7:	0f 34                	sysenter
+ 4f9:	c3                   	ret
+
+000004fa <read>:
+SYSCALL(read)
+ 4fa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4ff:	89 e1                	mov    %esp,%ecx
+ 501:	ba 08 05 00 00       	mov    $0x508,%edx
+ 506:	0f 34                	sysenter
+ 508:	c3                   	ret
+
+00000509 <write>:
+SYSCALL(write)
+ 509:	b8 10 00 00 00       	mov    $0x10,%eax
+ 50e:	89 e1                	mov    %esp,%ecx
+ 510:	ba 17 05 00 00       	mov    $0x517,%edx
+ 515:	0f 34                	sysenter
+ 517:	c3                   	ret
+
+00000518 <close>:
+SYSCALL(close)
+ 518:	b8 15 00 00 00       	mov    $0x15,%eax
+ 51d:	89 e1                	mov    %esp,%ecx
+ 51f:	ba 26 05 00 00       	mov    $0x526,%edx
+ 524:	0f 34                	sysenter
+ 526:	c3                   	ret
+
+00000527 <kill>:
+SYSCALL(kill)
+ 527:	b8 06 00 00 00       	mov    $0x6,%eax
+ 52c:	89 e1                	mov    %esp,%ecx
+ 52e:	ba 35 05 00 00       	mov    $0x535,%edx
+ 533:	0f 34                	sysenter
+ 535:	c3                   	ret
+
+00000536 <exec>:
+SYSCALL(exec)
+ 536:	b8 07 00 00 00       	mov    $0x7,%eax
+ 53b:	89 e1                	mov    %esp,%ecx
+ 53d:	ba 44 05 00 00       	mov    $0x544,%edx
+ 542:	0f 34                	sysenter
+ 544:	c3                   	ret
+
+00000545 <open>:
+SYSCALL(open)
+ 545:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 54a:	89 e1                	mov    %esp,%ecx
+ 54c:	ba 53 05 00 00       	mov    $0x553,%edx
+ 551:	0f 34                	sysenter
+ 553:	c3                   	ret
+
+00000554 <mknod>:
+SYSCALL(mknod)
+ 554:	b8 11 00 00 00       	mov    $0x11,%eax
+ 559:	89 e1                	mov    %esp,%ecx
+ 55b:	ba 62 05 00 00       	mov    $0x562,%edx
+ 560:	0f 34                	sysenter
+ 562:	c3                   	ret
+
+00000563 <unlink>:
+SYSCALL(unlink)
+ 563:	b8 12 00 00 00       	mov    $0x12,%eax
+ 568:	89 e1                	mov    %esp,%ecx
+ 56a:	ba 71 05 00 00       	mov    $0x571,%edx
+ 56f:	0f 34                	sysenter
+ 571:	c3                   	ret
+
+00000572 <fstat>:
+SYSCALL(fstat)
+ 572:	b8 08 00 00 00       	mov    $0x8,%eax
+ 577:	89 e1                	mov    %esp,%ecx
+ 579:	ba 80 05 00 00       	mov    $0x580,%edx
+ 57e:	0f 34                	sysenter
+ 580:	c3                   	ret
+
+00000581 <link>:
+SYSCALL(link)
+ 581:	b8 13 00 00 00       	mov    $0x13,%eax
+ 586:	89 e1                	mov    %esp,%ecx
+ 588:	ba 8f 05 00 00       	mov    $0x58f,%edx
+ 58d:	0f 34                	sysenter
+ 58f:	c3                   	ret
+
+00000590 <mkdir>:
+SYSCALL(mkdir)
+ 590:	b8 14 00 00 00       	mov    $0x14,%eax
+ 595:	89 e1                	mov    %esp,%ecx
+ 597:	ba 9e 05 00 00       	mov    $0x59e,%edx
+ 59c:	0f 34                	sysenter
+ 59e:	c3                   	ret
+
+0000059f <chdir>:
+SYSCALL(chdir)
+ 59f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a4:	89 e1                	mov    %esp,%ecx
+ 5a6:	ba ad 05 00 00       	mov    $0x5ad,%edx
+ 5ab:	0f 34                	sysenter
+ 5ad:	c3                   	ret
+
+000005ae <dup>:
+SYSCALL(dup)
+ 5ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b3:	89 e1                	mov    %esp,%ecx
+ 5b5:	ba bc 05 00 00       	mov    $0x5bc,%edx
+ 5ba:	0f 34                	sysenter
+ 5bc:	c3                   	ret
+
+000005bd <sbrk>:
+SYSCALL(sbrk)
+ 5bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c2:	89 e1                	mov    %esp,%ecx
+ 5c4:	ba cb 05 00 00       	mov    $0x5cb,%edx
+ 5c9:	0f 34                	sysenter
+ 5cb:	c3                   	ret
+
+000005cc <sleep>:
+SYSCALL(sleep)
+ 5cc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5d1:	89 e1                	mov    %esp,%ecx
+ 5d3:	ba da 05 00 00       	mov    $0x5da,%edx
+ 5d8:	0f 34                	sysenter
+ 5da:	c3                   	ret
+
+000005db <fallocate>:
+SYSCALL(fallocate)
+ 5db:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5e0:	89 e1                	mov    %esp,%ecx
+ 5e2:	ba e9 05 00 00       	mov    $0x5e9,%edx
+ 5e7:	0f 34                	sysenter
+ 5e9:	c3                   	ret
+
+000005ea <pread>:
+SYSCALL(pread)
+ 5ea:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5ef:	89 e1                	mov    %esp,%ecx
+ 5f1:	ba f8 05 00 00       	mov    $0x5f8,%edx
+ 5f6:	0f 34                	sysenter
+ 5f8:	c3                   	ret
+
+000005f9 <pwrite>:
+SYSCALL(pwrite)
+ 5f9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5fe:	89 e1                	mov    %esp,%ecx
+ 600:	ba 07 06 00 00       	mov    $0x607,%edx
+ 605:	0f 34                	sysenter
+ 607:	c3                   	ret
+
+00000608 <readv>:
+SYSCALL(readv)
+ 608:	b8 19 00 00 00       	mov    $0x19,%eax
+ 60d:	89 e1                	mov    %esp,%ecx
+ 60f:	ba 16 06 00 00       	mov    $0x616,%edx
+ 614:	0f 34                	sysenter
+ 616:	c3                   	ret
+
+00000617 <writev>:
+SYSCALL(writev)
+ 617:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 61c:	89 e1                	mov    %esp,%ecx
+ 61e:	ba 25 06 00 00       	mov    $0x625,%edx
+ 623:	0f 34                	sysenter
+ 625:	c3                   	ret
+
+00000626 <splice>:
+SYSCALL(splice)
+ 626:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 62b:	89 e1                	mov    %esp,%ecx
+ 62d:	ba 34 06 00 00       	mov    $0x634,%edx
+ 632:	0f 34                	sysenter
+ 634:	c3                   	ret
+
+00000635 <setpriority>:
+SYSCALL(setpriority)
+ 635:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 63a:	89 e1                	mov    %esp,%ecx
+ 63c:	ba 43 06 00 00       	mov    $0x643,%edx
+ 641:	0f 34                	sysenter
+ 643:	c3                   	ret
+
+00000644 <setaffinity>:
+SYSCALL(setaffinity)
+ 644:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 649:	89 e1                	mov    %esp,%ecx
+ 64b:	ba 52 06 00 00       	mov    $0x652,%edx
+ 650:	0f 34                	sysenter
+ 652:	c3                   	ret
+
+00000653 <lockstress>:
+SYSCALL(lockstress)
+ 653:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 658:	89 e1                	mov    %esp,%ecx
+ 65a:	ba 61 06 00 00       	mov    $0x661,%edx
+ 65f:	0f 34                	sysenter
+ 661:	c3                   	ret
+
+00000662 <lockstat>:
+SYSCALL(lockstat)
+ 662:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 667:	89 e1                	mov    %esp,%ecx
+ 669:	ba 70 06 00 00       	mov    $0x670,%edx
+ 66e:	0f 34                	sysenter
+ 670:	c3                   	ret
+
+00000671 <profctl>:
+SYSCALL(profctl)
+ 671:	b8 20 00 00 00       	mov    $0x20,%eax
+ 676:	89 e1                	mov    %esp,%ecx
+ 678:	ba 7f 06 00 00       	mov    $0x67f,%edx
+ 67d:	0f 34                	sysenter
+ 67f:	c3                   	ret
+
+00000680 <profread>:
+SYSCALL(profread)
+ 680:	b8 21 00 00 00       	mov    $0x21,%eax
+ 685:	89 e1                	mov    %esp,%ecx
+ 687:	ba 8e 06 00 00       	mov    $0x68e,%edx
+ 68c:	0f 34                	sysenter
+ 68e:	c3                   	ret
+
+0000068f <getrusage>:
+SYSCALL(getrusage)
+ 68f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 694:	89 e1                	mov    %esp,%ecx
+ 696:	ba 9d 06 00 00       	mov    $0x69d,%edx
+ 69b:	0f 34                	sysenter
+ 69d:	c3                   	ret
+
+0000069e <tracectl>:
+SYSCALL(tracectl)
+ 69e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6a3:	89 e1                	mov    %esp,%ecx
+ 6a5:	ba ac 06 00 00       	mov    $0x6ac,%edx
+ 6aa:	0f 34                	sysenter
+ 6ac:	c3                   	ret
+
+000006ad <traceread>:
+SYSCALL(traceread)
+ 6ad:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6b2:	89 e1                	mov    %esp,%ecx
+ 6b4:	ba bb 06 00 00       	mov    $0x6bb,%edx
+ 6b9:	0f 34                	sysenter
+ 6bb:	c3                   	ret
+
+000006bc <nanosleep>:
+SYSCALL(nanosleep)
+ 6bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6c1:	89 e1                	mov    %esp,%ecx
+ 6c3:	ba ca 06 00 00       	mov    $0x6ca,%edx
+ 6c8:	0f 34                	sysenter
+ 6ca:	c3                   	ret
+ 6cb:	66 90                	xchg   %ax,%ax
+ 6cd:	66 90                	xchg   %ax,%ax
+ 6cf:	90                   	nop
+
+000006d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	57                   	push   %edi
+ 6d4:	56                   	push   %esi
+ 6d5:	53                   	push   %ebx
+ 6d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6d8:	89 d1                	mov    %edx,%ecx
+{
+ 6da:	83 ec 3c             	sub    $0x3c,%esp
+ 6dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6e0:	85 d2                	test   %edx,%edx
+ 6e2:	0f 89 80 00 00 00    	jns    768 <printint+0x98>
+ 6e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6ec:	74 7a                	je     768 <printint+0x98>
+    x = -xx;
+ 6ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6f8:	31 f6                	xor    %esi,%esi
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 700:	89 c8                	mov    %ecx,%eax
+ 702:	31 d2                	xor    %edx,%edx
+ 704:	89 f7                	mov    %esi,%edi
+ 706:	f7 f3                	div    %ebx
+ 708:	8d 76 01             	lea    0x1(%esi),%esi
+ 70b:	0f b6 92 8c 0b 00 00 	movzbl 0xb8c(%edx),%edx
+ 712:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 716:	89 ca                	mov    %ecx,%edx
+ 718:	89 c1                	mov    %eax,%ecx
+ 71a:	39 da                	cmp    %ebx,%edx
+ 71c:	73 e2                	jae    700 <printint+0x30>
+  if(neg)
+ 71e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 721:	85 c0                	test   %eax,%eax
+ 723:	74 07                	je     72c <printint+0x5c>
+    buf[i++] = '-';
+ 725:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 72a:	89 f7                	mov    %esi,%edi
+ 72c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 72f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 732:	01 df                	add    %ebx,%edi
+ 734:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 738:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 741:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 744:	6a 01                	push   $0x1
+ 746:	50                   	push   %eax
+ 747:	56                   	push   %esi
+ 748:	e8 bc fd ff ff       	call   509 <write>
+  while(--i >= 0)
+ 74d:	89 f8                	mov    %edi,%eax
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	83 ef 01             	sub    $0x1,%edi
+ 755:	39 d8                	cmp    %ebx,%eax
+ 757:	75 df                	jne    738 <printint+0x68>
+}
+ 759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75c:	5b                   	pop    %ebx
+ 75d:	5e                   	pop    %esi
+ 75e:	5f                   	pop    %edi
+ 75f:	5d                   	pop    %ebp
+ 760:	c3                   	ret
+ 761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 768:	31 c0                	xor    %eax,%eax
+ 76a:	eb 89                	jmp    6f5 <printint+0x25>
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 779:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 77c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 77f:	0f b6 1e             	movzbl (%esi),%ebx
+ 782:	83 c6 01             	add    $0x1,%esi
+ 785:	84 db                	test   %bl,%bl
+ 787:	74 67                	je     7f0 <printf+0x80>
+ 789:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 78c:	31 d2                	xor    %edx,%edx
+ 78e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 791:	eb 34                	jmp    7c7 <printf+0x57>
+ 793:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 797:	90                   	nop
+ 798:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 79b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7a0:	83 f8 25             	cmp    $0x25,%eax
+ 7a3:	74 18                	je     7bd <printf+0x4d>
+  write(fd, &c, 1);
+ 7a5:	83 ec 04             	sub    $0x4,%esp
+ 7a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ae:	6a 01                	push   $0x1
+ 7b0:	50                   	push   %eax
+ 7b1:	57                   	push   %edi
+ 7b2:	e8 52 fd ff ff       	call   509 <write>
+ 7b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7c0:	83 c6 01             	add    $0x1,%esi
+ 7c3:	84 db                	test   %bl,%bl
+ 7c5:	74 29                	je     7f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ca:	85 d2                	test   %edx,%edx
+ 7cc:	74 ca                	je     798 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ce:	83 fa 25             	cmp    $0x25,%edx
+ 7d1:	75 ea                	jne    7bd <printf+0x4d>
+      if(c == 'd'){
+ 7d3:	83 f8 25             	cmp    $0x25,%eax
+ 7d6:	0f 84 24 01 00 00    	je     900 <printf+0x190>
+ 7dc:	83 e8 63             	sub    $0x63,%eax
+ 7df:	83 f8 15             	cmp    $0x15,%eax
+ 7e2:	77 1c                	ja     800 <printf+0x90>
+ 7e4:	ff 24 85 34 0b 00 00 	jmp    *0xb34(,%eax,4)
+ 7eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7f3:	5b                   	pop    %ebx
+ 7f4:	5e                   	pop    %esi
+ 7f5:	5f                   	pop    %edi
+ 7f6:	5d                   	pop    %ebp
+ 7f7:	c3                   	ret
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 806:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 80a:	6a 01                	push   $0x1
+ 80c:	52                   	push   %edx
+ 80d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 810:	57                   	push   %edi
+ 811:	e8 f3 fc ff ff       	call   509 <write>
+ 816:	83 c4 0c             	add    $0xc,%esp
+ 819:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 81c:	6a 01                	push   $0x1
+ 81e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 821:	52                   	push   %edx
+ 822:	57                   	push   %edi
+ 823:	e8 e1 fc ff ff       	call   509 <write>
+        putc(fd, c);
+ 828:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 82b:	31 d2                	xor    %edx,%edx
+ 82d:	eb 8e                	jmp    7bd <printf+0x4d>
+ 82f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 00                	push   $0x0
+ 83f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 841:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 844:	e8 87 fe ff ff       	call   6d0 <printint>
+        ap++;
+ 849:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 84c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 67 ff ff ff       	jmp    7bd <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 863:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 865:	83 c0 04             	add    $0x4,%eax
+ 868:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 86b:	85 db                	test   %ebx,%ebx
+ 86d:	0f 84 9d 00 00 00    	je     910 <printf+0x1a0>
+        while(*s != 0){
+ 873:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 876:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 878:	84 c0                	test   %al,%al
+ 87a:	0f 84 3d ff ff ff    	je     7bd <printf+0x4d>
+ 880:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 883:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 886:	89 de                	mov    %ebx,%esi
+ 888:	89 d3                	mov    %edx,%ebx
+ 88a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 896:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 899:	6a 01                	push   $0x1
+ 89b:	53                   	push   %ebx
+ 89c:	57                   	push   %edi
+ 89d:	e8 67 fc ff ff       	call   509 <write>
+        while(*s != 0){
+ 8a2:	0f b6 06             	movzbl (%esi),%eax
+ 8a5:	83 c4 10             	add    $0x10,%esp
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	75 e4                	jne    890 <printf+0x120>
+      state = 0;
+ 8ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 07 ff ff ff       	jmp    7bd <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 01                	push   $0x1
+ 8cf:	e9 6b ff ff ff       	jmp    83f <printf+0xcf>
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	52                   	push   %edx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 17 fc ff ff       	call   509 <write>
+        ap++;
+ 8f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8f8:	31 d2                	xor    %edx,%edx
+ 8fa:	e9 be fe ff ff       	jmp    7bd <printf+0x4d>
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 906:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 909:	6a 01                	push   $0x1
+ 90b:	e9 11 ff ff ff       	jmp    821 <printf+0xb1>
+ 910:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 915:	bb 2b 0b 00 00       	mov    $0xb2b,%ebx
+ 91a:	e9 61 ff ff ff       	jmp    880 <printf+0x110>
+ 91f:	90                   	nop
+
+00000920 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 920:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	a1 00 0f 00 00       	mov    0xf00,%eax
+{
+ 926:	89 e5                	mov    %esp,%ebp
+ 928:	57                   	push   %edi
+ 929:	56                   	push   %esi
+ 92a:	53                   	push   %ebx
+ 92b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 92e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 938:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 93a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 93c:	39 ca                	cmp    %ecx,%edx
+ 93e:	73 30                	jae    970 <free+0x50>
+ 940:	39 c1                	cmp    %eax,%ecx
+ 942:	72 04                	jb     948 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 944:	39 c2                	cmp    %eax,%edx
+ 946:	72 f0                	jb     938 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 948:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 94b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 94e:	39 f8                	cmp    %edi,%eax
+ 950:	74 2e                	je     980 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 952:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 955:	8b 42 04             	mov    0x4(%edx),%eax
+ 958:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 95b:	39 f1                	cmp    %esi,%ecx
+ 95d:	74 38                	je     997 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 95f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 961:	5b                   	pop    %ebx
+  freep = p;
+ 962:	89 15 00 0f 00 00    	mov    %edx,0xf00
+}
+ 968:	5e                   	pop    %esi
+ 969:	5f                   	pop    %edi
+ 96a:	5d                   	pop    %ebp
+ 96b:	c3                   	ret
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 d0                	jb     944 <free+0x24>
+ 974:	eb c2                	jmp    938 <free+0x18>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 980:	03 70 04             	add    0x4(%eax),%esi
+ 983:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 986:	8b 02                	mov    (%edx),%eax
+ 988:	8b 00                	mov    (%eax),%eax
+ 98a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 98d:	8b 42 04             	mov    0x4(%edx),%eax
+ 990:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 993:	39 f1                	cmp    %esi,%ecx
+ 995:	75 c8                	jne    95f <free+0x3f>
+    p->s.size += bp->s.size;
+ 997:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 99a:	89 15 00 0f 00 00    	mov    %edx,0xf00
+    p->s.size += bp->s.size;
+ 9a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9a8:	5b                   	pop    %ebx
+ 9a9:	5e                   	pop    %esi
+ 9aa:	5f                   	pop    %edi
+ 9ab:	5d                   	pop    %ebp
+ 9ac:	c3                   	ret
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9bc:	8b 15 00 0f 00 00    	mov    0xf00,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9c5:	c1 ef 03             	shr    $0x3,%edi
+ 9c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9cb:	85 d2                	test   %edx,%edx
+ 9cd:	0f 84 8d 00 00 00    	je     a60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9d8:	39 f9                	cmp    %edi,%ecx
+ 9da:	73 64                	jae    a40 <malloc+0x90>
+  if(nu < 4096)
+ 9dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9e1:	39 df                	cmp    %ebx,%edi
+ 9e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ed:	eb 0a                	jmp    9f9 <malloc+0x49>
+ 9ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9f5:	39 f9                	cmp    %edi,%ecx
+ 9f7:	73 47                	jae    a40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9f9:	89 c2                	mov    %eax,%edx
+ 9fb:	39 05 00 0f 00 00    	cmp    %eax,0xf00
+ a01:	75 ed                	jne    9f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	56                   	push   %esi
+ a07:	e8 b1 fb ff ff       	call   5bd <sbrk>
+  if(p == (char*)-1)
+ a0c:	83 c4 10             	add    $0x10,%esp
+ a0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a12:	74 1c                	je     a30 <malloc+0x80>
+  hp->s.size = nu;
+ a14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a17:	83 ec 0c             	sub    $0xc,%esp
+ a1a:	83 c0 08             	add    $0x8,%eax
+ a1d:	50                   	push   %eax
+ a1e:	e8 fd fe ff ff       	call   920 <free>
+  return freep;
+ a23:	8b 15 00 0f 00 00    	mov    0xf00,%edx
+      if((p = morecore(nunits)) == 0)
+ a29:	83 c4 10             	add    $0x10,%esp
+ a2c:	85 d2                	test   %edx,%edx
+ a2e:	75 c0                	jne    9f0 <malloc+0x40>
+        return 0;
+  }
+}
+ a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a33:	31 c0                	xor    %eax,%eax
+}
+ a35:	5b                   	pop    %ebx
+ a36:	5e                   	pop    %esi
+ a37:	5f                   	pop    %edi
+ a38:	5d                   	pop    %ebp
+ a39:	c3                   	ret
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a40:	39 cf                	cmp    %ecx,%edi
+ a42:	74 4c                	je     a90 <malloc+0xe0>
+        p->s.size -= nunits;
+ a44:	29 f9                	sub    %edi,%ecx
+ a46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a4f:	89 15 00 0f 00 00    	mov    %edx,0xf00
+}
+ a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a58:	83 c0 08             	add    $0x8,%eax
+}
+ a5b:	5b                   	pop    %ebx
+ a5c:	5e                   	pop    %esi
+ a5d:	5f                   	pop    %edi
+ a5e:	5d                   	pop    %ebp
+ a5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a60:	c7 05 00 0f 00 00 04 	movl   $0xf04,0xf00
+ a67:	0f 00 00 
+    base.s.size = 0;
+ a6a:	b8 04 0f 00 00       	mov    $0xf04,%eax
+    base.s.ptr = freep = prevp = &base;
+ a6f:	c7 05 04 0f 00 00 04 	movl   $0xf04,0xf04
+ a76:	0f 00 00 
+    base.s.size = 0;
+ a79:	c7 05 08 0f 00 00 00 	movl   $0x0,0xf08
+ a80:	00 00 00 
+    if(p->s.size >= nunits){
+ a83:	e9 54 ff ff ff       	jmp    9dc <malloc+0x2c>
+ a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a90:	8b 08                	mov    (%eax),%ecx
+ a92:	89 0a                	mov    %ecx,(%edx)
+ a94:	eb b9                	jmp    a4f <malloc+0x9f>
@@ -0,0 +1,74 @@
+// Process creation benchmark.
+// Times fork/exit/wait cycles while a growing number of other
+// children stay alive, to show whether the cost of wait() and
+// exit() depends on how many processes there are.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+#define CYCLES 1000  // fork/exit/wait cycles per measurement
+#define HZ     100   // approximate timer ticks per second
+
+int others[] = { 0, 16, NPROC - 8 };
+
+void
+bench(int nother)
+{
+  int hold[2], i, pid, start, ticks;
+  char c;
+
+  if(pipe(hold) < 0){
+    printf(2, "forkbench: pipe failed\n");
+    exit();
+  }
+
+  // The other children block reading hold until it is closed.
+  for(i = 0; i < nother; i++){
+    if((pid = fork()) < 0){
+      printf(2, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(hold[1]);
+      read(hold[0], &c, 1);
+      exit();
+    }
+  }
+  close(hold[0]);
+
+  start = uptime();
+  for(i = 0; i < CYCLES; i++){
+    if((pid = fork()) < 0){
+      printf(2, "forkbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0)
+      exit();
+    if(wait() != pid){
+      printf(2, "forkbench: wait returned the wrong child\n");
+      exit();
+    }
+  }
+  ticks = uptime() - start;
+  if(ticks == 0)
+    ticks = 1;
+
+  close(hold[1]);
+  for(i = 0; i < nother; i++)
+    wait();
+
+  printf(1, "%d other children: %d cycles in %d ticks, %d cycles/s\n",
+         nother, CYCLES, ticks, CYCLES * HZ / ticks);
+}
+
+int
+main(void)
+{
+  int i;
+
+  for(i = 0; i < sizeof(others)/sizeof(others[0]); i++)
+    bench(others[i]);
+  exit();
+}
@@ -0,0 +1,977 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 4d 04 00 00       	call   45d <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 90 01 00 00       	call   1b0 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 6c 04 00 00       	call   499 <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 5c 06 00 00       	push   $0x65c
+  4e:	e8 5d 01 00 00       	call   1b0 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 5c 06 00 00       	push   $0x65c
+  5c:	6a 01                	push   $0x1
+  5e:	e8 36 04 00 00       	call   499 <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 c8 03 00 00       	call   44e <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 d7 03 00 00       	call   46c <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 c9 03 00 00       	call   46c <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 8e 06 00 00       	push   $0x68e
+  b0:	e8 fb 00 00 00       	call   1b0 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 8e 06 00 00       	push   $0x68e
+  be:	6a 01                	push   $0x1
+  c0:	e8 d4 03 00 00       	call   499 <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 8b 03 00 00       	call   45d <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 67 06 00 00       	push   $0x667
+  da:	e8 d1 00 00 00       	call   1b0 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 67 06 00 00       	push   $0x667
+  e8:	6a 01                	push   $0x1
+  ea:	e8 aa 03 00 00       	call   499 <write>
+      exit();
+  ef:	e8 69 03 00 00       	call   45d <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 7b 06 00 00       	push   $0x67b
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 56 03 00 00       	call   45d <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 9c 06 00 00       	push   $0x69c
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 3f 03 00 00       	call   45d <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 2d 02 00 00       	call   48a <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 23 02 00 00       	call   4d5 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 3b 02 00 00       	call   502 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 d7 01 00 00       	call   4a8 <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	56                   	push   %esi
+ 364:	53                   	push   %ebx
+ 365:	8b 75 10             	mov    0x10(%ebp),%esi
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 36e:	85 f6                	test   %esi,%esi
+ 370:	74 2e                	je     3a0 <memcmp+0x40>
+ 372:	01 c6                	add    %eax,%esi
+ 374:	eb 14                	jmp    38a <memcmp+0x2a>
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 380:	83 c0 01             	add    $0x1,%eax
+ 383:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 386:	39 f0                	cmp    %esi,%eax
+ 388:	74 16                	je     3a0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 38a:	0f b6 0a             	movzbl (%edx),%ecx
+ 38d:	0f b6 18             	movzbl (%eax),%ebx
+ 390:	38 d9                	cmp    %bl,%cl
+ 392:	74 ec                	je     380 <memcmp+0x20>
+      return *s1 - *s2;
+ 394:	0f b6 c1             	movzbl %cl,%eax
+ 397:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 399:	5b                   	pop    %ebx
+ 39a:	5e                   	pop    %esi
+ 39b:	5d                   	pop    %ebp
+ 39c:	c3                   	ret
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+ 3a0:	5b                   	pop    %ebx
+  return 0;
+ 3a1:	31 c0                	xor    %eax,%eax
+}
+ 3a3:	5e                   	pop    %esi
+ 3a4:	5d                   	pop    %ebp
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003b0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 3b0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003c0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 3c0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 3c2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 3c8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 3ce:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 3e0:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 3e2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 3e8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+
+000003f0 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+ 3f5:	53                   	push   %ebx
+ 3f6:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 3f8:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 3fd:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 403:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 409:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 40f:	89 c6                	mov    %eax,%esi
+ 411:	f7 f7                	div    %edi
+ 413:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 415:	f7 e3                	mul    %ebx
+ 417:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 41a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 41d:	89 d3                	mov    %edx,%ebx
+ 41f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 422:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 424:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 426:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 42c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 431:	f7 e6                	mul    %esi
+ 433:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 439:	29 d9                	sub    %ebx,%ecx
+ 43b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 441:	01 c1                	add    %eax,%ecx
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 449:	5b                   	pop    %ebx
+ 44a:	5e                   	pop    %esi
+ 44b:	5f                   	pop    %edi
+ 44c:	5d                   	pop    %ebp
+ 44d:	c3                   	ret
+
+0000044e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 44e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 453:	89 e1                	mov    %esp,%ecx
+ 455:	ba 5c 04 00 00       	mov    $0x45c,%edx
+ 45a:	0f 34                	sysenter
+ 45c:	c3                   	ret
+
+0000045d <exit>:
+SYSCALL(exit)
+ 45d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 462:	89 e1                	mov    %esp,%ecx
+ 464:	ba 6b 04 00 00       	mov    $0x46b,%edx
+ 469:	0f 34                	sysenter
+ 46b:	c3                   	ret
+
+0000046c <wait>:
+SYSCALL(wait)
+ 46c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 471:	89 e1                	mov    %esp,%ecx
+ 473:	ba 7a 04 00 00       	mov    $0x47a,%edx
+ 478:	0f 34                	sysenter
+ 47a:	c3                   	ret
+
+0000047b <pipe>:
+SYSCALL(pipe)
+ 47b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 480:	89 e1                	mov    %esp,%ecx
+ 482:	ba 89 04 00 00       	mov    $0x489,%edx
+ 487:	0f 34                	sysenter
+ 489:	c3                   	ret
+
+0000048a <read>:
+SYSCALL(read)
+ 48a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 48f:	89 e1                	mov    %esp,%ecx
+ 491:	ba 98 04 00 00       	mov    $0x498,%edx
+ 496:	0f 34                	sysenter
+ 498:	c3                   	ret
+
+00000499 <write>:
+SYSCALL(write)
+ 499:	b8 10 00 00 00       	mov    $0x10,%eax
+ 49e:	89 e1                	mov    %esp,%ecx
+ 4a0:	ba a7 04 00 00       	mov    $0x4a7,%edx
+ 4a5:	0f 34                	sysenter
+ 4a7:	c3                   	ret
+
+000004a8 <close>:
+SYSCALL(close)
+ 4a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4ad:	89 e1                	mov    %esp,%ecx
+ 4af:	ba b6 04 00 00       	mov    $0x4b6,%edx
+ 4b4:	0f 34                	sysenter
+ 4b6:	c3                   	ret
+
+000004b7 <kill>:
+SYSCALL(kill)
+ 4b7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4bc:	89 e1                	mov    %esp,%ecx
+ 4be:	ba c5 04 00 00       	mov    $0x4c5,%edx
+ 4c3:	0f 34                	sysenter
+ 4c5:	c3                   	ret
+
+000004c6 <exec>:
+SYSCALL(exec)
+ 4c6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4cb:	89 e1                	mov    %esp,%ecx
+ 4cd:	ba d4 04 00 00       	mov    $0x4d4,%edx
+ 4d2:	0f 34                	sysenter
+ 4d4:	c3                   	ret
+
+000004d5 <open>:
+SYSCALL(open)
+ 4d5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4da:	89 e1                	mov    %esp,%ecx
+ 4dc:	ba e3 04 00 00       	mov    $0x4e3,%edx
+ 4e1:	0f 34                	sysenter
+ 4e3:	c3                   	ret
+
+000004e4 <mknod>:
+SYSCALL(mknod)
+ 4e4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e9:	89 e1                	mov    %esp,%ecx
+ 4eb:	ba f2 04 00 00       	mov    $0x4f2,%edx
+ 4f0:	0f 34                	sysenter
+ 4f2:	c3                   	ret
+
+000004f3 <unlink>:
+SYSCALL(unlink)
+ 4f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4f8:	89 e1                	mov    %esp,%ecx
+ 4fa:	ba 01 05 00 00       	mov    $0x501,%edx
+ 4ff:	0f 34                	sysenter
+ 501:	c3                   	ret
+
+00000502 <fstat>:
+SYSCALL(fstat)
+ 502:	b8 08 00 00 00       	mov    $0x8,%eax
+ 507:	89 e1                	mov    %esp,%ecx
+ 509:	ba 10 05 00 00       	mov    $0x510,%edx
+ 50e:	0f 34                	sysenter
+ 510:	c3                   	ret
+
+00000511 <link>:
+SYSCALL(link)
+ 511:	b8 13 00 00 00       	mov    $0x13,%eax
+ 516:	89 e1                	mov    %esp,%ecx
+ 518:	ba 1f 05 00 00       	mov    $0x51f,%edx
+ 51d:	0f 34                	sysenter
+ 51f:	c3                   	ret
+
+00000520 <mkdir>:
+SYSCALL(mkdir)
+ 520:	b8 14 00 00 00       	mov    $0x14,%eax
+ 525:	89 e1                	mov    %esp,%ecx
+ 527:	ba 2e 05 00 00       	mov    $0x52e,%edx
+ 52c:	0f 34                	sysenter
+ 52e:	c3                   	ret
+
+0000052f <chdir>:
+SYSCALL(chdir)
+ 52f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 534:	89 e1                	mov    %esp,%ecx
+ 536:	ba 3d 05 00 00       	mov    $0x53d,%edx
+ 53b:	0f 34                	sysenter
+ 53d:	c3                   	ret
+
+0000053e <dup>:
+SYSCALL(dup)
+ 53e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 543:	89 e1                	mov    %esp,%ecx
+ 545:	ba 4c 05 00 00       	mov    $0x54c,%edx
+ 54a:	0f 34                	sysenter
+ 54c:	c3                   	ret
+
+0000054d <sbrk>:
+SYSCALL(sbrk)
+ 54d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 552:	89 e1                	mov    %esp,%ecx
+ 554:	ba 5b 05 00 00       	mov    $0x55b,%edx
+ 559:	0f 34                	sysenter
+ 55b:	c3                   	ret
+
+0000055c <sleep>:
+SYSCALL(sleep)
+ 55c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 561:	89 e1                	mov    %esp,%ecx
+ 563:	ba 6a 05 00 00       	mov    $0x56a,%edx
+ 568:	0f 34                	sysenter
+ 56a:	c3                   	ret
+
+0000056b <fallocate>:
+SYSCALL(fallocate)
+ 56b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 570:	89 e1                	mov    %esp,%ecx
+ 572:	ba 79 05 00 00       	mov    $0x579,%edx
+ 577:	0f 34                	sysenter
+ 579:	c3                   	ret
+
+0000057a <pread>:
+SYSCALL(pread)
+ 57a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 57f:	89 e1                	mov    %esp,%ecx
+ 581:	ba 88 05 00 00       	mov    $0x588,%edx
+ 586:	0f 34                	sysenter
+ 588:	c3                   	ret
+
+00000589 <pwrite>:
+SYSCALL(pwrite)
+ 589:	b8 18 00 00 00       	mov    $0x18,%eax
+ 58e:	89 e1                	mov    %esp,%ecx
+ 590:	ba 97 05 00 00       	mov    $0x597,%edx
+ 595:	0f 34                	sysenter
+ 597:	c3                   	ret
+
+00000598 <readv>:
+SYSCALL(readv)
+ 598:	b8 19 00 00 00       	mov    $0x19,%eax
+ 59d:	89 e1                	mov    %esp,%ecx
+ 59f:	ba a6 05 00 00       	mov    $0x5a6,%edx
+ 5a4:	0f 34                	sysenter
+ 5a6:	c3                   	ret
+
+000005a7 <writev>:
+SYSCALL(writev)
+ 5a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5ac:	89 e1                	mov    %esp,%ecx
+ 5ae:	ba b5 05 00 00       	mov    $0x5b5,%edx
+ 5b3:	0f 34                	sysenter
+ 5b5:	c3                   	ret
+
+000005b6 <splice>:
+SYSCALL(splice)
+ 5b6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5bb:	89 e1                	mov    %esp,%ecx
+ 5bd:	ba c4 05 00 00       	mov    $0x5c4,%edx
+ 5c2:	0f 34                	sysenter
+ 5c4:	c3                   	ret
+
+000005c5 <setpriority>:
+SYSCALL(setpriority)
+ 5c5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5ca:	89 e1                	mov    %esp,%ecx
+ 5cc:	ba d3 05 00 00       	mov    $0x5d3,%edx
+ 5d1:	0f 34                	sysenter
+ 5d3:	c3                   	ret
+
+000005d4 <setaffinity>:
+SYSCALL(setaffinity)
+ 5d4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5d9:	89 e1                	mov    %esp,%ecx
+ 5db:	ba e2 05 00 00       	mov    $0x5e2,%edx
+ 5e0:	0f 34                	sysenter
+ 5e2:	c3                   	ret
+
+000005e3 <lockstress>:
+SYSCALL(lockstress)
+ 5e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e8:	89 e1                	mov    %esp,%ecx
+ 5ea:	ba f1 05 00 00       	mov    $0x5f1,%edx
+ 5ef:	0f 34                	sysenter
+ 5f1:	c3                   	ret
+
+000005f2 <lockstat>:
+SYSCALL(lockstat)
+ 5f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f7:	89 e1                	mov    %esp,%ecx
+ 5f9:	ba 00 06 00 00       	mov    $0x600,%edx
+ 5fe:	0f 34                	sysenter
+ 600:	c3                   	ret
+
+00000601 <profctl>:
+SYSCALL(profctl)
+ 601:	b8 20 00 00 00       	mov    $0x20,%eax
+ 606:	89 e1                	mov    %esp,%ecx
+ 608:	ba 0f 06 00 00       	mov    $0x60f,%edx
+ 60d:	0f 34                	sysenter
+ 60f:	c3                   	ret
+
+00000610 <profread>:
+SYSCALL(profread)
+ 610:	b8 21 00 00 00       	mov    $0x21,%eax
+ 615:	89 e1                	mov    %esp,%ecx
+ 617:	ba 1e 06 00 00       	mov    $0x61e,%edx
+ 61c:	0f 34                	sysenter
+ 61e:	c3                   	ret
+
+0000061f <getrusage>:
+SYSCALL(getrusage)
+ 61f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 624:	89 e1                	mov    %esp,%ecx
+ 626:	ba 2d 06 00 00       	mov    $0x62d,%edx
+ 62b:	0f 34                	sysenter
+ 62d:	c3                   	ret
+
+0000062e <tracectl>:
+SYSCALL(tracectl)
+ 62e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 633:	89 e1                	mov    %esp,%ecx
+ 635:	ba 3c 06 00 00       	mov    $0x63c,%edx
+ 63a:	0f 34                	sysenter
+ 63c:	c3                   	ret
+
+0000063d <traceread>:
+SYSCALL(traceread)
+ 63d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 642:	89 e1                	mov    %esp,%ecx
+ 644:	ba 4b 06 00 00       	mov    $0x64b,%edx
+ 649:	0f 34                	sysenter
+ 64b:	c3                   	ret
+
+0000064c <nanosleep>:
+SYSCALL(nanosleep)
+ 64c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 651:	89 e1                	mov    %esp,%ecx
+ 653:	ba 5a 06 00 00       	mov    $0x65a,%edx
+ 658:	0f 34                	sysenter
+ 65a:	c3                   	ret
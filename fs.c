@@ -14,9 +14,11 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
+#include "rwlock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -44,39 +46,65 @@ bzero(int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
-  memset(bp->data, 0, BSIZE);
+  bp = bnew(dev, bno);
   log_write(bp);
   brelse(bp);
 }
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Allocate up to n disk blocks as one contiguous run. The bitmap
+// is searched from block goal onward, wrapping around, so that a
+// file's consecutive blocks can be placed next to each other.
+// Stores the first block of the run in *bnop and returns the
+// length of the run, which is at least 1 but may be less than n.
+// The blocks are not zeroed.
 static uint
-balloc(uint dev)
+ballocrun(uint dev, uint goal, uint n, uint *bnop)
 {
-  int b, bi, m;
+  uint i, b, bi, m, cnt;
   struct buf *bp;
 
   bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
-    bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
+  for(i = 0; i < sb.size; i++){
+    b = (goal + i) % sb.size;
+    if(bp == 0 || b % BPB == 0){
+      if(bp)
         brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+      bp = bread(dev, BBLOCK(b, sb));
+    }
+    bi = b % BPB;
+    if((bp->data[bi/8] & (1 << (bi % 8))) == 0){  // Is block free?
+      // Extend the run over the free blocks that follow it
+      // in the same bitmap block.
+      for(cnt = 0; cnt < n && bi < BPB && b + cnt < sb.size; cnt++, bi++){
+        m = 1 << (bi % 8);
+        if(bp->data[bi/8] & m)
+          break;
+        bp->data[bi/8] |= m;  // Mark block in use.
       }
+      log_write(bp);
+      brelse(bp);
+      *bnop = b;
+      return cnt;
     }
-    brelse(bp);
   }
+  if(bp)
+    brelse(bp);
   panic("balloc: out of blocks");
 }
 
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+  uint b;
+
+  ballocrun(dev, 0, 1, &b);
+  bzero(dev, b);
+  return b;
+}
+
 // Free a disk block.
 static void
 bfree(int dev, uint b)
@@ -154,17 +182,24 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// The icache.lock reader-writer lock protects the allocation of
+// icache entries. Since ip->ref indicates whether an entry is
+// free, and ip->dev and ip->inum indicate which i-node an entry
+// holds, one must hold icache.lock while looking at those fields.
+// Nearly every iget() finds its inode already cached, so lookups
+// only read-lock icache.lock and many CPUs can search at once;
+// only recycling an entry takes it for writing. ip->ref itself
+// is changed with atomic instructions, which is what lets a
+// reader take a reference, and lets idup() and iput() take one
+// or drop one without the lock: an entry can't be recycled while
+// anyone holds icache.lock for reading or holds a reference.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
 struct {
-  struct spinlock lock;
+  struct rwlock lock;
   struct inode inode[NINODE];
 } icache;
 
@@ -173,7 +208,7 @@ iinit(int dev)
 {
   int i = 0;
   
-  initlock(&icache.lock, "icache");
+  initrwlock(&icache.lock, "icache");
   for(i = 0; i < NINODE; i++) {
     initsleeplock(&icache.inode[i].lock, "inode");
   }
@@ -243,14 +278,27 @@ iget(uint dev, uint inum)
 {
   struct inode *ip, *empty;
 
-  acquire(&icache.lock);
+  // Is the inode already cached? If iput() drops the last
+  // reference between the check and the xadd, the entry still
+  // holds this inode: it can't be recycled under the read lock.
+  acquireread(&icache.lock);
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+      xadd(&ip->ref, 1);
+      releaseread(&icache.lock);
+      return ip;
+    }
+  }
+  releaseread(&icache.lock);
 
-  // Is the inode already cached?
+  // Not cached: search again with the lock held for writing,
+  // since another CPU may have brought it in meanwhile.
+  acquirewrite(&icache.lock);
   empty = 0;
   for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
-      release(&icache.lock);
+      xadd(&ip->ref, 1);
+      releasewrite(&icache.lock);
       return ip;
     }
     if(empty == 0 && ip->ref == 0)    // Remember empty slot.
@@ -266,7 +314,7 @@ iget(uint dev, uint inum)
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  release(&icache.lock);
+  releasewrite(&icache.lock);
 
   return ip;
 }
@@ -276,9 +324,7 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-  acquire(&icache.lock);
-  ip->ref++;
-  release(&icache.lock);
+  xadd(&ip->ref, 1);
   return ip;
 }
 
@@ -333,10 +379,7 @@ iput(struct inode *ip)
 {
   acquiresleep(&ip->lock);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
-    if(r == 1){
+    if(ip->ref == 1){
       // inode has no links and no other references: truncate and free.
       itrunc(ip);
       ip->type = 0;
@@ -346,9 +389,7 @@ iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  release(&icache.lock);
+  xadd(&ip->ref, -1);
 }
 
 // Common idiom: unlock, then put.
@@ -366,9 +407,21 @@ iunlockput(struct inode *ip)
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
 // listed in block ip->addrs[NDIRECT].
+//
+// The exception is a regular file of at most MAXINLINE bytes,
+// whose content is stored in ip->addrs[] itself. writei() moves
+// it out to a data block once the file grows past that.
+
+// Is ip's content stored inline in ip->addrs?
+static int
+isinline(struct inode *ip)
+{
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
+// The address may carry the UNWRITTEN mark.
 static uint
 bmap(struct inode *ip, uint bn)
 {
@@ -399,6 +452,88 @@ bmap(struct inode *ip, uint bn)
   panic("bmap: out of range");
 }
 
+// Clear the UNWRITTEN mark on the nth block of inode ip,
+// which the caller is about to fill, and return its address.
+static uint
+bmapwritten(struct inode *ip, uint bn)
+{
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+    ip->addrs[bn] &= ~UNWRITTEN;
+    return ip->addrs[bn];
+  }
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+  a = (uint*)bp->data;
+  a[bn - NDIRECT] &= ~UNWRITTEN;
+  addr = a[bn - NDIRECT];
+  log_write(bp);
+  brelse(bp);
+  return addr;
+}
+
+// Allocate disk blocks for file blocks [bn, end) of inode ip,
+// none of which may have a block yet. Allocation is deferred
+// until writei() knows the whole extent of a write, so the blocks
+// can be taken as contiguous runs that continue right after the
+// file's preceding block. The blocks are not zeroed: writei()
+// fills them through bnew() instead of reading them back, and
+// reservei() passes UNWRITTEN in flags so they read as zeroes.
+static void
+bmapalloc(struct inode *ip, uint bn, uint end, uint flags)
+{
+  uint goal, b, cnt;
+  struct buf *bp;
+
+  if(bn >= end)
+    return;
+
+  // Allocate the indirect block first so it does not land in
+  // the middle of the data runs.
+  if(end > NDIRECT && ip->addrs[NDIRECT] == 0)
+    ip->addrs[NDIRECT] = balloc(ip->dev);
+
+  goal = bn > 0 ? (bmap(ip, bn - 1) & ~UNWRITTEN) + 1 : 0;
+  bp = 0;
+  while(bn < end){
+    cnt = ballocrun(ip->dev, goal, end - bn, &b);
+    goal = b + cnt;
+    for(; cnt > 0; cnt--, bn++, b++){
+      if(bn < NDIRECT){
+        ip->addrs[bn] = b | flags;
+        continue;
+      }
+      if(bp == 0)
+        bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      ((uint*)bp->data)[bn - NDIRECT] = b | flags;
+    }
+  }
+  if(bp){
+    log_write(bp);
+    brelse(bp);
+  }
+}
+
+// Move an inline file's content out of ip->addrs into
+// a data block, so that the file can grow past MAXINLINE.
+static void
+iuninline(struct inode *ip)
+{
+  char data[MAXINLINE];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, ip->size);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  if(ip->size == 0)
+    return;
+  bmapalloc(ip, 0, 1, 0);
+  bp = bnew(ip->dev, ip->addrs[0]);
+  memmove(bp->data, data, ip->size);
+  log_write(bp);
+  brelse(bp);
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -411,9 +546,16 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(isinline(ip)){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
+      bfree(ip->dev, ip->addrs[i] & ~UNWRITTEN);
       ip->addrs[i] = 0;
     }
   }
@@ -423,7 +565,7 @@ itrunc(struct inode *ip)
     a = (uint*)bp->data;
     for(j = 0; j < NINDIRECT; j++){
       if(a[j])
-        bfree(ip->dev, a[j]);
+        bfree(ip->dev, a[j] & ~UNWRITTEN);
     }
     brelse(bp);
     bfree(ip->dev, ip->addrs[NDIRECT]);
@@ -452,7 +594,7 @@ stati(struct inode *ip, struct stat *st)
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -466,9 +608,19 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   if(off + n > ip->size)
     n = ip->size - off;
 
+  if(isinline(ip)){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
+
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    addr = bmap(ip, off/BSIZE);
     m = min(n - tot, BSIZE - off%BSIZE);
+    if(addr & UNWRITTEN){
+      memset(dst, 0, m);
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -481,7 +633,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, bn, nbn, addr;
+  int update;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -495,8 +648,36 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  if(isinline(ip)){
+    if(off + n <= MAXINLINE){
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      return n;
+    }
+    iuninline(ip);
+  }
+
+  // Blocks from nbn on are past the end of the file and have no
+  // disk block yet. Allocate all the ones this write reaches in
+  // one go; since they're new, there's nothing to read back.
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+  if(n > 0)
+    bmapalloc(ip, nbn, (off + n - 1) / BSIZE + 1, 0);
+
+  update = 0;
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    bn = off/BSIZE;
+    addr = bmap(ip, bn);
+    if(addr & UNWRITTEN){
+      // First write to a block reserved by fallocate().
+      bp = bnew(ip->dev, bmapwritten(ip, bn));
+      update = 1;
+    } else if(bn >= nbn)
+      bp = bnew(ip->dev, addr);
+    else
+      bp = bread(ip->dev, addr);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
@@ -505,11 +686,49 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(n > 0 && off > ip->size){
     ip->size = off;
-    iupdate(ip);
+    update = 1;
   }
+  if(update)
+    iupdate(ip);
   return n;
 }
 
+// Reserve disk blocks for bytes [off, off+n) of regular file ip
+// in one go, extending the file to cover them if needed. The new
+// blocks are one contiguous run where the bitmap allows and are
+// marked UNWRITTEN, so they cost no zeroing now and read as
+// zeroes until writei() fills them.
+// Caller must hold ip->lock and be inside a transaction.
+int
+reservei(struct inode *ip, uint off, uint n)
+{
+  uint end;
+
+  if(ip->type != T_FILE)
+    return -1;
+  if(off + n < off || off + n > MAXFILE*BSIZE)
+    return -1;
+  end = off + n;
+  if(end <= ip->size)
+    return 0;
+
+  if(isinline(ip)){
+    if(end <= MAXINLINE){
+      memset((char*)ip->addrs + ip->size, 0, end - ip->size);
+      ip->size = end;
+      iupdate(ip);
+      return 0;
+    }
+    iuninline(ip);
+  }
+
+  bmapalloc(ip, (ip->size + BSIZE - 1) / BSIZE, (end + BSIZE - 1) / BSIZE,
+            UNWRITTEN);
+  ip->size = end;
+  iupdate(ip);
+  return 0;
+}
+
 //PAGEBREAK!
 // Directories
 
@@ -35,6 +35,16 @@ struct dinode {
   uint addrs[NDIRECT+1];   // Data block addresses
 };
 
+// Set in an addrs[] entry (or indirect block entry) for a block
+// that was reserved by fallocate() but never written. Such
+// blocks read as zeroes without touching the disk.
+#define UNWRITTEN 0x80000000
+
+// A regular file no bigger than this keeps its contents in the
+// dinode's addrs[] instead of in a data block, so reading it
+// costs only the inode block read.
+#define MAXINLINE ((NDIRECT+1)*sizeof(uint))
+
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
@@ -5,13 +5,14 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "trace.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -113,6 +114,7 @@ ideintr(void)
     return;
   }
   idequeue = b->qnext;
+  trace(TR_DISKDONE, b->blockno, 0);
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
@@ -147,6 +149,7 @@ iderw(struct buf *b)
     panic("iderw: ide disk 1 not present");
 
   acquire(&idelock);  //DOC:acquire-lock
+  trace(TR_DISKREQ, b->blockno, (b->flags & B_DIRTY) != 0);
 
   // Append b to idequeue.
   b->qnext = 0;
@@ -31,7 +31,7 @@ struct {
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  initlockkind(&kmem.lock, "kmem", LK_TICKET);
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -0,0 +1,23589 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory, basic version with two entries
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  # PG = paging; WP = write protect, i.e. read only
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax 
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 50 99 18 80       	mov    $0x80189950,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 b0 3e 10 80       	mov    $0x80103eb0,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return locked buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	57                   	push   %edi
+80100044:	89 d7                	mov    %edx,%edi
+80100046:	56                   	push   %esi
+80100047:	89 c6                	mov    %eax,%esi
+80100049:	53                   	push   %ebx
+8010004a:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  acquire(&bcache.lock);
+8010004d:	68 20 e7 10 80       	push   $0x8010e720
+80100052:	e8 d9 6c 00 00       	call   80106d30 <acquire>
+
+  // Is the block already cached?
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+80100057:	8b 1d 68 33 11 80    	mov    0x80113368,%ebx
+8010005d:	83 c4 10             	add    $0x10,%esp
+80100060:	81 fb ec 32 11 80    	cmp    $0x801132ec,%ebx
+80100066:	75 13                	jne    8010007b <bget+0x3b>
+80100068:	eb 26                	jmp    80100090 <bget+0x50>
+8010006a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80100070:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80100073:	81 fb ec 32 11 80    	cmp    $0x801132ec,%ebx
+80100079:	74 15                	je     80100090 <bget+0x50>
+    if(b->dev == dev && b->blockno == blockno){
+8010007b:	39 73 04             	cmp    %esi,0x4(%ebx)
+8010007e:	75 f0                	jne    80100070 <bget+0x30>
+80100080:	39 7b 08             	cmp    %edi,0x8(%ebx)
+80100083:	75 eb                	jne    80100070 <bget+0x30>
+      b->refcnt++;
+80100085:	83 43 74 01          	addl   $0x1,0x74(%ebx)
+      release(&bcache.lock);
+80100089:	eb 3f                	jmp    801000ca <bget+0x8a>
+8010008b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010008f:	90                   	nop
+  }
+
+  // Not cached; recycle an unused buffer.
+  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+  // because log.c has modified it but not yet committed it.
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+80100090:	8b 1d 64 33 11 80    	mov    0x80113364,%ebx
+80100096:	81 fb ec 32 11 80    	cmp    $0x801132ec,%ebx
+8010009c:	75 0d                	jne    801000ab <bget+0x6b>
+8010009e:	eb 4f                	jmp    801000ef <bget+0xaf>
+801000a0:	8b 5b 78             	mov    0x78(%ebx),%ebx
+801000a3:	81 fb ec 32 11 80    	cmp    $0x801132ec,%ebx
+801000a9:	74 44                	je     801000ef <bget+0xaf>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
+801000ab:	8b 43 74             	mov    0x74(%ebx),%eax
+801000ae:	85 c0                	test   %eax,%eax
+801000b0:	75 ee                	jne    801000a0 <bget+0x60>
+801000b2:	f6 03 04             	testb  $0x4,(%ebx)
+801000b5:	75 e9                	jne    801000a0 <bget+0x60>
+      b->dev = dev;
+801000b7:	89 73 04             	mov    %esi,0x4(%ebx)
+      b->blockno = blockno;
+801000ba:	89 7b 08             	mov    %edi,0x8(%ebx)
+      b->flags = 0;
+801000bd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+      b->refcnt = 1;
+801000c3:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+      release(&bcache.lock);
+801000ca:	83 ec 0c             	sub    $0xc,%esp
+801000cd:	68 20 e7 10 80       	push   $0x8010e720
+801000d2:	e8 19 6b 00 00       	call   80106bf0 <release>
+      acquiresleep(&b->lock);
+801000d7:	8d 43 0c             	lea    0xc(%ebx),%eax
+801000da:	89 04 24             	mov    %eax,(%esp)
+801000dd:	e8 7e 66 00 00       	call   80106760 <acquiresleep>
+      return b;
+801000e2:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+  panic("bget: no buffers");
+}
+801000e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801000e8:	89 d8                	mov    %ebx,%eax
+801000ea:	5b                   	pop    %ebx
+801000eb:	5e                   	pop    %esi
+801000ec:	5f                   	pop    %edi
+801000ed:	5d                   	pop    %ebp
+801000ee:	c3                   	ret
+  panic("bget: no buffers");
+801000ef:	83 ec 0c             	sub    $0xc,%esp
+801000f2:	68 80 b2 10 80       	push   $0x8010b280
+801000f7:	e8 e4 02 00 00       	call   801003e0 <panic>
+801000fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100100 <binit>:
+{
+80100100:	55                   	push   %ebp
+80100101:	89 e5                	mov    %esp,%ebp
+80100103:	53                   	push   %ebx
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100104:	bb 74 e7 10 80       	mov    $0x8010e774,%ebx
+{
+80100109:	83 ec 08             	sub    $0x8,%esp
+  initlockkind(&bcache.lock, "bcache", LK_MCS);
+8010010c:	6a 02                	push   $0x2
+8010010e:	68 91 b2 10 80       	push   $0x8010b291
+80100113:	68 20 e7 10 80       	push   $0x8010e720
+80100118:	e8 23 69 00 00       	call   80106a40 <initlockkind>
+  bcache.head.next = &bcache.head;
+8010011d:	83 c4 10             	add    $0x10,%esp
+80100120:	b8 ec 32 11 80       	mov    $0x801132ec,%eax
+  bcache.head.prev = &bcache.head;
+80100125:	c7 05 64 33 11 80 ec 	movl   $0x801132ec,0x80113364
+8010012c:	32 11 80 
+  bcache.head.next = &bcache.head;
+8010012f:	c7 05 68 33 11 80 ec 	movl   $0x801132ec,0x80113368
+80100136:	32 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100139:	eb 07                	jmp    80100142 <binit+0x42>
+8010013b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010013f:	90                   	nop
+80100140:	89 d3                	mov    %edx,%ebx
+    b->next = bcache.head.next;
+80100142:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100145:	83 ec 08             	sub    $0x8,%esp
+80100148:	8d 43 0c             	lea    0xc(%ebx),%eax
+    b->prev = &bcache.head;
+8010014b:	c7 43 78 ec 32 11 80 	movl   $0x801132ec,0x78(%ebx)
+    initsleeplock(&b->lock, "buffer");
+80100152:	68 98 b2 10 80       	push   $0x8010b298
+80100157:	50                   	push   %eax
+80100158:	e8 b3 65 00 00       	call   80106710 <initsleeplock>
+    bcache.head.next->prev = b;
+8010015d:	a1 68 33 11 80       	mov    0x80113368,%eax
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100162:	8d 93 84 02 00 00    	lea    0x284(%ebx),%edx
+80100168:	83 c4 10             	add    $0x10,%esp
+    bcache.head.next->prev = b;
+8010016b:	89 58 78             	mov    %ebx,0x78(%eax)
+    bcache.head.next = b;
+8010016e:	89 d8                	mov    %ebx,%eax
+80100170:	89 1d 68 33 11 80    	mov    %ebx,0x80113368
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100176:	81 fb 68 30 11 80    	cmp    $0x80113068,%ebx
+8010017c:	75 c2                	jne    80100140 <binit+0x40>
+}
+8010017e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100181:	c9                   	leave
+80100182:	c3                   	ret
+80100183:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010018a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100190 <bread>:
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+80100190:	55                   	push   %ebp
+80100191:	89 e5                	mov    %esp,%ebp
+80100193:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+80100196:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100199:	8b 45 08             	mov    0x8(%ebp),%eax
+8010019c:	e8 9f fe ff ff       	call   80100040 <bget>
+  if((b->flags & B_VALID) == 0) {
+801001a1:	f6 00 02             	testb  $0x2,(%eax)
+801001a4:	74 0a                	je     801001b0 <bread+0x20>
+    iderw(b);
+  }
+  return b;
+}
+801001a6:	c9                   	leave
+801001a7:	c3                   	ret
+801001a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001af:	90                   	nop
+    iderw(b);
+801001b0:	83 ec 0c             	sub    $0xc,%esp
+801001b3:	50                   	push   %eax
+801001b4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+801001b7:	e8 d4 2d 00 00       	call   80102f90 <iderw>
+801001bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801001bf:	83 c4 10             	add    $0x10,%esp
+}
+801001c2:	c9                   	leave
+801001c3:	c3                   	ret
+801001c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801001cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001cf:	90                   	nop
+
+801001d0 <bnew>:
+// Return a locked buf for a block whose old contents don't
+// matter, such as one that was just allocated, with its data
+// zero-filled. Unlike bread(), never reads the disk.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+801001d0:	55                   	push   %ebp
+801001d1:	89 e5                	mov    %esp,%ebp
+801001d3:	53                   	push   %ebx
+801001d4:	83 ec 04             	sub    $0x4,%esp
+  struct buf *b;
+
+  b = bget(dev, blockno);
+801001d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+801001da:	8b 45 08             	mov    0x8(%ebp),%eax
+801001dd:	e8 5e fe ff ff       	call   80100040 <bget>
+  memset(b->data, 0, BSIZE);
+801001e2:	83 ec 04             	sub    $0x4,%esp
+  b = bget(dev, blockno);
+801001e5:	89 c3                	mov    %eax,%ebx
+  memset(b->data, 0, BSIZE);
+801001e7:	8d 80 84 00 00 00    	lea    0x84(%eax),%eax
+801001ed:	68 00 02 00 00       	push   $0x200
+801001f2:	6a 00                	push   $0x0
+801001f4:	50                   	push   %eax
+801001f5:	e8 b6 70 00 00       	call   801072b0 <memset>
+  b->flags |= B_VALID;
+801001fa:	83 0b 02             	orl    $0x2,(%ebx)
+  return b;
+}
+801001fd:	89 d8                	mov    %ebx,%eax
+801001ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100202:	c9                   	leave
+80100203:	c3                   	ret
+80100204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010020b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010020f:	90                   	nop
+
+80100210 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100210:	55                   	push   %ebp
+80100211:	89 e5                	mov    %esp,%ebp
+80100213:	53                   	push   %ebx
+80100214:	83 ec 10             	sub    $0x10,%esp
+80100217:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010021a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010021d:	50                   	push   %eax
+8010021e:	e8 9d 66 00 00       	call   801068c0 <holdingsleep>
+80100223:	83 c4 10             	add    $0x10,%esp
+80100226:	85 c0                	test   %eax,%eax
+80100228:	74 0f                	je     80100239 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+8010022a:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+8010022d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100233:	c9                   	leave
+  iderw(b);
+80100234:	e9 57 2d 00 00       	jmp    80102f90 <iderw>
+    panic("bwrite");
+80100239:	83 ec 0c             	sub    $0xc,%esp
+8010023c:	68 9f b2 10 80       	push   $0x8010b29f
+80100241:	e8 9a 01 00 00       	call   801003e0 <panic>
+80100246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010024d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100250 <brelse>:
+
+// Release a locked buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+80100250:	55                   	push   %ebp
+80100251:	89 e5                	mov    %esp,%ebp
+80100253:	56                   	push   %esi
+80100254:	53                   	push   %ebx
+80100255:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100258:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010025b:	83 ec 0c             	sub    $0xc,%esp
+8010025e:	56                   	push   %esi
+8010025f:	e8 5c 66 00 00       	call   801068c0 <holdingsleep>
+80100264:	83 c4 10             	add    $0x10,%esp
+80100267:	85 c0                	test   %eax,%eax
+80100269:	74 63                	je     801002ce <brelse+0x7e>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010026b:	83 ec 0c             	sub    $0xc,%esp
+8010026e:	56                   	push   %esi
+8010026f:	e8 fc 65 00 00       	call   80106870 <releasesleep>
+
+  acquire(&bcache.lock);
+80100274:	c7 04 24 20 e7 10 80 	movl   $0x8010e720,(%esp)
+8010027b:	e8 b0 6a 00 00       	call   80106d30 <acquire>
+  b->refcnt--;
+80100280:	8b 43 74             	mov    0x74(%ebx),%eax
+  if (b->refcnt == 0) {
+80100283:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100286:	83 e8 01             	sub    $0x1,%eax
+80100289:	89 43 74             	mov    %eax,0x74(%ebx)
+  if (b->refcnt == 0) {
+8010028c:	85 c0                	test   %eax,%eax
+8010028e:	75 2c                	jne    801002bc <brelse+0x6c>
+    // no one is waiting for it.
+    b->next->prev = b->prev;
+80100290:	8b 53 7c             	mov    0x7c(%ebx),%edx
+80100293:	8b 43 78             	mov    0x78(%ebx),%eax
+80100296:	89 42 78             	mov    %eax,0x78(%edx)
+    b->prev->next = b->next;
+80100299:	8b 53 7c             	mov    0x7c(%ebx),%edx
+8010029c:	89 50 7c             	mov    %edx,0x7c(%eax)
+    b->next = bcache.head.next;
+8010029f:	a1 68 33 11 80       	mov    0x80113368,%eax
+    b->prev = &bcache.head;
+801002a4:	c7 43 78 ec 32 11 80 	movl   $0x801132ec,0x78(%ebx)
+    b->next = bcache.head.next;
+801002ab:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    bcache.head.next->prev = b;
+801002ae:	a1 68 33 11 80       	mov    0x80113368,%eax
+801002b3:	89 58 78             	mov    %ebx,0x78(%eax)
+    bcache.head.next = b;
+801002b6:	89 1d 68 33 11 80    	mov    %ebx,0x80113368
+  }
+  
+  release(&bcache.lock);
+801002bc:	c7 45 08 20 e7 10 80 	movl   $0x8010e720,0x8(%ebp)
+}
+801002c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801002c6:	5b                   	pop    %ebx
+801002c7:	5e                   	pop    %esi
+801002c8:	5d                   	pop    %ebp
+  release(&bcache.lock);
+801002c9:	e9 22 69 00 00       	jmp    80106bf0 <release>
+    panic("brelse");
+801002ce:	83 ec 0c             	sub    $0xc,%esp
+801002d1:	68 a6 b2 10 80       	push   $0x8010b2a6
+801002d6:	e8 05 01 00 00       	call   801003e0 <panic>
+801002db:	66 90                	xchg   %ax,%ax
+801002dd:	66 90                	xchg   %ax,%ax
+801002df:	90                   	nop
+
+801002e0 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+801002e0:	55                   	push   %ebp
+801002e1:	89 e5                	mov    %esp,%ebp
+801002e3:	57                   	push   %edi
+801002e4:	56                   	push   %esi
+801002e5:	53                   	push   %ebx
+801002e6:	83 ec 18             	sub    $0x18,%esp
+801002e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801002ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+801002ef:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+801002f2:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+801002f4:	e8 e7 1e 00 00       	call   801021e0 <iunlock>
+  acquire(&cons.lock);
+801002f9:	c7 04 24 20 36 11 80 	movl   $0x80113620,(%esp)
+80100300:	e8 2b 6a 00 00       	call   80106d30 <acquire>
+  while(n > 0){
+80100305:	83 c4 10             	add    $0x10,%esp
+80100308:	85 db                	test   %ebx,%ebx
+8010030a:	0f 8e 9c 00 00 00    	jle    801003ac <consoleread+0xcc>
+    while(input.r == input.w){
+80100310:	a1 00 36 11 80       	mov    0x80113600,%eax
+80100315:	39 05 04 36 11 80    	cmp    %eax,0x80113604
+8010031b:	74 25                	je     80100342 <consoleread+0x62>
+8010031d:	eb 61                	jmp    80100380 <consoleread+0xa0>
+8010031f:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80100320:	83 ec 08             	sub    $0x8,%esp
+80100323:	68 20 36 11 80       	push   $0x80113620
+80100328:	68 00 36 11 80       	push   $0x80113600
+8010032d:	e8 2e 54 00 00       	call   80105760 <sleep>
+    while(input.r == input.w){
+80100332:	a1 00 36 11 80       	mov    0x80113600,%eax
+80100337:	83 c4 10             	add    $0x10,%esp
+8010033a:	3b 05 04 36 11 80    	cmp    0x80113604,%eax
+80100340:	75 3e                	jne    80100380 <consoleread+0xa0>
+      if(myproc()->killed){
+80100342:	e8 e9 4c 00 00       	call   80105030 <myproc>
+80100347:	8b 88 90 00 00 00    	mov    0x90(%eax),%ecx
+8010034d:	85 c9                	test   %ecx,%ecx
+8010034f:	74 cf                	je     80100320 <consoleread+0x40>
+        release(&cons.lock);
+80100351:	83 ec 0c             	sub    $0xc,%esp
+80100354:	68 20 36 11 80       	push   $0x80113620
+80100359:	e8 92 68 00 00       	call   80106bf0 <release>
+        ilock(ip);
+8010035e:	5a                   	pop    %edx
+8010035f:	ff 75 08             	push   0x8(%ebp)
+80100362:	e8 99 1d 00 00       	call   80102100 <ilock>
+        return -1;
+80100367:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+8010036a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010036d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80100372:	5b                   	pop    %ebx
+80100373:	5e                   	pop    %esi
+80100374:	5f                   	pop    %edi
+80100375:	5d                   	pop    %ebp
+80100376:	c3                   	ret
+80100377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010037e:	66 90                	xchg   %ax,%ax
+    c = input.buf[input.r++ % INPUT_BUF];
+80100380:	8d 50 01             	lea    0x1(%eax),%edx
+80100383:	89 15 00 36 11 80    	mov    %edx,0x80113600
+80100389:	89 c2                	mov    %eax,%edx
+8010038b:	83 e2 7f             	and    $0x7f,%edx
+8010038e:	0f be 8a 80 35 11 80 	movsbl -0x7feeca80(%edx),%ecx
+    if(c == C('D')){  // EOF
+80100395:	80 f9 04             	cmp    $0x4,%cl
+80100398:	74 37                	je     801003d1 <consoleread+0xf1>
+    *dst++ = c;
+8010039a:	83 c6 01             	add    $0x1,%esi
+    --n;
+8010039d:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+801003a0:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+801003a3:	83 f9 0a             	cmp    $0xa,%ecx
+801003a6:	0f 85 5c ff ff ff    	jne    80100308 <consoleread+0x28>
+  release(&cons.lock);
+801003ac:	83 ec 0c             	sub    $0xc,%esp
+801003af:	68 20 36 11 80       	push   $0x80113620
+801003b4:	e8 37 68 00 00       	call   80106bf0 <release>
+  ilock(ip);
+801003b9:	58                   	pop    %eax
+801003ba:	ff 75 08             	push   0x8(%ebp)
+801003bd:	e8 3e 1d 00 00       	call   80102100 <ilock>
+  return target - n;
+801003c2:	89 f8                	mov    %edi,%eax
+801003c4:	83 c4 10             	add    $0x10,%esp
+}
+801003c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+801003ca:	29 d8                	sub    %ebx,%eax
+}
+801003cc:	5b                   	pop    %ebx
+801003cd:	5e                   	pop    %esi
+801003ce:	5f                   	pop    %edi
+801003cf:	5d                   	pop    %ebp
+801003d0:	c3                   	ret
+      if(n < target){
+801003d1:	39 fb                	cmp    %edi,%ebx
+801003d3:	73 d7                	jae    801003ac <consoleread+0xcc>
+        input.r--;
+801003d5:	a3 00 36 11 80       	mov    %eax,0x80113600
+801003da:	eb d0                	jmp    801003ac <consoleread+0xcc>
+801003dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801003e0 <panic>:
+{
+801003e0:	55                   	push   %ebp
+801003e1:	89 e5                	mov    %esp,%ebp
+801003e3:	56                   	push   %esi
+801003e4:	53                   	push   %ebx
+801003e5:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+801003e8:	fa                   	cli
+  cons.locking = 0;
+801003e9:	c7 05 74 36 11 80 00 	movl   $0x0,0x80113674
+801003f0:	00 00 00 
+  getcallerpcs(&s, pcs);
+801003f3:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+801003f6:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+801003f9:	e8 d2 31 00 00       	call   801035d0 <lapicid>
+801003fe:	83 ec 08             	sub    $0x8,%esp
+80100401:	50                   	push   %eax
+80100402:	68 ad b2 10 80       	push   $0x8010b2ad
+80100407:	e8 04 03 00 00       	call   80100710 <cprintf>
+  cprintf(s);
+8010040c:	58                   	pop    %eax
+8010040d:	ff 75 08             	push   0x8(%ebp)
+80100410:	e8 fb 02 00 00       	call   80100710 <cprintf>
+  cprintf("\n");
+80100415:	c7 04 24 27 bd 10 80 	movl   $0x8010bd27,(%esp)
+8010041c:	e8 ef 02 00 00       	call   80100710 <cprintf>
+  getcallerpcs(&s, pcs);
+80100421:	8d 45 08             	lea    0x8(%ebp),%eax
+80100424:	5a                   	pop    %edx
+80100425:	59                   	pop    %ecx
+80100426:	53                   	push   %ebx
+80100427:	50                   	push   %eax
+80100428:	e8 63 66 00 00       	call   80106a90 <getcallerpcs>
+  for(i=0; i<10; i++)
+8010042d:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+80100430:	83 ec 08             	sub    $0x8,%esp
+80100433:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+80100435:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+80100438:	68 c1 b2 10 80       	push   $0x8010b2c1
+8010043d:	e8 ce 02 00 00       	call   80100710 <cprintf>
+  for(i=0; i<10; i++)
+80100442:	83 c4 10             	add    $0x10,%esp
+80100445:	39 f3                	cmp    %esi,%ebx
+80100447:	75 e7                	jne    80100430 <panic+0x50>
+  panicked = 1; // freeze other CPU
+80100449:	c7 05 78 36 11 80 01 	movl   $0x1,0x80113678
+80100450:	00 00 00 
+  for(;;)
+80100453:	eb fe                	jmp    80100453 <panic+0x73>
+80100455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010045c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100460 <consputc.part.0>:
+consputc(int c)
+80100460:	55                   	push   %ebp
+80100461:	89 e5                	mov    %esp,%ebp
+80100463:	57                   	push   %edi
+80100464:	56                   	push   %esi
+80100465:	53                   	push   %ebx
+80100466:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100469:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010046e:	0f 84 cc 00 00 00    	je     80100540 <consputc.part.0+0xe0>
+    uartputc(c);
+80100474:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100477:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010047c:	89 c3                	mov    %eax,%ebx
+8010047e:	50                   	push   %eax
+8010047f:	e8 5c 98 00 00       	call   80109ce0 <uartputc>
+80100484:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100489:	89 fa                	mov    %edi,%edx
+8010048b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010048c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100491:	89 f2                	mov    %esi,%edx
+80100493:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100494:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100497:	89 fa                	mov    %edi,%edx
+80100499:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010049e:	c1 e1 08             	shl    $0x8,%ecx
+801004a1:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801004a2:	89 f2                	mov    %esi,%edx
+801004a4:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+801004a5:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+801004a8:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+801004ab:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+801004ad:	83 fb 0a             	cmp    $0xa,%ebx
+801004b0:	75 76                	jne    80100528 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+801004b2:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+801004b7:	f7 e2                	mul    %edx
+801004b9:	c1 ea 06             	shr    $0x6,%edx
+801004bc:	8d 04 92             	lea    (%edx,%edx,4),%eax
+801004bf:	c1 e0 04             	shl    $0x4,%eax
+801004c2:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+801004c5:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+801004cb:	0f 8f 2f 01 00 00    	jg     80100600 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+801004d1:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+801004d7:	0f 8f c3 00 00 00    	jg     801005a0 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+801004dd:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+801004df:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+801004e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+801004e9:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801004ec:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+801004f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+801004f6:	89 da                	mov    %ebx,%edx
+801004f8:	ee                   	out    %al,(%dx)
+801004f9:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+801004fe:	89 f8                	mov    %edi,%eax
+80100500:	89 ca                	mov    %ecx,%edx
+80100502:	ee                   	out    %al,(%dx)
+80100503:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100508:	89 da                	mov    %ebx,%edx
+8010050a:	ee                   	out    %al,(%dx)
+8010050b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+8010050f:	89 ca                	mov    %ecx,%edx
+80100511:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+80100512:	b8 20 07 00 00       	mov    $0x720,%eax
+80100517:	66 89 06             	mov    %ax,(%esi)
+}
+8010051a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010051d:	5b                   	pop    %ebx
+8010051e:	5e                   	pop    %esi
+8010051f:	5f                   	pop    %edi
+80100520:	5d                   	pop    %ebp
+80100521:	c3                   	ret
+80100522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80100528:	0f b6 db             	movzbl %bl,%ebx
+8010052b:	8d 70 01             	lea    0x1(%eax),%esi
+8010052e:	80 cf 07             	or     $0x7,%bh
+80100531:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+80100538:	80 
+80100539:	eb 8a                	jmp    801004c5 <consputc.part.0+0x65>
+8010053b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010053f:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80100540:	83 ec 0c             	sub    $0xc,%esp
+80100543:	be d4 03 00 00       	mov    $0x3d4,%esi
+80100548:	6a 08                	push   $0x8
+8010054a:	e8 91 97 00 00       	call   80109ce0 <uartputc>
+8010054f:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80100556:	e8 85 97 00 00       	call   80109ce0 <uartputc>
+8010055b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100562:	e8 79 97 00 00       	call   80109ce0 <uartputc>
+80100567:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010056c:	89 f2                	mov    %esi,%edx
+8010056e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010056f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100574:	89 da                	mov    %ebx,%edx
+80100576:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100577:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010057a:	89 f2                	mov    %esi,%edx
+8010057c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100581:	c1 e1 08             	shl    $0x8,%ecx
+80100584:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100585:	89 da                	mov    %ebx,%edx
+80100587:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100588:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010058b:	83 c4 10             	add    $0x10,%esp
+8010058e:	09 ce                	or     %ecx,%esi
+80100590:	74 5e                	je     801005f0 <consputc.part.0+0x190>
+80100592:	83 ee 01             	sub    $0x1,%esi
+80100595:	e9 2b ff ff ff       	jmp    801004c5 <consputc.part.0+0x65>
+8010059a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+801005a0:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+801005a3:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+801005a6:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+801005ad:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+801005b2:	68 60 0e 00 00       	push   $0xe60
+801005b7:	68 a0 80 0b 80       	push   $0x800b80a0
+801005bc:	68 00 80 0b 80       	push   $0x800b8000
+801005c1:	e8 7a 6d 00 00       	call   80107340 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+801005c6:	b8 80 07 00 00       	mov    $0x780,%eax
+801005cb:	83 c4 0c             	add    $0xc,%esp
+801005ce:	29 d8                	sub    %ebx,%eax
+801005d0:	01 c0                	add    %eax,%eax
+801005d2:	50                   	push   %eax
+801005d3:	6a 00                	push   $0x0
+801005d5:	56                   	push   %esi
+801005d6:	e8 d5 6c 00 00       	call   801072b0 <memset>
+  outb(CRTPORT+1, pos);
+801005db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+801005de:	83 c4 10             	add    $0x10,%esp
+801005e1:	e9 06 ff ff ff       	jmp    801004ec <consputc.part.0+0x8c>
+801005e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801005ed:	8d 76 00             	lea    0x0(%esi),%esi
+801005f0:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+801005f4:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+801005f9:	31 ff                	xor    %edi,%edi
+801005fb:	e9 ec fe ff ff       	jmp    801004ec <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100600:	83 ec 0c             	sub    $0xc,%esp
+80100603:	68 c5 b2 10 80       	push   $0x8010b2c5
+80100608:	e8 d3 fd ff ff       	call   801003e0 <panic>
+8010060d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100610 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100610:	55                   	push   %ebp
+80100611:	89 e5                	mov    %esp,%ebp
+80100613:	57                   	push   %edi
+80100614:	56                   	push   %esi
+80100615:	53                   	push   %ebx
+80100616:	83 ec 18             	sub    $0x18,%esp
+80100619:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+8010061c:	ff 75 08             	push   0x8(%ebp)
+8010061f:	e8 bc 1b 00 00       	call   801021e0 <iunlock>
+  acquire(&cons.lock);
+80100624:	c7 04 24 20 36 11 80 	movl   $0x80113620,(%esp)
+8010062b:	e8 00 67 00 00       	call   80106d30 <acquire>
+  for(i = 0; i < n; i++)
+80100630:	83 c4 10             	add    $0x10,%esp
+80100633:	85 f6                	test   %esi,%esi
+80100635:	7e 25                	jle    8010065c <consolewrite+0x4c>
+80100637:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010063a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+8010063d:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+    consputc(buf[i] & 0xff);
+80100643:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80100646:	85 d2                	test   %edx,%edx
+80100648:	74 06                	je     80100650 <consolewrite+0x40>
+  asm volatile("cli");
+8010064a:	fa                   	cli
+    for(;;)
+8010064b:	eb fe                	jmp    8010064b <consolewrite+0x3b>
+8010064d:	8d 76 00             	lea    0x0(%esi),%esi
+80100650:	e8 0b fe ff ff       	call   80100460 <consputc.part.0>
+  for(i = 0; i < n; i++)
+80100655:	83 c3 01             	add    $0x1,%ebx
+80100658:	39 df                	cmp    %ebx,%edi
+8010065a:	75 e1                	jne    8010063d <consolewrite+0x2d>
+  release(&cons.lock);
+8010065c:	83 ec 0c             	sub    $0xc,%esp
+8010065f:	68 20 36 11 80       	push   $0x80113620
+80100664:	e8 87 65 00 00       	call   80106bf0 <release>
+  ilock(ip);
+80100669:	58                   	pop    %eax
+8010066a:	ff 75 08             	push   0x8(%ebp)
+8010066d:	e8 8e 1a 00 00       	call   80102100 <ilock>
+
+  return n;
+}
+80100672:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100675:	89 f0                	mov    %esi,%eax
+80100677:	5b                   	pop    %ebx
+80100678:	5e                   	pop    %esi
+80100679:	5f                   	pop    %edi
+8010067a:	5d                   	pop    %ebp
+8010067b:	c3                   	ret
+8010067c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100680 <printint>:
+{
+80100680:	55                   	push   %ebp
+80100681:	89 e5                	mov    %esp,%ebp
+80100683:	57                   	push   %edi
+80100684:	56                   	push   %esi
+80100685:	89 c6                	mov    %eax,%esi
+80100687:	53                   	push   %ebx
+80100688:	89 d3                	mov    %edx,%ebx
+8010068a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010068d:	85 c9                	test   %ecx,%ecx
+8010068f:	74 04                	je     80100695 <printint+0x15>
+80100691:	85 c0                	test   %eax,%eax
+80100693:	78 63                	js     801006f8 <printint+0x78>
+    x = xx;
+80100695:	89 f1                	mov    %esi,%ecx
+80100697:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100699:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010069c:	31 f6                	xor    %esi,%esi
+8010069e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+801006a0:	89 c8                	mov    %ecx,%eax
+801006a2:	31 d2                	xor    %edx,%edx
+801006a4:	89 f7                	mov    %esi,%edi
+801006a6:	f7 f3                	div    %ebx
+801006a8:	8d 76 01             	lea    0x1(%esi),%esi
+801006ab:	0f b6 92 f0 b2 10 80 	movzbl -0x7fef4d10(%edx),%edx
+801006b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+801006b6:	89 ca                	mov    %ecx,%edx
+801006b8:	89 c1                	mov    %eax,%ecx
+801006ba:	39 da                	cmp    %ebx,%edx
+801006bc:	73 e2                	jae    801006a0 <printint+0x20>
+  if(sign)
+801006be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801006c1:	85 c0                	test   %eax,%eax
+801006c3:	74 07                	je     801006cc <printint+0x4c>
+    buf[i++] = '-';
+801006c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+801006ca:	89 f7                	mov    %esi,%edi
+801006cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+801006cf:	01 df                	add    %ebx,%edi
+  if(panicked){
+801006d1:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+    consputc(buf[i]);
+801006d7:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+801006da:	85 d2                	test   %edx,%edx
+801006dc:	74 0a                	je     801006e8 <printint+0x68>
+801006de:	fa                   	cli
+    for(;;)
+801006df:	eb fe                	jmp    801006df <printint+0x5f>
+801006e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006e8:	e8 73 fd ff ff       	call   80100460 <consputc.part.0>
+  while(--i >= 0)
+801006ed:	8d 47 ff             	lea    -0x1(%edi),%eax
+801006f0:	39 df                	cmp    %ebx,%edi
+801006f2:	74 0c                	je     80100700 <printint+0x80>
+801006f4:	89 c7                	mov    %eax,%edi
+801006f6:	eb d9                	jmp    801006d1 <printint+0x51>
+801006f8:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+801006fa:	89 f1                	mov    %esi,%ecx
+801006fc:	f7 d9                	neg    %ecx
+801006fe:	eb 99                	jmp    80100699 <printint+0x19>
+}
+80100700:	83 c4 2c             	add    $0x2c,%esp
+80100703:	5b                   	pop    %ebx
+80100704:	5e                   	pop    %esi
+80100705:	5f                   	pop    %edi
+80100706:	5d                   	pop    %ebp
+80100707:	c3                   	ret
+80100708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010070f:	90                   	nop
+
+80100710 <cprintf>:
+{
+80100710:	55                   	push   %ebp
+80100711:	89 e5                	mov    %esp,%ebp
+80100713:	57                   	push   %edi
+80100714:	56                   	push   %esi
+80100715:	53                   	push   %ebx
+80100716:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100719:	8b 3d 74 36 11 80    	mov    0x80113674,%edi
+  if (fmt == 0)
+8010071f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80100722:	85 ff                	test   %edi,%edi
+80100724:	0f 85 36 01 00 00    	jne    80100860 <cprintf+0x150>
+  if (fmt == 0)
+8010072a:	85 f6                	test   %esi,%esi
+8010072c:	0f 84 e0 01 00 00    	je     80100912 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100732:	0f b6 06             	movzbl (%esi),%eax
+80100735:	85 c0                	test   %eax,%eax
+80100737:	74 6b                	je     801007a4 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80100739:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010073c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010073f:	31 db                	xor    %ebx,%ebx
+80100741:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80100743:	83 f8 25             	cmp    $0x25,%eax
+80100746:	0f 85 dc 00 00 00    	jne    80100828 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+8010074c:	83 c3 01             	add    $0x1,%ebx
+8010074f:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80100753:	85 c9                	test   %ecx,%ecx
+80100755:	74 42                	je     80100799 <cprintf+0x89>
+    switch(c){
+80100757:	83 f9 70             	cmp    $0x70,%ecx
+8010075a:	0f 84 99 00 00 00    	je     801007f9 <cprintf+0xe9>
+80100760:	7f 4e                	jg     801007b0 <cprintf+0xa0>
+80100762:	83 f9 25             	cmp    $0x25,%ecx
+80100765:	0f 84 cd 00 00 00    	je     80100838 <cprintf+0x128>
+8010076b:	83 f9 64             	cmp    $0x64,%ecx
+8010076e:	0f 85 24 01 00 00    	jne    80100898 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100774:	8d 47 04             	lea    0x4(%edi),%eax
+80100777:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010077c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100781:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100784:	8b 07                	mov    (%edi),%eax
+80100786:	e8 f5 fe ff ff       	call   80100680 <printint>
+8010078b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010078e:	83 c3 01             	add    $0x1,%ebx
+80100791:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100795:	85 c0                	test   %eax,%eax
+80100797:	75 aa                	jne    80100743 <cprintf+0x33>
+80100799:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+8010079c:	85 ff                	test   %edi,%edi
+8010079e:	0f 85 df 00 00 00    	jne    80100883 <cprintf+0x173>
+}
+801007a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801007a7:	5b                   	pop    %ebx
+801007a8:	5e                   	pop    %esi
+801007a9:	5f                   	pop    %edi
+801007aa:	5d                   	pop    %ebp
+801007ab:	c3                   	ret
+801007ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+801007b0:	83 f9 73             	cmp    $0x73,%ecx
+801007b3:	75 3b                	jne    801007f0 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+801007b5:	8b 17                	mov    (%edi),%edx
+801007b7:	8d 47 04             	lea    0x4(%edi),%eax
+801007ba:	85 d2                	test   %edx,%edx
+801007bc:	0f 85 0e 01 00 00    	jne    801008d0 <cprintf+0x1c0>
+801007c2:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+801007c7:	bf d8 b2 10 80       	mov    $0x8010b2d8,%edi
+801007cc:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+801007cf:	89 fb                	mov    %edi,%ebx
+801007d1:	89 f7                	mov    %esi,%edi
+801007d3:	89 c6                	mov    %eax,%esi
+801007d5:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+801007d8:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+801007de:	85 d2                	test   %edx,%edx
+801007e0:	0f 84 fe 00 00 00    	je     801008e4 <cprintf+0x1d4>
+801007e6:	fa                   	cli
+    for(;;)
+801007e7:	eb fe                	jmp    801007e7 <cprintf+0xd7>
+801007e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+801007f0:	83 f9 78             	cmp    $0x78,%ecx
+801007f3:	0f 85 9f 00 00 00    	jne    80100898 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+801007f9:	8d 47 04             	lea    0x4(%edi),%eax
+801007fc:	31 c9                	xor    %ecx,%ecx
+801007fe:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100803:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100806:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100809:	8b 07                	mov    (%edi),%eax
+8010080b:	e8 70 fe ff ff       	call   80100680 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100810:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100814:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100817:	85 c0                	test   %eax,%eax
+80100819:	0f 85 24 ff ff ff    	jne    80100743 <cprintf+0x33>
+8010081f:	e9 75 ff ff ff       	jmp    80100799 <cprintf+0x89>
+80100824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80100828:	8b 0d 78 36 11 80    	mov    0x80113678,%ecx
+8010082e:	85 c9                	test   %ecx,%ecx
+80100830:	74 15                	je     80100847 <cprintf+0x137>
+80100832:	fa                   	cli
+    for(;;)
+80100833:	eb fe                	jmp    80100833 <cprintf+0x123>
+80100835:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80100838:	8b 0d 78 36 11 80    	mov    0x80113678,%ecx
+8010083e:	85 c9                	test   %ecx,%ecx
+80100840:	75 7e                	jne    801008c0 <cprintf+0x1b0>
+80100842:	b8 25 00 00 00       	mov    $0x25,%eax
+80100847:	e8 14 fc ff ff       	call   80100460 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010084c:	83 c3 01             	add    $0x1,%ebx
+8010084f:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100853:	85 c0                	test   %eax,%eax
+80100855:	0f 85 e8 fe ff ff    	jne    80100743 <cprintf+0x33>
+8010085b:	e9 39 ff ff ff       	jmp    80100799 <cprintf+0x89>
+    acquire(&cons.lock);
+80100860:	83 ec 0c             	sub    $0xc,%esp
+80100863:	68 20 36 11 80       	push   $0x80113620
+80100868:	e8 c3 64 00 00       	call   80106d30 <acquire>
+  if (fmt == 0)
+8010086d:	83 c4 10             	add    $0x10,%esp
+80100870:	85 f6                	test   %esi,%esi
+80100872:	0f 84 9a 00 00 00    	je     80100912 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100878:	0f b6 06             	movzbl (%esi),%eax
+8010087b:	85 c0                	test   %eax,%eax
+8010087d:	0f 85 b6 fe ff ff    	jne    80100739 <cprintf+0x29>
+    release(&cons.lock);
+80100883:	83 ec 0c             	sub    $0xc,%esp
+80100886:	68 20 36 11 80       	push   $0x80113620
+8010088b:	e8 60 63 00 00       	call   80106bf0 <release>
+80100890:	83 c4 10             	add    $0x10,%esp
+80100893:	e9 0c ff ff ff       	jmp    801007a4 <cprintf+0x94>
+  if(panicked){
+80100898:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+8010089e:	85 d2                	test   %edx,%edx
+801008a0:	75 26                	jne    801008c8 <cprintf+0x1b8>
+801008a2:	b8 25 00 00 00       	mov    $0x25,%eax
+801008a7:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801008aa:	e8 b1 fb ff ff       	call   80100460 <consputc.part.0>
+801008af:	a1 78 36 11 80       	mov    0x80113678,%eax
+801008b4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801008b7:	85 c0                	test   %eax,%eax
+801008b9:	74 4b                	je     80100906 <cprintf+0x1f6>
+801008bb:	fa                   	cli
+    for(;;)
+801008bc:	eb fe                	jmp    801008bc <cprintf+0x1ac>
+801008be:	66 90                	xchg   %ax,%ax
+801008c0:	fa                   	cli
+801008c1:	eb fe                	jmp    801008c1 <cprintf+0x1b1>
+801008c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801008c7:	90                   	nop
+801008c8:	fa                   	cli
+801008c9:	eb fe                	jmp    801008c9 <cprintf+0x1b9>
+801008cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801008cf:	90                   	nop
+      for(; *s; s++)
+801008d0:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+801008d3:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+801008d5:	84 c9                	test   %cl,%cl
+801008d7:	0f 85 ef fe ff ff    	jne    801007cc <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+801008dd:	89 c7                	mov    %eax,%edi
+801008df:	e9 aa fe ff ff       	jmp    8010078e <cprintf+0x7e>
+801008e4:	e8 77 fb ff ff       	call   80100460 <consputc.part.0>
+      for(; *s; s++)
+801008e9:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+801008ed:	83 c3 01             	add    $0x1,%ebx
+801008f0:	84 c0                	test   %al,%al
+801008f2:	0f 85 e0 fe ff ff    	jne    801007d8 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+801008f8:	89 f0                	mov    %esi,%eax
+801008fa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801008fd:	89 fe                	mov    %edi,%esi
+801008ff:	89 c7                	mov    %eax,%edi
+80100901:	e9 88 fe ff ff       	jmp    8010078e <cprintf+0x7e>
+80100906:	89 c8                	mov    %ecx,%eax
+80100908:	e8 53 fb ff ff       	call   80100460 <consputc.part.0>
+8010090d:	e9 7c fe ff ff       	jmp    8010078e <cprintf+0x7e>
+    panic("null fmt");
+80100912:	83 ec 0c             	sub    $0xc,%esp
+80100915:	68 df b2 10 80       	push   $0x8010b2df
+8010091a:	e8 c1 fa ff ff       	call   801003e0 <panic>
+8010091f:	90                   	nop
+
+80100920 <consoleintr>:
+{
+80100920:	55                   	push   %ebp
+80100921:	89 e5                	mov    %esp,%ebp
+80100923:	57                   	push   %edi
+80100924:	56                   	push   %esi
+  int c, doprocdump = 0;
+80100925:	31 f6                	xor    %esi,%esi
+{
+80100927:	53                   	push   %ebx
+80100928:	83 ec 18             	sub    $0x18,%esp
+8010092b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+8010092e:	68 20 36 11 80       	push   $0x80113620
+80100933:	e8 f8 63 00 00       	call   80106d30 <acquire>
+  while((c = getc()) >= 0){
+80100938:	83 c4 10             	add    $0x10,%esp
+8010093b:	eb 1a                	jmp    80100957 <consoleintr+0x37>
+8010093d:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+80100940:	83 fb 08             	cmp    $0x8,%ebx
+80100943:	0f 84 d7 00 00 00    	je     80100a20 <consoleintr+0x100>
+80100949:	83 fb 10             	cmp    $0x10,%ebx
+8010094c:	0f 85 2d 01 00 00    	jne    80100a7f <consoleintr+0x15f>
+80100952:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100957:	ff d7                	call   *%edi
+80100959:	89 c3                	mov    %eax,%ebx
+8010095b:	85 c0                	test   %eax,%eax
+8010095d:	0f 88 e5 00 00 00    	js     80100a48 <consoleintr+0x128>
+    switch(c){
+80100963:	83 fb 15             	cmp    $0x15,%ebx
+80100966:	74 7a                	je     801009e2 <consoleintr+0xc2>
+80100968:	7e d6                	jle    80100940 <consoleintr+0x20>
+8010096a:	83 fb 7f             	cmp    $0x7f,%ebx
+8010096d:	0f 84 ad 00 00 00    	je     80100a20 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100973:	a1 08 36 11 80       	mov    0x80113608,%eax
+80100978:	89 c2                	mov    %eax,%edx
+8010097a:	2b 15 00 36 11 80    	sub    0x80113600,%edx
+80100980:	83 fa 7f             	cmp    $0x7f,%edx
+80100983:	77 d2                	ja     80100957 <consoleintr+0x37>
+  if(panicked){
+80100985:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+8010098b:	8d 48 01             	lea    0x1(%eax),%ecx
+8010098e:	83 e0 7f             	and    $0x7f,%eax
+80100991:	89 0d 08 36 11 80    	mov    %ecx,0x80113608
+80100997:	88 98 80 35 11 80    	mov    %bl,-0x7feeca80(%eax)
+  if(panicked){
+8010099d:	85 d2                	test   %edx,%edx
+8010099f:	0f 85 47 01 00 00    	jne    80100aec <consoleintr+0x1cc>
+801009a5:	89 d8                	mov    %ebx,%eax
+801009a7:	e8 b4 fa ff ff       	call   80100460 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+801009ac:	83 fb 0a             	cmp    $0xa,%ebx
+801009af:	0f 84 18 01 00 00    	je     80100acd <consoleintr+0x1ad>
+801009b5:	83 fb 04             	cmp    $0x4,%ebx
+801009b8:	0f 84 0f 01 00 00    	je     80100acd <consoleintr+0x1ad>
+801009be:	a1 00 36 11 80       	mov    0x80113600,%eax
+801009c3:	83 e8 80             	sub    $0xffffff80,%eax
+801009c6:	39 05 08 36 11 80    	cmp    %eax,0x80113608
+801009cc:	75 89                	jne    80100957 <consoleintr+0x37>
+801009ce:	e9 ff 00 00 00       	jmp    80100ad2 <consoleintr+0x1b2>
+801009d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801009d7:	90                   	nop
+801009d8:	b8 00 01 00 00       	mov    $0x100,%eax
+801009dd:	e8 7e fa ff ff       	call   80100460 <consputc.part.0>
+      while(input.e != input.w &&
+801009e2:	a1 08 36 11 80       	mov    0x80113608,%eax
+801009e7:	3b 05 04 36 11 80    	cmp    0x80113604,%eax
+801009ed:	0f 84 64 ff ff ff    	je     80100957 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+801009f3:	83 e8 01             	sub    $0x1,%eax
+801009f6:	89 c2                	mov    %eax,%edx
+801009f8:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+801009fb:	80 ba 80 35 11 80 0a 	cmpb   $0xa,-0x7feeca80(%edx)
+80100a02:	0f 84 4f ff ff ff    	je     80100957 <consoleintr+0x37>
+  if(panicked){
+80100a08:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+        input.e--;
+80100a0e:	a3 08 36 11 80       	mov    %eax,0x80113608
+  if(panicked){
+80100a13:	85 d2                	test   %edx,%edx
+80100a15:	74 c1                	je     801009d8 <consoleintr+0xb8>
+80100a17:	fa                   	cli
+    for(;;)
+80100a18:	eb fe                	jmp    80100a18 <consoleintr+0xf8>
+80100a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+80100a20:	a1 08 36 11 80       	mov    0x80113608,%eax
+80100a25:	3b 05 04 36 11 80    	cmp    0x80113604,%eax
+80100a2b:	0f 84 26 ff ff ff    	je     80100957 <consoleintr+0x37>
+        input.e--;
+80100a31:	83 e8 01             	sub    $0x1,%eax
+80100a34:	a3 08 36 11 80       	mov    %eax,0x80113608
+  if(panicked){
+80100a39:	a1 78 36 11 80       	mov    0x80113678,%eax
+80100a3e:	85 c0                	test   %eax,%eax
+80100a40:	74 22                	je     80100a64 <consoleintr+0x144>
+80100a42:	fa                   	cli
+    for(;;)
+80100a43:	eb fe                	jmp    80100a43 <consoleintr+0x123>
+80100a45:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+80100a48:	83 ec 0c             	sub    $0xc,%esp
+80100a4b:	68 20 36 11 80       	push   $0x80113620
+80100a50:	e8 9b 61 00 00       	call   80106bf0 <release>
+  if(doprocdump) {
+80100a55:	83 c4 10             	add    $0x10,%esp
+80100a58:	85 f6                	test   %esi,%esi
+80100a5a:	75 17                	jne    80100a73 <consoleintr+0x153>
+}
+80100a5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a5f:	5b                   	pop    %ebx
+80100a60:	5e                   	pop    %esi
+80100a61:	5f                   	pop    %edi
+80100a62:	5d                   	pop    %ebp
+80100a63:	c3                   	ret
+80100a64:	b8 00 01 00 00       	mov    $0x100,%eax
+80100a69:	e8 f2 f9 ff ff       	call   80100460 <consputc.part.0>
+80100a6e:	e9 e4 fe ff ff       	jmp    80100957 <consoleintr+0x37>
+80100a73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100a76:	5b                   	pop    %ebx
+80100a77:	5e                   	pop    %esi
+80100a78:	5f                   	pop    %edi
+80100a79:	5d                   	pop    %ebp
+    procdump();  // now call procdump() wo. cons.lock held
+80100a7a:	e9 81 57 00 00       	jmp    80106200 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100a7f:	85 db                	test   %ebx,%ebx
+80100a81:	0f 84 d0 fe ff ff    	je     80100957 <consoleintr+0x37>
+80100a87:	a1 08 36 11 80       	mov    0x80113608,%eax
+80100a8c:	89 c2                	mov    %eax,%edx
+80100a8e:	2b 15 00 36 11 80    	sub    0x80113600,%edx
+80100a94:	83 fa 7f             	cmp    $0x7f,%edx
+80100a97:	0f 87 ba fe ff ff    	ja     80100957 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100a9d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100aa0:	8b 15 78 36 11 80    	mov    0x80113678,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100aa6:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100aa9:	83 fb 0d             	cmp    $0xd,%ebx
+80100aac:	0f 85 df fe ff ff    	jne    80100991 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100ab2:	89 0d 08 36 11 80    	mov    %ecx,0x80113608
+80100ab8:	c6 80 80 35 11 80 0a 	movb   $0xa,-0x7feeca80(%eax)
+  if(panicked){
+80100abf:	85 d2                	test   %edx,%edx
+80100ac1:	75 29                	jne    80100aec <consoleintr+0x1cc>
+80100ac3:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100ac8:	e8 93 f9 ff ff       	call   80100460 <consputc.part.0>
+          input.w = input.e;
+80100acd:	a1 08 36 11 80       	mov    0x80113608,%eax
+          wakeup(&input.r);
+80100ad2:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100ad5:	a3 04 36 11 80       	mov    %eax,0x80113604
+          wakeup(&input.r);
+80100ada:	68 00 36 11 80       	push   $0x80113600
+80100adf:	e8 2c 4f 00 00       	call   80105a10 <wakeup>
+80100ae4:	83 c4 10             	add    $0x10,%esp
+80100ae7:	e9 6b fe ff ff       	jmp    80100957 <consoleintr+0x37>
+80100aec:	fa                   	cli
+    for(;;)
+80100aed:	eb fe                	jmp    80100aed <consoleintr+0x1cd>
+80100aef:	90                   	nop
+
+80100af0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100af0:	55                   	push   %ebp
+80100af1:	89 e5                	mov    %esp,%ebp
+80100af3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100af6:	68 e8 b2 10 80       	push   $0x8010b2e8
+80100afb:	68 20 36 11 80       	push   $0x80113620
+80100b00:	e8 db 5e 00 00       	call   801069e0 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100b05:	c7 05 ec 41 11 80 10 	movl   $0x80100610,0x801141ec
+80100b0c:	06 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100b0f:	c7 05 e8 41 11 80 e0 	movl   $0x801002e0,0x801141e8
+80100b16:	02 10 80 
+  cons.locking = 1;
+80100b19:	c7 05 74 36 11 80 01 	movl   $0x1,0x80113674
+80100b20:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100b23:	58                   	pop    %eax
+80100b24:	5a                   	pop    %edx
+80100b25:	6a 00                	push   $0x0
+80100b27:	6a 01                	push   $0x1
+80100b29:	e8 22 26 00 00       	call   80103150 <ioapicenable>
+}
+80100b2e:	83 c4 10             	add    $0x10,%esp
+80100b31:	c9                   	leave
+80100b32:	c3                   	ret
+80100b33:	66 90                	xchg   %ax,%ax
+80100b35:	66 90                	xchg   %ax,%ax
+80100b37:	66 90                	xchg   %ax,%ax
+80100b39:	66 90                	xchg   %ax,%ax
+80100b3b:	66 90                	xchg   %ax,%ax
+80100b3d:	66 90                	xchg   %ax,%ax
+80100b3f:	90                   	nop
+
+80100b40 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100b40:	55                   	push   %ebp
+80100b41:	89 e5                	mov    %esp,%ebp
+80100b43:	57                   	push   %edi
+80100b44:	56                   	push   %esi
+80100b45:	53                   	push   %ebx
+80100b46:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100b4c:	e8 df 44 00 00       	call   80105030 <myproc>
+80100b51:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80100b57:	e8 34 30 00 00       	call   80103b90 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80100b5c:	83 ec 0c             	sub    $0xc,%esp
+80100b5f:	ff 75 08             	push   0x8(%ebp)
+80100b62:	e8 c9 21 00 00       	call   80102d30 <namei>
+80100b67:	83 c4 10             	add    $0x10,%esp
+80100b6a:	85 c0                	test   %eax,%eax
+80100b6c:	0f 84 52 03 00 00    	je     80100ec4 <exec+0x384>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80100b72:	83 ec 0c             	sub    $0xc,%esp
+80100b75:	89 c7                	mov    %eax,%edi
+80100b77:	50                   	push   %eax
+80100b78:	e8 83 15 00 00       	call   80102100 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80100b7d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80100b83:	6a 34                	push   $0x34
+80100b85:	6a 00                	push   $0x0
+80100b87:	50                   	push   %eax
+80100b88:	57                   	push   %edi
+80100b89:	e8 b2 18 00 00       	call   80102440 <readi>
+80100b8e:	83 c4 20             	add    $0x20,%esp
+80100b91:	83 f8 34             	cmp    $0x34,%eax
+80100b94:	0f 85 19 01 00 00    	jne    80100cb3 <exec+0x173>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80100b9a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80100ba1:	45 4c 46 
+80100ba4:	0f 85 09 01 00 00    	jne    80100cb3 <exec+0x173>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80100baa:	e8 81 a3 00 00       	call   8010af30 <setupkvm>
+80100baf:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80100bb5:	85 c0                	test   %eax,%eax
+80100bb7:	0f 84 f6 00 00 00    	je     80100cb3 <exec+0x173>
+    goto bad;
+  if(mapvdso(pgdir, curproc->pid) < 0)
+80100bbd:	8b 8d ec fe ff ff    	mov    -0x114(%ebp),%ecx
+80100bc3:	83 ec 08             	sub    $0x8,%esp
+80100bc6:	ff 71 64             	push   0x64(%ecx)
+80100bc9:	50                   	push   %eax
+80100bca:	e8 41 a2 00 00       	call   8010ae10 <mapvdso>
+80100bcf:	83 c4 10             	add    $0x10,%esp
+80100bd2:	85 c0                	test   %eax,%eax
+80100bd4:	0f 88 c8 00 00 00    	js     80100ca2 <exec+0x162>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100bda:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80100be1:	00 
+80100be2:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+80100be8:	0f 84 a6 02 00 00    	je     80100e94 <exec+0x354>
+  sz = 0;
+80100bee:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100bf5:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100bf8:	31 db                	xor    %ebx,%ebx
+80100bfa:	e9 87 00 00 00       	jmp    80100c86 <exec+0x146>
+80100bff:	90                   	nop
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80100c00:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80100c07:	75 6c                	jne    80100c75 <exec+0x135>
+      continue;
+    if(ph.memsz < ph.filesz)
+80100c09:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80100c0f:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80100c15:	0f 82 87 00 00 00    	jb     80100ca2 <exec+0x162>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80100c1b:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80100c21:	72 7f                	jb     80100ca2 <exec+0x162>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80100c23:	83 ec 04             	sub    $0x4,%esp
+80100c26:	50                   	push   %eax
+80100c27:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80100c2d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100c33:	e8 c8 a0 00 00       	call   8010ad00 <allocuvm>
+80100c38:	83 c4 10             	add    $0x10,%esp
+80100c3b:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100c41:	85 c0                	test   %eax,%eax
+80100c43:	74 5d                	je     80100ca2 <exec+0x162>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80100c45:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80100c4b:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80100c50:	75 50                	jne    80100ca2 <exec+0x162>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80100c52:	83 ec 0c             	sub    $0xc,%esp
+80100c55:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80100c5b:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80100c61:	57                   	push   %edi
+80100c62:	50                   	push   %eax
+80100c63:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100c69:	e8 c2 9f 00 00       	call   8010ac30 <loaduvm>
+80100c6e:	83 c4 20             	add    $0x20,%esp
+80100c71:	85 c0                	test   %eax,%eax
+80100c73:	78 2d                	js     80100ca2 <exec+0x162>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100c75:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80100c7c:	83 c3 01             	add    $0x1,%ebx
+80100c7f:	83 c6 20             	add    $0x20,%esi
+80100c82:	39 d8                	cmp    %ebx,%eax
+80100c84:	7e 52                	jle    80100cd8 <exec+0x198>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80100c86:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80100c8c:	6a 20                	push   $0x20
+80100c8e:	56                   	push   %esi
+80100c8f:	50                   	push   %eax
+80100c90:	57                   	push   %edi
+80100c91:	e8 aa 17 00 00       	call   80102440 <readi>
+80100c96:	83 c4 10             	add    $0x10,%esp
+80100c99:	83 f8 20             	cmp    $0x20,%eax
+80100c9c:	0f 84 5e ff ff ff    	je     80100c00 <exec+0xc0>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80100ca2:	83 ec 0c             	sub    $0xc,%esp
+80100ca5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100cab:	e8 00 a2 00 00       	call   8010aeb0 <freevm>
+80100cb0:	83 c4 10             	add    $0x10,%esp
+  if(ip){
+    iunlockput(ip);
+80100cb3:	83 ec 0c             	sub    $0xc,%esp
+80100cb6:	57                   	push   %edi
+80100cb7:	e8 04 17 00 00       	call   801023c0 <iunlockput>
+    end_op();
+80100cbc:	e8 3f 2f 00 00       	call   80103c00 <end_op>
+80100cc1:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80100cc4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80100cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100ccc:	5b                   	pop    %ebx
+80100ccd:	5e                   	pop    %esi
+80100cce:	5f                   	pop    %edi
+80100ccf:	5d                   	pop    %ebp
+80100cd0:	c3                   	ret
+80100cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80100cd8:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80100cde:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+80100ce4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100cea:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80100cf0:	83 ec 0c             	sub    $0xc,%esp
+80100cf3:	57                   	push   %edi
+80100cf4:	e8 c7 16 00 00       	call   801023c0 <iunlockput>
+  end_op();
+80100cf9:	e8 02 2f 00 00       	call   80103c00 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80100cfe:	83 c4 0c             	add    $0xc,%esp
+80100d01:	53                   	push   %ebx
+80100d02:	56                   	push   %esi
+80100d03:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+80100d09:	56                   	push   %esi
+80100d0a:	e8 f1 9f 00 00       	call   8010ad00 <allocuvm>
+80100d0f:	83 c4 10             	add    $0x10,%esp
+80100d12:	89 c7                	mov    %eax,%edi
+80100d14:	85 c0                	test   %eax,%eax
+80100d16:	0f 84 86 00 00 00    	je     80100da2 <exec+0x262>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100d1c:	83 ec 08             	sub    $0x8,%esp
+80100d1f:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+80100d25:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100d27:	50                   	push   %eax
+80100d28:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+80100d29:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80100d2b:	e8 a0 a2 00 00       	call   8010afd0 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80100d30:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100d33:	83 c4 10             	add    $0x10,%esp
+80100d36:	8b 10                	mov    (%eax),%edx
+80100d38:	85 d2                	test   %edx,%edx
+80100d3a:	0f 84 60 01 00 00    	je     80100ea0 <exec+0x360>
+80100d40:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+80100d46:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80100d49:	eb 23                	jmp    80100d6e <exec+0x22e>
+80100d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d4f:	90                   	nop
+80100d50:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80100d53:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80100d5a:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+80100d60:	8b 14 87             	mov    (%edi,%eax,4),%edx
+80100d63:	85 d2                	test   %edx,%edx
+80100d65:	74 51                	je     80100db8 <exec+0x278>
+    if(argc >= MAXARG)
+80100d67:	83 f8 20             	cmp    $0x20,%eax
+80100d6a:	74 36                	je     80100da2 <exec+0x262>
+  for(argc = 0; argv[argc]; argc++) {
+80100d6c:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d6e:	83 ec 0c             	sub    $0xc,%esp
+80100d71:	52                   	push   %edx
+80100d72:	e8 29 67 00 00       	call   801074a0 <strlen>
+80100d77:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d79:	58                   	pop    %eax
+80100d7a:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80100d7d:	83 eb 01             	sub    $0x1,%ebx
+80100d80:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80100d83:	e8 18 67 00 00       	call   801074a0 <strlen>
+80100d88:	83 c0 01             	add    $0x1,%eax
+80100d8b:	50                   	push   %eax
+80100d8c:	ff 34 b7             	push   (%edi,%esi,4)
+80100d8f:	53                   	push   %ebx
+80100d90:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100d96:	e8 05 a4 00 00       	call   8010b1a0 <copyout>
+80100d9b:	83 c4 20             	add    $0x20,%esp
+80100d9e:	85 c0                	test   %eax,%eax
+80100da0:	79 ae                	jns    80100d50 <exec+0x210>
+    freevm(pgdir);
+80100da2:	83 ec 0c             	sub    $0xc,%esp
+80100da5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100dab:	e8 00 a1 00 00       	call   8010aeb0 <freevm>
+80100db0:	83 c4 10             	add    $0x10,%esp
+80100db3:	e9 0c ff ff ff       	jmp    80100cc4 <exec+0x184>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100db8:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80100dbf:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80100dc5:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80100dcb:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80100dce:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80100dd1:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80100dd8:	00 00 00 00 
+  ustack[1] = argc;
+80100ddc:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80100de2:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80100de9:	ff ff ff 
+  ustack[1] = argc;
+80100dec:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100df2:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80100df4:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80100df6:	29 d0                	sub    %edx,%eax
+80100df8:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80100dfe:	56                   	push   %esi
+80100dff:	51                   	push   %ecx
+80100e00:	53                   	push   %ebx
+80100e01:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80100e07:	e8 94 a3 00 00       	call   8010b1a0 <copyout>
+80100e0c:	83 c4 10             	add    $0x10,%esp
+80100e0f:	85 c0                	test   %eax,%eax
+80100e11:	78 8f                	js     80100da2 <exec+0x262>
+  for(last=s=path; *s; s++)
+80100e13:	8b 45 08             	mov    0x8(%ebp),%eax
+80100e16:	8b 55 08             	mov    0x8(%ebp),%edx
+80100e19:	0f b6 00             	movzbl (%eax),%eax
+80100e1c:	84 c0                	test   %al,%al
+80100e1e:	74 17                	je     80100e37 <exec+0x2f7>
+80100e20:	89 d1                	mov    %edx,%ecx
+80100e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+80100e28:	83 c1 01             	add    $0x1,%ecx
+80100e2b:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+80100e2d:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+80100e30:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+80100e33:	84 c0                	test   %al,%al
+80100e35:	75 f1                	jne    80100e28 <exec+0x2e8>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+80100e37:	83 ec 04             	sub    $0x4,%esp
+80100e3a:	6a 10                	push   $0x10
+80100e3c:	52                   	push   %edx
+80100e3d:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+80100e43:	8d 86 d8 00 00 00    	lea    0xd8(%esi),%eax
+80100e49:	50                   	push   %eax
+80100e4a:	e8 11 66 00 00       	call   80107460 <safestrcpy>
+  curproc->pgdir = pgdir;
+80100e4f:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+80100e55:	89 f0                	mov    %esi,%eax
+80100e57:	8b 76 58             	mov    0x58(%esi),%esi
+  curproc->tf->eip = elf.entry;  // main
+80100e5a:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+  curproc->sz = sz;
+80100e60:	89 78 54             	mov    %edi,0x54(%eax)
+  curproc->pgdir = pgdir;
+80100e63:	89 48 58             	mov    %ecx,0x58(%eax)
+  curproc->tf->eip = elf.entry;  // main
+80100e66:	89 c1                	mov    %eax,%ecx
+80100e68:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80100e6e:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80100e71:	8b 81 80 00 00 00    	mov    0x80(%ecx),%eax
+80100e77:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+80100e7a:	89 0c 24             	mov    %ecx,(%esp)
+80100e7d:	e8 0e 9c 00 00       	call   8010aa90 <switchuvm>
+  freevm(oldpgdir);
+80100e82:	89 34 24             	mov    %esi,(%esp)
+80100e85:	e8 26 a0 00 00       	call   8010aeb0 <freevm>
+  return 0;
+80100e8a:	83 c4 10             	add    $0x10,%esp
+80100e8d:	31 c0                	xor    %eax,%eax
+80100e8f:	e9 35 fe ff ff       	jmp    80100cc9 <exec+0x189>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80100e94:	bb 00 20 00 00       	mov    $0x2000,%ebx
+80100e99:	31 f6                	xor    %esi,%esi
+80100e9b:	e9 50 fe ff ff       	jmp    80100cf0 <exec+0x1b0>
+  for(argc = 0; argv[argc]; argc++) {
+80100ea0:	be 10 00 00 00       	mov    $0x10,%esi
+80100ea5:	ba 04 00 00 00       	mov    $0x4,%edx
+80100eaa:	b8 03 00 00 00       	mov    $0x3,%eax
+80100eaf:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80100eb6:	00 00 00 
+80100eb9:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80100ebf:	e9 0d ff ff ff       	jmp    80100dd1 <exec+0x291>
+    end_op();
+80100ec4:	e8 37 2d 00 00       	call   80103c00 <end_op>
+    cprintf("exec: fail\n");
+80100ec9:	83 ec 0c             	sub    $0xc,%esp
+80100ecc:	68 01 b3 10 80       	push   $0x8010b301
+80100ed1:	e8 3a f8 ff ff       	call   80100710 <cprintf>
+    return -1;
+80100ed6:	83 c4 10             	add    $0x10,%esp
+80100ed9:	e9 e6 fd ff ff       	jmp    80100cc4 <exec+0x184>
+80100ede:	66 90                	xchg   %ax,%ax
+
+80100ee0 <writeat>:
+}
+
+// Write n bytes to inode file f at *poff, advancing *poff.
+static int
+writeat(struct file *f, char *addr, int n, uint *poff)
+{
+80100ee0:	55                   	push   %ebp
+80100ee1:	89 e5                	mov    %esp,%ebp
+80100ee3:	57                   	push   %edi
+80100ee4:	89 c7                	mov    %eax,%edi
+80100ee6:	56                   	push   %esi
+80100ee7:	53                   	push   %ebx
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int i = 0;
+80100ee8:	31 db                	xor    %ebx,%ebx
+{
+80100eea:	83 ec 1c             	sub    $0x1c,%esp
+80100eed:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  while(i < n){
+80100ef0:	85 c9                	test   %ecx,%ecx
+80100ef2:	0f 8e 98 00 00 00    	jle    80100f90 <writeat+0xb0>
+  int i = 0;
+80100ef8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80100efb:	eb 2c                	jmp    80100f29 <writeat+0x49>
+80100efd:	8d 76 00             	lea    0x0(%esi),%esi
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *poff, n1)) > 0)
+      *poff += r;
+80100f00:	8b 55 08             	mov    0x8(%ebp),%edx
+80100f03:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    iunlock(f->ip);
+80100f06:	83 ec 0c             	sub    $0xc,%esp
+      *poff += r;
+80100f09:	01 02                	add    %eax,(%edx)
+    iunlock(f->ip);
+80100f0b:	ff 77 10             	push   0x10(%edi)
+80100f0e:	e8 cd 12 00 00       	call   801021e0 <iunlock>
+    end_op();
+80100f13:	e8 e8 2c 00 00       	call   80103c00 <end_op>
+
+    if(r < 0)
+      break;
+    if(r != n1)
+80100f18:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100f1b:	83 c4 10             	add    $0x10,%esp
+80100f1e:	39 c6                	cmp    %eax,%esi
+80100f20:	75 5e                	jne    80100f80 <writeat+0xa0>
+      panic("short filewrite");
+    i += r;
+80100f22:	01 f3                	add    %esi,%ebx
+  while(i < n){
+80100f24:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80100f27:	7e 67                	jle    80100f90 <writeat+0xb0>
+    int n1 = n - i;
+80100f29:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(n1 > max)
+80100f2c:	b8 00 06 00 00       	mov    $0x600,%eax
+    int n1 = n - i;
+80100f31:	29 de                	sub    %ebx,%esi
+    if(n1 > max)
+80100f33:	39 c6                	cmp    %eax,%esi
+80100f35:	0f 4f f0             	cmovg  %eax,%esi
+    begin_op();
+80100f38:	e8 53 2c 00 00       	call   80103b90 <begin_op>
+    ilock(f->ip);
+80100f3d:	83 ec 0c             	sub    $0xc,%esp
+80100f40:	ff 77 10             	push   0x10(%edi)
+80100f43:	e8 b8 11 00 00       	call   80102100 <ilock>
+    if ((r = writei(f->ip, addr + i, *poff, n1)) > 0)
+80100f48:	56                   	push   %esi
+80100f49:	8b 45 08             	mov    0x8(%ebp),%eax
+80100f4c:	ff 30                	push   (%eax)
+80100f4e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100f51:	01 d8                	add    %ebx,%eax
+80100f53:	50                   	push   %eax
+80100f54:	ff 77 10             	push   0x10(%edi)
+80100f57:	e8 64 16 00 00       	call   801025c0 <writei>
+80100f5c:	83 c4 20             	add    $0x20,%esp
+80100f5f:	85 c0                	test   %eax,%eax
+80100f61:	7f 9d                	jg     80100f00 <writeat+0x20>
+    iunlock(f->ip);
+80100f63:	83 ec 0c             	sub    $0xc,%esp
+80100f66:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100f69:	ff 77 10             	push   0x10(%edi)
+80100f6c:	e8 6f 12 00 00       	call   801021e0 <iunlock>
+    end_op();
+80100f71:	e8 8a 2c 00 00       	call   80103c00 <end_op>
+    if(r < 0)
+80100f76:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100f79:	83 c4 10             	add    $0x10,%esp
+80100f7c:	85 c9                	test   %ecx,%ecx
+80100f7e:	75 10                	jne    80100f90 <writeat+0xb0>
+      panic("short filewrite");
+80100f80:	83 ec 0c             	sub    $0xc,%esp
+80100f83:	68 0d b3 10 80       	push   $0x8010b30d
+80100f88:	e8 53 f4 ff ff       	call   801003e0 <panic>
+80100f8d:	8d 76 00             	lea    0x0(%esi),%esi
+  }
+  return i == n ? n : -1;
+80100f90:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80100f93:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100f98:	0f 45 d8             	cmovne %eax,%ebx
+}
+80100f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f9e:	89 d8                	mov    %ebx,%eax
+80100fa0:	5b                   	pop    %ebx
+80100fa1:	5e                   	pop    %esi
+80100fa2:	5f                   	pop    %edi
+80100fa3:	5d                   	pop    %ebp
+80100fa4:	c3                   	ret
+80100fa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100fb0 <fileinit>:
+{
+80100fb0:	55                   	push   %ebp
+80100fb1:	89 e5                	mov    %esp,%ebp
+80100fb3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80100fb6:	68 1d b3 10 80       	push   $0x8010b31d
+80100fbb:	68 80 36 11 80       	push   $0x80113680
+80100fc0:	e8 1b 5a 00 00       	call   801069e0 <initlock>
+    f->next = ftable.free;
+80100fc5:	8b 15 c4 41 11 80    	mov    0x801141c4,%edx
+80100fcb:	83 c4 10             	add    $0x10,%esp
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100fce:	b8 d4 36 11 80       	mov    $0x801136d4,%eax
+80100fd3:	eb 05                	jmp    80100fda <fileinit+0x2a>
+80100fd5:	8d 76 00             	lea    0x0(%esi),%esi
+80100fd8:	89 c8                	mov    %ecx,%eax
+    f->next = ftable.free;
+80100fda:	89 50 18             	mov    %edx,0x18(%eax)
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80100fdd:	8d 48 1c             	lea    0x1c(%eax),%ecx
+80100fe0:	89 c2                	mov    %eax,%edx
+80100fe2:	3d a8 41 11 80       	cmp    $0x801141a8,%eax
+80100fe7:	75 ef                	jne    80100fd8 <fileinit+0x28>
+80100fe9:	a3 c4 41 11 80       	mov    %eax,0x801141c4
+}
+80100fee:	c9                   	leave
+80100fef:	c3                   	ret
+
+80100ff0 <filealloc>:
+{
+80100ff0:	55                   	push   %ebp
+80100ff1:	89 e5                	mov    %esp,%ebp
+80100ff3:	56                   	push   %esi
+80100ff4:	53                   	push   %ebx
+  acquire(&ftable.lock);
+80100ff5:	83 ec 0c             	sub    $0xc,%esp
+80100ff8:	68 80 36 11 80       	push   $0x80113680
+80100ffd:	e8 2e 5d 00 00       	call   80106d30 <acquire>
+  if(ftable.free == 0)
+80101002:	8b 35 c4 41 11 80    	mov    0x801141c4,%esi
+80101008:	83 c4 10             	add    $0x10,%esp
+8010100b:	85 f6                	test   %esi,%esi
+8010100d:	74 29                	je     80101038 <filealloc+0x48>
+    ftable.free = f->next;
+8010100f:	8b 46 18             	mov    0x18(%esi),%eax
+80101012:	a3 c4 41 11 80       	mov    %eax,0x801141c4
+    f->ref = 1;
+80101017:	c7 46 04 01 00 00 00 	movl   $0x1,0x4(%esi)
+  release(&ftable.lock);
+8010101e:	83 ec 0c             	sub    $0xc,%esp
+80101021:	68 80 36 11 80       	push   $0x80113680
+80101026:	e8 c5 5b 00 00       	call   80106bf0 <release>
+}
+8010102b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010102e:	89 f0                	mov    %esi,%eax
+80101030:	5b                   	pop    %ebx
+80101031:	5e                   	pop    %esi
+80101032:	5d                   	pop    %ebp
+80101033:	c3                   	ret
+80101034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if((mem = kalloc()) == 0)
+80101038:	e8 13 23 00 00       	call   80103350 <kalloc>
+8010103d:	89 c6                	mov    %eax,%esi
+8010103f:	85 c0                	test   %eax,%eax
+80101041:	74 41                	je     80101084 <filealloc+0x94>
+  memset(mem, 0, PGSIZE);
+80101043:	83 ec 04             	sub    $0x4,%esp
+80101046:	8d 9e f8 0f 00 00    	lea    0xff8(%esi),%ebx
+8010104c:	68 00 10 00 00       	push   $0x1000
+80101051:	6a 00                	push   $0x0
+80101053:	50                   	push   %eax
+80101054:	e8 57 62 00 00       	call   801072b0 <memset>
+    f->next = ftable.free;
+80101059:	8b 15 c4 41 11 80    	mov    0x801141c4,%edx
+8010105f:	89 f0                	mov    %esi,%eax
+80101061:	83 c4 10             	add    $0x10,%esp
+80101064:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101068:	89 d1                	mov    %edx,%ecx
+8010106a:	89 c2                	mov    %eax,%edx
+  for(f = (struct file*)mem; f + 1 <= (struct file*)(mem + PGSIZE); f++){
+8010106c:	83 c0 1c             	add    $0x1c,%eax
+    f->next = ftable.free;
+8010106f:	89 48 fc             	mov    %ecx,-0x4(%eax)
+  for(f = (struct file*)mem; f + 1 <= (struct file*)(mem + PGSIZE); f++){
+80101072:	39 d8                	cmp    %ebx,%eax
+80101074:	75 f2                	jne    80101068 <filealloc+0x78>
+80101076:	89 15 c4 41 11 80    	mov    %edx,0x801141c4
+8010107c:	81 c6 dc 0f 00 00    	add    $0xfdc,%esi
+  if((f = ftable.free) != 0){
+80101082:	eb 8b                	jmp    8010100f <filealloc+0x1f>
+80101084:	8b 35 c4 41 11 80    	mov    0x801141c4,%esi
+8010108a:	85 f6                	test   %esi,%esi
+8010108c:	74 90                	je     8010101e <filealloc+0x2e>
+8010108e:	e9 7c ff ff ff       	jmp    8010100f <filealloc+0x1f>
+80101093:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010109a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801010a0 <filedup>:
+{
+801010a0:	55                   	push   %ebp
+
+// Atomically add v to *addr and return the old value of *addr.
+static inline int
+xadd(volatile int *addr, int v)
+{
+  asm volatile("lock; xaddl %0, %1" :
+801010a1:	b8 01 00 00 00       	mov    $0x1,%eax
+801010a6:	89 e5                	mov    %esp,%ebp
+801010a8:	83 ec 08             	sub    $0x8,%esp
+801010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+801010ae:	f0 0f c1 42 04       	lock xadd %eax,0x4(%edx)
+  if(xadd(&f->ref, 1) < 1)
+801010b3:	85 c0                	test   %eax,%eax
+801010b5:	7e 04                	jle    801010bb <filedup+0x1b>
+}
+801010b7:	c9                   	leave
+801010b8:	89 d0                	mov    %edx,%eax
+801010ba:	c3                   	ret
+    panic("filedup");
+801010bb:	83 ec 0c             	sub    $0xc,%esp
+801010be:	68 24 b3 10 80       	push   $0x8010b324
+801010c3:	e8 18 f3 ff ff       	call   801003e0 <panic>
+801010c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801010cf:	90                   	nop
+
+801010d0 <fileclose>:
+{
+801010d0:	55                   	push   %ebp
+801010d1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+801010d6:	89 e5                	mov    %esp,%ebp
+801010d8:	57                   	push   %edi
+801010d9:	56                   	push   %esi
+801010da:	53                   	push   %ebx
+801010db:	83 ec 1c             	sub    $0x1c,%esp
+801010de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801010e1:	f0 0f c1 53 04       	lock xadd %edx,0x4(%ebx)
+  if(ref < 1)
+801010e6:	85 d2                	test   %edx,%edx
+801010e8:	0f 8e 98 00 00 00    	jle    80101186 <fileclose+0xb6>
+  if(ref > 1)
+801010ee:	83 fa 01             	cmp    $0x1,%edx
+801010f1:	74 0d                	je     80101100 <fileclose+0x30>
+}
+801010f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801010f6:	5b                   	pop    %ebx
+801010f7:	5e                   	pop    %esi
+801010f8:	5f                   	pop    %edi
+801010f9:	5d                   	pop    %ebp
+801010fa:	c3                   	ret
+801010fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801010ff:	90                   	nop
+  ff = *f;
+80101100:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  acquire(&ftable.lock);
+80101104:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101107:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101109:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010110f:	8b 73 0c             	mov    0xc(%ebx),%esi
+80101112:	88 45 e7             	mov    %al,-0x19(%ebp)
+80101115:	8b 43 10             	mov    0x10(%ebx),%eax
+80101118:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  acquire(&ftable.lock);
+8010111b:	68 80 36 11 80       	push   $0x80113680
+80101120:	e8 0b 5c 00 00       	call   80106d30 <acquire>
+  f->next = ftable.free;
+80101125:	8b 0d c4 41 11 80    	mov    0x801141c4,%ecx
+8010112b:	89 4b 18             	mov    %ecx,0x18(%ebx)
+  ftable.free = f;
+8010112e:	89 1d c4 41 11 80    	mov    %ebx,0x801141c4
+  release(&ftable.lock);
+80101134:	c7 04 24 80 36 11 80 	movl   $0x80113680,(%esp)
+8010113b:	e8 b0 5a 00 00       	call   80106bf0 <release>
+  if(ff.type == FD_PIPE)
+80101140:	83 c4 10             	add    $0x10,%esp
+80101143:	83 ff 01             	cmp    $0x1,%edi
+80101146:	74 28                	je     80101170 <fileclose+0xa0>
+  else if(ff.type == FD_INODE){
+80101148:	83 ff 02             	cmp    $0x2,%edi
+8010114b:	75 a6                	jne    801010f3 <fileclose+0x23>
+    begin_op();
+8010114d:	e8 3e 2a 00 00       	call   80103b90 <begin_op>
+    iput(ff.ip);
+80101152:	83 ec 0c             	sub    $0xc,%esp
+80101155:	ff 75 e0             	push   -0x20(%ebp)
+80101158:	e8 d3 10 00 00       	call   80102230 <iput>
+    end_op();
+8010115d:	83 c4 10             	add    $0x10,%esp
+}
+80101160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101163:	5b                   	pop    %ebx
+80101164:	5e                   	pop    %esi
+80101165:	5f                   	pop    %edi
+80101166:	5d                   	pop    %ebp
+    end_op();
+80101167:	e9 94 2a 00 00       	jmp    80103c00 <end_op>
+8010116c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pipeclose(ff.pipe, ff.writable);
+80101170:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101174:	83 ec 08             	sub    $0x8,%esp
+80101177:	53                   	push   %ebx
+80101178:	56                   	push   %esi
+80101179:	e8 42 32 00 00       	call   801043c0 <pipeclose>
+8010117e:	83 c4 10             	add    $0x10,%esp
+80101181:	e9 6d ff ff ff       	jmp    801010f3 <fileclose+0x23>
+    panic("fileclose");
+80101186:	83 ec 0c             	sub    $0xc,%esp
+80101189:	68 2c b3 10 80       	push   $0x8010b32c
+8010118e:	e8 4d f2 ff ff       	call   801003e0 <panic>
+80101193:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010119a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801011a0 <filestat>:
+{
+801011a0:	55                   	push   %ebp
+801011a1:	89 e5                	mov    %esp,%ebp
+801011a3:	53                   	push   %ebx
+801011a4:	83 ec 04             	sub    $0x4,%esp
+801011a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+801011aa:	83 3b 02             	cmpl   $0x2,(%ebx)
+801011ad:	75 31                	jne    801011e0 <filestat+0x40>
+    ilock(f->ip);
+801011af:	83 ec 0c             	sub    $0xc,%esp
+801011b2:	ff 73 10             	push   0x10(%ebx)
+801011b5:	e8 46 0f 00 00       	call   80102100 <ilock>
+    stati(f->ip, st);
+801011ba:	58                   	pop    %eax
+801011bb:	5a                   	pop    %edx
+801011bc:	ff 75 0c             	push   0xc(%ebp)
+801011bf:	ff 73 10             	push   0x10(%ebx)
+801011c2:	e8 49 12 00 00       	call   80102410 <stati>
+    iunlock(f->ip);
+801011c7:	59                   	pop    %ecx
+801011c8:	ff 73 10             	push   0x10(%ebx)
+801011cb:	e8 10 10 00 00       	call   801021e0 <iunlock>
+}
+801011d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801011d3:	83 c4 10             	add    $0x10,%esp
+801011d6:	31 c0                	xor    %eax,%eax
+}
+801011d8:	c9                   	leave
+801011d9:	c3                   	ret
+801011da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801011e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+801011e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801011e8:	c9                   	leave
+801011e9:	c3                   	ret
+801011ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801011f0 <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+801011f0:	55                   	push   %ebp
+801011f1:	89 e5                	mov    %esp,%ebp
+801011f3:	57                   	push   %edi
+801011f4:	56                   	push   %esi
+801011f5:	53                   	push   %ebx
+801011f6:	83 ec 0c             	sub    $0xc,%esp
+801011f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801011fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+801011ff:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(f->readable == 0)
+80101202:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+80101206:	74 60                	je     80101268 <fileread+0x78>
+    return -1;
+  if(f->type == FD_PIPE)
+80101208:	8b 03                	mov    (%ebx),%eax
+8010120a:	83 f8 01             	cmp    $0x1,%eax
+8010120d:	74 41                	je     80101250 <fileread+0x60>
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+8010120f:	83 f8 02             	cmp    $0x2,%eax
+80101212:	75 5b                	jne    8010126f <fileread+0x7f>
+  ilock(f->ip);
+80101214:	83 ec 0c             	sub    $0xc,%esp
+80101217:	ff 73 10             	push   0x10(%ebx)
+8010121a:	e8 e1 0e 00 00       	call   80102100 <ilock>
+  if((r = readi(f->ip, addr, *poff, n)) > 0)
+8010121f:	57                   	push   %edi
+80101220:	ff 73 14             	push   0x14(%ebx)
+80101223:	56                   	push   %esi
+80101224:	ff 73 10             	push   0x10(%ebx)
+80101227:	e8 14 12 00 00       	call   80102440 <readi>
+8010122c:	83 c4 20             	add    $0x20,%esp
+8010122f:	89 c6                	mov    %eax,%esi
+80101231:	85 c0                	test   %eax,%eax
+80101233:	7e 03                	jle    80101238 <fileread+0x48>
+    *poff += r;
+80101235:	01 43 14             	add    %eax,0x14(%ebx)
+  iunlock(f->ip);
+80101238:	83 ec 0c             	sub    $0xc,%esp
+8010123b:	ff 73 10             	push   0x10(%ebx)
+8010123e:	e8 9d 0f 00 00       	call   801021e0 <iunlock>
+    return readat(f, addr, n, &f->off);
+80101243:	83 c4 10             	add    $0x10,%esp
+  panic("fileread");
+}
+80101246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101249:	89 f0                	mov    %esi,%eax
+8010124b:	5b                   	pop    %ebx
+8010124c:	5e                   	pop    %esi
+8010124d:	5f                   	pop    %edi
+8010124e:	5d                   	pop    %ebp
+8010124f:	c3                   	ret
+    return piperead(f->pipe, addr, n);
+80101250:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101253:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101259:	5b                   	pop    %ebx
+8010125a:	5e                   	pop    %esi
+8010125b:	5f                   	pop    %edi
+8010125c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010125d:	e9 fe 32 00 00       	jmp    80104560 <piperead>
+80101262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80101268:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010126d:	eb d7                	jmp    80101246 <fileread+0x56>
+  panic("fileread");
+8010126f:	83 ec 0c             	sub    $0xc,%esp
+80101272:	68 36 b3 10 80       	push   $0x8010b336
+80101277:	e8 64 f1 ff ff       	call   801003e0 <panic>
+8010127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101280 <filepread>:
+
+// Read from file f at offset off, leaving f->off alone.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+80101280:	55                   	push   %ebp
+80101281:	89 e5                	mov    %esp,%ebp
+80101283:	56                   	push   %esi
+80101284:	53                   	push   %ebx
+80101285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->readable == 0 || f->type != FD_INODE)
+80101288:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+8010128c:	74 42                	je     801012d0 <filepread+0x50>
+8010128e:	83 3b 02             	cmpl   $0x2,(%ebx)
+80101291:	75 3d                	jne    801012d0 <filepread+0x50>
+  ilock(f->ip);
+80101293:	83 ec 0c             	sub    $0xc,%esp
+80101296:	ff 73 10             	push   0x10(%ebx)
+80101299:	e8 62 0e 00 00       	call   80102100 <ilock>
+  if((r = readi(f->ip, addr, *poff, n)) > 0)
+8010129e:	ff 75 10             	push   0x10(%ebp)
+801012a1:	ff 75 14             	push   0x14(%ebp)
+801012a4:	ff 75 0c             	push   0xc(%ebp)
+801012a7:	ff 73 10             	push   0x10(%ebx)
+801012aa:	e8 91 11 00 00       	call   80102440 <readi>
+  iunlock(f->ip);
+801012af:	83 c4 14             	add    $0x14,%esp
+801012b2:	ff 73 10             	push   0x10(%ebx)
+  if((r = readi(f->ip, addr, *poff, n)) > 0)
+801012b5:	89 c6                	mov    %eax,%esi
+  iunlock(f->ip);
+801012b7:	e8 24 0f 00 00       	call   801021e0 <iunlock>
+    return -1;
+  return readat(f, addr, n, &off);
+801012bc:	83 c4 10             	add    $0x10,%esp
+}
+801012bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801012c2:	89 f0                	mov    %esi,%eax
+801012c4:	5b                   	pop    %ebx
+801012c5:	5e                   	pop    %esi
+801012c6:	5d                   	pop    %ebp
+801012c7:	c3                   	ret
+801012c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012cf:	90                   	nop
+    return -1;
+801012d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801012d5:	eb e8                	jmp    801012bf <filepread+0x3f>
+801012d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012de:	66 90                	xchg   %ax,%ax
+
+801012e0 <filereadv>:
+// stopping early at a short read. An inode is locked only once
+// for the whole request. A pipe is read only until some data
+// arrives, as read() would, rather than wait to fill every buffer.
+int
+filereadv(struct file *f, struct iovec *iov, int cnt)
+{
+801012e0:	55                   	push   %ebp
+801012e1:	89 e5                	mov    %esp,%ebp
+801012e3:	57                   	push   %edi
+801012e4:	56                   	push   %esi
+801012e5:	53                   	push   %ebx
+801012e6:	83 ec 1c             	sub    $0x1c,%esp
+801012e9:	8b 75 08             	mov    0x8(%ebp),%esi
+801012ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i, r, tot;
+
+  if(f->readable == 0)
+801012ef:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+801012f3:	0f 84 2d 01 00 00    	je     80101426 <filereadv+0x146>
+    return -1;
+  if(f->type != FD_PIPE && f->type != FD_INODE)
+801012f9:	8b 06                	mov    (%esi),%eax
+801012fb:	8d 50 ff             	lea    -0x1(%eax),%edx
+801012fe:	83 fa 01             	cmp    $0x1,%edx
+80101301:	0f 87 2b 01 00 00    	ja     80101432 <filereadv+0x152>
+    panic("filereadv");
+
+  tot = 0;
+  if(f->type == FD_INODE)
+80101307:	83 f8 02             	cmp    $0x2,%eax
+8010130a:	0f 84 e0 00 00 00    	je     801013f0 <filereadv+0x110>
+    ilock(f->ip);
+  for(i = 0; i < cnt; i++){
+80101310:	8b 45 10             	mov    0x10(%ebp),%eax
+80101313:	ba 01 00 00 00       	mov    $0x1,%edx
+80101318:	85 c0                	test   %eax,%eax
+8010131a:	0f 8e fa 00 00 00    	jle    8010141a <filereadv+0x13a>
+    if(f->type == FD_PIPE)
+      r = piperead(f->pipe, iov[i].iov_base, iov[i].iov_len);
+80101320:	8b 4f 04             	mov    0x4(%edi),%ecx
+80101323:	8b 07                	mov    (%edi),%eax
+    if(f->type == FD_PIPE)
+80101325:	83 fa 01             	cmp    $0x1,%edx
+80101328:	75 7e                	jne    801013a8 <filereadv+0xc8>
+      r = piperead(f->pipe, iov[i].iov_base, iov[i].iov_len);
+8010132a:	83 ec 04             	sub    $0x4,%esp
+8010132d:	31 db                	xor    %ebx,%ebx
+8010132f:	51                   	push   %ecx
+80101330:	50                   	push   %eax
+80101331:	ff 76 0c             	push   0xc(%esi)
+80101334:	e8 27 32 00 00       	call   80104560 <piperead>
+80101339:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80101340:	83 c4 10             	add    $0x10,%esp
+80101343:	31 d2                	xor    %edx,%edx
+    else if((r = readi(f->ip, iov[i].iov_base, f->off, iov[i].iov_len)) > 0)
+      f->off += r;
+    if(r < 0){
+80101345:	85 c0                	test   %eax,%eax
+80101347:	78 6f                	js     801013b8 <filereadv+0xd8>
+      if(tot == 0)
+        tot = -1;
+      break;
+    }
+    tot += r;
+80101349:	01 45 e4             	add    %eax,-0x1c(%ebp)
+    if(r < iov[i].iov_len || f->type == FD_PIPE)
+8010134c:	8b 0e                	mov    (%esi),%ecx
+8010134e:	39 44 d7 04          	cmp    %eax,0x4(%edi,%edx,8)
+80101352:	7f 3e                	jg     80101392 <filereadv+0xb2>
+80101354:	83 f9 01             	cmp    $0x1,%ecx
+80101357:	74 3e                	je     80101397 <filereadv+0xb7>
+  for(i = 0; i < cnt; i++){
+80101359:	83 c3 01             	add    $0x1,%ebx
+8010135c:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+8010135f:	7e 31                	jle    80101392 <filereadv+0xb2>
+      r = piperead(f->pipe, iov[i].iov_base, iov[i].iov_len);
+80101361:	8b 4c df 04          	mov    0x4(%edi,%ebx,8),%ecx
+80101365:	8b 04 df             	mov    (%edi,%ebx,8),%eax
+80101368:	89 da                	mov    %ebx,%edx
+8010136a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    else if((r = readi(f->ip, iov[i].iov_base, f->off, iov[i].iov_len)) > 0)
+8010136d:	51                   	push   %ecx
+8010136e:	ff 76 14             	push   0x14(%esi)
+80101371:	50                   	push   %eax
+80101372:	ff 76 10             	push   0x10(%esi)
+80101375:	e8 c6 10 00 00       	call   80102440 <readi>
+8010137a:	83 c4 10             	add    $0x10,%esp
+8010137d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101380:	85 c0                	test   %eax,%eax
+80101382:	7e c1                	jle    80101345 <filereadv+0x65>
+      f->off += r;
+80101384:	01 46 14             	add    %eax,0x14(%esi)
+    if(r < iov[i].iov_len || f->type == FD_PIPE)
+80101387:	8b 0e                	mov    (%esi),%ecx
+    tot += r;
+80101389:	01 45 e4             	add    %eax,-0x1c(%ebp)
+    if(r < iov[i].iov_len || f->type == FD_PIPE)
+8010138c:	39 44 d7 04          	cmp    %eax,0x4(%edi,%edx,8)
+80101390:	7e c2                	jle    80101354 <filereadv+0x74>
+      break;
+  }
+  if(f->type == FD_INODE)
+80101392:	83 f9 02             	cmp    $0x2,%ecx
+80101395:	74 38                	je     801013cf <filereadv+0xef>
+    iunlock(f->ip);
+  return tot;
+}
+80101397:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010139a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010139d:	5b                   	pop    %ebx
+8010139e:	5e                   	pop    %esi
+8010139f:	5f                   	pop    %edi
+801013a0:	5d                   	pop    %ebp
+801013a1:	c3                   	ret
+801013a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801013a8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+801013af:	31 db                	xor    %ebx,%ebx
+801013b1:	31 d2                	xor    %edx,%edx
+801013b3:	eb b5                	jmp    8010136a <filereadv+0x8a>
+801013b5:	8d 76 00             	lea    0x0(%esi),%esi
+        tot = -1;
+801013b8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801013bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if(f->type == FD_INODE)
+801013c0:	8b 0e                	mov    (%esi),%ecx
+        tot = -1;
+801013c2:	85 ff                	test   %edi,%edi
+801013c4:	0f 45 c7             	cmovne %edi,%eax
+801013c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->type == FD_INODE)
+801013ca:	83 f9 02             	cmp    $0x2,%ecx
+801013cd:	75 c8                	jne    80101397 <filereadv+0xb7>
+    iunlock(f->ip);
+801013cf:	83 ec 0c             	sub    $0xc,%esp
+801013d2:	ff 76 10             	push   0x10(%esi)
+801013d5:	e8 06 0e 00 00       	call   801021e0 <iunlock>
+}
+801013da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    iunlock(f->ip);
+801013dd:	83 c4 10             	add    $0x10,%esp
+}
+801013e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801013e3:	5b                   	pop    %ebx
+801013e4:	5e                   	pop    %esi
+801013e5:	5f                   	pop    %edi
+801013e6:	5d                   	pop    %ebp
+801013e7:	c3                   	ret
+801013e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801013ef:	90                   	nop
+    ilock(f->ip);
+801013f0:	83 ec 0c             	sub    $0xc,%esp
+801013f3:	ff 76 10             	push   0x10(%esi)
+801013f6:	e8 05 0d 00 00       	call   80102100 <ilock>
+  for(i = 0; i < cnt; i++){
+801013fb:	8b 55 10             	mov    0x10(%ebp),%edx
+801013fe:	83 c4 10             	add    $0x10,%esp
+80101401:	85 d2                	test   %edx,%edx
+80101403:	7e 07                	jle    8010140c <filereadv+0x12c>
+  if(f->type == FD_INODE)
+80101405:	8b 16                	mov    (%esi),%edx
+80101407:	e9 14 ff ff ff       	jmp    80101320 <filereadv+0x40>
+8010140c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80101413:	8b 0e                	mov    (%esi),%ecx
+80101415:	e9 78 ff ff ff       	jmp    80101392 <filereadv+0xb2>
+  for(i = 0; i < cnt; i++){
+8010141a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80101421:	e9 71 ff ff ff       	jmp    80101397 <filereadv+0xb7>
+    return -1;
+80101426:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+8010142d:	e9 65 ff ff ff       	jmp    80101397 <filereadv+0xb7>
+    panic("filereadv");
+80101432:	83 ec 0c             	sub    $0xc,%esp
+80101435:	68 3f b3 10 80       	push   $0x8010b33f
+8010143a:	e8 a1 ef ff ff       	call   801003e0 <panic>
+8010143f:	90                   	nop
+
+80101440 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80101440:	55                   	push   %ebp
+80101441:	89 e5                	mov    %esp,%ebp
+80101443:	53                   	push   %ebx
+80101444:	83 ec 04             	sub    $0x4,%esp
+80101447:	8b 45 08             	mov    0x8(%ebp),%eax
+8010144a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010144d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if(f->writable == 0)
+80101450:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+80101454:	74 3a                	je     80101490 <filewrite+0x50>
+    return -1;
+  if(f->type == FD_PIPE)
+80101456:	8b 10                	mov    (%eax),%edx
+80101458:	83 fa 01             	cmp    $0x1,%edx
+8010145b:	74 1b                	je     80101478 <filewrite+0x38>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+8010145d:	83 fa 02             	cmp    $0x2,%edx
+80101460:	75 38                	jne    8010149a <filewrite+0x5a>
+    return writeat(f, addr, n, &f->off);
+80101462:	8d 50 14             	lea    0x14(%eax),%edx
+80101465:	89 55 08             	mov    %edx,0x8(%ebp)
+80101468:	89 da                	mov    %ebx,%edx
+  panic("filewrite");
+}
+8010146a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010146d:	c9                   	leave
+    return writeat(f, addr, n, &f->off);
+8010146e:	e9 6d fa ff ff       	jmp    80100ee0 <writeat>
+80101473:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101477:	90                   	nop
+    return pipewrite(f->pipe, addr, n);
+80101478:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+8010147b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return pipewrite(f->pipe, addr, n);
+8010147e:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101481:	c9                   	leave
+    return pipewrite(f->pipe, addr, n);
+80101482:	e9 d9 2f 00 00       	jmp    80104460 <pipewrite>
+80101487:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010148e:	66 90                	xchg   %ax,%ax
+}
+80101490:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101493:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101498:	c9                   	leave
+80101499:	c3                   	ret
+  panic("filewrite");
+8010149a:	83 ec 0c             	sub    $0xc,%esp
+8010149d:	68 13 b3 10 80       	push   $0x8010b313
+801014a2:	e8 39 ef ff ff       	call   801003e0 <panic>
+801014a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014ae:	66 90                	xchg   %ax,%ax
+
+801014b0 <filepwrite>:
+
+// Write to file f at offset off, leaving f->off alone.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+801014b0:	55                   	push   %ebp
+801014b1:	89 e5                	mov    %esp,%ebp
+801014b3:	83 ec 08             	sub    $0x8,%esp
+801014b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(f->writable == 0 || f->type != FD_INODE)
+801014b9:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+801014bd:	74 21                	je     801014e0 <filepwrite+0x30>
+801014bf:	83 38 02             	cmpl   $0x2,(%eax)
+801014c2:	75 1c                	jne    801014e0 <filepwrite+0x30>
+    return -1;
+  return writeat(f, addr, n, &off);
+801014c4:	83 ec 0c             	sub    $0xc,%esp
+801014c7:	8d 55 14             	lea    0x14(%ebp),%edx
+801014ca:	52                   	push   %edx
+801014cb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+801014ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+801014d1:	e8 0a fa ff ff       	call   80100ee0 <writeat>
+801014d6:	83 c4 10             	add    $0x10,%esp
+}
+801014d9:	c9                   	leave
+801014da:	c3                   	ret
+801014db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801014df:	90                   	nop
+801014e0:	c9                   	leave
+    return -1;
+801014e1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801014e6:	c3                   	ret
+801014e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014ee:	66 90                	xchg   %ax,%ax
+
+801014f0 <filewritev>:
+
+// Write each of the cnt buffers in iov to file f in turn.
+int
+filewritev(struct file *f, struct iovec *iov, int cnt)
+{
+801014f0:	55                   	push   %ebp
+801014f1:	89 e5                	mov    %esp,%ebp
+801014f3:	57                   	push   %edi
+801014f4:	56                   	push   %esi
+801014f5:	53                   	push   %ebx
+801014f6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, tot;
+
+  tot = 0;
+  for(i = 0; i < cnt; i++){
+801014f9:	8b 45 10             	mov    0x10(%ebp),%eax
+{
+801014fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  tot = 0;
+801014ff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+{
+80101506:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for(i = 0; i < cnt; i++){
+80101509:	85 c0                	test   %eax,%eax
+8010150b:	7e 73                	jle    80101580 <filewritev+0x90>
+    return writeat(f, addr, n, &f->off);
+8010150d:	8d 46 14             	lea    0x14(%esi),%eax
+  for(i = 0; i < cnt; i++){
+80101510:	31 db                	xor    %ebx,%ebx
+    return writeat(f, addr, n, &f->off);
+80101512:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101515:	eb 31                	jmp    80101548 <filewritev+0x58>
+80101517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010151e:	66 90                	xchg   %ax,%ax
+  if(f->type == FD_INODE)
+80101520:	83 f8 02             	cmp    $0x2,%eax
+80101523:	75 66                	jne    8010158b <filewritev+0x9b>
+    return writeat(f, addr, n, &f->off);
+80101525:	83 ec 0c             	sub    $0xc,%esp
+80101528:	ff 75 e0             	push   -0x20(%ebp)
+8010152b:	89 f0                	mov    %esi,%eax
+8010152d:	e8 ae f9 ff ff       	call   80100ee0 <writeat>
+80101532:	83 c4 10             	add    $0x10,%esp
+    if(filewrite(f, iov[i].iov_base, iov[i].iov_len) < 0)
+80101535:	85 c0                	test   %eax,%eax
+80101537:	78 37                	js     80101570 <filewritev+0x80>
+      return tot > 0 ? tot : -1;
+    tot += iov[i].iov_len;
+80101539:	8b 54 df 04          	mov    0x4(%edi,%ebx,8),%edx
+  for(i = 0; i < cnt; i++){
+8010153d:	83 c3 01             	add    $0x1,%ebx
+    tot += iov[i].iov_len;
+80101540:	01 55 e4             	add    %edx,-0x1c(%ebp)
+  for(i = 0; i < cnt; i++){
+80101543:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+80101546:	74 38                	je     80101580 <filewritev+0x90>
+  if(f->writable == 0)
+80101548:	80 7e 09 00          	cmpb   $0x0,0x9(%esi)
+    if(filewrite(f, iov[i].iov_base, iov[i].iov_len) < 0)
+8010154c:	8b 4c df 04          	mov    0x4(%edi,%ebx,8),%ecx
+80101550:	8b 14 df             	mov    (%edi,%ebx,8),%edx
+  if(f->writable == 0)
+80101553:	74 1b                	je     80101570 <filewritev+0x80>
+  if(f->type == FD_PIPE)
+80101555:	8b 06                	mov    (%esi),%eax
+80101557:	83 f8 01             	cmp    $0x1,%eax
+8010155a:	75 c4                	jne    80101520 <filewritev+0x30>
+    return pipewrite(f->pipe, addr, n);
+8010155c:	83 ec 04             	sub    $0x4,%esp
+8010155f:	51                   	push   %ecx
+80101560:	52                   	push   %edx
+80101561:	ff 76 0c             	push   0xc(%esi)
+80101564:	e8 f7 2e 00 00       	call   80104460 <pipewrite>
+80101569:	83 c4 10             	add    $0x10,%esp
+    if(filewrite(f, iov[i].iov_base, iov[i].iov_len) < 0)
+8010156c:	85 c0                	test   %eax,%eax
+8010156e:	79 c9                	jns    80101539 <filewritev+0x49>
+      return tot > 0 ? tot : -1;
+80101570:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101573:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80101578:	85 c9                	test   %ecx,%ecx
+8010157a:	0f 4f c1             	cmovg  %ecx,%eax
+8010157d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  }
+  return tot;
+}
+80101580:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101586:	5b                   	pop    %ebx
+80101587:	5e                   	pop    %esi
+80101588:	5f                   	pop    %edi
+80101589:	5d                   	pop    %ebp
+8010158a:	c3                   	ret
+  panic("filewrite");
+8010158b:	83 ec 0c             	sub    $0xc,%esp
+8010158e:	68 13 b3 10 80       	push   $0x8010b313
+80101593:	e8 48 ee ff ff       	call   801003e0 <panic>
+80101598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010159f:	90                   	nop
+
+801015a0 <filesplice>:
+// Move up to n bytes from file in to file out without passing
+// them through user space. Returns the number of bytes moved,
+// 0 at end of file, or -1 on error.
+int
+filesplice(struct file *in, struct file *out, int n)
+{
+801015a0:	55                   	push   %ebp
+801015a1:	89 e5                	mov    %esp,%ebp
+801015a3:	57                   	push   %edi
+801015a4:	56                   	push   %esi
+801015a5:	53                   	push   %ebx
+801015a6:	83 ec 2c             	sub    $0x2c,%esp
+  if(in->readable == 0 || out->writable == 0)
+801015a9:	8b 45 08             	mov    0x8(%ebp),%eax
+801015ac:	80 78 08 00          	cmpb   $0x0,0x8(%eax)
+801015b0:	0f 84 9b 01 00 00    	je     80101751 <filesplice+0x1b1>
+801015b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+801015b9:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+801015bd:	0f 84 8e 01 00 00    	je     80101751 <filesplice+0x1b1>
+    return -1;
+  if(in->type == FD_INODE && out->type == FD_PIPE)
+801015c3:	8b 45 08             	mov    0x8(%ebp),%eax
+801015c6:	8b 00                	mov    (%eax),%eax
+801015c8:	83 f8 02             	cmp    $0x2,%eax
+801015cb:	0f 84 b7 00 00 00    	je     80101688 <filesplice+0xe8>
+    return splicetopipe(in, out->pipe, n);
+  if(in->type == FD_PIPE && out->type == FD_INODE)
+801015d1:	83 f8 01             	cmp    $0x1,%eax
+801015d4:	75 0c                	jne    801015e2 <filesplice+0x42>
+801015d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+801015d9:	83 38 02             	cmpl   $0x2,(%eax)
+801015dc:	0f 84 79 01 00 00    	je     8010175b <filesplice+0x1bb>
+  if((buf = kalloc()) == 0)
+801015e2:	e8 69 1d 00 00       	call   80103350 <kalloc>
+801015e7:	89 c2                	mov    %eax,%edx
+801015e9:	85 c0                	test   %eax,%eax
+801015eb:	0f 84 60 01 00 00    	je     80101751 <filesplice+0x1b1>
+  for(tot = 0; tot < n; tot += r){
+801015f1:	8b 45 10             	mov    0x10(%ebp),%eax
+801015f4:	31 f6                	xor    %esi,%esi
+801015f6:	85 c0                	test   %eax,%eax
+801015f8:	7e 68                	jle    80101662 <filesplice+0xc2>
+801015fa:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801015fd:	eb 2e                	jmp    8010162d <filesplice+0x8d>
+801015ff:	90                   	nop
+    if(filewrite(out, buf, r) != r){
+80101600:	83 ec 04             	sub    $0x4,%esp
+80101603:	50                   	push   %eax
+80101604:	ff 75 d4             	push   -0x2c(%ebp)
+80101607:	ff 75 0c             	push   0xc(%ebp)
+8010160a:	e8 31 fe ff ff       	call   80101440 <filewrite>
+8010160f:	83 c4 10             	add    $0x10,%esp
+80101612:	39 c3                	cmp    %eax,%ebx
+80101614:	0f 85 ce 01 00 00    	jne    801017e8 <filesplice+0x248>
+  for(tot = 0; tot < n; tot += r){
+8010161a:	01 de                	add    %ebx,%esi
+    if(r < m || in->type == FD_PIPE){
+8010161c:	39 df                	cmp    %ebx,%edi
+8010161e:	7f 60                	jg     80101680 <filesplice+0xe0>
+80101620:	8b 45 08             	mov    0x8(%ebp),%eax
+80101623:	83 38 01             	cmpl   $0x1,(%eax)
+80101626:	74 58                	je     80101680 <filesplice+0xe0>
+  for(tot = 0; tot < n; tot += r){
+80101628:	39 75 10             	cmp    %esi,0x10(%ebp)
+8010162b:	7e 53                	jle    80101680 <filesplice+0xe0>
+    m = n - tot < PGSIZE ? n - tot : PGSIZE;
+8010162d:	8b 7d 10             	mov    0x10(%ebp),%edi
+80101630:	b8 00 10 00 00       	mov    $0x1000,%eax
+80101635:	29 f7                	sub    %esi,%edi
+80101637:	39 c7                	cmp    %eax,%edi
+80101639:	0f 4f f8             	cmovg  %eax,%edi
+    if((r = fileread(in, buf, m)) <= 0){
+8010163c:	83 ec 04             	sub    $0x4,%esp
+8010163f:	57                   	push   %edi
+80101640:	ff 75 d4             	push   -0x2c(%ebp)
+80101643:	ff 75 08             	push   0x8(%ebp)
+80101646:	e8 a5 fb ff ff       	call   801011f0 <fileread>
+8010164b:	83 c4 10             	add    $0x10,%esp
+8010164e:	89 c3                	mov    %eax,%ebx
+80101650:	85 c0                	test   %eax,%eax
+80101652:	7f ac                	jg     80101600 <filesplice+0x60>
+      if(r < 0 && tot == 0)
+80101654:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80101657:	79 09                	jns    80101662 <filesplice+0xc2>
+      if(tot == 0)
+80101659:	85 f6                	test   %esi,%esi
+8010165b:	75 05                	jne    80101662 <filesplice+0xc2>
+        tot = -1;
+8010165d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  kfree(buf);
+80101662:	83 ec 0c             	sub    $0xc,%esp
+80101665:	52                   	push   %edx
+80101666:	e8 25 1b 00 00       	call   80103190 <kfree>
+  return tot;
+8010166b:	83 c4 10             	add    $0x10,%esp
+    return splicefrompipe(in->pipe, out, n);
+  return splicecopy(in, out, n);
+}
+8010166e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101671:	89 f0                	mov    %esi,%eax
+80101673:	5b                   	pop    %ebx
+80101674:	5e                   	pop    %esi
+80101675:	5f                   	pop    %edi
+80101676:	5d                   	pop    %ebp
+80101677:	c3                   	ret
+80101678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010167f:	90                   	nop
+80101680:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80101683:	eb dd                	jmp    80101662 <filesplice+0xc2>
+80101685:	8d 76 00             	lea    0x0(%esi),%esi
+  if(in->type == FD_INODE && out->type == FD_PIPE)
+80101688:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010168b:	83 38 01             	cmpl   $0x1,(%eax)
+8010168e:	0f 85 4e ff ff ff    	jne    801015e2 <filesplice+0x42>
+    return splicetopipe(in, out->pipe, n);
+80101694:	8b 40 0c             	mov    0xc(%eax),%eax
+  for(tot = 0; tot < n; tot += r){
+80101697:	31 f6                	xor    %esi,%esi
+    return splicetopipe(in, out->pipe, n);
+80101699:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(tot = 0; tot < n; tot += r){
+8010169c:	8b 45 10             	mov    0x10(%ebp),%eax
+8010169f:	85 c0                	test   %eax,%eax
+801016a1:	7e cb                	jle    8010166e <filesplice+0xce>
+801016a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801016a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+801016a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801016ac:	eb 32                	jmp    801016e0 <filesplice+0x140>
+801016ae:	66 90                	xchg   %ax,%ax
+    *poff += r;
+801016b0:	01 47 14             	add    %eax,0x14(%edi)
+  iunlock(f->ip);
+801016b3:	83 ec 0c             	sub    $0xc,%esp
+    *poff += r;
+801016b6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  iunlock(f->ip);
+801016b9:	ff 77 10             	push   0x10(%edi)
+801016bc:	e8 1f 0b 00 00       	call   801021e0 <iunlock>
+    pipeendwrite(p, r > 0 ? r : 0);
+801016c1:	59                   	pop    %ecx
+801016c2:	58                   	pop    %eax
+801016c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801016c6:	50                   	push   %eax
+801016c7:	ff 75 d0             	push   -0x30(%ebp)
+801016ca:	e8 61 30 00 00       	call   80104730 <pipeendwrite>
+    if(r < 0)
+801016cf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    pipeendwrite(p, r > 0 ? r : 0);
+801016d2:	83 c4 10             	add    $0x10,%esp
+      tot += r;
+801016d5:	01 c6                	add    %eax,%esi
+    if(r < m){
+801016d7:	39 c3                	cmp    %eax,%ebx
+801016d9:	7f 93                	jg     8010166e <filesplice+0xce>
+  for(tot = 0; tot < n; tot += r){
+801016db:	39 75 10             	cmp    %esi,0x10(%ebp)
+801016de:	7e 8e                	jle    8010166e <filesplice+0xce>
+    if((m = pipebeginwrite(p, &dst, n - tot)) < 0)
+801016e0:	8b 45 10             	mov    0x10(%ebp),%eax
+801016e3:	83 ec 04             	sub    $0x4,%esp
+801016e6:	29 f0                	sub    %esi,%eax
+801016e8:	50                   	push   %eax
+801016e9:	ff 75 d4             	push   -0x2c(%ebp)
+801016ec:	ff 75 d0             	push   -0x30(%ebp)
+801016ef:	e8 6c 2f 00 00       	call   80104660 <pipebeginwrite>
+801016f4:	83 c4 10             	add    $0x10,%esp
+801016f7:	89 c3                	mov    %eax,%ebx
+801016f9:	85 c0                	test   %eax,%eax
+801016fb:	78 4c                	js     80101749 <filesplice+0x1a9>
+    r = readat(in, dst, m, &in->off);
+801016fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  ilock(f->ip);
+80101700:	83 ec 0c             	sub    $0xc,%esp
+    r = readat(in, dst, m, &in->off);
+80101703:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  ilock(f->ip);
+80101706:	ff 77 10             	push   0x10(%edi)
+80101709:	e8 f2 09 00 00       	call   80102100 <ilock>
+  if((r = readi(f->ip, addr, *poff, n)) > 0)
+8010170e:	53                   	push   %ebx
+8010170f:	ff 77 14             	push   0x14(%edi)
+80101712:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80101715:	50                   	push   %eax
+80101716:	ff 77 10             	push   0x10(%edi)
+80101719:	e8 22 0d 00 00       	call   80102440 <readi>
+8010171e:	83 c4 20             	add    $0x20,%esp
+80101721:	85 c0                	test   %eax,%eax
+80101723:	7f 8b                	jg     801016b0 <filesplice+0x110>
+  iunlock(f->ip);
+80101725:	83 ec 0c             	sub    $0xc,%esp
+80101728:	89 45 cc             	mov    %eax,-0x34(%ebp)
+8010172b:	ff 77 10             	push   0x10(%edi)
+8010172e:	e8 ad 0a 00 00       	call   801021e0 <iunlock>
+    pipeendwrite(p, r > 0 ? r : 0);
+80101733:	58                   	pop    %eax
+80101734:	5a                   	pop    %edx
+80101735:	6a 00                	push   $0x0
+80101737:	ff 75 d0             	push   -0x30(%ebp)
+8010173a:	e8 f1 2f 00 00       	call   80104730 <pipeendwrite>
+    if(r < 0)
+8010173f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80101742:	83 c4 10             	add    $0x10,%esp
+80101745:	85 c0                	test   %eax,%eax
+80101747:	74 8c                	je     801016d5 <filesplice+0x135>
+      return tot > 0 ? tot : -1;
+80101749:	85 f6                	test   %esi,%esi
+8010174b:	0f 85 1d ff ff ff    	jne    8010166e <filesplice+0xce>
+80101751:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80101756:	e9 13 ff ff ff       	jmp    8010166e <filesplice+0xce>
+    return splicefrompipe(in->pipe, out, n);
+8010175b:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(tot = 0; tot < n; tot += r){
+8010175e:	8b 7d 10             	mov    0x10(%ebp),%edi
+80101761:	31 f6                	xor    %esi,%esi
+    return splicefrompipe(in->pipe, out, n);
+80101763:	8b 58 0c             	mov    0xc(%eax),%ebx
+  for(tot = 0; tot < n; tot += r){
+80101766:	85 ff                	test   %edi,%edi
+80101768:	0f 8e 00 ff ff ff    	jle    8010166e <filesplice+0xce>
+8010176e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80101771:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    r = writeat(out, src, m, &out->off);
+80101774:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101777:	83 c0 14             	add    $0x14,%eax
+8010177a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+8010177d:	eb 3e                	jmp    801017bd <filesplice+0x21d>
+8010177f:	90                   	nop
+80101780:	83 ec 0c             	sub    $0xc,%esp
+80101783:	ff 75 d0             	push   -0x30(%ebp)
+80101786:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101789:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010178c:	e8 4f f7 ff ff       	call   80100ee0 <writeat>
+    if(pipeendread(p, r > 0 ? r : 0) == 0 && r > 0){
+80101791:	5a                   	pop    %edx
+80101792:	59                   	pop    %ecx
+    r = writeat(out, src, m, &out->off);
+80101793:	89 c7                	mov    %eax,%edi
+    if(pipeendread(p, r > 0 ? r : 0) == 0 && r > 0){
+80101795:	31 c0                	xor    %eax,%eax
+80101797:	85 ff                	test   %edi,%edi
+80101799:	0f 49 c7             	cmovns %edi,%eax
+8010179c:	50                   	push   %eax
+8010179d:	53                   	push   %ebx
+8010179e:	e8 9d 30 00 00       	call   80104840 <pipeendread>
+801017a3:	83 c4 10             	add    $0x10,%esp
+801017a6:	85 c0                	test   %eax,%eax
+801017a8:	75 04                	jne    801017ae <filesplice+0x20e>
+801017aa:	85 ff                	test   %edi,%edi
+801017ac:	7f 42                	jg     801017f0 <filesplice+0x250>
+    if(r < 0)
+801017ae:	85 ff                	test   %edi,%edi
+801017b0:	78 97                	js     80101749 <filesplice+0x1a9>
+  for(tot = 0; tot < n; tot += r){
+801017b2:	01 fe                	add    %edi,%esi
+801017b4:	39 75 10             	cmp    %esi,0x10(%ebp)
+801017b7:	0f 8e b1 fe ff ff    	jle    8010166e <filesplice+0xce>
+    if((m = pipebeginread(p, &src, n - tot)) <= 0){
+801017bd:	8b 45 10             	mov    0x10(%ebp),%eax
+801017c0:	83 ec 04             	sub    $0x4,%esp
+801017c3:	29 f0                	sub    %esi,%eax
+801017c5:	50                   	push   %eax
+801017c6:	ff 75 d4             	push   -0x2c(%ebp)
+801017c9:	53                   	push   %ebx
+801017ca:	e8 b1 2f 00 00       	call   80104780 <pipebeginread>
+801017cf:	83 c4 10             	add    $0x10,%esp
+801017d2:	89 c1                	mov    %eax,%ecx
+801017d4:	85 c0                	test   %eax,%eax
+801017d6:	7f a8                	jg     80101780 <filesplice+0x1e0>
+      if(m < 0 && tot == 0)
+801017d8:	0f 88 6b ff ff ff    	js     80101749 <filesplice+0x1a9>
+801017de:	e9 8b fe ff ff       	jmp    8010166e <filesplice+0xce>
+801017e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801017e7:	90                   	nop
+      if(tot == 0)
+801017e8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801017eb:	e9 69 fe ff ff       	jmp    80101659 <filesplice+0xb9>
+      tot += r;
+801017f0:	01 fe                	add    %edi,%esi
+      break;
+801017f2:	e9 77 fe ff ff       	jmp    8010166e <filesplice+0xce>
+801017f7:	66 90                	xchg   %ax,%ax
+801017f9:	66 90                	xchg   %ax,%ax
+801017fb:	66 90                	xchg   %ax,%ax
+801017fd:	66 90                	xchg   %ax,%ax
+801017ff:	90                   	nop
+
+80101800 <ballocrun>:
+// Stores the first block of the run in *bnop and returns the
+// length of the run, which is at least 1 but may be less than n.
+// The blocks are not zeroed.
+static uint
+ballocrun(uint dev, uint goal, uint n, uint *bnop)
+{
+80101800:	55                   	push   %ebp
+80101801:	89 e5                	mov    %esp,%ebp
+80101803:	57                   	push   %edi
+80101804:	56                   	push   %esi
+80101805:	53                   	push   %ebx
+80101806:	83 ec 1c             	sub    $0x1c,%esp
+80101809:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  uint i, b, bi, m, cnt;
+  struct buf *bp;
+
+  bp = 0;
+  for(i = 0; i < sb.size; i++){
+8010180c:	8b 0d 3c 66 11 80    	mov    0x8011663c,%ecx
+{
+80101812:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101815:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  for(i = 0; i < sb.size; i++){
+80101818:	85 c9                	test   %ecx,%ecx
+8010181a:	0f 84 13 01 00 00    	je     80101933 <ballocrun+0x133>
+  bp = 0;
+80101820:	31 f6                	xor    %esi,%esi
+  for(i = 0; i < sb.size; i++){
+80101822:	31 ff                	xor    %edi,%edi
+80101824:	eb 2d                	jmp    80101853 <ballocrun+0x53>
+80101826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010182d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, BBLOCK(b, sb));
+    }
+    bi = b % BPB;
+    if((bp->data[bi/8] & (1 << (bi % 8))) == 0){  // Is block free?
+80101830:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101833:	c1 e8 03             	shr    $0x3,%eax
+80101836:	0f b6 94 06 84 00 00 	movzbl 0x84(%esi,%eax,1),%edx
+8010183d:	00 
+8010183e:	89 d8                	mov    %ebx,%eax
+80101840:	83 e0 07             	and    $0x7,%eax
+80101843:	0f a3 c2             	bt     %eax,%edx
+80101846:	73 58                	jae    801018a0 <ballocrun+0xa0>
+  for(i = 0; i < sb.size; i++){
+80101848:	83 c7 01             	add    $0x1,%edi
+8010184b:	39 cf                	cmp    %ecx,%edi
+8010184d:	0f 83 d4 00 00 00    	jae    80101927 <ballocrun+0x127>
+    b = (goal + i) % sb.size;
+80101853:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101856:	31 d2                	xor    %edx,%edx
+80101858:	01 f8                	add    %edi,%eax
+8010185a:	f7 f1                	div    %ecx
+    if(bp == 0 || b % BPB == 0){
+8010185c:	89 d0                	mov    %edx,%eax
+    b = (goal + i) % sb.size;
+8010185e:	89 d3                	mov    %edx,%ebx
+    if(bp == 0 || b % BPB == 0){
+80101860:	25 ff 0f 00 00       	and    $0xfff,%eax
+80101865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101868:	85 f6                	test   %esi,%esi
+8010186a:	74 10                	je     8010187c <ballocrun+0x7c>
+8010186c:	85 c0                	test   %eax,%eax
+8010186e:	75 c0                	jne    80101830 <ballocrun+0x30>
+        brelse(bp);
+80101870:	83 ec 0c             	sub    $0xc,%esp
+80101873:	56                   	push   %esi
+80101874:	e8 d7 e9 ff ff       	call   80100250 <brelse>
+80101879:	83 c4 10             	add    $0x10,%esp
+      bp = bread(dev, BBLOCK(b, sb));
+8010187c:	89 d8                	mov    %ebx,%eax
+8010187e:	83 ec 08             	sub    $0x8,%esp
+80101881:	c1 e8 0c             	shr    $0xc,%eax
+80101884:	03 05 54 66 11 80    	add    0x80116654,%eax
+8010188a:	50                   	push   %eax
+8010188b:	ff 75 dc             	push   -0x24(%ebp)
+8010188e:	e8 fd e8 ff ff       	call   80100190 <bread>
+80101893:	8b 0d 3c 66 11 80    	mov    0x8011663c,%ecx
+80101899:	83 c4 10             	add    $0x10,%esp
+8010189c:	89 c6                	mov    %eax,%esi
+8010189e:	eb 90                	jmp    80101830 <ballocrun+0x30>
+801018a0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      // Extend the run over the free blocks that follow it
+      // in the same bitmap block.
+      for(cnt = 0; cnt < n && bi < BPB && b + cnt < sb.size; cnt++, bi++){
+801018a3:	31 ff                	xor    %edi,%edi
+801018a5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+        m = 1 << (bi % 8);
+801018a8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+801018ab:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801018ae:	eb 45                	jmp    801018f5 <ballocrun+0xf5>
+        if(bp->data[bi/8] & m)
+801018b0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+        m = 1 << (bi % 8);
+801018b3:	89 d9                	mov    %ebx,%ecx
+        if(bp->data[bi/8] & m)
+801018b5:	89 da                	mov    %ebx,%edx
+        m = 1 << (bi % 8);
+801018b7:	b8 01 00 00 00       	mov    $0x1,%eax
+801018bc:	83 e1 07             	and    $0x7,%ecx
+        if(bp->data[bi/8] & m)
+801018bf:	c1 ea 03             	shr    $0x3,%edx
+        m = 1 << (bi % 8);
+801018c2:	d3 e0                	shl    %cl,%eax
+        if(bp->data[bi/8] & m)
+801018c4:	0f b6 b4 16 84 00 00 	movzbl 0x84(%esi,%edx,1),%esi
+801018cb:	00 
+        m = 1 << (bi % 8);
+801018cc:	89 c1                	mov    %eax,%ecx
+        if(bp->data[bi/8] & m)
+801018ce:	89 f0                	mov    %esi,%eax
+801018d0:	85 ce                	test   %ecx,%esi
+801018d2:	75 2d                	jne    80101901 <ballocrun+0x101>
+          break;
+        bp->data[bi/8] |= m;  // Mark block in use.
+801018d4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801018d7:	09 c8                	or     %ecx,%eax
+      for(cnt = 0; cnt < n && bi < BPB && b + cnt < sb.size; cnt++, bi++){
+801018d9:	83 c7 01             	add    $0x1,%edi
+801018dc:	83 c3 01             	add    $0x1,%ebx
+        bp->data[bi/8] |= m;  // Mark block in use.
+801018df:	88 84 16 84 00 00 00 	mov    %al,0x84(%esi,%edx,1)
+      for(cnt = 0; cnt < n && bi < BPB && b + cnt < sb.size; cnt++, bi++){
+801018e6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801018e9:	39 c7                	cmp    %eax,%edi
+801018eb:	73 14                	jae    80101901 <ballocrun+0x101>
+801018ed:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+801018f3:	77 0f                	ja     80101904 <ballocrun+0x104>
+801018f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801018f8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801018fb:	01 f8                	add    %edi,%eax
+801018fd:	39 c8                	cmp    %ecx,%eax
+801018ff:	72 af                	jb     801018b0 <ballocrun+0xb0>
+80101901:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+      }
+      log_write(bp);
+80101904:	83 ec 0c             	sub    $0xc,%esp
+80101907:	56                   	push   %esi
+80101908:	e8 83 24 00 00       	call   80103d90 <log_write>
+      brelse(bp);
+8010190d:	89 34 24             	mov    %esi,(%esp)
+80101910:	e8 3b e9 ff ff       	call   80100250 <brelse>
+      *bnop = b;
+80101915:	8b 45 08             	mov    0x8(%ebp),%eax
+80101918:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010191b:	89 18                	mov    %ebx,(%eax)
+    }
+  }
+  if(bp)
+    brelse(bp);
+  panic("balloc: out of blocks");
+}
+8010191d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101920:	89 f8                	mov    %edi,%eax
+80101922:	5b                   	pop    %ebx
+80101923:	5e                   	pop    %esi
+80101924:	5f                   	pop    %edi
+80101925:	5d                   	pop    %ebp
+80101926:	c3                   	ret
+    brelse(bp);
+80101927:	83 ec 0c             	sub    $0xc,%esp
+8010192a:	56                   	push   %esi
+8010192b:	e8 20 e9 ff ff       	call   80100250 <brelse>
+80101930:	83 c4 10             	add    $0x10,%esp
+  panic("balloc: out of blocks");
+80101933:	83 ec 0c             	sub    $0xc,%esp
+80101936:	68 49 b3 10 80       	push   $0x8010b349
+8010193b:	e8 a0 ea ff ff       	call   801003e0 <panic>
+
+80101940 <bfree>:
+}
+
+// Free a disk block.
+static void
+bfree(int dev, uint b)
+{
+80101940:	55                   	push   %ebp
+80101941:	89 c1                	mov    %eax,%ecx
+  struct buf *bp;
+  int bi, m;
+
+  bp = bread(dev, BBLOCK(b, sb));
+80101943:	89 d0                	mov    %edx,%eax
+80101945:	c1 e8 0c             	shr    $0xc,%eax
+{
+80101948:	89 e5                	mov    %esp,%ebp
+8010194a:	56                   	push   %esi
+8010194b:	53                   	push   %ebx
+  bp = bread(dev, BBLOCK(b, sb));
+8010194c:	03 05 54 66 11 80    	add    0x80116654,%eax
+{
+80101952:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80101954:	83 ec 08             	sub    $0x8,%esp
+80101957:	50                   	push   %eax
+80101958:	51                   	push   %ecx
+80101959:	e8 32 e8 ff ff       	call   80100190 <bread>
+  bi = b % BPB;
+  m = 1 << (bi % 8);
+8010195e:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101960:	c1 fb 03             	sar    $0x3,%ebx
+80101963:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101966:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80101968:	83 e1 07             	and    $0x7,%ecx
+8010196b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101970:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+80101976:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101978:	0f b6 8c 1e 84 00 00 	movzbl 0x84(%esi,%ebx,1),%ecx
+8010197f:	00 
+80101980:	85 c1                	test   %eax,%ecx
+80101982:	74 26                	je     801019aa <bfree+0x6a>
+    panic("freeing free block");
+  bp->data[bi/8] &= ~m;
+80101984:	f7 d0                	not    %eax
+  log_write(bp);
+80101986:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+80101989:	21 c8                	and    %ecx,%eax
+8010198b:	88 84 1e 84 00 00 00 	mov    %al,0x84(%esi,%ebx,1)
+  log_write(bp);
+80101992:	56                   	push   %esi
+80101993:	e8 f8 23 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101998:	89 34 24             	mov    %esi,(%esp)
+8010199b:	e8 b0 e8 ff ff       	call   80100250 <brelse>
+}
+801019a0:	83 c4 10             	add    $0x10,%esp
+801019a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801019a6:	5b                   	pop    %ebx
+801019a7:	5e                   	pop    %esi
+801019a8:	5d                   	pop    %ebp
+801019a9:	c3                   	ret
+    panic("freeing free block");
+801019aa:	83 ec 0c             	sub    $0xc,%esp
+801019ad:	68 5f b3 10 80       	push   $0x8010b35f
+801019b2:	e8 29 ea ff ff       	call   801003e0 <panic>
+801019b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801019be:	66 90                	xchg   %ax,%ax
+
+801019c0 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+801019c0:	55                   	push   %ebp
+801019c1:	89 e5                	mov    %esp,%ebp
+801019c3:	57                   	push   %edi
+801019c4:	89 c7                	mov    %eax,%edi
+801019c6:	56                   	push   %esi
+801019c7:	53                   	push   %ebx
+
+  // Is the inode already cached? If iput() drops the last
+  // reference between the check and the xadd, the entry still
+  // holds this inode: it can't be recycled under the read lock.
+  acquireread(&icache.lock);
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801019c8:	bb 4c 42 11 80       	mov    $0x8011424c,%ebx
+{
+801019cd:	83 ec 28             	sub    $0x28,%esp
+801019d0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquireread(&icache.lock);
+801019d3:	68 40 42 11 80       	push   $0x80114240
+801019d8:	e8 f3 4b 00 00       	call   801065d0 <acquireread>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801019dd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquireread(&icache.lock);
+801019e0:	83 c4 10             	add    $0x10,%esp
+801019e3:	eb 11                	jmp    801019f6 <iget+0x36>
+801019e5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801019e8:	81 c3 b8 00 00 00    	add    $0xb8,%ebx
+801019ee:	81 fb 3c 66 11 80    	cmp    $0x8011663c,%ebx
+801019f4:	74 3a                	je     80101a30 <iget+0x70>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801019f6:	8b 43 08             	mov    0x8(%ebx),%eax
+801019f9:	85 c0                	test   %eax,%eax
+801019fb:	7e eb                	jle    801019e8 <iget+0x28>
+801019fd:	39 3b                	cmp    %edi,(%ebx)
+801019ff:	75 e7                	jne    801019e8 <iget+0x28>
+80101a01:	39 53 04             	cmp    %edx,0x4(%ebx)
+80101a04:	75 e2                	jne    801019e8 <iget+0x28>
+80101a06:	b8 01 00 00 00       	mov    $0x1,%eax
+80101a0b:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+      xadd(&ip->ref, 1);
+      releaseread(&icache.lock);
+80101a10:	83 ec 0c             	sub    $0xc,%esp
+80101a13:	68 40 42 11 80       	push   $0x80114240
+80101a18:	e8 03 4c 00 00       	call   80106620 <releaseread>
+      return ip;
+80101a1d:	83 c4 10             	add    $0x10,%esp
+  ip->ref = 1;
+  ip->valid = 0;
+  releasewrite(&icache.lock);
+
+  return ip;
+}
+80101a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a23:	89 d8                	mov    %ebx,%eax
+80101a25:	5b                   	pop    %ebx
+80101a26:	5e                   	pop    %esi
+80101a27:	5f                   	pop    %edi
+80101a28:	5d                   	pop    %ebp
+80101a29:	c3                   	ret
+80101a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  releaseread(&icache.lock);
+80101a30:	83 ec 0c             	sub    $0xc,%esp
+80101a33:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  empty = 0;
+80101a36:	31 db                	xor    %ebx,%ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101a38:	be 4c 42 11 80       	mov    $0x8011424c,%esi
+  releaseread(&icache.lock);
+80101a3d:	68 40 42 11 80       	push   $0x80114240
+80101a42:	e8 d9 4b 00 00       	call   80106620 <releaseread>
+  acquirewrite(&icache.lock);
+80101a47:	c7 04 24 40 42 11 80 	movl   $0x80114240,(%esp)
+80101a4e:	e8 fd 4b 00 00       	call   80106650 <acquirewrite>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101a53:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquirewrite(&icache.lock);
+80101a56:	83 c4 10             	add    $0x10,%esp
+80101a59:	eb 17                	jmp    80101a72 <iget+0xb2>
+80101a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101a5f:	90                   	nop
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101a60:	3b 3e                	cmp    (%esi),%edi
+80101a62:	74 6c                	je     80101ad0 <iget+0x110>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101a64:	81 c6 b8 00 00 00    	add    $0xb8,%esi
+80101a6a:	81 fe 3c 66 11 80    	cmp    $0x8011663c,%esi
+80101a70:	74 26                	je     80101a98 <iget+0xd8>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101a72:	8b 46 08             	mov    0x8(%esi),%eax
+80101a75:	85 c0                	test   %eax,%eax
+80101a77:	7f e7                	jg     80101a60 <iget+0xa0>
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80101a79:	85 db                	test   %ebx,%ebx
+80101a7b:	75 e7                	jne    80101a64 <iget+0xa4>
+80101a7d:	85 c0                	test   %eax,%eax
+80101a7f:	75 7a                	jne    80101afb <iget+0x13b>
+80101a81:	89 f3                	mov    %esi,%ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101a83:	81 c6 b8 00 00 00    	add    $0xb8,%esi
+80101a89:	81 fe 3c 66 11 80    	cmp    $0x8011663c,%esi
+80101a8f:	75 e1                	jne    80101a72 <iget+0xb2>
+80101a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(empty == 0)
+80101a98:	85 db                	test   %ebx,%ebx
+80101a9a:	74 7d                	je     80101b19 <iget+0x159>
+  releasewrite(&icache.lock);
+80101a9c:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+80101a9f:	89 3b                	mov    %edi,(%ebx)
+  ip->inum = inum;
+80101aa1:	89 53 04             	mov    %edx,0x4(%ebx)
+  ip->ref = 1;
+80101aa4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  ip->valid = 0;
+80101aab:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+  releasewrite(&icache.lock);
+80101ab2:	68 40 42 11 80       	push   $0x80114240
+80101ab7:	e8 04 4c 00 00       	call   801066c0 <releasewrite>
+  return ip;
+80101abc:	83 c4 10             	add    $0x10,%esp
+}
+80101abf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ac2:	89 d8                	mov    %ebx,%eax
+80101ac4:	5b                   	pop    %ebx
+80101ac5:	5e                   	pop    %esi
+80101ac6:	5f                   	pop    %edi
+80101ac7:	5d                   	pop    %ebp
+80101ac8:	c3                   	ret
+80101ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101ad0:	3b 56 04             	cmp    0x4(%esi),%edx
+80101ad3:	75 8f                	jne    80101a64 <iget+0xa4>
+80101ad5:	b8 01 00 00 00       	mov    $0x1,%eax
+80101ada:	f0 0f c1 46 08       	lock xadd %eax,0x8(%esi)
+      releasewrite(&icache.lock);
+80101adf:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+80101ae2:	89 f3                	mov    %esi,%ebx
+      releasewrite(&icache.lock);
+80101ae4:	68 40 42 11 80       	push   $0x80114240
+80101ae9:	e8 d2 4b 00 00       	call   801066c0 <releasewrite>
+      return ip;
+80101aee:	83 c4 10             	add    $0x10,%esp
+}
+80101af1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101af4:	89 d8                	mov    %ebx,%eax
+80101af6:	5b                   	pop    %ebx
+80101af7:	5e                   	pop    %esi
+80101af8:	5f                   	pop    %edi
+80101af9:	5d                   	pop    %ebp
+80101afa:	c3                   	ret
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80101afb:	81 c6 b8 00 00 00    	add    $0xb8,%esi
+80101b01:	81 fe 3c 66 11 80    	cmp    $0x8011663c,%esi
+80101b07:	74 10                	je     80101b19 <iget+0x159>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80101b09:	8b 46 08             	mov    0x8(%esi),%eax
+80101b0c:	85 c0                	test   %eax,%eax
+80101b0e:	0f 8f 4c ff ff ff    	jg     80101a60 <iget+0xa0>
+80101b14:	e9 64 ff ff ff       	jmp    80101a7d <iget+0xbd>
+    panic("iget: no inodes");
+80101b19:	83 ec 0c             	sub    $0xc,%esp
+80101b1c:	68 72 b3 10 80       	push   $0x8010b372
+80101b21:	e8 ba e8 ff ff       	call   801003e0 <panic>
+80101b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101b30 <bmap>:
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+// The address may carry the UNWRITTEN mark.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+80101b30:	55                   	push   %ebp
+80101b31:	89 e5                	mov    %esp,%ebp
+80101b33:	57                   	push   %edi
+80101b34:	56                   	push   %esi
+80101b35:	53                   	push   %ebx
+80101b36:	89 c3                	mov    %eax,%ebx
+80101b38:	83 ec 2c             	sub    $0x2c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+80101b3b:	83 fa 0b             	cmp    $0xb,%edx
+80101b3e:	0f 86 ec 00 00 00    	jbe    80101c30 <bmap+0x100>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+80101b44:	8d 72 f4             	lea    -0xc(%edx),%esi
+
+  if(bn < NINDIRECT){
+80101b47:	83 fe 7f             	cmp    $0x7f,%esi
+80101b4a:	0f 87 3e 01 00 00    	ja     80101c8e <bmap+0x15e>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101b50:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+80101b56:	85 d2                	test   %edx,%edx
+80101b58:	0f 84 82 00 00 00    	je     80101be0 <bmap+0xb0>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+80101b5e:	83 ec 08             	sub    $0x8,%esp
+80101b61:	52                   	push   %edx
+80101b62:	ff 33                	push   (%ebx)
+80101b64:	e8 27 e6 ff ff       	call   80100190 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+80101b69:	83 c4 10             	add    $0x10,%esp
+    bp = bread(ip->dev, addr);
+80101b6c:	89 c7                	mov    %eax,%edi
+    if((addr = a[bn]) == 0){
+80101b6e:	8d 84 b0 84 00 00 00 	lea    0x84(%eax,%esi,4),%eax
+80101b75:	8b 30                	mov    (%eax),%esi
+80101b77:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80101b7a:	85 f6                	test   %esi,%esi
+80101b7c:	74 1a                	je     80101b98 <bmap+0x68>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+80101b7e:	83 ec 0c             	sub    $0xc,%esp
+80101b81:	57                   	push   %edi
+80101b82:	e8 c9 e6 ff ff       	call   80100250 <brelse>
+80101b87:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+80101b8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b8d:	89 f0                	mov    %esi,%eax
+80101b8f:	5b                   	pop    %ebx
+80101b90:	5e                   	pop    %esi
+80101b91:	5f                   	pop    %edi
+80101b92:	5d                   	pop    %ebp
+80101b93:	c3                   	ret
+80101b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ballocrun(dev, 0, 1, &b);
+80101b98:	83 ec 0c             	sub    $0xc,%esp
+80101b9b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+      a[bn] = addr = balloc(ip->dev);
+80101b9e:	8b 1b                	mov    (%ebx),%ebx
+  ballocrun(dev, 0, 1, &b);
+80101ba0:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101ba5:	50                   	push   %eax
+80101ba6:	31 d2                	xor    %edx,%edx
+80101ba8:	89 d8                	mov    %ebx,%eax
+80101baa:	e8 51 fc ff ff       	call   80101800 <ballocrun>
+  bzero(dev, b);
+80101baf:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  bp = bnew(dev, bno);
+80101bb2:	58                   	pop    %eax
+80101bb3:	5a                   	pop    %edx
+80101bb4:	56                   	push   %esi
+80101bb5:	53                   	push   %ebx
+80101bb6:	e8 15 e6 ff ff       	call   801001d0 <bnew>
+  log_write(bp);
+80101bbb:	89 04 24             	mov    %eax,(%esp)
+  bp = bnew(dev, bno);
+80101bbe:	89 c3                	mov    %eax,%ebx
+  log_write(bp);
+80101bc0:	e8 cb 21 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101bc5:	89 1c 24             	mov    %ebx,(%esp)
+80101bc8:	e8 83 e6 ff ff       	call   80100250 <brelse>
+      a[bn] = addr = balloc(ip->dev);
+80101bcd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101bd0:	89 30                	mov    %esi,(%eax)
+      log_write(bp);
+80101bd2:	89 3c 24             	mov    %edi,(%esp)
+80101bd5:	e8 b6 21 00 00       	call   80103d90 <log_write>
+80101bda:	83 c4 10             	add    $0x10,%esp
+80101bdd:	eb 9f                	jmp    80101b7e <bmap+0x4e>
+80101bdf:	90                   	nop
+  ballocrun(dev, 0, 1, &b);
+80101be0:	83 ec 0c             	sub    $0xc,%esp
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101be3:	8b 38                	mov    (%eax),%edi
+  ballocrun(dev, 0, 1, &b);
+80101be5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80101be8:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101bed:	50                   	push   %eax
+80101bee:	89 f8                	mov    %edi,%eax
+80101bf0:	e8 0b fc ff ff       	call   80101800 <ballocrun>
+  bzero(dev, b);
+80101bf5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  bp = bnew(dev, bno);
+80101bf8:	59                   	pop    %ecx
+80101bf9:	58                   	pop    %eax
+80101bfa:	52                   	push   %edx
+80101bfb:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80101bfe:	57                   	push   %edi
+80101bff:	e8 cc e5 ff ff       	call   801001d0 <bnew>
+  log_write(bp);
+80101c04:	89 04 24             	mov    %eax,(%esp)
+  bp = bnew(dev, bno);
+80101c07:	89 c7                	mov    %eax,%edi
+  log_write(bp);
+80101c09:	e8 82 21 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101c0e:	89 3c 24             	mov    %edi,(%esp)
+80101c11:	e8 3a e6 ff ff       	call   80100250 <brelse>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80101c16:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80101c19:	83 c4 10             	add    $0x10,%esp
+80101c1c:	89 93 b4 00 00 00    	mov    %edx,0xb4(%ebx)
+80101c22:	e9 37 ff ff ff       	jmp    80101b5e <bmap+0x2e>
+80101c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c2e:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101c30:	8d 7a 20             	lea    0x20(%edx),%edi
+80101c33:	8b 74 b8 04          	mov    0x4(%eax,%edi,4),%esi
+80101c37:	85 f6                	test   %esi,%esi
+80101c39:	0f 85 4b ff ff ff    	jne    80101b8a <bmap+0x5a>
+  ballocrun(dev, 0, 1, &b);
+80101c3f:	83 ec 0c             	sub    $0xc,%esp
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101c42:	8b 30                	mov    (%eax),%esi
+  ballocrun(dev, 0, 1, &b);
+80101c44:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80101c47:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101c4c:	50                   	push   %eax
+80101c4d:	31 d2                	xor    %edx,%edx
+80101c4f:	89 f0                	mov    %esi,%eax
+80101c51:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+80101c54:	e8 a7 fb ff ff       	call   80101800 <ballocrun>
+  bzero(dev, b);
+80101c59:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  bp = bnew(dev, bno);
+80101c5c:	58                   	pop    %eax
+80101c5d:	5a                   	pop    %edx
+80101c5e:	56                   	push   %esi
+80101c5f:	ff 75 d4             	push   -0x2c(%ebp)
+80101c62:	e8 69 e5 ff ff       	call   801001d0 <bnew>
+  log_write(bp);
+80101c67:	89 04 24             	mov    %eax,(%esp)
+80101c6a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80101c6d:	e8 1e 21 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101c72:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80101c75:	89 04 24             	mov    %eax,(%esp)
+80101c78:	e8 d3 e5 ff ff       	call   80100250 <brelse>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+80101c7d:	89 74 bb 04          	mov    %esi,0x4(%ebx,%edi,4)
+80101c81:	83 c4 10             	add    $0x10,%esp
+}
+80101c84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c87:	5b                   	pop    %ebx
+80101c88:	89 f0                	mov    %esi,%eax
+80101c8a:	5e                   	pop    %esi
+80101c8b:	5f                   	pop    %edi
+80101c8c:	5d                   	pop    %ebp
+80101c8d:	c3                   	ret
+  panic("bmap: out of range");
+80101c8e:	83 ec 0c             	sub    $0xc,%esp
+80101c91:	68 82 b3 10 80       	push   $0x8010b382
+80101c96:	e8 45 e7 ff ff       	call   801003e0 <panic>
+80101c9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101c9f:	90                   	nop
+
+80101ca0 <bmapalloc.part.0>:
+// can be taken as contiguous runs that continue right after the
+// file's preceding block. The blocks are not zeroed: writei()
+// fills them through bnew() instead of reading them back, and
+// reservei() passes UNWRITTEN in flags so they read as zeroes.
+static void
+bmapalloc(struct inode *ip, uint bn, uint end, uint flags)
+80101ca0:	55                   	push   %ebp
+80101ca1:	89 e5                	mov    %esp,%ebp
+80101ca3:	57                   	push   %edi
+80101ca4:	56                   	push   %esi
+80101ca5:	53                   	push   %ebx
+80101ca6:	89 d3                	mov    %edx,%ebx
+80101ca8:	83 ec 3c             	sub    $0x3c,%esp
+80101cab:	8b 55 08             	mov    0x8(%ebp),%edx
+80101cae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80101cb1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+80101cb4:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  if(bn >= end)
+    return;
+
+  // Allocate the indirect block first so it does not land in
+  // the middle of the data runs.
+  if(end > NDIRECT && ip->addrs[NDIRECT] == 0)
+80101cb7:	83 f9 0c             	cmp    $0xc,%ecx
+80101cba:	76 0e                	jbe    80101cca <bmapalloc.part.0+0x2a>
+80101cbc:	8b 88 b4 00 00 00    	mov    0xb4(%eax),%ecx
+80101cc2:	85 c9                	test   %ecx,%ecx
+80101cc4:	0f 84 fe 00 00 00    	je     80101dc8 <bmapalloc.part.0+0x128>
+    ip->addrs[NDIRECT] = balloc(ip->dev);
+
+  goal = bn > 0 ? (bmap(ip, bn - 1) & ~UNWRITTEN) + 1 : 0;
+80101cca:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+80101cd1:	85 db                	test   %ebx,%ebx
+80101cd3:	0f 85 cd 00 00 00    	jne    80101da6 <bmapalloc.part.0+0x106>
+80101cd9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80101cdc:	31 ff                	xor    %edi,%edi
+80101cde:	89 45 c0             	mov    %eax,-0x40(%ebp)
+80101ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bp = 0;
+  while(bn < end){
+    cnt = ballocrun(ip->dev, goal, end - bn, &b);
+80101ce8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101ceb:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80101cee:	83 ec 0c             	sub    $0xc,%esp
+80101cf1:	8b 00                	mov    (%eax),%eax
+80101cf3:	ff 75 c0             	push   -0x40(%ebp)
+80101cf6:	29 d9                	sub    %ebx,%ecx
+80101cf8:	8b 55 c8             	mov    -0x38(%ebp),%edx
+80101cfb:	e8 00 fb ff ff       	call   80101800 <ballocrun>
+    goal = b + cnt;
+80101d00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    for(; cnt > 0; cnt--, bn++, b++){
+80101d03:	83 c4 10             	add    $0x10,%esp
+    goal = b + cnt;
+80101d06:	8d 14 30             	lea    (%eax,%esi,1),%edx
+80101d09:	89 55 c8             	mov    %edx,-0x38(%ebp)
+    for(; cnt > 0; cnt--, bn++, b++){
+80101d0c:	85 c0                	test   %eax,%eax
+80101d0e:	74 48                	je     80101d58 <bmapalloc.part.0+0xb8>
+80101d10:	8b 55 bc             	mov    -0x44(%ebp),%edx
+80101d13:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80101d16:	89 f8                	mov    %edi,%eax
+80101d18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80101d1b:	eb 18                	jmp    80101d35 <bmapalloc.part.0+0x95>
+80101d1d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(bn < NDIRECT){
+        ip->addrs[bn] = b | flags;
+        continue;
+      }
+      if(bp == 0)
+80101d20:	85 c0                	test   %eax,%eax
+80101d22:	74 5c                	je     80101d80 <bmapalloc.part.0+0xe0>
+        bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      ((uint*)bp->data)[bn - NDIRECT] = b | flags;
+80101d24:	89 7c 98 54          	mov    %edi,0x54(%eax,%ebx,4)
+    for(; cnt > 0; cnt--, bn++, b++){
+80101d28:	83 c6 01             	add    $0x1,%esi
+80101d2b:	83 c3 01             	add    $0x1,%ebx
+80101d2e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80101d31:	39 cb                	cmp    %ecx,%ebx
+80101d33:	74 21                	je     80101d56 <bmapalloc.part.0+0xb6>
+        ip->addrs[bn] = b | flags;
+80101d35:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80101d38:	09 f7                	or     %esi,%edi
+      if(bn < NDIRECT){
+80101d3a:	83 fb 0b             	cmp    $0xb,%ebx
+80101d3d:	77 e1                	ja     80101d20 <bmapalloc.part.0+0x80>
+        ip->addrs[bn] = b | flags;
+80101d3f:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    for(; cnt > 0; cnt--, bn++, b++){
+80101d42:	83 c6 01             	add    $0x1,%esi
+80101d45:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+        ip->addrs[bn] = b | flags;
+80101d48:	89 bc 9a 84 00 00 00 	mov    %edi,0x84(%edx,%ebx,4)
+    for(; cnt > 0; cnt--, bn++, b++){
+80101d4f:	83 c3 01             	add    $0x1,%ebx
+80101d52:	39 cb                	cmp    %ecx,%ebx
+80101d54:	75 df                	jne    80101d35 <bmapalloc.part.0+0x95>
+80101d56:	89 c7                	mov    %eax,%edi
+  while(bn < end){
+80101d58:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80101d5b:	39 c3                	cmp    %eax,%ebx
+80101d5d:	72 89                	jb     80101ce8 <bmapalloc.part.0+0x48>
+    }
+  }
+  if(bp){
+80101d5f:	85 ff                	test   %edi,%edi
+80101d61:	74 3b                	je     80101d9e <bmapalloc.part.0+0xfe>
+    log_write(bp);
+80101d63:	83 ec 0c             	sub    $0xc,%esp
+80101d66:	57                   	push   %edi
+80101d67:	e8 24 20 00 00       	call   80103d90 <log_write>
+    brelse(bp);
+80101d6c:	89 7d 08             	mov    %edi,0x8(%ebp)
+80101d6f:	83 c4 10             	add    $0x10,%esp
+  }
+}
+80101d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d75:	5b                   	pop    %ebx
+80101d76:	5e                   	pop    %esi
+80101d77:	5f                   	pop    %edi
+80101d78:	5d                   	pop    %ebp
+    brelse(bp);
+80101d79:	e9 d2 e4 ff ff       	jmp    80100250 <brelse>
+80101d7e:	66 90                	xchg   %ax,%ax
+        bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80101d80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101d83:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+80101d86:	83 ec 08             	sub    $0x8,%esp
+80101d89:	ff b0 b4 00 00 00    	push   0xb4(%eax)
+80101d8f:	ff 30                	push   (%eax)
+80101d91:	e8 fa e3 ff ff       	call   80100190 <bread>
+80101d96:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+80101d99:	83 c4 10             	add    $0x10,%esp
+80101d9c:	eb 86                	jmp    80101d24 <bmapalloc.part.0+0x84>
+}
+80101d9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101da1:	5b                   	pop    %ebx
+80101da2:	5e                   	pop    %esi
+80101da3:	5f                   	pop    %edi
+80101da4:	5d                   	pop    %ebp
+80101da5:	c3                   	ret
+  goal = bn > 0 ? (bmap(ip, bn - 1) & ~UNWRITTEN) + 1 : 0;
+80101da6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101da9:	8d 53 ff             	lea    -0x1(%ebx),%edx
+80101dac:	e8 7f fd ff ff       	call   80101b30 <bmap>
+  while(bn < end){
+80101db1:	8b 55 cc             	mov    -0x34(%ebp),%edx
+80101db4:	39 d3                	cmp    %edx,%ebx
+80101db6:	73 e6                	jae    80101d9e <bmapalloc.part.0+0xfe>
+  goal = bn > 0 ? (bmap(ip, bn - 1) & ~UNWRITTEN) + 1 : 0;
+80101db8:	25 ff ff ff 7f       	and    $0x7fffffff,%eax
+80101dbd:	83 c0 01             	add    $0x1,%eax
+80101dc0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+80101dc3:	e9 11 ff ff ff       	jmp    80101cd9 <bmapalloc.part.0+0x39>
+  ballocrun(dev, 0, 1, &b);
+80101dc8:	83 ec 0c             	sub    $0xc,%esp
+80101dcb:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+    ip->addrs[NDIRECT] = balloc(ip->dev);
+80101dce:	8b 30                	mov    (%eax),%esi
+  ballocrun(dev, 0, 1, &b);
+80101dd0:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101dd5:	52                   	push   %edx
+80101dd6:	31 d2                	xor    %edx,%edx
+80101dd8:	89 f0                	mov    %esi,%eax
+80101dda:	e8 21 fa ff ff       	call   80101800 <ballocrun>
+  bzero(dev, b);
+80101ddf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  bp = bnew(dev, bno);
+80101de2:	58                   	pop    %eax
+80101de3:	5a                   	pop    %edx
+80101de4:	57                   	push   %edi
+80101de5:	56                   	push   %esi
+80101de6:	e8 e5 e3 ff ff       	call   801001d0 <bnew>
+  log_write(bp);
+80101deb:	89 04 24             	mov    %eax,(%esp)
+  bp = bnew(dev, bno);
+80101dee:	89 c6                	mov    %eax,%esi
+  log_write(bp);
+80101df0:	e8 9b 1f 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101df5:	89 34 24             	mov    %esi,(%esp)
+80101df8:	e8 53 e4 ff ff       	call   80100250 <brelse>
+    ip->addrs[NDIRECT] = balloc(ip->dev);
+80101dfd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80101e00:	83 c4 10             	add    $0x10,%esp
+80101e03:	89 b8 b4 00 00 00    	mov    %edi,0xb4(%eax)
+80101e09:	e9 bc fe ff ff       	jmp    80101cca <bmapalloc.part.0+0x2a>
+80101e0e:	66 90                	xchg   %ax,%ax
+
+80101e10 <iuninline>:
+
+// Move an inline file's content out of ip->addrs into
+// a data block, so that the file can grow past MAXINLINE.
+static void
+iuninline(struct inode *ip)
+{
+80101e10:	55                   	push   %ebp
+80101e11:	89 e5                	mov    %esp,%ebp
+80101e13:	57                   	push   %edi
+80101e14:	56                   	push   %esi
+  char data[MAXINLINE];
+  struct buf *bp;
+
+  memmove(data, ip->addrs, ip->size);
+80101e15:	8d 7d b4             	lea    -0x4c(%ebp),%edi
+80101e18:	8d b0 84 00 00 00    	lea    0x84(%eax),%esi
+{
+80101e1e:	53                   	push   %ebx
+80101e1f:	89 c3                	mov    %eax,%ebx
+80101e21:	83 ec 50             	sub    $0x50,%esp
+  memmove(data, ip->addrs, ip->size);
+80101e24:	ff b0 80 00 00 00    	push   0x80(%eax)
+80101e2a:	56                   	push   %esi
+80101e2b:	57                   	push   %edi
+80101e2c:	e8 0f 55 00 00       	call   80107340 <memmove>
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+80101e31:	83 c4 0c             	add    $0xc,%esp
+80101e34:	6a 34                	push   $0x34
+80101e36:	6a 00                	push   $0x0
+80101e38:	56                   	push   %esi
+80101e39:	e8 72 54 00 00       	call   801072b0 <memset>
+  if(ip->size == 0)
+80101e3e:	8b 8b 80 00 00 00    	mov    0x80(%ebx),%ecx
+80101e44:	83 c4 10             	add    $0x10,%esp
+80101e47:	85 c9                	test   %ecx,%ecx
+80101e49:	74 4d                	je     80101e98 <iuninline+0x88>
+  if(bn >= end)
+80101e4b:	83 ec 0c             	sub    $0xc,%esp
+80101e4e:	b9 01 00 00 00       	mov    $0x1,%ecx
+80101e53:	31 d2                	xor    %edx,%edx
+80101e55:	89 d8                	mov    %ebx,%eax
+80101e57:	6a 00                	push   $0x0
+80101e59:	e8 42 fe ff ff       	call   80101ca0 <bmapalloc.part.0>
+    return;
+  bmapalloc(ip, 0, 1, 0);
+  bp = bnew(ip->dev, ip->addrs[0]);
+80101e5e:	58                   	pop    %eax
+80101e5f:	5a                   	pop    %edx
+80101e60:	ff b3 84 00 00 00    	push   0x84(%ebx)
+80101e66:	ff 33                	push   (%ebx)
+80101e68:	e8 63 e3 ff ff       	call   801001d0 <bnew>
+  memmove(bp->data, data, ip->size);
+80101e6d:	83 c4 0c             	add    $0xc,%esp
+80101e70:	ff b3 80 00 00 00    	push   0x80(%ebx)
+  bp = bnew(ip->dev, ip->addrs[0]);
+80101e76:	89 c6                	mov    %eax,%esi
+  memmove(bp->data, data, ip->size);
+80101e78:	8d 80 84 00 00 00    	lea    0x84(%eax),%eax
+80101e7e:	57                   	push   %edi
+80101e7f:	50                   	push   %eax
+80101e80:	e8 bb 54 00 00       	call   80107340 <memmove>
+  log_write(bp);
+80101e85:	89 34 24             	mov    %esi,(%esp)
+80101e88:	e8 03 1f 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+80101e8d:	89 34 24             	mov    %esi,(%esp)
+80101e90:	e8 bb e3 ff ff       	call   80100250 <brelse>
+80101e95:	83 c4 10             	add    $0x10,%esp
+}
+80101e98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101e9b:	5b                   	pop    %ebx
+80101e9c:	5e                   	pop    %esi
+80101e9d:	5f                   	pop    %edi
+80101e9e:	5d                   	pop    %ebp
+80101e9f:	c3                   	ret
+
+80101ea0 <readsb>:
+{
+80101ea0:	55                   	push   %ebp
+80101ea1:	89 e5                	mov    %esp,%ebp
+80101ea3:	56                   	push   %esi
+80101ea4:	53                   	push   %ebx
+80101ea5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80101ea8:	83 ec 08             	sub    $0x8,%esp
+80101eab:	6a 01                	push   $0x1
+80101ead:	ff 75 08             	push   0x8(%ebp)
+80101eb0:	e8 db e2 ff ff       	call   80100190 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101eb5:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80101eb8:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101eba:	8d 80 84 00 00 00    	lea    0x84(%eax),%eax
+80101ec0:	6a 1c                	push   $0x1c
+80101ec2:	50                   	push   %eax
+80101ec3:	56                   	push   %esi
+80101ec4:	e8 77 54 00 00       	call   80107340 <memmove>
+  brelse(bp);
+80101ec9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80101ecc:	83 c4 10             	add    $0x10,%esp
+}
+80101ecf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101ed2:	5b                   	pop    %ebx
+80101ed3:	5e                   	pop    %esi
+80101ed4:	5d                   	pop    %ebp
+  brelse(bp);
+80101ed5:	e9 76 e3 ff ff       	jmp    80100250 <brelse>
+80101eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101ee0 <iinit>:
+{
+80101ee0:	55                   	push   %ebp
+80101ee1:	89 e5                	mov    %esp,%ebp
+80101ee3:	53                   	push   %ebx
+80101ee4:	bb 58 42 11 80       	mov    $0x80114258,%ebx
+80101ee9:	83 ec 0c             	sub    $0xc,%esp
+  initrwlock(&icache.lock, "icache");
+80101eec:	68 95 b3 10 80       	push   $0x8010b395
+80101ef1:	68 40 42 11 80       	push   $0x80114240
+80101ef6:	e8 b5 46 00 00       	call   801065b0 <initrwlock>
+  for(i = 0; i < NINODE; i++) {
+80101efb:	83 c4 10             	add    $0x10,%esp
+80101efe:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101f00:	83 ec 08             	sub    $0x8,%esp
+80101f03:	68 9c b3 10 80       	push   $0x8010b39c
+80101f08:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+80101f09:	81 c3 b8 00 00 00    	add    $0xb8,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+80101f0f:	e8 fc 47 00 00       	call   80106710 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+80101f14:	83 c4 10             	add    $0x10,%esp
+80101f17:	81 fb 48 66 11 80    	cmp    $0x80116648,%ebx
+80101f1d:	75 e1                	jne    80101f00 <iinit+0x20>
+  bp = bread(dev, 1);
+80101f1f:	83 ec 08             	sub    $0x8,%esp
+80101f22:	6a 01                	push   $0x1
+80101f24:	ff 75 08             	push   0x8(%ebp)
+80101f27:	e8 64 e2 ff ff       	call   80100190 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80101f2c:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80101f2f:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80101f31:	8d 80 84 00 00 00    	lea    0x84(%eax),%eax
+80101f37:	6a 1c                	push   $0x1c
+80101f39:	50                   	push   %eax
+80101f3a:	68 3c 66 11 80       	push   $0x8011663c
+80101f3f:	e8 fc 53 00 00       	call   80107340 <memmove>
+  brelse(bp);
+80101f44:	89 1c 24             	mov    %ebx,(%esp)
+80101f47:	e8 04 e3 ff ff       	call   80100250 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80101f4c:	ff 35 54 66 11 80    	push   0x80116654
+80101f52:	ff 35 50 66 11 80    	push   0x80116650
+80101f58:	ff 35 4c 66 11 80    	push   0x8011664c
+80101f5e:	ff 35 48 66 11 80    	push   0x80116648
+80101f64:	ff 35 44 66 11 80    	push   0x80116644
+80101f6a:	ff 35 40 66 11 80    	push   0x80116640
+80101f70:	ff 35 3c 66 11 80    	push   0x8011663c
+80101f76:	68 00 b4 10 80       	push   $0x8010b400
+80101f7b:	e8 90 e7 ff ff       	call   80100710 <cprintf>
+}
+80101f80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101f83:	83 c4 30             	add    $0x30,%esp
+80101f86:	c9                   	leave
+80101f87:	c3                   	ret
+80101f88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101f8f:	90                   	nop
+
+80101f90 <ialloc>:
+{
+80101f90:	55                   	push   %ebp
+80101f91:	89 e5                	mov    %esp,%ebp
+80101f93:	57                   	push   %edi
+80101f94:	56                   	push   %esi
+80101f95:	53                   	push   %ebx
+80101f96:	83 ec 1c             	sub    $0x1c,%esp
+80101f99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101f9c:	83 3d 44 66 11 80 01 	cmpl   $0x1,0x80116644
+{
+80101fa3:	8b 75 08             	mov    0x8(%ebp),%esi
+80101fa6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101fa9:	0f 86 94 00 00 00    	jbe    80102043 <ialloc+0xb3>
+80101faf:	bf 01 00 00 00       	mov    $0x1,%edi
+80101fb4:	eb 21                	jmp    80101fd7 <ialloc+0x47>
+80101fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fbd:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80101fc0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101fc3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80101fc6:	53                   	push   %ebx
+80101fc7:	e8 84 e2 ff ff       	call   80100250 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80101fcc:	83 c4 10             	add    $0x10,%esp
+80101fcf:	3b 3d 44 66 11 80    	cmp    0x80116644,%edi
+80101fd5:	73 6c                	jae    80102043 <ialloc+0xb3>
+    bp = bread(dev, IBLOCK(inum, sb));
+80101fd7:	89 f8                	mov    %edi,%eax
+80101fd9:	83 ec 08             	sub    $0x8,%esp
+80101fdc:	c1 e8 03             	shr    $0x3,%eax
+80101fdf:	03 05 50 66 11 80    	add    0x80116650,%eax
+80101fe5:	50                   	push   %eax
+80101fe6:	56                   	push   %esi
+80101fe7:	e8 a4 e1 ff ff       	call   80100190 <bread>
+    if(dip->type == 0){  // a free inode
+80101fec:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+80101fef:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+80101ff1:	89 f8                	mov    %edi,%eax
+80101ff3:	83 e0 07             	and    $0x7,%eax
+80101ff6:	c1 e0 06             	shl    $0x6,%eax
+80101ff9:	8d 8c 03 84 00 00 00 	lea    0x84(%ebx,%eax,1),%ecx
+    if(dip->type == 0){  // a free inode
+80102000:	66 83 39 00          	cmpw   $0x0,(%ecx)
+80102004:	75 ba                	jne    80101fc0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+80102006:	83 ec 04             	sub    $0x4,%esp
+80102009:	6a 40                	push   $0x40
+8010200b:	6a 00                	push   $0x0
+8010200d:	51                   	push   %ecx
+8010200e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80102011:	e8 9a 52 00 00       	call   801072b0 <memset>
+      dip->type = type;
+80102016:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+8010201a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010201d:	66 89 01             	mov    %ax,(%ecx)
+      log_write(bp);   // mark it allocated on the disk
+80102020:	89 1c 24             	mov    %ebx,(%esp)
+80102023:	e8 68 1d 00 00       	call   80103d90 <log_write>
+      brelse(bp);
+80102028:	89 1c 24             	mov    %ebx,(%esp)
+8010202b:	e8 20 e2 ff ff       	call   80100250 <brelse>
+      return iget(dev, inum);
+80102030:	83 c4 10             	add    $0x10,%esp
+}
+80102033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102036:	89 fa                	mov    %edi,%edx
+}
+80102038:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102039:	89 f0                	mov    %esi,%eax
+}
+8010203b:	5e                   	pop    %esi
+8010203c:	5f                   	pop    %edi
+8010203d:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010203e:	e9 7d f9 ff ff       	jmp    801019c0 <iget>
+  panic("ialloc: no inodes");
+80102043:	83 ec 0c             	sub    $0xc,%esp
+80102046:	68 a2 b3 10 80       	push   $0x8010b3a2
+8010204b:	e8 90 e3 ff ff       	call   801003e0 <panic>
+
+80102050 <iupdate>:
+{
+80102050:	55                   	push   %ebp
+80102051:	89 e5                	mov    %esp,%ebp
+80102053:	56                   	push   %esi
+80102054:	53                   	push   %ebx
+80102055:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102058:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010205b:	81 c3 84 00 00 00    	add    $0x84,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102061:	83 ec 08             	sub    $0x8,%esp
+80102064:	c1 e8 03             	shr    $0x3,%eax
+80102067:	03 05 50 66 11 80    	add    0x80116650,%eax
+8010206d:	50                   	push   %eax
+8010206e:	ff b3 7c ff ff ff    	push   -0x84(%ebx)
+80102074:	e8 17 e1 ff ff       	call   80100190 <bread>
+  dip->type = ip->type;
+80102079:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010207d:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102080:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102082:	8b 43 80             	mov    -0x80(%ebx),%eax
+80102085:	83 e0 07             	and    $0x7,%eax
+80102088:	c1 e0 06             	shl    $0x6,%eax
+8010208b:	8d 84 06 84 00 00 00 	lea    0x84(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80102092:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102095:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102099:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+8010209c:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+801020a0:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+801020a4:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+801020a8:	0f b7 53 fa          	movzwl -0x6(%ebx),%edx
+801020ac:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+801020b0:	8b 53 fc             	mov    -0x4(%ebx),%edx
+801020b3:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+801020b6:	6a 34                	push   $0x34
+801020b8:	53                   	push   %ebx
+801020b9:	50                   	push   %eax
+801020ba:	e8 81 52 00 00       	call   80107340 <memmove>
+  log_write(bp);
+801020bf:	89 34 24             	mov    %esi,(%esp)
+801020c2:	e8 c9 1c 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+801020c7:	89 75 08             	mov    %esi,0x8(%ebp)
+801020ca:	83 c4 10             	add    $0x10,%esp
+}
+801020cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801020d0:	5b                   	pop    %ebx
+801020d1:	5e                   	pop    %esi
+801020d2:	5d                   	pop    %ebp
+  brelse(bp);
+801020d3:	e9 78 e1 ff ff       	jmp    80100250 <brelse>
+801020d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801020df:	90                   	nop
+
+801020e0 <idup>:
+{
+801020e0:	55                   	push   %ebp
+801020e1:	ba 01 00 00 00       	mov    $0x1,%edx
+801020e6:	89 e5                	mov    %esp,%ebp
+801020e8:	8b 45 08             	mov    0x8(%ebp),%eax
+801020eb:	f0 0f c1 50 08       	lock xadd %edx,0x8(%eax)
+}
+801020f0:	5d                   	pop    %ebp
+801020f1:	c3                   	ret
+801020f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801020f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102100 <ilock>:
+{
+80102100:	55                   	push   %ebp
+80102101:	89 e5                	mov    %esp,%ebp
+80102103:	56                   	push   %esi
+80102104:	53                   	push   %ebx
+80102105:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102108:	85 db                	test   %ebx,%ebx
+8010210a:	0f 84 c0 00 00 00    	je     801021d0 <ilock+0xd0>
+80102110:	8b 53 08             	mov    0x8(%ebx),%edx
+80102113:	85 d2                	test   %edx,%edx
+80102115:	0f 8e b5 00 00 00    	jle    801021d0 <ilock+0xd0>
+  acquiresleep(&ip->lock);
+8010211b:	83 ec 0c             	sub    $0xc,%esp
+8010211e:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102121:	50                   	push   %eax
+80102122:	e8 39 46 00 00       	call   80106760 <acquiresleep>
+  if(ip->valid == 0){
+80102127:	8b 43 74             	mov    0x74(%ebx),%eax
+8010212a:	83 c4 10             	add    $0x10,%esp
+8010212d:	85 c0                	test   %eax,%eax
+8010212f:	74 0f                	je     80102140 <ilock+0x40>
+}
+80102131:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102134:	5b                   	pop    %ebx
+80102135:	5e                   	pop    %esi
+80102136:	5d                   	pop    %ebp
+80102137:	c3                   	ret
+80102138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010213f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102140:	8b 43 04             	mov    0x4(%ebx),%eax
+80102143:	83 ec 08             	sub    $0x8,%esp
+80102146:	c1 e8 03             	shr    $0x3,%eax
+80102149:	03 05 50 66 11 80    	add    0x80116650,%eax
+8010214f:	50                   	push   %eax
+80102150:	ff 33                	push   (%ebx)
+80102152:	e8 39 e0 ff ff       	call   80100190 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102157:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+8010215a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+8010215c:	8b 43 04             	mov    0x4(%ebx),%eax
+8010215f:	83 e0 07             	and    $0x7,%eax
+80102162:	c1 e0 06             	shl    $0x6,%eax
+80102165:	8d 84 06 84 00 00 00 	lea    0x84(%esi,%eax,1),%eax
+    ip->type = dip->type;
+8010216c:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+8010216f:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+80102172:	66 89 53 78          	mov    %dx,0x78(%ebx)
+    ip->major = dip->major;
+80102176:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+8010217a:	66 89 53 7a          	mov    %dx,0x7a(%ebx)
+    ip->minor = dip->minor;
+8010217e:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+80102182:	66 89 53 7c          	mov    %dx,0x7c(%ebx)
+    ip->nlink = dip->nlink;
+80102186:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+8010218a:	66 89 53 7e          	mov    %dx,0x7e(%ebx)
+    ip->size = dip->size;
+8010218e:	8b 50 fc             	mov    -0x4(%eax),%edx
+80102191:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102197:	6a 34                	push   $0x34
+80102199:	50                   	push   %eax
+8010219a:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+801021a0:	50                   	push   %eax
+801021a1:	e8 9a 51 00 00       	call   80107340 <memmove>
+    brelse(bp);
+801021a6:	89 34 24             	mov    %esi,(%esp)
+801021a9:	e8 a2 e0 ff ff       	call   80100250 <brelse>
+    if(ip->type == 0)
+801021ae:	83 c4 10             	add    $0x10,%esp
+801021b1:	66 83 7b 78 00       	cmpw   $0x0,0x78(%ebx)
+    ip->valid = 1;
+801021b6:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+    if(ip->type == 0)
+801021bd:	0f 85 6e ff ff ff    	jne    80102131 <ilock+0x31>
+      panic("ilock: no type");
+801021c3:	83 ec 0c             	sub    $0xc,%esp
+801021c6:	68 ba b3 10 80       	push   $0x8010b3ba
+801021cb:	e8 10 e2 ff ff       	call   801003e0 <panic>
+    panic("ilock");
+801021d0:	83 ec 0c             	sub    $0xc,%esp
+801021d3:	68 b4 b3 10 80       	push   $0x8010b3b4
+801021d8:	e8 03 e2 ff ff       	call   801003e0 <panic>
+801021dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801021e0 <iunlock>:
+{
+801021e0:	55                   	push   %ebp
+801021e1:	89 e5                	mov    %esp,%ebp
+801021e3:	56                   	push   %esi
+801021e4:	53                   	push   %ebx
+801021e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801021e8:	85 db                	test   %ebx,%ebx
+801021ea:	74 28                	je     80102214 <iunlock+0x34>
+801021ec:	83 ec 0c             	sub    $0xc,%esp
+801021ef:	8d 73 0c             	lea    0xc(%ebx),%esi
+801021f2:	56                   	push   %esi
+801021f3:	e8 c8 46 00 00       	call   801068c0 <holdingsleep>
+801021f8:	83 c4 10             	add    $0x10,%esp
+801021fb:	85 c0                	test   %eax,%eax
+801021fd:	74 15                	je     80102214 <iunlock+0x34>
+801021ff:	8b 43 08             	mov    0x8(%ebx),%eax
+80102202:	85 c0                	test   %eax,%eax
+80102204:	7e 0e                	jle    80102214 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102206:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102209:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010220c:	5b                   	pop    %ebx
+8010220d:	5e                   	pop    %esi
+8010220e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+8010220f:	e9 5c 46 00 00       	jmp    80106870 <releasesleep>
+    panic("iunlock");
+80102214:	83 ec 0c             	sub    $0xc,%esp
+80102217:	68 c9 b3 10 80       	push   $0x8010b3c9
+8010221c:	e8 bf e1 ff ff       	call   801003e0 <panic>
+80102221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010222f:	90                   	nop
+
+80102230 <iput>:
+{
+80102230:	55                   	push   %ebp
+80102231:	89 e5                	mov    %esp,%ebp
+80102233:	57                   	push   %edi
+80102234:	56                   	push   %esi
+80102235:	53                   	push   %ebx
+80102236:	83 ec 28             	sub    $0x28,%esp
+80102239:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010223c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+8010223f:	57                   	push   %edi
+80102240:	e8 1b 45 00 00       	call   80106760 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80102245:	8b 53 74             	mov    0x74(%ebx),%edx
+80102248:	83 c4 10             	add    $0x10,%esp
+8010224b:	85 d2                	test   %edx,%edx
+8010224d:	74 0d                	je     8010225c <iput+0x2c>
+8010224f:	66 83 7b 7e 00       	cmpw   $0x0,0x7e(%ebx)
+80102254:	75 06                	jne    8010225c <iput+0x2c>
+    if(ip->ref == 1){
+80102256:	83 7b 08 01          	cmpl   $0x1,0x8(%ebx)
+8010225a:	74 24                	je     80102280 <iput+0x50>
+  releasesleep(&ip->lock);
+8010225c:	83 ec 0c             	sub    $0xc,%esp
+8010225f:	57                   	push   %edi
+80102260:	e8 0b 46 00 00       	call   80106870 <releasesleep>
+80102265:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010226a:	f0 0f c1 43 08       	lock xadd %eax,0x8(%ebx)
+}
+8010226f:	83 c4 10             	add    $0x10,%esp
+80102272:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102275:	5b                   	pop    %ebx
+80102276:	5e                   	pop    %esi
+80102277:	5f                   	pop    %edi
+80102278:	5d                   	pop    %ebp
+80102279:	c3                   	ret
+8010227a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+80102280:	66 83 7b 78 02       	cmpw   $0x2,0x78(%ebx)
+80102285:	74 41                	je     801022c8 <iput+0x98>
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+
+  for(i = 0; i < NDIRECT; i++){
+80102287:	8d 8b b4 00 00 00    	lea    0xb4(%ebx),%ecx
+8010228d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102290:	8d b3 84 00 00 00    	lea    0x84(%ebx),%esi
+80102296:	89 df                	mov    %ebx,%edi
+80102298:	89 cb                	mov    %ecx,%ebx
+8010229a:	eb 0b                	jmp    801022a7 <iput+0x77>
+8010229c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801022a0:	83 c6 04             	add    $0x4,%esi
+801022a3:	39 de                	cmp    %ebx,%esi
+801022a5:	74 79                	je     80102320 <iput+0xf0>
+    if(ip->addrs[i]){
+801022a7:	8b 16                	mov    (%esi),%edx
+801022a9:	85 d2                	test   %edx,%edx
+801022ab:	74 f3                	je     801022a0 <iput+0x70>
+      bfree(ip->dev, ip->addrs[i] & ~UNWRITTEN);
+801022ad:	8b 07                	mov    (%edi),%eax
+801022af:	81 e2 ff ff ff 7f    	and    $0x7fffffff,%edx
+801022b5:	e8 86 f6 ff ff       	call   80101940 <bfree>
+      ip->addrs[i] = 0;
+801022ba:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+801022c0:	eb de                	jmp    801022a0 <iput+0x70>
+801022c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+801022c8:	83 bb 80 00 00 00 34 	cmpl   $0x34,0x80(%ebx)
+801022cf:	77 b6                	ja     80102287 <iput+0x57>
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+801022d1:	83 ec 04             	sub    $0x4,%esp
+801022d4:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+801022da:	6a 34                	push   $0x34
+801022dc:	6a 00                	push   $0x0
+801022de:	50                   	push   %eax
+801022df:	e8 cc 4f 00 00       	call   801072b0 <memset>
+    ip->size = 0;
+801022e4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+801022eb:	00 00 00 
+    iupdate(ip);
+801022ee:	89 1c 24             	mov    %ebx,(%esp)
+801022f1:	e8 5a fd ff ff       	call   80102050 <iupdate>
+    return;
+801022f6:	83 c4 10             	add    $0x10,%esp
+801022f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      iupdate(ip);
+80102300:	83 ec 0c             	sub    $0xc,%esp
+      ip->type = 0;
+80102303:	31 c0                	xor    %eax,%eax
+80102305:	66 89 43 78          	mov    %ax,0x78(%ebx)
+      iupdate(ip);
+80102309:	53                   	push   %ebx
+8010230a:	e8 41 fd ff ff       	call   80102050 <iupdate>
+      ip->valid = 0;
+8010230f:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+80102316:	83 c4 10             	add    $0x10,%esp
+80102319:	e9 3e ff ff ff       	jmp    8010225c <iput+0x2c>
+8010231e:	66 90                	xchg   %ax,%ax
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+80102320:	89 fb                	mov    %edi,%ebx
+80102322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102325:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+8010232b:	85 c0                	test   %eax,%eax
+8010232d:	75 18                	jne    80102347 <iput+0x117>
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+8010232f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80102336:	00 00 00 
+  iupdate(ip);
+80102339:	83 ec 0c             	sub    $0xc,%esp
+8010233c:	53                   	push   %ebx
+8010233d:	e8 0e fd ff ff       	call   80102050 <iupdate>
+80102342:	83 c4 10             	add    $0x10,%esp
+80102345:	eb b9                	jmp    80102300 <iput+0xd0>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80102347:	83 ec 08             	sub    $0x8,%esp
+8010234a:	50                   	push   %eax
+8010234b:	ff 33                	push   (%ebx)
+8010234d:	e8 3e de ff ff       	call   80100190 <bread>
+    for(j = 0; j < NINDIRECT; j++){
+80102352:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102355:	83 c4 10             	add    $0x10,%esp
+80102358:	8d 88 84 02 00 00    	lea    0x284(%eax),%ecx
+8010235e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102361:	8d b0 84 00 00 00    	lea    0x84(%eax),%esi
+80102367:	89 cf                	mov    %ecx,%edi
+80102369:	eb 0c                	jmp    80102377 <iput+0x147>
+8010236b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010236f:	90                   	nop
+80102370:	83 c6 04             	add    $0x4,%esi
+80102373:	39 f7                	cmp    %esi,%edi
+80102375:	74 15                	je     8010238c <iput+0x15c>
+      if(a[j])
+80102377:	8b 16                	mov    (%esi),%edx
+80102379:	85 d2                	test   %edx,%edx
+8010237b:	74 f3                	je     80102370 <iput+0x140>
+        bfree(ip->dev, a[j] & ~UNWRITTEN);
+8010237d:	8b 03                	mov    (%ebx),%eax
+8010237f:	81 e2 ff ff ff 7f    	and    $0x7fffffff,%edx
+80102385:	e8 b6 f5 ff ff       	call   80101940 <bfree>
+8010238a:	eb e4                	jmp    80102370 <iput+0x140>
+    brelse(bp);
+8010238c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010238f:	83 ec 0c             	sub    $0xc,%esp
+80102392:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102395:	50                   	push   %eax
+80102396:	e8 b5 de ff ff       	call   80100250 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+8010239b:	8b 93 b4 00 00 00    	mov    0xb4(%ebx),%edx
+801023a1:	8b 03                	mov    (%ebx),%eax
+801023a3:	e8 98 f5 ff ff       	call   80101940 <bfree>
+    ip->addrs[NDIRECT] = 0;
+801023a8:	83 c4 10             	add    $0x10,%esp
+801023ab:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+801023b2:	00 00 00 
+801023b5:	e9 75 ff ff ff       	jmp    8010232f <iput+0xff>
+801023ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801023c0 <iunlockput>:
+{
+801023c0:	55                   	push   %ebp
+801023c1:	89 e5                	mov    %esp,%ebp
+801023c3:	56                   	push   %esi
+801023c4:	53                   	push   %ebx
+801023c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801023c8:	85 db                	test   %ebx,%ebx
+801023ca:	74 34                	je     80102400 <iunlockput+0x40>
+801023cc:	83 ec 0c             	sub    $0xc,%esp
+801023cf:	8d 73 0c             	lea    0xc(%ebx),%esi
+801023d2:	56                   	push   %esi
+801023d3:	e8 e8 44 00 00       	call   801068c0 <holdingsleep>
+801023d8:	83 c4 10             	add    $0x10,%esp
+801023db:	85 c0                	test   %eax,%eax
+801023dd:	74 21                	je     80102400 <iunlockput+0x40>
+801023df:	8b 43 08             	mov    0x8(%ebx),%eax
+801023e2:	85 c0                	test   %eax,%eax
+801023e4:	7e 1a                	jle    80102400 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+801023e6:	83 ec 0c             	sub    $0xc,%esp
+801023e9:	56                   	push   %esi
+801023ea:	e8 81 44 00 00       	call   80106870 <releasesleep>
+  iput(ip);
+801023ef:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801023f2:	83 c4 10             	add    $0x10,%esp
+}
+801023f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801023f8:	5b                   	pop    %ebx
+801023f9:	5e                   	pop    %esi
+801023fa:	5d                   	pop    %ebp
+  iput(ip);
+801023fb:	e9 30 fe ff ff       	jmp    80102230 <iput>
+    panic("iunlock");
+80102400:	83 ec 0c             	sub    $0xc,%esp
+80102403:	68 c9 b3 10 80       	push   $0x8010b3c9
+80102408:	e8 d3 df ff ff       	call   801003e0 <panic>
+8010240d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102410 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80102410:	55                   	push   %ebp
+80102411:	89 e5                	mov    %esp,%ebp
+80102413:	8b 55 08             	mov    0x8(%ebp),%edx
+80102416:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102419:	8b 0a                	mov    (%edx),%ecx
+8010241b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+8010241e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102421:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102424:	0f b7 4a 78          	movzwl 0x78(%edx),%ecx
+80102428:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+8010242b:	0f b7 4a 7e          	movzwl 0x7e(%edx),%ecx
+8010242f:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102433:	8b 92 80 00 00 00    	mov    0x80(%edx),%edx
+80102439:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010243c:	5d                   	pop    %ebp
+8010243d:	c3                   	ret
+8010243e:	66 90                	xchg   %ax,%ax
+
+80102440 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80102440:	55                   	push   %ebp
+80102441:	89 e5                	mov    %esp,%ebp
+80102443:	57                   	push   %edi
+80102444:	56                   	push   %esi
+80102445:	53                   	push   %ebx
+80102446:	83 ec 2c             	sub    $0x2c,%esp
+80102449:	8b 45 08             	mov    0x8(%ebp),%eax
+8010244c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010244f:	8b 75 10             	mov    0x10(%ebp),%esi
+80102452:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  uint tot, m, addr;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80102455:	0f b7 40 78          	movzwl 0x78(%eax),%eax
+{
+80102459:	89 7d e0             	mov    %edi,-0x20(%ebp)
+8010245c:	8b 7d 14             	mov    0x14(%ebp),%edi
+8010245f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  if(ip->type == T_DEV){
+80102462:	66 83 f8 03          	cmp    $0x3,%ax
+80102466:	0f 84 f4 00 00 00    	je     80102560 <readi+0x120>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+8010246c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+8010246f:	8b 8f 80 00 00 00    	mov    0x80(%edi),%ecx
+80102475:	39 f1                	cmp    %esi,%ecx
+80102477:	0f 82 2f 01 00 00    	jb     801025ac <readi+0x16c>
+8010247d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102480:	31 d2                	xor    %edx,%edx
+80102482:	01 f3                	add    %esi,%ebx
+80102484:	0f 92 c2             	setb   %dl
+80102487:	89 d7                	mov    %edx,%edi
+80102489:	85 ff                	test   %edi,%edi
+8010248b:	0f 85 1b 01 00 00    	jne    801025ac <readi+0x16c>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+80102491:	89 ca                	mov    %ecx,%edx
+80102493:	29 f2                	sub    %esi,%edx
+80102495:	39 d9                	cmp    %ebx,%ecx
+80102497:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010249a:	0f 42 da             	cmovb  %edx,%ebx
+    }
+    bp = bread(ip->dev, addr);
+    memmove(dst, bp->data + off%BSIZE, m);
+    brelse(bp);
+  }
+  return n;
+8010249d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+801024a0:	66 83 f8 02          	cmp    $0x2,%ax
+801024a4:	75 09                	jne    801024af <readi+0x6f>
+801024a6:	83 f9 34             	cmp    $0x34,%ecx
+801024a9:	0f 86 d9 00 00 00    	jbe    80102588 <readi+0x148>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801024af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801024b2:	85 c0                	test   %eax,%eax
+801024b4:	0f 84 9b 00 00 00    	je     80102555 <readi+0x115>
+801024ba:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+801024bd:	eb 4a                	jmp    80102509 <readi+0xc9>
+801024bf:	90                   	nop
+    bp = bread(ip->dev, addr);
+801024c0:	83 ec 08             	sub    $0x8,%esp
+801024c3:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801024c6:	01 df                	add    %ebx,%edi
+801024c8:	01 de                	add    %ebx,%esi
+    bp = bread(ip->dev, addr);
+801024ca:	50                   	push   %eax
+801024cb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801024ce:	ff 30                	push   (%eax)
+801024d0:	e8 bb dc ff ff       	call   80100190 <bread>
+    memmove(dst, bp->data + off%BSIZE, m);
+801024d5:	83 c4 0c             	add    $0xc,%esp
+801024d8:	53                   	push   %ebx
+801024d9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+    bp = bread(ip->dev, addr);
+801024dc:	89 c1                	mov    %eax,%ecx
+    memmove(dst, bp->data + off%BSIZE, m);
+801024de:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+801024e1:	8d 84 10 84 00 00 00 	lea    0x84(%eax,%edx,1),%eax
+801024e8:	50                   	push   %eax
+801024e9:	ff 75 e0             	push   -0x20(%ebp)
+801024ec:	e8 4f 4e 00 00       	call   80107340 <memmove>
+    brelse(bp);
+801024f1:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801024f4:	89 0c 24             	mov    %ecx,(%esp)
+801024f7:	e8 54 dd ff ff       	call   80100250 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801024fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801024ff:	01 5d e0             	add    %ebx,-0x20(%ebp)
+    brelse(bp);
+80102502:	83 c4 10             	add    $0x10,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102505:	39 c7                	cmp    %eax,%edi
+80102507:	73 49                	jae    80102552 <readi+0x112>
+    addr = bmap(ip, off/BSIZE);
+80102509:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010250c:	89 f2                	mov    %esi,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010250e:	bb 00 02 00 00       	mov    $0x200,%ebx
+    addr = bmap(ip, off/BSIZE);
+80102513:	c1 ea 09             	shr    $0x9,%edx
+80102516:	e8 15 f6 ff ff       	call   80101b30 <bmap>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010251b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010251e:	89 f2                	mov    %esi,%edx
+80102520:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+80102526:	29 d3                	sub    %edx,%ebx
+80102528:	29 f9                	sub    %edi,%ecx
+8010252a:	39 cb                	cmp    %ecx,%ebx
+8010252c:	0f 47 d9             	cmova  %ecx,%ebx
+    if(addr & UNWRITTEN){
+8010252f:	85 c0                	test   %eax,%eax
+80102531:	79 8d                	jns    801024c0 <readi+0x80>
+      memset(dst, 0, m);
+80102533:	83 ec 04             	sub    $0x4,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102536:	01 df                	add    %ebx,%edi
+80102538:	01 de                	add    %ebx,%esi
+      memset(dst, 0, m);
+8010253a:	53                   	push   %ebx
+8010253b:	6a 00                	push   $0x0
+8010253d:	ff 75 e0             	push   -0x20(%ebp)
+80102540:	e8 6b 4d 00 00       	call   801072b0 <memset>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102545:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102548:	01 5d e0             	add    %ebx,-0x20(%ebp)
+      continue;
+8010254b:	83 c4 10             	add    $0x10,%esp
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+8010254e:	39 c7                	cmp    %eax,%edi
+80102550:	72 b7                	jb     80102509 <readi+0xc9>
+80102552:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+}
+80102555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102558:	89 d8                	mov    %ebx,%eax
+8010255a:	5b                   	pop    %ebx
+8010255b:	5e                   	pop    %esi
+8010255c:	5f                   	pop    %edi
+8010255d:	5d                   	pop    %ebp
+8010255e:	c3                   	ret
+8010255f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80102560:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102563:	0f bf 40 7a          	movswl 0x7a(%eax),%eax
+80102567:	66 83 f8 09          	cmp    $0x9,%ax
+8010256b:	77 3f                	ja     801025ac <readi+0x16c>
+8010256d:	8b 04 c5 e0 41 11 80 	mov    -0x7feebe20(,%eax,8),%eax
+80102574:	85 c0                	test   %eax,%eax
+80102576:	74 34                	je     801025ac <readi+0x16c>
+    return devsw[ip->major].read(ip, dst, n);
+80102578:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+8010257b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010257e:	5b                   	pop    %ebx
+8010257f:	5e                   	pop    %esi
+80102580:	5f                   	pop    %edi
+80102581:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+80102582:	ff e0                	jmp    *%eax
+80102584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    memmove(dst, (char*)ip->addrs + off, n);
+80102588:	83 ec 04             	sub    $0x4,%esp
+8010258b:	53                   	push   %ebx
+8010258c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010258f:	8d 84 30 84 00 00 00 	lea    0x84(%eax,%esi,1),%eax
+80102596:	50                   	push   %eax
+80102597:	ff 75 e0             	push   -0x20(%ebp)
+8010259a:	e8 a1 4d 00 00       	call   80107340 <memmove>
+    return n;
+8010259f:	83 c4 10             	add    $0x10,%esp
+}
+801025a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801025a5:	89 d8                	mov    %ebx,%eax
+801025a7:	5b                   	pop    %ebx
+801025a8:	5e                   	pop    %esi
+801025a9:	5f                   	pop    %edi
+801025aa:	5d                   	pop    %ebp
+801025ab:	c3                   	ret
+      return -1;
+801025ac:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801025b1:	eb a2                	jmp    80102555 <readi+0x115>
+801025b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801025c0 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+801025c0:	55                   	push   %ebp
+801025c1:	89 e5                	mov    %esp,%ebp
+801025c3:	57                   	push   %edi
+801025c4:	56                   	push   %esi
+801025c5:	53                   	push   %ebx
+801025c6:	83 ec 2c             	sub    $0x2c,%esp
+801025c9:	8b 45 08             	mov    0x8(%ebp),%eax
+801025cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801025cf:	8b 75 10             	mov    0x10(%ebp),%esi
+801025d2:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  uint tot, m, bn, nbn, addr;
+  int update;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+801025d5:	0f b7 50 78          	movzwl 0x78(%eax),%edx
+{
+801025d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+801025dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801025df:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  if(ip->type == T_DEV){
+801025e2:	66 83 fa 03          	cmp    $0x3,%dx
+801025e6:	0f 84 a4 01 00 00    	je     80102790 <writei+0x1d0>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+801025ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801025ef:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+801025f5:	39 f0                	cmp    %esi,%eax
+801025f7:	0f 82 5d 02 00 00    	jb     8010285a <writei+0x29a>
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+801025fd:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102600:	01 f3                	add    %esi,%ebx
+80102602:	0f 82 52 02 00 00    	jb     8010285a <writei+0x29a>
+80102608:	81 fb 00 18 01 00    	cmp    $0x11800,%ebx
+8010260e:	0f 87 46 02 00 00    	ja     8010285a <writei+0x29a>
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+80102614:	83 f8 34             	cmp    $0x34,%eax
+80102617:	77 0a                	ja     80102623 <writei+0x63>
+80102619:	66 83 fa 02          	cmp    $0x2,%dx
+8010261d:	0f 84 dd 01 00 00    	je     80102800 <writei+0x240>
+
+  // Blocks from nbn on are past the end of the file and have no
+  // disk block yet. Allocate all the ones this write reaches in
+  // one go; since they're new, there's nothing to read back.
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+  if(n > 0)
+80102623:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102626:	85 d2                	test   %edx,%edx
+80102628:	75 0e                	jne    80102638 <writei+0x78>
+    ip->size = off;
+    update = 1;
+  }
+  if(update)
+    iupdate(ip);
+  return n;
+8010262a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+8010262d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102630:	5b                   	pop    %ebx
+80102631:	5e                   	pop    %esi
+80102632:	5f                   	pop    %edi
+80102633:	5d                   	pop    %ebp
+80102634:	c3                   	ret
+80102635:	8d 76 00             	lea    0x0(%esi),%esi
+    bmapalloc(ip, nbn, (off + n - 1) / BSIZE + 1, 0);
+80102638:	8d 4b ff             	lea    -0x1(%ebx),%ecx
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+8010263b:	05 ff 01 00 00       	add    $0x1ff,%eax
+    bmapalloc(ip, nbn, (off + n - 1) / BSIZE + 1, 0);
+80102640:	89 cb                	mov    %ecx,%ebx
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+80102642:	c1 e8 09             	shr    $0x9,%eax
+    bmapalloc(ip, nbn, (off + n - 1) / BSIZE + 1, 0);
+80102645:	c1 eb 09             	shr    $0x9,%ebx
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+80102648:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    bmapalloc(ip, nbn, (off + n - 1) / BSIZE + 1, 0);
+8010264b:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  if(bn >= end)
+8010264e:	39 c8                	cmp    %ecx,%eax
+80102650:	73 12                	jae    80102664 <writei+0xa4>
+80102652:	83 ec 0c             	sub    $0xc,%esp
+80102655:	89 c2                	mov    %eax,%edx
+80102657:	6a 00                	push   $0x0
+80102659:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010265c:	e8 3f f6 ff ff       	call   80101ca0 <bmapalloc.part.0>
+80102661:	83 c4 10             	add    $0x10,%esp
+{
+80102664:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+8010266b:	31 ff                	xor    %edi,%edi
+8010266d:	eb 67                	jmp    801026d6 <writei+0x116>
+8010266f:	90                   	nop
+      bp = bnew(ip->dev, addr);
+80102670:	83 ec 08             	sub    $0x8,%esp
+80102673:	50                   	push   %eax
+80102674:	52                   	push   %edx
+80102675:	e8 56 db ff ff       	call   801001d0 <bnew>
+8010267a:	83 c4 10             	add    $0x10,%esp
+8010267d:	89 c3                	mov    %eax,%ebx
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010267f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102682:	89 f0                	mov    %esi,%eax
+80102684:	ba 00 02 00 00       	mov    $0x200,%edx
+80102689:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010268e:	29 f9                	sub    %edi,%ecx
+80102690:	29 c2                	sub    %eax,%edx
+    memmove(bp->data + off%BSIZE, src, m);
+80102692:	8d 84 03 84 00 00 00 	lea    0x84(%ebx,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102699:	39 ca                	cmp    %ecx,%edx
+8010269b:	0f 47 d1             	cmova  %ecx,%edx
+    memmove(bp->data + off%BSIZE, src, m);
+8010269e:	83 ec 04             	sub    $0x4,%esp
+801026a1:	52                   	push   %edx
+801026a2:	89 55 d8             	mov    %edx,-0x28(%ebp)
+801026a5:	ff 75 dc             	push   -0x24(%ebp)
+801026a8:	50                   	push   %eax
+801026a9:	e8 92 4c 00 00       	call   80107340 <memmove>
+    log_write(bp);
+801026ae:	89 1c 24             	mov    %ebx,(%esp)
+801026b1:	e8 da 16 00 00       	call   80103d90 <log_write>
+    brelse(bp);
+801026b6:	89 1c 24             	mov    %ebx,(%esp)
+801026b9:	e8 92 db ff ff       	call   80100250 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801026be:	8b 55 d8             	mov    -0x28(%ebp),%edx
+801026c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801026c4:	83 c4 10             	add    $0x10,%esp
+801026c7:	01 55 dc             	add    %edx,-0x24(%ebp)
+801026ca:	01 d7                	add    %edx,%edi
+801026cc:	01 d6                	add    %edx,%esi
+801026ce:	39 cf                	cmp    %ecx,%edi
+801026d0:	0f 83 ea 00 00 00    	jae    801027c0 <writei+0x200>
+    bn = off/BSIZE;
+801026d6:	89 f3                	mov    %esi,%ebx
+    addr = bmap(ip, bn);
+801026d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    bn = off/BSIZE;
+801026db:	c1 eb 09             	shr    $0x9,%ebx
+    addr = bmap(ip, bn);
+801026de:	89 da                	mov    %ebx,%edx
+801026e0:	e8 4b f4 ff ff       	call   80101b30 <bmap>
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+801026e5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    if(addr & UNWRITTEN){
+801026e8:	85 c0                	test   %eax,%eax
+801026ea:	78 24                	js     80102710 <writei+0x150>
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+801026ec:	8b 11                	mov    (%ecx),%edx
+    } else if(bn >= nbn)
+801026ee:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+801026f1:	39 cb                	cmp    %ecx,%ebx
+801026f3:	0f 83 77 ff ff ff    	jae    80102670 <writei+0xb0>
+      bp = bread(ip->dev, addr);
+801026f9:	83 ec 08             	sub    $0x8,%esp
+801026fc:	50                   	push   %eax
+801026fd:	52                   	push   %edx
+801026fe:	e8 8d da ff ff       	call   80100190 <bread>
+80102703:	83 c4 10             	add    $0x10,%esp
+80102706:	89 c3                	mov    %eax,%ebx
+80102708:	e9 72 ff ff ff       	jmp    8010267f <writei+0xbf>
+8010270d:	8d 76 00             	lea    0x0(%esi),%esi
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80102710:	8b 01                	mov    (%ecx),%eax
+  if(bn < NDIRECT){
+80102712:	83 fb 0b             	cmp    $0xb,%ebx
+80102715:	77 39                	ja     80102750 <writei+0x190>
+    ip->addrs[bn] &= ~UNWRITTEN;
+80102717:	8d 43 20             	lea    0x20(%ebx),%eax
+8010271a:	8b 5c 81 04          	mov    0x4(%ecx,%eax,4),%ebx
+8010271e:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+80102721:	81 e3 ff ff ff 7f    	and    $0x7fffffff,%ebx
+80102727:	89 5c 81 04          	mov    %ebx,0x4(%ecx,%eax,4)
+      bp = bnew(ip->dev, bmapwritten(ip, bn));
+8010272b:	83 ec 08             	sub    $0x8,%esp
+8010272e:	53                   	push   %ebx
+8010272f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102732:	ff 30                	push   (%eax)
+80102734:	e8 97 da ff ff       	call   801001d0 <bnew>
+      update = 1;
+80102739:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+80102740:	83 c4 10             	add    $0x10,%esp
+      bp = bnew(ip->dev, bmapwritten(ip, bn));
+80102743:	89 c3                	mov    %eax,%ebx
+      update = 1;
+80102745:	e9 35 ff ff ff       	jmp    8010267f <writei+0xbf>
+8010274a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80102750:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102753:	83 ec 08             	sub    $0x8,%esp
+80102756:	ff b1 b4 00 00 00    	push   0xb4(%ecx)
+8010275c:	50                   	push   %eax
+8010275d:	e8 2e da ff ff       	call   80100190 <bread>
+  a[bn - NDIRECT] &= ~UNWRITTEN;
+80102762:	8d 54 98 54          	lea    0x54(%eax,%ebx,4),%edx
+80102766:	8b 1a                	mov    (%edx),%ebx
+80102768:	81 e3 ff ff ff 7f    	and    $0x7fffffff,%ebx
+8010276e:	89 1a                	mov    %ebx,(%edx)
+  log_write(bp);
+80102770:	89 04 24             	mov    %eax,(%esp)
+80102773:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102776:	e8 15 16 00 00       	call   80103d90 <log_write>
+  brelse(bp);
+8010277b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+8010277e:	89 04 24             	mov    %eax,(%esp)
+80102781:	e8 ca da ff ff       	call   80100250 <brelse>
+  return addr;
+80102786:	83 c4 10             	add    $0x10,%esp
+80102789:	eb a0                	jmp    8010272b <writei+0x16b>
+8010278b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010278f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80102790:	0f bf 40 7a          	movswl 0x7a(%eax),%eax
+80102794:	66 83 f8 09          	cmp    $0x9,%ax
+80102798:	0f 87 bc 00 00 00    	ja     8010285a <writei+0x29a>
+8010279e:	8b 04 c5 e4 41 11 80 	mov    -0x7feebe1c(,%eax,8),%eax
+801027a5:	85 c0                	test   %eax,%eax
+801027a7:	0f 84 ad 00 00 00    	je     8010285a <writei+0x29a>
+    return devsw[ip->major].write(ip, src, n);
+801027ad:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+801027b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027b3:	5b                   	pop    %ebx
+801027b4:	5e                   	pop    %esi
+801027b5:	5f                   	pop    %edi
+801027b6:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+801027b7:	ff e0                	jmp    *%eax
+801027b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(n > 0 && off > ip->size){
+801027c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801027c3:	39 b0 80 00 00 00    	cmp    %esi,0x80(%eax)
+801027c9:	72 25                	jb     801027f0 <writei+0x230>
+  if(update)
+801027cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801027ce:	85 c0                	test   %eax,%eax
+801027d0:	0f 84 54 fe ff ff    	je     8010262a <writei+0x6a>
+    iupdate(ip);
+801027d6:	83 ec 0c             	sub    $0xc,%esp
+801027d9:	ff 75 e4             	push   -0x1c(%ebp)
+801027dc:	e8 6f f8 ff ff       	call   80102050 <iupdate>
+801027e1:	83 c4 10             	add    $0x10,%esp
+801027e4:	e9 41 fe ff ff       	jmp    8010262a <writei+0x6a>
+801027e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    ip->size = off;
+801027f0:	89 b0 80 00 00 00    	mov    %esi,0x80(%eax)
+  if(update)
+801027f6:	eb de                	jmp    801027d6 <writei+0x216>
+801027f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801027ff:	90                   	nop
+    if(off + n <= MAXINLINE){
+80102800:	83 fb 34             	cmp    $0x34,%ebx
+80102803:	76 15                	jbe    8010281a <writei+0x25a>
+    iuninline(ip);
+80102805:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102808:	89 f8                	mov    %edi,%eax
+8010280a:	e8 01 f6 ff ff       	call   80101e10 <iuninline>
+  nbn = (ip->size + BSIZE - 1) / BSIZE;
+8010280f:	8b 87 80 00 00 00    	mov    0x80(%edi),%eax
+80102815:	e9 09 fe ff ff       	jmp    80102623 <writei+0x63>
+      memmove((char*)ip->addrs + off, src, n);
+8010281a:	83 ec 04             	sub    $0x4,%esp
+8010281d:	ff 75 e0             	push   -0x20(%ebp)
+80102820:	ff 75 dc             	push   -0x24(%ebp)
+80102823:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102826:	8d 84 37 84 00 00 00 	lea    0x84(%edi,%esi,1),%eax
+8010282d:	50                   	push   %eax
+8010282e:	e8 0d 4b 00 00       	call   80107340 <memmove>
+      if(off + n > ip->size)
+80102833:	83 c4 10             	add    $0x10,%esp
+80102836:	39 9f 80 00 00 00    	cmp    %ebx,0x80(%edi)
+8010283c:	73 06                	jae    80102844 <writei+0x284>
+        ip->size = off + n;
+8010283e:	89 9f 80 00 00 00    	mov    %ebx,0x80(%edi)
+      iupdate(ip);
+80102844:	83 ec 0c             	sub    $0xc,%esp
+80102847:	ff 75 e4             	push   -0x1c(%ebp)
+8010284a:	e8 01 f8 ff ff       	call   80102050 <iupdate>
+      return n;
+8010284f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102852:	83 c4 10             	add    $0x10,%esp
+80102855:	e9 d3 fd ff ff       	jmp    8010262d <writei+0x6d>
+      return -1;
+8010285a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010285f:	e9 c9 fd ff ff       	jmp    8010262d <writei+0x6d>
+80102864:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010286b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010286f:	90                   	nop
+
+80102870 <reservei>:
+// marked UNWRITTEN, so they cost no zeroing now and read as
+// zeroes until writei() fills them.
+// Caller must hold ip->lock and be inside a transaction.
+int
+reservei(struct inode *ip, uint off, uint n)
+{
+80102870:	55                   	push   %ebp
+80102871:	89 e5                	mov    %esp,%ebp
+80102873:	56                   	push   %esi
+80102874:	53                   	push   %ebx
+80102875:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint end;
+
+  if(ip->type != T_FILE)
+80102878:	66 83 7e 78 02       	cmpw   $0x2,0x78(%esi)
+8010287d:	0f 85 ad 00 00 00    	jne    80102930 <reservei+0xc0>
+    return -1;
+  if(off + n < off || off + n > MAXFILE*BSIZE)
+80102883:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80102886:	03 5d 10             	add    0x10(%ebp),%ebx
+80102889:	0f 82 a1 00 00 00    	jb     80102930 <reservei+0xc0>
+8010288f:	81 fb 00 18 01 00    	cmp    $0x11800,%ebx
+80102895:	0f 87 95 00 00 00    	ja     80102930 <reservei+0xc0>
+    return -1;
+  end = off + n;
+  if(end <= ip->size)
+8010289b:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+801028a1:	39 da                	cmp    %ebx,%edx
+801028a3:	73 51                	jae    801028f6 <reservei+0x86>
+  return ip->type == T_FILE && ip->size <= MAXINLINE;
+801028a5:	83 fa 34             	cmp    $0x34,%edx
+801028a8:	77 12                	ja     801028bc <reservei+0x4c>
+    return 0;
+
+  if(isinline(ip)){
+    if(end <= MAXINLINE){
+801028aa:	83 fb 34             	cmp    $0x34,%ebx
+801028ad:	76 51                	jbe    80102900 <reservei+0x90>
+      memset((char*)ip->addrs + ip->size, 0, end - ip->size);
+      ip->size = end;
+      iupdate(ip);
+      return 0;
+    }
+    iuninline(ip);
+801028af:	89 f0                	mov    %esi,%eax
+801028b1:	e8 5a f5 ff ff       	call   80101e10 <iuninline>
+  }
+
+  bmapalloc(ip, (ip->size + BSIZE - 1) / BSIZE, (end + BSIZE - 1) / BSIZE,
+801028b6:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+801028bc:	8d 8b ff 01 00 00    	lea    0x1ff(%ebx),%ecx
+801028c2:	81 c2 ff 01 00 00    	add    $0x1ff,%edx
+801028c8:	c1 e9 09             	shr    $0x9,%ecx
+801028cb:	c1 ea 09             	shr    $0x9,%edx
+  if(bn >= end)
+801028ce:	39 ca                	cmp    %ecx,%edx
+801028d0:	73 12                	jae    801028e4 <reservei+0x74>
+801028d2:	83 ec 0c             	sub    $0xc,%esp
+801028d5:	89 f0                	mov    %esi,%eax
+801028d7:	68 00 00 00 80       	push   $0x80000000
+801028dc:	e8 bf f3 ff ff       	call   80101ca0 <bmapalloc.part.0>
+801028e1:	83 c4 10             	add    $0x10,%esp
+            UNWRITTEN);
+  ip->size = end;
+  iupdate(ip);
+801028e4:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = end;
+801028e7:	89 9e 80 00 00 00    	mov    %ebx,0x80(%esi)
+  iupdate(ip);
+801028ed:	56                   	push   %esi
+801028ee:	e8 5d f7 ff ff       	call   80102050 <iupdate>
+  return 0;
+801028f3:	83 c4 10             	add    $0x10,%esp
+    return 0;
+801028f6:	31 c0                	xor    %eax,%eax
+}
+801028f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801028fb:	5b                   	pop    %ebx
+801028fc:	5e                   	pop    %esi
+801028fd:	5d                   	pop    %ebp
+801028fe:	c3                   	ret
+801028ff:	90                   	nop
+      memset((char*)ip->addrs + ip->size, 0, end - ip->size);
+80102900:	89 d8                	mov    %ebx,%eax
+80102902:	83 ec 04             	sub    $0x4,%esp
+80102905:	29 d0                	sub    %edx,%eax
+80102907:	50                   	push   %eax
+80102908:	8d 84 16 84 00 00 00 	lea    0x84(%esi,%edx,1),%eax
+8010290f:	6a 00                	push   $0x0
+80102911:	50                   	push   %eax
+80102912:	e8 99 49 00 00       	call   801072b0 <memset>
+      ip->size = end;
+80102917:	89 9e 80 00 00 00    	mov    %ebx,0x80(%esi)
+      iupdate(ip);
+8010291d:	89 34 24             	mov    %esi,(%esp)
+80102920:	e8 2b f7 ff ff       	call   80102050 <iupdate>
+      return 0;
+80102925:	83 c4 10             	add    $0x10,%esp
+80102928:	eb cc                	jmp    801028f6 <reservei+0x86>
+8010292a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80102930:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102935:	eb c1                	jmp    801028f8 <reservei+0x88>
+80102937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010293e:	66 90                	xchg   %ax,%ax
+
+80102940 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80102940:	55                   	push   %ebp
+80102941:	89 e5                	mov    %esp,%ebp
+80102943:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80102946:	6a 0e                	push   $0xe
+80102948:	ff 75 0c             	push   0xc(%ebp)
+8010294b:	ff 75 08             	push   0x8(%ebp)
+8010294e:	e8 5d 4a 00 00       	call   801073b0 <strncmp>
+}
+80102953:	c9                   	leave
+80102954:	c3                   	ret
+80102955:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010295c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102960 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80102960:	55                   	push   %ebp
+80102961:	89 e5                	mov    %esp,%ebp
+80102963:	57                   	push   %edi
+80102964:	56                   	push   %esi
+80102965:	53                   	push   %ebx
+80102966:	83 ec 1c             	sub    $0x1c,%esp
+80102969:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+8010296c:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80102971:	0f 85 95 00 00 00    	jne    80102a0c <dirlookup+0xac>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102977:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+8010297d:	31 ff                	xor    %edi,%edi
+8010297f:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102982:	85 d2                	test   %edx,%edx
+80102984:	74 46                	je     801029cc <dirlookup+0x6c>
+80102986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010298d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102990:	6a 10                	push   $0x10
+80102992:	57                   	push   %edi
+80102993:	56                   	push   %esi
+80102994:	53                   	push   %ebx
+80102995:	e8 a6 fa ff ff       	call   80102440 <readi>
+8010299a:	83 c4 10             	add    $0x10,%esp
+8010299d:	83 f8 10             	cmp    $0x10,%eax
+801029a0:	75 5d                	jne    801029ff <dirlookup+0x9f>
+      panic("dirlookup read");
+    if(de.inum == 0)
+801029a2:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801029a7:	74 18                	je     801029c1 <dirlookup+0x61>
+  return strncmp(s, t, DIRSIZ);
+801029a9:	83 ec 04             	sub    $0x4,%esp
+801029ac:	8d 45 da             	lea    -0x26(%ebp),%eax
+801029af:	6a 0e                	push   $0xe
+801029b1:	50                   	push   %eax
+801029b2:	ff 75 0c             	push   0xc(%ebp)
+801029b5:	e8 f6 49 00 00       	call   801073b0 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+801029ba:	83 c4 10             	add    $0x10,%esp
+801029bd:	85 c0                	test   %eax,%eax
+801029bf:	74 1f                	je     801029e0 <dirlookup+0x80>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801029c1:	83 c7 10             	add    $0x10,%edi
+801029c4:	3b bb 80 00 00 00    	cmp    0x80(%ebx),%edi
+801029ca:	72 c4                	jb     80102990 <dirlookup+0x30>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+801029cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801029cf:	31 c0                	xor    %eax,%eax
+}
+801029d1:	5b                   	pop    %ebx
+801029d2:	5e                   	pop    %esi
+801029d3:	5f                   	pop    %edi
+801029d4:	5d                   	pop    %ebp
+801029d5:	c3                   	ret
+801029d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801029dd:	8d 76 00             	lea    0x0(%esi),%esi
+      if(poff)
+801029e0:	8b 45 10             	mov    0x10(%ebp),%eax
+801029e3:	85 c0                	test   %eax,%eax
+801029e5:	74 05                	je     801029ec <dirlookup+0x8c>
+        *poff = off;
+801029e7:	8b 45 10             	mov    0x10(%ebp),%eax
+801029ea:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+801029ec:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+801029f0:	8b 03                	mov    (%ebx),%eax
+801029f2:	e8 c9 ef ff ff       	call   801019c0 <iget>
+}
+801029f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801029fa:	5b                   	pop    %ebx
+801029fb:	5e                   	pop    %esi
+801029fc:	5f                   	pop    %edi
+801029fd:	5d                   	pop    %ebp
+801029fe:	c3                   	ret
+      panic("dirlookup read");
+801029ff:	83 ec 0c             	sub    $0xc,%esp
+80102a02:	68 e3 b3 10 80       	push   $0x8010b3e3
+80102a07:	e8 d4 d9 ff ff       	call   801003e0 <panic>
+    panic("dirlookup not DIR");
+80102a0c:	83 ec 0c             	sub    $0xc,%esp
+80102a0f:	68 d1 b3 10 80       	push   $0x8010b3d1
+80102a14:	e8 c7 d9 ff ff       	call   801003e0 <panic>
+80102a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102a20 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80102a20:	55                   	push   %ebp
+80102a21:	89 e5                	mov    %esp,%ebp
+80102a23:	57                   	push   %edi
+80102a24:	56                   	push   %esi
+80102a25:	53                   	push   %ebx
+80102a26:	89 c3                	mov    %eax,%ebx
+80102a28:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+80102a2b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+80102a2e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80102a31:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80102a34:	0f 84 54 01 00 00    	je     80102b8e <namex+0x16e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+80102a3a:	e8 f1 25 00 00       	call   80105030 <myproc>
+80102a3f:	8b b0 d4 00 00 00    	mov    0xd4(%eax),%esi
+80102a45:	b8 01 00 00 00       	mov    $0x1,%eax
+80102a4a:	f0 0f c1 46 08       	lock xadd %eax,0x8(%esi)
+  return ip;
+80102a4f:	eb 0a                	jmp    80102a5b <namex+0x3b>
+80102a51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80102a58:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80102a5b:	0f b6 03             	movzbl (%ebx),%eax
+80102a5e:	3c 2f                	cmp    $0x2f,%al
+80102a60:	74 f6                	je     80102a58 <namex+0x38>
+  if(*path == 0)
+80102a62:	84 c0                	test   %al,%al
+80102a64:	0f 84 06 01 00 00    	je     80102b70 <namex+0x150>
+  while(*path != '/' && *path != 0)
+80102a6a:	0f b6 03             	movzbl (%ebx),%eax
+80102a6d:	84 c0                	test   %al,%al
+80102a6f:	0f 84 10 01 00 00    	je     80102b85 <namex+0x165>
+80102a75:	89 df                	mov    %ebx,%edi
+80102a77:	3c 2f                	cmp    $0x2f,%al
+80102a79:	0f 84 06 01 00 00    	je     80102b85 <namex+0x165>
+80102a7f:	90                   	nop
+80102a80:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80102a84:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80102a87:	3c 2f                	cmp    $0x2f,%al
+80102a89:	74 04                	je     80102a8f <namex+0x6f>
+80102a8b:	84 c0                	test   %al,%al
+80102a8d:	75 f1                	jne    80102a80 <namex+0x60>
+  len = path - s;
+80102a8f:	89 f8                	mov    %edi,%eax
+80102a91:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+80102a93:	83 f8 0d             	cmp    $0xd,%eax
+80102a96:	0f 8e ac 00 00 00    	jle    80102b48 <namex+0x128>
+    memmove(name, s, DIRSIZ);
+80102a9c:	83 ec 04             	sub    $0x4,%esp
+80102a9f:	6a 0e                	push   $0xe
+80102aa1:	53                   	push   %ebx
+    path++;
+80102aa2:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+80102aa4:	ff 75 e4             	push   -0x1c(%ebp)
+80102aa7:	e8 94 48 00 00       	call   80107340 <memmove>
+80102aac:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80102aaf:	80 3f 2f             	cmpb   $0x2f,(%edi)
+80102ab2:	75 0c                	jne    80102ac0 <namex+0xa0>
+80102ab4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80102ab8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80102abb:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80102abe:	74 f8                	je     80102ab8 <namex+0x98>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+80102ac0:	83 ec 0c             	sub    $0xc,%esp
+80102ac3:	56                   	push   %esi
+80102ac4:	e8 37 f6 ff ff       	call   80102100 <ilock>
+    if(ip->type != T_DIR){
+80102ac9:	83 c4 10             	add    $0x10,%esp
+80102acc:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+80102ad1:	0f 85 cd 00 00 00    	jne    80102ba4 <namex+0x184>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+80102ad7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102ada:	85 c0                	test   %eax,%eax
+80102adc:	74 09                	je     80102ae7 <namex+0xc7>
+80102ade:	80 3b 00             	cmpb   $0x0,(%ebx)
+80102ae1:	0f 84 34 01 00 00    	je     80102c1b <namex+0x1fb>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+80102ae7:	83 ec 04             	sub    $0x4,%esp
+80102aea:	6a 00                	push   $0x0
+80102aec:	ff 75 e4             	push   -0x1c(%ebp)
+80102aef:	56                   	push   %esi
+80102af0:	e8 6b fe ff ff       	call   80102960 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102af5:	8d 56 0c             	lea    0xc(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80102af8:	83 c4 10             	add    $0x10,%esp
+80102afb:	89 c7                	mov    %eax,%edi
+80102afd:	85 c0                	test   %eax,%eax
+80102aff:	0f 84 e1 00 00 00    	je     80102be6 <namex+0x1c6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102b05:	83 ec 0c             	sub    $0xc,%esp
+80102b08:	52                   	push   %edx
+80102b09:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102b0c:	e8 af 3d 00 00       	call   801068c0 <holdingsleep>
+80102b11:	83 c4 10             	add    $0x10,%esp
+80102b14:	85 c0                	test   %eax,%eax
+80102b16:	0f 84 3f 01 00 00    	je     80102c5b <namex+0x23b>
+80102b1c:	8b 56 08             	mov    0x8(%esi),%edx
+80102b1f:	85 d2                	test   %edx,%edx
+80102b21:	0f 8e 34 01 00 00    	jle    80102c5b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102b27:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102b2a:	83 ec 0c             	sub    $0xc,%esp
+80102b2d:	52                   	push   %edx
+80102b2e:	e8 3d 3d 00 00       	call   80106870 <releasesleep>
+  iput(ip);
+80102b33:	89 34 24             	mov    %esi,(%esp)
+80102b36:	89 fe                	mov    %edi,%esi
+80102b38:	e8 f3 f6 ff ff       	call   80102230 <iput>
+80102b3d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80102b40:	e9 16 ff ff ff       	jmp    80102a5b <namex+0x3b>
+80102b45:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80102b48:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102b4b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+80102b4e:	83 ec 04             	sub    $0x4,%esp
+80102b51:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80102b54:	50                   	push   %eax
+80102b55:	53                   	push   %ebx
+    name[len] = 0;
+80102b56:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80102b58:	ff 75 e4             	push   -0x1c(%ebp)
+80102b5b:	e8 e0 47 00 00       	call   80107340 <memmove>
+    name[len] = 0;
+80102b60:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102b63:	83 c4 10             	add    $0x10,%esp
+80102b66:	c6 02 00             	movb   $0x0,(%edx)
+80102b69:	e9 41 ff ff ff       	jmp    80102aaf <namex+0x8f>
+80102b6e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80102b70:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102b73:	85 c0                	test   %eax,%eax
+80102b75:	0f 85 d0 00 00 00    	jne    80102c4b <namex+0x22b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80102b7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102b7e:	89 f0                	mov    %esi,%eax
+80102b80:	5b                   	pop    %ebx
+80102b81:	5e                   	pop    %esi
+80102b82:	5f                   	pop    %edi
+80102b83:	5d                   	pop    %ebp
+80102b84:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80102b85:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102b88:	89 df                	mov    %ebx,%edi
+80102b8a:	31 c0                	xor    %eax,%eax
+80102b8c:	eb c0                	jmp    80102b4e <namex+0x12e>
+    ip = iget(ROOTDEV, ROOTINO);
+80102b8e:	ba 01 00 00 00       	mov    $0x1,%edx
+80102b93:	b8 01 00 00 00       	mov    $0x1,%eax
+80102b98:	e8 23 ee ff ff       	call   801019c0 <iget>
+80102b9d:	89 c6                	mov    %eax,%esi
+80102b9f:	e9 b7 fe ff ff       	jmp    80102a5b <namex+0x3b>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102ba4:	83 ec 0c             	sub    $0xc,%esp
+80102ba7:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102baa:	53                   	push   %ebx
+80102bab:	e8 10 3d 00 00       	call   801068c0 <holdingsleep>
+80102bb0:	83 c4 10             	add    $0x10,%esp
+80102bb3:	85 c0                	test   %eax,%eax
+80102bb5:	0f 84 a0 00 00 00    	je     80102c5b <namex+0x23b>
+80102bbb:	8b 46 08             	mov    0x8(%esi),%eax
+80102bbe:	85 c0                	test   %eax,%eax
+80102bc0:	0f 8e 95 00 00 00    	jle    80102c5b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102bc6:	83 ec 0c             	sub    $0xc,%esp
+80102bc9:	53                   	push   %ebx
+80102bca:	e8 a1 3c 00 00       	call   80106870 <releasesleep>
+  iput(ip);
+80102bcf:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80102bd2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102bd4:	e8 57 f6 ff ff       	call   80102230 <iput>
+      return 0;
+80102bd9:	83 c4 10             	add    $0x10,%esp
+}
+80102bdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bdf:	89 f0                	mov    %esi,%eax
+80102be1:	5b                   	pop    %ebx
+80102be2:	5e                   	pop    %esi
+80102be3:	5f                   	pop    %edi
+80102be4:	5d                   	pop    %ebp
+80102be5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102be6:	83 ec 0c             	sub    $0xc,%esp
+80102be9:	52                   	push   %edx
+80102bea:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102bed:	e8 ce 3c 00 00       	call   801068c0 <holdingsleep>
+80102bf2:	83 c4 10             	add    $0x10,%esp
+80102bf5:	85 c0                	test   %eax,%eax
+80102bf7:	74 62                	je     80102c5b <namex+0x23b>
+80102bf9:	8b 4e 08             	mov    0x8(%esi),%ecx
+80102bfc:	85 c9                	test   %ecx,%ecx
+80102bfe:	7e 5b                	jle    80102c5b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102c00:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102c03:	83 ec 0c             	sub    $0xc,%esp
+80102c06:	52                   	push   %edx
+80102c07:	e8 64 3c 00 00       	call   80106870 <releasesleep>
+  iput(ip);
+80102c0c:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+80102c0f:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80102c11:	e8 1a f6 ff ff       	call   80102230 <iput>
+      return 0;
+80102c16:	83 c4 10             	add    $0x10,%esp
+80102c19:	eb c1                	jmp    80102bdc <namex+0x1bc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102c1b:	83 ec 0c             	sub    $0xc,%esp
+80102c1e:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80102c21:	53                   	push   %ebx
+80102c22:	e8 99 3c 00 00       	call   801068c0 <holdingsleep>
+80102c27:	83 c4 10             	add    $0x10,%esp
+80102c2a:	85 c0                	test   %eax,%eax
+80102c2c:	74 2d                	je     80102c5b <namex+0x23b>
+80102c2e:	8b 7e 08             	mov    0x8(%esi),%edi
+80102c31:	85 ff                	test   %edi,%edi
+80102c33:	7e 26                	jle    80102c5b <namex+0x23b>
+  releasesleep(&ip->lock);
+80102c35:	83 ec 0c             	sub    $0xc,%esp
+80102c38:	53                   	push   %ebx
+80102c39:	e8 32 3c 00 00       	call   80106870 <releasesleep>
+}
+80102c3e:	83 c4 10             	add    $0x10,%esp
+}
+80102c41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c44:	89 f0                	mov    %esi,%eax
+80102c46:	5b                   	pop    %ebx
+80102c47:	5e                   	pop    %esi
+80102c48:	5f                   	pop    %edi
+80102c49:	5d                   	pop    %ebp
+80102c4a:	c3                   	ret
+    iput(ip);
+80102c4b:	83 ec 0c             	sub    $0xc,%esp
+80102c4e:	56                   	push   %esi
+      return 0;
+80102c4f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80102c51:	e8 da f5 ff ff       	call   80102230 <iput>
+    return 0;
+80102c56:	83 c4 10             	add    $0x10,%esp
+80102c59:	eb 81                	jmp    80102bdc <namex+0x1bc>
+    panic("iunlock");
+80102c5b:	83 ec 0c             	sub    $0xc,%esp
+80102c5e:	68 c9 b3 10 80       	push   $0x8010b3c9
+80102c63:	e8 78 d7 ff ff       	call   801003e0 <panic>
+80102c68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c6f:	90                   	nop
+
+80102c70 <dirlink>:
+{
+80102c70:	55                   	push   %ebp
+80102c71:	89 e5                	mov    %esp,%ebp
+80102c73:	57                   	push   %edi
+80102c74:	56                   	push   %esi
+80102c75:	53                   	push   %ebx
+80102c76:	83 ec 20             	sub    $0x20,%esp
+80102c79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80102c7c:	6a 00                	push   $0x0
+80102c7e:	ff 75 0c             	push   0xc(%ebp)
+80102c81:	53                   	push   %ebx
+80102c82:	e8 d9 fc ff ff       	call   80102960 <dirlookup>
+80102c87:	83 c4 10             	add    $0x10,%esp
+80102c8a:	85 c0                	test   %eax,%eax
+80102c8c:	75 72                	jne    80102d00 <dirlink+0x90>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+80102c8e:	8b bb 80 00 00 00    	mov    0x80(%ebx),%edi
+80102c94:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102c97:	85 ff                	test   %edi,%edi
+80102c99:	74 31                	je     80102ccc <dirlink+0x5c>
+80102c9b:	31 ff                	xor    %edi,%edi
+80102c9d:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80102ca0:	eb 11                	jmp    80102cb3 <dirlink+0x43>
+80102ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102ca8:	83 c7 10             	add    $0x10,%edi
+80102cab:	3b bb 80 00 00 00    	cmp    0x80(%ebx),%edi
+80102cb1:	73 19                	jae    80102ccc <dirlink+0x5c>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102cb3:	6a 10                	push   $0x10
+80102cb5:	57                   	push   %edi
+80102cb6:	56                   	push   %esi
+80102cb7:	53                   	push   %ebx
+80102cb8:	e8 83 f7 ff ff       	call   80102440 <readi>
+80102cbd:	83 c4 10             	add    $0x10,%esp
+80102cc0:	83 f8 10             	cmp    $0x10,%eax
+80102cc3:	75 4e                	jne    80102d13 <dirlink+0xa3>
+    if(de.inum == 0)
+80102cc5:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80102cca:	75 dc                	jne    80102ca8 <dirlink+0x38>
+  strncpy(de.name, name, DIRSIZ);
+80102ccc:	83 ec 04             	sub    $0x4,%esp
+80102ccf:	8d 45 da             	lea    -0x26(%ebp),%eax
+80102cd2:	6a 0e                	push   $0xe
+80102cd4:	ff 75 0c             	push   0xc(%ebp)
+80102cd7:	50                   	push   %eax
+80102cd8:	e8 23 47 00 00       	call   80107400 <strncpy>
+  de.inum = inum;
+80102cdd:	8b 45 10             	mov    0x10(%ebp),%eax
+80102ce0:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80102ce4:	6a 10                	push   $0x10
+80102ce6:	57                   	push   %edi
+80102ce7:	56                   	push   %esi
+80102ce8:	53                   	push   %ebx
+80102ce9:	e8 d2 f8 ff ff       	call   801025c0 <writei>
+80102cee:	83 c4 20             	add    $0x20,%esp
+80102cf1:	83 f8 10             	cmp    $0x10,%eax
+80102cf4:	75 2a                	jne    80102d20 <dirlink+0xb0>
+  return 0;
+80102cf6:	31 c0                	xor    %eax,%eax
+}
+80102cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cfb:	5b                   	pop    %ebx
+80102cfc:	5e                   	pop    %esi
+80102cfd:	5f                   	pop    %edi
+80102cfe:	5d                   	pop    %ebp
+80102cff:	c3                   	ret
+    iput(ip);
+80102d00:	83 ec 0c             	sub    $0xc,%esp
+80102d03:	50                   	push   %eax
+80102d04:	e8 27 f5 ff ff       	call   80102230 <iput>
+    return -1;
+80102d09:	83 c4 10             	add    $0x10,%esp
+80102d0c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102d11:	eb e5                	jmp    80102cf8 <dirlink+0x88>
+      panic("dirlink read");
+80102d13:	83 ec 0c             	sub    $0xc,%esp
+80102d16:	68 f2 b3 10 80       	push   $0x8010b3f2
+80102d1b:	e8 c0 d6 ff ff       	call   801003e0 <panic>
+    panic("dirlink");
+80102d20:	83 ec 0c             	sub    $0xc,%esp
+80102d23:	68 5e ba 10 80       	push   $0x8010ba5e
+80102d28:	e8 b3 d6 ff ff       	call   801003e0 <panic>
+80102d2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102d30 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80102d30:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80102d31:	31 d2                	xor    %edx,%edx
+{
+80102d33:	89 e5                	mov    %esp,%ebp
+80102d35:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80102d38:	8b 45 08             	mov    0x8(%ebp),%eax
+80102d3b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+80102d3e:	e8 dd fc ff ff       	call   80102a20 <namex>
+}
+80102d43:	c9                   	leave
+80102d44:	c3                   	ret
+80102d45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102d50 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80102d50:	55                   	push   %ebp
+  return namex(path, 1, name);
+80102d51:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80102d56:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80102d58:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80102d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80102d5e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+80102d5f:	e9 bc fc ff ff       	jmp    80102a20 <namex>
+80102d64:	66 90                	xchg   %ax,%ax
+80102d66:	66 90                	xchg   %ax,%ax
+80102d68:	66 90                	xchg   %ax,%ax
+80102d6a:	66 90                	xchg   %ax,%ax
+80102d6c:	66 90                	xchg   %ax,%ax
+80102d6e:	66 90                	xchg   %ax,%ax
+
+80102d70 <idestart>:
+}
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80102d70:	55                   	push   %ebp
+80102d71:	89 e5                	mov    %esp,%ebp
+80102d73:	57                   	push   %edi
+80102d74:	56                   	push   %esi
+80102d75:	53                   	push   %ebx
+80102d76:	83 ec 0c             	sub    $0xc,%esp
+  if(b == 0)
+80102d79:	85 c0                	test   %eax,%eax
+80102d7b:	0f 84 b7 00 00 00    	je     80102e38 <idestart+0xc8>
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80102d81:	8b 70 08             	mov    0x8(%eax),%esi
+80102d84:	89 c3                	mov    %eax,%ebx
+80102d86:	81 fe cf 07 00 00    	cmp    $0x7cf,%esi
+80102d8c:	0f 87 99 00 00 00    	ja     80102e2b <idestart+0xbb>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102d92:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80102d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d9e:	66 90                	xchg   %ax,%ax
+80102da0:	89 ca                	mov    %ecx,%edx
+80102da2:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102da3:	83 e0 c0             	and    $0xffffffc0,%eax
+80102da6:	3c 40                	cmp    $0x40,%al
+80102da8:	75 f6                	jne    80102da0 <idestart+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102daa:	31 ff                	xor    %edi,%edi
+80102dac:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102db1:	89 f8                	mov    %edi,%eax
+80102db3:	ee                   	out    %al,(%dx)
+80102db4:	b8 01 00 00 00       	mov    $0x1,%eax
+80102db9:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102dbe:	ee                   	out    %al,(%dx)
+80102dbf:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102dc4:	89 f0                	mov    %esi,%eax
+80102dc6:	ee                   	out    %al,(%dx)
+
+  idewait(0);
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+80102dc7:	89 f0                	mov    %esi,%eax
+80102dc9:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102dce:	c1 f8 08             	sar    $0x8,%eax
+80102dd1:	ee                   	out    %al,(%dx)
+80102dd2:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102dd7:	89 f8                	mov    %edi,%eax
+80102dd9:	ee                   	out    %al,(%dx)
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80102dda:	0f b6 43 04          	movzbl 0x4(%ebx),%eax
+80102dde:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102de3:	c1 e0 04             	shl    $0x4,%eax
+80102de6:	83 e0 10             	and    $0x10,%eax
+80102de9:	83 c8 e0             	or     $0xffffffe0,%eax
+80102dec:	ee                   	out    %al,(%dx)
+  if(b->flags & B_DIRTY){
+80102ded:	f6 03 04             	testb  $0x4,(%ebx)
+80102df0:	75 16                	jne    80102e08 <idestart+0x98>
+80102df2:	b8 20 00 00 00       	mov    $0x20,%eax
+80102df7:	89 ca                	mov    %ecx,%edx
+80102df9:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+80102dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102dfd:	5b                   	pop    %ebx
+80102dfe:	5e                   	pop    %esi
+80102dff:	5f                   	pop    %edi
+80102e00:	5d                   	pop    %ebp
+80102e01:	c3                   	ret
+80102e02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102e08:	b8 30 00 00 00       	mov    $0x30,%eax
+80102e0d:	89 ca                	mov    %ecx,%edx
+80102e0f:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+80102e10:	b9 80 00 00 00       	mov    $0x80,%ecx
+    outsl(0x1f0, b->data, BSIZE/4);
+80102e15:	8d b3 84 00 00 00    	lea    0x84(%ebx),%esi
+80102e1b:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102e20:	fc                   	cld
+80102e21:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80102e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e26:	5b                   	pop    %ebx
+80102e27:	5e                   	pop    %esi
+80102e28:	5f                   	pop    %edi
+80102e29:	5d                   	pop    %ebp
+80102e2a:	c3                   	ret
+    panic("incorrect blockno");
+80102e2b:	83 ec 0c             	sub    $0xc,%esp
+80102e2e:	68 5c b4 10 80       	push   $0x8010b45c
+80102e33:	e8 a8 d5 ff ff       	call   801003e0 <panic>
+    panic("idestart");
+80102e38:	83 ec 0c             	sub    $0xc,%esp
+80102e3b:	68 53 b4 10 80       	push   $0x8010b453
+80102e40:	e8 9b d5 ff ff       	call   801003e0 <panic>
+80102e45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102e50 <ideinit>:
+{
+80102e50:	55                   	push   %ebp
+80102e51:	89 e5                	mov    %esp,%ebp
+80102e53:	83 ec 10             	sub    $0x10,%esp
+  initlock(&idelock, "ide");
+80102e56:	68 6e b4 10 80       	push   $0x8010b46e
+80102e5b:	68 80 66 11 80       	push   $0x80116680
+80102e60:	e8 7b 3b 00 00       	call   801069e0 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80102e65:	58                   	pop    %eax
+80102e66:	a1 64 68 11 80       	mov    0x80116864,%eax
+80102e6b:	5a                   	pop    %edx
+80102e6c:	83 e8 01             	sub    $0x1,%eax
+80102e6f:	50                   	push   %eax
+80102e70:	6a 0e                	push   $0xe
+80102e72:	e8 d9 02 00 00       	call   80103150 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102e77:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102e7a:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80102e7f:	90                   	nop
+80102e80:	89 ca                	mov    %ecx,%edx
+80102e82:	ec                   	in     (%dx),%al
+80102e83:	83 e0 c0             	and    $0xffffffc0,%eax
+80102e86:	3c 40                	cmp    $0x40,%al
+80102e88:	75 f6                	jne    80102e80 <ideinit+0x30>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102e8a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80102e8f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102e94:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102e95:	89 ca                	mov    %ecx,%edx
+80102e97:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102e98:	84 c0                	test   %al,%al
+80102e9a:	75 1e                	jne    80102eba <ideinit+0x6a>
+80102e9c:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80102ea1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ead:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i=0; i<1000; i++){
+80102eb0:	83 e9 01             	sub    $0x1,%ecx
+80102eb3:	74 0f                	je     80102ec4 <ideinit+0x74>
+80102eb5:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+80102eb6:	84 c0                	test   %al,%al
+80102eb8:	74 f6                	je     80102eb0 <ideinit+0x60>
+      havedisk1 = 1;
+80102eba:	c7 05 60 66 11 80 01 	movl   $0x1,0x80116660
+80102ec1:	00 00 00 
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102ec4:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102ec9:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102ece:	ee                   	out    %al,(%dx)
+}
+80102ecf:	c9                   	leave
+80102ed0:	c3                   	ret
+80102ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102edf:	90                   	nop
+
+80102ee0 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+80102ee0:	55                   	push   %ebp
+80102ee1:	89 e5                	mov    %esp,%ebp
+80102ee3:	57                   	push   %edi
+80102ee4:	56                   	push   %esi
+80102ee5:	53                   	push   %ebx
+80102ee6:	83 ec 18             	sub    $0x18,%esp
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+80102ee9:	68 80 66 11 80       	push   $0x80116680
+80102eee:	e8 3d 3e 00 00       	call   80106d30 <acquire>
+
+  if((b = idequeue) == 0){
+80102ef3:	8b 1d 64 66 11 80    	mov    0x80116664,%ebx
+80102ef9:	83 c4 10             	add    $0x10,%esp
+80102efc:	85 db                	test   %ebx,%ebx
+80102efe:	74 76                	je     80102f76 <ideintr+0x96>
+    release(&idelock);
+    return;
+  }
+  idequeue = b->qnext;
+80102f00:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  trace(TR_DISKDONE, b->blockno, 0);
+80102f06:	83 ec 04             	sub    $0x4,%esp
+  idequeue = b->qnext;
+80102f09:	a3 64 66 11 80       	mov    %eax,0x80116664
+  trace(TR_DISKDONE, b->blockno, 0);
+80102f0e:	6a 00                	push   $0x0
+80102f10:	ff 73 08             	push   0x8(%ebx)
+80102f13:	6a 08                	push   $0x8
+80102f15:	e8 96 65 00 00       	call   801094b0 <trace>
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+80102f1a:	8b 33                	mov    (%ebx),%esi
+80102f1c:	83 c4 10             	add    $0x10,%esp
+80102f1f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+80102f25:	75 2d                	jne    80102f54 <ideintr+0x74>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f27:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102f2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f30:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80102f31:	89 c1                	mov    %eax,%ecx
+80102f33:	83 e1 c0             	and    $0xffffffc0,%ecx
+80102f36:	80 f9 40             	cmp    $0x40,%cl
+80102f39:	75 f5                	jne    80102f30 <ideintr+0x50>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80102f3b:	a8 21                	test   $0x21,%al
+80102f3d:	75 15                	jne    80102f54 <ideintr+0x74>
+    insl(0x1f0, b->data, BSIZE/4);
+80102f3f:	8d bb 84 00 00 00    	lea    0x84(%ebx),%edi
+  asm volatile("cld; rep insl" :
+80102f45:	b9 80 00 00 00       	mov    $0x80,%ecx
+80102f4a:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102f4f:	fc                   	cld
+80102f50:	f3 6d                	rep insl (%dx),%es:(%edi)
+
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+80102f52:	8b 33                	mov    (%ebx),%esi
+  b->flags &= ~B_DIRTY;
+80102f54:	83 e6 fb             	and    $0xfffffffb,%esi
+  wakeup(b);
+80102f57:	83 ec 0c             	sub    $0xc,%esp
+  b->flags &= ~B_DIRTY;
+80102f5a:	83 ce 02             	or     $0x2,%esi
+80102f5d:	89 33                	mov    %esi,(%ebx)
+  wakeup(b);
+80102f5f:	53                   	push   %ebx
+80102f60:	e8 ab 2a 00 00       	call   80105a10 <wakeup>
+
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+80102f65:	a1 64 66 11 80       	mov    0x80116664,%eax
+80102f6a:	83 c4 10             	add    $0x10,%esp
+80102f6d:	85 c0                	test   %eax,%eax
+80102f6f:	74 05                	je     80102f76 <ideintr+0x96>
+    idestart(idequeue);
+80102f71:	e8 fa fd ff ff       	call   80102d70 <idestart>
+    release(&idelock);
+80102f76:	83 ec 0c             	sub    $0xc,%esp
+80102f79:	68 80 66 11 80       	push   $0x80116680
+80102f7e:	e8 6d 3c 00 00       	call   80106bf0 <release>
+
+  release(&idelock);
+}
+80102f83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f86:	5b                   	pop    %ebx
+80102f87:	5e                   	pop    %esi
+80102f88:	5f                   	pop    %edi
+80102f89:	5d                   	pop    %ebp
+80102f8a:	c3                   	ret
+80102f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f8f:	90                   	nop
+
+80102f90 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80102f90:	55                   	push   %ebp
+80102f91:	89 e5                	mov    %esp,%ebp
+80102f93:	53                   	push   %ebx
+80102f94:	83 ec 10             	sub    $0x10,%esp
+80102f97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct buf **pp;
+
+  if(!holdingsleep(&b->lock))
+80102f9a:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102f9d:	50                   	push   %eax
+80102f9e:	e8 1d 39 00 00       	call   801068c0 <holdingsleep>
+80102fa3:	83 c4 10             	add    $0x10,%esp
+80102fa6:	85 c0                	test   %eax,%eax
+80102fa8:	0f 84 eb 00 00 00    	je     80103099 <iderw+0x109>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+80102fae:	8b 03                	mov    (%ebx),%eax
+80102fb0:	83 e0 06             	and    $0x6,%eax
+80102fb3:	83 f8 02             	cmp    $0x2,%eax
+80102fb6:	0f 84 d0 00 00 00    	je     8010308c <iderw+0xfc>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+80102fbc:	8b 53 04             	mov    0x4(%ebx),%edx
+80102fbf:	85 d2                	test   %edx,%edx
+80102fc1:	74 0d                	je     80102fd0 <iderw+0x40>
+80102fc3:	a1 60 66 11 80       	mov    0x80116660,%eax
+80102fc8:	85 c0                	test   %eax,%eax
+80102fca:	0f 84 af 00 00 00    	je     8010307f <iderw+0xef>
+    panic("iderw: ide disk 1 not present");
+
+  acquire(&idelock);  //DOC:acquire-lock
+80102fd0:	83 ec 0c             	sub    $0xc,%esp
+80102fd3:	68 80 66 11 80       	push   $0x80116680
+80102fd8:	e8 53 3d 00 00       	call   80106d30 <acquire>
+  trace(TR_DISKREQ, b->blockno, (b->flags & B_DIRTY) != 0);
+80102fdd:	8b 03                	mov    (%ebx),%eax
+80102fdf:	83 c4 0c             	add    $0xc,%esp
+80102fe2:	c1 e8 02             	shr    $0x2,%eax
+80102fe5:	83 e0 01             	and    $0x1,%eax
+80102fe8:	50                   	push   %eax
+80102fe9:	ff 73 08             	push   0x8(%ebx)
+80102fec:	6a 07                	push   $0x7
+80102fee:	e8 bd 64 00 00       	call   801094b0 <trace>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80102ff3:	a1 64 66 11 80       	mov    0x80116664,%eax
+80102ff8:	83 c4 10             	add    $0x10,%esp
+  b->qnext = 0;
+80102ffb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80103002:	00 00 00 
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80103005:	85 c0                	test   %eax,%eax
+80103007:	74 6f                	je     80103078 <iderw+0xe8>
+80103009:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103010:	89 c2                	mov    %eax,%edx
+80103012:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80103018:	85 c0                	test   %eax,%eax
+8010301a:	75 f4                	jne    80103010 <iderw+0x80>
+8010301c:	83 ea 80             	sub    $0xffffff80,%edx
+    ;
+  *pp = b;
+8010301f:	89 1a                	mov    %ebx,(%edx)
+
+  // Start disk if necessary.
+  if(idequeue == b)
+80103021:	39 1d 64 66 11 80    	cmp    %ebx,0x80116664
+80103027:	74 3f                	je     80103068 <iderw+0xd8>
+    idestart(b);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103029:	8b 03                	mov    (%ebx),%eax
+8010302b:	83 e0 06             	and    $0x6,%eax
+8010302e:	83 f8 02             	cmp    $0x2,%eax
+80103031:	74 20                	je     80103053 <iderw+0xc3>
+80103033:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103037:	90                   	nop
+    sleep(b, &idelock);
+80103038:	83 ec 08             	sub    $0x8,%esp
+8010303b:	68 80 66 11 80       	push   $0x80116680
+80103040:	53                   	push   %ebx
+80103041:	e8 1a 27 00 00       	call   80105760 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103046:	8b 03                	mov    (%ebx),%eax
+80103048:	83 c4 10             	add    $0x10,%esp
+8010304b:	83 e0 06             	and    $0x6,%eax
+8010304e:	83 f8 02             	cmp    $0x2,%eax
+80103051:	75 e5                	jne    80103038 <iderw+0xa8>
+  }
+
+
+  release(&idelock);
+80103053:	c7 45 08 80 66 11 80 	movl   $0x80116680,0x8(%ebp)
+}
+8010305a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010305d:	c9                   	leave
+  release(&idelock);
+8010305e:	e9 8d 3b 00 00       	jmp    80106bf0 <release>
+80103063:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103067:	90                   	nop
+    idestart(b);
+80103068:	89 d8                	mov    %ebx,%eax
+8010306a:	e8 01 fd ff ff       	call   80102d70 <idestart>
+8010306f:	eb b8                	jmp    80103029 <iderw+0x99>
+80103071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+80103078:	ba 64 66 11 80       	mov    $0x80116664,%edx
+8010307d:	eb a0                	jmp    8010301f <iderw+0x8f>
+    panic("iderw: ide disk 1 not present");
+8010307f:	83 ec 0c             	sub    $0xc,%esp
+80103082:	68 9d b4 10 80       	push   $0x8010b49d
+80103087:	e8 54 d3 ff ff       	call   801003e0 <panic>
+    panic("iderw: nothing to do");
+8010308c:	83 ec 0c             	sub    $0xc,%esp
+8010308f:	68 88 b4 10 80       	push   $0x8010b488
+80103094:	e8 47 d3 ff ff       	call   801003e0 <panic>
+    panic("iderw: buf not locked");
+80103099:	83 ec 0c             	sub    $0xc,%esp
+8010309c:	68 72 b4 10 80       	push   $0x8010b472
+801030a1:	e8 3a d3 ff ff       	call   801003e0 <panic>
+801030a6:	66 90                	xchg   %ax,%ax
+801030a8:	66 90                	xchg   %ax,%ax
+801030aa:	66 90                	xchg   %ax,%ax
+801030ac:	66 90                	xchg   %ax,%ax
+801030ae:	66 90                	xchg   %ax,%ax
+
+801030b0 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+801030b0:	55                   	push   %ebp
+801030b1:	89 e5                	mov    %esp,%ebp
+801030b3:	56                   	push   %esi
+801030b4:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+801030b5:	c7 05 d4 66 11 80 00 	movl   $0xfec00000,0x801166d4
+801030bc:	00 c0 fe 
+  ioapic->reg = reg;
+801030bf:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+801030c6:	00 00 00 
+  return ioapic->data;
+801030c9:	8b 15 d4 66 11 80    	mov    0x801166d4,%edx
+801030cf:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+801030d2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+801030d8:	8b 1d d4 66 11 80    	mov    0x801166d4,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+801030de:	0f b6 15 60 68 11 80 	movzbl 0x80116860,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801030e5:	c1 ee 10             	shr    $0x10,%esi
+801030e8:	89 f0                	mov    %esi,%eax
+801030ea:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+801030ed:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+801030f0:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+801030f3:	39 c2                	cmp    %eax,%edx
+801030f5:	74 16                	je     8010310d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801030f7:	83 ec 0c             	sub    $0xc,%esp
+801030fa:	68 bc b4 10 80       	push   $0x8010b4bc
+801030ff:	e8 0c d6 ff ff       	call   80100710 <cprintf>
+  ioapic->reg = reg;
+80103104:	8b 1d d4 66 11 80    	mov    0x801166d4,%ebx
+8010310a:	83 c4 10             	add    $0x10,%esp
+{
+8010310d:	ba 10 00 00 00       	mov    $0x10,%edx
+80103112:	31 c0                	xor    %eax,%eax
+80103114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+80103118:	89 13                	mov    %edx,(%ebx)
+8010311a:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+8010311d:	8b 1d d4 66 11 80    	mov    0x801166d4,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+80103123:	83 c0 01             	add    $0x1,%eax
+80103126:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+8010312c:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+8010312f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80103132:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80103135:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80103137:	8b 1d d4 66 11 80    	mov    0x801166d4,%ebx
+8010313d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+80103144:	39 c6                	cmp    %eax,%esi
+80103146:	7d d0                	jge    80103118 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80103148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010314b:	5b                   	pop    %ebx
+8010314c:	5e                   	pop    %esi
+8010314d:	5d                   	pop    %ebp
+8010314e:	c3                   	ret
+8010314f:	90                   	nop
+
+80103150 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80103150:	55                   	push   %ebp
+  ioapic->reg = reg;
+80103151:	8b 0d d4 66 11 80    	mov    0x801166d4,%ecx
+{
+80103157:	89 e5                	mov    %esp,%ebp
+80103159:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+8010315c:	8d 50 20             	lea    0x20(%eax),%edx
+8010315f:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80103163:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103165:	8b 0d d4 66 11 80    	mov    0x801166d4,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010316b:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+8010316e:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103171:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80103174:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103176:	a1 d4 66 11 80       	mov    0x801166d4,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010317b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010317e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80103181:	5d                   	pop    %ebp
+80103182:	c3                   	ret
+80103183:	66 90                	xchg   %ax,%ax
+80103185:	66 90                	xchg   %ax,%ax
+80103187:	66 90                	xchg   %ax,%ax
+80103189:	66 90                	xchg   %ax,%ax
+8010318b:	66 90                	xchg   %ax,%ax
+8010318d:	66 90                	xchg   %ax,%ax
+8010318f:	90                   	nop
+
+80103190 <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+80103190:	55                   	push   %ebp
+80103191:	89 e5                	mov    %esp,%ebp
+80103193:	53                   	push   %ebx
+80103194:	83 ec 04             	sub    $0x4,%esp
+80103197:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  // sanity check: v is page aligned, not in text or data, and less than PHYSTOP
+  if ((uint) v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+8010319a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801031a0:	75 76                	jne    80103218 <kfree+0x88>
+801031a2:	81 fb 50 99 18 80    	cmp    $0x80189950,%ebx
+801031a8:	72 6e                	jb     80103218 <kfree+0x88>
+801031aa:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+801031b0:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+801031b5:	77 61                	ja     80103218 <kfree+0x88>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  // The goal is that use-after-free results in a crash rather than a reference
+  // to previously kalloc'd code.
+  memset(v, 1, PGSIZE);
+801031b7:	83 ec 04             	sub    $0x4,%esp
+801031ba:	68 00 10 00 00       	push   $0x1000
+801031bf:	6a 01                	push   $0x1
+801031c1:	53                   	push   %ebx
+801031c2:	e8 e9 40 00 00       	call   801072b0 <memset>
+
+  // use_lock is a boolean that indicates whether a lock needs to be used
+  // At setup, a lock is not needed because we have a single CPU and irq disabled
+  if (kmem.use_lock) 
+801031c7:	8b 15 34 67 11 80    	mov    0x80116734,%edx
+801031cd:	83 c4 10             	add    $0x10,%esp
+801031d0:	85 d2                	test   %edx,%edx
+801031d2:	75 1c                	jne    801031f0 <kfree+0x60>
+    acquire(&kmem.lock);
+
+  r = (struct run*) v;
+  r->next = kmem.freelist;
+801031d4:	a1 38 67 11 80       	mov    0x80116738,%eax
+801031d9:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+
+  if (kmem.use_lock)
+801031db:	a1 34 67 11 80       	mov    0x80116734,%eax
+  kmem.freelist = r;
+801031e0:	89 1d 38 67 11 80    	mov    %ebx,0x80116738
+  if (kmem.use_lock)
+801031e6:	85 c0                	test   %eax,%eax
+801031e8:	75 1e                	jne    80103208 <kfree+0x78>
+    release(&kmem.lock);
+}
+801031ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801031ed:	c9                   	leave
+801031ee:	c3                   	ret
+801031ef:	90                   	nop
+    acquire(&kmem.lock);
+801031f0:	83 ec 0c             	sub    $0xc,%esp
+801031f3:	68 e0 66 11 80       	push   $0x801166e0
+801031f8:	e8 33 3b 00 00       	call   80106d30 <acquire>
+801031fd:	83 c4 10             	add    $0x10,%esp
+80103200:	eb d2                	jmp    801031d4 <kfree+0x44>
+80103202:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&kmem.lock);
+80103208:	c7 45 08 e0 66 11 80 	movl   $0x801166e0,0x8(%ebp)
+}
+8010320f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103212:	c9                   	leave
+    release(&kmem.lock);
+80103213:	e9 d8 39 00 00       	jmp    80106bf0 <release>
+    panic("kfree");
+80103218:	83 ec 0c             	sub    $0xc,%esp
+8010321b:	68 ee b4 10 80       	push   $0x8010b4ee
+80103220:	e8 bb d1 ff ff       	call   801003e0 <panic>
+80103225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010322c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103230 <freerange>:
+{
+80103230:	55                   	push   %ebp
+80103231:	89 e5                	mov    %esp,%ebp
+80103233:	56                   	push   %esi
+80103234:	53                   	push   %ebx
+  p = (char*) PGROUNDUP((uint) vstart);
+80103235:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80103238:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*) PGROUNDUP((uint) vstart);
+8010323b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103241:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+80103247:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010324d:	39 de                	cmp    %ebx,%esi
+8010324f:	72 23                	jb     80103274 <freerange+0x44>
+80103251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80103258:	83 ec 0c             	sub    $0xc,%esp
+8010325b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+80103261:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80103267:	50                   	push   %eax
+80103268:	e8 23 ff ff ff       	call   80103190 <kfree>
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+8010326d:	83 c4 10             	add    $0x10,%esp
+80103270:	39 de                	cmp    %ebx,%esi
+80103272:	73 e4                	jae    80103258 <freerange+0x28>
+}
+80103274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103277:	5b                   	pop    %ebx
+80103278:	5e                   	pop    %esi
+80103279:	5d                   	pop    %ebp
+8010327a:	c3                   	ret
+8010327b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010327f:	90                   	nop
+
+80103280 <kinit2>:
+{
+80103280:	55                   	push   %ebp
+80103281:	89 e5                	mov    %esp,%ebp
+80103283:	56                   	push   %esi
+80103284:	53                   	push   %ebx
+  p = (char*) PGROUNDUP((uint) vstart);
+80103285:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80103288:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*) PGROUNDUP((uint) vstart);
+8010328b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103291:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+80103297:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010329d:	39 de                	cmp    %ebx,%esi
+8010329f:	72 23                	jb     801032c4 <kinit2+0x44>
+801032a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+801032a8:	83 ec 0c             	sub    $0xc,%esp
+801032ab:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+801032b1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801032b7:	50                   	push   %eax
+801032b8:	e8 d3 fe ff ff       	call   80103190 <kfree>
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+801032bd:	83 c4 10             	add    $0x10,%esp
+801032c0:	39 de                	cmp    %ebx,%esi
+801032c2:	73 e4                	jae    801032a8 <kinit2+0x28>
+  kmem.use_lock = 1;
+801032c4:	c7 05 34 67 11 80 01 	movl   $0x1,0x80116734
+801032cb:	00 00 00 
+}
+801032ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801032d1:	5b                   	pop    %ebx
+801032d2:	5e                   	pop    %esi
+801032d3:	5d                   	pop    %ebp
+801032d4:	c3                   	ret
+801032d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801032dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801032e0 <kinit1>:
+{
+801032e0:	55                   	push   %ebp
+801032e1:	89 e5                	mov    %esp,%ebp
+801032e3:	56                   	push   %esi
+801032e4:	53                   	push   %ebx
+801032e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlockkind(&kmem.lock, "kmem", LK_TICKET);
+801032e8:	83 ec 04             	sub    $0x4,%esp
+801032eb:	6a 01                	push   $0x1
+801032ed:	68 f4 b4 10 80       	push   $0x8010b4f4
+801032f2:	68 e0 66 11 80       	push   $0x801166e0
+801032f7:	e8 44 37 00 00       	call   80106a40 <initlockkind>
+  p = (char*) PGROUNDUP((uint) vstart);
+801032fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+801032ff:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80103302:	c7 05 34 67 11 80 00 	movl   $0x0,0x80116734
+80103309:	00 00 00 
+  p = (char*) PGROUNDUP((uint) vstart);
+8010330c:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103312:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+80103318:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010331e:	39 de                	cmp    %ebx,%esi
+80103320:	72 22                	jb     80103344 <kinit1+0x64>
+80103322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    kfree(p);
+80103328:	83 ec 0c             	sub    $0xc,%esp
+8010332b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+80103331:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80103337:	50                   	push   %eax
+80103338:	e8 53 fe ff ff       	call   80103190 <kfree>
+  for(; p + PGSIZE <= (char *) vend; p += PGSIZE)
+8010333d:	83 c4 10             	add    $0x10,%esp
+80103340:	39 de                	cmp    %ebx,%esi
+80103342:	73 e4                	jae    80103328 <kinit1+0x48>
+}
+80103344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103347:	5b                   	pop    %ebx
+80103348:	5e                   	pop    %esi
+80103349:	5d                   	pop    %ebp
+8010334a:	c3                   	ret
+8010334b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010334f:	90                   	nop
+
+80103350 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+80103350:	55                   	push   %ebp
+80103351:	89 e5                	mov    %esp,%ebp
+80103353:	53                   	push   %ebx
+80103354:	83 ec 04             	sub    $0x4,%esp
+  struct run *r;
+
+  if (kmem.use_lock)
+80103357:	a1 34 67 11 80       	mov    0x80116734,%eax
+8010335c:	85 c0                	test   %eax,%eax
+8010335e:	75 20                	jne    80103380 <kalloc+0x30>
+    acquire(&kmem.lock);
+
+  // If empty list, r = NULL. Therefore, kalloc will return NULL.
+  // This implies all calls to kalloc() should be paired with a NULL ptr check
+  r = kmem.freelist;
+80103360:	8b 1d 38 67 11 80    	mov    0x80116738,%ebx
+  if (r)
+80103366:	85 db                	test   %ebx,%ebx
+80103368:	74 07                	je     80103371 <kalloc+0x21>
+    kmem.freelist = r->next;
+8010336a:	8b 03                	mov    (%ebx),%eax
+8010336c:	a3 38 67 11 80       	mov    %eax,0x80116738
+
+  if (kmem.use_lock)
+    release(&kmem.lock);
+
+  return (char*) r;
+}
+80103371:	89 d8                	mov    %ebx,%eax
+80103373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103376:	c9                   	leave
+80103377:	c3                   	ret
+80103378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010337f:	90                   	nop
+    acquire(&kmem.lock);
+80103380:	83 ec 0c             	sub    $0xc,%esp
+80103383:	68 e0 66 11 80       	push   $0x801166e0
+80103388:	e8 a3 39 00 00       	call   80106d30 <acquire>
+  r = kmem.freelist;
+8010338d:	8b 1d 38 67 11 80    	mov    0x80116738,%ebx
+  if (kmem.use_lock)
+80103393:	a1 34 67 11 80       	mov    0x80116734,%eax
+  if (r)
+80103398:	83 c4 10             	add    $0x10,%esp
+8010339b:	85 db                	test   %ebx,%ebx
+8010339d:	74 08                	je     801033a7 <kalloc+0x57>
+    kmem.freelist = r->next;
+8010339f:	8b 13                	mov    (%ebx),%edx
+801033a1:	89 15 38 67 11 80    	mov    %edx,0x80116738
+  if (kmem.use_lock)
+801033a7:	85 c0                	test   %eax,%eax
+801033a9:	74 c6                	je     80103371 <kalloc+0x21>
+    release(&kmem.lock);
+801033ab:	83 ec 0c             	sub    $0xc,%esp
+801033ae:	68 e0 66 11 80       	push   $0x801166e0
+801033b3:	e8 38 38 00 00       	call   80106bf0 <release>
+}
+801033b8:	89 d8                	mov    %ebx,%eax
+    release(&kmem.lock);
+801033ba:	83 c4 10             	add    $0x10,%esp
+}
+801033bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801033c0:	c9                   	leave
+801033c1:	c3                   	ret
+801033c2:	66 90                	xchg   %ax,%ax
+801033c4:	66 90                	xchg   %ax,%ax
+801033c6:	66 90                	xchg   %ax,%ax
+801033c8:	66 90                	xchg   %ax,%ax
+801033ca:	66 90                	xchg   %ax,%ax
+801033cc:	66 90                	xchg   %ax,%ax
+801033ce:	66 90                	xchg   %ax,%ax
+
+801033d0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801033d0:	ba 64 00 00 00       	mov    $0x64,%edx
+801033d5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+801033d6:	a8 01                	test   $0x1,%al
+801033d8:	0f 84 c2 00 00 00    	je     801034a0 <kbdgetc+0xd0>
+{
+801033de:	55                   	push   %ebp
+801033df:	ba 60 00 00 00       	mov    $0x60,%edx
+801033e4:	89 e5                	mov    %esp,%ebp
+801033e6:	53                   	push   %ebx
+801033e7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+801033e8:	8b 1d 3c 67 11 80    	mov    0x8011673c,%ebx
+  data = inb(KBDATAP);
+801033ee:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+801033f1:	3c e0                	cmp    $0xe0,%al
+801033f3:	74 5b                	je     80103450 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+801033f5:	89 da                	mov    %ebx,%edx
+801033f7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+801033fa:	84 c0                	test   %al,%al
+801033fc:	78 6a                	js     80103468 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+801033fe:	85 d2                	test   %edx,%edx
+80103400:	74 09                	je     8010340b <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80103402:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80103405:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80103408:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+8010340b:	0f b6 91 20 b6 10 80 	movzbl -0x7fef49e0(%ecx),%edx
+  shift ^= togglecode[data];
+80103412:	0f b6 81 20 b5 10 80 	movzbl -0x7fef4ae0(%ecx),%eax
+  shift |= shiftcode[data];
+80103419:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+8010341b:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010341d:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+8010341f:	89 15 3c 67 11 80    	mov    %edx,0x8011673c
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103425:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80103428:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010342b:	8b 04 85 00 b5 10 80 	mov    -0x7fef4b00(,%eax,4),%eax
+80103432:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80103436:	74 0b                	je     80103443 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80103438:	8d 50 9f             	lea    -0x61(%eax),%edx
+8010343b:	83 fa 19             	cmp    $0x19,%edx
+8010343e:	77 48                	ja     80103488 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80103440:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80103443:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103446:	c9                   	leave
+80103447:	c3                   	ret
+80103448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010344f:	90                   	nop
+    shift |= E0ESC;
+80103450:	89 d8                	mov    %ebx,%eax
+80103452:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80103455:	a3 3c 67 11 80       	mov    %eax,0x8011673c
+    return 0;
+8010345a:	31 c0                	xor    %eax,%eax
+}
+8010345c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010345f:	c9                   	leave
+80103460:	c3                   	ret
+80103461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103468:	83 e0 7f             	and    $0x7f,%eax
+8010346b:	85 d2                	test   %edx,%edx
+8010346d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80103470:	0f b6 81 20 b6 10 80 	movzbl -0x7fef49e0(%ecx),%eax
+80103477:	83 c8 40             	or     $0x40,%eax
+8010347a:	0f b6 c0             	movzbl %al,%eax
+8010347d:	f7 d0                	not    %eax
+8010347f:	21 d8                	and    %ebx,%eax
+    return 0;
+80103481:	eb d2                	jmp    80103455 <kbdgetc+0x85>
+80103483:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103487:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80103488:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+8010348b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+8010348e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103491:	c9                   	leave
+      c += 'a' - 'A';
+80103492:	83 f9 1a             	cmp    $0x1a,%ecx
+80103495:	0f 42 c2             	cmovb  %edx,%eax
+}
+80103498:	c3                   	ret
+80103499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+801034a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801034a5:	c3                   	ret
+801034a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801034ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801034b0 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801034b0:	55                   	push   %ebp
+801034b1:	89 e5                	mov    %esp,%ebp
+801034b3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+801034b6:	68 d0 33 10 80       	push   $0x801033d0
+801034bb:	e8 60 d4 ff ff       	call   80100920 <consoleintr>
+}
+801034c0:	83 c4 10             	add    $0x10,%esp
+801034c3:	c9                   	leave
+801034c4:	c3                   	ret
+801034c5:	66 90                	xchg   %ax,%ax
+801034c7:	66 90                	xchg   %ax,%ax
+801034c9:	66 90                	xchg   %ax,%ax
+801034cb:	66 90                	xchg   %ax,%ax
+801034cd:	66 90                	xchg   %ax,%ax
+801034cf:	90                   	nop
+
+801034d0 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+801034d0:	a1 40 67 11 80       	mov    0x80116740,%eax
+801034d5:	85 c0                	test   %eax,%eax
+801034d7:	0f 84 cb 00 00 00    	je     801035a8 <lapicinit+0xd8>
+  lapic[index] = value;
+801034dd:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+801034e4:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801034e7:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801034ea:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+801034f1:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801034f4:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801034f7:	c7 80 20 03 00 00 20 	movl   $0x20,0x320(%eax)
+801034fe:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103501:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103504:	c7 80 80 03 00 00 00 	movl   $0x0,0x380(%eax)
+8010350b:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010350e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103511:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80103518:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010351b:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010351e:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80103525:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103528:	8b 50 20             	mov    0x20(%eax),%edx
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+8010352b:	8b 50 30             	mov    0x30(%eax),%edx
+8010352e:	c1 ea 10             	shr    $0x10,%edx
+80103531:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80103537:	75 77                	jne    801035b0 <lapicinit+0xe0>
+  lapic[index] = value;
+80103539:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80103540:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103543:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103546:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010354d:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103550:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103553:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010355a:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010355d:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103560:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103567:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010356a:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010356d:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80103574:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103577:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+8010357a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80103581:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103584:	8b 50 20             	mov    0x20(%eax),%edx
+80103587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010358e:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80103590:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80103596:	80 e6 10             	and    $0x10,%dh
+80103599:	75 f5                	jne    80103590 <lapicinit+0xc0>
+  lapic[index] = value;
+8010359b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+801035a2:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801035a5:	8b 40 20             	mov    0x20(%eax),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+801035a8:	c3                   	ret
+801035a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+801035b0:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+801035b7:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+801035ba:	8b 50 20             	mov    0x20(%eax),%edx
+}
+801035bd:	e9 77 ff ff ff       	jmp    80103539 <lapicinit+0x69>
+801035c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801035d0 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+801035d0:	a1 40 67 11 80       	mov    0x80116740,%eax
+801035d5:	85 c0                	test   %eax,%eax
+801035d7:	74 07                	je     801035e0 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+801035d9:	8b 40 20             	mov    0x20(%eax),%eax
+801035dc:	c1 e8 18             	shr    $0x18,%eax
+801035df:	c3                   	ret
+    return 0;
+801035e0:	31 c0                	xor    %eax,%eax
+}
+801035e2:	c3                   	ret
+801035e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801035f0 <lapiccalibrate>:
+uint
+lapiccalibrate(void)
+{
+  uint64 t0;
+
+  if(!lapic)
+801035f0:	8b 0d 40 67 11 80    	mov    0x80116740,%ecx
+801035f6:	85 c9                	test   %ecx,%ecx
+801035f8:	74 4e                	je     80103648 <lapiccalibrate+0x58>
+{
+801035fa:	55                   	push   %ebp
+801035fb:	89 e5                	mov    %esp,%ebp
+801035fd:	53                   	push   %ebx
+  lapic[index] = value;
+801035fe:	c7 81 20 03 00 00 20 	movl   $0x10020,0x320(%ecx)
+80103605:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103608:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+8010360b:	c7 81 80 03 00 00 80 	movl   $0x989680,0x380(%ecx)
+80103612:	96 98 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103615:	8b 41 20             	mov    0x20(%ecx),%eax
+  asm volatile("rdtsc" : "=A" (t));
+80103618:	0f 31                	rdtsc
+8010361a:	89 c3                	mov    %eax,%ebx
+    return 0;
+  lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT);
+  t0 = rdtsc();
+  while(lapic[TCCR] != 0)
+8010361c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103620:	8b 91 90 03 00 00    	mov    0x390(%ecx),%edx
+80103626:	85 d2                	test   %edx,%edx
+80103628:	75 f6                	jne    80103620 <lapiccalibrate+0x30>
+8010362a:	0f 31                	rdtsc
+  lapic[index] = value;
+8010362c:	c7 81 20 03 00 00 20 	movl   $0x20,0x320(%ecx)
+80103633:	00 00 00 
+    ;
+  tsctick = rdtsc() - t0;
+80103636:	29 d8                	sub    %ebx,%eax
+  lapic[ID];  // wait for write to finish, by reading
+80103638:	8b 51 20             	mov    0x20(%ecx),%edx
+  tsctick = rdtsc() - t0;
+8010363b:	a3 44 67 11 80       	mov    %eax,0x80116744
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  return tsctick;
+}
+80103640:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103643:	c9                   	leave
+80103644:	c3                   	ret
+80103645:	8d 76 00             	lea    0x0(%esi),%esi
+    return 0;
+80103648:	31 c0                	xor    %eax,%eax
+}
+8010364a:	c3                   	ret
+8010364b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010364f:	90                   	nop
+
+80103650 <lapictimer>:
+
+// Make this CPU's timer interrupt n times per clock tick.
+void
+lapictimer(int n)
+{
+  if(!lapic)
+80103650:	8b 0d 40 67 11 80    	mov    0x80116740,%ecx
+80103656:	85 c9                	test   %ecx,%ecx
+80103658:	74 26                	je     80103680 <lapictimer+0x30>
+{
+8010365a:	55                   	push   %ebp
+    return;
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT / n);
+8010365b:	31 d2                	xor    %edx,%edx
+  lapic[index] = value;
+8010365d:	c7 81 20 03 00 00 20 	movl   $0x20020,0x320(%ecx)
+80103664:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103667:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapicw(TICR, TICKCOUNT / n);
+8010366a:	b8 80 96 98 00       	mov    $0x989680,%eax
+{
+8010366f:	89 e5                	mov    %esp,%ebp
+  lapicw(TICR, TICKCOUNT / n);
+80103671:	f7 7d 08             	idivl  0x8(%ebp)
+  lapic[index] = value;
+80103674:	89 81 80 03 00 00    	mov    %eax,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+8010367a:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+8010367d:	5d                   	pop    %ebp
+8010367e:	c3                   	ret
+8010367f:	90                   	nop
+80103680:	c3                   	ret
+80103681:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010368f:	90                   	nop
+
+80103690 <lapiconeshot>:
+// Make this CPU's timer interrupt once, cycles TSC cycles from
+// now, or never if cycles is 0. cycles must be less than 400
+// clock ticks.
+void
+lapiconeshot(uint64 cycles)
+{
+80103690:	55                   	push   %ebp
+  uint n;
+
+  if(!lapic)
+80103691:	8b 0d 40 67 11 80    	mov    0x80116740,%ecx
+{
+80103697:	89 e5                	mov    %esp,%ebp
+80103699:	57                   	push   %edi
+8010369a:	56                   	push   %esi
+8010369b:	53                   	push   %ebx
+8010369c:	8b 75 08             	mov    0x8(%ebp),%esi
+8010369f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(!lapic)
+801036a2:	85 c9                	test   %ecx,%ecx
+801036a4:	74 1e                	je     801036c4 <lapiconeshot+0x34>
+    return;
+  n = 0;
+  if(cycles)
+801036a6:	89 da                	mov    %ebx,%edx
+  n = 0;
+801036a8:	31 c0                	xor    %eax,%eax
+  if(cycles)
+801036aa:	09 f2                	or     %esi,%edx
+801036ac:	75 22                	jne    801036d0 <lapiconeshot+0x40>
+  lapic[index] = value;
+801036ae:	c7 81 20 03 00 00 20 	movl   $0x20,0x320(%ecx)
+801036b5:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801036b8:	8b 51 20             	mov    0x20(%ecx),%edx
+  lapic[index] = value;
+801036bb:	89 81 80 03 00 00    	mov    %eax,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+801036c1:	8b 41 20             	mov    0x20(%ecx),%eax
+    n = divl(cycles * TICKCOUNT, tsctick) + 1;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n);
+}
+801036c4:	5b                   	pop    %ebx
+801036c5:	5e                   	pop    %esi
+801036c6:	5f                   	pop    %edi
+801036c7:	5d                   	pop    %ebp
+801036c8:	c3                   	ret
+801036c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    n = divl(cycles * TICKCOUNT, tsctick) + 1;
+801036d0:	b8 80 96 98 00       	mov    $0x989680,%eax
+801036d5:	69 db 80 96 98 00    	imul   $0x989680,%ebx,%ebx
+801036db:	f7 e6                	mul    %esi
+801036dd:	89 c6                	mov    %eax,%esi
+801036df:	8d 14 1a             	lea    (%edx,%ebx,1),%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+801036e2:	89 f0                	mov    %esi,%eax
+801036e4:	f7 35 44 67 11 80    	divl   0x80116744
+801036ea:	83 c0 01             	add    $0x1,%eax
+801036ed:	eb bf                	jmp    801036ae <lapiconeshot+0x1e>
+801036ef:	90                   	nop
+
+801036f0 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+801036f0:	a1 40 67 11 80       	mov    0x80116740,%eax
+801036f5:	85 c0                	test   %eax,%eax
+801036f7:	74 0d                	je     80103706 <lapiceoi+0x16>
+  lapic[index] = value;
+801036f9:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103700:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103703:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80103706:	c3                   	ret
+80103707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010370e:	66 90                	xchg   %ax,%ax
+
+80103710 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80103710:	c3                   	ret
+80103711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010371f:	90                   	nop
+
+80103720 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80103720:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103721:	b8 0f 00 00 00       	mov    $0xf,%eax
+80103726:	ba 70 00 00 00       	mov    $0x70,%edx
+8010372b:	89 e5                	mov    %esp,%ebp
+8010372d:	53                   	push   %ebx
+8010372e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103731:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103734:	ee                   	out    %al,(%dx)
+80103735:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010373a:	ba 71 00 00 00       	mov    $0x71,%edx
+8010373f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80103740:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80103742:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80103745:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+8010374b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+8010374d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80103750:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80103752:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103755:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80103758:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+8010375e:	a1 40 67 11 80       	mov    0x80116740,%eax
+80103763:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103769:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010376c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80103773:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103776:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103779:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80103780:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103783:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103786:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010378c:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+8010378f:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103795:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103798:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+8010379e:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+801037a1:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801037a7:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+801037aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801037ad:	c9                   	leave
+801037ae:	c3                   	ret
+801037af:	90                   	nop
+
+801037b0 <lapicipi>:
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(uchar apicid, int vector)
+{
+801037b0:	55                   	push   %ebp
+  if(!lapic)
+801037b1:	8b 15 40 67 11 80    	mov    0x80116740,%edx
+{
+801037b7:	89 e5                	mov    %esp,%ebp
+801037b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(!lapic)
+801037bc:	85 d2                	test   %edx,%edx
+801037be:	74 2b                	je     801037eb <lapicipi+0x3b>
+  lapic[index] = value;
+801037c0:	c1 e0 18             	shl    $0x18,%eax
+801037c3:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+801037c9:	8b 42 20             	mov    0x20(%edx),%eax
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+801037cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801037cf:	80 cc 40             	or     $0x40,%ah
+  lapic[index] = value;
+801037d2:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+801037d8:	8b 42 20             	mov    0x20(%edx),%eax
+801037db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801037df:	90                   	nop
+  while(lapic[ICRLO] & DELIVS)
+801037e0:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+801037e6:	f6 c4 10             	test   $0x10,%ah
+801037e9:	75 f5                	jne    801037e0 <lapicipi+0x30>
+    ;
+}
+801037eb:	5d                   	pop    %ebp
+801037ec:	c3                   	ret
+801037ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801037f0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+801037f0:	55                   	push   %ebp
+801037f1:	b8 0b 00 00 00       	mov    $0xb,%eax
+801037f6:	ba 70 00 00 00       	mov    $0x70,%edx
+801037fb:	89 e5                	mov    %esp,%ebp
+801037fd:	57                   	push   %edi
+801037fe:	56                   	push   %esi
+801037ff:	53                   	push   %ebx
+80103800:	83 ec 4c             	sub    $0x4c,%esp
+80103803:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103804:	ba 71 00 00 00       	mov    $0x71,%edx
+80103809:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+8010380a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010380d:	bf 70 00 00 00       	mov    $0x70,%edi
+80103812:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80103815:	8d 76 00             	lea    0x0(%esi),%esi
+80103818:	31 c0                	xor    %eax,%eax
+8010381a:	89 fa                	mov    %edi,%edx
+8010381c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010381d:	b9 71 00 00 00       	mov    $0x71,%ecx
+80103822:	89 ca                	mov    %ecx,%edx
+80103824:	ec                   	in     (%dx),%al
+80103825:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103828:	89 fa                	mov    %edi,%edx
+8010382a:	b8 02 00 00 00       	mov    $0x2,%eax
+8010382f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103830:	89 ca                	mov    %ecx,%edx
+80103832:	ec                   	in     (%dx),%al
+80103833:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103836:	89 fa                	mov    %edi,%edx
+80103838:	b8 04 00 00 00       	mov    $0x4,%eax
+8010383d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010383e:	89 ca                	mov    %ecx,%edx
+80103840:	ec                   	in     (%dx),%al
+80103841:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103844:	89 fa                	mov    %edi,%edx
+80103846:	b8 07 00 00 00       	mov    $0x7,%eax
+8010384b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010384c:	89 ca                	mov    %ecx,%edx
+8010384e:	ec                   	in     (%dx),%al
+8010384f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103852:	89 fa                	mov    %edi,%edx
+80103854:	b8 08 00 00 00       	mov    $0x8,%eax
+80103859:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010385a:	89 ca                	mov    %ecx,%edx
+8010385c:	ec                   	in     (%dx),%al
+8010385d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010385f:	89 fa                	mov    %edi,%edx
+80103861:	b8 09 00 00 00       	mov    $0x9,%eax
+80103866:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103867:	89 ca                	mov    %ecx,%edx
+80103869:	ec                   	in     (%dx),%al
+8010386a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010386d:	89 fa                	mov    %edi,%edx
+8010386f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103874:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103875:	89 ca                	mov    %ecx,%edx
+80103877:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80103878:	84 c0                	test   %al,%al
+8010387a:	78 9c                	js     80103818 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+8010387c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80103880:	89 f2                	mov    %esi,%edx
+80103882:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80103885:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103888:	89 fa                	mov    %edi,%edx
+8010388a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010388d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80103891:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80103894:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80103897:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+8010389b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+8010389e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+801038a2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+801038a5:	31 c0                	xor    %eax,%eax
+801038a7:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038a8:	89 ca                	mov    %ecx,%edx
+801038aa:	ec                   	in     (%dx),%al
+801038ab:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801038ae:	89 fa                	mov    %edi,%edx
+801038b0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801038b3:	b8 02 00 00 00       	mov    $0x2,%eax
+801038b8:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038b9:	89 ca                	mov    %ecx,%edx
+801038bb:	ec                   	in     (%dx),%al
+801038bc:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801038bf:	89 fa                	mov    %edi,%edx
+801038c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801038c4:	b8 04 00 00 00       	mov    $0x4,%eax
+801038c9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038ca:	89 ca                	mov    %ecx,%edx
+801038cc:	ec                   	in     (%dx),%al
+801038cd:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801038d0:	89 fa                	mov    %edi,%edx
+801038d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801038d5:	b8 07 00 00 00       	mov    $0x7,%eax
+801038da:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038db:	89 ca                	mov    %ecx,%edx
+801038dd:	ec                   	in     (%dx),%al
+801038de:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801038e1:	89 fa                	mov    %edi,%edx
+801038e3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801038e6:	b8 08 00 00 00       	mov    $0x8,%eax
+801038eb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038ec:	89 ca                	mov    %ecx,%edx
+801038ee:	ec                   	in     (%dx),%al
+801038ef:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801038f2:	89 fa                	mov    %edi,%edx
+801038f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801038f7:	b8 09 00 00 00       	mov    $0x9,%eax
+801038fc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801038fd:	89 ca                	mov    %ecx,%edx
+801038ff:	ec                   	in     (%dx),%al
+80103900:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103903:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80103906:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80103909:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010390c:	6a 18                	push   $0x18
+8010390e:	50                   	push   %eax
+8010390f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80103912:	50                   	push   %eax
+80103913:	e8 d8 39 00 00       	call   801072f0 <memcmp>
+80103918:	83 c4 10             	add    $0x10,%esp
+8010391b:	85 c0                	test   %eax,%eax
+8010391d:	0f 85 f5 fe ff ff    	jne    80103818 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80103923:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80103927:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010392a:	89 f0                	mov    %esi,%eax
+8010392c:	84 c0                	test   %al,%al
+8010392e:	75 78                	jne    801039a8 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80103930:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80103933:	89 c2                	mov    %eax,%edx
+80103935:	83 e0 0f             	and    $0xf,%eax
+80103938:	c1 ea 04             	shr    $0x4,%edx
+8010393b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010393e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103941:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80103944:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80103947:	89 c2                	mov    %eax,%edx
+80103949:	83 e0 0f             	and    $0xf,%eax
+8010394c:	c1 ea 04             	shr    $0x4,%edx
+8010394f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103952:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103955:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80103958:	8b 45 c0             	mov    -0x40(%ebp),%eax
+8010395b:	89 c2                	mov    %eax,%edx
+8010395d:	83 e0 0f             	and    $0xf,%eax
+80103960:	c1 ea 04             	shr    $0x4,%edx
+80103963:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80103966:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103969:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+8010396c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010396f:	89 c2                	mov    %eax,%edx
+80103971:	83 e0 0f             	and    $0xf,%eax
+80103974:	c1 ea 04             	shr    $0x4,%edx
+80103977:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010397a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010397d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80103980:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80103983:	89 c2                	mov    %eax,%edx
+80103985:	83 e0 0f             	and    $0xf,%eax
+80103988:	c1 ea 04             	shr    $0x4,%edx
+8010398b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010398e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80103991:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80103994:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80103997:	89 c2                	mov    %eax,%edx
+80103999:	83 e0 0f             	and    $0xf,%eax
+8010399c:	c1 ea 04             	shr    $0x4,%edx
+8010399f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801039a2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801039a5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+801039a8:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801039ab:	89 03                	mov    %eax,(%ebx)
+801039ad:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801039b0:	89 43 04             	mov    %eax,0x4(%ebx)
+801039b3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+801039b6:	89 43 08             	mov    %eax,0x8(%ebx)
+801039b9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801039bc:	89 43 0c             	mov    %eax,0xc(%ebx)
+801039bf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801039c2:	89 43 10             	mov    %eax,0x10(%ebx)
+801039c5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801039c8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+801039cb:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+801039d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801039d5:	5b                   	pop    %ebx
+801039d6:	5e                   	pop    %esi
+801039d7:	5f                   	pop    %edi
+801039d8:	5d                   	pop    %ebp
+801039d9:	c3                   	ret
+801039da:	66 90                	xchg   %ax,%ax
+801039dc:	66 90                	xchg   %ax,%ax
+801039de:	66 90                	xchg   %ax,%ax
+
+801039e0 <install_trans>:
+static void
+install_trans(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+801039e0:	8b 0d c8 67 11 80    	mov    0x801167c8,%ecx
+801039e6:	85 c9                	test   %ecx,%ecx
+801039e8:	0f 8e 92 00 00 00    	jle    80103a80 <install_trans+0xa0>
+{
+801039ee:	55                   	push   %ebp
+801039ef:	89 e5                	mov    %esp,%ebp
+801039f1:	57                   	push   %edi
+  for (tail = 0; tail < log.lh.n; tail++) {
+801039f2:	31 ff                	xor    %edi,%edi
+{
+801039f4:	56                   	push   %esi
+801039f5:	53                   	push   %ebx
+801039f6:	83 ec 0c             	sub    $0xc,%esp
+801039f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80103a00:	a1 b4 67 11 80       	mov    0x801167b4,%eax
+80103a05:	83 ec 08             	sub    $0x8,%esp
+80103a08:	01 f8                	add    %edi,%eax
+80103a0a:	83 c0 01             	add    $0x1,%eax
+80103a0d:	50                   	push   %eax
+80103a0e:	ff 35 c4 67 11 80    	push   0x801167c4
+80103a14:	e8 77 c7 ff ff       	call   80100190 <bread>
+80103a19:	89 c6                	mov    %eax,%esi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80103a1b:	58                   	pop    %eax
+80103a1c:	5a                   	pop    %edx
+80103a1d:	ff 34 bd cc 67 11 80 	push   -0x7fee9834(,%edi,4)
+80103a24:	ff 35 c4 67 11 80    	push   0x801167c4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103a2a:	83 c7 01             	add    $0x1,%edi
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80103a2d:	e8 5e c7 ff ff       	call   80100190 <bread>
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80103a32:	83 c4 0c             	add    $0xc,%esp
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+80103a35:	89 c3                	mov    %eax,%ebx
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+80103a37:	8d 86 84 00 00 00    	lea    0x84(%esi),%eax
+80103a3d:	68 00 02 00 00       	push   $0x200
+80103a42:	50                   	push   %eax
+80103a43:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80103a49:	50                   	push   %eax
+80103a4a:	e8 f1 38 00 00       	call   80107340 <memmove>
+    bwrite(dbuf);  // write dst to disk
+80103a4f:	89 1c 24             	mov    %ebx,(%esp)
+80103a52:	e8 b9 c7 ff ff       	call   80100210 <bwrite>
+    brelse(lbuf);
+80103a57:	89 34 24             	mov    %esi,(%esp)
+80103a5a:	e8 f1 c7 ff ff       	call   80100250 <brelse>
+    brelse(dbuf);
+80103a5f:	89 1c 24             	mov    %ebx,(%esp)
+80103a62:	e8 e9 c7 ff ff       	call   80100250 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103a67:	83 c4 10             	add    $0x10,%esp
+80103a6a:	39 3d c8 67 11 80    	cmp    %edi,0x801167c8
+80103a70:	7f 8e                	jg     80103a00 <install_trans+0x20>
+  }
+}
+80103a72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103a75:	5b                   	pop    %ebx
+80103a76:	5e                   	pop    %esi
+80103a77:	5f                   	pop    %edi
+80103a78:	5d                   	pop    %ebp
+80103a79:	c3                   	ret
+80103a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103a80:	c3                   	ret
+80103a81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a8f:	90                   	nop
+
+80103a90 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+80103a90:	55                   	push   %ebp
+80103a91:	89 e5                	mov    %esp,%ebp
+80103a93:	53                   	push   %ebx
+80103a94:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80103a97:	ff 35 b4 67 11 80    	push   0x801167b4
+80103a9d:	ff 35 c4 67 11 80    	push   0x801167c4
+80103aa3:	e8 e8 c6 ff ff       	call   80100190 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+80103aa8:	83 c4 10             	add    $0x10,%esp
+  struct buf *buf = bread(log.dev, log.start);
+80103aab:	89 c3                	mov    %eax,%ebx
+  hb->n = log.lh.n;
+80103aad:	a1 c8 67 11 80       	mov    0x801167c8,%eax
+80103ab2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+80103ab8:	85 c0                	test   %eax,%eax
+80103aba:	7e 19                	jle    80103ad5 <write_head+0x45>
+80103abc:	31 d2                	xor    %edx,%edx
+80103abe:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.lh.block[i];
+80103ac0:	8b 0c 95 cc 67 11 80 	mov    -0x7fee9834(,%edx,4),%ecx
+80103ac7:	89 8c 93 88 00 00 00 	mov    %ecx,0x88(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80103ace:	83 c2 01             	add    $0x1,%edx
+80103ad1:	39 d0                	cmp    %edx,%eax
+80103ad3:	75 eb                	jne    80103ac0 <write_head+0x30>
+  }
+  bwrite(buf);
+80103ad5:	83 ec 0c             	sub    $0xc,%esp
+80103ad8:	53                   	push   %ebx
+80103ad9:	e8 32 c7 ff ff       	call   80100210 <bwrite>
+  brelse(buf);
+80103ade:	89 1c 24             	mov    %ebx,(%esp)
+80103ae1:	e8 6a c7 ff ff       	call   80100250 <brelse>
+}
+80103ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103ae9:	83 c4 10             	add    $0x10,%esp
+80103aec:	c9                   	leave
+80103aed:	c3                   	ret
+80103aee:	66 90                	xchg   %ax,%ax
+
+80103af0 <initlog>:
+{
+80103af0:	55                   	push   %ebp
+80103af1:	89 e5                	mov    %esp,%ebp
+80103af3:	53                   	push   %ebx
+80103af4:	83 ec 2c             	sub    $0x2c,%esp
+80103af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80103afa:	68 20 b7 10 80       	push   $0x8010b720
+80103aff:	68 60 67 11 80       	push   $0x80116760
+80103b04:	e8 d7 2e 00 00       	call   801069e0 <initlock>
+  readsb(dev, &sb);
+80103b09:	58                   	pop    %eax
+80103b0a:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80103b0d:	5a                   	pop    %edx
+80103b0e:	50                   	push   %eax
+80103b0f:	53                   	push   %ebx
+80103b10:	e8 8b e3 ff ff       	call   80101ea0 <readsb>
+  log.size = sb.nlog;
+80103b15:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80103b18:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+80103b1b:	89 1d c4 67 11 80    	mov    %ebx,0x801167c4
+  log.start = sb.logstart;
+80103b21:	a3 b4 67 11 80       	mov    %eax,0x801167b4
+  log.size = sb.nlog;
+80103b26:	89 15 b8 67 11 80    	mov    %edx,0x801167b8
+  struct buf *buf = bread(log.dev, log.start);
+80103b2c:	59                   	pop    %ecx
+80103b2d:	5a                   	pop    %edx
+80103b2e:	50                   	push   %eax
+80103b2f:	53                   	push   %ebx
+80103b30:	e8 5b c6 ff ff       	call   80100190 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80103b35:	83 c4 10             	add    $0x10,%esp
+  log.lh.n = lh->n;
+80103b38:	8b 98 84 00 00 00    	mov    0x84(%eax),%ebx
+80103b3e:	89 1d c8 67 11 80    	mov    %ebx,0x801167c8
+  for (i = 0; i < log.lh.n; i++) {
+80103b44:	85 db                	test   %ebx,%ebx
+80103b46:	7e 1d                	jle    80103b65 <initlog+0x75>
+80103b48:	31 d2                	xor    %edx,%edx
+80103b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    log.lh.block[i] = lh->block[i];
+80103b50:	8b 8c 90 88 00 00 00 	mov    0x88(%eax,%edx,4),%ecx
+80103b57:	89 0c 95 cc 67 11 80 	mov    %ecx,-0x7fee9834(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80103b5e:	83 c2 01             	add    $0x1,%edx
+80103b61:	39 d3                	cmp    %edx,%ebx
+80103b63:	75 eb                	jne    80103b50 <initlog+0x60>
+  brelse(buf);
+80103b65:	83 ec 0c             	sub    $0xc,%esp
+80103b68:	50                   	push   %eax
+80103b69:	e8 e2 c6 ff ff       	call   80100250 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+80103b6e:	e8 6d fe ff ff       	call   801039e0 <install_trans>
+  log.lh.n = 0;
+80103b73:	c7 05 c8 67 11 80 00 	movl   $0x0,0x801167c8
+80103b7a:	00 00 00 
+  write_head(); // clear the log
+80103b7d:	e8 0e ff ff ff       	call   80103a90 <write_head>
+}
+80103b82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b85:	83 c4 10             	add    $0x10,%esp
+80103b88:	c9                   	leave
+80103b89:	c3                   	ret
+80103b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103b90 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+80103b90:	55                   	push   %ebp
+80103b91:	89 e5                	mov    %esp,%ebp
+80103b93:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80103b96:	68 60 67 11 80       	push   $0x80116760
+80103b9b:	e8 90 31 00 00       	call   80106d30 <acquire>
+80103ba0:	83 c4 10             	add    $0x10,%esp
+80103ba3:	eb 18                	jmp    80103bbd <begin_op+0x2d>
+80103ba5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(1){
+    if(log.committing){
+      sleep(&log, &log.lock);
+80103ba8:	83 ec 08             	sub    $0x8,%esp
+80103bab:	68 60 67 11 80       	push   $0x80116760
+80103bb0:	68 60 67 11 80       	push   $0x80116760
+80103bb5:	e8 a6 1b 00 00       	call   80105760 <sleep>
+80103bba:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+80103bbd:	a1 c0 67 11 80       	mov    0x801167c0,%eax
+80103bc2:	85 c0                	test   %eax,%eax
+80103bc4:	75 e2                	jne    80103ba8 <begin_op+0x18>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80103bc6:	a1 bc 67 11 80       	mov    0x801167bc,%eax
+80103bcb:	8b 15 c8 67 11 80    	mov    0x801167c8,%edx
+80103bd1:	83 c0 01             	add    $0x1,%eax
+80103bd4:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80103bd7:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80103bda:	83 fa 1e             	cmp    $0x1e,%edx
+80103bdd:	7f c9                	jg     80103ba8 <begin_op+0x18>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+80103bdf:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80103be2:	a3 bc 67 11 80       	mov    %eax,0x801167bc
+      release(&log.lock);
+80103be7:	68 60 67 11 80       	push   $0x80116760
+80103bec:	e8 ff 2f 00 00       	call   80106bf0 <release>
+      break;
+    }
+  }
+}
+80103bf1:	83 c4 10             	add    $0x10,%esp
+80103bf4:	c9                   	leave
+80103bf5:	c3                   	ret
+80103bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103bfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103c00 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+80103c00:	55                   	push   %ebp
+80103c01:	89 e5                	mov    %esp,%ebp
+80103c03:	57                   	push   %edi
+80103c04:	56                   	push   %esi
+80103c05:	53                   	push   %ebx
+80103c06:	83 ec 18             	sub    $0x18,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+80103c09:	68 60 67 11 80       	push   $0x80116760
+80103c0e:	e8 1d 31 00 00       	call   80106d30 <acquire>
+  log.outstanding -= 1;
+80103c13:	a1 bc 67 11 80       	mov    0x801167bc,%eax
+  if(log.committing)
+80103c18:	8b 35 c0 67 11 80    	mov    0x801167c0,%esi
+80103c1e:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+80103c21:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80103c24:	89 1d bc 67 11 80    	mov    %ebx,0x801167bc
+  if(log.committing)
+80103c2a:	85 f6                	test   %esi,%esi
+80103c2c:	0f 85 4f 01 00 00    	jne    80103d81 <end_op+0x181>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80103c32:	85 db                	test   %ebx,%ebx
+80103c34:	75 62                	jne    80103c98 <end_op+0x98>
+    do_commit = 1;
+    log.committing = 1;
+80103c36:	c7 05 c0 67 11 80 01 	movl   $0x1,0x801167c0
+80103c3d:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80103c40:	83 ec 0c             	sub    $0xc,%esp
+80103c43:	68 60 67 11 80       	push   $0x80116760
+80103c48:	e8 a3 2f 00 00       	call   80106bf0 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80103c4d:	a1 c8 67 11 80       	mov    0x801167c8,%eax
+80103c52:	83 c4 10             	add    $0x10,%esp
+80103c55:	85 c0                	test   %eax,%eax
+80103c57:	7f 67                	jg     80103cc0 <end_op+0xc0>
+    acquire(&log.lock);
+80103c59:	83 ec 0c             	sub    $0xc,%esp
+80103c5c:	68 60 67 11 80       	push   $0x80116760
+80103c61:	e8 ca 30 00 00       	call   80106d30 <acquire>
+    log.committing = 0;
+80103c66:	c7 05 c0 67 11 80 00 	movl   $0x0,0x801167c0
+80103c6d:	00 00 00 
+    wakeup(&log);
+80103c70:	c7 04 24 60 67 11 80 	movl   $0x80116760,(%esp)
+80103c77:	e8 94 1d 00 00       	call   80105a10 <wakeup>
+    release(&log.lock);
+80103c7c:	c7 04 24 60 67 11 80 	movl   $0x80116760,(%esp)
+80103c83:	e8 68 2f 00 00       	call   80106bf0 <release>
+80103c88:	83 c4 10             	add    $0x10,%esp
+}
+80103c8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c8e:	5b                   	pop    %ebx
+80103c8f:	5e                   	pop    %esi
+80103c90:	5f                   	pop    %edi
+80103c91:	5d                   	pop    %ebp
+80103c92:	c3                   	ret
+80103c93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103c97:	90                   	nop
+    wakeup(&log);
+80103c98:	83 ec 0c             	sub    $0xc,%esp
+80103c9b:	68 60 67 11 80       	push   $0x80116760
+80103ca0:	e8 6b 1d 00 00       	call   80105a10 <wakeup>
+  release(&log.lock);
+80103ca5:	c7 04 24 60 67 11 80 	movl   $0x80116760,(%esp)
+80103cac:	e8 3f 2f 00 00       	call   80106bf0 <release>
+80103cb1:	83 c4 10             	add    $0x10,%esp
+}
+80103cb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103cb7:	5b                   	pop    %ebx
+80103cb8:	5e                   	pop    %esi
+80103cb9:	5f                   	pop    %edi
+80103cba:	5d                   	pop    %ebp
+80103cbb:	c3                   	ret
+80103cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    trace(TR_COMMIT, log.lh.n, 0);
+80103cc0:	83 ec 04             	sub    $0x4,%esp
+80103cc3:	6a 00                	push   $0x0
+80103cc5:	50                   	push   %eax
+80103cc6:	6a 09                	push   $0x9
+80103cc8:	e8 e3 57 00 00       	call   801094b0 <trace>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103ccd:	8b 0d c8 67 11 80    	mov    0x801167c8,%ecx
+80103cd3:	83 c4 10             	add    $0x10,%esp
+80103cd6:	85 c9                	test   %ecx,%ecx
+80103cd8:	7e 78                	jle    80103d52 <end_op+0x152>
+80103cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+80103ce0:	a1 b4 67 11 80       	mov    0x801167b4,%eax
+80103ce5:	83 ec 08             	sub    $0x8,%esp
+80103ce8:	01 d8                	add    %ebx,%eax
+80103cea:	83 c0 01             	add    $0x1,%eax
+80103ced:	50                   	push   %eax
+80103cee:	ff 35 c4 67 11 80    	push   0x801167c4
+80103cf4:	e8 97 c4 ff ff       	call   80100190 <bread>
+80103cf9:	89 c6                	mov    %eax,%esi
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80103cfb:	58                   	pop    %eax
+80103cfc:	5a                   	pop    %edx
+80103cfd:	ff 34 9d cc 67 11 80 	push   -0x7fee9834(,%ebx,4)
+80103d04:	ff 35 c4 67 11 80    	push   0x801167c4
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103d0a:	83 c3 01             	add    $0x1,%ebx
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80103d0d:	e8 7e c4 ff ff       	call   80100190 <bread>
+    memmove(to->data, from->data, BSIZE);
+80103d12:	83 c4 0c             	add    $0xc,%esp
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80103d15:	89 c7                	mov    %eax,%edi
+    memmove(to->data, from->data, BSIZE);
+80103d17:	8d 80 84 00 00 00    	lea    0x84(%eax),%eax
+80103d1d:	68 00 02 00 00       	push   $0x200
+80103d22:	50                   	push   %eax
+80103d23:	8d 86 84 00 00 00    	lea    0x84(%esi),%eax
+80103d29:	50                   	push   %eax
+80103d2a:	e8 11 36 00 00       	call   80107340 <memmove>
+    bwrite(to);  // write the log
+80103d2f:	89 34 24             	mov    %esi,(%esp)
+80103d32:	e8 d9 c4 ff ff       	call   80100210 <bwrite>
+    brelse(from);
+80103d37:	89 3c 24             	mov    %edi,(%esp)
+80103d3a:	e8 11 c5 ff ff       	call   80100250 <brelse>
+    brelse(to);
+80103d3f:	89 34 24             	mov    %esi,(%esp)
+80103d42:	e8 09 c5 ff ff       	call   80100250 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80103d47:	83 c4 10             	add    $0x10,%esp
+80103d4a:	3b 1d c8 67 11 80    	cmp    0x801167c8,%ebx
+80103d50:	7c 8e                	jl     80103ce0 <end_op+0xe0>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+80103d52:	e8 39 fd ff ff       	call   80103a90 <write_head>
+    install_trans(); // Now install writes to home locations
+80103d57:	e8 84 fc ff ff       	call   801039e0 <install_trans>
+    log.lh.n = 0;
+80103d5c:	c7 05 c8 67 11 80 00 	movl   $0x0,0x801167c8
+80103d63:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80103d66:	e8 25 fd ff ff       	call   80103a90 <write_head>
+    trace(TR_COMMITDONE, 0, 0);
+80103d6b:	83 ec 04             	sub    $0x4,%esp
+80103d6e:	6a 00                	push   $0x0
+80103d70:	6a 00                	push   $0x0
+80103d72:	6a 0a                	push   $0xa
+80103d74:	e8 37 57 00 00       	call   801094b0 <trace>
+80103d79:	83 c4 10             	add    $0x10,%esp
+80103d7c:	e9 d8 fe ff ff       	jmp    80103c59 <end_op+0x59>
+    panic("log.committing");
+80103d81:	83 ec 0c             	sub    $0xc,%esp
+80103d84:	68 24 b7 10 80       	push   $0x8010b724
+80103d89:	e8 52 c6 ff ff       	call   801003e0 <panic>
+80103d8e:	66 90                	xchg   %ax,%ax
+
+80103d90 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80103d90:	55                   	push   %ebp
+80103d91:	89 e5                	mov    %esp,%ebp
+80103d93:	53                   	push   %ebx
+80103d94:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103d97:	8b 15 c8 67 11 80    	mov    0x801167c8,%edx
+{
+80103d9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80103da0:	83 fa 1d             	cmp    $0x1d,%edx
+80103da3:	7f 7d                	jg     80103e22 <log_write+0x92>
+80103da5:	a1 b8 67 11 80       	mov    0x801167b8,%eax
+80103daa:	83 e8 01             	sub    $0x1,%eax
+80103dad:	39 c2                	cmp    %eax,%edx
+80103daf:	7d 71                	jge    80103e22 <log_write+0x92>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80103db1:	a1 bc 67 11 80       	mov    0x801167bc,%eax
+80103db6:	85 c0                	test   %eax,%eax
+80103db8:	7e 75                	jle    80103e2f <log_write+0x9f>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80103dba:	83 ec 0c             	sub    $0xc,%esp
+80103dbd:	68 60 67 11 80       	push   $0x80116760
+80103dc2:	e8 69 2f 00 00       	call   80106d30 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103dc7:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+80103dca:	83 c4 10             	add    $0x10,%esp
+80103dcd:	31 c0                	xor    %eax,%eax
+80103dcf:	8b 15 c8 67 11 80    	mov    0x801167c8,%edx
+80103dd5:	85 d2                	test   %edx,%edx
+80103dd7:	7f 0e                	jg     80103de7 <log_write+0x57>
+80103dd9:	eb 15                	jmp    80103df0 <log_write+0x60>
+80103ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103ddf:	90                   	nop
+80103de0:	83 c0 01             	add    $0x1,%eax
+80103de3:	39 c2                	cmp    %eax,%edx
+80103de5:	74 29                	je     80103e10 <log_write+0x80>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80103de7:	39 0c 85 cc 67 11 80 	cmp    %ecx,-0x7fee9834(,%eax,4)
+80103dee:	75 f0                	jne    80103de0 <log_write+0x50>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80103df0:	89 0c 85 cc 67 11 80 	mov    %ecx,-0x7fee9834(,%eax,4)
+  if (i == log.lh.n)
+80103df7:	39 c2                	cmp    %eax,%edx
+80103df9:	74 1c                	je     80103e17 <log_write+0x87>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+80103dfb:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+80103dfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80103e01:	c7 45 08 60 67 11 80 	movl   $0x80116760,0x8(%ebp)
+}
+80103e08:	c9                   	leave
+  release(&log.lock);
+80103e09:	e9 e2 2d 00 00       	jmp    80106bf0 <release>
+80103e0e:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+80103e10:	89 0c 95 cc 67 11 80 	mov    %ecx,-0x7fee9834(,%edx,4)
+    log.lh.n++;
+80103e17:	83 c2 01             	add    $0x1,%edx
+80103e1a:	89 15 c8 67 11 80    	mov    %edx,0x801167c8
+80103e20:	eb d9                	jmp    80103dfb <log_write+0x6b>
+    panic("too big a transaction");
+80103e22:	83 ec 0c             	sub    $0xc,%esp
+80103e25:	68 33 b7 10 80       	push   $0x8010b733
+80103e2a:	e8 b1 c5 ff ff       	call   801003e0 <panic>
+    panic("log_write outside of trans");
+80103e2f:	83 ec 0c             	sub    $0xc,%esp
+80103e32:	68 49 b7 10 80       	push   $0x8010b749
+80103e37:	e8 a4 c5 ff ff       	call   801003e0 <panic>
+80103e3c:	66 90                	xchg   %ax,%ax
+80103e3e:	66 90                	xchg   %ax,%ax
+
+80103e40 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+80103e40:	55                   	push   %ebp
+80103e41:	89 e5                	mov    %esp,%ebp
+80103e43:	53                   	push   %ebx
+80103e44:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+80103e47:	e8 b4 11 00 00       	call   80105000 <cpuid>
+80103e4c:	89 c3                	mov    %eax,%ebx
+80103e4e:	e8 ad 11 00 00       	call   80105000 <cpuid>
+80103e53:	83 ec 04             	sub    $0x4,%esp
+80103e56:	53                   	push   %ebx
+80103e57:	50                   	push   %eax
+80103e58:	68 64 b7 10 80       	push   $0x8010b764
+80103e5d:	e8 ae c8 ff ff       	call   80100710 <cprintf>
+  idtinit();       // load idt register
+80103e62:	e8 b9 59 00 00       	call   80109820 <idtinit>
+  sysenterinit();  // fast system calls
+80103e67:	e8 e4 59 00 00       	call   80109850 <sysenterinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80103e6c:	e8 af 11 00 00       	call   80105020 <mycpu>
+80103e71:	89 c2                	mov    %eax,%edx
+  asm volatile("lock; xchgl %0, %1" :
+80103e73:	b8 01 00 00 00       	mov    $0x1,%eax
+80103e78:	f0 87 82 a8 00 00 00 	lock xchg %eax,0xa8(%edx)
+  scheduler();     // start running processes
+80103e7f:	e8 4c 15 00 00       	call   801053d0 <scheduler>
+80103e84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e8f:	90                   	nop
+
+80103e90 <mpenter>:
+{
+80103e90:	55                   	push   %ebp
+80103e91:	89 e5                	mov    %esp,%ebp
+80103e93:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80103e96:	e8 e5 6b 00 00       	call   8010aa80 <switchkvm>
+  seginit();
+80103e9b:	e8 e0 6a 00 00       	call   8010a980 <seginit>
+  lapicinit();
+80103ea0:	e8 2b f6 ff ff       	call   801034d0 <lapicinit>
+  mpmain();
+80103ea5:	e8 96 ff ff ff       	call   80103e40 <mpmain>
+80103eaa:	66 90                	xchg   %ax,%ax
+80103eac:	66 90                	xchg   %ax,%ax
+80103eae:	66 90                	xchg   %ax,%ax
+
+80103eb0 <main>:
+{
+80103eb0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80103eb4:	83 e4 f0             	and    $0xfffffff0,%esp
+80103eb7:	ff 71 fc             	push   -0x4(%ecx)
+80103eba:	55                   	push   %ebp
+80103ebb:	89 e5                	mov    %esp,%ebp
+80103ebd:	53                   	push   %ebx
+80103ebe:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+80103ebf:	83 ec 08             	sub    $0x8,%esp
+80103ec2:	68 00 00 40 80       	push   $0x80400000
+80103ec7:	68 50 99 18 80       	push   $0x80189950
+80103ecc:	e8 0f f4 ff ff       	call   801032e0 <kinit1>
+  kvmalloc();      // kernel page table
+80103ed1:	e8 da 70 00 00       	call   8010afb0 <kvmalloc>
+  mpinit();        // detect other processors
+80103ed6:	e8 95 01 00 00       	call   80104070 <mpinit>
+  lapicinit();     // interrupt controller
+80103edb:	e8 f0 f5 ff ff       	call   801034d0 <lapicinit>
+  seginit();       // segment descriptors
+80103ee0:	e8 9b 6a 00 00       	call   8010a980 <seginit>
+  picinit();       // disable pic
+80103ee5:	e8 96 03 00 00       	call   80104280 <picinit>
+  ioapicinit();    // another interrupt controller
+80103eea:	e8 c1 f1 ff ff       	call   801030b0 <ioapicinit>
+  consoleinit();   // console hardware
+80103eef:	e8 fc cb ff ff       	call   80100af0 <consoleinit>
+  uartinit();      // serial port
+80103ef4:	e8 f7 5c 00 00       	call   80109bf0 <uartinit>
+  pinit();         // process table
+80103ef9:	e8 42 10 00 00       	call   80104f40 <pinit>
+  tvinit();        // trap vectors
+80103efe:	e8 bd 58 00 00       	call   801097c0 <tvinit>
+  timerinit();     // clock
+80103f03:	e8 58 4d 00 00       	call   80108c60 <timerinit>
+  profinit();      // profiler
+80103f08:	e8 b3 23 00 00       	call   801062c0 <profinit>
+  traceinit();     // event tracing
+80103f0d:	e8 7e 55 00 00       	call   80109490 <traceinit>
+  binit();         // buffer cache
+80103f12:	e8 e9 c1 ff ff       	call   80100100 <binit>
+  fileinit();      // file table
+80103f17:	e8 94 d0 ff ff       	call   80100fb0 <fileinit>
+  ideinit();       // disk 
+80103f1c:	e8 2f ef ff ff       	call   80102e50 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80103f21:	83 c4 0c             	add    $0xc,%esp
+80103f24:	68 8a 00 00 00       	push   $0x8a
+80103f29:	68 8c e6 10 80       	push   $0x8010e68c
+80103f2e:	68 00 70 00 80       	push   $0x80007000
+80103f33:	e8 08 34 00 00       	call   80107340 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80103f38:	83 c4 10             	add    $0x10,%esp
+80103f3b:	69 05 64 68 11 80 ec 	imul   $0xec,0x80116864,%eax
+80103f42:	00 00 00 
+80103f45:	05 80 68 11 80       	add    $0x80116880,%eax
+80103f4a:	3d 80 68 11 80       	cmp    $0x80116880,%eax
+80103f4f:	76 7f                	jbe    80103fd0 <main+0x120>
+80103f51:	bb 80 68 11 80       	mov    $0x80116880,%ebx
+80103f56:	eb 21                	jmp    80103f79 <main+0xc9>
+80103f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f5f:	90                   	nop
+80103f60:	69 05 64 68 11 80 ec 	imul   $0xec,0x80116864,%eax
+80103f67:	00 00 00 
+80103f6a:	81 c3 ec 00 00 00    	add    $0xec,%ebx
+80103f70:	05 80 68 11 80       	add    $0x80116880,%eax
+80103f75:	39 c3                	cmp    %eax,%ebx
+80103f77:	73 57                	jae    80103fd0 <main+0x120>
+    if(c == mycpu())  // We've started already.
+80103f79:	e8 a2 10 00 00       	call   80105020 <mycpu>
+80103f7e:	39 c3                	cmp    %eax,%ebx
+80103f80:	74 de                	je     80103f60 <main+0xb0>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80103f82:	e8 c9 f3 ff ff       	call   80103350 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80103f87:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+80103f8a:	c7 05 f8 6f 00 80 90 	movl   $0x80103e90,0x80006ff8
+80103f91:	3e 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80103f94:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+80103f9b:	d0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80103f9e:	05 00 10 00 00       	add    $0x1000,%eax
+80103fa3:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80103fa8:	0f b6 03             	movzbl (%ebx),%eax
+80103fab:	68 00 70 00 00       	push   $0x7000
+80103fb0:	50                   	push   %eax
+80103fb1:	e8 6a f7 ff ff       	call   80103720 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80103fb6:	83 c4 10             	add    $0x10,%esp
+80103fb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103fc0:	8b 83 a8 00 00 00    	mov    0xa8(%ebx),%eax
+80103fc6:	85 c0                	test   %eax,%eax
+80103fc8:	74 f6                	je     80103fc0 <main+0x110>
+80103fca:	eb 94                	jmp    80103f60 <main+0xb0>
+80103fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80103fd0:	83 ec 08             	sub    $0x8,%esp
+80103fd3:	68 00 00 00 8e       	push   $0x8e000000
+80103fd8:	68 00 00 40 80       	push   $0x80400000
+80103fdd:	e8 9e f2 ff ff       	call   80103280 <kinit2>
+  userinit();      // first user process
+80103fe2:	e8 59 10 00 00       	call   80105040 <userinit>
+  mpmain();        // finish this processor's setup
+80103fe7:	e8 54 fe ff ff       	call   80103e40 <mpmain>
+80103fec:	66 90                	xchg   %ax,%ax
+80103fee:	66 90                	xchg   %ax,%ax
+
+80103ff0 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80103ff0:	55                   	push   %ebp
+80103ff1:	89 e5                	mov    %esp,%ebp
+80103ff3:	57                   	push   %edi
+80103ff4:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80103ff5:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80103ffb:	53                   	push   %ebx
+  e = addr+len;
+80103ffc:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80103fff:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104002:	39 de                	cmp    %ebx,%esi
+80104004:	72 10                	jb     80104016 <mpsearch1+0x26>
+80104006:	eb 50                	jmp    80104058 <mpsearch1+0x68>
+80104008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010400f:	90                   	nop
+80104010:	89 fe                	mov    %edi,%esi
+80104012:	39 df                	cmp    %ebx,%edi
+80104014:	73 42                	jae    80104058 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104016:	83 ec 04             	sub    $0x4,%esp
+80104019:	8d 7e 10             	lea    0x10(%esi),%edi
+8010401c:	6a 04                	push   $0x4
+8010401e:	68 78 b7 10 80       	push   $0x8010b778
+80104023:	56                   	push   %esi
+80104024:	e8 c7 32 00 00       	call   801072f0 <memcmp>
+80104029:	83 c4 10             	add    $0x10,%esp
+8010402c:	85 c0                	test   %eax,%eax
+8010402e:	75 e0                	jne    80104010 <mpsearch1+0x20>
+80104030:	89 f2                	mov    %esi,%edx
+80104032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104038:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+8010403b:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+8010403e:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104040:	39 fa                	cmp    %edi,%edx
+80104042:	75 f4                	jne    80104038 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104044:	84 c0                	test   %al,%al
+80104046:	75 c8                	jne    80104010 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80104048:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010404b:	89 f0                	mov    %esi,%eax
+8010404d:	5b                   	pop    %ebx
+8010404e:	5e                   	pop    %esi
+8010404f:	5f                   	pop    %edi
+80104050:	5d                   	pop    %ebp
+80104051:	c3                   	ret
+80104052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104058:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010405b:	31 f6                	xor    %esi,%esi
+}
+8010405d:	5b                   	pop    %ebx
+8010405e:	89 f0                	mov    %esi,%eax
+80104060:	5e                   	pop    %esi
+80104061:	5f                   	pop    %edi
+80104062:	5d                   	pop    %ebp
+80104063:	c3                   	ret
+80104064:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010406b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010406f:	90                   	nop
+
+80104070 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80104070:	55                   	push   %ebp
+80104071:	89 e5                	mov    %esp,%ebp
+80104073:	57                   	push   %edi
+80104074:	56                   	push   %esi
+80104075:	53                   	push   %ebx
+80104076:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80104079:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104080:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80104087:	c1 e0 08             	shl    $0x8,%eax
+8010408a:	09 d0                	or     %edx,%eax
+8010408c:	c1 e0 04             	shl    $0x4,%eax
+8010408f:	75 1b                	jne    801040ac <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104091:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80104098:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010409f:	c1 e0 08             	shl    $0x8,%eax
+801040a2:	09 d0                	or     %edx,%eax
+801040a4:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+801040a7:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+801040ac:	ba 00 04 00 00       	mov    $0x400,%edx
+801040b1:	e8 3a ff ff ff       	call   80103ff0 <mpsearch1>
+801040b6:	89 c3                	mov    %eax,%ebx
+801040b8:	85 c0                	test   %eax,%eax
+801040ba:	0f 84 50 01 00 00    	je     80104210 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+801040c0:	8b 73 04             	mov    0x4(%ebx),%esi
+801040c3:	85 f6                	test   %esi,%esi
+801040c5:	0f 84 35 01 00 00    	je     80104200 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+801040cb:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+801040ce:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+801040d4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+801040d7:	6a 04                	push   $0x4
+801040d9:	68 7d b7 10 80       	push   $0x8010b77d
+801040de:	50                   	push   %eax
+801040df:	e8 0c 32 00 00       	call   801072f0 <memcmp>
+801040e4:	83 c4 10             	add    $0x10,%esp
+801040e7:	85 c0                	test   %eax,%eax
+801040e9:	0f 85 11 01 00 00    	jne    80104200 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+801040ef:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+801040f6:	3c 01                	cmp    $0x1,%al
+801040f8:	74 08                	je     80104102 <mpinit+0x92>
+801040fa:	3c 04                	cmp    $0x4,%al
+801040fc:	0f 85 fe 00 00 00    	jne    80104200 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104102:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80104109:	66 85 d2             	test   %dx,%dx
+8010410c:	74 22                	je     80104130 <mpinit+0xc0>
+8010410e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+80104111:	89 f0                	mov    %esi,%eax
+  sum = 0;
+80104113:	31 d2                	xor    %edx,%edx
+80104115:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104118:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+8010411f:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+80104122:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80104124:	39 c7                	cmp    %eax,%edi
+80104126:	75 f0                	jne    80104118 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104128:	84 d2                	test   %dl,%dl
+8010412a:	0f 85 d0 00 00 00    	jne    80104200 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80104130:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104136:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104139:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+8010413c:	a3 40 67 11 80       	mov    %eax,0x80116740
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104141:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80104148:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+8010414e:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104153:	01 d7                	add    %edx,%edi
+80104155:	89 fa                	mov    %edi,%edx
+80104157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010415e:	66 90                	xchg   %ax,%ax
+80104160:	39 d0                	cmp    %edx,%eax
+80104162:	73 15                	jae    80104179 <mpinit+0x109>
+    switch(*p){
+80104164:	0f b6 08             	movzbl (%eax),%ecx
+80104167:	80 f9 02             	cmp    $0x2,%cl
+8010416a:	74 54                	je     801041c0 <mpinit+0x150>
+8010416c:	77 42                	ja     801041b0 <mpinit+0x140>
+8010416e:	84 c9                	test   %cl,%cl
+80104170:	74 5e                	je     801041d0 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80104172:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104175:	39 d0                	cmp    %edx,%eax
+80104177:	72 eb                	jb     80104164 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80104179:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010417c:	85 f6                	test   %esi,%esi
+8010417e:	0f 84 e1 00 00 00    	je     80104265 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80104184:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80104188:	74 15                	je     8010419f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010418a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010418f:	ba 22 00 00 00       	mov    $0x22,%edx
+80104194:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104195:	ba 23 00 00 00       	mov    $0x23,%edx
+8010419a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010419b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010419e:	ee                   	out    %al,(%dx)
+  }
+}
+8010419f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801041a2:	5b                   	pop    %ebx
+801041a3:	5e                   	pop    %esi
+801041a4:	5f                   	pop    %edi
+801041a5:	5d                   	pop    %ebp
+801041a6:	c3                   	ret
+801041a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041ae:	66 90                	xchg   %ax,%ax
+    switch(*p){
+801041b0:	83 e9 03             	sub    $0x3,%ecx
+801041b3:	80 f9 01             	cmp    $0x1,%cl
+801041b6:	76 ba                	jbe    80104172 <mpinit+0x102>
+801041b8:	31 f6                	xor    %esi,%esi
+801041ba:	eb a4                	jmp    80104160 <mpinit+0xf0>
+801041bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+801041c0:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+801041c4:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+801041c7:	88 0d 60 68 11 80    	mov    %cl,0x80116860
+      continue;
+801041cd:	eb 91                	jmp    80104160 <mpinit+0xf0>
+801041cf:	90                   	nop
+      if(ncpu < NCPU) {
+801041d0:	8b 0d 64 68 11 80    	mov    0x80116864,%ecx
+801041d6:	83 f9 07             	cmp    $0x7,%ecx
+801041d9:	7f 19                	jg     801041f4 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801041db:	69 f9 ec 00 00 00    	imul   $0xec,%ecx,%edi
+801041e1:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+801041e5:	83 c1 01             	add    $0x1,%ecx
+801041e8:	89 0d 64 68 11 80    	mov    %ecx,0x80116864
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+801041ee:	88 9f 80 68 11 80    	mov    %bl,-0x7fee9780(%edi)
+      p += sizeof(struct mpproc);
+801041f4:	83 c0 14             	add    $0x14,%eax
+      continue;
+801041f7:	e9 64 ff ff ff       	jmp    80104160 <mpinit+0xf0>
+801041fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80104200:	83 ec 0c             	sub    $0xc,%esp
+80104203:	68 82 b7 10 80       	push   $0x8010b782
+80104208:	e8 d3 c1 ff ff       	call   801003e0 <panic>
+8010420d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80104210:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+80104215:	eb 13                	jmp    8010422a <mpinit+0x1ba>
+80104217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010421e:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104220:	89 f3                	mov    %esi,%ebx
+80104222:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80104228:	74 d6                	je     80104200 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010422a:	83 ec 04             	sub    $0x4,%esp
+8010422d:	8d 73 10             	lea    0x10(%ebx),%esi
+80104230:	6a 04                	push   $0x4
+80104232:	68 78 b7 10 80       	push   $0x8010b778
+80104237:	53                   	push   %ebx
+80104238:	e8 b3 30 00 00       	call   801072f0 <memcmp>
+8010423d:	83 c4 10             	add    $0x10,%esp
+80104240:	85 c0                	test   %eax,%eax
+80104242:	75 dc                	jne    80104220 <mpinit+0x1b0>
+80104244:	89 da                	mov    %ebx,%edx
+80104246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010424d:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104250:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104253:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104256:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104258:	39 f2                	cmp    %esi,%edx
+8010425a:	75 f4                	jne    80104250 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010425c:	84 c0                	test   %al,%al
+8010425e:	75 c0                	jne    80104220 <mpinit+0x1b0>
+80104260:	e9 5b fe ff ff       	jmp    801040c0 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80104265:	83 ec 0c             	sub    $0xc,%esp
+80104268:	68 9c b7 10 80       	push   $0x8010b79c
+8010426d:	e8 6e c1 ff ff       	call   801003e0 <panic>
+80104272:	66 90                	xchg   %ax,%ax
+80104274:	66 90                	xchg   %ax,%ax
+80104276:	66 90                	xchg   %ax,%ax
+80104278:	66 90                	xchg   %ax,%ax
+8010427a:	66 90                	xchg   %ax,%ax
+8010427c:	66 90                	xchg   %ax,%ax
+8010427e:	66 90                	xchg   %ax,%ax
+
+80104280 <picinit>:
+80104280:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104285:	ba 21 00 00 00       	mov    $0x21,%edx
+8010428a:	ee                   	out    %al,(%dx)
+8010428b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80104290:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80104291:	c3                   	ret
+80104292:	66 90                	xchg   %ax,%ax
+80104294:	66 90                	xchg   %ax,%ax
+80104296:	66 90                	xchg   %ax,%ax
+80104298:	66 90                	xchg   %ax,%ax
+8010429a:	66 90                	xchg   %ax,%ax
+8010429c:	66 90                	xchg   %ax,%ax
+8010429e:	66 90                	xchg   %ax,%ax
+
+801042a0 <pipealloc>:
+  kfree((char*)p);
+}
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+801042a0:	55                   	push   %ebp
+801042a1:	89 e5                	mov    %esp,%ebp
+801042a3:	57                   	push   %edi
+801042a4:	56                   	push   %esi
+801042a5:	53                   	push   %ebx
+801042a6:	83 ec 0c             	sub    $0xc,%esp
+801042a9:	8b 75 08             	mov    0x8(%ebp),%esi
+801042ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+  int i;
+
+  p = 0;
+  *f0 = *f1 = 0;
+801042af:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+801042b5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+801042bb:	e8 30 cd ff ff       	call   80100ff0 <filealloc>
+801042c0:	89 06                	mov    %eax,(%esi)
+801042c2:	85 c0                	test   %eax,%eax
+801042c4:	74 54                	je     8010431a <pipealloc+0x7a>
+801042c6:	e8 25 cd ff ff       	call   80100ff0 <filealloc>
+801042cb:	89 07                	mov    %eax,(%edi)
+801042cd:	85 c0                	test   %eax,%eax
+801042cf:	0f 84 d4 00 00 00    	je     801043a9 <pipealloc+0x109>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+801042d5:	e8 76 f0 ff ff       	call   80103350 <kalloc>
+801042da:	89 c3                	mov    %eax,%ebx
+801042dc:	85 c0                	test   %eax,%eax
+801042de:	74 28                	je     80104308 <pipealloc+0x68>
+    goto bad;
+  memset(p, 0, sizeof(*p));
+801042e0:	83 ec 04             	sub    $0x4,%esp
+801042e3:	6a 70                	push   $0x70
+801042e5:	6a 00                	push   $0x0
+801042e7:	50                   	push   %eax
+801042e8:	e8 c3 2f 00 00       	call   801072b0 <memset>
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+801042ed:	e8 5e f0 ff ff       	call   80103350 <kalloc>
+801042f2:	83 c4 10             	add    $0x10,%esp
+801042f5:	89 43 54             	mov    %eax,0x54(%ebx)
+801042f8:	85 c0                	test   %eax,%eax
+801042fa:	75 44                	jne    80104340 <pipealloc+0xa0>
+  kfree((char*)p);
+801042fc:	83 ec 0c             	sub    $0xc,%esp
+801042ff:	53                   	push   %ebx
+80104300:	e8 8b ee ff ff       	call   80103190 <kfree>
+}
+80104305:	83 c4 10             	add    $0x10,%esp
+
+//PAGEBREAK: 20
+ bad:
+  if(p)
+    pipefree(p);
+  if(*f0)
+80104308:	8b 06                	mov    (%esi),%eax
+8010430a:	85 c0                	test   %eax,%eax
+8010430c:	74 0c                	je     8010431a <pipealloc+0x7a>
+    fileclose(*f0);
+8010430e:	83 ec 0c             	sub    $0xc,%esp
+80104311:	50                   	push   %eax
+80104312:	e8 b9 cd ff ff       	call   801010d0 <fileclose>
+80104317:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+8010431a:	8b 07                	mov    (%edi),%eax
+8010431c:	85 c0                	test   %eax,%eax
+8010431e:	74 0c                	je     8010432c <pipealloc+0x8c>
+    fileclose(*f1);
+80104320:	83 ec 0c             	sub    $0xc,%esp
+80104323:	50                   	push   %eax
+80104324:	e8 a7 cd ff ff       	call   801010d0 <fileclose>
+80104329:	83 c4 10             	add    $0x10,%esp
+  return -1;
+}
+8010432c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return -1;
+8010432f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104334:	5b                   	pop    %ebx
+80104335:	5e                   	pop    %esi
+80104336:	5f                   	pop    %edi
+80104337:	5d                   	pop    %ebp
+80104338:	c3                   	ret
+80104339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  initlock(&p->lock, "pipe");
+80104340:	83 ec 08             	sub    $0x8,%esp
+  p->readopen = 1;
+80104343:	c7 43 60 01 00 00 00 	movl   $0x1,0x60(%ebx)
+  p->writeopen = 1;
+8010434a:	c7 43 64 01 00 00 00 	movl   $0x1,0x64(%ebx)
+  p->nwrite = 0;
+80104351:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+  p->nread = 0;
+80104358:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  initlock(&p->lock, "pipe");
+8010435f:	68 bb b7 10 80       	push   $0x8010b7bb
+80104364:	53                   	push   %ebx
+80104365:	e8 76 26 00 00       	call   801069e0 <initlock>
+  (*f0)->type = FD_PIPE;
+8010436a:	8b 06                	mov    (%esi),%eax
+  return 0;
+8010436c:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+8010436f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80104375:	8b 06                	mov    (%esi),%eax
+80104377:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+8010437b:	8b 06                	mov    (%esi),%eax
+8010437d:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80104381:	8b 06                	mov    (%esi),%eax
+80104383:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80104386:	8b 07                	mov    (%edi),%eax
+80104388:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+8010438e:	8b 07                	mov    (%edi),%eax
+80104390:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80104394:	8b 07                	mov    (%edi),%eax
+80104396:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+8010439a:	8b 07                	mov    (%edi),%eax
+8010439c:	89 58 0c             	mov    %ebx,0xc(%eax)
+}
+8010439f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801043a2:	31 c0                	xor    %eax,%eax
+}
+801043a4:	5b                   	pop    %ebx
+801043a5:	5e                   	pop    %esi
+801043a6:	5f                   	pop    %edi
+801043a7:	5d                   	pop    %ebp
+801043a8:	c3                   	ret
+  if(*f0)
+801043a9:	8b 06                	mov    (%esi),%eax
+801043ab:	85 c0                	test   %eax,%eax
+801043ad:	0f 85 5b ff ff ff    	jne    8010430e <pipealloc+0x6e>
+801043b3:	e9 74 ff ff ff       	jmp    8010432c <pipealloc+0x8c>
+801043b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801043bf:	90                   	nop
+
+801043c0 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+801043c0:	55                   	push   %ebp
+801043c1:	89 e5                	mov    %esp,%ebp
+801043c3:	56                   	push   %esi
+801043c4:	53                   	push   %ebx
+801043c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801043c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+801043cb:	83 ec 0c             	sub    $0xc,%esp
+801043ce:	53                   	push   %ebx
+801043cf:	e8 5c 29 00 00       	call   80106d30 <acquire>
+  if(writable){
+801043d4:	83 c4 10             	add    $0x10,%esp
+801043d7:	85 f6                	test   %esi,%esi
+801043d9:	74 35                	je     80104410 <pipeclose+0x50>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+801043db:	83 ec 0c             	sub    $0xc,%esp
+801043de:	8d 43 58             	lea    0x58(%ebx),%eax
+    p->writeopen = 0;
+801043e1:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+    wakeup(&p->nread);
+801043e8:	50                   	push   %eax
+801043e9:	e8 22 16 00 00       	call   80105a10 <wakeup>
+801043ee:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+801043f1:	8b 53 60             	mov    0x60(%ebx),%edx
+801043f4:	85 d2                	test   %edx,%edx
+801043f6:	75 07                	jne    801043ff <pipeclose+0x3f>
+801043f8:	8b 43 64             	mov    0x64(%ebx),%eax
+801043fb:	85 c0                	test   %eax,%eax
+801043fd:	74 31                	je     80104430 <pipeclose+0x70>
+    release(&p->lock);
+    pipefree(p);
+  } else
+    release(&p->lock);
+801043ff:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80104402:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104405:	5b                   	pop    %ebx
+80104406:	5e                   	pop    %esi
+80104407:	5d                   	pop    %ebp
+    release(&p->lock);
+80104408:	e9 e3 27 00 00       	jmp    80106bf0 <release>
+8010440d:	8d 76 00             	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+80104410:	83 ec 0c             	sub    $0xc,%esp
+80104413:	8d 43 5c             	lea    0x5c(%ebx),%eax
+    p->readopen = 0;
+80104416:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+    wakeup(&p->nwrite);
+8010441d:	50                   	push   %eax
+8010441e:	e8 ed 15 00 00       	call   80105a10 <wakeup>
+80104423:	83 c4 10             	add    $0x10,%esp
+80104426:	eb c9                	jmp    801043f1 <pipeclose+0x31>
+80104428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010442f:	90                   	nop
+    release(&p->lock);
+80104430:	83 ec 0c             	sub    $0xc,%esp
+80104433:	53                   	push   %ebx
+80104434:	e8 b7 27 00 00       	call   80106bf0 <release>
+    if(p->data[i])
+80104439:	8b 43 54             	mov    0x54(%ebx),%eax
+8010443c:	83 c4 10             	add    $0x10,%esp
+8010443f:	85 c0                	test   %eax,%eax
+80104441:	74 0c                	je     8010444f <pipeclose+0x8f>
+      kfree(p->data[i]);
+80104443:	83 ec 0c             	sub    $0xc,%esp
+80104446:	50                   	push   %eax
+80104447:	e8 44 ed ff ff       	call   80103190 <kfree>
+  for(i = 0; i < PIPEPAGES; i++)
+8010444c:	83 c4 10             	add    $0x10,%esp
+  kfree((char*)p);
+8010444f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80104452:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104455:	5b                   	pop    %ebx
+80104456:	5e                   	pop    %esi
+80104457:	5d                   	pop    %ebp
+  kfree((char*)p);
+80104458:	e9 33 ed ff ff       	jmp    80103190 <kfree>
+8010445d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104460 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80104460:	55                   	push   %ebp
+80104461:	89 e5                	mov    %esp,%ebp
+80104463:	57                   	push   %edi
+80104464:	56                   	push   %esi
+80104465:	53                   	push   %ebx
+80104466:	83 ec 28             	sub    $0x28,%esp
+80104469:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, m;
+  uint w;
+
+  acquire(&p->lock);
+8010446c:	53                   	push   %ebx
+8010446d:	8d 7b 58             	lea    0x58(%ebx),%edi
+80104470:	e8 bb 28 00 00       	call   80106d30 <acquire>
+  for(i = 0; i < n; i += m){
+80104475:	8b 45 10             	mov    0x10(%ebp),%eax
+80104478:	83 c4 10             	add    $0x10,%esp
+8010447b:	31 d2                	xor    %edx,%edx
+8010447d:	85 c0                	test   %eax,%eax
+8010447f:	0f 8e bb 00 00 00    	jle    80104540 <pipewrite+0xe0>
+80104485:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80104488:	8d 73 5c             	lea    0x5c(%ebx),%esi
+8010448b:	eb 27                	jmp    801044b4 <pipewrite+0x54>
+8010448d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(p->readopen == 0 || myproc()->killed){
+80104490:	e8 9b 0b 00 00       	call   80105030 <myproc>
+80104495:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+8010449b:	85 c0                	test   %eax,%eax
+8010449d:	75 32                	jne    801044d1 <pipewrite+0x71>
+      wakeup(&p->nread);
+8010449f:	83 ec 0c             	sub    $0xc,%esp
+801044a2:	57                   	push   %edi
+801044a3:	e8 68 15 00 00       	call   80105a10 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+801044a8:	5a                   	pop    %edx
+801044a9:	59                   	pop    %ecx
+801044aa:	53                   	push   %ebx
+801044ab:	56                   	push   %esi
+801044ac:	e8 af 12 00 00       	call   80105760 <sleep>
+801044b1:	83 c4 10             	add    $0x10,%esp
+    while(p->wbusy || p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+801044b4:	8b 43 68             	mov    0x68(%ebx),%eax
+801044b7:	85 c0                	test   %eax,%eax
+801044b9:	75 0f                	jne    801044ca <pipewrite+0x6a>
+801044bb:	8b 43 58             	mov    0x58(%ebx),%eax
+801044be:	8b 4b 5c             	mov    0x5c(%ebx),%ecx
+801044c1:	05 00 10 00 00       	add    $0x1000,%eax
+801044c6:	39 c1                	cmp    %eax,%ecx
+801044c8:	75 26                	jne    801044f0 <pipewrite+0x90>
+      if(p->readopen == 0 || myproc()->killed){
+801044ca:	8b 43 60             	mov    0x60(%ebx),%eax
+801044cd:	85 c0                	test   %eax,%eax
+801044cf:	75 bf                	jne    80104490 <pipewrite+0x30>
+        release(&p->lock);
+801044d1:	83 ec 0c             	sub    $0xc,%esp
+801044d4:	53                   	push   %ebx
+801044d5:	e8 16 27 00 00       	call   80106bf0 <release>
+        return -1;
+801044da:	83 c4 10             	add    $0x10,%esp
+801044dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->nwrite += m;
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+801044e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801044e5:	5b                   	pop    %ebx
+801044e6:	5e                   	pop    %esi
+801044e7:	5f                   	pop    %edi
+801044e8:	5d                   	pop    %ebp
+801044e9:	c3                   	ret
+801044ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    w = p->nwrite % PIPESIZE;
+801044f0:	89 ce                	mov    %ecx,%esi
+    m = min(n - i, PIPESIZE - (p->nwrite - p->nread));
+801044f2:	29 c8                	sub    %ecx,%eax
+    m = min(m, PGSIZE - w % PGSIZE);
+801044f4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    w = p->nwrite % PIPESIZE;
+801044f9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801044fc:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+    m = min(m, PGSIZE - w % PGSIZE);
+80104502:	29 f1                	sub    %esi,%ecx
+80104504:	39 c8                	cmp    %ecx,%eax
+80104506:	0f 46 c8             	cmovbe %eax,%ecx
+    m = min(n - i, PIPESIZE - (p->nwrite - p->nread));
+80104509:	8b 45 10             	mov    0x10(%ebp),%eax
+8010450c:	29 d0                	sub    %edx,%eax
+    m = min(m, PGSIZE - w % PGSIZE);
+8010450e:	39 c1                	cmp    %eax,%ecx
+80104510:	0f 47 c8             	cmova  %eax,%ecx
+    memmove(p->data[w / PGSIZE] + w % PGSIZE, addr + i, m);
+80104513:	83 ec 04             	sub    $0x4,%esp
+80104516:	51                   	push   %ecx
+80104517:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010451a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010451d:	01 d0                	add    %edx,%eax
+8010451f:	50                   	push   %eax
+80104520:	03 73 54             	add    0x54(%ebx),%esi
+80104523:	56                   	push   %esi
+80104524:	e8 17 2e 00 00       	call   80107340 <memmove>
+    p->nwrite += m;
+80104529:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  for(i = 0; i < n; i += m){
+8010452c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010452f:	83 c4 10             	add    $0x10,%esp
+    p->nwrite += m;
+80104532:	01 4b 5c             	add    %ecx,0x5c(%ebx)
+  for(i = 0; i < n; i += m){
+80104535:	01 ca                	add    %ecx,%edx
+80104537:	39 55 10             	cmp    %edx,0x10(%ebp)
+8010453a:	0f 8f 45 ff ff ff    	jg     80104485 <pipewrite+0x25>
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80104540:	83 ec 0c             	sub    $0xc,%esp
+80104543:	8d 43 58             	lea    0x58(%ebx),%eax
+80104546:	50                   	push   %eax
+80104547:	e8 c4 14 00 00       	call   80105a10 <wakeup>
+  release(&p->lock);
+8010454c:	89 1c 24             	mov    %ebx,(%esp)
+8010454f:	e8 9c 26 00 00       	call   80106bf0 <release>
+  return n;
+80104554:	8b 45 10             	mov    0x10(%ebp),%eax
+80104557:	83 c4 10             	add    $0x10,%esp
+8010455a:	eb 86                	jmp    801044e2 <pipewrite+0x82>
+8010455c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104560 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80104560:	55                   	push   %ebp
+80104561:	89 e5                	mov    %esp,%ebp
+80104563:	57                   	push   %edi
+80104564:	56                   	push   %esi
+80104565:	53                   	push   %ebx
+80104566:	83 ec 28             	sub    $0x28,%esp
+80104569:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, m;
+  uint r;
+
+  acquire(&p->lock);
+8010456c:	53                   	push   %ebx
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){  //DOC: pipe-empty
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+8010456d:	8d 73 58             	lea    0x58(%ebx),%esi
+  acquire(&p->lock);
+80104570:	e8 bb 27 00 00       	call   80106d30 <acquire>
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){  //DOC: pipe-empty
+80104575:	83 c4 10             	add    $0x10,%esp
+80104578:	eb 13                	jmp    8010458d <piperead+0x2d>
+8010457a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80104580:	83 ec 08             	sub    $0x8,%esp
+80104583:	53                   	push   %ebx
+80104584:	56                   	push   %esi
+80104585:	e8 d6 11 00 00       	call   80105760 <sleep>
+8010458a:	83 c4 10             	add    $0x10,%esp
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){  //DOC: pipe-empty
+8010458d:	8b 7b 6c             	mov    0x6c(%ebx),%edi
+80104590:	85 ff                	test   %edi,%edi
+80104592:	75 11                	jne    801045a5 <piperead+0x45>
+80104594:	8b 53 58             	mov    0x58(%ebx),%edx
+80104597:	8b 43 5c             	mov    0x5c(%ebx),%eax
+8010459a:	39 c2                	cmp    %eax,%edx
+8010459c:	75 32                	jne    801045d0 <piperead+0x70>
+8010459e:	8b 4b 64             	mov    0x64(%ebx),%ecx
+801045a1:	85 c9                	test   %ecx,%ecx
+801045a3:	74 2b                	je     801045d0 <piperead+0x70>
+    if(myproc()->killed){
+801045a5:	e8 86 0a 00 00       	call   80105030 <myproc>
+801045aa:	8b b8 90 00 00 00    	mov    0x90(%eax),%edi
+801045b0:	85 ff                	test   %edi,%edi
+801045b2:	74 cc                	je     80104580 <piperead+0x20>
+      release(&p->lock);
+801045b4:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801045b7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+      release(&p->lock);
+801045bc:	53                   	push   %ebx
+801045bd:	e8 2e 26 00 00       	call   80106bf0 <release>
+      return -1;
+801045c2:	83 c4 10             	add    $0x10,%esp
+    p->nread += m;
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+  return i;
+}
+801045c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801045c8:	89 f8                	mov    %edi,%eax
+801045ca:	5b                   	pop    %ebx
+801045cb:	5e                   	pop    %esi
+801045cc:	5f                   	pop    %edi
+801045cd:	5d                   	pop    %ebp
+801045ce:	c3                   	ret
+801045cf:	90                   	nop
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+801045d0:	8b 75 10             	mov    0x10(%ebp),%esi
+801045d3:	85 f6                	test   %esi,%esi
+801045d5:	7f 61                	jg     80104638 <piperead+0xd8>
+801045d7:	eb 63                	jmp    8010463c <piperead+0xdc>
+801045d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    m = min(n - i, p->nwrite - p->nread);
+801045e0:	8b 75 10             	mov    0x10(%ebp),%esi
+    r = p->nread % PIPESIZE;
+801045e3:	89 d1                	mov    %edx,%ecx
+801045e5:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    m = min(n - i, p->nwrite - p->nread);
+801045eb:	29 fe                	sub    %edi,%esi
+    m = min(m, PGSIZE - r % PGSIZE);
+801045ed:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    m = min(n - i, p->nwrite - p->nread);
+801045f0:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    m = min(m, PGSIZE - r % PGSIZE);
+801045f3:	be 00 10 00 00       	mov    $0x1000,%esi
+801045f8:	29 ce                	sub    %ecx,%esi
+801045fa:	89 f1                	mov    %esi,%ecx
+801045fc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801045ff:	39 ce                	cmp    %ecx,%esi
+80104601:	0f 46 ce             	cmovbe %esi,%ecx
+    m = min(n - i, p->nwrite - p->nread);
+80104604:	29 d0                	sub    %edx,%eax
+    m = min(m, PGSIZE - r % PGSIZE);
+80104606:	89 c6                	mov    %eax,%esi
+80104608:	39 c1                	cmp    %eax,%ecx
+8010460a:	0f 46 f1             	cmovbe %ecx,%esi
+    memmove(addr + i, p->data[r / PGSIZE] + r % PGSIZE, m);
+8010460d:	83 ec 04             	sub    $0x4,%esp
+80104610:	56                   	push   %esi
+80104611:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104614:	03 43 54             	add    0x54(%ebx),%eax
+80104617:	50                   	push   %eax
+80104618:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010461b:	01 f8                	add    %edi,%eax
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+8010461d:	01 f7                	add    %esi,%edi
+    memmove(addr + i, p->data[r / PGSIZE] + r % PGSIZE, m);
+8010461f:	50                   	push   %eax
+80104620:	e8 1b 2d 00 00       	call   80107340 <memmove>
+    p->nread += m;
+80104625:	8b 53 58             	mov    0x58(%ebx),%edx
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80104628:	83 c4 10             	add    $0x10,%esp
+    p->nread += m;
+8010462b:	01 f2                	add    %esi,%edx
+8010462d:	89 53 58             	mov    %edx,0x58(%ebx)
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80104630:	39 7d 10             	cmp    %edi,0x10(%ebp)
+80104633:	7e 07                	jle    8010463c <piperead+0xdc>
+80104635:	8b 43 5c             	mov    0x5c(%ebx),%eax
+80104638:	39 c2                	cmp    %eax,%edx
+8010463a:	75 a4                	jne    801045e0 <piperead+0x80>
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+8010463c:	83 ec 0c             	sub    $0xc,%esp
+8010463f:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80104642:	50                   	push   %eax
+80104643:	e8 c8 13 00 00       	call   80105a10 <wakeup>
+  release(&p->lock);
+80104648:	89 1c 24             	mov    %ebx,(%esp)
+8010464b:	e8 a0 25 00 00       	call   80106bf0 <release>
+  return i;
+80104650:	83 c4 10             	add    $0x10,%esp
+}
+80104653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104656:	89 f8                	mov    %edi,%eax
+80104658:	5b                   	pop    %ebx
+80104659:	5e                   	pop    %esi
+8010465a:	5f                   	pop    %edi
+8010465b:	5d                   	pop    %ebp
+8010465c:	c3                   	ret
+8010465d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104660 <pipebeginwrite>:
+// which becomes the only writer until pipeendwrite(). Sets *pp to
+// a contiguous run of free space and returns its length, at most
+// n. Returns -1 if the read end is closed or the caller killed.
+int
+pipebeginwrite(struct pipe *p, char **pp, int n)
+{
+80104660:	55                   	push   %ebp
+80104661:	89 e5                	mov    %esp,%ebp
+80104663:	57                   	push   %edi
+80104664:	56                   	push   %esi
+80104665:	53                   	push   %ebx
+80104666:	83 ec 28             	sub    $0x28,%esp
+80104669:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+  uint w;
+
+  acquire(&p->lock);
+8010466c:	53                   	push   %ebx
+  while(p->wbusy || p->nwrite == p->nread + PIPESIZE){
+    if(p->readopen == 0 || myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    wakeup(&p->nread);
+8010466d:	8d 7b 58             	lea    0x58(%ebx),%edi
+    sleep(&p->nwrite, &p->lock);
+80104670:	8d 73 5c             	lea    0x5c(%ebx),%esi
+  acquire(&p->lock);
+80104673:	e8 b8 26 00 00       	call   80106d30 <acquire>
+  while(p->wbusy || p->nwrite == p->nread + PIPESIZE){
+80104678:	83 c4 10             	add    $0x10,%esp
+8010467b:	eb 27                	jmp    801046a4 <pipebeginwrite+0x44>
+8010467d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(p->readopen == 0 || myproc()->killed){
+80104680:	e8 ab 09 00 00       	call   80105030 <myproc>
+80104685:	8b 88 90 00 00 00    	mov    0x90(%eax),%ecx
+8010468b:	85 c9                	test   %ecx,%ecx
+8010468d:	75 32                	jne    801046c1 <pipebeginwrite+0x61>
+    wakeup(&p->nread);
+8010468f:	83 ec 0c             	sub    $0xc,%esp
+80104692:	57                   	push   %edi
+80104693:	e8 78 13 00 00       	call   80105a10 <wakeup>
+    sleep(&p->nwrite, &p->lock);
+80104698:	58                   	pop    %eax
+80104699:	5a                   	pop    %edx
+8010469a:	53                   	push   %ebx
+8010469b:	56                   	push   %esi
+8010469c:	e8 bf 10 00 00       	call   80105760 <sleep>
+801046a1:	83 c4 10             	add    $0x10,%esp
+  while(p->wbusy || p->nwrite == p->nread + PIPESIZE){
+801046a4:	8b 43 68             	mov    0x68(%ebx),%eax
+801046a7:	85 c0                	test   %eax,%eax
+801046a9:	75 0f                	jne    801046ba <pipebeginwrite+0x5a>
+801046ab:	8b 43 58             	mov    0x58(%ebx),%eax
+801046ae:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801046b1:	05 00 10 00 00       	add    $0x1000,%eax
+801046b6:	39 c2                	cmp    %eax,%edx
+801046b8:	75 26                	jne    801046e0 <pipebeginwrite+0x80>
+    if(p->readopen == 0 || myproc()->killed){
+801046ba:	8b 43 60             	mov    0x60(%ebx),%eax
+801046bd:	85 c0                	test   %eax,%eax
+801046bf:	75 bf                	jne    80104680 <pipebeginwrite+0x20>
+  }
+  if(p->readopen == 0){
+    release(&p->lock);
+801046c1:	83 ec 0c             	sub    $0xc,%esp
+801046c4:	53                   	push   %ebx
+801046c5:	e8 26 25 00 00       	call   80106bf0 <release>
+    return -1;
+801046ca:	83 c4 10             	add    $0x10,%esp
+  m = min(n, PIPESIZE - (p->nwrite - p->nread));
+  m = min(m, PGSIZE - w % PGSIZE);
+  *pp = p->data[w / PGSIZE] + w % PGSIZE;
+  release(&p->lock);
+  return m;
+}
+801046cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+801046d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801046d5:	5b                   	pop    %ebx
+801046d6:	5e                   	pop    %esi
+801046d7:	5f                   	pop    %edi
+801046d8:	5d                   	pop    %ebp
+801046d9:	c3                   	ret
+801046da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(p->readopen == 0){
+801046e0:	8b 4b 60             	mov    0x60(%ebx),%ecx
+801046e3:	85 c9                	test   %ecx,%ecx
+801046e5:	74 da                	je     801046c1 <pipebeginwrite+0x61>
+  w = p->nwrite % PIPESIZE;
+801046e7:	89 d1                	mov    %edx,%ecx
+  m = min(n, PIPESIZE - (p->nwrite - p->nread));
+801046e9:	29 d0                	sub    %edx,%eax
+  m = min(m, PGSIZE - w % PGSIZE);
+801046eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  p->wbusy = 1;
+801046f0:	c7 43 68 01 00 00 00 	movl   $0x1,0x68(%ebx)
+  w = p->nwrite % PIPESIZE;
+801046f7:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  m = min(m, PGSIZE - w % PGSIZE);
+801046fd:	29 ca                	sub    %ecx,%edx
+801046ff:	39 d0                	cmp    %edx,%eax
+80104701:	0f 47 c2             	cmova  %edx,%eax
+  *pp = p->data[w / PGSIZE] + w % PGSIZE;
+80104704:	8b 55 0c             	mov    0xc(%ebp),%edx
+  m = min(m, PGSIZE - w % PGSIZE);
+80104707:	3b 45 10             	cmp    0x10(%ebp),%eax
+8010470a:	0f 47 45 10          	cmova  0x10(%ebp),%eax
+  *pp = p->data[w / PGSIZE] + w % PGSIZE;
+8010470e:	03 4b 54             	add    0x54(%ebx),%ecx
+  release(&p->lock);
+80104711:	83 ec 0c             	sub    $0xc,%esp
+  *pp = p->data[w / PGSIZE] + w % PGSIZE;
+80104714:	89 0a                	mov    %ecx,(%edx)
+  m = min(m, PGSIZE - w % PGSIZE);
+80104716:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  release(&p->lock);
+80104719:	53                   	push   %ebx
+8010471a:	e8 d1 24 00 00       	call   80106bf0 <release>
+  return m;
+8010471f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80104722:	83 c4 10             	add    $0x10,%esp
+}
+80104725:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104728:	5b                   	pop    %ebx
+80104729:	5e                   	pop    %esi
+8010472a:	5f                   	pop    %edi
+8010472b:	5d                   	pop    %ebp
+8010472c:	c3                   	ret
+8010472d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104730 <pipeendwrite>:
+
+// Publish the first m bytes of the space reserved by
+// pipebeginwrite() and give up the reservation.
+void
+pipeendwrite(struct pipe *p, int m)
+{
+80104730:	55                   	push   %ebp
+80104731:	89 e5                	mov    %esp,%ebp
+80104733:	56                   	push   %esi
+80104734:	53                   	push   %ebx
+80104735:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104738:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+8010473b:	83 ec 0c             	sub    $0xc,%esp
+8010473e:	53                   	push   %ebx
+8010473f:	e8 ec 25 00 00       	call   80106d30 <acquire>
+  p->nwrite += m;
+80104744:	01 73 5c             	add    %esi,0x5c(%ebx)
+  p->wbusy = 0;
+  wakeup(&p->nread);
+80104747:	8d 43 58             	lea    0x58(%ebx),%eax
+  p->wbusy = 0;
+8010474a:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+  wakeup(&p->nread);
+80104751:	89 04 24             	mov    %eax,(%esp)
+80104754:	e8 b7 12 00 00       	call   80105a10 <wakeup>
+  wakeup(&p->nwrite);
+80104759:	8d 43 5c             	lea    0x5c(%ebx),%eax
+8010475c:	89 04 24             	mov    %eax,(%esp)
+8010475f:	e8 ac 12 00 00       	call   80105a10 <wakeup>
+  release(&p->lock);
+80104764:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80104767:	83 c4 10             	add    $0x10,%esp
+}
+8010476a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010476d:	5b                   	pop    %ebx
+8010476e:	5e                   	pop    %esi
+8010476f:	5d                   	pop    %ebp
+  release(&p->lock);
+80104770:	e9 7b 24 00 00       	jmp    80106bf0 <release>
+80104775:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010477c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104780 <pipebeginread>:
+// which becomes the only reader until pipeendread(). Sets *pp to
+// a contiguous run of data and returns its length, at most n.
+// Returns 0 at end of file and -1 if the caller was killed.
+int
+pipebeginread(struct pipe *p, char **pp, int n)
+{
+80104780:	55                   	push   %ebp
+80104781:	89 e5                	mov    %esp,%ebp
+80104783:	57                   	push   %edi
+80104784:	56                   	push   %esi
+80104785:	53                   	push   %ebx
+80104786:	83 ec 18             	sub    $0x18,%esp
+80104789:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int m;
+  uint r;
+
+  acquire(&p->lock);
+8010478c:	53                   	push   %ebx
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock);
+8010478d:	8d 7b 58             	lea    0x58(%ebx),%edi
+  acquire(&p->lock);
+80104790:	e8 9b 25 00 00       	call   80106d30 <acquire>
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){
+80104795:	83 c4 10             	add    $0x10,%esp
+80104798:	eb 13                	jmp    801047ad <pipebeginread+0x2d>
+8010479a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sleep(&p->nread, &p->lock);
+801047a0:	83 ec 08             	sub    $0x8,%esp
+801047a3:	53                   	push   %ebx
+801047a4:	57                   	push   %edi
+801047a5:	e8 b6 0f 00 00       	call   80105760 <sleep>
+801047aa:	83 c4 10             	add    $0x10,%esp
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){
+801047ad:	8b 43 6c             	mov    0x6c(%ebx),%eax
+801047b0:	85 c0                	test   %eax,%eax
+801047b2:	75 11                	jne    801047c5 <pipebeginread+0x45>
+801047b4:	8b 53 58             	mov    0x58(%ebx),%edx
+801047b7:	8b 73 5c             	mov    0x5c(%ebx),%esi
+801047ba:	39 f2                	cmp    %esi,%edx
+801047bc:	75 32                	jne    801047f0 <pipebeginread+0x70>
+801047be:	8b 73 64             	mov    0x64(%ebx),%esi
+801047c1:	85 f6                	test   %esi,%esi
+801047c3:	74 56                	je     8010481b <pipebeginread+0x9b>
+    if(myproc()->killed){
+801047c5:	e8 66 08 00 00       	call   80105030 <myproc>
+801047ca:	8b 90 90 00 00 00    	mov    0x90(%eax),%edx
+801047d0:	85 d2                	test   %edx,%edx
+801047d2:	74 cc                	je     801047a0 <pipebeginread+0x20>
+      release(&p->lock);
+801047d4:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801047d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&p->lock);
+801047dc:	53                   	push   %ebx
+801047dd:	e8 0e 24 00 00       	call   80106bf0 <release>
+      return -1;
+801047e2:	83 c4 10             	add    $0x10,%esp
+  m = min(n, p->nwrite - p->nread);
+  m = min(m, PGSIZE - r % PGSIZE);
+  *pp = p->data[r / PGSIZE] + r % PGSIZE;
+  release(&p->lock);
+  return m;
+}
+801047e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801047e8:	89 f0                	mov    %esi,%eax
+801047ea:	5b                   	pop    %ebx
+801047eb:	5e                   	pop    %esi
+801047ec:	5f                   	pop    %edi
+801047ed:	5d                   	pop    %ebp
+801047ee:	c3                   	ret
+801047ef:	90                   	nop
+  r = p->nread % PIPESIZE;
+801047f0:	89 d0                	mov    %edx,%eax
+  m = min(n, p->nwrite - p->nread);
+801047f2:	29 d6                	sub    %edx,%esi
+  m = min(m, PGSIZE - r % PGSIZE);
+801047f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  p->rbusy = 1;
+801047f9:	c7 43 6c 01 00 00 00 	movl   $0x1,0x6c(%ebx)
+  r = p->nread % PIPESIZE;
+80104800:	25 ff 0f 00 00       	and    $0xfff,%eax
+  m = min(n, p->nwrite - p->nread);
+80104805:	3b 75 10             	cmp    0x10(%ebp),%esi
+80104808:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+  m = min(m, PGSIZE - r % PGSIZE);
+8010480c:	29 c2                	sub    %eax,%edx
+8010480e:	39 d6                	cmp    %edx,%esi
+80104810:	0f 47 f2             	cmova  %edx,%esi
+  *pp = p->data[r / PGSIZE] + r % PGSIZE;
+80104813:	8b 55 0c             	mov    0xc(%ebp),%edx
+80104816:	03 43 54             	add    0x54(%ebx),%eax
+80104819:	89 02                	mov    %eax,(%edx)
+  release(&p->lock);
+8010481b:	83 ec 0c             	sub    $0xc,%esp
+8010481e:	53                   	push   %ebx
+8010481f:	e8 cc 23 00 00       	call   80106bf0 <release>
+  return m;
+80104824:	83 c4 10             	add    $0x10,%esp
+}
+80104827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010482a:	89 f0                	mov    %esi,%eax
+8010482c:	5b                   	pop    %ebx
+8010482d:	5e                   	pop    %esi
+8010482e:	5f                   	pop    %edi
+8010482f:	5d                   	pop    %ebp
+80104830:	c3                   	ret
+80104831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104838:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010483f:	90                   	nop
+
+80104840 <pipeendread>:
+// Consume the first m bytes of the data reserved by
+// pipebeginread() and give up the reservation.
+// Returns the number of bytes still in the pipe.
+int
+pipeendread(struct pipe *p, int m)
+{
+80104840:	55                   	push   %ebp
+80104841:	89 e5                	mov    %esp,%ebp
+80104843:	56                   	push   %esi
+80104844:	53                   	push   %ebx
+80104845:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int left;
+
+  acquire(&p->lock);
+80104848:	83 ec 0c             	sub    $0xc,%esp
+8010484b:	53                   	push   %ebx
+8010484c:	e8 df 24 00 00       	call   80106d30 <acquire>
+  p->nread += m;
+  p->rbusy = 0;
+  left = p->nwrite - p->nread;
+80104851:	8b 73 5c             	mov    0x5c(%ebx),%esi
+  p->nread += m;
+80104854:	8b 45 0c             	mov    0xc(%ebp),%eax
+  p->rbusy = 0;
+80104857:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+  p->nread += m;
+8010485e:	03 43 58             	add    0x58(%ebx),%eax
+80104861:	89 43 58             	mov    %eax,0x58(%ebx)
+  left = p->nwrite - p->nread;
+80104864:	29 c6                	sub    %eax,%esi
+  wakeup(&p->nwrite);
+80104866:	8d 43 5c             	lea    0x5c(%ebx),%eax
+80104869:	89 04 24             	mov    %eax,(%esp)
+8010486c:	e8 9f 11 00 00       	call   80105a10 <wakeup>
+  wakeup(&p->nread);
+80104871:	8d 43 58             	lea    0x58(%ebx),%eax
+80104874:	89 04 24             	mov    %eax,(%esp)
+80104877:	e8 94 11 00 00       	call   80105a10 <wakeup>
+  release(&p->lock);
+8010487c:	89 1c 24             	mov    %ebx,(%esp)
+8010487f:	e8 6c 23 00 00       	call   80106bf0 <release>
+  return left;
+}
+80104884:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104887:	89 f0                	mov    %esi,%eax
+80104889:	5b                   	pop    %ebx
+8010488a:	5e                   	pop    %esi
+8010488b:	5d                   	pop    %ebp
+8010488c:	c3                   	ret
+8010488d:	66 90                	xchg   %ax,%ax
+8010488f:	90                   	nop
+
+80104890 <rusagefill>:
+}
+
+// Fill in ru from p, which must be locked.
+static void
+rusagefill(struct proc *p, struct rusage *ru)
+{
+80104890:	55                   	push   %ebp
+80104891:	89 e5                	mov    %esp,%ebp
+80104893:	56                   	push   %esi
+80104894:	89 d6                	mov    %edx,%esi
+80104896:	53                   	push   %ebx
+80104897:	89 c3                	mov    %eax,%ebx
+  int i;
+
+  ru->pid = p->pid;
+80104899:	8b 40 64             	mov    0x64(%eax),%eax
+8010489c:	89 02                	mov    %eax,(%edx)
+  ru->state = p->state;
+8010489e:	8b 43 60             	mov    0x60(%ebx),%eax
+  safestrcpy(ru->name, p->name, sizeof(ru->name));
+801048a1:	83 ec 04             	sub    $0x4,%esp
+  ru->state = p->state;
+801048a4:	89 42 04             	mov    %eax,0x4(%edx)
+  safestrcpy(ru->name, p->name, sizeof(ru->name));
+801048a7:	8d 83 d8 00 00 00    	lea    0xd8(%ebx),%eax
+801048ad:	6a 10                	push   $0x10
+801048af:	50                   	push   %eax
+801048b0:	8d 42 08             	lea    0x8(%edx),%eax
+801048b3:	50                   	push   %eax
+801048b4:	e8 a7 2b 00 00       	call   80107460 <safestrcpy>
+  ru->uticks = p->uticks;
+801048b9:	8b 83 04 01 00 00    	mov    0x104(%ebx),%eax
+  ru->sticks = p->sticks;
+  ru->cycles = p->cycles;
+  ru->nvcsw = p->nvcsw;
+  ru->nivcsw = p->nivcsw;
+  ru->nfault = p->nfault;
+  ru->nsyscall = 0;
+801048bf:	83 c4 10             	add    $0x10,%esp
+  ru->uticks = p->uticks;
+801048c2:	89 46 18             	mov    %eax,0x18(%esi)
+  ru->sticks = p->sticks;
+801048c5:	8b 83 08 01 00 00    	mov    0x108(%ebx),%eax
+801048cb:	89 46 1c             	mov    %eax,0x1c(%esi)
+  ru->cycles = p->cycles;
+801048ce:	8b 83 0c 01 00 00    	mov    0x10c(%ebx),%eax
+801048d4:	8b 93 10 01 00 00    	mov    0x110(%ebx),%edx
+801048da:	89 46 20             	mov    %eax,0x20(%esi)
+801048dd:	89 56 24             	mov    %edx,0x24(%esi)
+  ru->nvcsw = p->nvcsw;
+801048e0:	8b 83 14 01 00 00    	mov    0x114(%ebx),%eax
+  ru->nsyscall = 0;
+801048e6:	31 d2                	xor    %edx,%edx
+  ru->nvcsw = p->nvcsw;
+801048e8:	89 46 28             	mov    %eax,0x28(%esi)
+  ru->nivcsw = p->nivcsw;
+801048eb:	8b 83 18 01 00 00    	mov    0x118(%ebx),%eax
+801048f1:	89 46 2c             	mov    %eax,0x2c(%esi)
+  ru->nfault = p->nfault;
+801048f4:	8b 83 1c 01 00 00    	mov    0x11c(%ebx),%eax
+  ru->nsyscall = 0;
+801048fa:	c7 46 34 00 00 00 00 	movl   $0x0,0x34(%esi)
+  ru->nfault = p->nfault;
+80104901:	89 46 30             	mov    %eax,0x30(%esi)
+  for(i = 0; i < NSYSCALL; i++){
+80104904:	31 c0                	xor    %eax,%eax
+80104906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010490d:	8d 76 00             	lea    0x0(%esi),%esi
+    ru->syscalls[i] = p->syscalls[i];
+80104910:	8b 8c 83 20 01 00 00 	mov    0x120(%ebx,%eax,4),%ecx
+80104917:	89 4c 86 38          	mov    %ecx,0x38(%esi,%eax,4)
+    ru->nsyscall += p->syscalls[i];
+8010491b:	01 ca                	add    %ecx,%edx
+  for(i = 0; i < NSYSCALL; i++){
+8010491d:	83 c0 01             	add    $0x1,%eax
+    ru->nsyscall += p->syscalls[i];
+80104920:	89 56 34             	mov    %edx,0x34(%esi)
+  for(i = 0; i < NSYSCALL; i++){
+80104923:	83 f8 26             	cmp    $0x26,%eax
+80104926:	75 e8                	jne    80104910 <rusagefill+0x80>
+  }
+}
+80104928:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010492b:	5b                   	pop    %ebx
+8010492c:	5e                   	pop    %esi
+8010492d:	5d                   	pop    %ebp
+8010492e:	c3                   	ret
+8010492f:	90                   	nop
+
+80104930 <allocproc>:
+{
+80104930:	55                   	push   %ebp
+80104931:	89 e5                	mov    %esp,%ebp
+80104933:	53                   	push   %ebx
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104934:	bb 14 8e 11 80       	mov    $0x80118e14,%ebx
+{
+80104939:	83 ec 04             	sub    $0x4,%esp
+8010493c:	eb 20                	jmp    8010495e <allocproc+0x2e>
+8010493e:	66 90                	xchg   %ax,%ax
+    release(&p->lock);
+80104940:	83 ec 0c             	sub    $0xc,%esp
+80104943:	53                   	push   %ebx
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80104944:	81 c3 b8 01 00 00    	add    $0x1b8,%ebx
+    release(&p->lock);
+8010494a:	e8 a1 22 00 00       	call   80106bf0 <release>
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+8010494f:	83 c4 10             	add    $0x10,%esp
+80104952:	81 fb 14 fc 11 80    	cmp    $0x8011fc14,%ebx
+80104958:	0f 84 23 01 00 00    	je     80104a81 <allocproc+0x151>
+    acquire(&p->lock);
+8010495e:	83 ec 0c             	sub    $0xc,%esp
+80104961:	53                   	push   %ebx
+80104962:	e8 c9 23 00 00       	call   80106d30 <acquire>
+    if (p->state == UNUSED)
+80104967:	8b 43 60             	mov    0x60(%ebx),%eax
+8010496a:	83 c4 10             	add    $0x10,%esp
+8010496d:	85 c0                	test   %eax,%eax
+8010496f:	75 cf                	jne    80104940 <allocproc+0x10>
+  p->state = EMBRYO;
+80104971:	c7 43 60 01 00 00 00 	movl   $0x1,0x60(%ebx)
+  asm volatile("lock; xaddl %0, %1" :
+80104978:	b8 01 00 00 00       	mov    $0x1,%eax
+8010497d:	f0 0f c1 05 04 e0 10 	lock xadd %eax,0x8010e004
+80104984:	80 
+  p->pid = xadd(&nextpid, 1);
+80104985:	89 43 64             	mov    %eax,0x64(%ebx)
+  p->boostgen = boostgen;
+80104988:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+  memset(p->syscalls, 0, sizeof(p->syscalls));
+8010498d:	83 ec 04             	sub    $0x4,%esp
+  p->nice = 0;
+80104990:	c7 83 ec 00 00 00 00 	movl   $0x0,0xec(%ebx)
+80104997:	00 00 00 
+  p->boostgen = boostgen;
+8010499a:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+  memset(p->syscalls, 0, sizeof(p->syscalls));
+801049a0:	8d 83 20 01 00 00    	lea    0x120(%ebx),%eax
+  p->prio = 0;
+801049a6:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+801049ad:	00 00 00 
+  p->slice = 0;
+801049b0:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+801049b7:	00 00 00 
+  p->lastcpu = -1;
+801049ba:	c7 83 fc 00 00 00 ff 	movl   $0xffffffff,0xfc(%ebx)
+801049c1:	ff ff ff 
+  p->affinity = ~0;
+801049c4:	c7 83 00 01 00 00 ff 	movl   $0xffffffff,0x100(%ebx)
+801049cb:	ff ff ff 
+  p->uticks = p->sticks = 0;
+801049ce:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+801049d5:	00 00 00 
+801049d8:	c7 83 04 01 00 00 00 	movl   $0x0,0x104(%ebx)
+801049df:	00 00 00 
+  p->cycles = 0;
+801049e2:	c7 83 0c 01 00 00 00 	movl   $0x0,0x10c(%ebx)
+801049e9:	00 00 00 
+801049ec:	c7 83 10 01 00 00 00 	movl   $0x0,0x110(%ebx)
+801049f3:	00 00 00 
+  p->nvcsw = p->nivcsw = 0;
+801049f6:	c7 83 18 01 00 00 00 	movl   $0x0,0x118(%ebx)
+801049fd:	00 00 00 
+80104a00:	c7 83 14 01 00 00 00 	movl   $0x0,0x114(%ebx)
+80104a07:	00 00 00 
+  p->nfault = 0;
+80104a0a:	c7 83 1c 01 00 00 00 	movl   $0x0,0x11c(%ebx)
+80104a11:	00 00 00 
+  memset(p->syscalls, 0, sizeof(p->syscalls));
+80104a14:	68 98 00 00 00       	push   $0x98
+80104a19:	6a 00                	push   $0x0
+80104a1b:	50                   	push   %eax
+80104a1c:	e8 8f 28 00 00       	call   801072b0 <memset>
+  release(&p->lock); // process table slot isn't modifiable or runnable now
+80104a21:	89 1c 24             	mov    %ebx,(%esp)
+80104a24:	e8 c7 21 00 00       	call   80106bf0 <release>
+  if ((p->kstack = kalloc()) == 0) {
+80104a29:	e8 22 e9 ff ff       	call   80103350 <kalloc>
+80104a2e:	83 c4 10             	add    $0x10,%esp
+80104a31:	89 43 5c             	mov    %eax,0x5c(%ebx)
+80104a34:	85 c0                	test   %eax,%eax
+80104a36:	74 42                	je     80104a7a <allocproc+0x14a>
+  sp -= sizeof *p->tf;
+80104a38:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  memset(p->context, 0, sizeof *p->context);
+80104a3e:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80104a41:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80104a46:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+  *(uint *) sp = (uint) trapret;
+80104a4c:	c7 40 14 65 97 10 80 	movl   $0x80109765,0x14(%eax)
+  p->context = (struct context*) sp;
+80104a53:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80104a59:	6a 14                	push   $0x14
+80104a5b:	6a 00                	push   $0x0
+80104a5d:	50                   	push   %eax
+80104a5e:	e8 4d 28 00 00       	call   801072b0 <memset>
+  p->context->eip = (uint) forkret;
+80104a63:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  return p;
+80104a69:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint) forkret;
+80104a6c:	c7 40 10 90 4a 10 80 	movl   $0x80104a90,0x10(%eax)
+}
+80104a73:	89 d8                	mov    %ebx,%eax
+80104a75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a78:	c9                   	leave
+80104a79:	c3                   	ret
+    p->state = UNUSED;
+80104a7a:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+  return 0;
+80104a81:	31 db                	xor    %ebx,%ebx
+}
+80104a83:	89 d8                	mov    %ebx,%eax
+80104a85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104a88:	c9                   	leave
+80104a89:	c3                   	ret
+80104a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104a90 <forkret>:
+{
+80104a90:	55                   	push   %ebp
+80104a91:	89 e5                	mov    %esp,%ebp
+80104a93:	83 ec 14             	sub    $0x14,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80104a96:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  release(&myproc()->lock);
+80104a9c:	50                   	push   %eax
+80104a9d:	e8 4e 21 00 00       	call   80106bf0 <release>
+  if (first) {
+80104aa2:	a1 00 e0 10 80       	mov    0x8010e000,%eax
+80104aa7:	83 c4 10             	add    $0x10,%esp
+80104aaa:	85 c0                	test   %eax,%eax
+80104aac:	75 02                	jne    80104ab0 <forkret+0x20>
+}
+80104aae:	c9                   	leave
+80104aaf:	c3                   	ret
+    first = 0;
+80104ab0:	c7 05 00 e0 10 80 00 	movl   $0x0,0x8010e000
+80104ab7:	00 00 00 
+    iinit(ROOTDEV); // both part of xv6's file system code
+80104aba:	83 ec 0c             	sub    $0xc,%esp
+80104abd:	6a 01                	push   $0x1
+80104abf:	e8 1c d4 ff ff       	call   80101ee0 <iinit>
+    initlog(ROOTDEV);
+80104ac4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80104acb:	e8 20 f0 ff ff       	call   80103af0 <initlog>
+}
+80104ad0:	83 c4 10             	add    $0x10,%esp
+80104ad3:	c9                   	leave
+80104ad4:	c3                   	ret
+80104ad5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104ae0 <setrunnable>:
+{
+80104ae0:	55                   	push   %ebp
+80104ae1:	89 e5                	mov    %esp,%ebp
+80104ae3:	57                   	push   %edi
+80104ae4:	56                   	push   %esi
+80104ae5:	53                   	push   %ebx
+80104ae6:	89 c3                	mov    %eax,%ebx
+80104ae8:	83 ec 28             	sub    $0x28,%esp
+  if(!holding(&p->lock))
+80104aeb:	50                   	push   %eax
+80104aec:	e8 bf 20 00 00       	call   80106bb0 <holding>
+80104af1:	83 c4 10             	add    $0x10,%esp
+80104af4:	85 c0                	test   %eax,%eax
+80104af6:	0f 84 93 02 00 00    	je     80104d8f <setrunnable+0x2af>
+  if(p->boostgen != boostgen){
+80104afc:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80104b01:	39 83 f8 00 00 00    	cmp    %eax,0xf8(%ebx)
+80104b07:	74 21                	je     80104b2a <setrunnable+0x4a>
+    p->slice = 0;
+80104b09:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80104b10:	00 00 00 
+    p->boostgen = boostgen;
+80104b13:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80104b18:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+    p->prio = p->nice;
+80104b1e:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+80104b24:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+  p->state = RUNNABLE;
+80104b2a:	c7 43 60 03 00 00 00 	movl   $0x3,0x60(%ebx)
+  p->rqnext = 0;
+80104b31:	c7 83 e8 00 00 00 00 	movl   $0x0,0xe8(%ebx)
+80104b38:	00 00 00 
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80104b3b:	65 8b 35 00 00 00 00 	mov    %gs:0x0,%esi
+  if(p->lastcpu >= 0 && (p->affinity & (1 << p->lastcpu)))
+80104b42:	8b bb fc 00 00 00    	mov    0xfc(%ebx),%edi
+80104b48:	8b 83 00 01 00 00    	mov    0x100(%ebx),%eax
+80104b4e:	85 ff                	test   %edi,%edi
+80104b50:	78 16                	js     80104b68 <setrunnable+0x88>
+80104b52:	0f a3 f8             	bt     %edi,%eax
+80104b55:	73 11                	jae    80104b68 <setrunnable+0x88>
+  acquire(&rq->lock);
+80104b57:	6b f7 7c             	imul   $0x7c,%edi,%esi
+80104b5a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80104b5d:	81 c6 e0 89 11 80    	add    $0x801189e0,%esi
+80104b63:	eb 35                	jmp    80104b9a <setrunnable+0xba>
+80104b65:	8d 76 00             	lea    0x0(%esi),%esi
+  return mycpu()-cpus;
+80104b68:	81 ee 80 68 11 80    	sub    $0x80116880,%esi
+  else if((p->affinity & (1 << c)) == 0)
+80104b6e:	ba 01 00 00 00       	mov    $0x1,%edx
+  return mycpu()-cpus;
+80104b73:	c1 fe 02             	sar    $0x2,%esi
+80104b76:	69 fe f3 d8 8a a0    	imul   $0xa08ad8f3,%esi,%edi
+  else if((p->affinity & (1 << c)) == 0)
+80104b7c:	89 f9                	mov    %edi,%ecx
+80104b7e:	d3 e2                	shl    %cl,%edx
+80104b80:	21 c2                	and    %eax,%edx
+80104b82:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80104b85:	0f 84 75 01 00 00    	je     80104d00 <setrunnable+0x220>
+  acquire(&rq->lock);
+80104b8b:	69 f6 b4 15 41 c3    	imul   $0xc34115b4,%esi,%esi
+80104b91:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80104b94:	81 c6 e0 89 11 80    	add    $0x801189e0,%esi
+80104b9a:	83 ec 0c             	sub    $0xc,%esp
+80104b9d:	56                   	push   %esi
+80104b9e:	e8 8d 21 00 00       	call   80106d30 <acquire>
+  if(rq->q[p->prio].tail)
+80104ba3:	6b c7 7c             	imul   $0x7c,%edi,%eax
+80104ba6:	8b 93 f0 00 00 00    	mov    0xf0(%ebx),%edx
+80104bac:	83 c4 10             	add    $0x10,%esp
+80104baf:	8d 94 d0 30 8a 11 80 	lea    -0x7fee75d0(%eax,%edx,8),%edx
+80104bb6:	8b 42 08             	mov    0x8(%edx),%eax
+80104bb9:	85 c0                	test   %eax,%eax
+80104bbb:	0f 84 87 01 00 00    	je     80104d48 <setrunnable+0x268>
+    rq->q[p->prio].tail->rqnext = p;
+80104bc1:	89 98 e8 00 00 00    	mov    %ebx,0xe8(%eax)
+  rq->q[p->prio].tail = p;
+80104bc7:	6b c7 7c             	imul   $0x7c,%edi,%eax
+80104bca:	8b 93 f0 00 00 00    	mov    0xf0(%ebx),%edx
+  release(&rq->lock);
+80104bd0:	83 ec 0c             	sub    $0xc,%esp
+  rq->q[p->prio].tail = p;
+80104bd3:	89 9c d0 38 8a 11 80 	mov    %ebx,-0x7fee75c8(%eax,%edx,8)
+  n = ++rq->n;
+80104bda:	8b 90 54 8a 11 80    	mov    -0x7fee75ac(%eax),%edx
+80104be0:	83 c2 01             	add    $0x1,%edx
+80104be3:	89 90 54 8a 11 80    	mov    %edx,-0x7fee75ac(%eax)
+80104be9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  release(&rq->lock);
+80104bec:	56                   	push   %esi
+80104bed:	e8 fe 1f 00 00       	call   80106bf0 <release>
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80104bf2:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  if(p != myproc() || n > 1)
+80104bf8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80104bfb:	83 c4 10             	add    $0x10,%esp
+80104bfe:	83 fa 01             	cmp    $0x1,%edx
+80104c01:	7f 08                	jg     80104c0b <setrunnable+0x12b>
+80104c03:	39 c3                	cmp    %eax,%ebx
+80104c05:	0f 84 e4 00 00 00    	je     80104cef <setrunnable+0x20f>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80104c0b:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80104c11:	2d 80 68 11 80       	sub    $0x80116880,%eax
+80104c16:	c1 f8 02             	sar    $0x2,%eax
+80104c19:	69 c0 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%eax
+  if(c != cpuid() && xchg(&cpus[c].idle, 0)){
+80104c1f:	39 c7                	cmp    %eax,%edi
+80104c21:	74 1e                	je     80104c41 <setrunnable+0x161>
+80104c23:	69 55 e4 ec 00 00 00 	imul   $0xec,-0x1c(%ebp),%edx
+  asm volatile("lock; xchgl %0, %1" :
+80104c2a:	31 c0                	xor    %eax,%eax
+80104c2c:	81 c2 b4 00 00 00    	add    $0xb4,%edx
+80104c32:	f0 87 82 80 68 11 80 	lock xchg %eax,-0x7fee9780(%edx)
+80104c39:	85 c0                	test   %eax,%eax
+80104c3b:	0f 85 93 00 00 00    	jne    80104cd4 <setrunnable+0x1f4>
+  for(i = 0; i < ncpu; i++){
+80104c41:	a1 64 68 11 80       	mov    0x80116864,%eax
+80104c46:	ba 34 69 11 80       	mov    $0x80116934,%edx
+80104c4b:	31 c9                	xor    %ecx,%ecx
+    if(i != cpuid() && (p->affinity & (1 << i)) && xchg(&cpus[i].idle, 0)){
+80104c4d:	be 01 00 00 00       	mov    $0x1,%esi
+  for(i = 0; i < ncpu; i++){
+80104c52:	85 c0                	test   %eax,%eax
+80104c54:	7e 4c                	jle    80104ca2 <setrunnable+0x1c2>
+80104c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c5d:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80104c60:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80104c66:	2d 80 68 11 80       	sub    $0x80116880,%eax
+80104c6b:	c1 f8 02             	sar    $0x2,%eax
+80104c6e:	69 c0 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%eax
+    if(i != cpuid() && (p->affinity & (1 << i)) && xchg(&cpus[i].idle, 0)){
+80104c74:	39 c8                	cmp    %ecx,%eax
+80104c76:	74 19                	je     80104c91 <setrunnable+0x1b1>
+80104c78:	89 f0                	mov    %esi,%eax
+80104c7a:	d3 e0                	shl    %cl,%eax
+80104c7c:	23 83 00 01 00 00    	and    0x100(%ebx),%eax
+80104c82:	74 0d                	je     80104c91 <setrunnable+0x1b1>
+80104c84:	31 c0                	xor    %eax,%eax
+80104c86:	f0 87 02             	lock xchg %eax,(%edx)
+80104c89:	85 c0                	test   %eax,%eax
+80104c8b:	0f 85 cf 00 00 00    	jne    80104d60 <setrunnable+0x280>
+  for(i = 0; i < ncpu; i++){
+80104c91:	83 c1 01             	add    $0x1,%ecx
+80104c94:	81 c2 ec 00 00 00    	add    $0xec,%edx
+80104c9a:	3b 0d 64 68 11 80    	cmp    0x80116864,%ecx
+80104ca0:	7c be                	jl     80104c60 <setrunnable+0x180>
+  if(xchg(&cpus[c].unsliced, 0)){
+80104ca2:	69 55 e4 ec 00 00 00 	imul   $0xec,-0x1c(%ebp),%edx
+80104ca9:	31 c0                	xor    %eax,%eax
+80104cab:	81 c2 b8 00 00 00    	add    $0xb8,%edx
+80104cb1:	f0 87 82 80 68 11 80 	lock xchg %eax,-0x7fee9780(%edx)
+80104cb8:	85 c0                	test   %eax,%eax
+80104cba:	74 33                	je     80104cef <setrunnable+0x20f>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80104cbc:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80104cc2:	2d 80 68 11 80       	sub    $0x80116880,%eax
+80104cc7:	c1 f8 02             	sar    $0x2,%eax
+80104cca:	69 c0 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%eax
+    if(c == cpuid())
+80104cd0:	39 c7                	cmp    %eax,%edi
+80104cd2:	74 7c                	je     80104d50 <setrunnable+0x270>
+      lapicipi(cpus[c].apicid, T_IRQ0 + IRQ_RESCHED);
+80104cd4:	69 ff ec 00 00 00    	imul   $0xec,%edi,%edi
+80104cda:	83 ec 08             	sub    $0x8,%esp
+80104cdd:	6a 3e                	push   $0x3e
+80104cdf:	0f b6 87 80 68 11 80 	movzbl -0x7fee9780(%edi),%eax
+80104ce6:	50                   	push   %eax
+80104ce7:	e8 c4 ea ff ff       	call   801037b0 <lapicipi>
+80104cec:	83 c4 10             	add    $0x10,%esp
+}
+80104cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104cf2:	5b                   	pop    %ebx
+80104cf3:	5e                   	pop    %esi
+80104cf4:	5f                   	pop    %edi
+80104cf5:	5d                   	pop    %ebp
+80104cf6:	c3                   	ret
+80104cf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104cfe:	66 90                	xchg   %ax,%ax
+    for(c = 0; c < ncpu-1 && (p->affinity & (1 << c)) == 0; c++)
+80104d00:	8b 0d 64 68 11 80    	mov    0x80116864,%ecx
+80104d06:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80104d09:	83 f9 01             	cmp    $0x1,%ecx
+80104d0c:	7e 75                	jle    80104d83 <setrunnable+0x2a3>
+80104d0e:	a8 01                	test   $0x1,%al
+80104d10:	75 71                	jne    80104d83 <setrunnable+0x2a3>
+80104d12:	31 ff                	xor    %edi,%edi
+80104d14:	be 01 00 00 00       	mov    $0x1,%esi
+80104d19:	89 f9                	mov    %edi,%ecx
+80104d1b:	eb 0b                	jmp    80104d28 <setrunnable+0x248>
+80104d1d:	8d 76 00             	lea    0x0(%esi),%esi
+80104d20:	89 f7                	mov    %esi,%edi
+80104d22:	d3 e7                	shl    %cl,%edi
+80104d24:	85 c7                	test   %eax,%edi
+80104d26:	75 07                	jne    80104d2f <setrunnable+0x24f>
+80104d28:	83 c1 01             	add    $0x1,%ecx
+80104d2b:	39 ca                	cmp    %ecx,%edx
+80104d2d:	75 f1                	jne    80104d20 <setrunnable+0x240>
+  acquire(&rq->lock);
+80104d2f:	6b f1 7c             	imul   $0x7c,%ecx,%esi
+80104d32:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80104d35:	89 cf                	mov    %ecx,%edi
+80104d37:	81 c6 e0 89 11 80    	add    $0x801189e0,%esi
+80104d3d:	e9 58 fe ff ff       	jmp    80104b9a <setrunnable+0xba>
+80104d42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    rq->q[p->prio].head = p;
+80104d48:	89 5a 04             	mov    %ebx,0x4(%edx)
+80104d4b:	e9 77 fe ff ff       	jmp    80104bc7 <setrunnable+0xe7>
+}
+80104d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d53:	5b                   	pop    %ebx
+80104d54:	5e                   	pop    %esi
+80104d55:	5f                   	pop    %edi
+80104d56:	5d                   	pop    %ebp
+      timerarm();
+80104d57:	e9 94 45 00 00       	jmp    801092f0 <timerarm>
+80104d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+80104d60:	69 d1 ec 00 00 00    	imul   $0xec,%ecx,%edx
+80104d66:	83 ec 08             	sub    $0x8,%esp
+80104d69:	6a 3e                	push   $0x3e
+80104d6b:	0f b6 82 80 68 11 80 	movzbl -0x7fee9780(%edx),%eax
+80104d72:	50                   	push   %eax
+80104d73:	e8 38 ea ff ff       	call   801037b0 <lapicipi>
+      return;
+80104d78:	83 c4 10             	add    $0x10,%esp
+}
+80104d7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d7e:	5b                   	pop    %ebx
+80104d7f:	5e                   	pop    %esi
+80104d80:	5f                   	pop    %edi
+80104d81:	5d                   	pop    %ebp
+80104d82:	c3                   	ret
+    for(c = 0; c < ncpu-1 && (p->affinity & (1 << c)) == 0; c++)
+80104d83:	be e0 89 11 80       	mov    $0x801189e0,%esi
+80104d88:	31 ff                	xor    %edi,%edi
+80104d8a:	e9 0b fe ff ff       	jmp    80104b9a <setrunnable+0xba>
+    panic("setrunnable");
+80104d8f:	83 ec 0c             	sub    $0xc,%esp
+80104d92:	68 c0 b7 10 80       	push   $0x8010b7c0
+80104d97:	e8 44 b6 ff ff       	call   801003e0 <panic>
+80104d9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104da0 <dequeue>:
+{
+80104da0:	55                   	push   %ebp
+80104da1:	89 e5                	mov    %esp,%ebp
+80104da3:	57                   	push   %edi
+80104da4:	56                   	push   %esi
+80104da5:	89 c6                	mov    %eax,%esi
+80104da7:	53                   	push   %ebx
+80104da8:	83 ec 2c             	sub    $0x2c,%esp
+  if(rq->n == 0)  // peek without the lock, so idle CPUs leave it alone
+80104dab:	8b 40 74             	mov    0x74(%eax),%eax
+{
+80104dae:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  if(rq->n == 0)  // peek without the lock, so idle CPUs leave it alone
+80104db1:	85 c0                	test   %eax,%eax
+80104db3:	0f 84 63 01 00 00    	je     80104f1c <dequeue+0x17c>
+  if(rq->boostgen != boostgen)
+80104db9:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80104dbe:	39 46 78             	cmp    %eax,0x78(%esi)
+80104dc1:	0f 85 a9 00 00 00    	jne    80104e70 <dequeue+0xd0>
+  acquire(&rq->lock);
+80104dc7:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPRIO && p == 0; i++){
+80104dca:	31 ff                	xor    %edi,%edi
+  acquire(&rq->lock);
+80104dcc:	56                   	push   %esi
+80104dcd:	e8 5e 1f 00 00       	call   80106d30 <acquire>
+      if(p->affinity & (1 << id))
+80104dd2:	0f b6 4d d4          	movzbl -0x2c(%ebp),%ecx
+80104dd6:	b8 01 00 00 00       	mov    $0x1,%eax
+80104ddb:	83 c4 10             	add    $0x10,%esp
+80104dde:	d3 e0                	shl    %cl,%eax
+80104de0:	89 c1                	mov    %eax,%ecx
+    for(p = rq->q[i].head; p; prev = p, p = p->rqnext)
+80104de2:	8b 5c fe 54          	mov    0x54(%esi,%edi,8),%ebx
+80104de6:	85 db                	test   %ebx,%ebx
+80104de8:	74 56                	je     80104e40 <dequeue+0xa0>
+    prev = 0;
+80104dea:	31 d2                	xor    %edx,%edx
+80104dec:	eb 0a                	jmp    80104df8 <dequeue+0x58>
+80104dee:	66 90                	xchg   %ax,%ax
+    for(p = rq->q[i].head; p; prev = p, p = p->rqnext)
+80104df0:	89 da                	mov    %ebx,%edx
+80104df2:	85 c0                	test   %eax,%eax
+80104df4:	74 4a                	je     80104e40 <dequeue+0xa0>
+80104df6:	89 c3                	mov    %eax,%ebx
+      if(p->affinity & (1 << id))
+80104df8:	89 c8                	mov    %ecx,%eax
+80104dfa:	23 83 00 01 00 00    	and    0x100(%ebx),%eax
+      prev->rqnext = p->rqnext;
+80104e00:	8b 83 e8 00 00 00    	mov    0xe8(%ebx),%eax
+      if(p->affinity & (1 << id))
+80104e06:	74 e8                	je     80104df0 <dequeue+0x50>
+    if(prev)
+80104e08:	85 d2                	test   %edx,%edx
+80104e0a:	74 54                	je     80104e60 <dequeue+0xc0>
+      prev->rqnext = p->rqnext;
+80104e0c:	89 82 e8 00 00 00    	mov    %eax,0xe8(%edx)
+80104e12:	83 c7 0a             	add    $0xa,%edi
+    if(rq->q[i].tail == p)
+80104e15:	39 5c fe 08          	cmp    %ebx,0x8(%esi,%edi,8)
+80104e19:	74 35                	je     80104e50 <dequeue+0xb0>
+    rq->n--;
+80104e1b:	8b 46 74             	mov    0x74(%esi),%eax
+80104e1e:	83 e8 01             	sub    $0x1,%eax
+80104e21:	89 46 74             	mov    %eax,0x74(%esi)
+  release(&rq->lock);
+80104e24:	83 ec 0c             	sub    $0xc,%esp
+80104e27:	56                   	push   %esi
+80104e28:	e8 c3 1d 00 00       	call   80106bf0 <release>
+  return p;
+80104e2d:	83 c4 10             	add    $0x10,%esp
+}
+80104e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104e33:	89 d8                	mov    %ebx,%eax
+80104e35:	5b                   	pop    %ebx
+80104e36:	5e                   	pop    %esi
+80104e37:	5f                   	pop    %edi
+80104e38:	5d                   	pop    %ebp
+80104e39:	c3                   	ret
+80104e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < NPRIO && p == 0; i++){
+80104e40:	83 c7 01             	add    $0x1,%edi
+80104e43:	83 ff 04             	cmp    $0x4,%edi
+80104e46:	75 9a                	jne    80104de2 <dequeue+0x42>
+80104e48:	31 db                	xor    %ebx,%ebx
+80104e4a:	eb d8                	jmp    80104e24 <dequeue+0x84>
+80104e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      rq->q[i].tail = prev;
+80104e50:	89 54 fe 08          	mov    %edx,0x8(%esi,%edi,8)
+80104e54:	eb c5                	jmp    80104e1b <dequeue+0x7b>
+80104e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e5d:	8d 76 00             	lea    0x0(%esi),%esi
+      rq->q[i].head = p->rqnext;
+80104e60:	83 c7 0a             	add    $0xa,%edi
+80104e63:	89 44 fe 04          	mov    %eax,0x4(%esi,%edi,8)
+80104e67:	eb ac                	jmp    80104e15 <dequeue+0x75>
+80104e69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  acquire(&rq->lock);
+80104e70:	83 ec 0c             	sub    $0xc,%esp
+80104e73:	56                   	push   %esi
+80104e74:	e8 b7 1e 00 00       	call   80106d30 <acquire>
+  if(rq->boostgen == boostgen){
+80104e79:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80104e7e:	83 c4 10             	add    $0x10,%esp
+80104e81:	39 46 78             	cmp    %eax,0x78(%esi)
+80104e84:	0f 84 9e 00 00 00    	je     80104f28 <dequeue+0x188>
+  rq->boostgen = boostgen;
+80104e8a:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+  list = 0;
+80104e8f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+80104e96:	8d 5e 74             	lea    0x74(%esi),%ebx
+  tail = &list;
+80104e99:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  rq->boostgen = boostgen;
+80104e9c:	89 46 78             	mov    %eax,0x78(%esi)
+  for(i = 0; i < NPRIO; i++){
+80104e9f:	8d 46 54             	lea    0x54(%esi),%eax
+    if(rq->q[i].head){
+80104ea2:	8b 08                	mov    (%eax),%ecx
+80104ea4:	85 c9                	test   %ecx,%ecx
+80104ea6:	74 0b                	je     80104eb3 <dequeue+0x113>
+      *tail = rq->q[i].head;
+80104ea8:	89 0a                	mov    %ecx,(%edx)
+      tail = &rq->q[i].tail->rqnext;
+80104eaa:	8b 78 04             	mov    0x4(%eax),%edi
+80104ead:	8d 97 e8 00 00 00    	lea    0xe8(%edi),%edx
+    rq->q[i].head = rq->q[i].tail = 0;
+80104eb3:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  for(i = 0; i < NPRIO; i++){
+80104eba:	83 c0 08             	add    $0x8,%eax
+    rq->q[i].head = rq->q[i].tail = 0;
+80104ebd:	c7 40 f8 00 00 00 00 	movl   $0x0,-0x8(%eax)
+  for(i = 0; i < NPRIO; i++){
+80104ec4:	39 d8                	cmp    %ebx,%eax
+80104ec6:	75 da                	jne    80104ea2 <dequeue+0x102>
+  release(&rq->lock);
+80104ec8:	83 ec 0c             	sub    $0xc,%esp
+  rq->n = 0;
+80104ecb:	c7 46 74 00 00 00 00 	movl   $0x0,0x74(%esi)
+  release(&rq->lock);
+80104ed2:	56                   	push   %esi
+80104ed3:	e8 18 1d 00 00       	call   80106bf0 <release>
+  for(p = list; p; p = next){
+80104ed8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104edb:	83 c4 10             	add    $0x10,%esp
+80104ede:	85 ff                	test   %edi,%edi
+80104ee0:	0f 84 e1 fe ff ff    	je     80104dc7 <dequeue+0x27>
+80104ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104eed:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&p->lock);
+80104ef0:	83 ec 0c             	sub    $0xc,%esp
+80104ef3:	89 fb                	mov    %edi,%ebx
+    next = p->rqnext;
+80104ef5:	8b bf e8 00 00 00    	mov    0xe8(%edi),%edi
+    acquire(&p->lock);
+80104efb:	53                   	push   %ebx
+80104efc:	e8 2f 1e 00 00       	call   80106d30 <acquire>
+    setrunnable(p);
+80104f01:	89 d8                	mov    %ebx,%eax
+80104f03:	e8 d8 fb ff ff       	call   80104ae0 <setrunnable>
+    release(&p->lock);
+80104f08:	89 1c 24             	mov    %ebx,(%esp)
+80104f0b:	e8 e0 1c 00 00       	call   80106bf0 <release>
+  for(p = list; p; p = next){
+80104f10:	83 c4 10             	add    $0x10,%esp
+80104f13:	85 ff                	test   %edi,%edi
+80104f15:	75 d9                	jne    80104ef0 <dequeue+0x150>
+80104f17:	e9 ab fe ff ff       	jmp    80104dc7 <dequeue+0x27>
+}
+80104f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80104f1f:	31 db                	xor    %ebx,%ebx
+}
+80104f21:	89 d8                	mov    %ebx,%eax
+80104f23:	5b                   	pop    %ebx
+80104f24:	5e                   	pop    %esi
+80104f25:	5f                   	pop    %edi
+80104f26:	5d                   	pop    %ebp
+80104f27:	c3                   	ret
+    release(&rq->lock);
+80104f28:	83 ec 0c             	sub    $0xc,%esp
+80104f2b:	56                   	push   %esi
+80104f2c:	e8 bf 1c 00 00       	call   80106bf0 <release>
+    return;
+80104f31:	83 c4 10             	add    $0x10,%esp
+80104f34:	e9 8e fe ff ff       	jmp    80104dc7 <dequeue+0x27>
+80104f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104f40 <pinit>:
+{
+80104f40:	55                   	push   %ebp
+80104f41:	89 e5                	mov    %esp,%ebp
+80104f43:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80104f44:	bb 14 8e 11 80       	mov    $0x80118e14,%ebx
+{
+80104f49:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable"); // see spinlock.c for function def
+80104f4c:	68 cc b7 10 80       	push   $0x8010b7cc
+80104f51:	68 c0 8d 11 80       	push   $0x80118dc0
+80104f56:	e8 85 1a 00 00       	call   801069e0 <initlock>
+80104f5b:	83 c4 10             	add    $0x10,%esp
+80104f5e:	66 90                	xchg   %ax,%ax
+    initlock(&p->lock, "proc");
+80104f60:	83 ec 08             	sub    $0x8,%esp
+80104f63:	68 d3 b7 10 80       	push   $0x8010b7d3
+80104f68:	53                   	push   %ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80104f69:	81 c3 b8 01 00 00    	add    $0x1b8,%ebx
+    initlock(&p->lock, "proc");
+80104f6f:	e8 6c 1a 00 00       	call   801069e0 <initlock>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80104f74:	83 c4 10             	add    $0x10,%esp
+80104f77:	81 fb 14 fc 11 80    	cmp    $0x8011fc14,%ebx
+80104f7d:	75 e1                	jne    80104f60 <pinit+0x20>
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80104f7f:	bb e0 89 11 80       	mov    $0x801189e0,%ebx
+80104f84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&rq->lock, "runq");
+80104f88:	83 ec 08             	sub    $0x8,%esp
+80104f8b:	68 d8 b7 10 80       	push   $0x8010b7d8
+80104f90:	53                   	push   %ebx
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80104f91:	83 c3 7c             	add    $0x7c,%ebx
+    initlock(&rq->lock, "runq");
+80104f94:	e8 47 1a 00 00       	call   801069e0 <initlock>
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+80104f99:	83 c4 10             	add    $0x10,%esp
+80104f9c:	81 fb c0 8d 11 80    	cmp    $0x80118dc0,%ebx
+80104fa2:	75 e4                	jne    80104f88 <pinit+0x48>
+  for(sq = sleepq; sq < &sleepq[NSLEEPQ]; sq++)
+80104fa4:	bb e0 73 11 80       	mov    $0x801173e0,%ebx
+80104fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&sq->lock, "sleepq");
+80104fb0:	83 ec 08             	sub    $0x8,%esp
+80104fb3:	68 dd b7 10 80       	push   $0x8010b7dd
+80104fb8:	53                   	push   %ebx
+  for(sq = sleepq; sq < &sleepq[NSLEEPQ]; sq++)
+80104fb9:	83 c3 58             	add    $0x58,%ebx
+    initlock(&sq->lock, "sleepq");
+80104fbc:	e8 1f 1a 00 00       	call   801069e0 <initlock>
+  for(sq = sleepq; sq < &sleepq[NSLEEPQ]; sq++)
+80104fc1:	83 c4 10             	add    $0x10,%esp
+80104fc4:	81 fb e0 89 11 80    	cmp    $0x801189e0,%ebx
+80104fca:	75 e4                	jne    80104fb0 <pinit+0x70>
+  for(ph = pidhash; ph < &pidhash[NPIDHASH]; ph++)
+80104fcc:	bb e0 6f 11 80       	mov    $0x80116fe0,%ebx
+80104fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    initrwlock(&ph->lock, "pidhash");
+80104fd8:	83 ec 08             	sub    $0x8,%esp
+80104fdb:	68 e4 b7 10 80       	push   $0x8010b7e4
+80104fe0:	53                   	push   %ebx
+  for(ph = pidhash; ph < &pidhash[NPIDHASH]; ph++)
+80104fe1:	83 c3 10             	add    $0x10,%ebx
+    initrwlock(&ph->lock, "pidhash");
+80104fe4:	e8 c7 15 00 00       	call   801065b0 <initrwlock>
+  for(ph = pidhash; ph < &pidhash[NPIDHASH]; ph++)
+80104fe9:	83 c4 10             	add    $0x10,%esp
+80104fec:	81 fb e0 73 11 80    	cmp    $0x801173e0,%ebx
+80104ff2:	75 e4                	jne    80104fd8 <pinit+0x98>
+}
+80104ff4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ff7:	c9                   	leave
+80104ff8:	c3                   	ret
+80104ff9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105000 <cpuid>:
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105000:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80105006:	2d 80 68 11 80       	sub    $0x80116880,%eax
+8010500b:	c1 f8 02             	sar    $0x2,%eax
+8010500e:	69 c0 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%eax
+}
+80105014:	c3                   	ret
+80105015:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010501c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105020 <mycpu>:
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105020:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+}
+80105026:	c3                   	ret
+80105027:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010502e:	66 90                	xchg   %ax,%ax
+
+80105030 <myproc>:
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105030:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+}
+80105036:	c3                   	ret
+80105037:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010503e:	66 90                	xchg   %ax,%ax
+
+80105040 <userinit>:
+{
+80105040:	55                   	push   %ebp
+80105041:	89 e5                	mov    %esp,%ebp
+80105043:	56                   	push   %esi
+80105044:	53                   	push   %ebx
+  p = allocproc();
+80105045:	e8 e6 f8 ff ff       	call   80104930 <allocproc>
+8010504a:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+8010504c:	a3 14 fc 11 80       	mov    %eax,0x8011fc14
+  if((p->pgdir = setupkvm()) == 0)
+80105051:	e8 da 5e 00 00       	call   8010af30 <setupkvm>
+80105056:	89 43 58             	mov    %eax,0x58(%ebx)
+80105059:	85 c0                	test   %eax,%eax
+8010505b:	0f 84 1f 01 00 00    	je     80105180 <userinit+0x140>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105061:	83 ec 04             	sub    $0x4,%esp
+80105064:	68 2c 00 00 00       	push   $0x2c
+80105069:	68 60 e6 10 80       	push   $0x8010e660
+8010506e:	50                   	push   %eax
+8010506f:	e8 3c 5b 00 00       	call   8010abb0 <inituvm>
+  if(mapvdso(p->pgdir, p->pid) < 0)
+80105074:	5e                   	pop    %esi
+80105075:	58                   	pop    %eax
+80105076:	ff 73 64             	push   0x64(%ebx)
+80105079:	ff 73 58             	push   0x58(%ebx)
+8010507c:	e8 8f 5d 00 00       	call   8010ae10 <mapvdso>
+80105081:	83 c4 10             	add    $0x10,%esp
+80105084:	85 c0                	test   %eax,%eax
+80105086:	0f 88 f4 00 00 00    	js     80105180 <userinit+0x140>
+  memset(p->tf, 0, sizeof(*p->tf));
+8010508c:	83 ec 04             	sub    $0x4,%esp
+  p->sz = PGSIZE;
+8010508f:	c7 43 54 00 10 00 00 	movl   $0x1000,0x54(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105096:	6a 4c                	push   $0x4c
+80105098:	6a 00                	push   $0x0
+8010509a:	ff b3 80 00 00 00    	push   0x80(%ebx)
+801050a0:	e8 0b 22 00 00       	call   801072b0 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+801050a5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050ab:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+801050b0:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+801050b3:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+801050b8:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+801050bc:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050c2:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+801050c6:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050cc:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+801050d0:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+801050d4:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050da:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+801050de:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+801050e2:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050e8:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+801050ef:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801050f5:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+801050fc:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80105102:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105109:	8d 83 d8 00 00 00    	lea    0xd8(%ebx),%eax
+8010510f:	6a 10                	push   $0x10
+80105111:	68 05 b8 10 80       	push   $0x8010b805
+80105116:	50                   	push   %eax
+80105117:	e8 44 23 00 00       	call   80107460 <safestrcpy>
+  p->cwd = namei("/");
+8010511c:	c7 04 24 0e b8 10 80 	movl   $0x8010b80e,(%esp)
+80105123:	e8 08 dc ff ff       	call   80102d30 <namei>
+80105128:	89 83 d4 00 00 00    	mov    %eax,0xd4(%ebx)
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+8010512e:	8b 43 64             	mov    0x64(%ebx),%eax
+80105131:	99                   	cltd
+80105132:	c1 ea 1a             	shr    $0x1a,%edx
+80105135:	8d 34 10             	lea    (%eax,%edx,1),%esi
+80105138:	83 e6 3f             	and    $0x3f,%esi
+8010513b:	29 d6                	sub    %edx,%esi
+  acquirewrite(&ph->lock);
+8010513d:	c1 e6 04             	shl    $0x4,%esi
+80105140:	81 c6 e0 6f 11 80    	add    $0x80116fe0,%esi
+80105146:	89 34 24             	mov    %esi,(%esp)
+80105149:	e8 02 15 00 00       	call   80106650 <acquirewrite>
+  p->pidnext = ph->head;
+8010514e:	8b 46 0c             	mov    0xc(%esi),%eax
+80105151:	89 43 7c             	mov    %eax,0x7c(%ebx)
+  ph->head = p;
+80105154:	89 5e 0c             	mov    %ebx,0xc(%esi)
+  releasewrite(&ph->lock);
+80105157:	89 34 24             	mov    %esi,(%esp)
+8010515a:	e8 61 15 00 00       	call   801066c0 <releasewrite>
+  acquire(&p->lock);
+8010515f:	89 1c 24             	mov    %ebx,(%esp)
+80105162:	e8 c9 1b 00 00       	call   80106d30 <acquire>
+  setrunnable(p);
+80105167:	89 d8                	mov    %ebx,%eax
+80105169:	e8 72 f9 ff ff       	call   80104ae0 <setrunnable>
+  release(&p->lock);
+8010516e:	89 1c 24             	mov    %ebx,(%esp)
+80105171:	e8 7a 1a 00 00       	call   80106bf0 <release>
+}
+80105176:	83 c4 10             	add    $0x10,%esp
+80105179:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010517c:	5b                   	pop    %ebx
+8010517d:	5e                   	pop    %esi
+8010517e:	5d                   	pop    %ebp
+8010517f:	c3                   	ret
+    panic("userinit: out of memory?");
+80105180:	83 ec 0c             	sub    $0xc,%esp
+80105183:	68 ec b7 10 80       	push   $0x8010b7ec
+80105188:	e8 53 b2 ff ff       	call   801003e0 <panic>
+8010518d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105190 <growproc>:
+{
+80105190:	55                   	push   %ebp
+80105191:	89 e5                	mov    %esp,%ebp
+80105193:	53                   	push   %ebx
+80105194:	83 ec 04             	sub    $0x4,%esp
+80105197:	8b 55 08             	mov    0x8(%ebp),%edx
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+8010519a:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  sz = curproc->sz;
+801051a1:	8b 43 54             	mov    0x54(%ebx),%eax
+  if (n > 0) {
+801051a4:	85 d2                	test   %edx,%edx
+801051a6:	7f 18                	jg     801051c0 <growproc+0x30>
+  } else if (n < 0) {
+801051a8:	75 36                	jne    801051e0 <growproc+0x50>
+  switchuvm(curproc); // update the page directory and TSS stored by hardware
+801051aa:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+801051ad:	89 43 54             	mov    %eax,0x54(%ebx)
+  switchuvm(curproc); // update the page directory and TSS stored by hardware
+801051b0:	53                   	push   %ebx
+801051b1:	e8 da 58 00 00       	call   8010aa90 <switchuvm>
+  return 0;
+801051b6:	83 c4 10             	add    $0x10,%esp
+801051b9:	31 c0                	xor    %eax,%eax
+}
+801051bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801051be:	c9                   	leave
+801051bf:	c3                   	ret
+    if ((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+801051c0:	83 ec 04             	sub    $0x4,%esp
+801051c3:	01 c2                	add    %eax,%edx
+801051c5:	52                   	push   %edx
+801051c6:	50                   	push   %eax
+801051c7:	ff 73 58             	push   0x58(%ebx)
+801051ca:	e8 31 5b 00 00       	call   8010ad00 <allocuvm>
+801051cf:	83 c4 10             	add    $0x10,%esp
+801051d2:	85 c0                	test   %eax,%eax
+801051d4:	75 d4                	jne    801051aa <growproc+0x1a>
+      return -1;
+801051d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801051db:	eb de                	jmp    801051bb <growproc+0x2b>
+801051dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if ((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+801051e0:	83 ec 04             	sub    $0x4,%esp
+801051e3:	01 c2                	add    %eax,%edx
+801051e5:	52                   	push   %edx
+801051e6:	50                   	push   %eax
+801051e7:	ff 73 58             	push   0x58(%ebx)
+801051ea:	e8 91 5c 00 00       	call   8010ae80 <deallocuvm>
+801051ef:	83 c4 10             	add    $0x10,%esp
+801051f2:	85 c0                	test   %eax,%eax
+801051f4:	75 b4                	jne    801051aa <growproc+0x1a>
+801051f6:	eb de                	jmp    801051d6 <growproc+0x46>
+801051f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801051ff:	90                   	nop
+
+80105200 <fork>:
+{
+80105200:	55                   	push   %ebp
+80105201:	89 e5                	mov    %esp,%ebp
+80105203:	57                   	push   %edi
+80105204:	56                   	push   %esi
+80105205:	53                   	push   %ebx
+80105206:	83 ec 1c             	sub    $0x1c,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105209:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if((np = allocproc()) == 0){
+80105210:	e8 1b f7 ff ff       	call   80104930 <allocproc>
+80105215:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105218:	85 c0                	test   %eax,%eax
+8010521a:	0f 84 9b 01 00 00    	je     801053bb <fork+0x1bb>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+80105220:	83 ec 08             	sub    $0x8,%esp
+80105223:	ff 73 54             	push   0x54(%ebx)
+80105226:	89 c6                	mov    %eax,%esi
+80105228:	ff 73 58             	push   0x58(%ebx)
+8010522b:	e8 f0 5d 00 00       	call   8010b020 <copyuvm>
+80105230:	83 c4 10             	add    $0x10,%esp
+80105233:	89 46 58             	mov    %eax,0x58(%esi)
+80105236:	85 c0                	test   %eax,%eax
+80105238:	0f 84 5e 01 00 00    	je     8010539c <fork+0x19c>
+     mapvdso(np->pgdir, np->pid) < 0){
+8010523e:	83 ec 08             	sub    $0x8,%esp
+80105241:	ff 76 64             	push   0x64(%esi)
+80105244:	50                   	push   %eax
+80105245:	e8 c6 5b 00 00       	call   8010ae10 <mapvdso>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+8010524a:	83 c4 10             	add    $0x10,%esp
+8010524d:	85 c0                	test   %eax,%eax
+8010524f:	0f 88 31 01 00 00    	js     80105386 <fork+0x186>
+  np->sz = curproc->sz;
+80105255:	8b 43 54             	mov    0x54(%ebx),%eax
+80105258:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  *np->tf = *curproc->tf;
+8010525b:	b9 13 00 00 00       	mov    $0x13,%ecx
+  np->sz = curproc->sz;
+80105260:	89 42 54             	mov    %eax,0x54(%edx)
+  *np->tf = *curproc->tf;
+80105263:	8b ba 80 00 00 00    	mov    0x80(%edx),%edi
+80105269:	8b b3 80 00 00 00    	mov    0x80(%ebx),%esi
+8010526f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for (i = 0; i < NOFILE; i++)
+80105271:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+80105273:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+80105279:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+    if (curproc->ofile[i])
+80105280:	8b 84 b3 94 00 00 00 	mov    0x94(%ebx,%esi,4),%eax
+80105287:	85 c0                	test   %eax,%eax
+80105289:	74 16                	je     801052a1 <fork+0xa1>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+8010528b:	83 ec 0c             	sub    $0xc,%esp
+8010528e:	50                   	push   %eax
+8010528f:	e8 0c be ff ff       	call   801010a0 <filedup>
+80105294:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105297:	83 c4 10             	add    $0x10,%esp
+8010529a:	89 84 b1 94 00 00 00 	mov    %eax,0x94(%ecx,%esi,4)
+  for (i = 0; i < NOFILE; i++)
+801052a1:	83 c6 01             	add    $0x1,%esi
+801052a4:	83 fe 10             	cmp    $0x10,%esi
+801052a7:	75 d7                	jne    80105280 <fork+0x80>
+  np->cwd = idup(curproc->cwd);
+801052a9:	83 ec 0c             	sub    $0xc,%esp
+801052ac:	ff b3 d4 00 00 00    	push   0xd4(%ebx)
+801052b2:	e8 29 ce ff ff       	call   801020e0 <idup>
+801052b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801052ba:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+801052bd:	89 87 d4 00 00 00    	mov    %eax,0xd4(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801052c3:	8d 83 d8 00 00 00    	lea    0xd8(%ebx),%eax
+801052c9:	6a 10                	push   $0x10
+801052cb:	50                   	push   %eax
+801052cc:	8d 87 d8 00 00 00    	lea    0xd8(%edi),%eax
+801052d2:	50                   	push   %eax
+801052d3:	e8 88 21 00 00       	call   80107460 <safestrcpy>
+  np->nice = curproc->nice;
+801052d8:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+  pid = np->pid;
+801052de:	8b 77 64             	mov    0x64(%edi),%esi
+  np->nice = curproc->nice;
+801052e1:	89 87 ec 00 00 00    	mov    %eax,0xec(%edi)
+  np->affinity = curproc->affinity;
+801052e7:	8b 83 00 01 00 00    	mov    0x100(%ebx),%eax
+801052ed:	89 87 00 01 00 00    	mov    %eax,0x100(%edi)
+  acquire(&ptable.lock);
+801052f3:	c7 04 24 c0 8d 11 80 	movl   $0x80118dc0,(%esp)
+801052fa:	e8 31 1a 00 00       	call   80106d30 <acquire>
+  np->parent = curproc;
+801052ff:	89 5f 68             	mov    %ebx,0x68(%edi)
+  p->sibling = *list;
+80105302:	8b 43 6c             	mov    0x6c(%ebx),%eax
+  if(*list)
+80105305:	83 c4 10             	add    $0x10,%esp
+  p->sibling = *list;
+80105308:	89 47 74             	mov    %eax,0x74(%edi)
+  childpush(&curproc->kids, np);
+8010530b:	8d 43 6c             	lea    0x6c(%ebx),%eax
+8010530e:	89 47 78             	mov    %eax,0x78(%edi)
+  if(*list)
+80105311:	8b 43 6c             	mov    0x6c(%ebx),%eax
+80105314:	85 c0                	test   %eax,%eax
+80105316:	74 06                	je     8010531e <fork+0x11e>
+    (*list)->sibprev = &p->sibling;
+80105318:	8d 57 74             	lea    0x74(%edi),%edx
+8010531b:	89 50 78             	mov    %edx,0x78(%eax)
+  *list = p;
+8010531e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  release(&ptable.lock);
+80105321:	83 ec 0c             	sub    $0xc,%esp
+  *list = p;
+80105324:	89 7b 6c             	mov    %edi,0x6c(%ebx)
+  release(&ptable.lock);
+80105327:	68 c0 8d 11 80       	push   $0x80118dc0
+8010532c:	e8 bf 18 00 00       	call   80106bf0 <release>
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+80105331:	8b 47 64             	mov    0x64(%edi),%eax
+80105334:	99                   	cltd
+80105335:	c1 ea 1a             	shr    $0x1a,%edx
+80105338:	8d 1c 10             	lea    (%eax,%edx,1),%ebx
+8010533b:	83 e3 3f             	and    $0x3f,%ebx
+8010533e:	29 d3                	sub    %edx,%ebx
+  acquirewrite(&ph->lock);
+80105340:	c1 e3 04             	shl    $0x4,%ebx
+80105343:	81 c3 e0 6f 11 80    	add    $0x80116fe0,%ebx
+80105349:	89 1c 24             	mov    %ebx,(%esp)
+8010534c:	e8 ff 12 00 00       	call   80106650 <acquirewrite>
+  p->pidnext = ph->head;
+80105351:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105354:	89 47 7c             	mov    %eax,0x7c(%edi)
+  ph->head = p;
+80105357:	89 7b 0c             	mov    %edi,0xc(%ebx)
+  releasewrite(&ph->lock);
+8010535a:	89 1c 24             	mov    %ebx,(%esp)
+8010535d:	e8 5e 13 00 00       	call   801066c0 <releasewrite>
+  acquire(&np->lock);
+80105362:	89 3c 24             	mov    %edi,(%esp)
+80105365:	e8 c6 19 00 00       	call   80106d30 <acquire>
+  setrunnable(np);
+8010536a:	89 f8                	mov    %edi,%eax
+8010536c:	e8 6f f7 ff ff       	call   80104ae0 <setrunnable>
+  release(&np->lock);
+80105371:	89 3c 24             	mov    %edi,(%esp)
+80105374:	e8 77 18 00 00       	call   80106bf0 <release>
+  return pid;
+80105379:	83 c4 10             	add    $0x10,%esp
+}
+8010537c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010537f:	89 f0                	mov    %esi,%eax
+80105381:	5b                   	pop    %ebx
+80105382:	5e                   	pop    %esi
+80105383:	5f                   	pop    %edi
+80105384:	5d                   	pop    %ebp
+80105385:	c3                   	ret
+    if(np->pgdir)
+80105386:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105389:	8b 40 58             	mov    0x58(%eax),%eax
+8010538c:	85 c0                	test   %eax,%eax
+8010538e:	74 0c                	je     8010539c <fork+0x19c>
+      freevm(np->pgdir);
+80105390:	83 ec 0c             	sub    $0xc,%esp
+80105393:	50                   	push   %eax
+80105394:	e8 17 5b 00 00       	call   8010aeb0 <freevm>
+80105399:	83 c4 10             	add    $0x10,%esp
+    kfree(np->kstack);
+8010539c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010539f:	83 ec 0c             	sub    $0xc,%esp
+801053a2:	ff 73 5c             	push   0x5c(%ebx)
+801053a5:	e8 e6 dd ff ff       	call   80103190 <kfree>
+    np->kstack = 0;
+801053aa:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+    return -1;
+801053b1:	83 c4 10             	add    $0x10,%esp
+    np->state = UNUSED;
+801053b4:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+    return -1;
+801053bb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801053c0:	eb ba                	jmp    8010537c <fork+0x17c>
+801053c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801053c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801053d0 <scheduler>:
+{
+801053d0:	55                   	push   %ebp
+801053d1:	89 e5                	mov    %esp,%ebp
+801053d3:	57                   	push   %edi
+801053d4:	56                   	push   %esi
+801053d5:	53                   	push   %ebx
+801053d6:	83 ec 2c             	sub    $0x2c,%esp
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+801053d9:	65 8b 0d 00 00 00 00 	mov    %gs:0x0,%ecx
+801053e0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801053e3:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  c->proc = 0; // set current cpu's process pointer to be null
+801053e9:	c7 81 e8 00 00 00 00 	movl   $0x0,0xe8(%ecx)
+801053f0:	00 00 00 
+  return mycpu()-cpus;
+801053f3:	2d 80 68 11 80       	sub    $0x80116880,%eax
+801053f8:	c1 f8 02             	sar    $0x2,%eax
+801053fb:	69 f8 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%edi
+  if((p = dequeue(&runq[id], id)) != 0)
+80105401:	69 c0 b4 15 41 c3    	imul   $0xc34115b4,%eax,%eax
+  return mycpu()-cpus;
+80105407:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  if((p = dequeue(&runq[id], id)) != 0)
+8010540a:	05 e0 89 11 80       	add    $0x801189e0,%eax
+8010540f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    xchg(&c->idle, 1);
+80105412:	8d 81 b4 00 00 00    	lea    0xb4(%ecx),%eax
+80105418:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    swtch(&(c->scheduler), p->context);
+8010541b:	8d 41 04             	lea    0x4(%ecx),%eax
+8010541e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80105421:	e9 b5 00 00 00       	jmp    801054db <scheduler+0x10b>
+80105426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010542d:	8d 76 00             	lea    0x0(%esi),%esi
+    c->idle = 0;
+80105430:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    acquire(&p->lock);
+80105433:	83 ec 0c             	sub    $0xc,%esp
+    c->idle = 0;
+80105436:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+8010543d:	00 00 00 
+    acquire(&p->lock);
+80105440:	53                   	push   %ebx
+80105441:	e8 ea 18 00 00       	call   80106d30 <acquire>
+    if(p->state != RUNNABLE)
+80105446:	83 c4 10             	add    $0x10,%esp
+80105449:	83 7b 60 03          	cmpl   $0x3,0x60(%ebx)
+8010544d:	0f 85 95 01 00 00    	jne    801055e8 <scheduler+0x218>
+    c->proc = p;
+80105453:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    switchuvm(p);
+80105456:	83 ec 0c             	sub    $0xc,%esp
+    c->proc = p;
+80105459:	89 9f e8 00 00 00    	mov    %ebx,0xe8(%edi)
+    switchuvm(p);
+8010545f:	53                   	push   %ebx
+80105460:	e8 2b 56 00 00       	call   8010aa90 <switchuvm>
+    p->lastcpu = id;
+80105465:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    trace(TR_RUN, 0, 0);
+80105468:	83 c4 0c             	add    $0xc,%esp
+    p->state = RUNNING;
+8010546b:	c7 43 60 04 00 00 00 	movl   $0x4,0x60(%ebx)
+    p->lastcpu = id;
+80105472:	89 83 fc 00 00 00    	mov    %eax,0xfc(%ebx)
+    trace(TR_RUN, 0, 0);
+80105478:	6a 00                	push   $0x0
+8010547a:	6a 00                	push   $0x0
+8010547c:	6a 03                	push   $0x3
+8010547e:	e8 2d 40 00 00       	call   801094b0 <trace>
+    c->lasttick = readticks();
+80105483:	e8 38 39 00 00       	call   80108dc0 <readticks>
+80105488:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010548b:	89 87 bc 00 00 00    	mov    %eax,0xbc(%edi)
+    timerarm();
+80105491:	e8 5a 3e 00 00       	call   801092f0 <timerarm>
+  asm volatile("rdtsc" : "=A" (t));
+80105496:	0f 31                	rdtsc
+80105498:	89 c6                	mov    %eax,%esi
+8010549a:	89 d7                	mov    %edx,%edi
+    swtch(&(c->scheduler), p->context);
+8010549c:	58                   	pop    %eax
+8010549d:	5a                   	pop    %edx
+8010549e:	ff b3 84 00 00 00    	push   0x84(%ebx)
+801054a4:	ff 75 d4             	push   -0x2c(%ebp)
+801054a7:	e8 0f 20 00 00       	call   801074bb <swtch>
+801054ac:	0f 31                	rdtsc
+    p->cycles += rdtsc() - t0;
+801054ae:	29 f0                	sub    %esi,%eax
+801054b0:	19 fa                	sbb    %edi,%edx
+801054b2:	01 83 0c 01 00 00    	add    %eax,0x10c(%ebx)
+801054b8:	11 93 10 01 00 00    	adc    %edx,0x110(%ebx)
+    switchkvm();
+801054be:	e8 bd 55 00 00       	call   8010aa80 <switchkvm>
+    c->proc = 0;
+801054c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801054c6:	c7 87 e8 00 00 00 00 	movl   $0x0,0xe8(%edi)
+801054cd:	00 00 00 
+    release(&p->lock);
+801054d0:	89 1c 24             	mov    %ebx,(%esp)
+801054d3:	e8 18 17 00 00       	call   80106bf0 <release>
+801054d8:	83 c4 10             	add    $0x10,%esp
+  asm volatile("cli");
+801054db:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+801054dc:	b8 01 00 00 00       	mov    $0x1,%eax
+801054e1:	8b 7d d8             	mov    -0x28(%ebp),%edi
+801054e4:	f0 87 07             	lock xchg %eax,(%edi)
+  if((p = dequeue(&runq[id], id)) != 0)
+801054e7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801054ea:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801054ed:	e8 ae f8 ff ff       	call   80104da0 <dequeue>
+801054f2:	89 c3                	mov    %eax,%ebx
+801054f4:	85 c0                	test   %eax,%eax
+801054f6:	0f 85 34 ff ff ff    	jne    80105430 <scheduler+0x60>
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+801054fc:	6b 15 64 68 11 80 7c 	imul   $0x7c,0x80116864,%edx
+80105503:	b8 e0 89 11 80       	mov    $0x801189e0,%eax
+80105508:	81 c2 e0 89 11 80    	add    $0x801189e0,%edx
+8010550e:	39 c2                	cmp    %eax,%edx
+80105510:	0f 86 a8 00 00 00    	jbe    801055be <scheduler+0x1ee>
+80105516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010551d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(rq->n > 0 && (busiest == 0 || rq->n > busiest->n))
+80105520:	8b 48 74             	mov    0x74(%eax),%ecx
+80105523:	85 c9                	test   %ecx,%ecx
+80105525:	7e 29                	jle    80105550 <scheduler+0x180>
+80105527:	85 db                	test   %ebx,%ebx
+80105529:	0f 84 a1 00 00 00    	je     801055d0 <scheduler+0x200>
+8010552f:	8b 70 74             	mov    0x74(%eax),%esi
+80105532:	8b 4b 74             	mov    0x74(%ebx),%ecx
+80105535:	39 ce                	cmp    %ecx,%esi
+80105537:	0f 8f 93 00 00 00    	jg     801055d0 <scheduler+0x200>
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+8010553d:	83 c0 7c             	add    $0x7c,%eax
+80105540:	39 d0                	cmp    %edx,%eax
+80105542:	73 13                	jae    80105557 <scheduler+0x187>
+    if(rq->n > 0 && (busiest == 0 || rq->n > busiest->n))
+80105544:	8b 48 74             	mov    0x74(%eax),%ecx
+80105547:	85 c9                	test   %ecx,%ecx
+80105549:	7f e4                	jg     8010552f <scheduler+0x15f>
+8010554b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010554f:	90                   	nop
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+80105550:	83 c0 7c             	add    $0x7c,%eax
+80105553:	39 d0                	cmp    %edx,%eax
+80105555:	72 c9                	jb     80105520 <scheduler+0x150>
+  if(busiest == 0)
+80105557:	85 db                	test   %ebx,%ebx
+80105559:	74 63                	je     801055be <scheduler+0x1ee>
+  if((p = dequeue(busiest, id)) != 0)
+8010555b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010555e:	89 d8                	mov    %ebx,%eax
+80105560:	89 fa                	mov    %edi,%edx
+80105562:	e8 39 f8 ff ff       	call   80104da0 <dequeue>
+80105567:	85 c0                	test   %eax,%eax
+80105569:	74 0d                	je     80105578 <scheduler+0x1a8>
+    return p;
+8010556b:	89 c3                	mov    %eax,%ebx
+8010556d:	e9 be fe ff ff       	jmp    80105430 <scheduler+0x60>
+80105572:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+80105578:	8b 15 64 68 11 80    	mov    0x80116864,%edx
+8010557e:	6b c2 7c             	imul   $0x7c,%edx,%eax
+80105581:	05 e0 89 11 80       	add    $0x801189e0,%eax
+80105586:	3d e0 89 11 80       	cmp    $0x801189e0,%eax
+8010558b:	76 31                	jbe    801055be <scheduler+0x1ee>
+8010558d:	be e0 89 11 80       	mov    $0x801189e0,%esi
+80105592:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(rq != busiest && (p = dequeue(rq, id)) != 0)
+80105598:	39 f3                	cmp    %esi,%ebx
+8010559a:	74 13                	je     801055af <scheduler+0x1df>
+8010559c:	89 fa                	mov    %edi,%edx
+8010559e:	89 f0                	mov    %esi,%eax
+801055a0:	e8 fb f7 ff ff       	call   80104da0 <dequeue>
+801055a5:	85 c0                	test   %eax,%eax
+801055a7:	75 c2                	jne    8010556b <scheduler+0x19b>
+801055a9:	8b 15 64 68 11 80    	mov    0x80116864,%edx
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+801055af:	6b c2 7c             	imul   $0x7c,%edx,%eax
+801055b2:	83 c6 7c             	add    $0x7c,%esi
+801055b5:	05 e0 89 11 80       	add    $0x801189e0,%eax
+801055ba:	39 c6                	cmp    %eax,%esi
+801055bc:	72 da                	jb     80105598 <scheduler+0x1c8>
+      timerarm();
+801055be:	e8 2d 3d 00 00       	call   801092f0 <timerarm>
+  asm volatile("sti; hlt");
+801055c3:	fb                   	sti
+801055c4:	f4                   	hlt
+      continue;
+801055c5:	e9 11 ff ff ff       	jmp    801054db <scheduler+0x10b>
+801055ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801055d0:	89 c3                	mov    %eax,%ebx
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+801055d2:	83 c0 7c             	add    $0x7c,%eax
+801055d5:	39 d0                	cmp    %edx,%eax
+801055d7:	0f 82 43 ff ff ff    	jb     80105520 <scheduler+0x150>
+801055dd:	e9 75 ff ff ff       	jmp    80105557 <scheduler+0x187>
+801055e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      panic("scheduler");
+801055e8:	83 ec 0c             	sub    $0xc,%esp
+801055eb:	68 10 b8 10 80       	push   $0x8010b810
+801055f0:	e8 eb ad ff ff       	call   801003e0 <panic>
+801055f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105600 <sched>:
+{
+80105600:	55                   	push   %ebp
+80105601:	89 e5                	mov    %esp,%ebp
+80105603:	56                   	push   %esi
+80105604:	53                   	push   %ebx
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105605:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if (!holding(&p->lock)) // should be called after acquiring the process's lock
+8010560c:	83 ec 0c             	sub    $0xc,%esp
+8010560f:	53                   	push   %ebx
+80105610:	e8 9b 15 00 00       	call   80106bb0 <holding>
+80105615:	83 c4 10             	add    $0x10,%esp
+80105618:	85 c0                	test   %eax,%eax
+8010561a:	74 64                	je     80105680 <sched+0x80>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+8010561c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  if (mycpu()->ncli != 1) // should not be holding any other locks
+80105622:	83 b8 ac 00 00 00 01 	cmpl   $0x1,0xac(%eax)
+80105629:	75 7c                	jne    801056a7 <sched+0xa7>
+  if (p->state == RUNNING) // state should be changed beforehand
+8010562b:	8b 43 60             	mov    0x60(%ebx),%eax
+8010562e:	83 f8 04             	cmp    $0x4,%eax
+80105631:	74 67                	je     8010569a <sched+0x9a>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105633:	9c                   	pushf
+80105634:	5a                   	pop    %edx
+  if (readeflags()&FL_IF) // interrupts should be disabled
+80105635:	80 e6 02             	and    $0x2,%dh
+80105638:	75 53                	jne    8010568d <sched+0x8d>
+  trace(TR_SCHED, p->state, 0);
+8010563a:	83 ec 04             	sub    $0x4,%esp
+8010563d:	6a 00                	push   $0x0
+8010563f:	50                   	push   %eax
+80105640:	6a 04                	push   $0x4
+80105642:	e8 69 3e 00 00       	call   801094b0 <trace>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105647:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  intena = mycpu()->intena; 
+8010564d:	8b b0 b0 00 00 00    	mov    0xb0(%eax),%esi
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105653:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  swtch(&p->context, mycpu()->scheduler);
+80105659:	81 c3 84 00 00 00    	add    $0x84,%ebx
+8010565f:	5a                   	pop    %edx
+80105660:	59                   	pop    %ecx
+80105661:	ff 70 04             	push   0x4(%eax)
+80105664:	53                   	push   %ebx
+80105665:	e8 51 1e 00 00       	call   801074bb <swtch>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+8010566a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  mycpu()->intena = intena;
+80105670:	89 b0 b0 00 00 00    	mov    %esi,0xb0(%eax)
+}
+80105676:	83 c4 10             	add    $0x10,%esp
+80105679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010567c:	5b                   	pop    %ebx
+8010567d:	5e                   	pop    %esi
+8010567e:	5d                   	pop    %ebp
+8010567f:	c3                   	ret
+    panic("sched p->lock");
+80105680:	83 ec 0c             	sub    $0xc,%esp
+80105683:	68 1a b8 10 80       	push   $0x8010b81a
+80105688:	e8 53 ad ff ff       	call   801003e0 <panic>
+    panic("sched interruptible");
+8010568d:	83 ec 0c             	sub    $0xc,%esp
+80105690:	68 42 b8 10 80       	push   $0x8010b842
+80105695:	e8 46 ad ff ff       	call   801003e0 <panic>
+    panic("sched running");
+8010569a:	83 ec 0c             	sub    $0xc,%esp
+8010569d:	68 34 b8 10 80       	push   $0x8010b834
+801056a2:	e8 39 ad ff ff       	call   801003e0 <panic>
+    panic("sched locks");
+801056a7:	83 ec 0c             	sub    $0xc,%esp
+801056aa:	68 28 b8 10 80       	push   $0x8010b828
+801056af:	e8 2c ad ff ff       	call   801003e0 <panic>
+801056b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801056bf:	90                   	nop
+
+801056c0 <yield>:
+{
+801056c0:	55                   	push   %ebp
+801056c1:	89 e5                	mov    %esp,%ebp
+801056c3:	53                   	push   %ebx
+801056c4:	83 ec 10             	sub    $0x10,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+801056c7:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  acquire(&p->lock);  //DOC: yieldlock
+801056ce:	53                   	push   %ebx
+801056cf:	e8 5c 16 00 00       	call   80106d30 <acquire>
+  setrunnable(p);
+801056d4:	89 d8                	mov    %ebx,%eax
+801056d6:	e8 05 f4 ff ff       	call   80104ae0 <setrunnable>
+  p->nivcsw++;
+801056db:	83 83 18 01 00 00 01 	addl   $0x1,0x118(%ebx)
+  sched();
+801056e2:	e8 19 ff ff ff       	call   80105600 <sched>
+  release(&p->lock);
+801056e7:	89 1c 24             	mov    %ebx,(%esp)
+801056ea:	e8 01 15 00 00       	call   80106bf0 <release>
+}
+801056ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801056f2:	83 c4 10             	add    $0x10,%esp
+801056f5:	c9                   	leave
+801056f6:	c3                   	ret
+801056f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056fe:	66 90                	xchg   %ax,%ax
+
+80105700 <timeslice>:
+{
+80105700:	55                   	push   %ebp
+  return n > 0;
+80105701:	31 c0                	xor    %eax,%eax
+{
+80105703:	89 e5                	mov    %esp,%ebp
+  return n > 0;
+80105705:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+80105708:	5d                   	pop    %ebp
+  return n > 0;
+80105709:	85 d2                	test   %edx,%edx
+8010570b:	0f 9f c0             	setg   %al
+}
+8010570e:	c3                   	ret
+8010570f:	90                   	nop
+
+80105710 <quantum>:
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105710:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  if(p == 0 || runq[cpuid()].n == 0)
+80105716:	85 c0                	test   %eax,%eax
+80105718:	74 26                	je     80105740 <quantum+0x30>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+8010571a:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80105720:	2d 80 68 11 80       	sub    $0x80116880,%eax
+80105725:	c1 f8 02             	sar    $0x2,%eax
+  if(p == 0 || runq[cpuid()].n == 0)
+80105728:	69 c0 b4 15 41 c3    	imul   $0xc34115b4,%eax,%eax
+8010572e:	05 e0 89 11 80       	add    $0x801189e0,%eax
+80105733:	8b 40 74             	mov    0x74(%eax),%eax
+80105736:	85 c0                	test   %eax,%eax
+80105738:	0f 95 c0             	setne  %al
+8010573b:	0f b6 c0             	movzbl %al,%eax
+8010573e:	c3                   	ret
+8010573f:	90                   	nop
+    return 0;
+80105740:	31 c0                	xor    %eax,%eax
+}
+80105742:	c3                   	ret
+80105743:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010574a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105750 <boost>:
+}
+80105750:	c3                   	ret
+80105751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010575f:	90                   	nop
+
+80105760 <sleep>:
+{
+80105760:	55                   	push   %ebp
+80105761:	89 e5                	mov    %esp,%ebp
+80105763:	57                   	push   %edi
+80105764:	56                   	push   %esi
+80105765:	53                   	push   %ebx
+80105766:	83 ec 1c             	sub    $0x1c,%esp
+80105769:	8b 45 08             	mov    0x8(%ebp),%eax
+8010576c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+8010576f:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if (p == 0) // check that cpu is actually running a process
+80105776:	85 db                	test   %ebx,%ebx
+80105778:	0f 84 07 01 00 00    	je     80105885 <sleep+0x125>
+  if (lk == 0)
+8010577e:	85 f6                	test   %esi,%esi
+80105780:	0f 84 f2 00 00 00    	je     80105878 <sleep+0x118>
+  return &sleepq[(((uint)chan * 2654435761U) >> 16) % NSLEEPQ];
+80105786:	69 f8 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%edi
+  acquire(&sq->lock);  //DOC: sleeplock1
+8010578c:	83 ec 0c             	sub    $0xc,%esp
+  return &sleepq[(((uint)chan * 2654435761U) >> 16) % NSLEEPQ];
+8010578f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105792:	c1 ef 10             	shr    $0x10,%edi
+80105795:	83 e7 3f             	and    $0x3f,%edi
+  acquire(&sq->lock);  //DOC: sleeplock1
+80105798:	6b d7 58             	imul   $0x58,%edi,%edx
+8010579b:	8d ba e0 73 11 80    	lea    -0x7fee8c20(%edx),%edi
+801057a1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+801057a4:	57                   	push   %edi
+801057a5:	e8 86 15 00 00       	call   80106d30 <acquire>
+  acquire(&p->lock);
+801057aa:	89 1c 24             	mov    %ebx,(%esp)
+801057ad:	e8 7e 15 00 00       	call   80106d30 <acquire>
+  release(lk);
+801057b2:	89 34 24             	mov    %esi,(%esp)
+801057b5:	e8 36 14 00 00       	call   80106bf0 <release>
+  p->chan = chan;
+801057ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  trace(TR_SLEEP, (uint)chan, 0);
+801057bd:	83 c4 0c             	add    $0xc,%esp
+  p->chan = chan;
+801057c0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  p->chnext = sq->head;
+801057c6:	8b 4f 54             	mov    0x54(%edi),%ecx
+801057c9:	89 8b 8c 00 00 00    	mov    %ecx,0x8c(%ebx)
+  sq->head = p;
+801057cf:	89 5f 54             	mov    %ebx,0x54(%edi)
+  p->nvcsw++;
+801057d2:	83 83 14 01 00 00 01 	addl   $0x1,0x114(%ebx)
+  p->state = SLEEPING;
+801057d9:	c7 43 60 02 00 00 00 	movl   $0x2,0x60(%ebx)
+  trace(TR_SLEEP, (uint)chan, 0);
+801057e0:	6a 00                	push   $0x0
+801057e2:	50                   	push   %eax
+801057e3:	6a 05                	push   $0x5
+801057e5:	e8 c6 3c 00 00       	call   801094b0 <trace>
+  release(&sq->lock);
+801057ea:	89 3c 24             	mov    %edi,(%esp)
+801057ed:	e8 fe 13 00 00       	call   80106bf0 <release>
+  sched(); // recall: must hold p->lock
+801057f2:	e8 09 fe ff ff       	call   80105600 <sched>
+  release(&p->lock);  //DOC: sleeplock2
+801057f7:	89 1c 24             	mov    %ebx,(%esp)
+801057fa:	e8 f1 13 00 00       	call   80106bf0 <release>
+  acquire(&sq->lock);
+801057ff:	89 3c 24             	mov    %edi,(%esp)
+80105802:	e8 29 15 00 00       	call   80106d30 <acquire>
+  if(p->chan)
+80105807:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+8010580d:	83 c4 10             	add    $0x10,%esp
+80105810:	85 c0                	test   %eax,%eax
+80105812:	74 2e                	je     80105842 <sleep+0xe2>
+  for(pp = &sq->head; *pp; pp = &(*pp)->chnext){
+80105814:	8b 47 54             	mov    0x54(%edi),%eax
+80105817:	85 c0                	test   %eax,%eax
+80105819:	74 1d                	je     80105838 <sleep+0xd8>
+    if(*pp == p){
+8010581b:	39 c3                	cmp    %eax,%ebx
+8010581d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80105820:	75 0a                	jne    8010582c <sleep+0xcc>
+80105822:	eb 4c                	jmp    80105870 <sleep+0x110>
+80105824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105828:	39 c3                	cmp    %eax,%ebx
+8010582a:	74 34                	je     80105860 <sleep+0x100>
+  for(pp = &sq->head; *pp; pp = &(*pp)->chnext){
+8010582c:	89 c2                	mov    %eax,%edx
+8010582e:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80105834:	85 c0                	test   %eax,%eax
+80105836:	75 f0                	jne    80105828 <sleep+0xc8>
+  p->chan = 0;
+80105838:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+8010583f:	00 00 00 
+  release(&sq->lock);
+80105842:	83 ec 0c             	sub    $0xc,%esp
+80105845:	57                   	push   %edi
+80105846:	e8 a5 13 00 00       	call   80106bf0 <release>
+  acquire(lk);
+8010584b:	89 75 08             	mov    %esi,0x8(%ebp)
+8010584e:	83 c4 10             	add    $0x10,%esp
+}
+80105851:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105854:	5b                   	pop    %ebx
+80105855:	5e                   	pop    %esi
+80105856:	5f                   	pop    %edi
+80105857:	5d                   	pop    %ebp
+  acquire(lk);
+80105858:	e9 d3 14 00 00       	jmp    80106d30 <acquire>
+8010585d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(pp = &sq->head; *pp; pp = &(*pp)->chnext){
+80105860:	81 c2 8c 00 00 00    	add    $0x8c,%edx
+      *pp = p->chnext;
+80105866:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+8010586c:	89 02                	mov    %eax,(%edx)
+      break;
+8010586e:	eb c8                	jmp    80105838 <sleep+0xd8>
+  for(pp = &sq->head; *pp; pp = &(*pp)->chnext){
+80105870:	81 c2 34 74 11 80    	add    $0x80117434,%edx
+80105876:	eb ee                	jmp    80105866 <sleep+0x106>
+    panic("sleep without lk");
+80105878:	83 ec 0c             	sub    $0xc,%esp
+8010587b:	68 5c b8 10 80       	push   $0x8010b85c
+80105880:	e8 5b ab ff ff       	call   801003e0 <panic>
+    panic("sleep");
+80105885:	83 ec 0c             	sub    $0xc,%esp
+80105888:	68 56 b8 10 80       	push   $0x8010b856
+8010588d:	e8 4e ab ff ff       	call   801003e0 <panic>
+80105892:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801058a0 <wait>:
+{
+801058a0:	55                   	push   %ebp
+801058a1:	89 e5                	mov    %esp,%ebp
+801058a3:	57                   	push   %edi
+801058a4:	56                   	push   %esi
+801058a5:	53                   	push   %ebx
+801058a6:	83 ec 18             	sub    $0x18,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+801058a9:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  acquire(&ptable.lock);
+801058b0:	68 c0 8d 11 80       	push   $0x80118dc0
+801058b5:	e8 76 14 00 00       	call   80106d30 <acquire>
+    if ((p = curproc->zombies) != 0) {
+801058ba:	8b 73 70             	mov    0x70(%ebx),%esi
+801058bd:	83 c4 10             	add    $0x10,%esp
+801058c0:	85 f6                	test   %esi,%esi
+801058c2:	74 2e                	je     801058f2 <wait+0x52>
+801058c4:	eb 5a                	jmp    80105920 <wait+0x80>
+801058c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801058cd:	8d 76 00             	lea    0x0(%esi),%esi
+    if (curproc->kids == 0 || curproc->killed) {
+801058d0:	8b 83 90 00 00 00    	mov    0x90(%ebx),%eax
+801058d6:	85 c0                	test   %eax,%eax
+801058d8:	75 1f                	jne    801058f9 <wait+0x59>
+    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+801058da:	83 ec 08             	sub    $0x8,%esp
+801058dd:	68 c0 8d 11 80       	push   $0x80118dc0
+801058e2:	53                   	push   %ebx
+801058e3:	e8 78 fe ff ff       	call   80105760 <sleep>
+    if ((p = curproc->zombies) != 0) {
+801058e8:	8b 73 70             	mov    0x70(%ebx),%esi
+801058eb:	83 c4 10             	add    $0x10,%esp
+801058ee:	85 f6                	test   %esi,%esi
+801058f0:	75 2e                	jne    80105920 <wait+0x80>
+    if (curproc->kids == 0 || curproc->killed) {
+801058f2:	8b 53 6c             	mov    0x6c(%ebx),%edx
+801058f5:	85 d2                	test   %edx,%edx
+801058f7:	75 d7                	jne    801058d0 <wait+0x30>
+      release(&ptable.lock);
+801058f9:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801058fc:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&ptable.lock);
+80105901:	68 c0 8d 11 80       	push   $0x80118dc0
+80105906:	e8 e5 12 00 00       	call   80106bf0 <release>
+      return -1;
+8010590b:	83 c4 10             	add    $0x10,%esp
+}
+8010590e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105911:	89 d8                	mov    %ebx,%eax
+80105913:	5b                   	pop    %ebx
+80105914:	5e                   	pop    %esi
+80105915:	5f                   	pop    %edi
+80105916:	5d                   	pop    %ebp
+80105917:	c3                   	ret
+80105918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010591f:	90                   	nop
+  *p->sibprev = p->sibling;
+80105920:	8b 56 78             	mov    0x78(%esi),%edx
+80105923:	8b 46 74             	mov    0x74(%esi),%eax
+80105926:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+80105928:	85 c0                	test   %eax,%eax
+8010592a:	74 06                	je     80105932 <wait+0x92>
+    p->sibling->sibprev = p->sibprev;
+8010592c:	8b 56 78             	mov    0x78(%esi),%edx
+8010592f:	89 50 78             	mov    %edx,0x78(%eax)
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+80105932:	8b 46 64             	mov    0x64(%esi),%eax
+  acquirewrite(&ph->lock);
+80105935:	83 ec 0c             	sub    $0xc,%esp
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+80105938:	89 c1                	mov    %eax,%ecx
+8010593a:	c1 f9 1f             	sar    $0x1f,%ecx
+8010593d:	c1 e9 1a             	shr    $0x1a,%ecx
+80105940:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+80105943:	83 e2 3f             	and    $0x3f,%edx
+80105946:	29 ca                	sub    %ecx,%edx
+  acquirewrite(&ph->lock);
+80105948:	c1 e2 04             	shl    $0x4,%edx
+8010594b:	8d ba e0 6f 11 80    	lea    -0x7fee9020(%edx),%edi
+80105951:	89 d3                	mov    %edx,%ebx
+80105953:	57                   	push   %edi
+80105954:	e8 f7 0c 00 00       	call   80106650 <acquirewrite>
+  for(pp = &ph->head; *pp; pp = &(*pp)->pidnext){
+80105959:	8b 47 0c             	mov    0xc(%edi),%eax
+8010595c:	83 c4 10             	add    $0x10,%esp
+8010595f:	85 c0                	test   %eax,%eax
+80105961:	74 1e                	je     80105981 <wait+0xe1>
+    if(*pp == p){
+80105963:	39 f0                	cmp    %esi,%eax
+80105965:	75 11                	jne    80105978 <wait+0xd8>
+80105967:	e9 99 00 00 00       	jmp    80105a05 <wait+0x165>
+8010596c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105970:	39 f0                	cmp    %esi,%eax
+80105972:	0f 84 80 00 00 00    	je     801059f8 <wait+0x158>
+  for(pp = &ph->head; *pp; pp = &(*pp)->pidnext){
+80105978:	89 c2                	mov    %eax,%edx
+8010597a:	8b 40 7c             	mov    0x7c(%eax),%eax
+8010597d:	85 c0                	test   %eax,%eax
+8010597f:	75 ef                	jne    80105970 <wait+0xd0>
+  releasewrite(&ph->lock);
+80105981:	83 ec 0c             	sub    $0xc,%esp
+80105984:	57                   	push   %edi
+80105985:	e8 36 0d 00 00       	call   801066c0 <releasewrite>
+      pid = p->pid;
+8010598a:	8b 5e 64             	mov    0x64(%esi),%ebx
+      acquire(&p->lock);
+8010598d:	89 34 24             	mov    %esi,(%esp)
+80105990:	e8 9b 13 00 00       	call   80106d30 <acquire>
+      kfree(p->kstack); // free kernel stack
+80105995:	59                   	pop    %ecx
+80105996:	ff 76 5c             	push   0x5c(%esi)
+80105999:	e8 f2 d7 ff ff       	call   80103190 <kfree>
+      p->kstack = 0;
+8010599e:	c7 46 5c 00 00 00 00 	movl   $0x0,0x5c(%esi)
+      freevm(p->pgdir); // free pgdir
+801059a5:	5f                   	pop    %edi
+801059a6:	ff 76 58             	push   0x58(%esi)
+801059a9:	e8 02 55 00 00       	call   8010aeb0 <freevm>
+      p->pid = 0; // reset the struct proc (p-> instructions)
+801059ae:	c7 46 64 00 00 00 00 	movl   $0x0,0x64(%esi)
+      p->parent = 0;
+801059b5:	c7 46 68 00 00 00 00 	movl   $0x0,0x68(%esi)
+      p->name[0] = 0;
+801059bc:	c6 86 d8 00 00 00 00 	movb   $0x0,0xd8(%esi)
+      p->killed = 0;
+801059c3:	c7 86 90 00 00 00 00 	movl   $0x0,0x90(%esi)
+801059ca:	00 00 00 
+      p->state = UNUSED;
+801059cd:	c7 46 60 00 00 00 00 	movl   $0x0,0x60(%esi)
+      release(&p->lock);
+801059d4:	89 34 24             	mov    %esi,(%esp)
+801059d7:	e8 14 12 00 00       	call   80106bf0 <release>
+      release(&ptable.lock);
+801059dc:	c7 04 24 c0 8d 11 80 	movl   $0x80118dc0,(%esp)
+801059e3:	e8 08 12 00 00       	call   80106bf0 <release>
+      return pid;
+801059e8:	83 c4 10             	add    $0x10,%esp
+}
+801059eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801059ee:	89 d8                	mov    %ebx,%eax
+801059f0:	5b                   	pop    %ebx
+801059f1:	5e                   	pop    %esi
+801059f2:	5f                   	pop    %edi
+801059f3:	5d                   	pop    %ebp
+801059f4:	c3                   	ret
+801059f5:	8d 76 00             	lea    0x0(%esi),%esi
+  for(pp = &ph->head; *pp; pp = &(*pp)->pidnext){
+801059f8:	83 c2 7c             	add    $0x7c,%edx
+      *pp = p->pidnext;
+801059fb:	8b 46 7c             	mov    0x7c(%esi),%eax
+801059fe:	89 02                	mov    %eax,(%edx)
+      break;
+80105a00:	e9 7c ff ff ff       	jmp    80105981 <wait+0xe1>
+  for(pp = &ph->head; *pp; pp = &(*pp)->pidnext){
+80105a05:	8d 93 ec 6f 11 80    	lea    -0x7fee9014(%ebx),%edx
+80105a0b:	eb ee                	jmp    801059fb <wait+0x15b>
+80105a0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105a10 <wakeup>:
+{
+80105a10:	55                   	push   %ebp
+80105a11:	89 e5                	mov    %esp,%ebp
+80105a13:	57                   	push   %edi
+80105a14:	56                   	push   %esi
+80105a15:	53                   	push   %ebx
+80105a16:	83 ec 28             	sub    $0x28,%esp
+80105a19:	8b 75 08             	mov    0x8(%ebp),%esi
+  return &sleepq[(((uint)chan * 2654435761U) >> 16) % NSLEEPQ];
+80105a1c:	69 d6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%edx
+80105a22:	c1 ea 10             	shr    $0x10,%edx
+80105a25:	83 e2 3f             	and    $0x3f,%edx
+  acquire(&sq->lock);
+80105a28:	6b fa 58             	imul   $0x58,%edx,%edi
+80105a2b:	8d 9f e0 73 11 80    	lea    -0x7fee8c20(%edi),%ebx
+  for(pp = &sq->head; (p = *pp) != 0; ){
+80105a31:	81 c7 34 74 11 80    	add    $0x80117434,%edi
+  acquire(&sq->lock);
+80105a37:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80105a3a:	53                   	push   %ebx
+80105a3b:	e8 f0 12 00 00       	call   80106d30 <acquire>
+  for(pp = &sq->head; (p = *pp) != 0; ){
+80105a40:	8b 5b 54             	mov    0x54(%ebx),%ebx
+80105a43:	83 c4 10             	add    $0x10,%esp
+80105a46:	85 db                	test   %ebx,%ebx
+80105a48:	75 12                	jne    80105a5c <wakeup+0x4c>
+80105a4a:	eb 4e                	jmp    80105a9a <wakeup+0x8a>
+80105a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      pp = &p->chnext;
+80105a50:	8d bb 8c 00 00 00    	lea    0x8c(%ebx),%edi
+  for(pp = &sq->head; (p = *pp) != 0; ){
+80105a56:	8b 1f                	mov    (%edi),%ebx
+80105a58:	85 db                	test   %ebx,%ebx
+80105a5a:	74 3e                	je     80105a9a <wakeup+0x8a>
+    if(p->chan != chan){
+80105a5c:	39 b3 88 00 00 00    	cmp    %esi,0x88(%ebx)
+80105a62:	75 ec                	jne    80105a50 <wakeup+0x40>
+    *pp = p->chnext;
+80105a64:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+    acquire(&p->lock);
+80105a6a:	83 ec 0c             	sub    $0xc,%esp
+    *pp = p->chnext;
+80105a6d:	89 07                	mov    %eax,(%edi)
+    p->chan = 0;
+80105a6f:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80105a76:	00 00 00 
+    acquire(&p->lock);
+80105a79:	53                   	push   %ebx
+80105a7a:	e8 b1 12 00 00       	call   80106d30 <acquire>
+    if(p->state == SLEEPING){  // not if kill() got there first
+80105a7f:	83 c4 10             	add    $0x10,%esp
+80105a82:	83 7b 60 02          	cmpl   $0x2,0x60(%ebx)
+80105a86:	74 28                	je     80105ab0 <wakeup+0xa0>
+    release(&p->lock);
+80105a88:	83 ec 0c             	sub    $0xc,%esp
+80105a8b:	53                   	push   %ebx
+80105a8c:	e8 5f 11 00 00       	call   80106bf0 <release>
+  for(pp = &sq->head; (p = *pp) != 0; ){
+80105a91:	8b 1f                	mov    (%edi),%ebx
+    release(&p->lock);
+80105a93:	83 c4 10             	add    $0x10,%esp
+  for(pp = &sq->head; (p = *pp) != 0; ){
+80105a96:	85 db                	test   %ebx,%ebx
+80105a98:	75 c2                	jne    80105a5c <wakeup+0x4c>
+  release(&sq->lock);
+80105a9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105a9d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80105aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105aa3:	5b                   	pop    %ebx
+80105aa4:	5e                   	pop    %esi
+80105aa5:	5f                   	pop    %edi
+80105aa6:	5d                   	pop    %ebp
+  release(&sq->lock);
+80105aa7:	e9 44 11 00 00       	jmp    80106bf0 <release>
+80105aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      trace(TR_WAKEUP, (uint)chan, p->pid);
+80105ab0:	83 ec 04             	sub    $0x4,%esp
+80105ab3:	ff 73 64             	push   0x64(%ebx)
+80105ab6:	56                   	push   %esi
+80105ab7:	6a 06                	push   $0x6
+80105ab9:	e8 f2 39 00 00       	call   801094b0 <trace>
+      setrunnable(p);
+80105abe:	89 d8                	mov    %ebx,%eax
+80105ac0:	e8 1b f0 ff ff       	call   80104ae0 <setrunnable>
+80105ac5:	83 c4 10             	add    $0x10,%esp
+80105ac8:	eb be                	jmp    80105a88 <wakeup+0x78>
+80105aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105ad0 <exit>:
+{
+80105ad0:	55                   	push   %ebp
+80105ad1:	89 e5                	mov    %esp,%ebp
+80105ad3:	57                   	push   %edi
+80105ad4:	56                   	push   %esi
+80105ad5:	53                   	push   %ebx
+80105ad6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105ad9:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+  if (curproc == initproc)
+80105ae0:	8d 9e 94 00 00 00    	lea    0x94(%esi),%ebx
+80105ae6:	8d be d4 00 00 00    	lea    0xd4(%esi),%edi
+80105aec:	39 35 14 fc 11 80    	cmp    %esi,0x8011fc14
+80105af2:	0f 84 5e 01 00 00    	je     80105c56 <exit+0x186>
+80105af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105aff:	90                   	nop
+    if (curproc->ofile[fd]) {
+80105b00:	8b 03                	mov    (%ebx),%eax
+80105b02:	85 c0                	test   %eax,%eax
+80105b04:	74 12                	je     80105b18 <exit+0x48>
+      fileclose(curproc->ofile[fd]);
+80105b06:	83 ec 0c             	sub    $0xc,%esp
+80105b09:	50                   	push   %eax
+80105b0a:	e8 c1 b5 ff ff       	call   801010d0 <fileclose>
+      curproc->ofile[fd] = 0;
+80105b0f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80105b15:	83 c4 10             	add    $0x10,%esp
+  for (fd = 0; fd < NOFILE; fd++) {
+80105b18:	83 c3 04             	add    $0x4,%ebx
+80105b1b:	39 fb                	cmp    %edi,%ebx
+80105b1d:	75 e1                	jne    80105b00 <exit+0x30>
+  begin_op();
+80105b1f:	e8 6c e0 ff ff       	call   80103b90 <begin_op>
+  iput(curproc->cwd);
+80105b24:	83 ec 0c             	sub    $0xc,%esp
+80105b27:	ff b6 d4 00 00 00    	push   0xd4(%esi)
+80105b2d:	e8 fe c6 ff ff       	call   80102230 <iput>
+  end_op();
+80105b32:	e8 c9 e0 ff ff       	call   80103c00 <end_op>
+  curproc->cwd = 0;
+80105b37:	c7 86 d4 00 00 00 00 	movl   $0x0,0xd4(%esi)
+80105b3e:	00 00 00 
+  acquire(&ptable.lock);
+80105b41:	c7 04 24 c0 8d 11 80 	movl   $0x80118dc0,(%esp)
+80105b48:	e8 e3 11 00 00       	call   80106d30 <acquire>
+  *p->sibprev = p->sibling;
+80105b4d:	8b 56 78             	mov    0x78(%esi),%edx
+80105b50:	8b 46 74             	mov    0x74(%esi),%eax
+  if(p->sibling)
+80105b53:	83 c4 10             	add    $0x10,%esp
+  *p->sibprev = p->sibling;
+80105b56:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+80105b58:	85 c0                	test   %eax,%eax
+80105b5a:	74 06                	je     80105b62 <exit+0x92>
+    p->sibling->sibprev = p->sibprev;
+80105b5c:	8b 56 78             	mov    0x78(%esi),%edx
+80105b5f:	89 50 78             	mov    %edx,0x78(%eax)
+  childpush(&curproc->parent->zombies, curproc);
+80105b62:	8b 46 68             	mov    0x68(%esi),%eax
+  p->sibling = *list;
+80105b65:	8b 50 70             	mov    0x70(%eax),%edx
+80105b68:	89 56 74             	mov    %edx,0x74(%esi)
+  childpush(&curproc->parent->zombies, curproc);
+80105b6b:	8d 50 70             	lea    0x70(%eax),%edx
+80105b6e:	89 56 78             	mov    %edx,0x78(%esi)
+  if(*list)
+80105b71:	8b 50 70             	mov    0x70(%eax),%edx
+80105b74:	85 d2                	test   %edx,%edx
+80105b76:	74 06                	je     80105b7e <exit+0xae>
+    (*list)->sibprev = &p->sibling;
+80105b78:	8d 4e 74             	lea    0x74(%esi),%ecx
+80105b7b:	89 4a 78             	mov    %ecx,0x78(%edx)
+  *list = p;
+80105b7e:	89 70 70             	mov    %esi,0x70(%eax)
+  wakeup(curproc->parent);
+80105b81:	83 ec 0c             	sub    $0xc,%esp
+80105b84:	ff 76 68             	push   0x68(%esi)
+80105b87:	e8 84 fe ff ff       	call   80105a10 <wakeup>
+    p->parent = initproc;
+80105b8c:	8b 15 14 fc 11 80    	mov    0x8011fc14,%edx
+  while ((p = curproc->kids) != 0) {
+80105b92:	8b 46 6c             	mov    0x6c(%esi),%eax
+80105b95:	83 c4 10             	add    $0x10,%esp
+    childpush(&initproc->kids, p);
+80105b98:	8d 5a 6c             	lea    0x6c(%edx),%ebx
+  while ((p = curproc->kids) != 0) {
+80105b9b:	85 c0                	test   %eax,%eax
+80105b9d:	74 36                	je     80105bd5 <exit+0x105>
+80105b9f:	90                   	nop
+  *p->sibprev = p->sibling;
+80105ba0:	8b 78 78             	mov    0x78(%eax),%edi
+80105ba3:	8b 48 74             	mov    0x74(%eax),%ecx
+80105ba6:	89 0f                	mov    %ecx,(%edi)
+  if(p->sibling)
+80105ba8:	85 c9                	test   %ecx,%ecx
+80105baa:	74 06                	je     80105bb2 <exit+0xe2>
+    p->sibling->sibprev = p->sibprev;
+80105bac:	8b 78 78             	mov    0x78(%eax),%edi
+80105baf:	89 79 78             	mov    %edi,0x78(%ecx)
+    p->parent = initproc;
+80105bb2:	89 50 68             	mov    %edx,0x68(%eax)
+  p->sibling = *list;
+80105bb5:	8b 4a 6c             	mov    0x6c(%edx),%ecx
+  p->sibprev = list;
+80105bb8:	89 58 78             	mov    %ebx,0x78(%eax)
+  p->sibling = *list;
+80105bbb:	89 48 74             	mov    %ecx,0x74(%eax)
+  if(*list)
+80105bbe:	8b 4a 6c             	mov    0x6c(%edx),%ecx
+80105bc1:	85 c9                	test   %ecx,%ecx
+80105bc3:	74 06                	je     80105bcb <exit+0xfb>
+    (*list)->sibprev = &p->sibling;
+80105bc5:	8d 78 74             	lea    0x74(%eax),%edi
+80105bc8:	89 79 78             	mov    %edi,0x78(%ecx)
+  *list = p;
+80105bcb:	89 42 6c             	mov    %eax,0x6c(%edx)
+  while ((p = curproc->kids) != 0) {
+80105bce:	8b 46 6c             	mov    0x6c(%esi),%eax
+80105bd1:	85 c0                	test   %eax,%eax
+80105bd3:	75 cb                	jne    80105ba0 <exit+0xd0>
+      p->parent = initproc;
+80105bd5:	8b 15 14 fc 11 80    	mov    0x8011fc14,%edx
+  if (curproc->zombies) {
+80105bdb:	8b 46 70             	mov    0x70(%esi),%eax
+      childpush(&initproc->zombies, p);
+80105bde:	8d 5a 70             	lea    0x70(%edx),%ebx
+  if (curproc->zombies) {
+80105be1:	85 c0                	test   %eax,%eax
+80105be3:	74 44                	je     80105c29 <exit+0x159>
+80105be5:	8d 76 00             	lea    0x0(%esi),%esi
+  *p->sibprev = p->sibling;
+80105be8:	8b 78 78             	mov    0x78(%eax),%edi
+80105beb:	8b 48 74             	mov    0x74(%eax),%ecx
+80105bee:	89 0f                	mov    %ecx,(%edi)
+  if(p->sibling)
+80105bf0:	85 c9                	test   %ecx,%ecx
+80105bf2:	74 06                	je     80105bfa <exit+0x12a>
+    p->sibling->sibprev = p->sibprev;
+80105bf4:	8b 78 78             	mov    0x78(%eax),%edi
+80105bf7:	89 79 78             	mov    %edi,0x78(%ecx)
+      p->parent = initproc;
+80105bfa:	89 50 68             	mov    %edx,0x68(%eax)
+  p->sibling = *list;
+80105bfd:	8b 4a 70             	mov    0x70(%edx),%ecx
+  p->sibprev = list;
+80105c00:	89 58 78             	mov    %ebx,0x78(%eax)
+  p->sibling = *list;
+80105c03:	89 48 74             	mov    %ecx,0x74(%eax)
+  if(*list)
+80105c06:	8b 4a 70             	mov    0x70(%edx),%ecx
+80105c09:	85 c9                	test   %ecx,%ecx
+80105c0b:	74 06                	je     80105c13 <exit+0x143>
+    (*list)->sibprev = &p->sibling;
+80105c0d:	8d 78 74             	lea    0x74(%eax),%edi
+80105c10:	89 79 78             	mov    %edi,0x78(%ecx)
+  *list = p;
+80105c13:	89 42 70             	mov    %eax,0x70(%edx)
+    while ((p = curproc->zombies) != 0) {
+80105c16:	8b 46 70             	mov    0x70(%esi),%eax
+80105c19:	85 c0                	test   %eax,%eax
+80105c1b:	75 cb                	jne    80105be8 <exit+0x118>
+    wakeup(initproc);
+80105c1d:	83 ec 0c             	sub    $0xc,%esp
+80105c20:	52                   	push   %edx
+80105c21:	e8 ea fd ff ff       	call   80105a10 <wakeup>
+80105c26:	83 c4 10             	add    $0x10,%esp
+  acquire(&curproc->lock);
+80105c29:	83 ec 0c             	sub    $0xc,%esp
+80105c2c:	56                   	push   %esi
+80105c2d:	e8 fe 10 00 00       	call   80106d30 <acquire>
+  curproc->state = ZOMBIE;
+80105c32:	c7 46 60 05 00 00 00 	movl   $0x5,0x60(%esi)
+  release(&ptable.lock);
+80105c39:	c7 04 24 c0 8d 11 80 	movl   $0x80118dc0,(%esp)
+80105c40:	e8 ab 0f 00 00       	call   80106bf0 <release>
+  sched();
+80105c45:	e8 b6 f9 ff ff       	call   80105600 <sched>
+  panic("zombie exit");
+80105c4a:	c7 04 24 7a b8 10 80 	movl   $0x8010b87a,(%esp)
+80105c51:	e8 8a a7 ff ff       	call   801003e0 <panic>
+    panic("init exiting");
+80105c56:	83 ec 0c             	sub    $0xc,%esp
+80105c59:	68 6d b8 10 80       	push   $0x8010b86d
+80105c5e:	e8 7d a7 ff ff       	call   801003e0 <panic>
+80105c63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105c70 <kill>:
+{
+80105c70:	55                   	push   %ebp
+80105c71:	89 e5                	mov    %esp,%ebp
+80105c73:	57                   	push   %edi
+80105c74:	56                   	push   %esi
+80105c75:	53                   	push   %ebx
+80105c76:	83 ec 18             	sub    $0x18,%esp
+80105c79:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+80105c7c:	89 f7                	mov    %esi,%edi
+80105c7e:	83 e7 3f             	and    $0x3f,%edi
+  acquireread(&ph->lock);
+80105c81:	c1 e7 04             	shl    $0x4,%edi
+80105c84:	81 c7 e0 6f 11 80    	add    $0x80116fe0,%edi
+80105c8a:	57                   	push   %edi
+80105c8b:	e8 40 09 00 00       	call   801065d0 <acquireread>
+  for(p = ph->head; p; p = p->pidnext){
+80105c90:	8b 5f 0c             	mov    0xc(%edi),%ebx
+80105c93:	83 c4 10             	add    $0x10,%esp
+80105c96:	85 db                	test   %ebx,%ebx
+80105c98:	75 0d                	jne    80105ca7 <kill+0x37>
+80105c9a:	eb 54                	jmp    80105cf0 <kill+0x80>
+80105c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105ca0:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80105ca3:	85 db                	test   %ebx,%ebx
+80105ca5:	74 49                	je     80105cf0 <kill+0x80>
+    if(p->pid == pid){
+80105ca7:	3b 73 64             	cmp    0x64(%ebx),%esi
+80105caa:	75 f4                	jne    80105ca0 <kill+0x30>
+      acquire(&p->lock);
+80105cac:	83 ec 0c             	sub    $0xc,%esp
+80105caf:	53                   	push   %ebx
+80105cb0:	e8 7b 10 00 00       	call   80106d30 <acquire>
+  releaseread(&ph->lock);
+80105cb5:	89 3c 24             	mov    %edi,(%esp)
+80105cb8:	e8 63 09 00 00       	call   80106620 <releaseread>
+  if (p->state == SLEEPING)
+80105cbd:	83 c4 10             	add    $0x10,%esp
+80105cc0:	83 7b 60 02          	cmpl   $0x2,0x60(%ebx)
+  p->killed = 1;
+80105cc4:	c7 83 90 00 00 00 01 	movl   $0x1,0x90(%ebx)
+80105ccb:	00 00 00 
+  if (p->state == SLEEPING)
+80105cce:	74 40                	je     80105d10 <kill+0xa0>
+  release(&p->lock);
+80105cd0:	83 ec 0c             	sub    $0xc,%esp
+80105cd3:	53                   	push   %ebx
+80105cd4:	e8 17 0f 00 00       	call   80106bf0 <release>
+  return 0;
+80105cd9:	83 c4 10             	add    $0x10,%esp
+}
+80105cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80105cdf:	31 c0                	xor    %eax,%eax
+}
+80105ce1:	5b                   	pop    %ebx
+80105ce2:	5e                   	pop    %esi
+80105ce3:	5f                   	pop    %edi
+80105ce4:	5d                   	pop    %ebp
+80105ce5:	c3                   	ret
+80105ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ced:	8d 76 00             	lea    0x0(%esi),%esi
+  releaseread(&ph->lock);
+80105cf0:	83 ec 0c             	sub    $0xc,%esp
+80105cf3:	57                   	push   %edi
+80105cf4:	e8 27 09 00 00       	call   80106620 <releaseread>
+  return p;
+80105cf9:	83 c4 10             	add    $0x10,%esp
+}
+80105cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1; // no PID match found
+80105cff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105d04:	5b                   	pop    %ebx
+80105d05:	5e                   	pop    %esi
+80105d06:	5f                   	pop    %edi
+80105d07:	5d                   	pop    %ebp
+80105d08:	c3                   	ret
+80105d09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    setrunnable(p);
+80105d10:	89 d8                	mov    %ebx,%eax
+80105d12:	e8 c9 ed ff ff       	call   80104ae0 <setrunnable>
+80105d17:	eb b7                	jmp    80105cd0 <kill+0x60>
+80105d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105d20 <setpriority>:
+{
+80105d20:	55                   	push   %ebp
+80105d21:	89 e5                	mov    %esp,%ebp
+80105d23:	57                   	push   %edi
+80105d24:	56                   	push   %esi
+80105d25:	53                   	push   %ebx
+80105d26:	83 ec 1c             	sub    $0x1c,%esp
+  if(prio < -1 || prio >= NPRIO || (p = findproc(pid)) == 0)
+80105d29:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+80105d2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(prio < -1 || prio >= NPRIO || (p = findproc(pid)) == 0)
+80105d2f:	83 c0 01             	add    $0x1,%eax
+80105d32:	83 f8 04             	cmp    $0x4,%eax
+80105d35:	77 7d                	ja     80105db4 <setpriority+0x94>
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+80105d37:	89 f0                	mov    %esi,%eax
+  acquireread(&ph->lock);
+80105d39:	83 ec 0c             	sub    $0xc,%esp
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+80105d3c:	83 e0 3f             	and    $0x3f,%eax
+  acquireread(&ph->lock);
+80105d3f:	c1 e0 04             	shl    $0x4,%eax
+80105d42:	8d b8 e0 6f 11 80    	lea    -0x7fee9020(%eax),%edi
+80105d48:	57                   	push   %edi
+80105d49:	e8 82 08 00 00       	call   801065d0 <acquireread>
+  for(p = ph->head; p; p = p->pidnext){
+80105d4e:	8b 5f 0c             	mov    0xc(%edi),%ebx
+80105d51:	83 c4 10             	add    $0x10,%esp
+80105d54:	85 db                	test   %ebx,%ebx
+80105d56:	75 0f                	jne    80105d67 <setpriority+0x47>
+80105d58:	eb 4e                	jmp    80105da8 <setpriority+0x88>
+80105d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105d60:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80105d63:	85 db                	test   %ebx,%ebx
+80105d65:	74 41                	je     80105da8 <setpriority+0x88>
+    if(p->pid == pid){
+80105d67:	3b 73 64             	cmp    0x64(%ebx),%esi
+80105d6a:	75 f4                	jne    80105d60 <setpriority+0x40>
+      acquire(&p->lock);
+80105d6c:	83 ec 0c             	sub    $0xc,%esp
+80105d6f:	53                   	push   %ebx
+80105d70:	e8 bb 0f 00 00       	call   80106d30 <acquire>
+  releaseread(&ph->lock);
+80105d75:	89 3c 24             	mov    %edi,(%esp)
+80105d78:	e8 a3 08 00 00       	call   80106620 <releaseread>
+  if(prio < 0){
+80105d7d:	83 c4 10             	add    $0x10,%esp
+80105d80:	83 7d 0c ff          	cmpl   $0xffffffff,0xc(%ebp)
+80105d84:	74 42                	je     80105dc8 <setpriority+0xa8>
+  p->nice = prio;
+80105d86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  release(&p->lock);
+80105d89:	83 ec 0c             	sub    $0xc,%esp
+  p->nice = prio;
+80105d8c:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+  release(&p->lock);
+80105d92:	53                   	push   %ebx
+80105d93:	e8 58 0e 00 00       	call   80106bf0 <release>
+  return 0;
+80105d98:	83 c4 10             	add    $0x10,%esp
+}
+80105d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80105d9e:	31 c0                	xor    %eax,%eax
+}
+80105da0:	5b                   	pop    %ebx
+80105da1:	5e                   	pop    %esi
+80105da2:	5f                   	pop    %edi
+80105da3:	5d                   	pop    %ebp
+80105da4:	c3                   	ret
+80105da5:	8d 76 00             	lea    0x0(%esi),%esi
+  releaseread(&ph->lock);
+80105da8:	83 ec 0c             	sub    $0xc,%esp
+80105dab:	57                   	push   %edi
+80105dac:	e8 6f 08 00 00       	call   80106620 <releaseread>
+  return p;
+80105db1:	83 c4 10             	add    $0x10,%esp
+}
+80105db4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80105db7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105dbc:	5b                   	pop    %ebx
+80105dbd:	5e                   	pop    %esi
+80105dbe:	5f                   	pop    %edi
+80105dbf:	5d                   	pop    %ebp
+80105dc0:	c3                   	ret
+80105dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(p->boostgen != boostgen){
+80105dc8:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80105dcd:	39 83 f8 00 00 00    	cmp    %eax,0xf8(%ebx)
+80105dd3:	74 3b                	je     80105e10 <setpriority+0xf0>
+    p->slice = 0;
+80105dd5:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80105ddc:	00 00 00 
+    p->boostgen = boostgen;
+80105ddf:	a1 18 fc 11 80       	mov    0x8011fc18,%eax
+80105de4:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+    p->prio = p->nice;
+80105dea:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+80105df0:	89 83 f0 00 00 00    	mov    %eax,0xf0(%ebx)
+    release(&p->lock);
+80105df6:	83 ec 0c             	sub    $0xc,%esp
+80105df9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105dfc:	53                   	push   %ebx
+80105dfd:	e8 ee 0d 00 00       	call   80106bf0 <release>
+    return prio;
+80105e02:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105e05:	83 c4 10             	add    $0x10,%esp
+}
+80105e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105e0b:	5b                   	pop    %ebx
+80105e0c:	5e                   	pop    %esi
+80105e0d:	5f                   	pop    %edi
+80105e0e:	5d                   	pop    %ebp
+80105e0f:	c3                   	ret
+    prio = p->prio;
+80105e10:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80105e16:	eb de                	jmp    80105df6 <setpriority+0xd6>
+80105e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e1f:	90                   	nop
+
+80105e20 <setaffinity>:
+{
+80105e20:	55                   	push   %ebp
+80105e21:	89 e5                	mov    %esp,%ebp
+80105e23:	57                   	push   %edi
+80105e24:	56                   	push   %esi
+  mask &= (1 << ncpu) - 1;
+80105e25:	be 01 00 00 00       	mov    $0x1,%esi
+{
+80105e2a:	53                   	push   %ebx
+80105e2b:	83 ec 1c             	sub    $0x1c,%esp
+  mask &= (1 << ncpu) - 1;
+80105e2e:	8b 0d 64 68 11 80    	mov    0x80116864,%ecx
+{
+80105e34:	8b 7d 08             	mov    0x8(%ebp),%edi
+  mask &= (1 << ncpu) - 1;
+80105e37:	d3 e6                	shl    %cl,%esi
+80105e39:	83 ee 01             	sub    $0x1,%esi
+  if(mask == 0 || (p = findproc(pid)) == 0)
+80105e3c:	23 75 0c             	and    0xc(%ebp),%esi
+80105e3f:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+80105e42:	0f 84 8c 00 00 00    	je     80105ed4 <setaffinity+0xb4>
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+80105e48:	89 f8                	mov    %edi,%eax
+  acquireread(&ph->lock);
+80105e4a:	83 ec 0c             	sub    $0xc,%esp
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+80105e4d:	83 e0 3f             	and    $0x3f,%eax
+  acquireread(&ph->lock);
+80105e50:	c1 e0 04             	shl    $0x4,%eax
+80105e53:	8d b0 e0 6f 11 80    	lea    -0x7fee9020(%eax),%esi
+80105e59:	56                   	push   %esi
+80105e5a:	e8 71 07 00 00       	call   801065d0 <acquireread>
+  for(p = ph->head; p; p = p->pidnext){
+80105e5f:	8b 5e 0c             	mov    0xc(%esi),%ebx
+80105e62:	83 c4 10             	add    $0x10,%esp
+80105e65:	85 db                	test   %ebx,%ebx
+80105e67:	75 0e                	jne    80105e77 <setaffinity+0x57>
+80105e69:	eb 5d                	jmp    80105ec8 <setaffinity+0xa8>
+80105e6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105e6f:	90                   	nop
+80105e70:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80105e73:	85 db                	test   %ebx,%ebx
+80105e75:	74 51                	je     80105ec8 <setaffinity+0xa8>
+    if(p->pid == pid){
+80105e77:	3b 7b 64             	cmp    0x64(%ebx),%edi
+80105e7a:	75 f4                	jne    80105e70 <setaffinity+0x50>
+      acquire(&p->lock);
+80105e7c:	83 ec 0c             	sub    $0xc,%esp
+80105e7f:	53                   	push   %ebx
+80105e80:	e8 ab 0e 00 00       	call   80106d30 <acquire>
+  releaseread(&ph->lock);
+80105e85:	89 34 24             	mov    %esi,(%esp)
+80105e88:	e8 93 07 00 00       	call   80106620 <releaseread>
+  p->affinity = mask;
+80105e8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105e90:	89 83 00 01 00 00    	mov    %eax,0x100(%ebx)
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105e96:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80105e9c:	83 c4 10             	add    $0x10,%esp
+80105e9f:	39 c3                	cmp    %eax,%ebx
+80105ea1:	74 45                	je     80105ee8 <setaffinity+0xc8>
+  if(p->state == RUNNABLE && rqremove(p))
+80105ea3:	83 7b 60 03          	cmpl   $0x3,0x60(%ebx)
+80105ea7:	0f 84 a3 00 00 00    	je     80105f50 <setaffinity+0x130>
+  release(&p->lock);
+80105ead:	83 ec 0c             	sub    $0xc,%esp
+80105eb0:	53                   	push   %ebx
+80105eb1:	e8 3a 0d 00 00       	call   80106bf0 <release>
+80105eb6:	83 c4 10             	add    $0x10,%esp
+  return 0;
+80105eb9:	31 c0                	xor    %eax,%eax
+}
+80105ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105ebe:	5b                   	pop    %ebx
+80105ebf:	5e                   	pop    %esi
+80105ec0:	5f                   	pop    %edi
+80105ec1:	5d                   	pop    %ebp
+80105ec2:	c3                   	ret
+80105ec3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105ec7:	90                   	nop
+  releaseread(&ph->lock);
+80105ec8:	83 ec 0c             	sub    $0xc,%esp
+80105ecb:	56                   	push   %esi
+80105ecc:	e8 4f 07 00 00       	call   80106620 <releaseread>
+  return p;
+80105ed1:	83 c4 10             	add    $0x10,%esp
+}
+80105ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80105ed7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105edc:	5b                   	pop    %ebx
+80105edd:	5e                   	pop    %esi
+80105ede:	5f                   	pop    %edi
+80105edf:	5d                   	pop    %ebp
+80105ee0:	c3                   	ret
+80105ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105ee8:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80105eee:	2d 80 68 11 80       	sub    $0x80116880,%eax
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80105ef3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  return mycpu()-cpus;
+80105ef6:	c1 f8 02             	sar    $0x2,%eax
+80105ef9:	69 c0 f3 d8 8a a0    	imul   $0xa08ad8f3,%eax,%eax
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80105eff:	0f a3 c2             	bt     %eax,%edx
+80105f02:	72 9f                	jb     80105ea3 <setaffinity+0x83>
+  if(p->state == RUNNABLE && rqremove(p))
+80105f04:	83 7b 60 03          	cmpl   $0x3,0x60(%ebx)
+80105f08:	0f 84 62 01 00 00    	je     80106070 <setaffinity+0x250>
+  release(&p->lock);
+80105f0e:	83 ec 0c             	sub    $0xc,%esp
+80105f11:	53                   	push   %ebx
+80105f12:	e8 d9 0c 00 00       	call   80106bf0 <release>
+80105f17:	83 c4 10             	add    $0x10,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80105f1a:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  acquire(&p->lock);  //DOC: yieldlock
+80105f21:	83 ec 0c             	sub    $0xc,%esp
+80105f24:	53                   	push   %ebx
+80105f25:	e8 06 0e 00 00       	call   80106d30 <acquire>
+  setrunnable(p);
+80105f2a:	89 d8                	mov    %ebx,%eax
+80105f2c:	e8 af eb ff ff       	call   80104ae0 <setrunnable>
+  p->nivcsw++;
+80105f31:	83 83 18 01 00 00 01 	addl   $0x1,0x118(%ebx)
+  sched();
+80105f38:	e8 c3 f6 ff ff       	call   80105600 <sched>
+  release(&p->lock);
+80105f3d:	89 1c 24             	mov    %ebx,(%esp)
+80105f40:	e8 ab 0c 00 00       	call   80106bf0 <release>
+}
+80105f45:	83 c4 10             	add    $0x10,%esp
+  return 0;
+80105f48:	31 c0                	xor    %eax,%eax
+80105f4a:	e9 6c ff ff ff       	jmp    80105ebb <setaffinity+0x9b>
+80105f4f:	90                   	nop
+  for(c = 0; c < ncpu; c++){
+80105f50:	8b 15 64 68 11 80    	mov    0x80116864,%edx
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80105f56:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  for(c = 0; c < ncpu; c++){
+80105f5d:	85 d2                	test   %edx,%edx
+80105f5f:	0f 8e 48 ff ff ff    	jle    80105ead <setaffinity+0x8d>
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80105f65:	31 c0                	xor    %eax,%eax
+  for(c = 0; c < ncpu; c++){
+80105f67:	31 ff                	xor    %edi,%edi
+    if(p->affinity & (1 << c))
+80105f69:	ba 01 00 00 00       	mov    $0x1,%edx
+80105f6e:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80105f71:	89 c6                	mov    %eax,%esi
+80105f73:	89 d3                	mov    %edx,%ebx
+80105f75:	89 f9                	mov    %edi,%ecx
+80105f77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105f7a:	d3 e3                	shl    %cl,%ebx
+80105f7c:	85 c3                	test   %eax,%ebx
+80105f7e:	74 25                	je     80105fa5 <setaffinity+0x185>
+  for(c = 0; c < ncpu; c++){
+80105f80:	83 c7 01             	add    $0x1,%edi
+80105f83:	83 c6 7c             	add    $0x7c,%esi
+80105f86:	3b 3d 64 68 11 80    	cmp    0x80116864,%edi
+80105f8c:	0f 8d d9 00 00 00    	jge    8010606b <setaffinity+0x24b>
+    if(p->affinity & (1 << c))
+80105f92:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80105f95:	89 d3                	mov    %edx,%ebx
+80105f97:	89 f9                	mov    %edi,%ecx
+80105f99:	d3 e3                	shl    %cl,%ebx
+80105f9b:	8b 80 00 01 00 00    	mov    0x100(%eax),%eax
+80105fa1:	85 c3                	test   %eax,%ebx
+80105fa3:	75 db                	jne    80105f80 <setaffinity+0x160>
+    acquire(&rq->lock);
+80105fa5:	8d 86 e0 89 11 80    	lea    -0x7fee7620(%esi),%eax
+80105fab:	83 ec 0c             	sub    $0xc,%esp
+80105fae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105fb1:	50                   	push   %eax
+80105fb2:	e8 79 0d 00 00       	call   80106d30 <acquire>
+    for(i = 0; i < NPRIO; i++){
+80105fb7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    acquire(&rq->lock);
+80105fba:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NPRIO; i++){
+80105fbd:	31 c9                	xor    %ecx,%ecx
+      for(pp = &rq->q[i].head; *pp; prev = *pp, pp = &(*pp)->rqnext){
+80105fbf:	8b 84 ce 34 8a 11 80 	mov    -0x7fee75cc(%esi,%ecx,8),%eax
+80105fc6:	85 c0                	test   %eax,%eax
+80105fc8:	0f 84 c2 00 00 00    	je     80106090 <setaffinity+0x270>
+        if(*pp != p)
+80105fce:	39 c3                	cmp    %eax,%ebx
+80105fd0:	74 7e                	je     80106050 <setaffinity+0x230>
+      for(pp = &rq->q[i].head; *pp; prev = *pp, pp = &(*pp)->rqnext){
+80105fd2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105fd5:	8b 80 e8 00 00 00    	mov    0xe8(%eax),%eax
+80105fdb:	85 c0                	test   %eax,%eax
+80105fdd:	0f 84 ad 00 00 00    	je     80106090 <setaffinity+0x270>
+        if(*pp != p)
+80105fe3:	39 d8                	cmp    %ebx,%eax
+80105fe5:	75 eb                	jne    80105fd2 <setaffinity+0x1b2>
+      for(pp = &rq->q[i].head; *pp; prev = *pp, pp = &(*pp)->rqnext){
+80105fe7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80105fea:	8d 51 0a             	lea    0xa(%ecx),%edx
+80105fed:	05 e8 00 00 00       	add    $0xe8,%eax
+        *pp = p->rqnext;
+80105ff2:	8b 8b e8 00 00 00    	mov    0xe8(%ebx),%ecx
+80105ff8:	89 08                	mov    %ecx,(%eax)
+        if(rq->q[i].tail == p)
+80105ffa:	6b c7 7c             	imul   $0x7c,%edi,%eax
+80105ffd:	8d 84 d0 e0 89 11 80 	lea    -0x7fee7620(%eax,%edx,8),%eax
+80106004:	3b 58 08             	cmp    0x8(%eax),%ebx
+80106007:	74 5a                	je     80106063 <setaffinity+0x243>
+        rq->n--;
+80106009:	6b ff 7c             	imul   $0x7c,%edi,%edi
+        release(&rq->lock);
+8010600c:	83 ec 0c             	sub    $0xc,%esp
+        rq->n--;
+8010600f:	8b 87 54 8a 11 80    	mov    -0x7fee75ac(%edi),%eax
+80106015:	83 e8 01             	sub    $0x1,%eax
+80106018:	89 87 54 8a 11 80    	mov    %eax,-0x7fee75ac(%edi)
+        release(&rq->lock);
+8010601e:	ff 75 e4             	push   -0x1c(%ebp)
+80106021:	e8 ca 0b 00 00       	call   80106bf0 <release>
+    setrunnable(p);
+80106026:	89 d8                	mov    %ebx,%eax
+80106028:	e8 b3 ea ff ff       	call   80104ae0 <setrunnable>
+8010602d:	83 c4 10             	add    $0x10,%esp
+  release(&p->lock);
+80106030:	83 ec 0c             	sub    $0xc,%esp
+80106033:	53                   	push   %ebx
+80106034:	e8 b7 0b 00 00       	call   80106bf0 <release>
+  if(move)
+80106039:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010603c:	83 c4 10             	add    $0x10,%esp
+8010603f:	85 c0                	test   %eax,%eax
+80106041:	0f 85 d3 fe ff ff    	jne    80105f1a <setaffinity+0xfa>
+  return 0;
+80106047:	31 c0                	xor    %eax,%eax
+80106049:	e9 6d fe ff ff       	jmp    80105ebb <setaffinity+0x9b>
+8010604e:	66 90                	xchg   %ax,%ax
+      prev = 0;
+80106050:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      for(pp = &rq->q[i].head; *pp; prev = *pp, pp = &(*pp)->rqnext){
+80106057:	8d 51 0a             	lea    0xa(%ecx),%edx
+8010605a:	8d 84 ce 34 8a 11 80 	lea    -0x7fee75cc(%esi,%ecx,8),%eax
+80106061:	eb 8f                	jmp    80105ff2 <setaffinity+0x1d2>
+          rq->q[i].tail = prev;
+80106063:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80106066:	89 50 08             	mov    %edx,0x8(%eax)
+80106069:	eb 9e                	jmp    80106009 <setaffinity+0x1e9>
+8010606b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010606e:	eb c0                	jmp    80106030 <setaffinity+0x210>
+  for(c = 0; c < ncpu; c++){
+80106070:	8b 0d 64 68 11 80    	mov    0x80116864,%ecx
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+80106076:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+  for(c = 0; c < ncpu; c++){
+8010607d:	85 c9                	test   %ecx,%ecx
+8010607f:	0f 8f e0 fe ff ff    	jg     80105f65 <setaffinity+0x145>
+80106085:	e9 84 fe ff ff       	jmp    80105f0e <setaffinity+0xee>
+8010608a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    for(i = 0; i < NPRIO; i++){
+80106090:	83 c1 01             	add    $0x1,%ecx
+80106093:	83 f9 04             	cmp    $0x4,%ecx
+80106096:	0f 85 23 ff ff ff    	jne    80105fbf <setaffinity+0x19f>
+    release(&rq->lock);
+8010609c:	83 ec 0c             	sub    $0xc,%esp
+8010609f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+801060a2:	ff 75 e4             	push   -0x1c(%ebp)
+801060a5:	e8 46 0b 00 00       	call   80106bf0 <release>
+801060aa:	83 c4 10             	add    $0x10,%esp
+801060ad:	ba 01 00 00 00       	mov    $0x1,%edx
+801060b2:	e9 c9 fe ff ff       	jmp    80105f80 <setaffinity+0x160>
+801060b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801060be:	66 90                	xchg   %ax,%ax
+
+801060c0 <getrusage>:
+// or of the caller if pid is 0, or if pid is -1, of up to n
+// processes. Returns how many were copied, or -1 if there is no
+// process pid.
+int
+getrusage(int pid, struct rusage *ru, int n)
+{
+801060c0:	55                   	push   %ebp
+801060c1:	89 e5                	mov    %esp,%ebp
+801060c3:	57                   	push   %edi
+801060c4:	56                   	push   %esi
+801060c5:	53                   	push   %ebx
+801060c6:	83 ec 1c             	sub    $0x1c,%esp
+801060c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+801060cc:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct proc *p;
+  int i;
+
+  if(pid != -1){
+801060cf:	83 ff ff             	cmp    $0xffffffff,%edi
+801060d2:	0f 84 a8 00 00 00    	je     80106180 <getrusage+0xc0>
+    if(n < 1)
+801060d8:	85 f6                	test   %esi,%esi
+801060da:	0f 8e 0c 01 00 00    	jle    801061ec <getrusage+0x12c>
+      return -1;
+    if(pid == 0){
+801060e0:	85 ff                	test   %edi,%edi
+801060e2:	74 5c                	je     80106140 <getrusage+0x80>
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+801060e4:	89 f8                	mov    %edi,%eax
+  acquireread(&ph->lock);
+801060e6:	83 ec 0c             	sub    $0xc,%esp
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+801060e9:	83 e0 3f             	and    $0x3f,%eax
+  acquireread(&ph->lock);
+801060ec:	c1 e0 04             	shl    $0x4,%eax
+801060ef:	8d b0 e0 6f 11 80    	lea    -0x7fee9020(%eax),%esi
+801060f5:	56                   	push   %esi
+801060f6:	e8 d5 04 00 00       	call   801065d0 <acquireread>
+  for(p = ph->head; p; p = p->pidnext){
+801060fb:	8b 5e 0c             	mov    0xc(%esi),%ebx
+801060fe:	83 c4 10             	add    $0x10,%esp
+80106101:	85 db                	test   %ebx,%ebx
+80106103:	75 16                	jne    8010611b <getrusage+0x5b>
+80106105:	e9 d6 00 00 00       	jmp    801061e0 <getrusage+0x120>
+8010610a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106110:	8b 5b 7c             	mov    0x7c(%ebx),%ebx
+80106113:	85 db                	test   %ebx,%ebx
+80106115:	0f 84 c5 00 00 00    	je     801061e0 <getrusage+0x120>
+    if(p->pid == pid){
+8010611b:	3b 7b 64             	cmp    0x64(%ebx),%edi
+8010611e:	75 f0                	jne    80106110 <getrusage+0x50>
+      acquire(&p->lock);
+80106120:	83 ec 0c             	sub    $0xc,%esp
+80106123:	89 df                	mov    %ebx,%edi
+80106125:	53                   	push   %ebx
+80106126:	e8 05 0c 00 00       	call   80106d30 <acquire>
+  releaseread(&ph->lock);
+8010612b:	89 34 24             	mov    %esi,(%esp)
+8010612e:	e8 ed 04 00 00       	call   80106620 <releaseread>
+80106133:	83 c4 10             	add    $0x10,%esp
+80106136:	eb 1d                	jmp    80106155 <getrusage+0x95>
+80106138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010613f:	90                   	nop
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+80106140:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+      p = myproc();
+      acquire(&p->lock);
+80106147:	83 ec 0c             	sub    $0xc,%esp
+8010614a:	89 df                	mov    %ebx,%edi
+8010614c:	53                   	push   %ebx
+8010614d:	e8 de 0b 00 00       	call   80106d30 <acquire>
+80106152:	83 c4 10             	add    $0x10,%esp
+    } else if((p = findproc(pid)) == 0)
+      return -1;
+    rusagefill(p, ru);
+80106155:	8b 55 0c             	mov    0xc(%ebp),%edx
+80106158:	89 d8                	mov    %ebx,%eax
+    release(&p->lock);
+    return 1;
+8010615a:	bb 01 00 00 00       	mov    $0x1,%ebx
+    rusagefill(p, ru);
+8010615f:	e8 2c e7 ff ff       	call   80104890 <rusagefill>
+    release(&p->lock);
+80106164:	83 ec 0c             	sub    $0xc,%esp
+80106167:	57                   	push   %edi
+80106168:	e8 83 0a 00 00       	call   80106bf0 <release>
+    return 1;
+8010616d:	83 c4 10             	add    $0x10,%esp
+    if(p->state != UNUSED)
+      rusagefill(p, &ru[i++]);
+    release(&p->lock);
+  }
+  return i;
+}
+80106170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106173:	89 d8                	mov    %ebx,%eax
+80106175:	5b                   	pop    %ebx
+80106176:	5e                   	pop    %esi
+80106177:	5f                   	pop    %edi
+80106178:	5d                   	pop    %ebp
+80106179:	c3                   	ret
+8010617a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  i = 0;
+80106180:	31 db                	xor    %ebx,%ebx
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80106182:	bf 14 8e 11 80       	mov    $0x80118e14,%edi
+80106187:	85 f6                	test   %esi,%esi
+80106189:	7f 23                	jg     801061ae <getrusage+0xee>
+8010618b:	eb e3                	jmp    80106170 <getrusage+0xb0>
+8010618d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&p->lock);
+80106190:	83 ec 0c             	sub    $0xc,%esp
+80106193:	57                   	push   %edi
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80106194:	81 c7 b8 01 00 00    	add    $0x1b8,%edi
+    release(&p->lock);
+8010619a:	e8 51 0a 00 00       	call   80106bf0 <release>
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+8010619f:	83 c4 10             	add    $0x10,%esp
+801061a2:	39 f3                	cmp    %esi,%ebx
+801061a4:	7d ca                	jge    80106170 <getrusage+0xb0>
+801061a6:	81 ff 14 fc 11 80    	cmp    $0x8011fc14,%edi
+801061ac:	73 c2                	jae    80106170 <getrusage+0xb0>
+    acquire(&p->lock);
+801061ae:	83 ec 0c             	sub    $0xc,%esp
+801061b1:	57                   	push   %edi
+801061b2:	e8 79 0b 00 00       	call   80106d30 <acquire>
+    if(p->state != UNUSED)
+801061b7:	8b 47 60             	mov    0x60(%edi),%eax
+801061ba:	83 c4 10             	add    $0x10,%esp
+801061bd:	85 c0                	test   %eax,%eax
+801061bf:	74 cf                	je     80106190 <getrusage+0xd0>
+      rusagefill(p, &ru[i++]);
+801061c1:	69 d3 d0 00 00 00    	imul   $0xd0,%ebx,%edx
+801061c7:	8d 43 01             	lea    0x1(%ebx),%eax
+801061ca:	03 55 0c             	add    0xc(%ebp),%edx
+801061cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801061d0:	89 f8                	mov    %edi,%eax
+801061d2:	e8 b9 e6 ff ff       	call   80104890 <rusagefill>
+801061d7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801061da:	eb b4                	jmp    80106190 <getrusage+0xd0>
+801061dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  releaseread(&ph->lock);
+801061e0:	83 ec 0c             	sub    $0xc,%esp
+801061e3:	56                   	push   %esi
+801061e4:	e8 37 04 00 00       	call   80106620 <releaseread>
+  return p;
+801061e9:	83 c4 10             	add    $0x10,%esp
+}
+801061ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+801061ef:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801061f4:	89 d8                	mov    %ebx,%eax
+801061f6:	5b                   	pop    %ebx
+801061f7:	5e                   	pop    %esi
+801061f8:	5f                   	pop    %edi
+801061f9:	5d                   	pop    %ebp
+801061fa:	c3                   	ret
+801061fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801061ff:	90                   	nop
+
+80106200 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80106200:	55                   	push   %ebp
+80106201:	89 e5                	mov    %esp,%ebp
+80106203:	57                   	push   %edi
+80106204:	56                   	push   %esi
+80106205:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80106208:	53                   	push   %ebx
+80106209:	bb ec 8e 11 80       	mov    $0x80118eec,%ebx
+8010620e:	83 ec 3c             	sub    $0x3c,%esp
+80106211:	eb 27                	jmp    8010623a <procdump+0x3a>
+80106213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106217:	90                   	nop
+    if (p->state == SLEEPING) { 
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for (i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80106218:	83 ec 0c             	sub    $0xc,%esp
+8010621b:	68 27 bd 10 80       	push   $0x8010bd27
+80106220:	e8 eb a4 ff ff       	call   80100710 <cprintf>
+80106225:	83 c4 10             	add    $0x10,%esp
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80106228:	81 c3 b8 01 00 00    	add    $0x1b8,%ebx
+8010622e:	81 fb ec fc 11 80    	cmp    $0x8011fcec,%ebx
+80106234:	0f 84 7e 00 00 00    	je     801062b8 <procdump+0xb8>
+    if (p->state == UNUSED)
+8010623a:	8b 43 88             	mov    -0x78(%ebx),%eax
+8010623d:	85 c0                	test   %eax,%eax
+8010623f:	74 e7                	je     80106228 <procdump+0x28>
+      state = "???";
+80106241:	ba 86 b8 10 80       	mov    $0x8010b886,%edx
+    if (p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80106246:	83 f8 05             	cmp    $0x5,%eax
+80106249:	77 11                	ja     8010625c <procdump+0x5c>
+8010624b:	8b 14 85 c0 b8 10 80 	mov    -0x7fef4740(,%eax,4),%edx
+      state = "???";
+80106252:	b8 86 b8 10 80       	mov    $0x8010b886,%eax
+80106257:	85 d2                	test   %edx,%edx
+80106259:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+8010625c:	53                   	push   %ebx
+8010625d:	52                   	push   %edx
+8010625e:	ff 73 8c             	push   -0x74(%ebx)
+80106261:	68 8a b8 10 80       	push   $0x8010b88a
+80106266:	e8 a5 a4 ff ff       	call   80100710 <cprintf>
+    if (p->state == SLEEPING) { 
+8010626b:	83 c4 10             	add    $0x10,%esp
+8010626e:	83 7b 88 02          	cmpl   $0x2,-0x78(%ebx)
+80106272:	75 a4                	jne    80106218 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80106274:	83 ec 08             	sub    $0x8,%esp
+80106277:	8d 45 c0             	lea    -0x40(%ebp),%eax
+8010627a:	8d 7d c0             	lea    -0x40(%ebp),%edi
+8010627d:	50                   	push   %eax
+8010627e:	8b 43 ac             	mov    -0x54(%ebx),%eax
+80106281:	8b 40 0c             	mov    0xc(%eax),%eax
+80106284:	83 c0 08             	add    $0x8,%eax
+80106287:	50                   	push   %eax
+80106288:	e8 03 08 00 00       	call   80106a90 <getcallerpcs>
+      for (i=0; i<10 && pc[i] != 0; i++)
+8010628d:	83 c4 10             	add    $0x10,%esp
+80106290:	8b 17                	mov    (%edi),%edx
+80106292:	85 d2                	test   %edx,%edx
+80106294:	74 82                	je     80106218 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80106296:	83 ec 08             	sub    $0x8,%esp
+      for (i=0; i<10 && pc[i] != 0; i++)
+80106299:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+8010629c:	52                   	push   %edx
+8010629d:	68 c1 b2 10 80       	push   $0x8010b2c1
+801062a2:	e8 69 a4 ff ff       	call   80100710 <cprintf>
+      for (i=0; i<10 && pc[i] != 0; i++)
+801062a7:	83 c4 10             	add    $0x10,%esp
+801062aa:	39 f7                	cmp    %esi,%edi
+801062ac:	75 e2                	jne    80106290 <procdump+0x90>
+801062ae:	e9 65 ff ff ff       	jmp    80106218 <procdump+0x18>
+801062b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801062b7:	90                   	nop
+  }
+}
+801062b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801062bb:	5b                   	pop    %ebx
+801062bc:	5e                   	pop    %esi
+801062bd:	5f                   	pop    %edi
+801062be:	5d                   	pop    %ebp
+801062bf:	c3                   	ret
+
+801062c0 <profinit>:
+static struct profbuf prof[NCPU];
+static int profrate;  // samples per tick, or 0 if not profiling
+
+void
+profinit(void)
+{
+801062c0:	55                   	push   %ebp
+801062c1:	89 e5                	mov    %esp,%ebp
+801062c3:	53                   	push   %ebx
+  struct profbuf *pb;
+
+  for(pb = prof; pb < &prof[NCPU]; pb++)
+801062c4:	bb 40 fc 11 80       	mov    $0x8011fc40,%ebx
+{
+801062c9:	83 ec 04             	sub    $0x4,%esp
+801062cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&pb->lock, "prof");
+801062d0:	83 ec 08             	sub    $0x8,%esp
+801062d3:	68 d8 b8 10 80       	push   $0x8010b8d8
+801062d8:	53                   	push   %ebx
+  for(pb = prof; pb < &prof[NCPU]; pb++)
+801062d9:	81 c3 60 60 00 00    	add    $0x6060,%ebx
+    initlock(&pb->lock, "prof");
+801062df:	e8 fc 06 00 00       	call   801069e0 <initlock>
+  for(pb = prof; pb < &prof[NCPU]; pb++)
+801062e4:	83 c4 10             	add    $0x10,%esp
+801062e7:	81 fb 40 ff 14 80    	cmp    $0x8014ff40,%ebx
+801062ed:	75 e1                	jne    801062d0 <profinit+0x10>
+}
+801062ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801062f2:	c9                   	leave
+801062f3:	c3                   	ret
+801062f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801062fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801062ff:	90                   	nop
+
+80106300 <profiling>:
+// Samples per tick, or 0 if the profiler is off.
+int
+profiling(void)
+{
+  return profrate;
+}
+80106300:	a1 20 fc 11 80       	mov    0x8011fc20,%eax
+80106305:	c3                   	ret
+80106306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010630d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106310 <profintr>:
+
+// Called on every timer interrupt, with interrupts off.
+void
+profintr(struct trapframe *tf)
+{
+80106310:	55                   	push   %ebp
+80106311:	89 e5                	mov    %esp,%ebp
+80106313:	57                   	push   %edi
+80106314:	56                   	push   %esi
+80106315:	53                   	push   %ebx
+80106316:	83 ec 1c             	sub    $0x1c,%esp
+80106319:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct profbuf *pb = &prof[cpuid()];
+8010631c:	e8 df ec ff ff       	call   80105000 <cpuid>
+  struct profsample *s;
+  struct proc *p;
+
+  if(profrate == 0)
+80106321:	8b 15 20 fc 11 80    	mov    0x8011fc20,%edx
+80106327:	85 d2                	test   %edx,%edx
+80106329:	75 0d                	jne    80106338 <profintr+0x28>
+      s->name[0] = 0;
+    }
+  } else
+    pb->dropped++;
+  release(&pb->lock);
+}
+8010632b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010632e:	5b                   	pop    %ebx
+8010632f:	5e                   	pop    %esi
+80106330:	5f                   	pop    %edi
+80106331:	5d                   	pop    %ebp
+80106332:	c3                   	ret
+80106333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106337:	90                   	nop
+  acquire(&pb->lock);
+80106338:	69 f0 60 60 00 00    	imul   $0x6060,%eax,%esi
+8010633e:	83 ec 0c             	sub    $0xc,%esp
+80106341:	8d be 40 fc 11 80    	lea    -0x7fee03c0(%esi),%edi
+80106347:	57                   	push   %edi
+80106348:	e8 e3 09 00 00       	call   80106d30 <acquire>
+  if(pb->w - pb->r < NPROF){
+8010634d:	8b 87 58 60 00 00    	mov    0x6058(%edi),%eax
+80106353:	83 c4 10             	add    $0x10,%esp
+80106356:	89 c2                	mov    %eax,%edx
+80106358:	2b 97 54 60 00 00    	sub    0x6054(%edi),%edx
+8010635e:	81 fa ff 03 00 00    	cmp    $0x3ff,%edx
+80106364:	76 1a                	jbe    80106380 <profintr+0x70>
+    pb->dropped++;
+80106366:	83 87 5c 60 00 00 01 	addl   $0x1,0x605c(%edi)
+  release(&pb->lock);
+8010636d:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+80106370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106373:	5b                   	pop    %ebx
+80106374:	5e                   	pop    %esi
+80106375:	5f                   	pop    %edi
+80106376:	5d                   	pop    %ebp
+  release(&pb->lock);
+80106377:	e9 74 08 00 00       	jmp    80106bf0 <release>
+8010637c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    s = &pb->s[pb->w++ % NPROF];
+80106380:	8d 50 01             	lea    0x1(%eax),%edx
+80106383:	25 ff 03 00 00       	and    $0x3ff,%eax
+80106388:	89 97 58 60 00 00    	mov    %edx,0x6058(%edi)
+    s->eip = tf->eip;
+8010638e:	8b 4b 38             	mov    0x38(%ebx),%ecx
+80106391:	8d 1c 40             	lea    (%eax,%eax,2),%ebx
+80106394:	c1 e3 03             	shl    $0x3,%ebx
+80106397:	8d 94 1e 40 fc 11 80 	lea    -0x7fee03c0(%esi,%ebx,1),%edx
+8010639e:	89 4a 54             	mov    %ecx,0x54(%edx)
+801063a1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    if((p = myproc()) != 0){
+801063a4:	e8 87 ec ff ff       	call   80105030 <myproc>
+801063a9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801063ac:	85 c0                	test   %eax,%eax
+801063ae:	74 28                	je     801063d8 <profintr+0xc8>
+      s->pid = p->pid;
+801063b0:	8b 48 64             	mov    0x64(%eax),%ecx
+      safestrcpy(s->name, p->name, sizeof(s->name));
+801063b3:	83 ec 04             	sub    $0x4,%esp
+801063b6:	05 d8 00 00 00       	add    $0xd8,%eax
+      s->pid = p->pid;
+801063bb:	89 4a 58             	mov    %ecx,0x58(%edx)
+      safestrcpy(s->name, p->name, sizeof(s->name));
+801063be:	6a 10                	push   $0x10
+801063c0:	50                   	push   %eax
+801063c1:	8d 84 1e 9c fc 11 80 	lea    -0x7fee0364(%esi,%ebx,1),%eax
+801063c8:	50                   	push   %eax
+801063c9:	e8 92 10 00 00       	call   80107460 <safestrcpy>
+801063ce:	83 c4 10             	add    $0x10,%esp
+801063d1:	eb 9a                	jmp    8010636d <profintr+0x5d>
+801063d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801063d7:	90                   	nop
+      s->pid = 0;
+801063d8:	c7 42 58 00 00 00 00 	movl   $0x0,0x58(%edx)
+      s->name[0] = 0;
+801063df:	c6 42 5c 00          	movb   $0x0,0x5c(%edx)
+801063e3:	eb 88                	jmp    8010636d <profintr+0x5d>
+801063e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801063f0 <profctl>:
+// samples not yet read, or stop if rate is 0. Returns the number
+// of samples lost since profiling started because a CPU's ring
+// was full, or -1 if rate is out of range.
+int
+profctl(int rate)
+{
+801063f0:	55                   	push   %ebp
+801063f1:	89 e5                	mov    %esp,%ebp
+801063f3:	57                   	push   %edi
+801063f4:	56                   	push   %esi
+801063f5:	53                   	push   %ebx
+801063f6:	83 ec 0c             	sub    $0xc,%esp
+801063f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct profbuf *pb;
+  int dropped, i;
+
+  if(rate < 0 || rate > MAXPROFRATE)
+801063fc:	83 ff 64             	cmp    $0x64,%edi
+801063ff:	0f 87 b5 00 00 00    	ja     801064ba <profctl+0xca>
+    return -1;
+  dropped = 0;
+80106405:	31 f6                	xor    %esi,%esi
+  for(pb = prof; pb < &prof[NCPU]; pb++){
+80106407:	bb 40 fc 11 80       	mov    $0x8011fc40,%ebx
+8010640c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    acquire(&pb->lock);
+80106410:	83 ec 0c             	sub    $0xc,%esp
+80106413:	53                   	push   %ebx
+80106414:	e8 17 09 00 00       	call   80106d30 <acquire>
+    dropped += pb->dropped;
+80106419:	03 b3 5c 60 00 00    	add    0x605c(%ebx),%esi
+    if(rate){
+8010641f:	83 c4 10             	add    $0x10,%esp
+80106422:	85 ff                	test   %edi,%edi
+80106424:	74 1e                	je     80106444 <profctl+0x54>
+      pb->r = pb->w = 0;
+80106426:	c7 83 58 60 00 00 00 	movl   $0x0,0x6058(%ebx)
+8010642d:	00 00 00 
+80106430:	c7 83 54 60 00 00 00 	movl   $0x0,0x6054(%ebx)
+80106437:	00 00 00 
+      pb->dropped = 0;
+8010643a:	c7 83 5c 60 00 00 00 	movl   $0x0,0x605c(%ebx)
+80106441:	00 00 00 
+    }
+    release(&pb->lock);
+80106444:	83 ec 0c             	sub    $0xc,%esp
+80106447:	53                   	push   %ebx
+  for(pb = prof; pb < &prof[NCPU]; pb++){
+80106448:	81 c3 60 60 00 00    	add    $0x6060,%ebx
+    release(&pb->lock);
+8010644e:	e8 9d 07 00 00       	call   80106bf0 <release>
+  for(pb = prof; pb < &prof[NCPU]; pb++){
+80106453:	83 c4 10             	add    $0x10,%esp
+80106456:	81 fb 40 ff 14 80    	cmp    $0x8014ff40,%ebx
+8010645c:	75 b2                	jne    80106410 <profctl+0x20>
+  }
+  profrate = rate;
+8010645e:	89 3d 20 fc 11 80    	mov    %edi,0x8011fc20
+
+  // Have every CPU rearm its timer.
+  pushcli();
+80106464:	e8 97 06 00 00       	call   80106b00 <pushcli>
+  timerarm();
+80106469:	e8 82 2e 00 00       	call   801092f0 <timerarm>
+  for(i = 0; i < ncpu; i++)
+8010646e:	a1 64 68 11 80       	mov    0x80116864,%eax
+80106473:	85 c0                	test   %eax,%eax
+80106475:	7e 34                	jle    801064ab <profctl+0xbb>
+80106477:	bf 80 68 11 80       	mov    $0x80116880,%edi
+8010647c:	31 db                	xor    %ebx,%ebx
+8010647e:	66 90                	xchg   %ax,%ax
+    if(i != cpuid())
+80106480:	e8 7b eb ff ff       	call   80105000 <cpuid>
+80106485:	39 d8                	cmp    %ebx,%eax
+80106487:	74 11                	je     8010649a <profctl+0xaa>
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+80106489:	83 ec 08             	sub    $0x8,%esp
+8010648c:	6a 3e                	push   $0x3e
+8010648e:	0f b6 07             	movzbl (%edi),%eax
+80106491:	50                   	push   %eax
+80106492:	e8 19 d3 ff ff       	call   801037b0 <lapicipi>
+80106497:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < ncpu; i++)
+8010649a:	83 c3 01             	add    $0x1,%ebx
+8010649d:	81 c7 ec 00 00 00    	add    $0xec,%edi
+801064a3:	39 1d 64 68 11 80    	cmp    %ebx,0x80116864
+801064a9:	7f d5                	jg     80106480 <profctl+0x90>
+  popcli();
+801064ab:	e8 a0 06 00 00       	call   80106b50 <popcli>
+  return dropped;
+}
+801064b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801064b3:	89 f0                	mov    %esi,%eax
+801064b5:	5b                   	pop    %ebx
+801064b6:	5e                   	pop    %esi
+801064b7:	5f                   	pop    %edi
+801064b8:	5d                   	pop    %ebp
+801064b9:	c3                   	ret
+    return -1;
+801064ba:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801064bf:	eb ef                	jmp    801064b0 <profctl+0xc0>
+801064c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801064c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801064cf:	90                   	nop
+
+801064d0 <profread>:
+
+// Copy out up to n samples, taking them out of the rings.
+// Returns how many were copied.
+int
+profread(struct profsample *s, int n)
+{
+801064d0:	55                   	push   %ebp
+801064d1:	89 e5                	mov    %esp,%ebp
+801064d3:	57                   	push   %edi
+801064d4:	56                   	push   %esi
+  struct profbuf *pb;
+  int i;
+
+  i = 0;
+801064d5:	31 f6                	xor    %esi,%esi
+{
+801064d7:	53                   	push   %ebx
+801064d8:	83 ec 1c             	sub    $0x1c,%esp
+801064db:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for(pb = prof; pb < &prof[NCPU] && i < n; pb++){
+801064de:	85 ff                	test   %edi,%edi
+801064e0:	0f 8e b9 00 00 00    	jle    8010659f <profread+0xcf>
+801064e6:	bb 40 fc 11 80       	mov    $0x8011fc40,%ebx
+801064eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801064ef:	90                   	nop
+    acquire(&pb->lock);
+801064f0:	83 ec 0c             	sub    $0xc,%esp
+801064f3:	53                   	push   %ebx
+801064f4:	e8 37 08 00 00       	call   80106d30 <acquire>
+    while(pb->r != pb->w && i < n)
+801064f9:	83 c4 10             	add    $0x10,%esp
+801064fc:	39 f7                	cmp    %esi,%edi
+801064fe:	8b 93 54 60 00 00    	mov    0x6054(%ebx),%edx
+80106504:	0f 9f c0             	setg   %al
+80106507:	89 c1                	mov    %eax,%ecx
+80106509:	39 93 58 60 00 00    	cmp    %edx,0x6058(%ebx)
+8010650f:	74 65                	je     80106576 <profread+0xa6>
+80106511:	84 c0                	test   %al,%al
+80106513:	74 61                	je     80106576 <profread+0xa6>
+80106515:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80106518:	8d 04 76             	lea    (%esi,%esi,2),%eax
+8010651b:	8d 04 c1             	lea    (%ecx,%eax,8),%eax
+8010651e:	eb 04                	jmp    80106524 <profread+0x54>
+80106520:	84 c9                	test   %cl,%cl
+80106522:	74 52                	je     80106576 <profread+0xa6>
+      s[i++] = pb->s[pb->r++ % NPROF];
+80106524:	8d 4a 01             	lea    0x1(%edx),%ecx
+80106527:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+8010652d:	83 c6 01             	add    $0x1,%esi
+80106530:	8d 14 52             	lea    (%edx,%edx,2),%edx
+80106533:	89 8b 54 60 00 00    	mov    %ecx,0x6054(%ebx)
+    while(pb->r != pb->w && i < n)
+80106539:	39 f7                	cmp    %esi,%edi
+      s[i++] = pb->s[pb->r++ % NPROF];
+8010653b:	8d 54 d3 50          	lea    0x50(%ebx,%edx,8),%edx
+8010653f:	8b 4a 04             	mov    0x4(%edx),%ecx
+80106542:	89 08                	mov    %ecx,(%eax)
+80106544:	8b 4a 08             	mov    0x8(%edx),%ecx
+80106547:	89 48 04             	mov    %ecx,0x4(%eax)
+8010654a:	8b 4a 0c             	mov    0xc(%edx),%ecx
+8010654d:	89 48 08             	mov    %ecx,0x8(%eax)
+80106550:	8b 4a 10             	mov    0x10(%edx),%ecx
+80106553:	89 48 0c             	mov    %ecx,0xc(%eax)
+80106556:	8b 4a 14             	mov    0x14(%edx),%ecx
+80106559:	89 48 10             	mov    %ecx,0x10(%eax)
+8010655c:	8b 52 18             	mov    0x18(%edx),%edx
+    while(pb->r != pb->w && i < n)
+8010655f:	0f 9f c1             	setg   %cl
+80106562:	83 c0 18             	add    $0x18,%eax
+      s[i++] = pb->s[pb->r++ % NPROF];
+80106565:	89 50 fc             	mov    %edx,-0x4(%eax)
+    while(pb->r != pb->w && i < n)
+80106568:	8b 93 54 60 00 00    	mov    0x6054(%ebx),%edx
+8010656e:	39 93 58 60 00 00    	cmp    %edx,0x6058(%ebx)
+80106574:	75 aa                	jne    80106520 <profread+0x50>
+    release(&pb->lock);
+80106576:	83 ec 0c             	sub    $0xc,%esp
+80106579:	88 4d e7             	mov    %cl,-0x19(%ebp)
+8010657c:	53                   	push   %ebx
+  for(pb = prof; pb < &prof[NCPU] && i < n; pb++){
+8010657d:	81 c3 60 60 00 00    	add    $0x6060,%ebx
+    release(&pb->lock);
+80106583:	e8 68 06 00 00       	call   80106bf0 <release>
+  for(pb = prof; pb < &prof[NCPU] && i < n; pb++){
+80106588:	83 c4 10             	add    $0x10,%esp
+8010658b:	81 fb 40 ff 14 80    	cmp    $0x8014ff40,%ebx
+80106591:	73 0c                	jae    8010659f <profread+0xcf>
+80106593:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+80106597:	84 c9                	test   %cl,%cl
+80106599:	0f 85 51 ff ff ff    	jne    801064f0 <profread+0x20>
+  }
+  return i;
+}
+8010659f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801065a2:	89 f0                	mov    %esi,%eax
+801065a4:	5b                   	pop    %ebx
+801065a5:	5e                   	pop    %esi
+801065a6:	5f                   	pop    %edi
+801065a7:	5d                   	pop    %ebp
+801065a8:	c3                   	ret
+801065a9:	66 90                	xchg   %ax,%ax
+801065ab:	66 90                	xchg   %ax,%ax
+801065ad:	66 90                	xchg   %ax,%ax
+801065af:	90                   	nop
+
+801065b0 <initrwlock>:
+#include "proc.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+801065b0:	55                   	push   %ebp
+801065b1:	89 e5                	mov    %esp,%ebp
+801065b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+801065b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->word = 0;
+801065b9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+801065bf:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+801065c2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+801065c9:	5d                   	pop    %ebp
+801065ca:	c3                   	ret
+801065cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801065cf:	90                   	nop
+
+801065d0 <acquireread>:
+
+// Acquire the lock for reading.
+void
+acquireread(struct rwlock *lk)
+{
+801065d0:	55                   	push   %ebp
+801065d1:	89 e5                	mov    %esp,%ebp
+801065d3:	56                   	push   %esi
+801065d4:	53                   	push   %ebx
+801065d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint w;
+
+  pushcli();
+801065d8:	e8 23 05 00 00       	call   80106b00 <pushcli>
+  if(lk->cpu == mycpu())
+801065dd:	8b 73 08             	mov    0x8(%ebx),%esi
+801065e0:	e8 3b ea ff ff       	call   80105020 <mycpu>
+801065e5:	39 c6                	cmp    %eax,%esi
+801065e7:	75 09                	jne    801065f2 <acquireread+0x22>
+801065e9:	eb 25                	jmp    80106610 <acquireread+0x40>
+801065eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801065ef:	90                   	nop
+    panic("acquireread");
+  for(;;){
+    w = lk->word;
+    if((w & (RW_WRITER|RW_WAIT)) == 0 && cmpxchg(&lk->word, w, w+1) == w)
+      break;
+    asm volatile("pause");
+801065f0:	f3 90                	pause
+    w = lk->word;
+801065f2:	8b 13                	mov    (%ebx),%edx
+    if((w & (RW_WRITER|RW_WAIT)) == 0 && cmpxchg(&lk->word, w, w+1) == w)
+801065f4:	81 fa ff ff ff 3f    	cmp    $0x3fffffff,%edx
+801065fa:	77 f4                	ja     801065f0 <acquireread+0x20>
+801065fc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  asm volatile("lock; cmpxchgl %2, %1" :
+801065ff:	89 d0                	mov    %edx,%eax
+80106601:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+80106605:	39 c2                	cmp    %eax,%edx
+80106607:	75 e7                	jne    801065f0 <acquireread+0x20>
+  }
+  // cmpxchg is a full barrier, so the critical section's loads
+  // can't move above it.
+}
+80106609:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010660c:	5b                   	pop    %ebx
+8010660d:	5e                   	pop    %esi
+8010660e:	5d                   	pop    %ebp
+8010660f:	c3                   	ret
+    panic("acquireread");
+80106610:	83 ec 0c             	sub    $0xc,%esp
+80106613:	68 dd b8 10 80       	push   $0x8010b8dd
+80106618:	e8 c3 9d ff ff       	call   801003e0 <panic>
+8010661d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106620 <releaseread>:
+
+void
+releaseread(struct rwlock *lk)
+{
+80106620:	55                   	push   %ebp
+80106621:	89 e5                	mov    %esp,%ebp
+80106623:	83 ec 08             	sub    $0x8,%esp
+80106626:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((lk->word & RW_READERS) == 0)
+80106629:	8b 10                	mov    (%eax),%edx
+8010662b:	81 e2 ff ff ff 3f    	and    $0x3fffffff,%edx
+80106631:	74 0f                	je     80106642 <releaseread+0x22>
+  asm volatile("lock; xaddl %0, %1" :
+80106633:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80106638:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    panic("releaseread");
+  xadd((volatile int*)&lk->word, -1);
+  popcli();
+}
+8010663c:	c9                   	leave
+  popcli();
+8010663d:	e9 0e 05 00 00       	jmp    80106b50 <popcli>
+    panic("releaseread");
+80106642:	83 ec 0c             	sub    $0xc,%esp
+80106645:	68 e9 b8 10 80       	push   $0x8010b8e9
+8010664a:	e8 91 9d ff ff       	call   801003e0 <panic>
+8010664f:	90                   	nop
+
+80106650 <acquirewrite>:
+
+// Acquire the lock for writing, waiting for any readers to leave.
+void
+acquirewrite(struct rwlock *lk)
+{
+80106650:	55                   	push   %ebp
+80106651:	89 e5                	mov    %esp,%ebp
+80106653:	56                   	push   %esi
+80106654:	53                   	push   %ebx
+80106655:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint w;
+
+  pushcli();
+80106658:	e8 a3 04 00 00       	call   80106b00 <pushcli>
+  if(lk->cpu == mycpu())
+8010665d:	8b 73 08             	mov    0x8(%ebx),%esi
+80106660:	e8 bb e9 ff ff       	call   80105020 <mycpu>
+80106665:	39 c6                	cmp    %eax,%esi
+80106667:	74 46                	je     801066af <acquirewrite+0x5f>
+  asm volatile("lock; cmpxchgl %2, %1" :
+80106669:	b9 00 00 00 80       	mov    $0x80000000,%ecx
+8010666e:	eb 0c                	jmp    8010667c <acquirewrite+0x2c>
+80106670:	89 d0                	mov    %edx,%eax
+80106672:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    panic("acquirewrite");
+  for(;;){
+    w = lk->word;
+    if((w & ~RW_WAIT) == 0){
+      if(cmpxchg(&lk->word, w, RW_WRITER) == w)
+80106676:	39 c2                	cmp    %eax,%edx
+80106678:	74 26                	je     801066a0 <acquirewrite+0x50>
+        break;
+    } else if((w & RW_WAIT) == 0)
+      cmpxchg(&lk->word, w, w | RW_WAIT);
+    asm volatile("pause");
+8010667a:	f3 90                	pause
+    w = lk->word;
+8010667c:	8b 13                	mov    (%ebx),%edx
+    if((w & ~RW_WAIT) == 0){
+8010667e:	f7 c2 ff ff ff bf    	test   $0xbfffffff,%edx
+80106684:	74 ea                	je     80106670 <acquirewrite+0x20>
+    } else if((w & RW_WAIT) == 0)
+80106686:	f7 c2 00 00 00 40    	test   $0x40000000,%edx
+8010668c:	75 ec                	jne    8010667a <acquirewrite+0x2a>
+      cmpxchg(&lk->word, w, w | RW_WAIT);
+8010668e:	89 d6                	mov    %edx,%esi
+80106690:	89 d0                	mov    %edx,%eax
+80106692:	81 ce 00 00 00 40    	or     $0x40000000,%esi
+80106698:	f0 0f b1 33          	lock cmpxchg %esi,(%ebx)
+  return result;
+8010669c:	eb dc                	jmp    8010667a <acquirewrite+0x2a>
+8010669e:	66 90                	xchg   %ax,%ax
+  }
+  lk->cpu = mycpu();
+801066a0:	e8 7b e9 ff ff       	call   80105020 <mycpu>
+801066a5:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+801066a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801066ab:	5b                   	pop    %ebx
+801066ac:	5e                   	pop    %esi
+801066ad:	5d                   	pop    %ebp
+801066ae:	c3                   	ret
+    panic("acquirewrite");
+801066af:	83 ec 0c             	sub    $0xc,%esp
+801066b2:	68 f5 b8 10 80       	push   $0x8010b8f5
+801066b7:	e8 24 9d ff ff       	call   801003e0 <panic>
+801066bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801066c0 <releasewrite>:
+
+void
+releasewrite(struct rwlock *lk)
+{
+801066c0:	55                   	push   %ebp
+801066c1:	89 e5                	mov    %esp,%ebp
+801066c3:	56                   	push   %esi
+801066c4:	53                   	push   %ebx
+801066c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((lk->word & RW_WRITER) == 0 || lk->cpu != mycpu())
+801066c8:	8b 03                	mov    (%ebx),%eax
+801066ca:	85 c0                	test   %eax,%eax
+801066cc:	79 29                	jns    801066f7 <releasewrite+0x37>
+801066ce:	8b 73 08             	mov    0x8(%ebx),%esi
+801066d1:	e8 4a e9 ff ff       	call   80105020 <mycpu>
+801066d6:	39 c6                	cmp    %eax,%esi
+801066d8:	75 1d                	jne    801066f7 <releasewrite+0x37>
+    panic("releasewrite");
+  lk->cpu = 0;
+801066da:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+
+  // Any other writer still waiting sets RW_WAIT again.
+  __sync_synchronize();
+801066e1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->word = 0;
+801066e6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  popcli();
+}
+801066ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801066ef:	5b                   	pop    %ebx
+801066f0:	5e                   	pop    %esi
+801066f1:	5d                   	pop    %ebp
+  popcli();
+801066f2:	e9 59 04 00 00       	jmp    80106b50 <popcli>
+    panic("releasewrite");
+801066f7:	83 ec 0c             	sub    $0xc,%esp
+801066fa:	68 02 b9 10 80       	push   $0x8010b902
+801066ff:	e8 dc 9c ff ff       	call   801003e0 <panic>
+80106704:	66 90                	xchg   %ax,%ax
+80106706:	66 90                	xchg   %ax,%ax
+80106708:	66 90                	xchg   %ax,%ax
+8010670a:	66 90                	xchg   %ax,%ax
+8010670c:	66 90                	xchg   %ax,%ax
+8010670e:	66 90                	xchg   %ax,%ax
+
+80106710 <initsleeplock>:
+// SPINCYCLES, and only sleeps if that doesn't work out.
+#define SPINCYCLES 50000
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80106710:	55                   	push   %ebp
+80106711:	89 e5                	mov    %esp,%ebp
+80106713:	56                   	push   %esi
+80106714:	53                   	push   %ebx
+80106715:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106718:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&lk->lk, "sleep lock");
+8010671b:	8d 43 04             	lea    0x4(%ebx),%eax
+8010671e:	83 ec 08             	sub    $0x8,%esp
+80106721:	68 0f b9 10 80       	push   $0x8010b90f
+80106726:	50                   	push   %eax
+80106727:	e8 b4 02 00 00       	call   801069e0 <initlock>
+  lk->name = name;
+8010672c:	89 73 60             	mov    %esi,0x60(%ebx)
+  lk->locked = 0;
+8010672f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->owner = 0;
+80106735:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  lk->class = lockclass(name);
+8010673c:	89 34 24             	mov    %esi,(%esp)
+8010673f:	e8 cc 01 00 00       	call   80106910 <lockclass>
+  lk->pid = 0;
+80106744:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+}
+8010674b:	83 c4 10             	add    $0x10,%esp
+  lk->class = lockclass(name);
+8010674e:	89 43 5c             	mov    %eax,0x5c(%ebx)
+}
+80106751:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106754:	5b                   	pop    %ebx
+80106755:	5e                   	pop    %esi
+80106756:	5d                   	pop    %ebp
+80106757:	c3                   	ret
+80106758:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010675f:	90                   	nop
+
+80106760 <acquiresleep>:
+  }
+}
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80106760:	55                   	push   %ebp
+80106761:	89 e5                	mov    %esp,%ebp
+80106763:	57                   	push   %edi
+80106764:	56                   	push   %esi
+80106765:	53                   	push   %ebx
+80106766:	83 ec 38             	sub    $0x38,%esp
+80106769:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  asm volatile("rdtsc" : "=A" (t));
+8010676c:	0f 31                	rdtsc
+  uint64 t0;
+  int how;
+
+  t0 = rdtsc();
+  how = SL_FREE;
+  acquire(&lk->lk);
+8010676e:	8d 73 04             	lea    0x4(%ebx),%esi
+80106771:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  how = SL_FREE;
+80106774:	31 ff                	xor    %edi,%edi
+80106776:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  acquire(&lk->lk);
+80106779:	56                   	push   %esi
+8010677a:	e8 b1 05 00 00       	call   80106d30 <acquire>
+  if(lk->locked){
+8010677f:	8b 03                	mov    (%ebx),%eax
+80106781:	83 c4 10             	add    $0x10,%esp
+80106784:	85 c0                	test   %eax,%eax
+80106786:	75 48                	jne    801067d0 <acquiresleep+0x70>
+  }
+  while (lk->locked) {
+    how = SL_SLEPT;
+    sleep(lk, &lk->lk);
+  }
+  lk->locked = 1;
+80106788:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->owner = myproc();
+8010678e:	e8 9d e8 ff ff       	call   80105030 <myproc>
+80106793:	89 43 58             	mov    %eax,0x58(%ebx)
+  lk->pid = myproc()->pid;
+80106796:	e8 95 e8 ff ff       	call   80105030 <myproc>
+8010679b:	8b 40 64             	mov    0x64(%eax),%eax
+8010679e:	89 43 64             	mov    %eax,0x64(%ebx)
+801067a1:	0f 31                	rdtsc
+  lockstatsleep(lk->class, how, rdtsc() - t0);
+801067a3:	2b 45 d8             	sub    -0x28(%ebp),%eax
+801067a6:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+801067a9:	52                   	push   %edx
+801067aa:	50                   	push   %eax
+801067ab:	57                   	push   %edi
+801067ac:	ff 73 5c             	push   0x5c(%ebx)
+801067af:	e8 7c 09 00 00       	call   80107130 <lockstatsleep>
+  release(&lk->lk);
+801067b4:	89 75 08             	mov    %esi,0x8(%ebp)
+801067b7:	83 c4 10             	add    $0x10,%esp
+}
+801067ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801067bd:	5b                   	pop    %ebx
+801067be:	5e                   	pop    %esi
+801067bf:	5f                   	pop    %edi
+801067c0:	5d                   	pop    %ebp
+  release(&lk->lk);
+801067c1:	e9 2a 04 00 00       	jmp    80106bf0 <release>
+801067c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067cd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&lk->lk);
+801067d0:	83 ec 0c             	sub    $0xc,%esp
+801067d3:	56                   	push   %esi
+801067d4:	e8 17 04 00 00       	call   80106bf0 <release>
+801067d9:	0f 31                	rdtsc
+  while(lk->locked){
+801067db:	8b 0b                	mov    (%ebx),%ecx
+801067dd:	83 c4 10             	add    $0x10,%esp
+801067e0:	85 c9                	test   %ecx,%ecx
+801067e2:	74 44                	je     80106828 <acquiresleep+0xc8>
+    if(rdtsc() - t0 > SPINCYCLES)
+801067e4:	bf 50 c3 00 00       	mov    $0xc350,%edi
+801067e9:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+801067ec:	31 c9                	xor    %ecx,%ecx
+801067ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801067f1:	89 fe                	mov    %edi,%esi
+801067f3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801067f6:	eb 10                	jmp    80106808 <acquiresleep+0xa8>
+801067f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067ff:	90                   	nop
+    asm volatile("pause" : : : "memory");
+80106800:	f3 90                	pause
+  while(lk->locked){
+80106802:	8b 3b                	mov    (%ebx),%edi
+80106804:	85 ff                	test   %edi,%edi
+80106806:	74 1d                	je     80106825 <acquiresleep+0xc5>
+    p = lk->owner;
+80106808:	8b 43 58             	mov    0x58(%ebx),%eax
+    if(p && p->state != RUNNING)
+8010680b:	85 c0                	test   %eax,%eax
+8010680d:	74 06                	je     80106815 <acquiresleep+0xb5>
+8010680f:	83 78 60 04          	cmpl   $0x4,0x60(%eax)
+80106813:	75 10                	jne    80106825 <acquiresleep+0xc5>
+80106815:	0f 31                	rdtsc
+    if(rdtsc() - t0 > SPINCYCLES)
+80106817:	2b 45 e0             	sub    -0x20(%ebp),%eax
+8010681a:	89 cf                	mov    %ecx,%edi
+8010681c:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+8010681f:	39 c6                	cmp    %eax,%esi
+80106821:	19 d7                	sbb    %edx,%edi
+80106823:	73 db                	jae    80106800 <acquiresleep+0xa0>
+80106825:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    acquire(&lk->lk);
+80106828:	83 ec 0c             	sub    $0xc,%esp
+8010682b:	56                   	push   %esi
+8010682c:	e8 ff 04 00 00       	call   80106d30 <acquire>
+  while (lk->locked) {
+80106831:	8b 13                	mov    (%ebx),%edx
+80106833:	83 c4 10             	add    $0x10,%esp
+80106836:	85 d2                	test   %edx,%edx
+80106838:	74 23                	je     8010685d <acquiresleep+0xfd>
+8010683a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80106840:	83 ec 08             	sub    $0x8,%esp
+80106843:	56                   	push   %esi
+80106844:	53                   	push   %ebx
+80106845:	e8 16 ef ff ff       	call   80105760 <sleep>
+  while (lk->locked) {
+8010684a:	8b 03                	mov    (%ebx),%eax
+8010684c:	83 c4 10             	add    $0x10,%esp
+8010684f:	85 c0                	test   %eax,%eax
+80106851:	75 ed                	jne    80106840 <acquiresleep+0xe0>
+    how = SL_SLEPT;
+80106853:	bf 02 00 00 00       	mov    $0x2,%edi
+80106858:	e9 2b ff ff ff       	jmp    80106788 <acquiresleep+0x28>
+    how = SL_SPUN;
+8010685d:	bf 01 00 00 00       	mov    $0x1,%edi
+80106862:	e9 21 ff ff ff       	jmp    80106788 <acquiresleep+0x28>
+80106867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010686e:	66 90                	xchg   %ax,%ax
+
+80106870 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80106870:	55                   	push   %ebp
+80106871:	89 e5                	mov    %esp,%ebp
+80106873:	56                   	push   %esi
+80106874:	53                   	push   %ebx
+80106875:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80106878:	8d 73 04             	lea    0x4(%ebx),%esi
+8010687b:	83 ec 0c             	sub    $0xc,%esp
+8010687e:	56                   	push   %esi
+8010687f:	e8 ac 04 00 00       	call   80106d30 <acquire>
+  lk->locked = 0;
+80106884:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->owner = 0;
+8010688a:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  lk->pid = 0;
+80106891:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+  wakeup(lk);
+80106898:	89 1c 24             	mov    %ebx,(%esp)
+8010689b:	e8 70 f1 ff ff       	call   80105a10 <wakeup>
+  release(&lk->lk);
+801068a0:	89 75 08             	mov    %esi,0x8(%ebp)
+801068a3:	83 c4 10             	add    $0x10,%esp
+}
+801068a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801068a9:	5b                   	pop    %ebx
+801068aa:	5e                   	pop    %esi
+801068ab:	5d                   	pop    %ebp
+  release(&lk->lk);
+801068ac:	e9 3f 03 00 00       	jmp    80106bf0 <release>
+801068b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801068b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801068bf:	90                   	nop
+
+801068c0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+801068c0:	55                   	push   %ebp
+801068c1:	89 e5                	mov    %esp,%ebp
+801068c3:	57                   	push   %edi
+801068c4:	31 ff                	xor    %edi,%edi
+801068c6:	56                   	push   %esi
+801068c7:	53                   	push   %ebx
+801068c8:	83 ec 18             	sub    $0x18,%esp
+801068cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+801068ce:	8d 73 04             	lea    0x4(%ebx),%esi
+801068d1:	56                   	push   %esi
+801068d2:	e8 59 04 00 00       	call   80106d30 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+801068d7:	8b 03                	mov    (%ebx),%eax
+801068d9:	83 c4 10             	add    $0x10,%esp
+801068dc:	85 c0                	test   %eax,%eax
+801068de:	75 18                	jne    801068f8 <holdingsleep+0x38>
+  release(&lk->lk);
+801068e0:	83 ec 0c             	sub    $0xc,%esp
+801068e3:	56                   	push   %esi
+801068e4:	e8 07 03 00 00       	call   80106bf0 <release>
+  return r;
+}
+801068e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801068ec:	89 f8                	mov    %edi,%eax
+801068ee:	5b                   	pop    %ebx
+801068ef:	5e                   	pop    %esi
+801068f0:	5f                   	pop    %edi
+801068f1:	5d                   	pop    %ebp
+801068f2:	c3                   	ret
+801068f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801068f7:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+801068f8:	8b 5b 64             	mov    0x64(%ebx),%ebx
+801068fb:	e8 30 e7 ff ff       	call   80105030 <myproc>
+80106900:	39 58 64             	cmp    %ebx,0x64(%eax)
+80106903:	0f 94 c0             	sete   %al
+80106906:	0f b6 c0             	movzbl %al,%eax
+80106909:	89 c7                	mov    %eax,%edi
+8010690b:	eb d3                	jmp    801068e0 <holdingsleep+0x20>
+8010690d:	66 90                	xchg   %ax,%ax
+8010690f:	90                   	nop
+
+80106910 <lockclass>:
+// kinit1() initializes locks before seginit() sets up %gs, so
+// this mustn't use pushcli(), which calls mycpu(); it turns
+// interrupts off by hand instead.
+int
+lockclass(char *name)
+{
+80106910:	55                   	push   %ebp
+80106911:	89 e5                	mov    %esp,%ebp
+80106913:	57                   	push   %edi
+80106914:	56                   	push   %esi
+80106915:	53                   	push   %ebx
+80106916:	83 ec 0c             	sub    $0xc,%esp
+80106919:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+8010691c:	9c                   	pushf
+8010691d:	5e                   	pop    %esi
+  asm volatile("cli");
+8010691e:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+8010691f:	ba 01 00 00 00       	mov    $0x1,%edx
+80106924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106928:	89 d0                	mov    %edx,%eax
+8010692a:	f0 87 05 60 7f 15 80 	lock xchg %eax,0x80157f60
+  uint eflags;
+  int i;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&classlock, 1) != 0)
+80106931:	85 c0                	test   %eax,%eax
+80106933:	75 f3                	jne    80106928 <lockclass+0x18>
+    ;
+  for(i = 1; i < nclass; i++)
+80106935:	8b 3d 1c e1 10 80    	mov    0x8010e11c,%edi
+8010693b:	83 ff 01             	cmp    $0x1,%edi
+8010693e:	0f 8e 80 00 00 00    	jle    801069c4 <lockclass+0xb4>
+80106944:	bf 01 00 00 00       	mov    $0x1,%edi
+80106949:	eb 11                	jmp    8010695c <lockclass+0x4c>
+8010694b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010694f:	90                   	nop
+80106950:	a1 1c e1 10 80       	mov    0x8010e11c,%eax
+80106955:	83 c7 01             	add    $0x1,%edi
+80106958:	39 f8                	cmp    %edi,%eax
+8010695a:	7e 1e                	jle    8010697a <lockclass+0x6a>
+    if(strncmp(classname[i], name, sizeof(stats[0][0].name)) == 0)
+8010695c:	83 ec 04             	sub    $0x4,%esp
+8010695f:	6a 10                	push   $0x10
+80106961:	53                   	push   %ebx
+80106962:	ff 34 bd 20 e1 10 80 	push   -0x7fef1ee0(,%edi,4)
+80106969:	e8 42 0a 00 00       	call   801073b0 <strncmp>
+8010696e:	83 c4 10             	add    $0x10,%esp
+80106971:	85 c0                	test   %eax,%eax
+80106973:	75 db                	jne    80106950 <lockclass+0x40>
+  for(i = 1; i < nclass; i++)
+80106975:	a1 1c e1 10 80       	mov    0x8010e11c,%eax
+      break;
+  if(i == nclass){
+8010697a:	39 f8                	cmp    %edi,%eax
+8010697c:	74 22                	je     801069a0 <lockclass+0x90>
+8010697e:	31 c0                	xor    %eax,%eax
+80106980:	f0 87 05 60 7f 15 80 	lock xchg %eax,0x80157f60
+      classname[nclass++] = name;
+    else
+      i = 0;
+  }
+  xchg(&classlock, 0);
+  if(eflags & FL_IF)
+80106987:	81 e6 00 02 00 00    	and    $0x200,%esi
+8010698d:	74 01                	je     80106990 <lockclass+0x80>
+  asm volatile("sti");
+8010698f:	fb                   	sti
+    sti();
+  return i;
+}
+80106990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106993:	89 f8                	mov    %edi,%eax
+80106995:	5b                   	pop    %ebx
+80106996:	5e                   	pop    %esi
+80106997:	5f                   	pop    %edi
+80106998:	5d                   	pop    %ebp
+80106999:	c3                   	ret
+8010699a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      classname[nclass++] = name;
+801069a0:	8d 47 01             	lea    0x1(%edi),%eax
+    if(nclass < NLOCKSTAT)
+801069a3:	83 ff 40             	cmp    $0x40,%edi
+801069a6:	74 18                	je     801069c0 <lockclass+0xb0>
+      classname[nclass++] = name;
+801069a8:	a3 1c e1 10 80       	mov    %eax,0x8010e11c
+801069ad:	89 1c bd 20 e1 10 80 	mov    %ebx,-0x7fef1ee0(,%edi,4)
+801069b4:	eb c8                	jmp    8010697e <lockclass+0x6e>
+801069b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801069bd:	8d 76 00             	lea    0x0(%esi),%esi
+      i = 0;
+801069c0:	31 ff                	xor    %edi,%edi
+801069c2:	eb ba                	jmp    8010697e <lockclass+0x6e>
+  if(i == nclass){
+801069c4:	74 07                	je     801069cd <lockclass+0xbd>
+  for(i = 1; i < nclass; i++)
+801069c6:	bf 01 00 00 00       	mov    $0x1,%edi
+801069cb:	eb b1                	jmp    8010697e <lockclass+0x6e>
+  if(i == nclass){
+801069cd:	b8 02 00 00 00       	mov    $0x2,%eax
+801069d2:	eb d4                	jmp    801069a8 <lockclass+0x98>
+801069d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801069db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801069df:	90                   	nop
+
+801069e0 <initlock>:
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+801069e0:	55                   	push   %ebp
+801069e1:	89 e5                	mov    %esp,%ebp
+801069e3:	53                   	push   %ebx
+801069e4:	83 ec 10             	sub    $0x10,%esp
+801069e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801069ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+initlockkind(struct spinlock *lk, char *name, int kind)
+{
+  lk->name = name;
+  lk->kind = kind;
+  lk->locked = 0;
+  lk->next = 0;
+801069ed:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  lk->name = name;
+801069f4:	89 43 24             	mov    %eax,0x24(%ebx)
+  lk->served = 0;
+801069f7:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->kind = kind;
+801069fe:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  lk->locked = 0;
+80106a05:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->tail = 0;
+80106a0b:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  lk->node = 0;
+80106a12:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  lk->class = lockclass(name);
+80106a19:	50                   	push   %eax
+80106a1a:	e8 f1 fe ff ff       	call   80106910 <lockclass>
+  lk->cpu = 0;
+80106a1f:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+}
+80106a26:	83 c4 10             	add    $0x10,%esp
+  lk->class = lockclass(name);
+80106a29:	89 43 18             	mov    %eax,0x18(%ebx)
+}
+80106a2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106a2f:	c9                   	leave
+80106a30:	c3                   	ret
+80106a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a3f:	90                   	nop
+
+80106a40 <initlockkind>:
+{
+80106a40:	55                   	push   %ebp
+80106a41:	89 e5                	mov    %esp,%ebp
+80106a43:	53                   	push   %ebx
+80106a44:	83 ec 10             	sub    $0x10,%esp
+80106a47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106a4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->kind = kind;
+80106a4d:	8b 55 10             	mov    0x10(%ebp),%edx
+  lk->next = 0;
+80106a50:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  lk->name = name;
+80106a57:	89 43 24             	mov    %eax,0x24(%ebx)
+  lk->served = 0;
+80106a5a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->kind = kind;
+80106a61:	89 53 04             	mov    %edx,0x4(%ebx)
+  lk->locked = 0;
+80106a64:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->tail = 0;
+80106a6a:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  lk->node = 0;
+80106a71:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+  lk->class = lockclass(name);
+80106a78:	50                   	push   %eax
+80106a79:	e8 92 fe ff ff       	call   80106910 <lockclass>
+  lk->cpu = 0;
+80106a7e:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+}
+80106a85:	83 c4 10             	add    $0x10,%esp
+  lk->class = lockclass(name);
+80106a88:	89 43 18             	mov    %eax,0x18(%ebx)
+}
+80106a8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106a8e:	c9                   	leave
+80106a8f:	c3                   	ret
+
+80106a90 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80106a90:	55                   	push   %ebp
+80106a91:	89 e5                	mov    %esp,%ebp
+80106a93:	53                   	push   %ebx
+80106a94:	8b 45 08             	mov    0x8(%ebp),%eax
+80106a97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80106a9a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    // if null ptr OR less than KERNBASE
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106a9d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80106aa2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80106aa7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106aac:	76 10                	jbe    80106abe <getcallerpcs+0x2e>
+80106aae:	eb 28                	jmp    80106ad8 <getcallerpcs+0x48>
+80106ab0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80106ab6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80106abc:	77 1a                	ja     80106ad8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80106abe:	8b 5a 04             	mov    0x4(%edx),%ebx
+80106ac1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80106ac4:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80106ac7:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80106ac9:	83 f8 0a             	cmp    $0xa,%eax
+80106acc:	75 e2                	jne    80106ab0 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80106ace:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ad1:	c9                   	leave
+80106ad2:	c3                   	ret
+80106ad3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ad7:	90                   	nop
+80106ad8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80106adb:	8d 51 28             	lea    0x28(%ecx),%edx
+80106ade:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80106ae0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80106ae6:	83 c0 04             	add    $0x4,%eax
+80106ae9:	39 d0                	cmp    %edx,%eax
+80106aeb:	75 f3                	jne    80106ae0 <getcallerpcs+0x50>
+}
+80106aed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106af0:	c9                   	leave
+80106af1:	c3                   	ret
+80106af2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106af9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106b00 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80106b00:	55                   	push   %ebp
+80106b01:	89 e5                	mov    %esp,%ebp
+80106b03:	53                   	push   %ebx
+80106b04:	83 ec 04             	sub    $0x4,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106b07:	9c                   	pushf
+80106b08:	5b                   	pop    %ebx
+  asm volatile("cli");
+80106b09:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0) // ncli = num of cli 
+80106b0a:	e8 11 e5 ff ff       	call   80105020 <mycpu>
+80106b0f:	8b 80 ac 00 00 00    	mov    0xac(%eax),%eax
+80106b15:	85 c0                	test   %eax,%eax
+80106b17:	74 17                	je     80106b30 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF; // if ncli == 0, save old int flag val
+  mycpu()->ncli += 1;
+80106b19:	e8 02 e5 ff ff       	call   80105020 <mycpu>
+80106b1e:	83 80 ac 00 00 00 01 	addl   $0x1,0xac(%eax)
+}
+80106b25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106b28:	c9                   	leave
+80106b29:	c3                   	ret
+80106b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF; // if ncli == 0, save old int flag val
+80106b30:	e8 eb e4 ff ff       	call   80105020 <mycpu>
+80106b35:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80106b3b:	89 98 b0 00 00 00    	mov    %ebx,0xb0(%eax)
+80106b41:	eb d6                	jmp    80106b19 <pushcli+0x19>
+80106b43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106b50 <popcli>:
+
+void
+popcli(void)
+{
+80106b50:	55                   	push   %ebp
+80106b51:	89 e5                	mov    %esp,%ebp
+80106b53:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106b56:	9c                   	pushf
+80106b57:	58                   	pop    %eax
+  if(readeflags()&FL_IF) // check that interrupts are not already enabled
+80106b58:	f6 c4 02             	test   $0x2,%ah
+80106b5b:	75 35                	jne    80106b92 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0) // decrement value of ncli, check that it does not become negative
+80106b5d:	e8 be e4 ff ff       	call   80105020 <mycpu>
+80106b62:	83 a8 ac 00 00 00 01 	subl   $0x1,0xac(%eax)
+80106b69:	78 34                	js     80106b9f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena) // if interrupts were previously enabled
+80106b6b:	e8 b0 e4 ff ff       	call   80105020 <mycpu>
+80106b70:	8b 90 ac 00 00 00    	mov    0xac(%eax),%edx
+80106b76:	85 d2                	test   %edx,%edx
+80106b78:	74 06                	je     80106b80 <popcli+0x30>
+    sti();
+}
+80106b7a:	c9                   	leave
+80106b7b:	c3                   	ret
+80106b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena) // if interrupts were previously enabled
+80106b80:	e8 9b e4 ff ff       	call   80105020 <mycpu>
+80106b85:	8b 80 b0 00 00 00    	mov    0xb0(%eax),%eax
+80106b8b:	85 c0                	test   %eax,%eax
+80106b8d:	74 eb                	je     80106b7a <popcli+0x2a>
+  asm volatile("sti");
+80106b8f:	fb                   	sti
+}
+80106b90:	c9                   	leave
+80106b91:	c3                   	ret
+    panic("popcli - interruptible");
+80106b92:	83 ec 0c             	sub    $0xc,%esp
+80106b95:	68 1a b9 10 80       	push   $0x8010b91a
+80106b9a:	e8 41 98 ff ff       	call   801003e0 <panic>
+    panic("popcli");
+80106b9f:	83 ec 0c             	sub    $0xc,%esp
+80106ba2:	68 31 b9 10 80       	push   $0x8010b931
+80106ba7:	e8 34 98 ff ff       	call   801003e0 <panic>
+80106bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106bb0 <holding>:
+{
+80106bb0:	55                   	push   %ebp
+80106bb1:	89 e5                	mov    %esp,%ebp
+80106bb3:	56                   	push   %esi
+80106bb4:	53                   	push   %ebx
+80106bb5:	8b 75 08             	mov    0x8(%ebp),%esi
+80106bb8:	31 db                	xor    %ebx,%ebx
+  pushcli();
+80106bba:	e8 41 ff ff ff       	call   80106b00 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80106bbf:	8b 06                	mov    (%esi),%eax
+80106bc1:	85 c0                	test   %eax,%eax
+80106bc3:	75 0b                	jne    80106bd0 <holding+0x20>
+  popcli();
+80106bc5:	e8 86 ff ff ff       	call   80106b50 <popcli>
+}
+80106bca:	89 d8                	mov    %ebx,%eax
+80106bcc:	5b                   	pop    %ebx
+80106bcd:	5e                   	pop    %esi
+80106bce:	5d                   	pop    %ebp
+80106bcf:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80106bd0:	8b 5e 28             	mov    0x28(%esi),%ebx
+80106bd3:	e8 48 e4 ff ff       	call   80105020 <mycpu>
+80106bd8:	39 c3                	cmp    %eax,%ebx
+80106bda:	0f 94 c3             	sete   %bl
+  popcli();
+80106bdd:	e8 6e ff ff ff       	call   80106b50 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80106be2:	0f b6 db             	movzbl %bl,%ebx
+}
+80106be5:	89 d8                	mov    %ebx,%eax
+80106be7:	5b                   	pop    %ebx
+80106be8:	5e                   	pop    %esi
+80106be9:	5d                   	pop    %ebp
+80106bea:	c3                   	ret
+80106beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106bef:	90                   	nop
+
+80106bf0 <release>:
+{
+80106bf0:	55                   	push   %ebp
+80106bf1:	89 e5                	mov    %esp,%ebp
+80106bf3:	57                   	push   %edi
+80106bf4:	56                   	push   %esi
+80106bf5:	53                   	push   %ebx
+80106bf6:	83 ec 0c             	sub    $0xc,%esp
+80106bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80106bfc:	e8 ff fe ff ff       	call   80106b00 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80106c01:	8b 03                	mov    (%ebx),%eax
+80106c03:	85 c0                	test   %eax,%eax
+80106c05:	75 19                	jne    80106c20 <release+0x30>
+  popcli();
+80106c07:	e8 44 ff ff ff       	call   80106b50 <popcli>
+    panic("release");
+80106c0c:	83 ec 0c             	sub    $0xc,%esp
+80106c0f:	68 38 b9 10 80       	push   $0x8010b938
+80106c14:	e8 c7 97 ff ff       	call   801003e0 <panic>
+80106c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80106c20:	8b 73 28             	mov    0x28(%ebx),%esi
+80106c23:	e8 f8 e3 ff ff       	call   80105020 <mycpu>
+80106c28:	39 c6                	cmp    %eax,%esi
+80106c2a:	75 db                	jne    80106c07 <release+0x17>
+  popcli();
+80106c2c:	e8 1f ff ff ff       	call   80106b50 <popcli>
+  asm volatile("rdtsc" : "=A" (t));
+80106c31:	0f 31                	rdtsc
+  hold = rdtsc() - lk->tacquired;
+80106c33:	2b 43 1c             	sub    0x1c(%ebx),%eax
+80106c36:	1b 53 20             	sbb    0x20(%ebx),%edx
+80106c39:	89 d7                	mov    %edx,%edi
+80106c3b:	89 c6                	mov    %eax,%esi
+  st = &stats[cpuid()][lk->class];
+80106c3d:	e8 be e3 ff ff       	call   80105000 <cpuid>
+  st->hold += hold;
+80106c42:	8b 53 18             	mov    0x18(%ebx),%edx
+80106c45:	c1 e0 06             	shl    $0x6,%eax
+80106c48:	01 c2                	add    %eax,%edx
+80106c4a:	c1 e2 06             	shl    $0x6,%edx
+  if(hold > st->maxhold)
+80106c4d:	8b 82 9c ff 14 80    	mov    -0x7feb0064(%edx),%eax
+  st->hold += hold;
+80106c53:	01 b2 90 ff 14 80    	add    %esi,-0x7feb0070(%edx)
+80106c59:	11 ba 94 ff 14 80    	adc    %edi,-0x7feb006c(%edx)
+  if(hold > st->maxhold)
+80106c5f:	39 b2 98 ff 14 80    	cmp    %esi,-0x7feb0068(%edx)
+80106c65:	19 f8                	sbb    %edi,%eax
+80106c67:	73 0c                	jae    80106c75 <release+0x85>
+    st->maxhold = hold;
+80106c69:	89 b2 98 ff 14 80    	mov    %esi,-0x7feb0068(%edx)
+80106c6f:	89 ba 9c ff 14 80    	mov    %edi,-0x7feb0064(%edx)
+  lk->pcs[0] = 0;
+80106c75:	c7 43 2c 00 00 00 00 	movl   $0x0,0x2c(%ebx)
+  lk->cpu = 0;
+80106c7c:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+  __sync_synchronize();
+80106c83:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  switch(lk->kind){
+80106c88:	8b 43 04             	mov    0x4(%ebx),%eax
+80106c8b:	83 f8 01             	cmp    $0x1,%eax
+80106c8e:	74 20                	je     80106cb0 <release+0xc0>
+80106c90:	83 f8 02             	cmp    $0x2,%eax
+80106c93:	74 3b                	je     80106cd0 <release+0xe0>
+    asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80106c95:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80106c9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106c9e:	5b                   	pop    %ebx
+80106c9f:	5e                   	pop    %esi
+80106ca0:	5f                   	pop    %edi
+80106ca1:	5d                   	pop    %ebp
+  popcli();
+80106ca2:	e9 a9 fe ff ff       	jmp    80106b50 <popcli>
+80106ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cae:	66 90                	xchg   %ax,%ax
+    lk->served = lk->served + 1;  // only the holder writes served
+80106cb0:	8b 43 0c             	mov    0xc(%ebx),%eax
+    lk->locked = 0;
+80106cb3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    lk->served = lk->served + 1;  // only the holder writes served
+80106cb9:	83 c0 01             	add    $0x1,%eax
+80106cbc:	89 43 0c             	mov    %eax,0xc(%ebx)
+}
+80106cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106cc2:	5b                   	pop    %ebx
+80106cc3:	5e                   	pop    %esi
+80106cc4:	5f                   	pop    %edi
+80106cc5:	5d                   	pop    %ebp
+  popcli();
+80106cc6:	e9 85 fe ff ff       	jmp    80106b50 <popcli>
+80106ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ccf:	90                   	nop
+  struct mcsnode *n = lk->node;
+80106cd0:	8b 73 14             	mov    0x14(%ebx),%esi
+    lk->locked = 0;
+80106cd3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  if(n->next == 0){
+80106cd9:	8b 16                	mov    (%esi),%edx
+80106cdb:	85 d2                	test   %edx,%edx
+80106cdd:	74 39                	je     80106d18 <release+0x128>
+  n->next->wait = 0;
+80106cdf:	8b 06                	mov    (%esi),%eax
+80106ce1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  struct cpu *c = mycpu();
+80106ce8:	e8 33 e3 ff ff       	call   80105020 <mycpu>
+  c->mcsused &= ~(1 << (n - c->mcs));
+80106ced:	89 f1                	mov    %esi,%ecx
+80106cef:	8d 90 c0 00 00 00    	lea    0xc0(%eax),%edx
+80106cf5:	29 d1                	sub    %edx,%ecx
+80106cf7:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+80106cfc:	c1 f9 03             	sar    $0x3,%ecx
+80106cff:	d3 c2                	rol    %cl,%edx
+80106d01:	21 90 e0 00 00 00    	and    %edx,0xe0(%eax)
+}
+80106d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106d0a:	5b                   	pop    %ebx
+80106d0b:	5e                   	pop    %esi
+80106d0c:	5f                   	pop    %edi
+80106d0d:	5d                   	pop    %ebp
+  popcli();
+80106d0e:	e9 3d fe ff ff       	jmp    80106b50 <popcli>
+80106d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106d17:	90                   	nop
+  asm volatile("lock; cmpxchgl %2, %1" :
+80106d18:	89 f0                	mov    %esi,%eax
+80106d1a:	f0 0f b1 53 10       	lock cmpxchg %edx,0x10(%ebx)
+    if(cmpxchg((volatile uint*)&lk->tail, (uint)n, 0) == (uint)n){
+80106d1f:	39 c6                	cmp    %eax,%esi
+80106d21:	74 c5                	je     80106ce8 <release+0xf8>
+80106d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106d27:	90                   	nop
+    while(n->next == 0)
+80106d28:	8b 06                	mov    (%esi),%eax
+80106d2a:	85 c0                	test   %eax,%eax
+80106d2c:	74 fa                	je     80106d28 <release+0x138>
+80106d2e:	eb af                	jmp    80106cdf <release+0xef>
+
+80106d30 <acquire>:
+{
+80106d30:	55                   	push   %ebp
+80106d31:	89 e5                	mov    %esp,%ebp
+80106d33:	57                   	push   %edi
+80106d34:	56                   	push   %esi
+80106d35:	53                   	push   %ebx
+80106d36:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80106d39:	e8 c2 fd ff ff       	call   80106b00 <pushcli>
+  if(holding(lk)) // check that not already holding lock
+80106d3e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80106d41:	e8 ba fd ff ff       	call   80106b00 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80106d46:	8b 03                	mov    (%ebx),%eax
+80106d48:	85 c0                	test   %eax,%eax
+80106d4a:	0f 85 80 01 00 00    	jne    80106ed0 <acquire+0x1a0>
+  popcli();
+80106d50:	e8 fb fd ff ff       	call   80106b50 <popcli>
+  asm volatile("rdtsc" : "=A" (t));
+80106d55:	0f 31                	rdtsc
+  switch(lk->kind){
+80106d57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106d5a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106d5d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80106d60:	8b 7b 04             	mov    0x4(%ebx),%edi
+80106d63:	83 ff 01             	cmp    $0x1,%edi
+80106d66:	0f 84 34 01 00 00    	je     80106ea0 <acquire+0x170>
+80106d6c:	83 ff 02             	cmp    $0x2,%edi
+80106d6f:	75 3f                	jne    80106db0 <acquire+0x80>
+  struct cpu *c = mycpu();
+80106d71:	e8 aa e2 ff ff       	call   80105020 <mycpu>
+    if((c->mcsused & (1 << i)) == 0){
+80106d76:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80106d7c:	f6 c2 01             	test   $0x1,%dl
+80106d7f:	0f 84 74 01 00 00    	je     80106ef9 <acquire+0x1c9>
+80106d85:	f6 c2 02             	test   $0x2,%dl
+80106d88:	0f 84 cc 01 00 00    	je     80106f5a <acquire+0x22a>
+80106d8e:	f6 c2 04             	test   $0x4,%dl
+80106d91:	0f 84 d6 01 00 00    	je     80106f6d <acquire+0x23d>
+80106d97:	f6 c2 08             	test   $0x8,%dl
+80106d9a:	0f 84 d4 01 00 00    	je     80106f74 <acquire+0x244>
+  panic("mcsalloc");
+80106da0:	83 ec 0c             	sub    $0xc,%esp
+80106da3:	68 48 b9 10 80       	push   $0x8010b948
+80106da8:	e8 33 96 ff ff       	call   801003e0 <panic>
+80106dad:	8d 76 00             	lea    0x0(%esi),%esi
+  asm volatile("lock; xchgl %0, %1" :
+80106db0:	b8 01 00 00 00       	mov    $0x1,%eax
+80106db5:	f0 87 03             	lock xchg %eax,(%ebx)
+    while(xchg(&lk->locked, 1) != 0)
+80106db8:	85 c0                	test   %eax,%eax
+80106dba:	0f 84 32 01 00 00    	je     80106ef2 <acquire+0x1c2>
+80106dc0:	b9 01 00 00 00       	mov    $0x1,%ecx
+80106dc5:	8d 76 00             	lea    0x0(%esi),%esi
+80106dc8:	8b 55 08             	mov    0x8(%ebp),%edx
+80106dcb:	89 c8                	mov    %ecx,%eax
+80106dcd:	f0 87 02             	lock xchg %eax,(%edx)
+80106dd0:	85 c0                	test   %eax,%eax
+80106dd2:	75 f4                	jne    80106dc8 <acquire+0x98>
+      waited = 1;
+80106dd4:	bb 01 00 00 00       	mov    $0x1,%ebx
+  __sync_synchronize();
+80106dd9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80106dde:	8b 75 08             	mov    0x8(%ebp),%esi
+80106de1:	e8 3a e2 ff ff       	call   80105020 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80106de6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+80106de9:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+80106deb:	89 46 28             	mov    %eax,0x28(%esi)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106dee:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80106df4:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80106df9:	0f 87 89 00 00 00    	ja     80106e88 <acquire+0x158>
+  ebp = (uint*)v - 2;
+80106dff:	89 e8                	mov    %ebp,%eax
+80106e01:	eb 13                	jmp    80106e16 <acquire+0xe6>
+80106e03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106e07:	90                   	nop
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106e08:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+80106e0e:	81 fe fe ff ff 7f    	cmp    $0x7ffffffe,%esi
+80106e14:	77 72                	ja     80106e88 <acquire+0x158>
+    pcs[i] = ebp[1];     // saved %eip
+80106e16:	8b 70 04             	mov    0x4(%eax),%esi
+80106e19:	89 74 91 2c          	mov    %esi,0x2c(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80106e1d:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80106e20:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80106e22:	83 fa 0a             	cmp    $0xa,%edx
+80106e25:	75 e1                	jne    80106e08 <acquire+0xd8>
+  asm volatile("rdtsc" : "=A" (t));
+80106e27:	0f 31                	rdtsc
+  lk->tacquired = rdtsc();
+80106e29:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80106e2c:	89 51 20             	mov    %edx,0x20(%ecx)
+80106e2f:	89 41 1c             	mov    %eax,0x1c(%ecx)
+  st = &stats[cpuid()][lk->class];
+80106e32:	e8 c9 e1 ff ff       	call   80105000 <cpuid>
+80106e37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  st->acquires++;
+80106e3a:	c1 e0 06             	shl    $0x6,%eax
+80106e3d:	03 41 18             	add    0x18(%ecx),%eax
+80106e40:	c1 e0 06             	shl    $0x6,%eax
+80106e43:	83 80 70 ff 14 80 01 	addl   $0x1,-0x7feb0090(%eax)
+80106e4a:	8d 90 60 ff 14 80    	lea    -0x7feb00a0(%eax),%edx
+  if(waited){
+80106e50:	85 db                	test   %ebx,%ebx
+80106e52:	74 26                	je     80106e7a <acquire+0x14a>
+    if(spin > st->maxspin)
+80106e54:	8b 42 2c             	mov    0x2c(%edx),%eax
+    spin = lk->tacquired - t0;
+80106e57:	8b 59 20             	mov    0x20(%ecx),%ebx
+80106e5a:	8b 49 1c             	mov    0x1c(%ecx),%ecx
+80106e5d:	2b 4d e0             	sub    -0x20(%ebp),%ecx
+80106e60:	1b 5d e4             	sbb    -0x1c(%ebp),%ebx
+    st->contended++;
+80106e63:	83 42 14 01          	addl   $0x1,0x14(%edx)
+    st->spin += spin;
+80106e67:	01 4a 20             	add    %ecx,0x20(%edx)
+80106e6a:	11 5a 24             	adc    %ebx,0x24(%edx)
+    if(spin > st->maxspin)
+80106e6d:	39 4a 28             	cmp    %ecx,0x28(%edx)
+80106e70:	19 d8                	sbb    %ebx,%eax
+80106e72:	73 06                	jae    80106e7a <acquire+0x14a>
+      st->maxspin = spin;
+80106e74:	89 4a 28             	mov    %ecx,0x28(%edx)
+80106e77:	89 5a 2c             	mov    %ebx,0x2c(%edx)
+}
+80106e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106e7d:	5b                   	pop    %ebx
+80106e7e:	5e                   	pop    %esi
+80106e7f:	5f                   	pop    %edi
+80106e80:	5d                   	pop    %ebp
+80106e81:	c3                   	ret
+80106e82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106e88:	8d 44 91 2c          	lea    0x2c(%ecx,%edx,4),%eax
+80106e8c:	83 c1 54             	add    $0x54,%ecx
+80106e8f:	90                   	nop
+    pcs[i] = 0;
+80106e90:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80106e96:	83 c0 04             	add    $0x4,%eax
+80106e99:	39 c8                	cmp    %ecx,%eax
+80106e9b:	75 f3                	jne    80106e90 <acquire+0x160>
+80106e9d:	eb 88                	jmp    80106e27 <acquire+0xf7>
+80106e9f:	90                   	nop
+  asm volatile("lock; xaddl %0, %1" :
+80106ea0:	f0 0f c1 7b 08       	lock xadd %edi,0x8(%ebx)
+  waited = 0;
+80106ea5:	31 db                	xor    %ebx,%ebx
+    while(lk->served != t)
+80106ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+80106eaa:	eb 09                	jmp    80106eb5 <acquire+0x185>
+80106eac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      waited = 1;
+80106eb0:	bb 01 00 00 00       	mov    $0x1,%ebx
+    while(lk->served != t)
+80106eb5:	8b 42 0c             	mov    0xc(%edx),%eax
+80106eb8:	39 f8                	cmp    %edi,%eax
+80106eba:	75 f4                	jne    80106eb0 <acquire+0x180>
+    lk->locked = 1;
+80106ebc:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+    break;
+80106ec2:	e9 12 ff ff ff       	jmp    80106dd9 <acquire+0xa9>
+80106ec7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106ece:	66 90                	xchg   %ax,%ax
+  r = lock->locked && lock->cpu == mycpu();
+80106ed0:	8b 5b 28             	mov    0x28(%ebx),%ebx
+80106ed3:	e8 48 e1 ff ff       	call   80105020 <mycpu>
+80106ed8:	39 c3                	cmp    %eax,%ebx
+80106eda:	0f 85 70 fe ff ff    	jne    80106d50 <acquire+0x20>
+  popcli();
+80106ee0:	e8 6b fc ff ff       	call   80106b50 <popcli>
+    panic("acquire");
+80106ee5:	83 ec 0c             	sub    $0xc,%esp
+80106ee8:	68 40 b9 10 80       	push   $0x8010b940
+80106eed:	e8 ee 94 ff ff       	call   801003e0 <panic>
+  waited = 0;
+80106ef2:	31 db                	xor    %ebx,%ebx
+80106ef4:	e9 e0 fe ff ff       	jmp    80106dd9 <acquire+0xa9>
+    if((c->mcsused & (1 << i)) == 0){
+80106ef9:	be c0 00 00 00       	mov    $0xc0,%esi
+80106efe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  for(i = 0; i < NMCS; i++){
+80106f03:	31 ff                	xor    %edi,%edi
+      c->mcsused |= 1 << i;
+80106f05:	09 ca                	or     %ecx,%edx
+      return &c->mcs[i];
+80106f07:	01 c6                	add    %eax,%esi
+80106f09:	8d 0c f8             	lea    (%eax,%edi,8),%ecx
+      c->mcsused |= 1 << i;
+80106f0c:	89 90 e0 00 00 00    	mov    %edx,0xe0(%eax)
+  asm volatile("lock; xchgl %0, %1" :
+80106f12:	89 f0                	mov    %esi,%eax
+  n->next = 0;
+80106f14:	c7 81 c0 00 00 00 00 	movl   $0x0,0xc0(%ecx)
+80106f1b:	00 00 00 
+  n->wait = 1;
+80106f1e:	c7 81 c4 00 00 00 01 	movl   $0x1,0xc4(%ecx)
+80106f25:	00 00 00 
+80106f28:	f0 87 43 10          	lock xchg %eax,0x10(%ebx)
+  if(prev){
+80106f2c:	85 c0                	test   %eax,%eax
+80106f2e:	74 12                	je     80106f42 <acquire+0x212>
+    prev->next = n;
+80106f30:	89 30                	mov    %esi,(%eax)
+    while(n->wait)
+80106f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106f38:	8b 91 c4 00 00 00    	mov    0xc4(%ecx),%edx
+80106f3e:	85 d2                	test   %edx,%edx
+80106f40:	75 f6                	jne    80106f38 <acquire+0x208>
+  lk->node = n;
+80106f42:	89 73 14             	mov    %esi,0x14(%ebx)
+  return prev != 0;
+80106f45:	31 db                	xor    %ebx,%ebx
+80106f47:	85 c0                	test   %eax,%eax
+    lk->locked = 1;
+80106f49:	8b 45 08             	mov    0x8(%ebp),%eax
+  return prev != 0;
+80106f4c:	0f 95 c3             	setne  %bl
+    lk->locked = 1;
+80106f4f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+    break;
+80106f55:	e9 7f fe ff ff       	jmp    80106dd9 <acquire+0xa9>
+  for(i = 0; i < NMCS; i++){
+80106f5a:	bf 01 00 00 00       	mov    $0x1,%edi
+    if((c->mcsused & (1 << i)) == 0){
+80106f5f:	b9 02 00 00 00       	mov    $0x2,%ecx
+80106f64:	8d 34 fd c0 00 00 00 	lea    0xc0(,%edi,8),%esi
+80106f6b:	eb 98                	jmp    80106f05 <acquire+0x1d5>
+80106f6d:	b9 04 00 00 00       	mov    $0x4,%ecx
+80106f72:	eb f0                	jmp    80106f64 <acquire+0x234>
+  for(i = 0; i < NMCS; i++){
+80106f74:	bf 03 00 00 00       	mov    $0x3,%edi
+    if((c->mcsused & (1 << i)) == 0){
+80106f79:	b9 08 00 00 00       	mov    $0x8,%ecx
+80106f7e:	eb e4                	jmp    80106f64 <acquire+0x234>
+
+80106f80 <lockstatread>:
+// CPUs, to st. If reset is set, then start counting again from
+// zero; counts from other CPUs that are in the middle of an
+// update may survive. Returns the number of classes copied.
+int
+lockstatread(struct lockstat *st, int n, int reset)
+{
+80106f80:	55                   	push   %ebp
+80106f81:	89 e5                	mov    %esp,%ebp
+80106f83:	57                   	push   %edi
+80106f84:	56                   	push   %esi
+80106f85:	be 70 ff 14 80       	mov    $0x8014ff70,%esi
+80106f8a:	53                   	push   %ebx
+80106f8b:	83 ec 4c             	sub    $0x4c,%esp
+80106f8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+80106f91:	a1 1c e1 10 80       	mov    0x8010e11c,%eax
+80106f96:	8b 7d 08             	mov    0x8(%ebp),%edi
+80106f99:	39 c2                	cmp    %eax,%edx
+80106f9b:	0f 4e c2             	cmovle %edx,%eax
+80106f9e:	31 db                	xor    %ebx,%ebx
+80106fa0:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  struct lockstat *s;
+  int i, c;
+
+  if(n > nclass)
+    n = nclass;
+  for(i = 0; i < n; i++){
+80106fa3:	85 c0                	test   %eax,%eax
+80106fa5:	0f 8e 44 01 00 00    	jle    801070ef <lockstatread+0x16f>
+80106fab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106faf:	90                   	nop
+    memset(&st[i], 0, sizeof(st[i]));
+80106fb0:	83 ec 04             	sub    $0x4,%esp
+80106fb3:	6a 40                	push   $0x40
+80106fb5:	6a 00                	push   $0x0
+80106fb7:	57                   	push   %edi
+80106fb8:	e8 f3 02 00 00       	call   801072b0 <memset>
+    safestrcpy(st[i].name, classname[i], sizeof(st[i].name));
+80106fbd:	83 c4 0c             	add    $0xc,%esp
+80106fc0:	6a 10                	push   $0x10
+80106fc2:	ff 34 9d 20 e1 10 80 	push   -0x7fef1ee0(,%ebx,4)
+80106fc9:	57                   	push   %edi
+80106fca:	e8 91 04 00 00       	call   80107460 <safestrcpy>
+    for(c = 0; c < ncpu; c++){
+80106fcf:	a1 64 68 11 80       	mov    0x80116864,%eax
+80106fd4:	83 c4 10             	add    $0x10,%esp
+80106fd7:	85 c0                	test   %eax,%eax
+80106fd9:	0f 8e fe 00 00 00    	jle    801070dd <lockstatread+0x15d>
+      s = &stats[c][i];
+      st[i].acquires += s->acquires;
+80106fdf:	8b 4f 10             	mov    0x10(%edi),%ecx
+      st[i].contended += s->contended;
+      st[i].spun += s->spun;
+      st[i].slept += s->slept;
+      st[i].spin += s->spin;
+80106fe2:	8b 57 20             	mov    0x20(%edi),%edx
+80106fe5:	c1 e0 06             	shl    $0x6,%eax
+      st[i].hold += s->hold;
+80106fe8:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106feb:	01 d8                	add    %ebx,%eax
+80106fed:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+      st[i].acquires += s->acquires;
+80106ff0:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+      st[i].contended += s->contended;
+80106ff3:	8b 4f 14             	mov    0x14(%edi),%ecx
+80106ff6:	c1 e0 06             	shl    $0x6,%eax
+      st[i].spin += s->spin;
+80106ff9:	89 55 c8             	mov    %edx,-0x38(%ebp)
+      st[i].hold += s->hold;
+80106ffc:	8b 57 30             	mov    0x30(%edi),%edx
+80106fff:	05 70 ff 14 80       	add    $0x8014ff70,%eax
+      st[i].contended += s->contended;
+80107004:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+      st[i].spun += s->spun;
+80107007:	8b 4f 18             	mov    0x18(%edi),%ecx
+      st[i].hold += s->hold;
+8010700a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+      st[i].spun += s->spun;
+8010700d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+      st[i].slept += s->slept;
+80107010:	8b 4f 1c             	mov    0x1c(%edi),%ecx
+      st[i].hold += s->hold;
+80107013:	89 75 b8             	mov    %esi,-0x48(%ebp)
+      st[i].slept += s->slept;
+80107016:	89 4d c4             	mov    %ecx,-0x3c(%ebp)
+      st[i].spin += s->spin;
+80107019:	8b 4f 24             	mov    0x24(%edi),%ecx
+8010701c:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      st[i].hold += s->hold;
+8010701f:	89 f0                	mov    %esi,%eax
+      st[i].spin += s->spin;
+80107021:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+      st[i].hold += s->hold;
+80107024:	8b 4f 34             	mov    0x34(%edi),%ecx
+80107027:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+8010702a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      st[i].acquires += s->acquires;
+80107030:	8b 38                	mov    (%eax),%edi
+80107032:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80107035:	01 7d d8             	add    %edi,-0x28(%ebp)
+80107038:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010703b:	89 53 10             	mov    %edx,0x10(%ebx)
+      st[i].contended += s->contended;
+8010703e:	8b 70 04             	mov    0x4(%eax),%esi
+80107041:	01 75 e0             	add    %esi,-0x20(%ebp)
+80107044:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80107047:	89 7b 14             	mov    %edi,0x14(%ebx)
+      st[i].spun += s->spun;
+8010704a:	8b 78 08             	mov    0x8(%eax),%edi
+8010704d:	01 7d dc             	add    %edi,-0x24(%ebp)
+80107050:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80107053:	89 53 18             	mov    %edx,0x18(%ebx)
+      st[i].slept += s->slept;
+80107056:	8b 78 0c             	mov    0xc(%eax),%edi
+80107059:	01 7d c4             	add    %edi,-0x3c(%ebp)
+8010705c:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+8010705f:	89 4b 1c             	mov    %ecx,0x1c(%ebx)
+      st[i].spin += s->spin;
+80107062:	8b 50 10             	mov    0x10(%eax),%edx
+80107065:	8b 48 14             	mov    0x14(%eax),%ecx
+80107068:	01 55 c8             	add    %edx,-0x38(%ebp)
+8010706b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010706e:	11 4d cc             	adc    %ecx,-0x34(%ebp)
+80107071:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+80107074:	8b 75 cc             	mov    -0x34(%ebp),%esi
+80107077:	89 5a 20             	mov    %ebx,0x20(%edx)
+8010707a:	89 72 24             	mov    %esi,0x24(%edx)
+      st[i].hold += s->hold;
+8010707d:	8b 70 20             	mov    0x20(%eax),%esi
+80107080:	8b 78 24             	mov    0x24(%eax),%edi
+80107083:	01 75 d0             	add    %esi,-0x30(%ebp)
+80107086:	11 7d d4             	adc    %edi,-0x2c(%ebp)
+80107089:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+8010708c:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+8010708f:	89 4a 30             	mov    %ecx,0x30(%edx)
+      if(s->maxspin > st[i].maxspin)
+80107092:	8b 4a 2c             	mov    0x2c(%edx),%ecx
+      st[i].hold += s->hold;
+80107095:	89 5a 34             	mov    %ebx,0x34(%edx)
+      if(s->maxspin > st[i].maxspin)
+80107098:	8b 58 1c             	mov    0x1c(%eax),%ebx
+8010709b:	8b 70 18             	mov    0x18(%eax),%esi
+8010709e:	39 72 28             	cmp    %esi,0x28(%edx)
+801070a1:	19 d9                	sbb    %ebx,%ecx
+801070a3:	73 06                	jae    801070ab <lockstatread+0x12b>
+        st[i].maxspin = s->maxspin;
+801070a5:	89 72 28             	mov    %esi,0x28(%edx)
+801070a8:	89 5a 2c             	mov    %ebx,0x2c(%edx)
+      if(s->maxhold > st[i].maxhold)
+801070ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801070ae:	8b 58 2c             	mov    0x2c(%eax),%ebx
+801070b1:	8b 70 28             	mov    0x28(%eax),%esi
+801070b4:	8b 4f 3c             	mov    0x3c(%edi),%ecx
+801070b7:	39 77 38             	cmp    %esi,0x38(%edi)
+801070ba:	19 d9                	sbb    %ebx,%ecx
+801070bc:	73 06                	jae    801070c4 <lockstatread+0x144>
+        st[i].maxhold = s->maxhold;
+801070be:	89 77 38             	mov    %esi,0x38(%edi)
+801070c1:	89 5f 3c             	mov    %ebx,0x3c(%edi)
+    for(c = 0; c < ncpu; c++){
+801070c4:	8b 7d c0             	mov    -0x40(%ebp),%edi
+801070c7:	05 00 10 00 00       	add    $0x1000,%eax
+801070cc:	39 f8                	cmp    %edi,%eax
+801070ce:	0f 85 5c ff ff ff    	jne    80107030 <lockstatread+0xb0>
+801070d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801070d7:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+801070da:	8b 75 b8             	mov    -0x48(%ebp),%esi
+  for(i = 0; i < n; i++){
+801070dd:	83 c3 01             	add    $0x1,%ebx
+801070e0:	83 c7 40             	add    $0x40,%edi
+801070e3:	83 c6 40             	add    $0x40,%esi
+801070e6:	39 5d b4             	cmp    %ebx,-0x4c(%ebp)
+801070e9:	0f 85 c1 fe ff ff    	jne    80106fb0 <lockstatread+0x30>
+    }
+  }
+  if(reset)
+801070ef:	8b 45 10             	mov    0x10(%ebp),%eax
+801070f2:	85 c0                	test   %eax,%eax
+801070f4:	75 0b                	jne    80107101 <lockstatread+0x181>
+    memset(stats, 0, sizeof(stats));
+  return n;
+}
+801070f6:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+801070f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801070fc:	5b                   	pop    %ebx
+801070fd:	5e                   	pop    %esi
+801070fe:	5f                   	pop    %edi
+801070ff:	5d                   	pop    %ebp
+80107100:	c3                   	ret
+    memset(stats, 0, sizeof(stats));
+80107101:	83 ec 04             	sub    $0x4,%esp
+80107104:	68 00 80 00 00       	push   $0x8000
+80107109:	6a 00                	push   $0x0
+8010710b:	68 60 ff 14 80       	push   $0x8014ff60
+80107110:	e8 9b 01 00 00       	call   801072b0 <memset>
+}
+80107115:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    memset(stats, 0, sizeof(stats));
+80107118:	83 c4 10             	add    $0x10,%esp
+}
+8010711b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010711e:	5b                   	pop    %ebx
+8010711f:	5e                   	pop    %esi
+80107120:	5f                   	pop    %edi
+80107121:	5d                   	pop    %ebp
+80107122:	c3                   	ret
+80107123:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010712a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107130 <lockstatsleep>:
+// Count an acquisition of a sleep lock in class for lockstat.
+// how is SL_FREE, SL_SPUN or SL_SLEPT, and wait is how many
+// cycles it took. Caller must have interrupts off.
+void
+lockstatsleep(int class, int how, uint64 wait)
+{
+80107130:	55                   	push   %ebp
+80107131:	89 e5                	mov    %esp,%ebp
+80107133:	57                   	push   %edi
+80107134:	56                   	push   %esi
+80107135:	53                   	push   %ebx
+80107136:	83 ec 0c             	sub    $0xc,%esp
+80107139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010713c:	8b 75 10             	mov    0x10(%ebp),%esi
+8010713f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  struct lockstat *st;
+
+  st = &stats[cpuid()][class];
+80107142:	e8 b9 de ff ff       	call   80105000 <cpuid>
+  st->acquires++;
+80107147:	89 c2                	mov    %eax,%edx
+80107149:	c1 e2 06             	shl    $0x6,%edx
+8010714c:	03 55 08             	add    0x8(%ebp),%edx
+8010714f:	c1 e2 06             	shl    $0x6,%edx
+80107152:	83 82 70 ff 14 80 01 	addl   $0x1,-0x7feb0090(%edx)
+  if(how == SL_FREE)
+80107159:	85 db                	test   %ebx,%ebx
+8010715b:	74 44                	je     801071a1 <lockstatsleep+0x71>
+8010715d:	8d 8a 60 ff 14 80    	lea    -0x7feb00a0(%edx),%ecx
+    return;
+  st->contended++;
+80107163:	83 41 14 01          	addl   $0x1,0x14(%ecx)
+  if(how == SL_SPUN)
+80107167:	83 fb 01             	cmp    $0x1,%ebx
+8010716a:	74 44                	je     801071b0 <lockstatsleep+0x80>
+    st->spun++;
+  else
+    st->slept++;
+8010716c:	83 41 1c 01          	addl   $0x1,0x1c(%ecx)
+  st->spin += wait;
+80107170:	c1 e0 06             	shl    $0x6,%eax
+80107173:	03 45 08             	add    0x8(%ebp),%eax
+80107176:	c1 e0 06             	shl    $0x6,%eax
+  if(wait > st->maxspin)
+80107179:	8b 90 8c ff 14 80    	mov    -0x7feb0074(%eax),%edx
+  st->spin += wait;
+8010717f:	01 b0 80 ff 14 80    	add    %esi,-0x7feb0080(%eax)
+80107185:	11 b8 84 ff 14 80    	adc    %edi,-0x7feb007c(%eax)
+  if(wait > st->maxspin)
+8010718b:	39 b0 88 ff 14 80    	cmp    %esi,-0x7feb0078(%eax)
+80107191:	19 fa                	sbb    %edi,%edx
+80107193:	73 0c                	jae    801071a1 <lockstatsleep+0x71>
+    st->maxspin = wait;
+80107195:	89 b0 88 ff 14 80    	mov    %esi,-0x7feb0078(%eax)
+8010719b:	89 b8 8c ff 14 80    	mov    %edi,-0x7feb0074(%eax)
+}
+801071a1:	83 c4 0c             	add    $0xc,%esp
+801071a4:	5b                   	pop    %ebx
+801071a5:	5e                   	pop    %esi
+801071a6:	5f                   	pop    %edi
+801071a7:	5d                   	pop    %ebp
+801071a8:	c3                   	ret
+801071a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    st->spun++;
+801071b0:	83 41 18 01          	addl   $0x1,0x18(%ecx)
+801071b4:	eb ba                	jmp    80107170 <lockstatsleep+0x40>
+801071b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801071bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801071c0 <lockstress>:
+// Acquire and release the stress lock of the given kind n times,
+// doing a little work while holding it, for the lockbench program.
+// Returns the longest wait for the lock in clock cycles.
+int
+lockstress(int kind, int n)
+{
+801071c0:	55                   	push   %ebp
+801071c1:	89 e5                	mov    %esp,%ebp
+801071c3:	57                   	push   %edi
+801071c4:	56                   	push   %esi
+801071c5:	53                   	push   %ebx
+801071c6:	83 ec 1c             	sub    $0x1c,%esp
+801071c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct spinlock *lk;
+  uint64 t0, w, maxw;
+  int i;
+
+  if(kind < 0 || kind >= NELEM(stresslk) || n < 0)
+801071cc:	83 f8 02             	cmp    $0x2,%eax
+801071cf:	0f 87 cb 00 00 00    	ja     801072a0 <lockstress+0xe0>
+801071d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801071d8:	85 db                	test   %ebx,%ebx
+801071da:	0f 88 c0 00 00 00    	js     801072a0 <lockstress+0xe0>
+    return -1;
+  lk = &stresslk[kind];
+801071e0:	6b c0 54             	imul   $0x54,%eax,%eax
+  if(lk->class == 0)
+801071e3:	8b 88 38 e0 10 80    	mov    -0x7fef1fc8(%eax),%ecx
+  lk = &stresslk[kind];
+801071e9:	8d 90 20 e0 10 80    	lea    -0x7fef1fe0(%eax),%edx
+801071ef:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  if(lk->class == 0)
+801071f2:	85 c9                	test   %ecx,%ecx
+801071f4:	0f 84 7e 00 00 00    	je     80107278 <lockstress+0xb8>
+    lk->class = lockclass(lk->name);
+  maxw = 0;
+  for(i = 0; i < n; i++){
+801071fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+801071fd:	85 d2                	test   %edx,%edx
+801071ff:	0f 84 91 00 00 00    	je     80107296 <lockstress+0xd6>
+80107205:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+8010720c:	31 c9                	xor    %ecx,%ecx
+8010720e:	31 db                	xor    %ebx,%ebx
+80107210:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  asm volatile("rdtsc" : "=A" (t));
+80107213:	0f 31                	rdtsc
+    t0 = rdtsc();
+    acquire(lk);
+80107215:	83 ec 0c             	sub    $0xc,%esp
+80107218:	ff 75 e0             	push   -0x20(%ebp)
+8010721b:	89 c6                	mov    %eax,%esi
+8010721d:	89 d7                	mov    %edx,%edi
+8010721f:	e8 0c fb ff ff       	call   80106d30 <acquire>
+80107224:	0f 31                	rdtsc
+    w = rdtsc() - t0;
+80107226:	29 f0                	sub    %esi,%eax
+80107228:	89 de                	mov    %ebx,%esi
+8010722a:	19 fa                	sbb    %edi,%edx
+8010722c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010722f:	39 c7                	cmp    %eax,%edi
+80107231:	19 d6                	sbb    %edx,%esi
+80107233:	0f 42 f8             	cmovb  %eax,%edi
+80107236:	0f 42 da             	cmovb  %edx,%ebx
+    if(w > maxw)
+      maxw = w;
+    stresscount++;
+80107239:	83 05 40 ff 14 80 01 	addl   $0x1,0x8014ff40
+    release(lk);
+80107240:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80107243:	58                   	pop    %eax
+80107244:	ff 75 e0             	push   -0x20(%ebp)
+80107247:	e8 a4 f9 ff ff       	call   80106bf0 <release>
+  for(i = 0; i < n; i++){
+8010724c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010724f:	83 c4 10             	add    $0x10,%esp
+80107252:	83 c1 01             	add    $0x1,%ecx
+80107255:	39 4d 0c             	cmp    %ecx,0xc(%ebp)
+80107258:	75 b6                	jne    80107210 <lockstress+0x50>
+  }
+  return maxw > 0x7fffffff ? 0x7fffffff : maxw;
+8010725a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010725d:	b8 ff ff ff 7f       	mov    $0x7fffffff,%eax
+80107262:	31 d2                	xor    %edx,%edx
+80107264:	39 f0                	cmp    %esi,%eax
+80107266:	19 da                	sbb    %ebx,%edx
+80107268:	0f 43 c6             	cmovae %esi,%eax
+}
+8010726b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010726e:	5b                   	pop    %ebx
+8010726f:	5e                   	pop    %esi
+80107270:	5f                   	pop    %edi
+80107271:	5d                   	pop    %ebp
+80107272:	c3                   	ret
+80107273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107277:	90                   	nop
+    lk->class = lockclass(lk->name);
+80107278:	83 ec 0c             	sub    $0xc,%esp
+8010727b:	ff 72 24             	push   0x24(%edx)
+8010727e:	89 d3                	mov    %edx,%ebx
+80107280:	e8 8b f6 ff ff       	call   80106910 <lockclass>
+  for(i = 0; i < n; i++){
+80107285:	8b 55 0c             	mov    0xc(%ebp),%edx
+    lk->class = lockclass(lk->name);
+80107288:	83 c4 10             	add    $0x10,%esp
+8010728b:	89 43 18             	mov    %eax,0x18(%ebx)
+  for(i = 0; i < n; i++){
+8010728e:	85 d2                	test   %edx,%edx
+80107290:	0f 85 6f ff ff ff    	jne    80107205 <lockstress+0x45>
+}
+80107296:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  for(i = 0; i < n; i++){
+80107299:	31 c0                	xor    %eax,%eax
+}
+8010729b:	5b                   	pop    %ebx
+8010729c:	5e                   	pop    %esi
+8010729d:	5f                   	pop    %edi
+8010729e:	5d                   	pop    %ebp
+8010729f:	c3                   	ret
+    return -1;
+801072a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801072a5:	eb c4                	jmp    8010726b <lockstress+0xab>
+801072a7:	66 90                	xchg   %ax,%ax
+801072a9:	66 90                	xchg   %ax,%ax
+801072ab:	66 90                	xchg   %ax,%ax
+801072ad:	66 90                	xchg   %ax,%ax
+801072af:	90                   	nop
+
+801072b0 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+801072b0:	55                   	push   %ebp
+801072b1:	89 e5                	mov    %esp,%ebp
+801072b3:	57                   	push   %edi
+801072b4:	8b 55 08             	mov    0x8(%ebp),%edx
+801072b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+801072ba:	89 d0                	mov    %edx,%eax
+801072bc:	09 c8                	or     %ecx,%eax
+801072be:	a8 03                	test   $0x3,%al
+801072c0:	75 1e                	jne    801072e0 <memset+0x30>
+    c &= 0xFF;
+801072c2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+801072c6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+801072c9:	89 d7                	mov    %edx,%edi
+801072cb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+801072d1:	fc                   	cld
+801072d2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+801072d4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801072d7:	89 d0                	mov    %edx,%eax
+801072d9:	c9                   	leave
+801072da:	c3                   	ret
+801072db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801072df:	90                   	nop
+  asm volatile("cld; rep stosb" :
+801072e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801072e3:	89 d7                	mov    %edx,%edi
+801072e5:	fc                   	cld
+801072e6:	f3 aa                	rep stos %al,%es:(%edi)
+801072e8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801072eb:	89 d0                	mov    %edx,%eax
+801072ed:	c9                   	leave
+801072ee:	c3                   	ret
+801072ef:	90                   	nop
+
+801072f0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+801072f0:	55                   	push   %ebp
+801072f1:	89 e5                	mov    %esp,%ebp
+801072f3:	56                   	push   %esi
+801072f4:	53                   	push   %ebx
+801072f5:	8b 75 10             	mov    0x10(%ebp),%esi
+801072f8:	8b 55 08             	mov    0x8(%ebp),%edx
+801072fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+801072fe:	85 f6                	test   %esi,%esi
+80107300:	74 2e                	je     80107330 <memcmp+0x40>
+80107302:	01 c6                	add    %eax,%esi
+80107304:	eb 14                	jmp    8010731a <memcmp+0x2a>
+80107306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010730d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107310:	83 c0 01             	add    $0x1,%eax
+80107313:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107316:	39 f0                	cmp    %esi,%eax
+80107318:	74 16                	je     80107330 <memcmp+0x40>
+    if(*s1 != *s2)
+8010731a:	0f b6 0a             	movzbl (%edx),%ecx
+8010731d:	0f b6 18             	movzbl (%eax),%ebx
+80107320:	38 d9                	cmp    %bl,%cl
+80107322:	74 ec                	je     80107310 <memcmp+0x20>
+      return *s1 - *s2;
+80107324:	0f b6 c1             	movzbl %cl,%eax
+80107327:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107329:	5b                   	pop    %ebx
+8010732a:	5e                   	pop    %esi
+8010732b:	5d                   	pop    %ebp
+8010732c:	c3                   	ret
+8010732d:	8d 76 00             	lea    0x0(%esi),%esi
+80107330:	5b                   	pop    %ebx
+  return 0;
+80107331:	31 c0                	xor    %eax,%eax
+}
+80107333:	5e                   	pop    %esi
+80107334:	5d                   	pop    %ebp
+80107335:	c3                   	ret
+80107336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010733d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107340 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107340:	55                   	push   %ebp
+80107341:	89 e5                	mov    %esp,%ebp
+80107343:	57                   	push   %edi
+80107344:	56                   	push   %esi
+80107345:	8b 55 08             	mov    0x8(%ebp),%edx
+80107348:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010734b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+8010734e:	39 d6                	cmp    %edx,%esi
+80107350:	73 26                	jae    80107378 <memmove+0x38>
+80107352:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107355:	39 ca                	cmp    %ecx,%edx
+80107357:	73 1f                	jae    80107378 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80107359:	85 c0                	test   %eax,%eax
+8010735b:	74 0f                	je     8010736c <memmove+0x2c>
+8010735d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80107360:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80107364:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80107367:	83 e8 01             	sub    $0x1,%eax
+8010736a:	73 f4                	jae    80107360 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+8010736c:	5e                   	pop    %esi
+8010736d:	89 d0                	mov    %edx,%eax
+8010736f:	5f                   	pop    %edi
+80107370:	5d                   	pop    %ebp
+80107371:	c3                   	ret
+80107372:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80107378:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010737b:	89 d7                	mov    %edx,%edi
+8010737d:	85 c0                	test   %eax,%eax
+8010737f:	74 eb                	je     8010736c <memmove+0x2c>
+80107381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107388:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107389:	39 ce                	cmp    %ecx,%esi
+8010738b:	75 fb                	jne    80107388 <memmove+0x48>
+}
+8010738d:	5e                   	pop    %esi
+8010738e:	89 d0                	mov    %edx,%eax
+80107390:	5f                   	pop    %edi
+80107391:	5d                   	pop    %ebp
+80107392:	c3                   	ret
+80107393:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010739a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801073a0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+801073a0:	eb 9e                	jmp    80107340 <memmove>
+801073a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801073b0 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+801073b0:	55                   	push   %ebp
+801073b1:	89 e5                	mov    %esp,%ebp
+801073b3:	53                   	push   %ebx
+801073b4:	8b 55 10             	mov    0x10(%ebp),%edx
+801073b7:	8b 45 08             	mov    0x8(%ebp),%eax
+801073ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+801073bd:	85 d2                	test   %edx,%edx
+801073bf:	75 16                	jne    801073d7 <strncmp+0x27>
+801073c1:	eb 2d                	jmp    801073f0 <strncmp+0x40>
+801073c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801073c7:	90                   	nop
+801073c8:	3a 19                	cmp    (%ecx),%bl
+801073ca:	75 12                	jne    801073de <strncmp+0x2e>
+    n--, p++, q++;
+801073cc:	83 c0 01             	add    $0x1,%eax
+801073cf:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+801073d2:	83 ea 01             	sub    $0x1,%edx
+801073d5:	74 19                	je     801073f0 <strncmp+0x40>
+801073d7:	0f b6 18             	movzbl (%eax),%ebx
+801073da:	84 db                	test   %bl,%bl
+801073dc:	75 ea                	jne    801073c8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+801073de:	0f b6 00             	movzbl (%eax),%eax
+801073e1:	0f b6 11             	movzbl (%ecx),%edx
+}
+801073e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801073e7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+801073e8:	29 d0                	sub    %edx,%eax
+}
+801073ea:	c3                   	ret
+801073eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801073ef:	90                   	nop
+801073f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+801073f3:	31 c0                	xor    %eax,%eax
+}
+801073f5:	c9                   	leave
+801073f6:	c3                   	ret
+801073f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073fe:	66 90                	xchg   %ax,%ax
+
+80107400 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107400:	55                   	push   %ebp
+80107401:	89 e5                	mov    %esp,%ebp
+80107403:	57                   	push   %edi
+80107404:	56                   	push   %esi
+80107405:	53                   	push   %ebx
+80107406:	8b 75 08             	mov    0x8(%ebp),%esi
+80107409:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010740c:	89 f0                	mov    %esi,%eax
+8010740e:	eb 15                	jmp    80107425 <strncpy+0x25>
+80107410:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80107414:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107417:	83 c0 01             	add    $0x1,%eax
+8010741a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+8010741e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80107421:	84 c9                	test   %cl,%cl
+80107423:	74 13                	je     80107438 <strncpy+0x38>
+80107425:	89 d3                	mov    %edx,%ebx
+80107427:	83 ea 01             	sub    $0x1,%edx
+8010742a:	85 db                	test   %ebx,%ebx
+8010742c:	7f e2                	jg     80107410 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+8010742e:	5b                   	pop    %ebx
+8010742f:	89 f0                	mov    %esi,%eax
+80107431:	5e                   	pop    %esi
+80107432:	5f                   	pop    %edi
+80107433:	5d                   	pop    %ebp
+80107434:	c3                   	ret
+80107435:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80107438:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010743b:	83 e9 01             	sub    $0x1,%ecx
+8010743e:	85 d2                	test   %edx,%edx
+80107440:	74 ec                	je     8010742e <strncpy+0x2e>
+80107442:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80107448:	83 c0 01             	add    $0x1,%eax
+8010744b:	89 ca                	mov    %ecx,%edx
+8010744d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80107451:	29 c2                	sub    %eax,%edx
+80107453:	85 d2                	test   %edx,%edx
+80107455:	7f f1                	jg     80107448 <strncpy+0x48>
+}
+80107457:	5b                   	pop    %ebx
+80107458:	89 f0                	mov    %esi,%eax
+8010745a:	5e                   	pop    %esi
+8010745b:	5f                   	pop    %edi
+8010745c:	5d                   	pop    %ebp
+8010745d:	c3                   	ret
+8010745e:	66 90                	xchg   %ax,%ax
+
+80107460 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107460:	55                   	push   %ebp
+80107461:	89 e5                	mov    %esp,%ebp
+80107463:	56                   	push   %esi
+80107464:	53                   	push   %ebx
+80107465:	8b 55 10             	mov    0x10(%ebp),%edx
+80107468:	8b 75 08             	mov    0x8(%ebp),%esi
+8010746b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+8010746e:	85 d2                	test   %edx,%edx
+80107470:	7e 25                	jle    80107497 <safestrcpy+0x37>
+80107472:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80107476:	89 f2                	mov    %esi,%edx
+80107478:	eb 16                	jmp    80107490 <safestrcpy+0x30>
+8010747a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107480:	0f b6 08             	movzbl (%eax),%ecx
+80107483:	83 c0 01             	add    $0x1,%eax
+80107486:	83 c2 01             	add    $0x1,%edx
+80107489:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010748c:	84 c9                	test   %cl,%cl
+8010748e:	74 04                	je     80107494 <safestrcpy+0x34>
+80107490:	39 d8                	cmp    %ebx,%eax
+80107492:	75 ec                	jne    80107480 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80107494:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107497:	89 f0                	mov    %esi,%eax
+80107499:	5b                   	pop    %ebx
+8010749a:	5e                   	pop    %esi
+8010749b:	5d                   	pop    %ebp
+8010749c:	c3                   	ret
+8010749d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801074a0 <strlen>:
+
+int
+strlen(const char *s)
+{
+801074a0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+801074a1:	31 c0                	xor    %eax,%eax
+{
+801074a3:	89 e5                	mov    %esp,%ebp
+801074a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+801074a8:	80 3a 00             	cmpb   $0x0,(%edx)
+801074ab:	74 0c                	je     801074b9 <strlen+0x19>
+801074ad:	8d 76 00             	lea    0x0(%esi),%esi
+801074b0:	83 c0 01             	add    $0x1,%eax
+801074b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+801074b7:	75 f7                	jne    801074b0 <strlen+0x10>
+    ;
+  return n;
+}
+801074b9:	5d                   	pop    %ebp
+801074ba:	c3                   	ret
+
+801074bb <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+801074bb:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+801074bf:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+801074c3:	55                   	push   %ebp
+  pushl %ebx
+801074c4:	53                   	push   %ebx
+  pushl %esi
+801074c5:	56                   	push   %esi
+  pushl %edi
+801074c6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax) # Save a ptr to old struct context into *old
+801074c7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp # Switch stacks to the new context, which is in edx
+801074c9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+801074cb:	5f                   	pop    %edi
+  popl %esi
+801074cc:	5e                   	pop    %esi
+  popl %ebx
+801074cd:	5b                   	pop    %ebx
+  popl %ebp
+801074ce:	5d                   	pop    %ebp
+  ret
+801074cf:	c3                   	ret
+
+801074d0 <fetchint>:
+
+// Fetch the int at addr from the current process.
+// Only called in one other place.
+int
+fetchint(uint addr, int *ip)
+{
+801074d0:	55                   	push   %ebp
+801074d1:	89 e5                	mov    %esp,%ebp
+801074d3:	53                   	push   %ebx
+801074d4:	83 ec 04             	sub    $0x4,%esp
+801074d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801074da:	e8 51 db ff ff       	call   80105030 <myproc>
+
+  // Check that the integer is inside the process's address space
+  if (addr >= curproc->sz || addr+4 > curproc->sz)
+801074df:	8b 40 54             	mov    0x54(%eax),%eax
+801074e2:	39 c3                	cmp    %eax,%ebx
+801074e4:	73 1a                	jae    80107500 <fetchint+0x30>
+801074e6:	8d 53 04             	lea    0x4(%ebx),%edx
+801074e9:	39 d0                	cmp    %edx,%eax
+801074eb:	72 13                	jb     80107500 <fetchint+0x30>
+    return -1;
+
+  // Dereference addr and store in ip
+  *ip = *(int *)(addr);
+801074ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+801074f0:	8b 13                	mov    (%ebx),%edx
+801074f2:	89 10                	mov    %edx,(%eax)
+  return 0;
+801074f4:	31 c0                	xor    %eax,%eax
+}
+801074f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801074f9:	c9                   	leave
+801074fa:	c3                   	ret
+801074fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801074ff:	90                   	nop
+    return -1;
+80107500:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107505:	eb ef                	jmp    801074f6 <fetchint+0x26>
+80107507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010750e:	66 90                	xchg   %ax,%ax
+
+80107510 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80107510:	55                   	push   %ebp
+80107511:	89 e5                	mov    %esp,%ebp
+80107513:	53                   	push   %ebx
+80107514:	83 ec 04             	sub    $0x4,%esp
+80107517:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010751a:	e8 11 db ff ff       	call   80105030 <myproc>
+
+  // Make sure the ptr is in a valid address
+  if (addr >= curproc->sz)
+8010751f:	3b 58 54             	cmp    0x54(%eax),%ebx
+80107522:	73 2c                	jae    80107550 <fetchstr+0x40>
+    return -1;
+
+  *pp = (char*) addr;
+80107524:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107527:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*) curproc->sz;
+80107529:	8b 50 54             	mov    0x54(%eax),%edx
+  // Scan for a nul byte inside process's address space
+  for (s = *pp; s < ep; s++) {
+8010752c:	39 d3                	cmp    %edx,%ebx
+8010752e:	73 20                	jae    80107550 <fetchstr+0x40>
+80107530:	89 d8                	mov    %ebx,%eax
+80107532:	eb 0b                	jmp    8010753f <fetchstr+0x2f>
+80107534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107538:	83 c0 01             	add    $0x1,%eax
+8010753b:	39 d0                	cmp    %edx,%eax
+8010753d:	73 11                	jae    80107550 <fetchstr+0x40>
+    if (*s == 0)
+8010753f:	80 38 00             	cmpb   $0x0,(%eax)
+80107542:	75 f4                	jne    80107538 <fetchstr+0x28>
+      return s - *pp;
+80107544:	29 d8                	sub    %ebx,%eax
+  }
+  // String is not null-terminated, return err
+  return -1;
+}
+80107546:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107549:	c9                   	leave
+8010754a:	c3                   	ret
+8010754b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010754f:	90                   	nop
+80107550:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80107553:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107558:	c9                   	leave
+80107559:	c3                   	ret
+8010755a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107560 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+// Used by sys_ functions to recover an integer arg.
+int
+argint(int n, int *ip)
+{
+80107560:	55                   	push   %ebp
+80107561:	89 e5                	mov    %esp,%ebp
+80107563:	56                   	push   %esi
+80107564:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107565:	e8 c6 da ff ff       	call   80105030 <myproc>
+8010756a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010756d:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80107573:	8b 40 44             	mov    0x44(%eax),%eax
+80107576:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107579:	e8 b2 da ff ff       	call   80105030 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010757e:	8d 73 04             	lea    0x4(%ebx),%esi
+  if (addr >= curproc->sz || addr+4 > curproc->sz)
+80107581:	8b 40 54             	mov    0x54(%eax),%eax
+80107584:	39 c6                	cmp    %eax,%esi
+80107586:	73 18                	jae    801075a0 <argint+0x40>
+80107588:	8d 53 08             	lea    0x8(%ebx),%edx
+8010758b:	39 d0                	cmp    %edx,%eax
+8010758d:	72 11                	jb     801075a0 <argint+0x40>
+  *ip = *(int *)(addr);
+8010758f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107592:	8b 53 04             	mov    0x4(%ebx),%edx
+80107595:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107597:	31 c0                	xor    %eax,%eax
+}
+80107599:	5b                   	pop    %ebx
+8010759a:	5e                   	pop    %esi
+8010759b:	5d                   	pop    %ebp
+8010759c:	c3                   	ret
+8010759d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801075a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801075a5:	eb f2                	jmp    80107599 <argint+0x39>
+801075a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801075ae:	66 90                	xchg   %ax,%ax
+
+801075b0 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+801075b0:	55                   	push   %ebp
+801075b1:	89 e5                	mov    %esp,%ebp
+801075b3:	57                   	push   %edi
+801075b4:	56                   	push   %esi
+801075b5:	53                   	push   %ebx
+801075b6:	83 ec 0c             	sub    $0xc,%esp
+  int i;
+  struct proc *curproc = myproc();
+801075b9:	e8 72 da ff ff       	call   80105030 <myproc>
+801075be:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801075c0:	e8 6b da ff ff       	call   80105030 <myproc>
+801075c5:	8b 55 08             	mov    0x8(%ebp),%edx
+801075c8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+801075ce:	8b 40 44             	mov    0x44(%eax),%eax
+801075d1:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+801075d4:	e8 57 da ff ff       	call   80105030 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801075d9:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if (addr >= curproc->sz || addr+4 > curproc->sz)
+801075dc:	8b 40 54             	mov    0x54(%eax),%eax
+801075df:	39 c7                	cmp    %eax,%edi
+801075e1:	73 35                	jae    80107618 <argptr+0x68>
+801075e3:	8d 4b 08             	lea    0x8(%ebx),%ecx
+801075e6:	39 c8                	cmp    %ecx,%eax
+801075e8:	72 2e                	jb     80107618 <argptr+0x68>
+ 
+  if (argint(n, &i) < 0)
+    return -1;
+  // Make sure that ptr is valid, that the size is non-neg and the beginning and
+  // end of the memory block it points to are both in the process's address space
+  if (size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801075ea:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int *)(addr);
+801075ed:	8b 43 04             	mov    0x4(%ebx),%eax
+  if (size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801075f0:	85 d2                	test   %edx,%edx
+801075f2:	78 24                	js     80107618 <argptr+0x68>
+801075f4:	8b 56 54             	mov    0x54(%esi),%edx
+801075f7:	39 d0                	cmp    %edx,%eax
+801075f9:	73 1d                	jae    80107618 <argptr+0x68>
+801075fb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801075fe:	01 c3                	add    %eax,%ebx
+80107600:	39 da                	cmp    %ebx,%edx
+80107602:	72 14                	jb     80107618 <argptr+0x68>
+    return -1;
+
+  *pp = (char*) i;
+80107604:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107607:	89 02                	mov    %eax,(%edx)
+  return 0;
+80107609:	31 c0                	xor    %eax,%eax
+}
+8010760b:	83 c4 0c             	add    $0xc,%esp
+8010760e:	5b                   	pop    %ebx
+8010760f:	5e                   	pop    %esi
+80107610:	5f                   	pop    %edi
+80107611:	5d                   	pop    %ebp
+80107612:	c3                   	ret
+80107613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107617:	90                   	nop
+    return -1;
+80107618:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010761d:	eb ec                	jmp    8010760b <argptr+0x5b>
+8010761f:	90                   	nop
+
+80107620 <argarray>:
+// Fetch the nth word-sized system call argument as a pointer
+// to count elements of size bytes each.  count must be between
+// 0 and max, which keeps count*size from wrapping.
+int
+argarray(int n, void **pp, int count, int size, int max)
+{
+80107620:	55                   	push   %ebp
+80107621:	89 e5                	mov    %esp,%ebp
+80107623:	57                   	push   %edi
+80107624:	56                   	push   %esi
+80107625:	53                   	push   %ebx
+80107626:	83 ec 1c             	sub    $0x1c,%esp
+80107629:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (count < 0 || count > max)
+8010762c:	85 c0                	test   %eax,%eax
+8010762e:	78 68                	js     80107698 <argarray+0x78>
+80107630:	3b 45 18             	cmp    0x18(%ebp),%eax
+80107633:	7f 63                	jg     80107698 <argarray+0x78>
+    return -1;
+  return argptr(n, (char**)pp, count*size);
+80107635:	0f af 45 14          	imul   0x14(%ebp),%eax
+80107639:	89 c3                	mov    %eax,%ebx
+  struct proc *curproc = myproc();
+8010763b:	e8 f0 d9 ff ff       	call   80105030 <myproc>
+80107640:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107642:	e8 e9 d9 ff ff       	call   80105030 <myproc>
+80107647:	8b 55 08             	mov    0x8(%ebp),%edx
+8010764a:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80107650:	8b 40 44             	mov    0x44(%eax),%eax
+80107653:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+80107656:	8d 47 04             	lea    0x4(%edi),%eax
+80107659:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct proc *curproc = myproc();
+8010765c:	e8 cf d9 ff ff       	call   80105030 <myproc>
+  if (addr >= curproc->sz || addr+4 > curproc->sz)
+80107661:	8b 40 54             	mov    0x54(%eax),%eax
+80107664:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+80107667:	73 2f                	jae    80107698 <argarray+0x78>
+80107669:	8d 4f 08             	lea    0x8(%edi),%ecx
+8010766c:	39 c8                	cmp    %ecx,%eax
+8010766e:	72 28                	jb     80107698 <argarray+0x78>
+  *ip = *(int *)(addr);
+80107670:	8b 57 04             	mov    0x4(%edi),%edx
+  if (size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107673:	85 db                	test   %ebx,%ebx
+80107675:	78 21                	js     80107698 <argarray+0x78>
+80107677:	8b 4e 54             	mov    0x54(%esi),%ecx
+8010767a:	39 ca                	cmp    %ecx,%edx
+8010767c:	73 1a                	jae    80107698 <argarray+0x78>
+8010767e:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80107681:	39 c1                	cmp    %eax,%ecx
+80107683:	72 13                	jb     80107698 <argarray+0x78>
+  *pp = (char*) i;
+80107685:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107688:	89 10                	mov    %edx,(%eax)
+  return 0;
+8010768a:	31 c0                	xor    %eax,%eax
+}
+8010768c:	83 c4 1c             	add    $0x1c,%esp
+8010768f:	5b                   	pop    %ebx
+80107690:	5e                   	pop    %esi
+80107691:	5f                   	pop    %edi
+80107692:	5d                   	pop    %ebp
+80107693:	c3                   	ret
+80107694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80107698:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010769d:	eb ed                	jmp    8010768c <argarray+0x6c>
+8010769f:	90                   	nop
+
+801076a0 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+801076a0:	55                   	push   %ebp
+801076a1:	89 e5                	mov    %esp,%ebp
+801076a3:	56                   	push   %esi
+801076a4:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801076a5:	e8 86 d9 ff ff       	call   80105030 <myproc>
+801076aa:	8b 55 08             	mov    0x8(%ebp),%edx
+801076ad:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+801076b3:	8b 40 44             	mov    0x44(%eax),%eax
+801076b6:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+801076b9:	e8 72 d9 ff ff       	call   80105030 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801076be:	8d 73 04             	lea    0x4(%ebx),%esi
+  if (addr >= curproc->sz || addr+4 > curproc->sz)
+801076c1:	8b 40 54             	mov    0x54(%eax),%eax
+801076c4:	39 c6                	cmp    %eax,%esi
+801076c6:	73 40                	jae    80107708 <argstr+0x68>
+801076c8:	8d 53 08             	lea    0x8(%ebx),%edx
+801076cb:	39 d0                	cmp    %edx,%eax
+801076cd:	72 39                	jb     80107708 <argstr+0x68>
+  *ip = *(int *)(addr);
+801076cf:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+801076d2:	e8 59 d9 ff ff       	call   80105030 <myproc>
+  if (addr >= curproc->sz)
+801076d7:	3b 58 54             	cmp    0x54(%eax),%ebx
+801076da:	73 2c                	jae    80107708 <argstr+0x68>
+  *pp = (char*) addr;
+801076dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+801076df:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*) curproc->sz;
+801076e1:	8b 50 54             	mov    0x54(%eax),%edx
+  for (s = *pp; s < ep; s++) {
+801076e4:	39 d3                	cmp    %edx,%ebx
+801076e6:	73 20                	jae    80107708 <argstr+0x68>
+801076e8:	89 d8                	mov    %ebx,%eax
+801076ea:	eb 0b                	jmp    801076f7 <argstr+0x57>
+801076ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801076f0:	83 c0 01             	add    $0x1,%eax
+801076f3:	39 d0                	cmp    %edx,%eax
+801076f5:	73 11                	jae    80107708 <argstr+0x68>
+    if (*s == 0)
+801076f7:	80 38 00             	cmpb   $0x0,(%eax)
+801076fa:	75 f4                	jne    801076f0 <argstr+0x50>
+      return s - *pp;
+801076fc:	29 d8                	sub    %ebx,%eax
+  int addr;
+  if (argint(n, &addr) < 0)
+    return -1;
+  return fetchstr(addr, pp);
+}
+801076fe:	5b                   	pop    %ebx
+801076ff:	5e                   	pop    %esi
+80107700:	5d                   	pop    %ebp
+80107701:	c3                   	ret
+80107702:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107708:	5b                   	pop    %ebx
+    return -1;
+80107709:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010770e:	5e                   	pop    %esi
+8010770f:	5d                   	pop    %ebp
+80107710:	c3                   	ret
+80107711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010771f:	90                   	nop
+
+80107720 <syscall>:
+// must keep up with this table.
+_Static_assert(NELEM(syscalls) == NSYSCALL, "NSYSCALL does not match syscalls[]");
+
+void
+syscall(void)
+{
+80107720:	55                   	push   %ebp
+80107721:	89 e5                	mov    %esp,%ebp
+80107723:	57                   	push   %edi
+80107724:	56                   	push   %esi
+80107725:	53                   	push   %ebx
+80107726:	83 ec 0c             	sub    $0xc,%esp
+  int num;
+  struct proc *curproc = myproc();
+80107729:	e8 02 d9 ff ff       	call   80105030 <myproc>
+8010772e:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80107730:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+80107736:	8b 70 1c             	mov    0x1c(%eax),%esi
+  // Check that the syscall number is between 1 and 21
+  if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80107739:	8d 46 ff             	lea    -0x1(%esi),%eax
+8010773c:	83 f8 24             	cmp    $0x24,%eax
+8010773f:	77 4f                	ja     80107790 <syscall+0x70>
+80107741:	8b 3c b5 a0 b9 10 80 	mov    -0x7fef4660(,%esi,4),%edi
+80107748:	85 ff                	test   %edi,%edi
+8010774a:	74 44                	je     80107790 <syscall+0x70>
+    curproc->syscalls[num]++;
+8010774c:	83 84 b3 20 01 00 00 	addl   $0x1,0x120(%ebx,%esi,4)
+80107753:	01 
+    trace(TR_SYSCALL, num, 0);
+80107754:	83 ec 04             	sub    $0x4,%esp
+80107757:	6a 00                	push   $0x0
+80107759:	56                   	push   %esi
+8010775a:	6a 01                	push   $0x1
+8010775c:	e8 4f 1d 00 00       	call   801094b0 <trace>
+    curproc->tf->eax = syscalls[num]();
+80107761:	ff d7                	call   *%edi
+80107763:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+    trace(TR_SYSRET, num, curproc->tf->eax);
+80107769:	83 c4 0c             	add    $0xc,%esp
+    curproc->tf->eax = syscalls[num]();
+8010776c:	89 42 1c             	mov    %eax,0x1c(%edx)
+    trace(TR_SYSRET, num, curproc->tf->eax);
+8010776f:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80107775:	ff 70 1c             	push   0x1c(%eax)
+80107778:	56                   	push   %esi
+80107779:	6a 02                	push   $0x2
+8010777b:	e8 30 1d 00 00       	call   801094b0 <trace>
+80107780:	83 c4 10             	add    $0x10,%esp
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+80107783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107786:	5b                   	pop    %ebx
+80107787:	5e                   	pop    %esi
+80107788:	5f                   	pop    %edi
+80107789:	5d                   	pop    %ebp
+8010778a:	c3                   	ret
+8010778b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010778f:	90                   	nop
+            curproc->pid, curproc->name, num);
+80107790:	8d 83 d8 00 00 00    	lea    0xd8(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80107796:	56                   	push   %esi
+80107797:	50                   	push   %eax
+80107798:	ff 73 64             	push   0x64(%ebx)
+8010779b:	68 7d b9 10 80       	push   $0x8010b97d
+801077a0:	e8 6b 8f ff ff       	call   80100710 <cprintf>
+    curproc->tf->eax = -1;
+801077a5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801077ab:	83 c4 10             	add    $0x10,%esp
+801077ae:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+801077b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801077b8:	5b                   	pop    %ebx
+801077b9:	5e                   	pop    %esi
+801077ba:	5f                   	pop    %edi
+801077bb:	5d                   	pop    %ebp
+801077bc:	c3                   	ret
+801077bd:	66 90                	xchg   %ax,%ax
+801077bf:	90                   	nop
+
+801077c0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801077c0:	55                   	push   %ebp
+801077c1:	89 e5                	mov    %esp,%ebp
+801077c3:	57                   	push   %edi
+801077c4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801077c5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+801077c8:	53                   	push   %ebx
+801077c9:	83 ec 34             	sub    $0x34,%esp
+801077cc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801077cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801077d2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801077d5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+801077d8:	57                   	push   %edi
+801077d9:	50                   	push   %eax
+801077da:	e8 71 b5 ff ff       	call   80102d50 <nameiparent>
+801077df:	83 c4 10             	add    $0x10,%esp
+801077e2:	85 c0                	test   %eax,%eax
+801077e4:	74 5e                	je     80107844 <create+0x84>
+    return 0;
+  ilock(dp);
+801077e6:	83 ec 0c             	sub    $0xc,%esp
+801077e9:	89 c3                	mov    %eax,%ebx
+801077eb:	50                   	push   %eax
+801077ec:	e8 0f a9 ff ff       	call   80102100 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801077f1:	83 c4 0c             	add    $0xc,%esp
+801077f4:	6a 00                	push   $0x0
+801077f6:	57                   	push   %edi
+801077f7:	53                   	push   %ebx
+801077f8:	e8 63 b1 ff ff       	call   80102960 <dirlookup>
+801077fd:	83 c4 10             	add    $0x10,%esp
+80107800:	89 c6                	mov    %eax,%esi
+80107802:	85 c0                	test   %eax,%eax
+80107804:	74 4a                	je     80107850 <create+0x90>
+    iunlockput(dp);
+80107806:	83 ec 0c             	sub    $0xc,%esp
+80107809:	53                   	push   %ebx
+8010780a:	e8 b1 ab ff ff       	call   801023c0 <iunlockput>
+    ilock(ip);
+8010780f:	89 34 24             	mov    %esi,(%esp)
+80107812:	e8 e9 a8 ff ff       	call   80102100 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80107817:	83 c4 10             	add    $0x10,%esp
+8010781a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+8010781f:	75 17                	jne    80107838 <create+0x78>
+80107821:	66 83 7e 78 02       	cmpw   $0x2,0x78(%esi)
+80107826:	75 10                	jne    80107838 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010782b:	89 f0                	mov    %esi,%eax
+8010782d:	5b                   	pop    %ebx
+8010782e:	5e                   	pop    %esi
+8010782f:	5f                   	pop    %edi
+80107830:	5d                   	pop    %ebp
+80107831:	c3                   	ret
+80107832:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80107838:	83 ec 0c             	sub    $0xc,%esp
+8010783b:	56                   	push   %esi
+8010783c:	e8 7f ab ff ff       	call   801023c0 <iunlockput>
+    return 0;
+80107841:	83 c4 10             	add    $0x10,%esp
+}
+80107844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80107847:	31 f6                	xor    %esi,%esi
+}
+80107849:	5b                   	pop    %ebx
+8010784a:	89 f0                	mov    %esi,%eax
+8010784c:	5e                   	pop    %esi
+8010784d:	5f                   	pop    %edi
+8010784e:	5d                   	pop    %ebp
+8010784f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80107850:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80107854:	83 ec 08             	sub    $0x8,%esp
+80107857:	50                   	push   %eax
+80107858:	ff 33                	push   (%ebx)
+8010785a:	e8 31 a7 ff ff       	call   80101f90 <ialloc>
+8010785f:	83 c4 10             	add    $0x10,%esp
+80107862:	89 c6                	mov    %eax,%esi
+80107864:	85 c0                	test   %eax,%eax
+80107866:	0f 84 bc 00 00 00    	je     80107928 <create+0x168>
+  ilock(ip);
+8010786c:	83 ec 0c             	sub    $0xc,%esp
+8010786f:	50                   	push   %eax
+80107870:	e8 8b a8 ff ff       	call   80102100 <ilock>
+  ip->major = major;
+80107875:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80107879:	66 89 46 7a          	mov    %ax,0x7a(%esi)
+  ip->minor = minor;
+8010787d:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80107881:	66 89 46 7c          	mov    %ax,0x7c(%esi)
+  ip->nlink = 1;
+80107885:	b8 01 00 00 00       	mov    $0x1,%eax
+8010788a:	66 89 46 7e          	mov    %ax,0x7e(%esi)
+  iupdate(ip);
+8010788e:	89 34 24             	mov    %esi,(%esp)
+80107891:	e8 ba a7 ff ff       	call   80102050 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80107896:	83 c4 10             	add    $0x10,%esp
+80107899:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+8010789e:	74 30                	je     801078d0 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0)
+801078a0:	83 ec 04             	sub    $0x4,%esp
+801078a3:	ff 76 04             	push   0x4(%esi)
+801078a6:	57                   	push   %edi
+801078a7:	53                   	push   %ebx
+801078a8:	e8 c3 b3 ff ff       	call   80102c70 <dirlink>
+801078ad:	83 c4 10             	add    $0x10,%esp
+801078b0:	85 c0                	test   %eax,%eax
+801078b2:	78 67                	js     8010791b <create+0x15b>
+  iunlockput(dp);
+801078b4:	83 ec 0c             	sub    $0xc,%esp
+801078b7:	53                   	push   %ebx
+801078b8:	e8 03 ab ff ff       	call   801023c0 <iunlockput>
+  return ip;
+801078bd:	83 c4 10             	add    $0x10,%esp
+}
+801078c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801078c3:	89 f0                	mov    %esi,%eax
+801078c5:	5b                   	pop    %ebx
+801078c6:	5e                   	pop    %esi
+801078c7:	5f                   	pop    %edi
+801078c8:	5d                   	pop    %ebp
+801078c9:	c3                   	ret
+801078ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+801078d0:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+801078d3:	66 83 43 7e 01       	addw   $0x1,0x7e(%ebx)
+    iupdate(dp);
+801078d8:	53                   	push   %ebx
+801078d9:	e8 72 a7 ff ff       	call   80102050 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+801078de:	83 c4 0c             	add    $0xc,%esp
+801078e1:	ff 76 04             	push   0x4(%esi)
+801078e4:	68 54 ba 10 80       	push   $0x8010ba54
+801078e9:	56                   	push   %esi
+801078ea:	e8 81 b3 ff ff       	call   80102c70 <dirlink>
+801078ef:	83 c4 10             	add    $0x10,%esp
+801078f2:	85 c0                	test   %eax,%eax
+801078f4:	78 18                	js     8010790e <create+0x14e>
+801078f6:	83 ec 04             	sub    $0x4,%esp
+801078f9:	ff 73 04             	push   0x4(%ebx)
+801078fc:	68 53 ba 10 80       	push   $0x8010ba53
+80107901:	56                   	push   %esi
+80107902:	e8 69 b3 ff ff       	call   80102c70 <dirlink>
+80107907:	83 c4 10             	add    $0x10,%esp
+8010790a:	85 c0                	test   %eax,%eax
+8010790c:	79 92                	jns    801078a0 <create+0xe0>
+      panic("create dots");
+8010790e:	83 ec 0c             	sub    $0xc,%esp
+80107911:	68 47 ba 10 80       	push   $0x8010ba47
+80107916:	e8 c5 8a ff ff       	call   801003e0 <panic>
+    panic("create: dirlink");
+8010791b:	83 ec 0c             	sub    $0xc,%esp
+8010791e:	68 56 ba 10 80       	push   $0x8010ba56
+80107923:	e8 b8 8a ff ff       	call   801003e0 <panic>
+    panic("create: ialloc");
+80107928:	83 ec 0c             	sub    $0xc,%esp
+8010792b:	68 38 ba 10 80       	push   $0x8010ba38
+80107930:	e8 ab 8a ff ff       	call   801003e0 <panic>
+80107935:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010793c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107940 <argiov.constprop.0>:
+argiov(int n, int cnt, struct iovec **piov)
+80107940:	55                   	push   %ebp
+80107941:	89 e5                	mov    %esp,%ebp
+80107943:	57                   	push   %edi
+80107944:	56                   	push   %esi
+80107945:	89 d6                	mov    %edx,%esi
+80107947:	53                   	push   %ebx
+80107948:	89 c3                	mov    %eax,%ebx
+8010794a:	83 ec 2c             	sub    $0x2c,%esp
+  struct proc *curproc = myproc();
+8010794d:	e8 de d6 ff ff       	call   80105030 <myproc>
+80107952:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(cnt < 0 || cnt > MAXIOV)
+80107955:	83 fb 10             	cmp    $0x10,%ebx
+80107958:	77 50                	ja     801079aa <argiov.constprop.0+0x6a>
+  if(argptr(n, (void*)&iov, cnt*sizeof(*iov)) < 0)
+8010795a:	83 ec 04             	sub    $0x4,%esp
+8010795d:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+80107964:	50                   	push   %eax
+80107965:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80107968:	50                   	push   %eax
+80107969:	6a 01                	push   $0x1
+8010796b:	e8 40 fc ff ff       	call   801075b0 <argptr>
+80107970:	83 c4 10             	add    $0x10,%esp
+80107973:	85 c0                	test   %eax,%eax
+80107975:	78 33                	js     801079aa <argiov.constprop.0+0x6a>
+  *piov = iov;
+80107977:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  for(i = 0; i < cnt; i++){
+8010797a:	85 db                	test   %ebx,%ebx
+8010797c:	74 45                	je     801079c3 <argiov.constprop.0+0x83>
+8010797e:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80107981:	31 c0                	xor    %eax,%eax
+80107983:	eb 1a                	jmp    8010799f <argiov.constprop.0+0x5f>
+80107985:	8d 76 00             	lea    0x0(%esi),%esi
+    if(iov[i].iov_len < 0 || base >= curproc->sz ||
+80107988:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+8010798b:	8b 76 54             	mov    0x54(%esi),%esi
+8010798e:	39 f1                	cmp    %esi,%ecx
+80107990:	73 18                	jae    801079aa <argiov.constprop.0+0x6a>
+       base + iov[i].iov_len > curproc->sz)
+80107992:	01 ca                	add    %ecx,%edx
+    if(iov[i].iov_len < 0 || base >= curproc->sz ||
+80107994:	39 d6                	cmp    %edx,%esi
+80107996:	72 12                	jb     801079aa <argiov.constprop.0+0x6a>
+  for(i = 0; i < cnt; i++){
+80107998:	83 c0 01             	add    $0x1,%eax
+8010799b:	39 c3                	cmp    %eax,%ebx
+8010799d:	74 21                	je     801079c0 <argiov.constprop.0+0x80>
+    if(iov[i].iov_len < 0 || base >= curproc->sz ||
+8010799f:	8b 54 c7 04          	mov    0x4(%edi,%eax,8),%edx
+    base = (uint)iov[i].iov_base;
+801079a3:	8b 0c c7             	mov    (%edi,%eax,8),%ecx
+    if(iov[i].iov_len < 0 || base >= curproc->sz ||
+801079a6:	85 d2                	test   %edx,%edx
+801079a8:	79 de                	jns    80107988 <argiov.constprop.0+0x48>
+}
+801079aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+801079ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801079b2:	5b                   	pop    %ebx
+801079b3:	5e                   	pop    %esi
+801079b4:	5f                   	pop    %edi
+801079b5:	5d                   	pop    %ebp
+801079b6:	c3                   	ret
+801079b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801079be:	66 90                	xchg   %ax,%ax
+801079c0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+  *piov = iov;
+801079c3:	89 3e                	mov    %edi,(%esi)
+}
+801079c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801079c8:	31 c0                	xor    %eax,%eax
+}
+801079ca:	5b                   	pop    %ebx
+801079cb:	5e                   	pop    %esi
+801079cc:	5f                   	pop    %edi
+801079cd:	5d                   	pop    %ebp
+801079ce:	c3                   	ret
+801079cf:	90                   	nop
+
+801079d0 <sys_dup>:
+{
+801079d0:	55                   	push   %ebp
+801079d1:	89 e5                	mov    %esp,%ebp
+801079d3:	56                   	push   %esi
+801079d4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+801079d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801079d8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+801079db:	50                   	push   %eax
+801079dc:	6a 00                	push   $0x0
+801079de:	e8 7d fb ff ff       	call   80107560 <argint>
+801079e3:	83 c4 10             	add    $0x10,%esp
+801079e6:	85 c0                	test   %eax,%eax
+801079e8:	78 39                	js     80107a23 <sys_dup+0x53>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801079ea:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801079ee:	77 33                	ja     80107a23 <sys_dup+0x53>
+801079f0:	e8 3b d6 ff ff       	call   80105030 <myproc>
+801079f5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801079f8:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+801079ff:	85 f6                	test   %esi,%esi
+80107a01:	74 20                	je     80107a23 <sys_dup+0x53>
+  struct proc *curproc = myproc();
+80107a03:	e8 28 d6 ff ff       	call   80105030 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80107a08:	31 db                	xor    %ebx,%ebx
+80107a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd] == 0){
+80107a10:	8b 94 98 94 00 00 00 	mov    0x94(%eax,%ebx,4),%edx
+80107a17:	85 d2                	test   %edx,%edx
+80107a19:	74 1d                	je     80107a38 <sys_dup+0x68>
+  for(fd = 0; fd < NOFILE; fd++){
+80107a1b:	83 c3 01             	add    $0x1,%ebx
+80107a1e:	83 fb 10             	cmp    $0x10,%ebx
+80107a21:	75 ed                	jne    80107a10 <sys_dup+0x40>
+}
+80107a23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80107a26:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80107a2b:	89 d8                	mov    %ebx,%eax
+80107a2d:	5b                   	pop    %ebx
+80107a2e:	5e                   	pop    %esi
+80107a2f:	5d                   	pop    %ebp
+80107a30:	c3                   	ret
+80107a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  filedup(f);
+80107a38:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80107a3b:	89 b4 98 94 00 00 00 	mov    %esi,0x94(%eax,%ebx,4)
+  filedup(f);
+80107a42:	56                   	push   %esi
+80107a43:	e8 58 96 ff ff       	call   801010a0 <filedup>
+  return fd;
+80107a48:	83 c4 10             	add    $0x10,%esp
+}
+80107a4b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a4e:	89 d8                	mov    %ebx,%eax
+80107a50:	5b                   	pop    %ebx
+80107a51:	5e                   	pop    %esi
+80107a52:	5d                   	pop    %ebp
+80107a53:	c3                   	ret
+80107a54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107a5f:	90                   	nop
+
+80107a60 <sys_read>:
+{
+80107a60:	55                   	push   %ebp
+80107a61:	89 e5                	mov    %esp,%ebp
+80107a63:	56                   	push   %esi
+80107a64:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107a65:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107a68:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107a6b:	53                   	push   %ebx
+80107a6c:	6a 00                	push   $0x0
+80107a6e:	e8 ed fa ff ff       	call   80107560 <argint>
+80107a73:	83 c4 10             	add    $0x10,%esp
+80107a76:	85 c0                	test   %eax,%eax
+80107a78:	78 66                	js     80107ae0 <sys_read+0x80>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107a7a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107a7e:	77 60                	ja     80107ae0 <sys_read+0x80>
+80107a80:	e8 ab d5 ff ff       	call   80105030 <myproc>
+80107a85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107a88:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107a8f:	85 f6                	test   %esi,%esi
+80107a91:	74 4d                	je     80107ae0 <sys_read+0x80>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107a93:	83 ec 08             	sub    $0x8,%esp
+80107a96:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107a99:	50                   	push   %eax
+80107a9a:	6a 02                	push   $0x2
+80107a9c:	e8 bf fa ff ff       	call   80107560 <argint>
+80107aa1:	83 c4 10             	add    $0x10,%esp
+80107aa4:	85 c0                	test   %eax,%eax
+80107aa6:	78 38                	js     80107ae0 <sys_read+0x80>
+80107aa8:	83 ec 04             	sub    $0x4,%esp
+80107aab:	ff 75 f0             	push   -0x10(%ebp)
+80107aae:	53                   	push   %ebx
+80107aaf:	6a 01                	push   $0x1
+80107ab1:	e8 fa fa ff ff       	call   801075b0 <argptr>
+80107ab6:	83 c4 10             	add    $0x10,%esp
+80107ab9:	85 c0                	test   %eax,%eax
+80107abb:	78 23                	js     80107ae0 <sys_read+0x80>
+  return fileread(f, p, n);
+80107abd:	83 ec 04             	sub    $0x4,%esp
+80107ac0:	ff 75 f0             	push   -0x10(%ebp)
+80107ac3:	ff 75 f4             	push   -0xc(%ebp)
+80107ac6:	56                   	push   %esi
+80107ac7:	e8 24 97 ff ff       	call   801011f0 <fileread>
+80107acc:	83 c4 10             	add    $0x10,%esp
+}
+80107acf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ad2:	5b                   	pop    %ebx
+80107ad3:	5e                   	pop    %esi
+80107ad4:	5d                   	pop    %ebp
+80107ad5:	c3                   	ret
+80107ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107add:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107ae0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ae5:	eb e8                	jmp    80107acf <sys_read+0x6f>
+80107ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107aee:	66 90                	xchg   %ax,%ax
+
+80107af0 <sys_write>:
+{
+80107af0:	55                   	push   %ebp
+80107af1:	89 e5                	mov    %esp,%ebp
+80107af3:	56                   	push   %esi
+80107af4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107af5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107af8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107afb:	53                   	push   %ebx
+80107afc:	6a 00                	push   $0x0
+80107afe:	e8 5d fa ff ff       	call   80107560 <argint>
+80107b03:	83 c4 10             	add    $0x10,%esp
+80107b06:	85 c0                	test   %eax,%eax
+80107b08:	78 66                	js     80107b70 <sys_write+0x80>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107b0a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107b0e:	77 60                	ja     80107b70 <sys_write+0x80>
+80107b10:	e8 1b d5 ff ff       	call   80105030 <myproc>
+80107b15:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107b18:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107b1f:	85 f6                	test   %esi,%esi
+80107b21:	74 4d                	je     80107b70 <sys_write+0x80>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107b23:	83 ec 08             	sub    $0x8,%esp
+80107b26:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107b29:	50                   	push   %eax
+80107b2a:	6a 02                	push   $0x2
+80107b2c:	e8 2f fa ff ff       	call   80107560 <argint>
+80107b31:	83 c4 10             	add    $0x10,%esp
+80107b34:	85 c0                	test   %eax,%eax
+80107b36:	78 38                	js     80107b70 <sys_write+0x80>
+80107b38:	83 ec 04             	sub    $0x4,%esp
+80107b3b:	ff 75 f0             	push   -0x10(%ebp)
+80107b3e:	53                   	push   %ebx
+80107b3f:	6a 01                	push   $0x1
+80107b41:	e8 6a fa ff ff       	call   801075b0 <argptr>
+80107b46:	83 c4 10             	add    $0x10,%esp
+80107b49:	85 c0                	test   %eax,%eax
+80107b4b:	78 23                	js     80107b70 <sys_write+0x80>
+  return filewrite(f, p, n);
+80107b4d:	83 ec 04             	sub    $0x4,%esp
+80107b50:	ff 75 f0             	push   -0x10(%ebp)
+80107b53:	ff 75 f4             	push   -0xc(%ebp)
+80107b56:	56                   	push   %esi
+80107b57:	e8 e4 98 ff ff       	call   80101440 <filewrite>
+80107b5c:	83 c4 10             	add    $0x10,%esp
+}
+80107b5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107b62:	5b                   	pop    %ebx
+80107b63:	5e                   	pop    %esi
+80107b64:	5d                   	pop    %ebp
+80107b65:	c3                   	ret
+80107b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b6d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107b70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107b75:	eb e8                	jmp    80107b5f <sys_write+0x6f>
+80107b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b7e:	66 90                	xchg   %ax,%ax
+
+80107b80 <sys_pread>:
+{
+80107b80:	55                   	push   %ebp
+80107b81:	89 e5                	mov    %esp,%ebp
+80107b83:	56                   	push   %esi
+80107b84:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107b85:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107b88:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107b8b:	53                   	push   %ebx
+80107b8c:	6a 00                	push   $0x0
+80107b8e:	e8 cd f9 ff ff       	call   80107560 <argint>
+80107b93:	83 c4 10             	add    $0x10,%esp
+80107b96:	85 c0                	test   %eax,%eax
+80107b98:	78 76                	js     80107c10 <sys_pread+0x90>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107b9a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107b9e:	77 70                	ja     80107c10 <sys_pread+0x90>
+80107ba0:	e8 8b d4 ff ff       	call   80105030 <myproc>
+80107ba5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107ba8:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107baf:	85 f6                	test   %esi,%esi
+80107bb1:	74 5d                	je     80107c10 <sys_pread+0x90>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+80107bb3:	83 ec 08             	sub    $0x8,%esp
+80107bb6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80107bb9:	50                   	push   %eax
+80107bba:	6a 02                	push   $0x2
+80107bbc:	e8 9f f9 ff ff       	call   80107560 <argint>
+80107bc1:	83 c4 10             	add    $0x10,%esp
+80107bc4:	85 c0                	test   %eax,%eax
+80107bc6:	78 48                	js     80107c10 <sys_pread+0x90>
+80107bc8:	83 ec 04             	sub    $0x4,%esp
+80107bcb:	ff 75 ec             	push   -0x14(%ebp)
+80107bce:	53                   	push   %ebx
+80107bcf:	6a 01                	push   $0x1
+80107bd1:	e8 da f9 ff ff       	call   801075b0 <argptr>
+80107bd6:	83 c4 10             	add    $0x10,%esp
+80107bd9:	85 c0                	test   %eax,%eax
+80107bdb:	78 33                	js     80107c10 <sys_pread+0x90>
+     argint(3, &off) < 0 || off < 0)
+80107bdd:	83 ec 08             	sub    $0x8,%esp
+80107be0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107be3:	50                   	push   %eax
+80107be4:	6a 03                	push   $0x3
+80107be6:	e8 75 f9 ff ff       	call   80107560 <argint>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+80107beb:	83 c4 10             	add    $0x10,%esp
+80107bee:	85 c0                	test   %eax,%eax
+80107bf0:	78 1e                	js     80107c10 <sys_pread+0x90>
+     argint(3, &off) < 0 || off < 0)
+80107bf2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80107bf5:	85 c0                	test   %eax,%eax
+80107bf7:	78 17                	js     80107c10 <sys_pread+0x90>
+  return filepread(f, p, n, off);
+80107bf9:	50                   	push   %eax
+80107bfa:	ff 75 ec             	push   -0x14(%ebp)
+80107bfd:	ff 75 f4             	push   -0xc(%ebp)
+80107c00:	56                   	push   %esi
+80107c01:	e8 7a 96 ff ff       	call   80101280 <filepread>
+80107c06:	83 c4 10             	add    $0x10,%esp
+}
+80107c09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c0c:	5b                   	pop    %ebx
+80107c0d:	5e                   	pop    %esi
+80107c0e:	5d                   	pop    %ebp
+80107c0f:	c3                   	ret
+    return -1;
+80107c10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107c15:	eb f2                	jmp    80107c09 <sys_pread+0x89>
+80107c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c1e:	66 90                	xchg   %ax,%ax
+
+80107c20 <sys_pwrite>:
+{
+80107c20:	55                   	push   %ebp
+80107c21:	89 e5                	mov    %esp,%ebp
+80107c23:	56                   	push   %esi
+80107c24:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107c25:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107c28:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107c2b:	53                   	push   %ebx
+80107c2c:	6a 00                	push   $0x0
+80107c2e:	e8 2d f9 ff ff       	call   80107560 <argint>
+80107c33:	83 c4 10             	add    $0x10,%esp
+80107c36:	85 c0                	test   %eax,%eax
+80107c38:	78 76                	js     80107cb0 <sys_pwrite+0x90>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107c3a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107c3e:	77 70                	ja     80107cb0 <sys_pwrite+0x90>
+80107c40:	e8 eb d3 ff ff       	call   80105030 <myproc>
+80107c45:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107c48:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107c4f:	85 f6                	test   %esi,%esi
+80107c51:	74 5d                	je     80107cb0 <sys_pwrite+0x90>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+80107c53:	83 ec 08             	sub    $0x8,%esp
+80107c56:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80107c59:	50                   	push   %eax
+80107c5a:	6a 02                	push   $0x2
+80107c5c:	e8 ff f8 ff ff       	call   80107560 <argint>
+80107c61:	83 c4 10             	add    $0x10,%esp
+80107c64:	85 c0                	test   %eax,%eax
+80107c66:	78 48                	js     80107cb0 <sys_pwrite+0x90>
+80107c68:	83 ec 04             	sub    $0x4,%esp
+80107c6b:	ff 75 ec             	push   -0x14(%ebp)
+80107c6e:	53                   	push   %ebx
+80107c6f:	6a 01                	push   $0x1
+80107c71:	e8 3a f9 ff ff       	call   801075b0 <argptr>
+80107c76:	83 c4 10             	add    $0x10,%esp
+80107c79:	85 c0                	test   %eax,%eax
+80107c7b:	78 33                	js     80107cb0 <sys_pwrite+0x90>
+     argint(3, &off) < 0 || off < 0)
+80107c7d:	83 ec 08             	sub    $0x8,%esp
+80107c80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107c83:	50                   	push   %eax
+80107c84:	6a 03                	push   $0x3
+80107c86:	e8 d5 f8 ff ff       	call   80107560 <argint>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+80107c8b:	83 c4 10             	add    $0x10,%esp
+80107c8e:	85 c0                	test   %eax,%eax
+80107c90:	78 1e                	js     80107cb0 <sys_pwrite+0x90>
+     argint(3, &off) < 0 || off < 0)
+80107c92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80107c95:	85 c0                	test   %eax,%eax
+80107c97:	78 17                	js     80107cb0 <sys_pwrite+0x90>
+  return filepwrite(f, p, n, off);
+80107c99:	50                   	push   %eax
+80107c9a:	ff 75 ec             	push   -0x14(%ebp)
+80107c9d:	ff 75 f4             	push   -0xc(%ebp)
+80107ca0:	56                   	push   %esi
+80107ca1:	e8 0a 98 ff ff       	call   801014b0 <filepwrite>
+80107ca6:	83 c4 10             	add    $0x10,%esp
+}
+80107ca9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107cac:	5b                   	pop    %ebx
+80107cad:	5e                   	pop    %esi
+80107cae:	5d                   	pop    %ebp
+80107caf:	c3                   	ret
+    return -1;
+80107cb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107cb5:	eb f2                	jmp    80107ca9 <sys_pwrite+0x89>
+80107cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cbe:	66 90                	xchg   %ax,%ax
+
+80107cc0 <sys_readv>:
+{
+80107cc0:	55                   	push   %ebp
+80107cc1:	89 e5                	mov    %esp,%ebp
+80107cc3:	56                   	push   %esi
+80107cc4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107cc5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107cc8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107ccb:	53                   	push   %ebx
+80107ccc:	6a 00                	push   $0x0
+80107cce:	e8 8d f8 ff ff       	call   80107560 <argint>
+80107cd3:	83 c4 10             	add    $0x10,%esp
+80107cd6:	85 c0                	test   %eax,%eax
+80107cd8:	78 56                	js     80107d30 <sys_readv+0x70>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107cda:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107cde:	77 50                	ja     80107d30 <sys_readv+0x70>
+80107ce0:	e8 4b d3 ff ff       	call   80105030 <myproc>
+80107ce5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107ce8:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107cef:	85 f6                	test   %esi,%esi
+80107cf1:	74 3d                	je     80107d30 <sys_readv+0x70>
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, &iov) < 0)
+80107cf3:	83 ec 08             	sub    $0x8,%esp
+80107cf6:	53                   	push   %ebx
+80107cf7:	6a 02                	push   $0x2
+80107cf9:	e8 62 f8 ff ff       	call   80107560 <argint>
+80107cfe:	83 c4 10             	add    $0x10,%esp
+80107d01:	85 c0                	test   %eax,%eax
+80107d03:	78 2b                	js     80107d30 <sys_readv+0x70>
+80107d05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80107d08:	8d 55 f0             	lea    -0x10(%ebp),%edx
+80107d0b:	e8 30 fc ff ff       	call   80107940 <argiov.constprop.0>
+80107d10:	85 c0                	test   %eax,%eax
+80107d12:	78 1c                	js     80107d30 <sys_readv+0x70>
+  return filereadv(f, iov, cnt);
+80107d14:	83 ec 04             	sub    $0x4,%esp
+80107d17:	ff 75 f4             	push   -0xc(%ebp)
+80107d1a:	ff 75 f0             	push   -0x10(%ebp)
+80107d1d:	56                   	push   %esi
+80107d1e:	e8 bd 95 ff ff       	call   801012e0 <filereadv>
+80107d23:	83 c4 10             	add    $0x10,%esp
+}
+80107d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d29:	5b                   	pop    %ebx
+80107d2a:	5e                   	pop    %esi
+80107d2b:	5d                   	pop    %ebp
+80107d2c:	c3                   	ret
+80107d2d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107d30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d35:	eb ef                	jmp    80107d26 <sys_readv+0x66>
+80107d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d3e:	66 90                	xchg   %ax,%ax
+
+80107d40 <sys_writev>:
+{
+80107d40:	55                   	push   %ebp
+80107d41:	89 e5                	mov    %esp,%ebp
+80107d43:	56                   	push   %esi
+80107d44:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107d45:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107d48:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107d4b:	53                   	push   %ebx
+80107d4c:	6a 00                	push   $0x0
+80107d4e:	e8 0d f8 ff ff       	call   80107560 <argint>
+80107d53:	83 c4 10             	add    $0x10,%esp
+80107d56:	85 c0                	test   %eax,%eax
+80107d58:	78 56                	js     80107db0 <sys_writev+0x70>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107d5a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107d5e:	77 50                	ja     80107db0 <sys_writev+0x70>
+80107d60:	e8 cb d2 ff ff       	call   80105030 <myproc>
+80107d65:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107d68:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107d6f:	85 f6                	test   %esi,%esi
+80107d71:	74 3d                	je     80107db0 <sys_writev+0x70>
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, &iov) < 0)
+80107d73:	83 ec 08             	sub    $0x8,%esp
+80107d76:	53                   	push   %ebx
+80107d77:	6a 02                	push   $0x2
+80107d79:	e8 e2 f7 ff ff       	call   80107560 <argint>
+80107d7e:	83 c4 10             	add    $0x10,%esp
+80107d81:	85 c0                	test   %eax,%eax
+80107d83:	78 2b                	js     80107db0 <sys_writev+0x70>
+80107d85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80107d88:	8d 55 f0             	lea    -0x10(%ebp),%edx
+80107d8b:	e8 b0 fb ff ff       	call   80107940 <argiov.constprop.0>
+80107d90:	85 c0                	test   %eax,%eax
+80107d92:	78 1c                	js     80107db0 <sys_writev+0x70>
+  return filewritev(f, iov, cnt);
+80107d94:	83 ec 04             	sub    $0x4,%esp
+80107d97:	ff 75 f4             	push   -0xc(%ebp)
+80107d9a:	ff 75 f0             	push   -0x10(%ebp)
+80107d9d:	56                   	push   %esi
+80107d9e:	e8 4d 97 ff ff       	call   801014f0 <filewritev>
+80107da3:	83 c4 10             	add    $0x10,%esp
+}
+80107da6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107da9:	5b                   	pop    %ebx
+80107daa:	5e                   	pop    %esi
+80107dab:	5d                   	pop    %ebp
+80107dac:	c3                   	ret
+80107dad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107db0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107db5:	eb ef                	jmp    80107da6 <sys_writev+0x66>
+80107db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dbe:	66 90                	xchg   %ax,%ax
+
+80107dc0 <sys_splice>:
+{
+80107dc0:	55                   	push   %ebp
+80107dc1:	89 e5                	mov    %esp,%ebp
+80107dc3:	57                   	push   %edi
+80107dc4:	56                   	push   %esi
+80107dc5:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107dc6:	8d 5d e4             	lea    -0x1c(%ebp),%ebx
+{
+80107dc9:	83 ec 24             	sub    $0x24,%esp
+  if(argint(n, &fd) < 0)
+80107dcc:	53                   	push   %ebx
+80107dcd:	6a 00                	push   $0x0
+80107dcf:	e8 8c f7 ff ff       	call   80107560 <argint>
+80107dd4:	83 c4 10             	add    $0x10,%esp
+80107dd7:	85 c0                	test   %eax,%eax
+80107dd9:	78 75                	js     80107e50 <sys_splice+0x90>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107ddb:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+80107ddf:	77 6f                	ja     80107e50 <sys_splice+0x90>
+80107de1:	e8 4a d2 ff ff       	call   80105030 <myproc>
+80107de6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107de9:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107df0:	85 f6                	test   %esi,%esi
+80107df2:	74 5c                	je     80107e50 <sys_splice+0x90>
+  if(argint(n, &fd) < 0)
+80107df4:	83 ec 08             	sub    $0x8,%esp
+80107df7:	53                   	push   %ebx
+80107df8:	6a 01                	push   $0x1
+80107dfa:	e8 61 f7 ff ff       	call   80107560 <argint>
+80107dff:	83 c4 10             	add    $0x10,%esp
+80107e02:	85 c0                	test   %eax,%eax
+80107e04:	78 4a                	js     80107e50 <sys_splice+0x90>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107e06:	83 7d e4 0f          	cmpl   $0xf,-0x1c(%ebp)
+80107e0a:	77 44                	ja     80107e50 <sys_splice+0x90>
+80107e0c:	e8 1f d2 ff ff       	call   80105030 <myproc>
+80107e11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107e14:	8b bc 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%edi
+80107e1b:	85 ff                	test   %edi,%edi
+80107e1d:	74 31                	je     80107e50 <sys_splice+0x90>
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0 || n < 0)
+80107e1f:	83 ec 08             	sub    $0x8,%esp
+80107e22:	53                   	push   %ebx
+80107e23:	6a 02                	push   $0x2
+80107e25:	e8 36 f7 ff ff       	call   80107560 <argint>
+80107e2a:	83 c4 10             	add    $0x10,%esp
+80107e2d:	85 c0                	test   %eax,%eax
+80107e2f:	78 1f                	js     80107e50 <sys_splice+0x90>
+80107e31:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107e34:	85 c0                	test   %eax,%eax
+80107e36:	78 18                	js     80107e50 <sys_splice+0x90>
+  return filesplice(in, out, n);
+80107e38:	83 ec 04             	sub    $0x4,%esp
+80107e3b:	50                   	push   %eax
+80107e3c:	57                   	push   %edi
+80107e3d:	56                   	push   %esi
+80107e3e:	e8 5d 97 ff ff       	call   801015a0 <filesplice>
+80107e43:	83 c4 10             	add    $0x10,%esp
+}
+80107e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e49:	5b                   	pop    %ebx
+80107e4a:	5e                   	pop    %esi
+80107e4b:	5f                   	pop    %edi
+80107e4c:	5d                   	pop    %ebp
+80107e4d:	c3                   	ret
+80107e4e:	66 90                	xchg   %ax,%ax
+    return -1;
+80107e50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e55:	eb ef                	jmp    80107e46 <sys_splice+0x86>
+80107e57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107e5e:	66 90                	xchg   %ax,%ax
+
+80107e60 <sys_close>:
+{
+80107e60:	55                   	push   %ebp
+80107e61:	89 e5                	mov    %esp,%ebp
+80107e63:	56                   	push   %esi
+80107e64:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107e65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80107e68:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107e6b:	50                   	push   %eax
+80107e6c:	6a 00                	push   $0x0
+80107e6e:	e8 ed f6 ff ff       	call   80107560 <argint>
+80107e73:	83 c4 10             	add    $0x10,%esp
+80107e76:	85 c0                	test   %eax,%eax
+80107e78:	78 3e                	js     80107eb8 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107e7a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107e7e:	77 38                	ja     80107eb8 <sys_close+0x58>
+80107e80:	e8 ab d1 ff ff       	call   80105030 <myproc>
+80107e85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107e88:	8d 5a 24             	lea    0x24(%edx),%ebx
+80107e8b:	8b 74 98 04          	mov    0x4(%eax,%ebx,4),%esi
+80107e8f:	85 f6                	test   %esi,%esi
+80107e91:	74 25                	je     80107eb8 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80107e93:	e8 98 d1 ff ff       	call   80105030 <myproc>
+  fileclose(f);
+80107e98:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+80107e9b:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+80107ea2:	00 
+  fileclose(f);
+80107ea3:	56                   	push   %esi
+80107ea4:	e8 27 92 ff ff       	call   801010d0 <fileclose>
+  return 0;
+80107ea9:	83 c4 10             	add    $0x10,%esp
+80107eac:	31 c0                	xor    %eax,%eax
+}
+80107eae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107eb1:	5b                   	pop    %ebx
+80107eb2:	5e                   	pop    %esi
+80107eb3:	5d                   	pop    %ebp
+80107eb4:	c3                   	ret
+80107eb5:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107eb8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ebd:	eb ef                	jmp    80107eae <sys_close+0x4e>
+80107ebf:	90                   	nop
+
+80107ec0 <sys_fallocate>:
+{
+80107ec0:	55                   	push   %ebp
+80107ec1:	89 e5                	mov    %esp,%ebp
+80107ec3:	56                   	push   %esi
+80107ec4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107ec5:	8d 75 f4             	lea    -0xc(%ebp),%esi
+{
+80107ec8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107ecb:	56                   	push   %esi
+80107ecc:	6a 00                	push   $0x0
+80107ece:	e8 8d f6 ff ff       	call   80107560 <argint>
+80107ed3:	83 c4 10             	add    $0x10,%esp
+80107ed6:	85 c0                	test   %eax,%eax
+80107ed8:	0f 88 9a 00 00 00    	js     80107f78 <sys_fallocate+0xb8>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107ede:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107ee2:	0f 87 90 00 00 00    	ja     80107f78 <sys_fallocate+0xb8>
+80107ee8:	e8 43 d1 ff ff       	call   80105030 <myproc>
+80107eed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107ef0:	8b 9c 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%ebx
+80107ef7:	85 db                	test   %ebx,%ebx
+80107ef9:	74 7d                	je     80107f78 <sys_fallocate+0xb8>
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0)
+80107efb:	83 ec 08             	sub    $0x8,%esp
+80107efe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107f01:	50                   	push   %eax
+80107f02:	6a 01                	push   $0x1
+80107f04:	e8 57 f6 ff ff       	call   80107560 <argint>
+80107f09:	83 c4 10             	add    $0x10,%esp
+80107f0c:	85 c0                	test   %eax,%eax
+80107f0e:	78 68                	js     80107f78 <sys_fallocate+0xb8>
+80107f10:	83 ec 08             	sub    $0x8,%esp
+80107f13:	56                   	push   %esi
+80107f14:	6a 02                	push   $0x2
+80107f16:	e8 45 f6 ff ff       	call   80107560 <argint>
+  if(off < 0 || len <= 0 || f->type != FD_INODE || f->writable == 0)
+80107f1b:	83 c4 10             	add    $0x10,%esp
+80107f1e:	0b 45 f0             	or     -0x10(%ebp),%eax
+80107f21:	78 55                	js     80107f78 <sys_fallocate+0xb8>
+80107f23:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107f26:	85 d2                	test   %edx,%edx
+80107f28:	7e 4e                	jle    80107f78 <sys_fallocate+0xb8>
+80107f2a:	83 3b 02             	cmpl   $0x2,(%ebx)
+80107f2d:	75 49                	jne    80107f78 <sys_fallocate+0xb8>
+80107f2f:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+80107f33:	74 43                	je     80107f78 <sys_fallocate+0xb8>
+  begin_op();
+80107f35:	e8 56 bc ff ff       	call   80103b90 <begin_op>
+  ilock(f->ip);
+80107f3a:	83 ec 0c             	sub    $0xc,%esp
+80107f3d:	ff 73 10             	push   0x10(%ebx)
+80107f40:	e8 bb a1 ff ff       	call   80102100 <ilock>
+  r = reservei(f->ip, off, len);
+80107f45:	83 c4 0c             	add    $0xc,%esp
+80107f48:	ff 75 f4             	push   -0xc(%ebp)
+80107f4b:	ff 75 f0             	push   -0x10(%ebp)
+80107f4e:	ff 73 10             	push   0x10(%ebx)
+80107f51:	e8 1a a9 ff ff       	call   80102870 <reservei>
+80107f56:	89 c6                	mov    %eax,%esi
+  iunlock(f->ip);
+80107f58:	58                   	pop    %eax
+80107f59:	ff 73 10             	push   0x10(%ebx)
+80107f5c:	e8 7f a2 ff ff       	call   801021e0 <iunlock>
+  end_op();
+80107f61:	e8 9a bc ff ff       	call   80103c00 <end_op>
+  return r;
+80107f66:	83 c4 10             	add    $0x10,%esp
+}
+80107f69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107f6c:	89 f0                	mov    %esi,%eax
+80107f6e:	5b                   	pop    %ebx
+80107f6f:	5e                   	pop    %esi
+80107f70:	5d                   	pop    %ebp
+80107f71:	c3                   	ret
+80107f72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80107f78:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80107f7d:	eb ea                	jmp    80107f69 <sys_fallocate+0xa9>
+80107f7f:	90                   	nop
+
+80107f80 <sys_fstat>:
+{
+80107f80:	55                   	push   %ebp
+80107f81:	89 e5                	mov    %esp,%ebp
+80107f83:	56                   	push   %esi
+80107f84:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107f85:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107f88:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107f8b:	53                   	push   %ebx
+80107f8c:	6a 00                	push   $0x0
+80107f8e:	e8 cd f5 ff ff       	call   80107560 <argint>
+80107f93:	83 c4 10             	add    $0x10,%esp
+80107f96:	85 c0                	test   %eax,%eax
+80107f98:	78 46                	js     80107fe0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107f9a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107f9e:	77 40                	ja     80107fe0 <sys_fstat+0x60>
+80107fa0:	e8 8b d0 ff ff       	call   80105030 <myproc>
+80107fa5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107fa8:	8b b4 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%esi
+80107faf:	85 f6                	test   %esi,%esi
+80107fb1:	74 2d                	je     80107fe0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80107fb3:	83 ec 04             	sub    $0x4,%esp
+80107fb6:	6a 14                	push   $0x14
+80107fb8:	53                   	push   %ebx
+80107fb9:	6a 01                	push   $0x1
+80107fbb:	e8 f0 f5 ff ff       	call   801075b0 <argptr>
+80107fc0:	83 c4 10             	add    $0x10,%esp
+80107fc3:	85 c0                	test   %eax,%eax
+80107fc5:	78 19                	js     80107fe0 <sys_fstat+0x60>
+  return filestat(f, st);
+80107fc7:	83 ec 08             	sub    $0x8,%esp
+80107fca:	ff 75 f4             	push   -0xc(%ebp)
+80107fcd:	56                   	push   %esi
+80107fce:	e8 cd 91 ff ff       	call   801011a0 <filestat>
+80107fd3:	83 c4 10             	add    $0x10,%esp
+}
+80107fd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107fd9:	5b                   	pop    %ebx
+80107fda:	5e                   	pop    %esi
+80107fdb:	5d                   	pop    %ebp
+80107fdc:	c3                   	ret
+80107fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107fe0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107fe5:	eb ef                	jmp    80107fd6 <sys_fstat+0x56>
+80107fe7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107fee:	66 90                	xchg   %ax,%ax
+
+80107ff0 <sys_link>:
+{
+80107ff0:	55                   	push   %ebp
+80107ff1:	89 e5                	mov    %esp,%ebp
+80107ff3:	57                   	push   %edi
+80107ff4:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107ff5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80107ff8:	53                   	push   %ebx
+80107ff9:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107ffc:	50                   	push   %eax
+80107ffd:	6a 00                	push   $0x0
+80107fff:	e8 9c f6 ff ff       	call   801076a0 <argstr>
+80108004:	83 c4 10             	add    $0x10,%esp
+80108007:	85 c0                	test   %eax,%eax
+80108009:	0f 88 fb 00 00 00    	js     8010810a <sys_link+0x11a>
+8010800f:	83 ec 08             	sub    $0x8,%esp
+80108012:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80108015:	50                   	push   %eax
+80108016:	6a 01                	push   $0x1
+80108018:	e8 83 f6 ff ff       	call   801076a0 <argstr>
+8010801d:	83 c4 10             	add    $0x10,%esp
+80108020:	85 c0                	test   %eax,%eax
+80108022:	0f 88 e2 00 00 00    	js     8010810a <sys_link+0x11a>
+  begin_op();
+80108028:	e8 63 bb ff ff       	call   80103b90 <begin_op>
+  if((ip = namei(old)) == 0){
+8010802d:	83 ec 0c             	sub    $0xc,%esp
+80108030:	ff 75 d4             	push   -0x2c(%ebp)
+80108033:	e8 f8 ac ff ff       	call   80102d30 <namei>
+80108038:	83 c4 10             	add    $0x10,%esp
+8010803b:	89 c3                	mov    %eax,%ebx
+8010803d:	85 c0                	test   %eax,%eax
+8010803f:	0f 84 df 00 00 00    	je     80108124 <sys_link+0x134>
+  ilock(ip);
+80108045:	83 ec 0c             	sub    $0xc,%esp
+80108048:	50                   	push   %eax
+80108049:	e8 b2 a0 ff ff       	call   80102100 <ilock>
+  if(ip->type == T_DIR){
+8010804e:	83 c4 10             	add    $0x10,%esp
+80108051:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80108056:	0f 84 b5 00 00 00    	je     80108111 <sys_link+0x121>
+  iupdate(ip);
+8010805c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+8010805f:	66 83 43 7e 01       	addw   $0x1,0x7e(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80108064:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80108067:	53                   	push   %ebx
+80108068:	e8 e3 9f ff ff       	call   80102050 <iupdate>
+  iunlock(ip);
+8010806d:	89 1c 24             	mov    %ebx,(%esp)
+80108070:	e8 6b a1 ff ff       	call   801021e0 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80108075:	58                   	pop    %eax
+80108076:	5a                   	pop    %edx
+80108077:	57                   	push   %edi
+80108078:	ff 75 d0             	push   -0x30(%ebp)
+8010807b:	e8 d0 ac ff ff       	call   80102d50 <nameiparent>
+80108080:	83 c4 10             	add    $0x10,%esp
+80108083:	89 c6                	mov    %eax,%esi
+80108085:	85 c0                	test   %eax,%eax
+80108087:	74 5b                	je     801080e4 <sys_link+0xf4>
+  ilock(dp);
+80108089:	83 ec 0c             	sub    $0xc,%esp
+8010808c:	50                   	push   %eax
+8010808d:	e8 6e a0 ff ff       	call   80102100 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80108092:	8b 03                	mov    (%ebx),%eax
+80108094:	83 c4 10             	add    $0x10,%esp
+80108097:	39 06                	cmp    %eax,(%esi)
+80108099:	75 3d                	jne    801080d8 <sys_link+0xe8>
+8010809b:	83 ec 04             	sub    $0x4,%esp
+8010809e:	ff 73 04             	push   0x4(%ebx)
+801080a1:	57                   	push   %edi
+801080a2:	56                   	push   %esi
+801080a3:	e8 c8 ab ff ff       	call   80102c70 <dirlink>
+801080a8:	83 c4 10             	add    $0x10,%esp
+801080ab:	85 c0                	test   %eax,%eax
+801080ad:	78 29                	js     801080d8 <sys_link+0xe8>
+  iunlockput(dp);
+801080af:	83 ec 0c             	sub    $0xc,%esp
+801080b2:	56                   	push   %esi
+801080b3:	e8 08 a3 ff ff       	call   801023c0 <iunlockput>
+  iput(ip);
+801080b8:	89 1c 24             	mov    %ebx,(%esp)
+801080bb:	e8 70 a1 ff ff       	call   80102230 <iput>
+  end_op();
+801080c0:	e8 3b bb ff ff       	call   80103c00 <end_op>
+  return 0;
+801080c5:	83 c4 10             	add    $0x10,%esp
+801080c8:	31 c0                	xor    %eax,%eax
+}
+801080ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801080cd:	5b                   	pop    %ebx
+801080ce:	5e                   	pop    %esi
+801080cf:	5f                   	pop    %edi
+801080d0:	5d                   	pop    %ebp
+801080d1:	c3                   	ret
+801080d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+801080d8:	83 ec 0c             	sub    $0xc,%esp
+801080db:	56                   	push   %esi
+801080dc:	e8 df a2 ff ff       	call   801023c0 <iunlockput>
+    goto bad;
+801080e1:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+801080e4:	83 ec 0c             	sub    $0xc,%esp
+801080e7:	53                   	push   %ebx
+801080e8:	e8 13 a0 ff ff       	call   80102100 <ilock>
+  ip->nlink--;
+801080ed:	66 83 6b 7e 01       	subw   $0x1,0x7e(%ebx)
+  iupdate(ip);
+801080f2:	89 1c 24             	mov    %ebx,(%esp)
+801080f5:	e8 56 9f ff ff       	call   80102050 <iupdate>
+  iunlockput(ip);
+801080fa:	89 1c 24             	mov    %ebx,(%esp)
+801080fd:	e8 be a2 ff ff       	call   801023c0 <iunlockput>
+  end_op();
+80108102:	e8 f9 ba ff ff       	call   80103c00 <end_op>
+  return -1;
+80108107:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010810a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010810f:	eb b9                	jmp    801080ca <sys_link+0xda>
+    iunlockput(ip);
+80108111:	83 ec 0c             	sub    $0xc,%esp
+80108114:	53                   	push   %ebx
+80108115:	e8 a6 a2 ff ff       	call   801023c0 <iunlockput>
+    end_op();
+8010811a:	e8 e1 ba ff ff       	call   80103c00 <end_op>
+    return -1;
+8010811f:	83 c4 10             	add    $0x10,%esp
+80108122:	eb e6                	jmp    8010810a <sys_link+0x11a>
+    end_op();
+80108124:	e8 d7 ba ff ff       	call   80103c00 <end_op>
+    return -1;
+80108129:	eb df                	jmp    8010810a <sys_link+0x11a>
+8010812b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010812f:	90                   	nop
+
+80108130 <sys_unlink>:
+{
+80108130:	55                   	push   %ebp
+80108131:	89 e5                	mov    %esp,%ebp
+80108133:	57                   	push   %edi
+80108134:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80108135:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80108138:	53                   	push   %ebx
+80108139:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+8010813c:	50                   	push   %eax
+8010813d:	6a 00                	push   $0x0
+8010813f:	e8 5c f5 ff ff       	call   801076a0 <argstr>
+80108144:	83 c4 10             	add    $0x10,%esp
+80108147:	85 c0                	test   %eax,%eax
+80108149:	0f 88 5c 01 00 00    	js     801082ab <sys_unlink+0x17b>
+  begin_op();
+8010814f:	e8 3c ba ff ff       	call   80103b90 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108154:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80108157:	83 ec 08             	sub    $0x8,%esp
+8010815a:	53                   	push   %ebx
+8010815b:	ff 75 c0             	push   -0x40(%ebp)
+8010815e:	e8 ed ab ff ff       	call   80102d50 <nameiparent>
+80108163:	83 c4 10             	add    $0x10,%esp
+80108166:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80108169:	85 c0                	test   %eax,%eax
+8010816b:	0f 84 60 01 00 00    	je     801082d1 <sys_unlink+0x1a1>
+  ilock(dp);
+80108171:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80108174:	83 ec 0c             	sub    $0xc,%esp
+80108177:	57                   	push   %edi
+80108178:	e8 83 9f ff ff       	call   80102100 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+8010817d:	58                   	pop    %eax
+8010817e:	5a                   	pop    %edx
+8010817f:	68 54 ba 10 80       	push   $0x8010ba54
+80108184:	53                   	push   %ebx
+80108185:	e8 b6 a7 ff ff       	call   80102940 <namecmp>
+8010818a:	83 c4 10             	add    $0x10,%esp
+8010818d:	85 c0                	test   %eax,%eax
+8010818f:	0f 84 03 01 00 00    	je     80108298 <sys_unlink+0x168>
+80108195:	83 ec 08             	sub    $0x8,%esp
+80108198:	68 53 ba 10 80       	push   $0x8010ba53
+8010819d:	53                   	push   %ebx
+8010819e:	e8 9d a7 ff ff       	call   80102940 <namecmp>
+801081a3:	83 c4 10             	add    $0x10,%esp
+801081a6:	85 c0                	test   %eax,%eax
+801081a8:	0f 84 ea 00 00 00    	je     80108298 <sys_unlink+0x168>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801081ae:	83 ec 04             	sub    $0x4,%esp
+801081b1:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+801081b4:	50                   	push   %eax
+801081b5:	53                   	push   %ebx
+801081b6:	57                   	push   %edi
+801081b7:	e8 a4 a7 ff ff       	call   80102960 <dirlookup>
+801081bc:	83 c4 10             	add    $0x10,%esp
+801081bf:	89 c3                	mov    %eax,%ebx
+801081c1:	85 c0                	test   %eax,%eax
+801081c3:	0f 84 cf 00 00 00    	je     80108298 <sys_unlink+0x168>
+  ilock(ip);
+801081c9:	83 ec 0c             	sub    $0xc,%esp
+801081cc:	50                   	push   %eax
+801081cd:	e8 2e 9f ff ff       	call   80102100 <ilock>
+  if(ip->nlink < 1)
+801081d2:	83 c4 10             	add    $0x10,%esp
+801081d5:	66 83 7b 7e 00       	cmpw   $0x0,0x7e(%ebx)
+801081da:	0f 8e 12 01 00 00    	jle    801082f2 <sys_unlink+0x1c2>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+801081e0:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+801081e5:	8d 7d d8             	lea    -0x28(%ebp),%edi
+801081e8:	74 66                	je     80108250 <sys_unlink+0x120>
+  memset(&de, 0, sizeof(de));
+801081ea:	83 ec 04             	sub    $0x4,%esp
+801081ed:	6a 10                	push   $0x10
+801081ef:	6a 00                	push   $0x0
+801081f1:	57                   	push   %edi
+801081f2:	e8 b9 f0 ff ff       	call   801072b0 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801081f7:	6a 10                	push   $0x10
+801081f9:	ff 75 c4             	push   -0x3c(%ebp)
+801081fc:	57                   	push   %edi
+801081fd:	ff 75 b4             	push   -0x4c(%ebp)
+80108200:	e8 bb a3 ff ff       	call   801025c0 <writei>
+80108205:	83 c4 20             	add    $0x20,%esp
+80108208:	83 f8 10             	cmp    $0x10,%eax
+8010820b:	0f 85 d4 00 00 00    	jne    801082e5 <sys_unlink+0x1b5>
+  if(ip->type == T_DIR){
+80108211:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80108216:	0f 84 9c 00 00 00    	je     801082b8 <sys_unlink+0x188>
+  iunlockput(dp);
+8010821c:	83 ec 0c             	sub    $0xc,%esp
+8010821f:	ff 75 b4             	push   -0x4c(%ebp)
+80108222:	e8 99 a1 ff ff       	call   801023c0 <iunlockput>
+  ip->nlink--;
+80108227:	66 83 6b 7e 01       	subw   $0x1,0x7e(%ebx)
+  iupdate(ip);
+8010822c:	89 1c 24             	mov    %ebx,(%esp)
+8010822f:	e8 1c 9e ff ff       	call   80102050 <iupdate>
+  iunlockput(ip);
+80108234:	89 1c 24             	mov    %ebx,(%esp)
+80108237:	e8 84 a1 ff ff       	call   801023c0 <iunlockput>
+  end_op();
+8010823c:	e8 bf b9 ff ff       	call   80103c00 <end_op>
+  return 0;
+80108241:	83 c4 10             	add    $0x10,%esp
+80108244:	31 c0                	xor    %eax,%eax
+}
+80108246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108249:	5b                   	pop    %ebx
+8010824a:	5e                   	pop    %esi
+8010824b:	5f                   	pop    %edi
+8010824c:	5d                   	pop    %ebp
+8010824d:	c3                   	ret
+8010824e:	66 90                	xchg   %ax,%ax
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108250:	83 bb 80 00 00 00 20 	cmpl   $0x20,0x80(%ebx)
+80108257:	76 91                	jbe    801081ea <sys_unlink+0xba>
+80108259:	be 20 00 00 00       	mov    $0x20,%esi
+8010825e:	eb 0f                	jmp    8010826f <sys_unlink+0x13f>
+80108260:	83 c6 10             	add    $0x10,%esi
+80108263:	3b b3 80 00 00 00    	cmp    0x80(%ebx),%esi
+80108269:	0f 83 7b ff ff ff    	jae    801081ea <sys_unlink+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010826f:	6a 10                	push   $0x10
+80108271:	56                   	push   %esi
+80108272:	57                   	push   %edi
+80108273:	53                   	push   %ebx
+80108274:	e8 c7 a1 ff ff       	call   80102440 <readi>
+80108279:	83 c4 10             	add    $0x10,%esp
+8010827c:	83 f8 10             	cmp    $0x10,%eax
+8010827f:	75 57                	jne    801082d8 <sys_unlink+0x1a8>
+    if(de.inum != 0)
+80108281:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80108286:	74 d8                	je     80108260 <sys_unlink+0x130>
+    iunlockput(ip);
+80108288:	83 ec 0c             	sub    $0xc,%esp
+8010828b:	53                   	push   %ebx
+8010828c:	e8 2f a1 ff ff       	call   801023c0 <iunlockput>
+    goto bad;
+80108291:	83 c4 10             	add    $0x10,%esp
+80108294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  iunlockput(dp);
+80108298:	83 ec 0c             	sub    $0xc,%esp
+8010829b:	ff 75 b4             	push   -0x4c(%ebp)
+8010829e:	e8 1d a1 ff ff       	call   801023c0 <iunlockput>
+  end_op();
+801082a3:	e8 58 b9 ff ff       	call   80103c00 <end_op>
+  return -1;
+801082a8:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801082ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801082b0:	eb 94                	jmp    80108246 <sys_unlink+0x116>
+801082b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+801082b8:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+801082bb:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+801082be:	66 83 68 7e 01       	subw   $0x1,0x7e(%eax)
+    iupdate(dp);
+801082c3:	50                   	push   %eax
+801082c4:	e8 87 9d ff ff       	call   80102050 <iupdate>
+801082c9:	83 c4 10             	add    $0x10,%esp
+801082cc:	e9 4b ff ff ff       	jmp    8010821c <sys_unlink+0xec>
+    end_op();
+801082d1:	e8 2a b9 ff ff       	call   80103c00 <end_op>
+    return -1;
+801082d6:	eb d3                	jmp    801082ab <sys_unlink+0x17b>
+      panic("isdirempty: readi");
+801082d8:	83 ec 0c             	sub    $0xc,%esp
+801082db:	68 78 ba 10 80       	push   $0x8010ba78
+801082e0:	e8 fb 80 ff ff       	call   801003e0 <panic>
+    panic("unlink: writei");
+801082e5:	83 ec 0c             	sub    $0xc,%esp
+801082e8:	68 8a ba 10 80       	push   $0x8010ba8a
+801082ed:	e8 ee 80 ff ff       	call   801003e0 <panic>
+    panic("unlink: nlink < 1");
+801082f2:	83 ec 0c             	sub    $0xc,%esp
+801082f5:	68 66 ba 10 80       	push   $0x8010ba66
+801082fa:	e8 e1 80 ff ff       	call   801003e0 <panic>
+801082ff:	90                   	nop
+
+80108300 <sys_open>:
+
+int
+sys_open(void)
+{
+80108300:	55                   	push   %ebp
+80108301:	89 e5                	mov    %esp,%ebp
+80108303:	57                   	push   %edi
+80108304:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108305:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+80108308:	53                   	push   %ebx
+80108309:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010830c:	50                   	push   %eax
+8010830d:	6a 00                	push   $0x0
+8010830f:	e8 8c f3 ff ff       	call   801076a0 <argstr>
+80108314:	83 c4 10             	add    $0x10,%esp
+80108317:	85 c0                	test   %eax,%eax
+80108319:	0f 88 a1 00 00 00    	js     801083c0 <sys_open+0xc0>
+8010831f:	83 ec 08             	sub    $0x8,%esp
+80108322:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108325:	50                   	push   %eax
+80108326:	6a 01                	push   $0x1
+80108328:	e8 33 f2 ff ff       	call   80107560 <argint>
+8010832d:	83 c4 10             	add    $0x10,%esp
+80108330:	85 c0                	test   %eax,%eax
+80108332:	0f 88 88 00 00 00    	js     801083c0 <sys_open+0xc0>
+    return -1;
+
+  begin_op();
+80108338:	e8 53 b8 ff ff       	call   80103b90 <begin_op>
+
+  if(omode & O_CREATE){
+8010833d:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80108341:	0f 85 89 00 00 00    	jne    801083d0 <sys_open+0xd0>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+80108347:	83 ec 0c             	sub    $0xc,%esp
+8010834a:	ff 75 e0             	push   -0x20(%ebp)
+8010834d:	e8 de a9 ff ff       	call   80102d30 <namei>
+80108352:	83 c4 10             	add    $0x10,%esp
+80108355:	89 c6                	mov    %eax,%esi
+80108357:	85 c0                	test   %eax,%eax
+80108359:	0f 84 8e 00 00 00    	je     801083ed <sys_open+0xed>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+8010835f:	83 ec 0c             	sub    $0xc,%esp
+80108362:	50                   	push   %eax
+80108363:	e8 98 9d ff ff       	call   80102100 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108368:	83 c4 10             	add    $0x10,%esp
+8010836b:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+80108370:	0f 84 ca 00 00 00    	je     80108440 <sys_open+0x140>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108376:	e8 75 8c ff ff       	call   80100ff0 <filealloc>
+8010837b:	89 c7                	mov    %eax,%edi
+8010837d:	85 c0                	test   %eax,%eax
+8010837f:	74 2e                	je     801083af <sys_open+0xaf>
+  struct proc *curproc = myproc();
+80108381:	e8 aa cc ff ff       	call   80105030 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108386:	31 db                	xor    %ebx,%ebx
+80108388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010838f:	90                   	nop
+    if(curproc->ofile[fd] == 0){
+80108390:	8b 94 98 94 00 00 00 	mov    0x94(%eax,%ebx,4),%edx
+80108397:	85 d2                	test   %edx,%edx
+80108399:	74 5d                	je     801083f8 <sys_open+0xf8>
+  for(fd = 0; fd < NOFILE; fd++){
+8010839b:	83 c3 01             	add    $0x1,%ebx
+8010839e:	83 fb 10             	cmp    $0x10,%ebx
+801083a1:	75 ed                	jne    80108390 <sys_open+0x90>
+    if(f)
+      fileclose(f);
+801083a3:	83 ec 0c             	sub    $0xc,%esp
+801083a6:	57                   	push   %edi
+801083a7:	e8 24 8d ff ff       	call   801010d0 <fileclose>
+801083ac:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+801083af:	83 ec 0c             	sub    $0xc,%esp
+801083b2:	56                   	push   %esi
+801083b3:	e8 08 a0 ff ff       	call   801023c0 <iunlockput>
+    end_op();
+801083b8:	e8 43 b8 ff ff       	call   80103c00 <end_op>
+    return -1;
+801083bd:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801083c0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801083c5:	eb 6d                	jmp    80108434 <sys_open+0x134>
+801083c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801083ce:	66 90                	xchg   %ax,%ax
+    ip = create(path, T_FILE, 0, 0);
+801083d0:	83 ec 0c             	sub    $0xc,%esp
+801083d3:	31 c9                	xor    %ecx,%ecx
+801083d5:	ba 02 00 00 00       	mov    $0x2,%edx
+801083da:	6a 00                	push   $0x0
+801083dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801083df:	e8 dc f3 ff ff       	call   801077c0 <create>
+    if(ip == 0){
+801083e4:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+801083e7:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+801083e9:	85 c0                	test   %eax,%eax
+801083eb:	75 89                	jne    80108376 <sys_open+0x76>
+      end_op();
+801083ed:	e8 0e b8 ff ff       	call   80103c00 <end_op>
+      return -1;
+801083f2:	eb cc                	jmp    801083c0 <sys_open+0xc0>
+801083f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+801083f8:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801083fb:	89 bc 98 94 00 00 00 	mov    %edi,0x94(%eax,%ebx,4)
+  iunlock(ip);
+80108402:	56                   	push   %esi
+80108403:	e8 d8 9d ff ff       	call   801021e0 <iunlock>
+  end_op();
+80108408:	e8 f3 b7 ff ff       	call   80103c00 <end_op>
+
+  f->type = FD_INODE;
+8010840d:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+80108413:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108416:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+80108419:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+8010841c:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+8010841e:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108425:	f7 d0                	not    %eax
+80108427:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010842a:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+8010842d:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108430:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+80108434:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108437:	89 d8                	mov    %ebx,%eax
+80108439:	5b                   	pop    %ebx
+8010843a:	5e                   	pop    %esi
+8010843b:	5f                   	pop    %edi
+8010843c:	5d                   	pop    %ebp
+8010843d:	c3                   	ret
+8010843e:	66 90                	xchg   %ax,%ax
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108440:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80108443:	85 c9                	test   %ecx,%ecx
+80108445:	0f 84 2b ff ff ff    	je     80108376 <sys_open+0x76>
+8010844b:	e9 5f ff ff ff       	jmp    801083af <sys_open+0xaf>
+
+80108450 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80108450:	55                   	push   %ebp
+80108451:	89 e5                	mov    %esp,%ebp
+80108453:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108456:	e8 35 b7 ff ff       	call   80103b90 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+8010845b:	83 ec 08             	sub    $0x8,%esp
+8010845e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108461:	50                   	push   %eax
+80108462:	6a 00                	push   $0x0
+80108464:	e8 37 f2 ff ff       	call   801076a0 <argstr>
+80108469:	83 c4 10             	add    $0x10,%esp
+8010846c:	85 c0                	test   %eax,%eax
+8010846e:	78 30                	js     801084a0 <sys_mkdir+0x50>
+80108470:	83 ec 0c             	sub    $0xc,%esp
+80108473:	31 c9                	xor    %ecx,%ecx
+80108475:	ba 01 00 00 00       	mov    $0x1,%edx
+8010847a:	6a 00                	push   $0x0
+8010847c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010847f:	e8 3c f3 ff ff       	call   801077c0 <create>
+80108484:	83 c4 10             	add    $0x10,%esp
+80108487:	85 c0                	test   %eax,%eax
+80108489:	74 15                	je     801084a0 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010848b:	83 ec 0c             	sub    $0xc,%esp
+8010848e:	50                   	push   %eax
+8010848f:	e8 2c 9f ff ff       	call   801023c0 <iunlockput>
+  end_op();
+80108494:	e8 67 b7 ff ff       	call   80103c00 <end_op>
+  return 0;
+80108499:	83 c4 10             	add    $0x10,%esp
+8010849c:	31 c0                	xor    %eax,%eax
+}
+8010849e:	c9                   	leave
+8010849f:	c3                   	ret
+    end_op();
+801084a0:	e8 5b b7 ff ff       	call   80103c00 <end_op>
+    return -1;
+801084a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801084aa:	c9                   	leave
+801084ab:	c3                   	ret
+801084ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801084b0 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+801084b0:	55                   	push   %ebp
+801084b1:	89 e5                	mov    %esp,%ebp
+801084b3:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+801084b6:	e8 d5 b6 ff ff       	call   80103b90 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+801084bb:	83 ec 08             	sub    $0x8,%esp
+801084be:	8d 45 ec             	lea    -0x14(%ebp),%eax
+801084c1:	50                   	push   %eax
+801084c2:	6a 00                	push   $0x0
+801084c4:	e8 d7 f1 ff ff       	call   801076a0 <argstr>
+801084c9:	83 c4 10             	add    $0x10,%esp
+801084cc:	85 c0                	test   %eax,%eax
+801084ce:	78 60                	js     80108530 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+801084d0:	83 ec 08             	sub    $0x8,%esp
+801084d3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801084d6:	50                   	push   %eax
+801084d7:	6a 01                	push   $0x1
+801084d9:	e8 82 f0 ff ff       	call   80107560 <argint>
+  if((argstr(0, &path)) < 0 ||
+801084de:	83 c4 10             	add    $0x10,%esp
+801084e1:	85 c0                	test   %eax,%eax
+801084e3:	78 4b                	js     80108530 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+801084e5:	83 ec 08             	sub    $0x8,%esp
+801084e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801084eb:	50                   	push   %eax
+801084ec:	6a 02                	push   $0x2
+801084ee:	e8 6d f0 ff ff       	call   80107560 <argint>
+     argint(1, &major) < 0 ||
+801084f3:	83 c4 10             	add    $0x10,%esp
+801084f6:	85 c0                	test   %eax,%eax
+801084f8:	78 36                	js     80108530 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+801084fa:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+801084fe:	83 ec 0c             	sub    $0xc,%esp
+80108501:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108505:	ba 03 00 00 00       	mov    $0x3,%edx
+8010850a:	50                   	push   %eax
+8010850b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010850e:	e8 ad f2 ff ff       	call   801077c0 <create>
+     argint(2, &minor) < 0 ||
+80108513:	83 c4 10             	add    $0x10,%esp
+80108516:	85 c0                	test   %eax,%eax
+80108518:	74 16                	je     80108530 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010851a:	83 ec 0c             	sub    $0xc,%esp
+8010851d:	50                   	push   %eax
+8010851e:	e8 9d 9e ff ff       	call   801023c0 <iunlockput>
+  end_op();
+80108523:	e8 d8 b6 ff ff       	call   80103c00 <end_op>
+  return 0;
+80108528:	83 c4 10             	add    $0x10,%esp
+8010852b:	31 c0                	xor    %eax,%eax
+}
+8010852d:	c9                   	leave
+8010852e:	c3                   	ret
+8010852f:	90                   	nop
+    end_op();
+80108530:	e8 cb b6 ff ff       	call   80103c00 <end_op>
+    return -1;
+80108535:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010853a:	c9                   	leave
+8010853b:	c3                   	ret
+8010853c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108540 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80108540:	55                   	push   %ebp
+80108541:	89 e5                	mov    %esp,%ebp
+80108543:	56                   	push   %esi
+80108544:	53                   	push   %ebx
+80108545:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80108548:	e8 e3 ca ff ff       	call   80105030 <myproc>
+8010854d:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+8010854f:	e8 3c b6 ff ff       	call   80103b90 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108554:	83 ec 08             	sub    $0x8,%esp
+80108557:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010855a:	50                   	push   %eax
+8010855b:	6a 00                	push   $0x0
+8010855d:	e8 3e f1 ff ff       	call   801076a0 <argstr>
+80108562:	83 c4 10             	add    $0x10,%esp
+80108565:	85 c0                	test   %eax,%eax
+80108567:	78 77                	js     801085e0 <sys_chdir+0xa0>
+80108569:	83 ec 0c             	sub    $0xc,%esp
+8010856c:	ff 75 f4             	push   -0xc(%ebp)
+8010856f:	e8 bc a7 ff ff       	call   80102d30 <namei>
+80108574:	83 c4 10             	add    $0x10,%esp
+80108577:	89 c3                	mov    %eax,%ebx
+80108579:	85 c0                	test   %eax,%eax
+8010857b:	74 63                	je     801085e0 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+8010857d:	83 ec 0c             	sub    $0xc,%esp
+80108580:	50                   	push   %eax
+80108581:	e8 7a 9b ff ff       	call   80102100 <ilock>
+  if(ip->type != T_DIR){
+80108586:	83 c4 10             	add    $0x10,%esp
+80108589:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+8010858e:	75 30                	jne    801085c0 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108590:	83 ec 0c             	sub    $0xc,%esp
+80108593:	53                   	push   %ebx
+80108594:	e8 47 9c ff ff       	call   801021e0 <iunlock>
+  iput(curproc->cwd);
+80108599:	58                   	pop    %eax
+8010859a:	ff b6 d4 00 00 00    	push   0xd4(%esi)
+801085a0:	e8 8b 9c ff ff       	call   80102230 <iput>
+  end_op();
+801085a5:	e8 56 b6 ff ff       	call   80103c00 <end_op>
+  curproc->cwd = ip;
+801085aa:	89 9e d4 00 00 00    	mov    %ebx,0xd4(%esi)
+  return 0;
+801085b0:	83 c4 10             	add    $0x10,%esp
+801085b3:	31 c0                	xor    %eax,%eax
+}
+801085b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801085b8:	5b                   	pop    %ebx
+801085b9:	5e                   	pop    %esi
+801085ba:	5d                   	pop    %ebp
+801085bb:	c3                   	ret
+801085bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+801085c0:	83 ec 0c             	sub    $0xc,%esp
+801085c3:	53                   	push   %ebx
+801085c4:	e8 f7 9d ff ff       	call   801023c0 <iunlockput>
+    end_op();
+801085c9:	e8 32 b6 ff ff       	call   80103c00 <end_op>
+    return -1;
+801085ce:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801085d1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801085d6:	eb dd                	jmp    801085b5 <sys_chdir+0x75>
+801085d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801085df:	90                   	nop
+    end_op();
+801085e0:	e8 1b b6 ff ff       	call   80103c00 <end_op>
+    return -1;
+801085e5:	eb ea                	jmp    801085d1 <sys_chdir+0x91>
+801085e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801085ee:	66 90                	xchg   %ax,%ax
+
+801085f0 <sys_exec>:
+
+int
+sys_exec(void)
+{
+801085f0:	55                   	push   %ebp
+801085f1:	89 e5                	mov    %esp,%ebp
+801085f3:	57                   	push   %edi
+801085f4:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801085f5:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+801085fb:	53                   	push   %ebx
+801085fc:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108602:	50                   	push   %eax
+80108603:	6a 00                	push   $0x0
+80108605:	e8 96 f0 ff ff       	call   801076a0 <argstr>
+8010860a:	83 c4 10             	add    $0x10,%esp
+8010860d:	85 c0                	test   %eax,%eax
+8010860f:	0f 88 87 00 00 00    	js     8010869c <sys_exec+0xac>
+80108615:	83 ec 08             	sub    $0x8,%esp
+80108618:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+8010861e:	50                   	push   %eax
+8010861f:	6a 01                	push   $0x1
+80108621:	e8 3a ef ff ff       	call   80107560 <argint>
+80108626:	83 c4 10             	add    $0x10,%esp
+80108629:	85 c0                	test   %eax,%eax
+8010862b:	78 6f                	js     8010869c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+8010862d:	83 ec 04             	sub    $0x4,%esp
+80108630:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80108636:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80108638:	68 80 00 00 00       	push   $0x80
+8010863d:	6a 00                	push   $0x0
+8010863f:	56                   	push   %esi
+80108640:	e8 6b ec ff ff       	call   801072b0 <memset>
+80108645:	83 c4 10             	add    $0x10,%esp
+80108648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010864f:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80108650:	83 ec 08             	sub    $0x8,%esp
+80108653:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80108659:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108660:	50                   	push   %eax
+80108661:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108667:	01 f8                	add    %edi,%eax
+80108669:	50                   	push   %eax
+8010866a:	e8 61 ee ff ff       	call   801074d0 <fetchint>
+8010866f:	83 c4 10             	add    $0x10,%esp
+80108672:	85 c0                	test   %eax,%eax
+80108674:	78 26                	js     8010869c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108676:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010867c:	85 c0                	test   %eax,%eax
+8010867e:	74 30                	je     801086b0 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108680:	83 ec 08             	sub    $0x8,%esp
+80108683:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108686:	52                   	push   %edx
+80108687:	50                   	push   %eax
+80108688:	e8 83 ee ff ff       	call   80107510 <fetchstr>
+8010868d:	83 c4 10             	add    $0x10,%esp
+80108690:	85 c0                	test   %eax,%eax
+80108692:	78 08                	js     8010869c <sys_exec+0xac>
+  for(i=0;; i++){
+80108694:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108697:	83 fb 20             	cmp    $0x20,%ebx
+8010869a:	75 b4                	jne    80108650 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+8010869c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010869f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801086a4:	5b                   	pop    %ebx
+801086a5:	5e                   	pop    %esi
+801086a6:	5f                   	pop    %edi
+801086a7:	5d                   	pop    %ebp
+801086a8:	c3                   	ret
+801086a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+801086b0:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+801086b7:	00 00 00 00 
+  return exec(path, argv);
+801086bb:	83 ec 08             	sub    $0x8,%esp
+801086be:	56                   	push   %esi
+801086bf:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+801086c5:	e8 76 84 ff ff       	call   80100b40 <exec>
+801086ca:	83 c4 10             	add    $0x10,%esp
+}
+801086cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801086d0:	5b                   	pop    %ebx
+801086d1:	5e                   	pop    %esi
+801086d2:	5f                   	pop    %edi
+801086d3:	5d                   	pop    %ebp
+801086d4:	c3                   	ret
+801086d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801086dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801086e0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801086e0:	55                   	push   %ebp
+801086e1:	89 e5                	mov    %esp,%ebp
+801086e3:	57                   	push   %edi
+801086e4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801086e5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801086e8:	53                   	push   %ebx
+801086e9:	83 ec 20             	sub    $0x20,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801086ec:	6a 08                	push   $0x8
+801086ee:	50                   	push   %eax
+801086ef:	6a 00                	push   $0x0
+801086f1:	e8 ba ee ff ff       	call   801075b0 <argptr>
+801086f6:	83 c4 10             	add    $0x10,%esp
+801086f9:	85 c0                	test   %eax,%eax
+801086fb:	0f 88 8e 00 00 00    	js     8010878f <sys_pipe+0xaf>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108701:	83 ec 08             	sub    $0x8,%esp
+80108704:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108707:	50                   	push   %eax
+80108708:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010870b:	50                   	push   %eax
+8010870c:	e8 8f bb ff ff       	call   801042a0 <pipealloc>
+80108711:	83 c4 10             	add    $0x10,%esp
+80108714:	85 c0                	test   %eax,%eax
+80108716:	78 77                	js     8010878f <sys_pipe+0xaf>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108718:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+8010871b:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+8010871d:	e8 0e c9 ff ff       	call   80105030 <myproc>
+    if(curproc->ofile[fd] == 0){
+80108722:	8b b4 98 94 00 00 00 	mov    0x94(%eax,%ebx,4),%esi
+80108729:	85 f6                	test   %esi,%esi
+8010872b:	74 16                	je     80108743 <sys_pipe+0x63>
+8010872d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80108730:	83 c3 01             	add    $0x1,%ebx
+80108733:	83 fb 10             	cmp    $0x10,%ebx
+80108736:	74 40                	je     80108778 <sys_pipe+0x98>
+    if(curproc->ofile[fd] == 0){
+80108738:	8b b4 98 94 00 00 00 	mov    0x94(%eax,%ebx,4),%esi
+8010873f:	85 f6                	test   %esi,%esi
+80108741:	75 ed                	jne    80108730 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80108743:	8d 73 24             	lea    0x24(%ebx),%esi
+80108746:	89 7c b0 04          	mov    %edi,0x4(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+8010874a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+8010874d:	e8 de c8 ff ff       	call   80105030 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108752:	31 d2                	xor    %edx,%edx
+80108754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80108758:	8b 8c 90 94 00 00 00 	mov    0x94(%eax,%edx,4),%ecx
+8010875f:	85 c9                	test   %ecx,%ecx
+80108761:	74 3d                	je     801087a0 <sys_pipe+0xc0>
+  for(fd = 0; fd < NOFILE; fd++){
+80108763:	83 c2 01             	add    $0x1,%edx
+80108766:	83 fa 10             	cmp    $0x10,%edx
+80108769:	75 ed                	jne    80108758 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+8010876b:	e8 c0 c8 ff ff       	call   80105030 <myproc>
+80108770:	c7 44 b0 04 00 00 00 	movl   $0x0,0x4(%eax,%esi,4)
+80108777:	00 
+    fileclose(rf);
+80108778:	83 ec 0c             	sub    $0xc,%esp
+8010877b:	ff 75 e0             	push   -0x20(%ebp)
+8010877e:	e8 4d 89 ff ff       	call   801010d0 <fileclose>
+    fileclose(wf);
+80108783:	58                   	pop    %eax
+80108784:	ff 75 e4             	push   -0x1c(%ebp)
+80108787:	e8 44 89 ff ff       	call   801010d0 <fileclose>
+    return -1;
+8010878c:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010878f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108794:	eb 1e                	jmp    801087b4 <sys_pipe+0xd4>
+80108796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010879d:	8d 76 00             	lea    0x0(%esi),%esi
+      curproc->ofile[fd] = f;
+801087a0:	89 bc 90 94 00 00 00 	mov    %edi,0x94(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+801087a7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801087aa:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+801087ac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801087af:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+801087b2:	31 c0                	xor    %eax,%eax
+}
+801087b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087b7:	5b                   	pop    %ebx
+801087b8:	5e                   	pop    %esi
+801087b9:	5f                   	pop    %edi
+801087ba:	5d                   	pop    %ebp
+801087bb:	c3                   	ret
+801087bc:	66 90                	xchg   %ax,%ax
+801087be:	66 90                	xchg   %ax,%ax
+
+801087c0 <sys_fork>:
+#include "trace.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+801087c0:	e9 3b ca ff ff       	jmp    80105200 <fork>
+801087c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801087d0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+801087d0:	55                   	push   %ebp
+801087d1:	89 e5                	mov    %esp,%ebp
+801087d3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+801087d6:	e8 f5 d2 ff ff       	call   80105ad0 <exit>
+  return 0;  // not reached
+}
+801087db:	31 c0                	xor    %eax,%eax
+801087dd:	c9                   	leave
+801087de:	c3                   	ret
+801087df:	90                   	nop
+
+801087e0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+801087e0:	e9 bb d0 ff ff       	jmp    801058a0 <wait>
+801087e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801087f0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+801087f0:	55                   	push   %ebp
+801087f1:	89 e5                	mov    %esp,%ebp
+801087f3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if (argint(0, &pid) < 0)
+801087f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801087f9:	50                   	push   %eax
+801087fa:	6a 00                	push   $0x0
+801087fc:	e8 5f ed ff ff       	call   80107560 <argint>
+80108801:	83 c4 10             	add    $0x10,%esp
+80108804:	85 c0                	test   %eax,%eax
+80108806:	78 18                	js     80108820 <sys_kill+0x30>
+    return -1;
+  // kill() tags the process with the 'killed' field in the struct proc
+  return kill(pid);
+80108808:	83 ec 0c             	sub    $0xc,%esp
+8010880b:	ff 75 f4             	push   -0xc(%ebp)
+8010880e:	e8 5d d4 ff ff       	call   80105c70 <kill>
+80108813:	83 c4 10             	add    $0x10,%esp
+}
+80108816:	c9                   	leave
+80108817:	c3                   	ret
+80108818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010881f:	90                   	nop
+80108820:	c9                   	leave
+    return -1;
+80108821:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108826:	c3                   	ret
+80108827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010882e:	66 90                	xchg   %ax,%ax
+
+80108830 <sys_setpriority>:
+
+int
+sys_setpriority(void)
+{
+80108830:	55                   	push   %ebp
+80108831:	89 e5                	mov    %esp,%ebp
+80108833:	83 ec 20             	sub    $0x20,%esp
+  int pid, prio;
+
+  if (argint(0, &pid) < 0 || argint(1, &prio) < 0)
+80108836:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108839:	50                   	push   %eax
+8010883a:	6a 00                	push   $0x0
+8010883c:	e8 1f ed ff ff       	call   80107560 <argint>
+80108841:	83 c4 10             	add    $0x10,%esp
+80108844:	85 c0                	test   %eax,%eax
+80108846:	78 28                	js     80108870 <sys_setpriority+0x40>
+80108848:	83 ec 08             	sub    $0x8,%esp
+8010884b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010884e:	50                   	push   %eax
+8010884f:	6a 01                	push   $0x1
+80108851:	e8 0a ed ff ff       	call   80107560 <argint>
+80108856:	83 c4 10             	add    $0x10,%esp
+80108859:	85 c0                	test   %eax,%eax
+8010885b:	78 13                	js     80108870 <sys_setpriority+0x40>
+    return -1;
+  return setpriority(pid, prio);
+8010885d:	83 ec 08             	sub    $0x8,%esp
+80108860:	ff 75 f4             	push   -0xc(%ebp)
+80108863:	ff 75 f0             	push   -0x10(%ebp)
+80108866:	e8 b5 d4 ff ff       	call   80105d20 <setpriority>
+8010886b:	83 c4 10             	add    $0x10,%esp
+}
+8010886e:	c9                   	leave
+8010886f:	c3                   	ret
+80108870:	c9                   	leave
+    return -1;
+80108871:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108876:	c3                   	ret
+80108877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010887e:	66 90                	xchg   %ax,%ax
+
+80108880 <sys_setaffinity>:
+
+int
+sys_setaffinity(void)
+{
+80108880:	55                   	push   %ebp
+80108881:	89 e5                	mov    %esp,%ebp
+80108883:	83 ec 20             	sub    $0x20,%esp
+  int pid, mask;
+
+  if (argint(0, &pid) < 0 || argint(1, &mask) < 0)
+80108886:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108889:	50                   	push   %eax
+8010888a:	6a 00                	push   $0x0
+8010888c:	e8 cf ec ff ff       	call   80107560 <argint>
+80108891:	83 c4 10             	add    $0x10,%esp
+80108894:	85 c0                	test   %eax,%eax
+80108896:	78 28                	js     801088c0 <sys_setaffinity+0x40>
+80108898:	83 ec 08             	sub    $0x8,%esp
+8010889b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010889e:	50                   	push   %eax
+8010889f:	6a 01                	push   $0x1
+801088a1:	e8 ba ec ff ff       	call   80107560 <argint>
+801088a6:	83 c4 10             	add    $0x10,%esp
+801088a9:	85 c0                	test   %eax,%eax
+801088ab:	78 13                	js     801088c0 <sys_setaffinity+0x40>
+    return -1;
+  return setaffinity(pid, mask);
+801088ad:	83 ec 08             	sub    $0x8,%esp
+801088b0:	ff 75 f4             	push   -0xc(%ebp)
+801088b3:	ff 75 f0             	push   -0x10(%ebp)
+801088b6:	e8 65 d5 ff ff       	call   80105e20 <setaffinity>
+801088bb:	83 c4 10             	add    $0x10,%esp
+}
+801088be:	c9                   	leave
+801088bf:	c3                   	ret
+801088c0:	c9                   	leave
+    return -1;
+801088c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801088c6:	c3                   	ret
+801088c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801088ce:	66 90                	xchg   %ax,%ax
+
+801088d0 <sys_lockstress>:
+
+int
+sys_lockstress(void)
+{
+801088d0:	55                   	push   %ebp
+801088d1:	89 e5                	mov    %esp,%ebp
+801088d3:	83 ec 20             	sub    $0x20,%esp
+  int kind, n;
+
+  if (argint(0, &kind) < 0 || argint(1, &n) < 0)
+801088d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801088d9:	50                   	push   %eax
+801088da:	6a 00                	push   $0x0
+801088dc:	e8 7f ec ff ff       	call   80107560 <argint>
+801088e1:	83 c4 10             	add    $0x10,%esp
+801088e4:	85 c0                	test   %eax,%eax
+801088e6:	78 28                	js     80108910 <sys_lockstress+0x40>
+801088e8:	83 ec 08             	sub    $0x8,%esp
+801088eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801088ee:	50                   	push   %eax
+801088ef:	6a 01                	push   $0x1
+801088f1:	e8 6a ec ff ff       	call   80107560 <argint>
+801088f6:	83 c4 10             	add    $0x10,%esp
+801088f9:	85 c0                	test   %eax,%eax
+801088fb:	78 13                	js     80108910 <sys_lockstress+0x40>
+    return -1;
+  return lockstress(kind, n);
+801088fd:	83 ec 08             	sub    $0x8,%esp
+80108900:	ff 75 f4             	push   -0xc(%ebp)
+80108903:	ff 75 f0             	push   -0x10(%ebp)
+80108906:	e8 b5 e8 ff ff       	call   801071c0 <lockstress>
+8010890b:	83 c4 10             	add    $0x10,%esp
+}
+8010890e:	c9                   	leave
+8010890f:	c3                   	ret
+80108910:	c9                   	leave
+    return -1;
+80108911:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108916:	c3                   	ret
+80108917:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010891e:	66 90                	xchg   %ax,%ax
+
+80108920 <sys_lockstat>:
+
+// Copy out lock statistics, resetting them if asked to.
+int
+sys_lockstat(void)
+{
+80108920:	55                   	push   %ebp
+80108921:	89 e5                	mov    %esp,%ebp
+80108923:	83 ec 20             	sub    $0x20,%esp
+  struct lockstat *st;
+  int n, reset;
+
+  if (argint(1, &n) < 0 ||
+80108926:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108929:	50                   	push   %eax
+8010892a:	6a 01                	push   $0x1
+8010892c:	e8 2f ec ff ff       	call   80107560 <argint>
+80108931:	83 c4 10             	add    $0x10,%esp
+80108934:	85 c0                	test   %eax,%eax
+80108936:	78 48                	js     80108980 <sys_lockstat+0x60>
+      argarray(0, (void*)&st, n, sizeof(*st), NLOCKSTAT) < 0 ||
+80108938:	83 ec 0c             	sub    $0xc,%esp
+8010893b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+8010893e:	6a 40                	push   $0x40
+80108940:	6a 40                	push   $0x40
+80108942:	ff 75 f0             	push   -0x10(%ebp)
+80108945:	50                   	push   %eax
+80108946:	6a 00                	push   $0x0
+80108948:	e8 d3 ec ff ff       	call   80107620 <argarray>
+  if (argint(1, &n) < 0 ||
+8010894d:	83 c4 20             	add    $0x20,%esp
+80108950:	85 c0                	test   %eax,%eax
+80108952:	78 2c                	js     80108980 <sys_lockstat+0x60>
+      argint(2, &reset) < 0)
+80108954:	83 ec 08             	sub    $0x8,%esp
+80108957:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010895a:	50                   	push   %eax
+8010895b:	6a 02                	push   $0x2
+8010895d:	e8 fe eb ff ff       	call   80107560 <argint>
+      argarray(0, (void*)&st, n, sizeof(*st), NLOCKSTAT) < 0 ||
+80108962:	83 c4 10             	add    $0x10,%esp
+80108965:	85 c0                	test   %eax,%eax
+80108967:	78 17                	js     80108980 <sys_lockstat+0x60>
+    return -1;
+  return lockstatread(st, n, reset);
+80108969:	83 ec 04             	sub    $0x4,%esp
+8010896c:	ff 75 f4             	push   -0xc(%ebp)
+8010896f:	ff 75 f0             	push   -0x10(%ebp)
+80108972:	ff 75 ec             	push   -0x14(%ebp)
+80108975:	e8 06 e6 ff ff       	call   80106f80 <lockstatread>
+8010897a:	83 c4 10             	add    $0x10,%esp
+}
+8010897d:	c9                   	leave
+8010897e:	c3                   	ret
+8010897f:	90                   	nop
+80108980:	c9                   	leave
+    return -1;
+80108981:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108986:	c3                   	ret
+80108987:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010898e:	66 90                	xchg   %ax,%ax
+
+80108990 <sys_profctl>:
+
+// Start or stop the profiler.
+int
+sys_profctl(void)
+{
+80108990:	55                   	push   %ebp
+80108991:	89 e5                	mov    %esp,%ebp
+80108993:	83 ec 20             	sub    $0x20,%esp
+  int rate;
+
+  if(argint(0, &rate) < 0)
+80108996:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108999:	50                   	push   %eax
+8010899a:	6a 00                	push   $0x0
+8010899c:	e8 bf eb ff ff       	call   80107560 <argint>
+801089a1:	83 c4 10             	add    $0x10,%esp
+801089a4:	85 c0                	test   %eax,%eax
+801089a6:	78 18                	js     801089c0 <sys_profctl+0x30>
+    return -1;
+  return profctl(rate);
+801089a8:	83 ec 0c             	sub    $0xc,%esp
+801089ab:	ff 75 f4             	push   -0xc(%ebp)
+801089ae:	e8 3d da ff ff       	call   801063f0 <profctl>
+801089b3:	83 c4 10             	add    $0x10,%esp
+}
+801089b6:	c9                   	leave
+801089b7:	c3                   	ret
+801089b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801089bf:	90                   	nop
+801089c0:	c9                   	leave
+    return -1;
+801089c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801089c6:	c3                   	ret
+801089c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801089ce:	66 90                	xchg   %ax,%ax
+
+801089d0 <sys_profread>:
+
+// Copy out profiler samples.
+int
+sys_profread(void)
+{
+801089d0:	55                   	push   %ebp
+801089d1:	89 e5                	mov    %esp,%ebp
+801089d3:	83 ec 20             	sub    $0x20,%esp
+  struct profsample *s;
+  int n;
+
+  if(argint(1, &n) < 0 ||
+801089d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801089d9:	50                   	push   %eax
+801089da:	6a 01                	push   $0x1
+801089dc:	e8 7f eb ff ff       	call   80107560 <argint>
+801089e1:	83 c4 10             	add    $0x10,%esp
+801089e4:	85 c0                	test   %eax,%eax
+801089e6:	78 38                	js     80108a20 <sys_profread+0x50>
+     argarray(0, (void*)&s, n, sizeof(*s), NCPU*NPROF) < 0)
+801089e8:	83 ec 0c             	sub    $0xc,%esp
+801089eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801089ee:	68 00 20 00 00       	push   $0x2000
+801089f3:	6a 18                	push   $0x18
+801089f5:	ff 75 f4             	push   -0xc(%ebp)
+801089f8:	50                   	push   %eax
+801089f9:	6a 00                	push   $0x0
+801089fb:	e8 20 ec ff ff       	call   80107620 <argarray>
+  if(argint(1, &n) < 0 ||
+80108a00:	83 c4 20             	add    $0x20,%esp
+80108a03:	85 c0                	test   %eax,%eax
+80108a05:	78 19                	js     80108a20 <sys_profread+0x50>
+    return -1;
+  return profread(s, n);
+80108a07:	83 ec 08             	sub    $0x8,%esp
+80108a0a:	ff 75 f4             	push   -0xc(%ebp)
+80108a0d:	ff 75 f0             	push   -0x10(%ebp)
+80108a10:	e8 bb da ff ff       	call   801064d0 <profread>
+80108a15:	83 c4 10             	add    $0x10,%esp
+}
+80108a18:	c9                   	leave
+80108a19:	c3                   	ret
+80108a1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108a20:	c9                   	leave
+    return -1;
+80108a21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108a26:	c3                   	ret
+80108a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a2e:	66 90                	xchg   %ax,%ax
+
+80108a30 <sys_getrusage>:
+
+// Copy out resource usage of one process or all of them.
+int
+sys_getrusage(void)
+{
+80108a30:	55                   	push   %ebp
+80108a31:	89 e5                	mov    %esp,%ebp
+80108a33:	83 ec 20             	sub    $0x20,%esp
+  struct rusage *ru;
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(2, &n) < 0 ||
+80108a36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108a39:	50                   	push   %eax
+80108a3a:	6a 00                	push   $0x0
+80108a3c:	e8 1f eb ff ff       	call   80107560 <argint>
+80108a41:	83 c4 10             	add    $0x10,%esp
+80108a44:	85 c0                	test   %eax,%eax
+80108a46:	78 50                	js     80108a98 <sys_getrusage+0x68>
+80108a48:	83 ec 08             	sub    $0x8,%esp
+80108a4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a4e:	50                   	push   %eax
+80108a4f:	6a 02                	push   $0x2
+80108a51:	e8 0a eb ff ff       	call   80107560 <argint>
+80108a56:	83 c4 10             	add    $0x10,%esp
+80108a59:	85 c0                	test   %eax,%eax
+80108a5b:	78 3b                	js     80108a98 <sys_getrusage+0x68>
+     argarray(1, (void*)&ru, n, sizeof(*ru), NPROC) < 0)
+80108a5d:	83 ec 0c             	sub    $0xc,%esp
+80108a60:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108a63:	6a 40                	push   $0x40
+80108a65:	68 d0 00 00 00       	push   $0xd0
+80108a6a:	ff 75 f4             	push   -0xc(%ebp)
+80108a6d:	50                   	push   %eax
+80108a6e:	6a 01                	push   $0x1
+80108a70:	e8 ab eb ff ff       	call   80107620 <argarray>
+  if(argint(0, &pid) < 0 || argint(2, &n) < 0 ||
+80108a75:	83 c4 20             	add    $0x20,%esp
+80108a78:	85 c0                	test   %eax,%eax
+80108a7a:	78 1c                	js     80108a98 <sys_getrusage+0x68>
+    return -1;
+  return getrusage(pid, ru, n);
+80108a7c:	83 ec 04             	sub    $0x4,%esp
+80108a7f:	ff 75 f4             	push   -0xc(%ebp)
+80108a82:	ff 75 ec             	push   -0x14(%ebp)
+80108a85:	ff 75 f0             	push   -0x10(%ebp)
+80108a88:	e8 33 d6 ff ff       	call   801060c0 <getrusage>
+80108a8d:	83 c4 10             	add    $0x10,%esp
+}
+80108a90:	c9                   	leave
+80108a91:	c3                   	ret
+80108a92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108a98:	c9                   	leave
+    return -1;
+80108a99:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108a9e:	c3                   	ret
+80108a9f:	90                   	nop
+
+80108aa0 <sys_tracectl>:
+
+// Turn event tracing on or off.
+int
+sys_tracectl(void)
+{
+80108aa0:	55                   	push   %ebp
+80108aa1:	89 e5                	mov    %esp,%ebp
+80108aa3:	83 ec 20             	sub    $0x20,%esp
+  int on;
+
+  if(argint(0, &on) < 0)
+80108aa6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108aa9:	50                   	push   %eax
+80108aaa:	6a 00                	push   $0x0
+80108aac:	e8 af ea ff ff       	call   80107560 <argint>
+80108ab1:	83 c4 10             	add    $0x10,%esp
+80108ab4:	85 c0                	test   %eax,%eax
+80108ab6:	78 18                	js     80108ad0 <sys_tracectl+0x30>
+    return -1;
+  return tracectl(on);
+80108ab8:	83 ec 0c             	sub    $0xc,%esp
+80108abb:	ff 75 f4             	push   -0xc(%ebp)
+80108abe:	e8 cd 0a 00 00       	call   80109590 <tracectl>
+80108ac3:	83 c4 10             	add    $0x10,%esp
+}
+80108ac6:	c9                   	leave
+80108ac7:	c3                   	ret
+80108ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108acf:	90                   	nop
+80108ad0:	c9                   	leave
+    return -1;
+80108ad1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108ad6:	c3                   	ret
+80108ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ade:	66 90                	xchg   %ax,%ax
+
+80108ae0 <sys_traceread>:
+
+// Copy out trace events.
+int
+sys_traceread(void)
+{
+80108ae0:	55                   	push   %ebp
+80108ae1:	89 e5                	mov    %esp,%ebp
+80108ae3:	83 ec 20             	sub    $0x20,%esp
+  struct traceev *ev;
+  int n;
+
+  if(argint(1, &n) < 0 ||
+80108ae6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ae9:	50                   	push   %eax
+80108aea:	6a 01                	push   $0x1
+80108aec:	e8 6f ea ff ff       	call   80107560 <argint>
+80108af1:	83 c4 10             	add    $0x10,%esp
+80108af4:	85 c0                	test   %eax,%eax
+80108af6:	78 38                	js     80108b30 <sys_traceread+0x50>
+     argarray(0, (void*)&ev, n, sizeof(*ev), NCPU*NTRACE) < 0)
+80108af8:	83 ec 0c             	sub    $0xc,%esp
+80108afb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108afe:	68 00 20 00 00       	push   $0x2000
+80108b03:	6a 18                	push   $0x18
+80108b05:	ff 75 f4             	push   -0xc(%ebp)
+80108b08:	50                   	push   %eax
+80108b09:	6a 00                	push   $0x0
+80108b0b:	e8 10 eb ff ff       	call   80107620 <argarray>
+  if(argint(1, &n) < 0 ||
+80108b10:	83 c4 20             	add    $0x20,%esp
+80108b13:	85 c0                	test   %eax,%eax
+80108b15:	78 19                	js     80108b30 <sys_traceread+0x50>
+    return -1;
+  return traceread(ev, n);
+80108b17:	83 ec 08             	sub    $0x8,%esp
+80108b1a:	ff 75 f4             	push   -0xc(%ebp)
+80108b1d:	ff 75 f0             	push   -0x10(%ebp)
+80108b20:	e8 0b 0b 00 00       	call   80109630 <traceread>
+80108b25:	83 c4 10             	add    $0x10,%esp
+}
+80108b28:	c9                   	leave
+80108b29:	c3                   	ret
+80108b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108b30:	c9                   	leave
+    return -1;
+80108b31:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108b36:	c3                   	ret
+80108b37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b3e:	66 90                	xchg   %ax,%ax
+
+80108b40 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108b40:	55                   	push   %ebp
+80108b41:	89 e5                	mov    %esp,%ebp
+80108b43:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108b46:	e8 e5 c4 ff ff       	call   80105030 <myproc>
+80108b4b:	8b 40 64             	mov    0x64(%eax),%eax
+}
+80108b4e:	c9                   	leave
+80108b4f:	c3                   	ret
+
+80108b50 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108b50:	55                   	push   %ebp
+80108b51:	89 e5                	mov    %esp,%ebp
+80108b53:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if (argint(0, &n) < 0)
+80108b54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108b57:	83 ec 1c             	sub    $0x1c,%esp
+  if (argint(0, &n) < 0)
+80108b5a:	50                   	push   %eax
+80108b5b:	6a 00                	push   $0x0
+80108b5d:	e8 fe e9 ff ff       	call   80107560 <argint>
+80108b62:	83 c4 10             	add    $0x10,%esp
+80108b65:	85 c0                	test   %eax,%eax
+80108b67:	78 27                	js     80108b90 <sys_sbrk+0x40>
+    return -1;
+
+  addr = myproc()->sz;
+80108b69:	e8 c2 c4 ff ff       	call   80105030 <myproc>
+  if (growproc(n) < 0)
+80108b6e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80108b71:	8b 58 54             	mov    0x54(%eax),%ebx
+  if (growproc(n) < 0)
+80108b74:	ff 75 f4             	push   -0xc(%ebp)
+80108b77:	e8 14 c6 ff ff       	call   80105190 <growproc>
+80108b7c:	83 c4 10             	add    $0x10,%esp
+80108b7f:	85 c0                	test   %eax,%eax
+80108b81:	78 0d                	js     80108b90 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108b83:	89 d8                	mov    %ebx,%eax
+80108b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108b88:	c9                   	leave
+80108b89:	c3                   	ret
+80108b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80108b90:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b95:	eb ec                	jmp    80108b83 <sys_sbrk+0x33>
+80108b97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b9e:	66 90                	xchg   %ax,%ax
+
+80108ba0 <sys_sleep>:
+// arbitrary integer.
+// Also used in xv6 for processes that are waiting on something else to happen,
+// for example, waiting for a disk to finish reading
+int
+sys_sleep(void)
+{
+80108ba0:	55                   	push   %ebp
+80108ba1:	89 e5                	mov    %esp,%ebp
+80108ba3:	83 ec 20             	sub    $0x20,%esp
+  int n;
+
+  if (argint(0, &n) < 0)
+80108ba6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108ba9:	50                   	push   %eax
+80108baa:	6a 00                	push   $0x0
+80108bac:	e8 af e9 ff ff       	call   80107560 <argint>
+80108bb1:	83 c4 10             	add    $0x10,%esp
+80108bb4:	85 c0                	test   %eax,%eax
+80108bb6:	78 17                	js     80108bcf <sys_sleep+0x2f>
+    return -1;
+  if (n <= 0)
+80108bb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    return 0;
+80108bbb:	31 c0                	xor    %eax,%eax
+  if (n <= 0)
+80108bbd:	85 d2                	test   %edx,%edx
+80108bbf:	7e 0c                	jle    80108bcd <sys_sleep+0x2d>
+  // Wakes when the timer queue says so; see timer.c.
+  return sleepticks(n);
+80108bc1:	83 ec 0c             	sub    $0xc,%esp
+80108bc4:	52                   	push   %edx
+80108bc5:	e8 e6 03 00 00       	call   80108fb0 <sleepticks>
+80108bca:	83 c4 10             	add    $0x10,%esp
+}
+80108bcd:	c9                   	leave
+80108bce:	c3                   	ret
+80108bcf:	c9                   	leave
+    return -1;
+80108bd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108bd5:	c3                   	ret
+80108bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108be0 <sys_nanosleep>:
+
+// Sleep for the time in *req, to the resolution of the TSC.
+int
+sys_nanosleep(void)
+{
+80108be0:	55                   	push   %ebp
+80108be1:	89 e5                	mov    %esp,%ebp
+80108be3:	83 ec 1c             	sub    $0x1c,%esp
+  struct timespec *req;
+
+  if (argptr(0, (void*)&req, sizeof(*req)) < 0)
+80108be6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108be9:	6a 08                	push   $0x8
+80108beb:	50                   	push   %eax
+80108bec:	6a 00                	push   $0x0
+80108bee:	e8 bd e9 ff ff       	call   801075b0 <argptr>
+80108bf3:	83 c4 10             	add    $0x10,%esp
+80108bf6:	85 c0                	test   %eax,%eax
+80108bf8:	78 26                	js     80108c20 <sys_nanosleep+0x40>
+    return -1;
+  if (req->tv_nsec >= 1000000000)
+80108bfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108bfd:	8b 50 04             	mov    0x4(%eax),%edx
+80108c00:	81 fa ff c9 9a 3b    	cmp    $0x3b9ac9ff,%edx
+80108c06:	77 18                	ja     80108c20 <sys_nanosleep+0x40>
+    return -1;
+  return sleepns(req->tv_sec, req->tv_nsec);
+80108c08:	83 ec 08             	sub    $0x8,%esp
+80108c0b:	52                   	push   %edx
+80108c0c:	ff 30                	push   (%eax)
+80108c0e:	e8 fd 03 00 00       	call   80109010 <sleepns>
+80108c13:	83 c4 10             	add    $0x10,%esp
+}
+80108c16:	c9                   	leave
+80108c17:	c3                   	ret
+80108c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108c1f:	90                   	nop
+80108c20:	c9                   	leave
+    return -1;
+80108c21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108c26:	c3                   	ret
+80108c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108c2e:	66 90                	xchg   %ax,%ax
+
+80108c30 <sys_uptime>:
+
+// return how many clock ticks have passed
+// since start.
+int
+sys_uptime(void)
+{
+80108c30:	55                   	push   %ebp
+80108c31:	89 e5                	mov    %esp,%ebp
+80108c33:	53                   	push   %ebx
+80108c34:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108c37:	68 a0 7f 15 80       	push   $0x80157fa0
+80108c3c:	e8 ef e0 ff ff       	call   80106d30 <acquire>
+  tickupdate();
+80108c41:	e8 1a 01 00 00       	call   80108d60 <tickupdate>
+  xticks = ticks;
+80108c46:	8b 1d 80 7f 15 80    	mov    0x80157f80,%ebx
+  release(&tickslock);
+80108c4c:	c7 04 24 a0 7f 15 80 	movl   $0x80157fa0,(%esp)
+80108c53:	e8 98 df ff ff       	call   80106bf0 <release>
+  return xticks;
+}
+80108c58:	89 d8                	mov    %ebx,%eax
+80108c5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108c5d:	c9                   	leave
+80108c5e:	c3                   	ret
+80108c5f:	90                   	nop
+
+80108c60 <timerinit>:
+  return divl(rdtsc() - t0, 10);
+}
+
+void
+timerinit(void)
+{
+80108c60:	55                   	push   %ebp
+80108c61:	89 e5                	mov    %esp,%ebp
+80108c63:	56                   	push   %esi
+80108c64:	53                   	push   %ebx
+  initlock(&tickslock, "time");
+80108c65:	83 ec 08             	sub    $0x8,%esp
+80108c68:	68 99 ba 10 80       	push   $0x8010ba99
+80108c6d:	68 a0 7f 15 80       	push   $0x80157fa0
+80108c72:	e8 69 dd ff ff       	call   801069e0 <initlock>
+  initlock(&tq.lock, "timerq");
+80108c77:	58                   	pop    %eax
+80108c78:	5a                   	pop    %edx
+80108c79:	68 9e ba 10 80       	push   $0x8010ba9e
+80108c7e:	68 00 80 15 80       	push   $0x80158000
+80108c83:	e8 58 dd ff ff       	call   801069e0 <initlock>
+  tq.next = NEVER;
+80108c88:	c7 05 5c 80 15 80 ff 	movl   $0xffffffff,0x8015805c
+80108c8f:	ff ff ff 
+80108c92:	c7 05 60 80 15 80 ff 	movl   $0xffffffff,0x80158060
+80108c99:	ff ff ff 
+  tickcycles = lapiccalibrate();
+80108c9c:	e8 4f a9 ff ff       	call   801035f0 <lapiccalibrate>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80108ca1:	ba 61 00 00 00       	mov    $0x61,%edx
+80108ca6:	89 c6                	mov    %eax,%esi
+80108ca8:	a3 74 80 15 80       	mov    %eax,0x80158074
+80108cad:	ec                   	in     (%dx),%al
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80108cae:	83 e0 fc             	and    $0xfffffffc,%eax
+80108cb1:	83 c8 01             	or     $0x1,%eax
+80108cb4:	ee                   	out    %al,(%dx)
+80108cb5:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+80108cba:	ba 43 00 00 00       	mov    $0x43,%edx
+80108cbf:	ee                   	out    %al,(%dx)
+80108cc0:	ba 42 00 00 00       	mov    $0x42,%edx
+80108cc5:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+80108cca:	ee                   	out    %al,(%dx)
+80108ccb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+80108cd0:	ee                   	out    %al,(%dx)
+  asm volatile("rdtsc" : "=A" (t));
+80108cd1:	0f 31                	rdtsc
+80108cd3:	89 d3                	mov    %edx,%ebx
+80108cd5:	89 c1                	mov    %eax,%ecx
+  while((inb(0x61) & 0x20) == 0)           // until channel 2 reaches 0
+80108cd7:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80108cda:	ba 61 00 00 00       	mov    $0x61,%edx
+80108cdf:	90                   	nop
+80108ce0:	ec                   	in     (%dx),%al
+80108ce1:	a8 20                	test   $0x20,%al
+80108ce3:	74 fb                	je     80108ce0 <timerinit+0x80>
+  asm volatile("rdtsc" : "=A" (t));
+80108ce5:	0f 31                	rdtsc
+  return divl(rdtsc() - t0, 10);
+80108ce7:	29 c8                	sub    %ecx,%eax
+80108ce9:	19 da                	sbb    %ebx,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+80108ceb:	bb 0a 00 00 00       	mov    $0xa,%ebx
+80108cf0:	f7 f3                	div    %ebx
+  tsckhz = pitcalibrate();
+80108cf2:	a3 70 80 15 80       	mov    %eax,0x80158070
+80108cf7:	89 c1                	mov    %eax,%ecx
+  asm volatile("rdtsc" : "=A" (t));
+80108cf9:	0f 31                	rdtsc
+  tsc0 = rdtsc();
+80108cfb:	a3 68 80 15 80       	mov    %eax,0x80158068
+80108d00:	89 15 6c 80 15 80    	mov    %edx,0x8015806c
+  if(tickcycles == 0 || tsckhz == 0)
+80108d06:	85 f6                	test   %esi,%esi
+80108d08:	74 0b                	je     80108d15 <timerinit+0xb5>
+80108d0a:	85 c9                	test   %ecx,%ecx
+80108d0c:	74 07                	je     80108d15 <timerinit+0xb5>
+    panic("timerinit");
+}
+80108d0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108d11:	5b                   	pop    %ebx
+80108d12:	5e                   	pop    %esi
+80108d13:	5d                   	pop    %ebp
+80108d14:	c3                   	ret
+    panic("timerinit");
+80108d15:	83 ec 0c             	sub    $0xc,%esp
+80108d18:	68 a5 ba 10 80       	push   $0x8010baa5
+80108d1d:	e8 be 76 ff ff       	call   801003e0 <panic>
+80108d22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108d30 <timervdso>:
+
+// Fill in the clock in a process's vdso page.
+void
+timervdso(struct vdso *v)
+{
+  v->tickcycles = tickcycles;
+80108d30:	a1 74 80 15 80       	mov    0x80158074,%eax
+  v->tsckhz = tsckhz;
+  v->tsc0 = tsc0;
+80108d35:	8b 15 6c 80 15 80    	mov    0x8015806c,%edx
+{
+80108d3b:	55                   	push   %ebp
+80108d3c:	89 e5                	mov    %esp,%ebp
+80108d3e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  v->tickcycles = tickcycles;
+80108d41:	89 41 04             	mov    %eax,0x4(%ecx)
+  v->tsckhz = tsckhz;
+80108d44:	a1 70 80 15 80       	mov    0x80158070,%eax
+  v->tsc0 = tsc0;
+80108d49:	89 51 10             	mov    %edx,0x10(%ecx)
+  v->tsckhz = tsckhz;
+80108d4c:	89 41 08             	mov    %eax,0x8(%ecx)
+  v->tsc0 = tsc0;
+80108d4f:	a1 68 80 15 80       	mov    0x80158068,%eax
+80108d54:	89 41 0c             	mov    %eax,0xc(%ecx)
+}
+80108d57:	5d                   	pop    %ebp
+80108d58:	c3                   	ret
+80108d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108d60 <tickupdate>:
+// Bring ticks up to date with the clock, boosting MLFQ
+// priorities when it passes a multiple of BOOSTTICKS.
+// Caller must hold tickslock.
+void
+tickupdate(void)
+{
+80108d60:	55                   	push   %ebp
+80108d61:	89 e5                	mov    %esp,%ebp
+80108d63:	57                   	push   %edi
+80108d64:	56                   	push   %esi
+80108d65:	53                   	push   %ebx
+80108d66:	83 ec 0c             	sub    $0xc,%esp
+80108d69:	0f 31                	rdtsc
+  uint now;
+
+  now = clockticks();
+  if(now == ticks)
+80108d6b:	8b 0d 80 7f 15 80    	mov    0x80157f80,%ecx
+  return divl(rdtsc() - tsc0, tickcycles);
+80108d71:	2b 05 68 80 15 80    	sub    0x80158068,%eax
+80108d77:	1b 15 6c 80 15 80    	sbb    0x8015806c,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+80108d7d:	f7 35 74 80 15 80    	divl   0x80158074
+  if(now == ticks)
+80108d83:	39 c1                	cmp    %eax,%ecx
+80108d85:	74 1f                	je     80108da6 <tickupdate+0x46>
+    return;
+  if(now / BOOSTTICKS != ticks / BOOSTTICKS)
+80108d87:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+80108d8c:	89 c3                	mov    %eax,%ebx
+80108d8e:	f7 e7                	mul    %edi
+80108d90:	89 c8                	mov    %ecx,%eax
+80108d92:	89 d6                	mov    %edx,%esi
+80108d94:	f7 e7                	mul    %edi
+80108d96:	c1 ee 05             	shr    $0x5,%esi
+80108d99:	c1 ea 05             	shr    $0x5,%edx
+80108d9c:	39 d6                	cmp    %edx,%esi
+80108d9e:	75 10                	jne    80108db0 <tickupdate+0x50>
+    boost();
+  ticks = now;
+80108da0:	89 1d 80 7f 15 80    	mov    %ebx,0x80157f80
+}
+80108da6:	83 c4 0c             	add    $0xc,%esp
+80108da9:	5b                   	pop    %ebx
+80108daa:	5e                   	pop    %esi
+80108dab:	5f                   	pop    %edi
+80108dac:	5d                   	pop    %ebp
+80108dad:	c3                   	ret
+80108dae:	66 90                	xchg   %ax,%ax
+    boost();
+80108db0:	e8 9b c9 ff ff       	call   80105750 <boost>
+80108db5:	eb e9                	jmp    80108da0 <tickupdate+0x40>
+80108db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108dbe:	66 90                	xchg   %ax,%ax
+
+80108dc0 <readticks>:
+  asm volatile("rdtsc" : "=A" (t));
+80108dc0:	0f 31                	rdtsc
+  return divl(rdtsc() - tsc0, tickcycles);
+80108dc2:	2b 05 68 80 15 80    	sub    0x80158068,%eax
+80108dc8:	1b 15 6c 80 15 80    	sbb    0x8015806c,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+80108dce:	f7 35 74 80 15 80    	divl   0x80158074
+
+// Bring ticks up to date, if it isn't, and return it.
+uint
+readticks(void)
+{
+  if(clockticks() != ticks){  // unlocked peek
+80108dd4:	39 05 80 7f 15 80    	cmp    %eax,0x80157f80
+80108dda:	75 04                	jne    80108de0 <readticks+0x20>
+    acquire(&tickslock);
+    tickupdate();
+    release(&tickslock);
+  }
+  return ticks;
+}
+80108ddc:	c3                   	ret
+80108ddd:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80108de0:	55                   	push   %ebp
+80108de1:	89 e5                	mov    %esp,%ebp
+80108de3:	83 ec 14             	sub    $0x14,%esp
+    acquire(&tickslock);
+80108de6:	68 a0 7f 15 80       	push   $0x80157fa0
+80108deb:	e8 40 df ff ff       	call   80106d30 <acquire>
+    tickupdate();
+80108df0:	e8 6b ff ff ff       	call   80108d60 <tickupdate>
+    release(&tickslock);
+80108df5:	c7 04 24 a0 7f 15 80 	movl   $0x80157fa0,(%esp)
+80108dfc:	e8 ef dd ff ff       	call   80106bf0 <release>
+  return ticks;
+80108e01:	a1 80 7f 15 80       	mov    0x80157f80,%eax
+80108e06:	83 c4 10             	add    $0x10,%esp
+}
+80108e09:	c9                   	leave
+80108e0a:	c3                   	ret
+80108e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108e0f:	90                   	nop
+
+80108e10 <sleepuntil>:
+
+// Sleep until the TSC reaches when.
+// Returns -1 if killed first, otherwise 0.
+int
+sleepuntil(uint64 when)
+{
+80108e10:	55                   	push   %ebp
+80108e11:	89 e5                	mov    %esp,%ebp
+80108e13:	56                   	push   %esi
+80108e14:	53                   	push   %ebx
+80108e15:	83 ec 10             	sub    $0x10,%esp
+80108e18:	8b 75 08             	mov    0x8(%ebp),%esi
+80108e1b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  asm volatile("rdtsc" : "=A" (t));
+80108e1e:	0f 31                	rdtsc
+80108e20:	89 c1                	mov    %eax,%ecx
+80108e22:	89 d0                	mov    %edx,%eax
+  struct timer t, **pp;
+
+  if(rdtsc() >= when)
+80108e24:	39 f1                	cmp    %esi,%ecx
+80108e26:	19 d8                	sbb    %ebx,%eax
+80108e28:	72 0e                	jb     80108e38 <sleepuntil+0x28>
+    }
+    sleep(&t, &tq.lock);
+  }
+  release(&tq.lock);
+  return 0;
+}
+80108e2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+80108e2d:	31 c0                	xor    %eax,%eax
+}
+80108e2f:	5b                   	pop    %ebx
+80108e30:	5e                   	pop    %esi
+80108e31:	5d                   	pop    %ebp
+80108e32:	c3                   	ret
+80108e33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108e37:	90                   	nop
+  acquire(&tq.lock);
+80108e38:	83 ec 0c             	sub    $0xc,%esp
+  t.when = when;
+80108e3b:	89 75 e8             	mov    %esi,-0x18(%ebp)
+80108e3e:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  t.pending = 1;
+80108e41:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  acquire(&tq.lock);
+80108e48:	68 00 80 15 80       	push   $0x80158000
+80108e4d:	e8 de de ff ff       	call   80106d30 <acquire>
+  for(pp = &tq.head; *pp && (*pp)->when <= when; pp = &(*pp)->next)
+80108e52:	a1 54 80 15 80       	mov    0x80158054,%eax
+80108e57:	83 c4 10             	add    $0x10,%esp
+80108e5a:	ba 54 80 15 80       	mov    $0x80158054,%edx
+80108e5f:	85 c0                	test   %eax,%eax
+80108e61:	75 0f                	jne    80108e72 <sleepuntil+0x62>
+80108e63:	eb 16                	jmp    80108e7b <sleepuntil+0x6b>
+80108e65:	8d 76 00             	lea    0x0(%esi),%esi
+80108e68:	8d 50 08             	lea    0x8(%eax),%edx
+80108e6b:	8b 40 08             	mov    0x8(%eax),%eax
+80108e6e:	85 c0                	test   %eax,%eax
+80108e70:	74 09                	je     80108e7b <sleepuntil+0x6b>
+80108e72:	3b 30                	cmp    (%eax),%esi
+80108e74:	89 d9                	mov    %ebx,%ecx
+80108e76:	1b 48 04             	sbb    0x4(%eax),%ecx
+80108e79:	73 ed                	jae    80108e68 <sleepuntil+0x58>
+  *pp = &t;
+80108e7b:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  t.next = *pp;
+80108e7e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  *pp = &t;
+80108e81:	89 1a                	mov    %ebx,(%edx)
+  if(tq.head == &t)
+80108e83:	39 1d 54 80 15 80    	cmp    %ebx,0x80158054
+80108e89:	75 25                	jne    80108eb0 <sleepuntil+0xa0>
+80108e8b:	e9 c8 00 00 00       	jmp    80108f58 <sleepuntil+0x148>
+    if(myproc()->killed){
+80108e90:	e8 9b c1 ff ff       	call   80105030 <myproc>
+80108e95:	8b 90 90 00 00 00    	mov    0x90(%eax),%edx
+80108e9b:	85 d2                	test   %edx,%edx
+80108e9d:	75 31                	jne    80108ed0 <sleepuntil+0xc0>
+    sleep(&t, &tq.lock);
+80108e9f:	83 ec 08             	sub    $0x8,%esp
+80108ea2:	68 00 80 15 80       	push   $0x80158000
+80108ea7:	53                   	push   %ebx
+80108ea8:	e8 b3 c8 ff ff       	call   80105760 <sleep>
+  while(t.pending){
+80108ead:	83 c4 10             	add    $0x10,%esp
+80108eb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108eb3:	85 c0                	test   %eax,%eax
+80108eb5:	75 d9                	jne    80108e90 <sleepuntil+0x80>
+  release(&tq.lock);
+80108eb7:	83 ec 0c             	sub    $0xc,%esp
+80108eba:	68 00 80 15 80       	push   $0x80158000
+80108ebf:	e8 2c dd ff ff       	call   80106bf0 <release>
+  return 0;
+80108ec4:	83 c4 10             	add    $0x10,%esp
+80108ec7:	e9 5e ff ff ff       	jmp    80108e2a <sleepuntil+0x1a>
+80108ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      for(pp = &tq.head; *pp != &t; pp = &(*pp)->next)
+80108ed0:	a1 54 80 15 80       	mov    0x80158054,%eax
+80108ed5:	39 d8                	cmp    %ebx,%eax
+80108ed7:	0f 84 c8 00 00 00    	je     80108fa5 <sleepuntil+0x195>
+80108edd:	8d 76 00             	lea    0x0(%esi),%esi
+80108ee0:	89 c2                	mov    %eax,%edx
+80108ee2:	8b 40 08             	mov    0x8(%eax),%eax
+80108ee5:	39 d8                	cmp    %ebx,%eax
+80108ee7:	75 f7                	jne    80108ee0 <sleepuntil+0xd0>
+80108ee9:	83 c2 08             	add    $0x8,%edx
+      *pp = t.next;
+80108eec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108eef:	89 02                	mov    %eax,(%edx)
+  tq.seq++;
+80108ef1:	a1 58 80 15 80       	mov    0x80158058,%eax
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108ef6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  tq.seq++;
+80108efb:	83 c0 01             	add    $0x1,%eax
+80108efe:	a3 58 80 15 80       	mov    %eax,0x80158058
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f03:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  __sync_synchronize();
+80108f08:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f0d:	8b 0d 54 80 15 80    	mov    0x80158054,%ecx
+80108f13:	85 c9                	test   %ecx,%ecx
+80108f15:	74 05                	je     80108f1c <sleepuntil+0x10c>
+80108f17:	8b 01                	mov    (%ecx),%eax
+80108f19:	8b 51 04             	mov    0x4(%ecx),%edx
+80108f1c:	a3 5c 80 15 80       	mov    %eax,0x8015805c
+      release(&tq.lock);
+80108f21:	83 ec 0c             	sub    $0xc,%esp
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f24:	89 15 60 80 15 80    	mov    %edx,0x80158060
+  __sync_synchronize();
+80108f2a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.seq++;
+80108f2f:	a1 58 80 15 80       	mov    0x80158058,%eax
+80108f34:	83 c0 01             	add    $0x1,%eax
+80108f37:	a3 58 80 15 80       	mov    %eax,0x80158058
+      release(&tq.lock);
+80108f3c:	68 00 80 15 80       	push   $0x80158000
+80108f41:	e8 aa dc ff ff       	call   80106bf0 <release>
+      return -1;
+80108f46:	83 c4 10             	add    $0x10,%esp
+}
+80108f49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return -1;
+80108f4c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108f51:	5b                   	pop    %ebx
+80108f52:	5e                   	pop    %esi
+80108f53:	5d                   	pop    %ebp
+80108f54:	c3                   	ret
+80108f55:	8d 76 00             	lea    0x0(%esi),%esi
+  tq.seq++;
+80108f58:	a1 58 80 15 80       	mov    0x80158058,%eax
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f5d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  tq.seq++;
+80108f62:	83 c0 01             	add    $0x1,%eax
+80108f65:	a3 58 80 15 80       	mov    %eax,0x80158058
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f6a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  __sync_synchronize();
+80108f6f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.next = tq.head ? tq.head->when : NEVER;
+80108f74:	8b 0d 54 80 15 80    	mov    0x80158054,%ecx
+80108f7a:	85 c9                	test   %ecx,%ecx
+80108f7c:	74 05                	je     80108f83 <sleepuntil+0x173>
+80108f7e:	8b 01                	mov    (%ecx),%eax
+80108f80:	8b 51 04             	mov    0x4(%ecx),%edx
+80108f83:	a3 5c 80 15 80       	mov    %eax,0x8015805c
+80108f88:	89 15 60 80 15 80    	mov    %edx,0x80158060
+  __sync_synchronize();
+80108f8e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.seq++;
+80108f93:	a1 58 80 15 80       	mov    0x80158058,%eax
+80108f98:	83 c0 01             	add    $0x1,%eax
+80108f9b:	a3 58 80 15 80       	mov    %eax,0x80158058
+}
+80108fa0:	e9 0b ff ff ff       	jmp    80108eb0 <sleepuntil+0xa0>
+      for(pp = &tq.head; *pp != &t; pp = &(*pp)->next)
+80108fa5:	ba 54 80 15 80       	mov    $0x80158054,%edx
+80108faa:	e9 3d ff ff ff       	jmp    80108eec <sleepuntil+0xdc>
+80108faf:	90                   	nop
+
+80108fb0 <sleepticks>:
+
+// Sleep until n ticks after the start of the current one.
+int
+sleepticks(uint n)
+{
+80108fb0:	55                   	push   %ebp
+80108fb1:	89 e5                	mov    %esp,%ebp
+80108fb3:	53                   	push   %ebx
+80108fb4:	83 ec 10             	sub    $0x10,%esp
+  uint t0;
+
+  acquire(&tickslock);
+80108fb7:	68 a0 7f 15 80       	push   $0x80157fa0
+80108fbc:	e8 6f dd ff ff       	call   80106d30 <acquire>
+  tickupdate();
+80108fc1:	e8 9a fd ff ff       	call   80108d60 <tickupdate>
+  t0 = ticks;
+80108fc6:	8b 1d 80 7f 15 80    	mov    0x80157f80,%ebx
+  release(&tickslock);
+80108fcc:	c7 04 24 a0 7f 15 80 	movl   $0x80157fa0,(%esp)
+80108fd3:	e8 18 dc ff ff       	call   80106bf0 <release>
+  return sleepuntil(tsc0 + ((uint64)t0 + n) * tickcycles);
+80108fd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80108fdb:	58                   	pop    %eax
+80108fdc:	89 d8                	mov    %ebx,%eax
+80108fde:	5a                   	pop    %edx
+80108fdf:	31 db                	xor    %ebx,%ebx
+80108fe1:	31 d2                	xor    %edx,%edx
+80108fe3:	01 c8                	add    %ecx,%eax
+80108fe5:	8b 0d 74 80 15 80    	mov    0x80158074,%ecx
+80108feb:	11 da                	adc    %ebx,%edx
+80108fed:	0f af ca             	imul   %edx,%ecx
+80108ff0:	f7 25 74 80 15 80    	mull   0x80158074
+80108ff6:	01 ca                	add    %ecx,%edx
+80108ff8:	03 05 68 80 15 80    	add    0x80158068,%eax
+80108ffe:	13 15 6c 80 15 80    	adc    0x8015806c,%edx
+80109004:	52                   	push   %edx
+80109005:	50                   	push   %eax
+80109006:	e8 05 fe ff ff       	call   80108e10 <sleepuntil>
+}
+8010900b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010900e:	c9                   	leave
+8010900f:	c3                   	ret
+
+80109010 <sleepns>:
+
+// Sleep for sec seconds and nsec nanoseconds. A sleep too long
+// for the TSC to count to lasts until the process is killed.
+int
+sleepns(uint sec, uint nsec)
+{
+80109010:	55                   	push   %ebp
+80109011:	89 e5                	mov    %esp,%ebp
+80109013:	57                   	push   %edi
+80109014:	56                   	push   %esi
+80109015:	53                   	push   %ebx
+80109016:	83 ec 2c             	sub    $0x2c,%esp
+80109019:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010901c:	0f 31                	rdtsc
+8010901e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  ms = (uint64)sec * 1000 + nsec / 1000000;
+80109021:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+80109026:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80109029:	f7 65 08             	mull   0x8(%ebp)
+8010902c:	89 c6                	mov    %eax,%esi
+8010902e:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+80109033:	89 d7                	mov    %edx,%edi
+80109035:	f7 e1                	mul    %ecx
+80109037:	89 d0                	mov    %edx,%eax
+80109039:	31 d2                	xor    %edx,%edx
+8010903b:	c1 e8 12             	shr    $0x12,%eax
+8010903e:	01 c6                	add    %eax,%esi
+80109040:	11 d7                	adc    %edx,%edi
+  hi = (ms >> 32) * tsckhz;
+80109042:	89 75 d0             	mov    %esi,-0x30(%ebp)
+    return NEVER;
+80109045:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  ms = (uint64)sec * 1000 + nsec / 1000000;
+8010904a:	89 fa                	mov    %edi,%edx
+  hi = (ms >> 32) * tsckhz;
+8010904c:	8b 3d 70 80 15 80    	mov    0x80158070,%edi
+80109052:	89 d0                	mov    %edx,%eax
+80109054:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80109057:	f7 e7                	mul    %edi
+80109059:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    return NEVER;
+8010905c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  if(hi >> 32)
+80109061:	89 d3                	mov    %edx,%ebx
+80109063:	83 cb 00             	or     $0x0,%ebx
+80109066:	75 68                	jne    801090d0 <sleepns+0xc0>
+  c = (hi << 32) + (uint)ms * (uint64)tsckhz;
+80109068:	89 c7                	mov    %eax,%edi
+8010906a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010906d:	f7 65 e4             	mull   -0x1c(%ebp)
+80109070:	31 f6                	xor    %esi,%esi
+80109072:	31 db                	xor    %ebx,%ebx
+80109074:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+8010907b:	01 c6                	add    %eax,%esi
+8010907d:	11 d7                	adc    %edx,%edi
+8010907f:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80109082:	89 7d cc             	mov    %edi,-0x34(%ebp)
+80109085:	0f 82 98 00 00 00    	jb     80109123 <sleepns+0x113>
+  d = divl((uint64)(nsec % 1000000) * tsckhz, 1000000);
+8010908b:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+    return NEVER;
+80109090:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80109095:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  d = divl((uint64)(nsec % 1000000) * tsckhz, 1000000);
+8010909a:	f7 e1                	mul    %ecx
+8010909c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010909f:	c1 ea 12             	shr    $0x12,%edx
+801090a2:	69 d2 40 42 0f 00    	imul   $0xf4240,%edx,%edx
+801090a8:	29 d1                	sub    %edx,%ecx
+801090aa:	f7 e1                	mul    %ecx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+801090ac:	b9 40 42 0f 00       	mov    $0xf4240,%ecx
+801090b1:	f7 f1                	div    %ecx
+  if(c < (hi << 32) || c + d < c)
+801090b3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  d = divl((uint64)(nsec % 1000000) * tsckhz, 1000000);
+801090b6:	31 d2                	xor    %edx,%edx
+  if(c < (hi << 32) || c + d < c)
+801090b8:	09 d9                	or     %ebx,%ecx
+801090ba:	75 14                	jne    801090d0 <sleepns+0xc0>
+801090bc:	31 c9                	xor    %ecx,%ecx
+801090be:	31 db                	xor    %ebx,%ebx
+801090c0:	03 45 c8             	add    -0x38(%ebp),%eax
+801090c3:	13 55 cc             	adc    -0x34(%ebp),%edx
+801090c6:	72 67                	jb     8010912f <sleepns+0x11f>
+801090c8:	09 d9                	or     %ebx,%ecx
+801090ca:	89 c6                	mov    %eax,%esi
+801090cc:	89 d7                	mov    %edx,%edi
+801090ce:	75 40                	jne    80109110 <sleepns+0x100>
+  uint64 now, d;
+
+  now = rdtsc();
+  d = nstocycles(sec, nsec);
+  return sleepuntil(d > NEVER - now ? NEVER : now + d);
+801090d0:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801090d3:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801090d6:	31 c0                	xor    %eax,%eax
+801090d8:	31 d2                	xor    %edx,%edx
+801090da:	01 f1                	add    %esi,%ecx
+801090dc:	11 fb                	adc    %edi,%ebx
+801090de:	72 3c                	jb     8010911c <sleepns+0x10c>
+801090e0:	09 d0                	or     %edx,%eax
+801090e2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+801090e7:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801090ec:	75 0a                	jne    801090f8 <sleepns+0xe8>
+801090ee:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801090f1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801090f4:	01 f1                	add    %esi,%ecx
+801090f6:	11 fb                	adc    %edi,%ebx
+801090f8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+801090fb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+}
+801090fe:	83 c4 2c             	add    $0x2c,%esp
+80109101:	5b                   	pop    %ebx
+80109102:	5e                   	pop    %esi
+80109103:	5f                   	pop    %edi
+80109104:	5d                   	pop    %ebp
+  return sleepuntil(d > NEVER - now ? NEVER : now + d);
+80109105:	e9 06 fd ff ff       	jmp    80108e10 <sleepuntil>
+8010910a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return NEVER;
+80109110:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80109115:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+8010911a:	eb b4                	jmp    801090d0 <sleepns+0xc0>
+8010911c:	b8 01 00 00 00       	mov    $0x1,%eax
+80109121:	eb bd                	jmp    801090e0 <sleepns+0xd0>
+80109123:	c7 45 d0 01 00 00 00 	movl   $0x1,-0x30(%ebp)
+8010912a:	e9 5c ff ff ff       	jmp    8010908b <sleepns+0x7b>
+8010912f:	b9 01 00 00 00       	mov    $0x1,%ecx
+80109134:	eb 92                	jmp    801090c8 <sleepns+0xb8>
+80109136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010913d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109140 <timerintr>:
+// Handle a timer interrupt. Charges the ticks since this CPU last
+// looked to the process running on it, and returns how many
+// there were.
+int
+timerintr(struct trapframe *tf)
+{
+80109140:	55                   	push   %ebp
+80109141:	89 e5                	mov    %esp,%ebp
+80109143:	57                   	push   %edi
+80109144:	56                   	push   %esi
+80109145:	53                   	push   %ebx
+80109146:	83 ec 1c             	sub    $0x1c,%esp
+  struct cpu *c = mycpu();
+80109149:	e8 d2 be ff ff       	call   80105020 <mycpu>
+8010914e:	89 c6                	mov    %eax,%esi
+  struct proc *p = myproc();
+80109150:	e8 db be ff ff       	call   80105030 <myproc>
+80109155:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  asm volatile("rdtsc" : "=A" (t));
+80109158:	0f 31                	rdtsc
+  if(clockticks() != ticks){  // unlocked peek
+8010915a:	8b 3d 80 7f 15 80    	mov    0x80157f80,%edi
+  return divl(rdtsc() - tsc0, tickcycles);
+80109160:	2b 05 68 80 15 80    	sub    0x80158068,%eax
+80109166:	1b 15 6c 80 15 80    	sbb    0x8015806c,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+8010916c:	f7 35 74 80 15 80    	divl   0x80158074
+  if(clockticks() != ticks){  // unlocked peek
+80109172:	39 f8                	cmp    %edi,%eax
+80109174:	74 2a                	je     801091a0 <timerintr+0x60>
+    acquire(&tickslock);
+80109176:	83 ec 0c             	sub    $0xc,%esp
+80109179:	68 a0 7f 15 80       	push   $0x80157fa0
+8010917e:	e8 ad db ff ff       	call   80106d30 <acquire>
+    tickupdate();
+80109183:	e8 d8 fb ff ff       	call   80108d60 <tickupdate>
+    release(&tickslock);
+80109188:	c7 04 24 a0 7f 15 80 	movl   $0x80157fa0,(%esp)
+8010918f:	e8 5c da ff ff       	call   80106bf0 <release>
+  return ticks;
+80109194:	8b 3d 80 7f 15 80    	mov    0x80157f80,%edi
+8010919a:	83 c4 10             	add    $0x10,%esp
+tqpeek(void)
+8010919d:	8d 76 00             	lea    0x0(%esi),%esi
+    seq = tq.seq;
+801091a0:	a1 58 80 15 80       	mov    0x80158058,%eax
+    __sync_synchronize();
+801091a5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    next = tq.next;
+801091aa:	8b 0d 5c 80 15 80    	mov    0x8015805c,%ecx
+801091b0:	8b 1d 60 80 15 80    	mov    0x80158060,%ebx
+    __sync_synchronize();
+801091b6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != tq.seq);
+801091bb:	a8 01                	test   $0x1,%al
+801091bd:	75 e1                	jne    801091a0 <timerintr+0x60>
+801091bf:	8b 15 58 80 15 80    	mov    0x80158058,%edx
+801091c5:	39 d0                	cmp    %edx,%eax
+801091c7:	75 d7                	jne    801091a0 <timerintr+0x60>
+  asm volatile("rdtsc" : "=A" (t));
+801091c9:	0f 31                	rdtsc
+801091cb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801091ce:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  uint now;
+  int n;
+
+  now = readticks();
+  if(tqpeek() <= rdtsc())
+801091d1:	39 c8                	cmp    %ecx,%eax
+801091d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801091d6:	19 da                	sbb    %ebx,%edx
+801091d8:	0f 83 c2 00 00 00    	jae    801092a0 <timerintr+0x160>
+    tqexpire();
+  n = now - c->lasttick;
+  c->lasttick = now;
+  if(p && n > 0){
+801091de:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  n = now - c->lasttick;
+801091e1:	89 f8                	mov    %edi,%eax
+801091e3:	2b 86 bc 00 00 00    	sub    0xbc(%esi),%eax
+  c->lasttick = now;
+801091e9:	89 be bc 00 00 00    	mov    %edi,0xbc(%esi)
+  if(p && n > 0){
+801091ef:	85 d2                	test   %edx,%edx
+801091f1:	74 21                	je     80109214 <timerintr+0xd4>
+801091f3:	85 c0                	test   %eax,%eax
+801091f5:	7e 1d                	jle    80109214 <timerintr+0xd4>
+    if((tf->cs&3) == DPL_USER)
+801091f7:	8b 55 08             	mov    0x8(%ebp),%edx
+801091fa:	0f b7 52 3c          	movzwl 0x3c(%edx),%edx
+801091fe:	83 e2 03             	and    $0x3,%edx
+80109201:	66 83 fa 03          	cmp    $0x3,%dx
+80109205:	0f 84 c8 00 00 00    	je     801092d3 <timerintr+0x193>
+      p->uticks += n;
+    else
+      p->sticks += n;
+8010920b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010920e:	01 87 08 01 00 00    	add    %eax,0x108(%edi)
+  }
+  return n;
+}
+80109214:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109217:	5b                   	pop    %ebx
+80109218:	5e                   	pop    %esi
+80109219:	5f                   	pop    %edi
+8010921a:	5d                   	pop    %ebp
+8010921b:	c3                   	ret
+8010921c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109220:	0f 31                	rdtsc
+80109222:	89 c1                	mov    %eax,%ecx
+80109224:	89 d0                	mov    %edx,%eax
+    if((t = tq.head) == 0 || t->when > rdtsc()){
+80109226:	3b 0b                	cmp    (%ebx),%ecx
+80109228:	1b 43 04             	sbb    0x4(%ebx),%eax
+8010922b:	0f 82 8d 00 00 00    	jb     801092be <timerintr+0x17e>
+    tq.head = t->next;
+80109231:	8b 43 08             	mov    0x8(%ebx),%eax
+  tq.next = tq.head ? tq.head->when : NEVER;
+80109234:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    tq.head = t->next;
+80109239:	a3 54 80 15 80       	mov    %eax,0x80158054
+    t->pending = 0;
+8010923e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  tq.seq++;
+80109245:	a1 58 80 15 80       	mov    0x80158058,%eax
+8010924a:	83 c0 01             	add    $0x1,%eax
+8010924d:	a3 58 80 15 80       	mov    %eax,0x80158058
+  tq.next = tq.head ? tq.head->when : NEVER;
+80109252:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  __sync_synchronize();
+80109257:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.next = tq.head ? tq.head->when : NEVER;
+8010925c:	8b 0d 54 80 15 80    	mov    0x80158054,%ecx
+80109262:	85 c9                	test   %ecx,%ecx
+80109264:	74 05                	je     8010926b <timerintr+0x12b>
+80109266:	8b 01                	mov    (%ecx),%eax
+80109268:	8b 51 04             	mov    0x4(%ecx),%edx
+8010926b:	a3 5c 80 15 80       	mov    %eax,0x8015805c
+    release(&tq.lock);
+80109270:	83 ec 0c             	sub    $0xc,%esp
+  tq.next = tq.head ? tq.head->when : NEVER;
+80109273:	89 15 60 80 15 80    	mov    %edx,0x80158060
+  __sync_synchronize();
+80109279:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  tq.seq++;
+8010927e:	a1 58 80 15 80       	mov    0x80158058,%eax
+80109283:	83 c0 01             	add    $0x1,%eax
+80109286:	a3 58 80 15 80       	mov    %eax,0x80158058
+    release(&tq.lock);
+8010928b:	68 00 80 15 80       	push   $0x80158000
+80109290:	e8 5b d9 ff ff       	call   80106bf0 <release>
+    wakeup(t);
+80109295:	89 1c 24             	mov    %ebx,(%esp)
+80109298:	e8 73 c7 ff ff       	call   80105a10 <wakeup>
+    acquire(&tq.lock);
+8010929d:	83 c4 10             	add    $0x10,%esp
+801092a0:	83 ec 0c             	sub    $0xc,%esp
+801092a3:	68 00 80 15 80       	push   $0x80158000
+801092a8:	e8 83 da ff ff       	call   80106d30 <acquire>
+    if((t = tq.head) == 0 || t->when > rdtsc()){
+801092ad:	8b 1d 54 80 15 80    	mov    0x80158054,%ebx
+801092b3:	83 c4 10             	add    $0x10,%esp
+801092b6:	85 db                	test   %ebx,%ebx
+801092b8:	0f 85 62 ff ff ff    	jne    80109220 <timerintr+0xe0>
+      release(&tq.lock);
+801092be:	83 ec 0c             	sub    $0xc,%esp
+801092c1:	68 00 80 15 80       	push   $0x80158000
+801092c6:	e8 25 d9 ff ff       	call   80106bf0 <release>
+      return;
+801092cb:	83 c4 10             	add    $0x10,%esp
+801092ce:	e9 0b ff ff ff       	jmp    801091de <timerintr+0x9e>
+      p->uticks += n;
+801092d3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801092d6:	01 86 04 01 00 00    	add    %eax,0x104(%esi)
+}
+801092dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801092df:	5b                   	pop    %ebx
+801092e0:	5e                   	pop    %esi
+801092e1:	5f                   	pop    %edi
+801092e2:	5d                   	pop    %ebp
+801092e3:	c3                   	ret
+801092e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801092eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801092ef:	90                   	nop
+
+801092f0 <timerarm>:
+
+// Arm this CPU's timer for the next thing it has to do, at most
+// MAXIDLE ticks away. Interrupts must be off.
+void
+timerarm(void)
+{
+801092f0:	55                   	push   %ebp
+801092f1:	89 e5                	mov    %esp,%ebp
+801092f3:	57                   	push   %edi
+801092f4:	56                   	push   %esi
+801092f5:	53                   	push   %ebx
+801092f6:	83 ec 2c             	sub    $0x2c,%esp
+  struct cpu *c = mycpu();
+801092f9:	e8 22 bd ff ff       	call   80105020 <mycpu>
+801092fe:	89 c3                	mov    %eax,%ebx
+  uint64 now, when, end;
+  int q;
+
+  if(profiling()){
+80109300:	e8 fb cf ff ff       	call   80106300 <profiling>
+80109305:	85 c0                	test   %eax,%eax
+80109307:	0f 85 53 01 00 00    	jne    80109460 <timerarm+0x170>
+8010930d:	8d 76 00             	lea    0x0(%esi),%esi
+    seq = tq.seq;
+80109310:	a1 58 80 15 80       	mov    0x80158058,%eax
+    __sync_synchronize();
+80109315:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    next = tq.next;
+8010931a:	8b 35 5c 80 15 80    	mov    0x8015805c,%esi
+80109320:	8b 3d 60 80 15 80    	mov    0x80158060,%edi
+    __sync_synchronize();
+80109326:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != tq.seq);
+8010932b:	a8 01                	test   $0x1,%al
+8010932d:	75 e1                	jne    80109310 <timerarm+0x20>
+8010932f:	8b 15 58 80 15 80    	mov    0x80158058,%edx
+80109335:	39 d0                	cmp    %edx,%eax
+80109337:	75 d7                	jne    80109310 <timerarm+0x20>
+
+  // Say we're running without a time slice before looking for
+  // waiting processes, so that setrunnable() either sees the
+  // flag and sends an IPI, or queued a process quantum() sees.
+  when = tqpeek();
+  if(c->proc){
+80109339:	8b 93 e8 00 00 00    	mov    0xe8(%ebx),%edx
+8010933f:	85 d2                	test   %edx,%edx
+80109341:	74 5d                	je     801093a0 <timerarm+0xb0>
+  asm volatile("lock; xchgl %0, %1" :
+80109343:	b8 01 00 00 00       	mov    $0x1,%eax
+80109348:	f0 87 83 b8 00 00 00 	lock xchg %eax,0xb8(%ebx)
+    xchg(&c->unsliced, 1);
+    if((q = quantum()) > 0){
+8010934f:	e8 bc c3 ff ff       	call   80105710 <quantum>
+80109354:	85 c0                	test   %eax,%eax
+80109356:	0f 8e d4 00 00 00    	jle    80109430 <timerarm+0x140>
+      c->unsliced = 0;
+      end = tsc0 + (uint64)(c->lasttick + q) * tickcycles;
+8010935c:	8b 15 74 80 15 80    	mov    0x80158074,%edx
+80109362:	03 83 bc 00 00 00    	add    0xbc(%ebx),%eax
+      c->unsliced = 0;
+80109368:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+8010936f:	00 00 00 
+      end = tsc0 + (uint64)(c->lasttick + q) * tickcycles;
+80109372:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+80109379:	89 55 d0             	mov    %edx,-0x30(%ebp)
+8010937c:	f7 e2                	mul    %edx
+8010937e:	03 05 68 80 15 80    	add    0x80158068,%eax
+80109384:	13 15 6c 80 15 80    	adc    0x8015806c,%edx
+      if(end < when)
+8010938a:	39 f0                	cmp    %esi,%eax
+8010938c:	89 d1                	mov    %edx,%ecx
+8010938e:	19 f9                	sbb    %edi,%ecx
+80109390:	0f 83 9a 00 00 00    	jae    80109430 <timerarm+0x140>
+80109396:	89 c6                	mov    %eax,%esi
+80109398:	89 d7                	mov    %edx,%edi
+8010939a:	eb 21                	jmp    801093bd <timerarm+0xcd>
+8010939c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        when = end;
+    }
+  }
+  if(when == NEVER && c->proc == 0){
+801093a0:	89 fa                	mov    %edi,%edx
+801093a2:	89 f0                	mov    %esi,%eax
+801093a4:	f7 d2                	not    %edx
+801093a6:	f7 d0                	not    %eax
+801093a8:	09 c2                	or     %eax,%edx
+801093aa:	0f 84 9e 00 00 00    	je     8010944e <timerarm+0x15e>
+    lapiconeshot(0);  // idle until an interrupt
+    return;
+  }
+
+  now = rdtsc();
+  if(when > now + (uint64)MAXIDLE * tickcycles)
+801093b0:	a1 74 80 15 80       	mov    0x80158074,%eax
+801093b5:	31 d2                	xor    %edx,%edx
+801093b7:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801093ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  asm volatile("rdtsc" : "=A" (t));
+801093bd:	0f 31                	rdtsc
+801093bf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801093c2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+801093c5:	8b 55 d0             	mov    -0x30(%ebp),%edx
+801093c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801093cb:	b8 64 00 00 00       	mov    $0x64,%eax
+801093d0:	6b d9 64             	imul   $0x64,%ecx,%ebx
+801093d3:	89 f9                	mov    %edi,%ecx
+801093d5:	f7 e2                	mul    %edx
+801093d7:	01 da                	add    %ebx,%edx
+801093d9:	03 45 e0             	add    -0x20(%ebp),%eax
+801093dc:	13 55 e4             	adc    -0x1c(%ebp),%edx
+801093df:	39 c6                	cmp    %eax,%esi
+801093e1:	19 d1                	sbb    %edx,%ecx
+801093e3:	89 f1                	mov    %esi,%ecx
+801093e5:	0f 43 c8             	cmovae %eax,%ecx
+    when = now + (uint64)MAXIDLE * tickcycles;
+  lapiconeshot(when > now ? when - now : 1);
+801093e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801093eb:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+801093ee:	89 f9                	mov    %edi,%ecx
+801093f0:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801093f3:	0f 43 ca             	cmovae %edx,%ecx
+801093f6:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+801093f9:	ba 00 00 00 00       	mov    $0x0,%edx
+801093fe:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80109401:	8b 7d dc             	mov    -0x24(%ebp),%edi
+80109404:	19 f8                	sbb    %edi,%eax
+80109406:	b8 01 00 00 00       	mov    $0x1,%eax
+8010940b:	73 0a                	jae    80109417 <timerarm+0x127>
+8010940d:	89 f0                	mov    %esi,%eax
+8010940f:	89 fa                	mov    %edi,%edx
+80109411:	2b 45 e0             	sub    -0x20(%ebp),%eax
+80109414:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+80109417:	83 ec 08             	sub    $0x8,%esp
+8010941a:	52                   	push   %edx
+8010941b:	50                   	push   %eax
+8010941c:	e8 6f a2 ff ff       	call   80103690 <lapiconeshot>
+80109421:	83 c4 10             	add    $0x10,%esp
+}
+80109424:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109427:	5b                   	pop    %ebx
+80109428:	5e                   	pop    %esi
+80109429:	5f                   	pop    %edi
+8010942a:	5d                   	pop    %ebp
+8010942b:	c3                   	ret
+8010942c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(when == NEVER && c->proc == 0){
+80109430:	89 fa                	mov    %edi,%edx
+80109432:	89 f0                	mov    %esi,%eax
+80109434:	f7 d2                	not    %edx
+80109436:	f7 d0                	not    %eax
+80109438:	09 c2                	or     %eax,%edx
+8010943a:	0f 85 70 ff ff ff    	jne    801093b0 <timerarm+0xc0>
+80109440:	8b 83 e8 00 00 00    	mov    0xe8(%ebx),%eax
+80109446:	85 c0                	test   %eax,%eax
+80109448:	0f 85 62 ff ff ff    	jne    801093b0 <timerarm+0xc0>
+    lapiconeshot(0);  // idle until an interrupt
+8010944e:	83 ec 08             	sub    $0x8,%esp
+80109451:	6a 00                	push   $0x0
+80109453:	6a 00                	push   $0x0
+80109455:	e8 36 a2 ff ff       	call   80103690 <lapiconeshot>
+    return;
+8010945a:	83 c4 10             	add    $0x10,%esp
+8010945d:	eb c5                	jmp    80109424 <timerarm+0x134>
+8010945f:	90                   	nop
+    c->unsliced = 0;
+80109460:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+80109467:	00 00 00 
+    lapictimer(profiling());
+8010946a:	e8 91 ce ff ff       	call   80106300 <profiling>
+8010946f:	83 ec 0c             	sub    $0xc,%esp
+80109472:	50                   	push   %eax
+80109473:	e8 d8 a1 ff ff       	call   80103650 <lapictimer>
+    return;
+80109478:	83 c4 10             	add    $0x10,%esp
+}
+8010947b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010947e:	5b                   	pop    %ebx
+8010947f:	5e                   	pop    %esi
+80109480:	5f                   	pop    %edi
+80109481:	5d                   	pop    %ebp
+80109482:	c3                   	ret
+80109483:	66 90                	xchg   %ax,%ax
+80109485:	66 90                	xchg   %ax,%ax
+80109487:	66 90                	xchg   %ax,%ax
+80109489:	66 90                	xchg   %ax,%ax
+8010948b:	66 90                	xchg   %ax,%ax
+8010948d:	66 90                	xchg   %ax,%ax
+8010948f:	90                   	nop
+
+80109490 <traceinit>:
+static struct spinlock tracelock;  // serializes readers, protects r
+static int tracing;
+
+void
+traceinit(void)
+{
+80109490:	55                   	push   %ebp
+80109491:	89 e5                	mov    %esp,%ebp
+80109493:	83 ec 10             	sub    $0x10,%esp
+  initlock(&tracelock, "trace");
+80109496:	68 af ba 10 80       	push   $0x8010baaf
+8010949b:	68 a0 80 15 80       	push   $0x801580a0
+801094a0:	e8 3b d5 ff ff       	call   801069e0 <initlock>
+}
+801094a5:	83 c4 10             	add    $0x10,%esp
+801094a8:	c9                   	leave
+801094a9:	c3                   	ret
+801094aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801094b0 <trace>:
+
+// Record an event on this CPU, if tracing is on.
+void
+trace(int type, uint a0, uint a1)
+{
+801094b0:	55                   	push   %ebp
+801094b1:	89 e5                	mov    %esp,%ebp
+801094b3:	57                   	push   %edi
+801094b4:	56                   	push   %esi
+801094b5:	53                   	push   %ebx
+801094b6:	83 ec 2c             	sub    $0x2c,%esp
+801094b9:	8b 45 10             	mov    0x10(%ebp),%eax
+801094bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+801094bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+801094c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct tracebuf *tb;
+  struct traceev *e;
+  struct proc *p;
+
+  if(!tracing)
+801094c5:	a1 80 80 15 80       	mov    0x80158080,%eax
+801094ca:	85 c0                	test   %eax,%eax
+801094cc:	75 12                	jne    801094e0 <trace+0x30>
+  e->pid = (p = myproc()) ? p->pid : 0;
+  e->a0 = a0;
+  e->a1 = a1;
+  tb->w++;
+  popcli();
+}
+801094ce:	83 c4 2c             	add    $0x2c,%esp
+801094d1:	5b                   	pop    %ebx
+801094d2:	5e                   	pop    %esi
+801094d3:	5f                   	pop    %edi
+801094d4:	5d                   	pop    %ebp
+801094d5:	c3                   	ret
+801094d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094dd:	8d 76 00             	lea    0x0(%esi),%esi
+  pushcli();
+801094e0:	e8 1b d6 ff ff       	call   80106b00 <pushcli>
+  tb = &tbuf[cpuid()];
+801094e5:	e8 16 bb ff ff       	call   80105000 <cpuid>
+  e = &tb->ev[tb->w % NTRACE];
+801094ea:	69 c8 08 60 00 00    	imul   $0x6008,%eax,%ecx
+  tb = &tbuf[cpuid()];
+801094f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  e = &tb->ev[tb->w % NTRACE];
+801094f3:	8b 99 00 e1 15 80    	mov    -0x7fea1f00(%ecx),%ebx
+801094f9:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+801094ff:	0f 31                	rdtsc
+80109501:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  e->tsc = rdtsc();
+80109504:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+80109507:	89 45 d0             	mov    %eax,-0x30(%ebp)
+8010950a:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+8010950d:	8d 04 c1             	lea    (%ecx,%eax,8),%eax
+80109510:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80109513:	8b 55 d0             	mov    -0x30(%ebp),%edx
+80109516:	8d 88 00 81 15 80    	lea    -0x7fea7f00(%eax),%ecx
+8010951c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010951f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80109522:	89 90 00 81 15 80    	mov    %edx,-0x7fea7f00(%eax)
+80109528:	89 88 04 81 15 80    	mov    %ecx,-0x7fea7efc(%eax)
+  e->type = type;
+8010952e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80109531:	66 89 78 08          	mov    %di,0x8(%eax)
+  e->cpu = cpuid();
+80109535:	e8 c6 ba ff ff       	call   80105000 <cpuid>
+8010953a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010953d:	66 89 47 0a          	mov    %ax,0xa(%edi)
+  e->pid = (p = myproc()) ? p->pid : 0;
+80109541:	e8 ea ba ff ff       	call   80105030 <myproc>
+80109546:	31 c9                	xor    %ecx,%ecx
+80109548:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010954b:	85 c0                	test   %eax,%eax
+8010954d:	74 03                	je     80109552 <trace+0xa2>
+8010954f:	8b 48 64             	mov    0x64(%eax),%ecx
+80109552:	69 45 dc 08 60 00 00 	imul   $0x6008,-0x24(%ebp),%eax
+80109559:	01 da                	add    %ebx,%edx
+8010955b:	8d 94 d0 00 81 15 80 	lea    -0x7fea7f00(%eax,%edx,8),%edx
+  e->a0 = a0;
+80109562:	89 72 10             	mov    %esi,0x10(%edx)
+  e->a1 = a1;
+80109565:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  e->pid = (p = myproc()) ? p->pid : 0;
+80109568:	89 4a 0c             	mov    %ecx,0xc(%edx)
+  e->a1 = a1;
+8010956b:	89 72 14             	mov    %esi,0x14(%edx)
+  tb->w++;
+8010956e:	8b 90 00 e1 15 80    	mov    -0x7fea1f00(%eax),%edx
+80109574:	83 c2 01             	add    $0x1,%edx
+80109577:	89 90 00 e1 15 80    	mov    %edx,-0x7fea1f00(%eax)
+}
+8010957d:	83 c4 2c             	add    $0x2c,%esp
+80109580:	5b                   	pop    %ebx
+80109581:	5e                   	pop    %esi
+80109582:	5f                   	pop    %edi
+80109583:	5d                   	pop    %ebp
+  popcli();
+80109584:	e9 c7 d5 ff ff       	jmp    80106b50 <popcli>
+80109589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109590 <tracectl>:
+// Turn tracing on, forgetting any events not yet read, or off if
+// on is 0. Returns how many events have been overwritten before
+// they could be read.
+int
+tracectl(int on)
+{
+80109590:	55                   	push   %ebp
+80109591:	89 e5                	mov    %esp,%ebp
+80109593:	56                   	push   %esi
+80109594:	53                   	push   %ebx
+80109595:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct tracebuf *tb;
+  int lost;
+
+  acquire(&tracelock);
+80109598:	31 db                	xor    %ebx,%ebx
+8010959a:	83 ec 0c             	sub    $0xc,%esp
+8010959d:	68 a0 80 15 80       	push   $0x801580a0
+801095a2:	e8 89 d7 ff ff       	call   80106d30 <acquire>
+801095a7:	83 c4 10             	add    $0x10,%esp
+801095aa:	b8 00 81 15 80       	mov    $0x80158100,%eax
+801095af:	eb 1f                	jmp    801095d0 <tracectl+0x40>
+801095b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(on)
+    tracing = 0;
+  lost = 0;
+  for(tb = tbuf; tb < &tbuf[NCPU]; tb++){
+    if(on)
+      tb->r = tb->w;
+801095b8:	8b 90 00 60 00 00    	mov    0x6000(%eax),%edx
+801095be:	89 90 04 60 00 00    	mov    %edx,0x6004(%eax)
+  for(tb = tbuf; tb < &tbuf[NCPU]; tb++){
+801095c4:	05 08 60 00 00       	add    $0x6008,%eax
+801095c9:	3d 40 81 18 80       	cmp    $0x80188140,%eax
+801095ce:	74 35                	je     80109605 <tracectl+0x75>
+    if(on)
+801095d0:	85 f6                	test   %esi,%esi
+801095d2:	75 e4                	jne    801095b8 <tracectl+0x28>
+    else if(tb->w - tb->r > NTRACE)
+801095d4:	8b 90 00 60 00 00    	mov    0x6000(%eax),%edx
+801095da:	8b 88 04 60 00 00    	mov    0x6004(%eax),%ecx
+801095e0:	29 ca                	sub    %ecx,%edx
+801095e2:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+801095e8:	76 da                	jbe    801095c4 <tracectl+0x34>
+      lost += tb->w - tb->r - NTRACE;
+801095ea:	8b 90 00 60 00 00    	mov    0x6000(%eax),%edx
+  for(tb = tbuf; tb < &tbuf[NCPU]; tb++){
+801095f0:	05 08 60 00 00       	add    $0x6008,%eax
+      lost += tb->w - tb->r - NTRACE;
+801095f5:	8d 9c 1a 00 fc ff ff 	lea    -0x400(%edx,%ebx,1),%ebx
+801095fc:	29 cb                	sub    %ecx,%ebx
+  for(tb = tbuf; tb < &tbuf[NCPU]; tb++){
+801095fe:	3d 40 81 18 80       	cmp    $0x80188140,%eax
+80109603:	75 cf                	jne    801095d4 <tracectl+0x44>
+  }
+  tracing = on != 0;
+80109605:	31 c0                	xor    %eax,%eax
+80109607:	85 f6                	test   %esi,%esi
+80109609:	0f 95 c0             	setne  %al
+  release(&tracelock);
+8010960c:	83 ec 0c             	sub    $0xc,%esp
+  tracing = on != 0;
+8010960f:	a3 80 80 15 80       	mov    %eax,0x80158080
+  release(&tracelock);
+80109614:	68 a0 80 15 80       	push   $0x801580a0
+80109619:	e8 d2 d5 ff ff       	call   80106bf0 <release>
+  return lost;
+}
+8010961e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109621:	89 d8                	mov    %ebx,%eax
+80109623:	5b                   	pop    %ebx
+80109624:	5e                   	pop    %esi
+80109625:	5d                   	pop    %ebp
+80109626:	c3                   	ret
+80109627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010962e:	66 90                	xchg   %ax,%ax
+
+80109630 <traceread>:
+// Copy out up to n events, one CPU after another; each CPU's
+// events come out in the order they happened. Returns how many
+// were copied.
+int
+traceread(struct traceev *ev, int n)
+{
+80109630:	55                   	push   %ebp
+80109631:	89 e5                	mov    %esp,%ebp
+80109633:	57                   	push   %edi
+80109634:	56                   	push   %esi
+80109635:	53                   	push   %ebx
+  struct tracebuf *tb;
+  uint w;
+  int i;
+
+  i = 0;
+80109636:	31 db                	xor    %ebx,%ebx
+{
+80109638:	83 ec 28             	sub    $0x28,%esp
+  acquire(&tracelock);
+8010963b:	68 a0 80 15 80       	push   $0x801580a0
+80109640:	e8 eb d6 ff ff       	call   80106d30 <acquire>
+  for(tb = tbuf; tb < &tbuf[NCPU] && i < n; tb++){
+80109645:	8b 45 0c             	mov    0xc(%ebp),%eax
+80109648:	83 c4 10             	add    $0x10,%esp
+8010964b:	85 c0                	test   %eax,%eax
+8010964d:	0f 8e c0 00 00 00    	jle    80109713 <traceread+0xe3>
+80109653:	b9 00 81 15 80       	mov    $0x80158100,%ecx
+80109658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010965f:	90                   	nop
+    w = tb->w;
+80109660:	8b b9 00 60 00 00    	mov    0x6000(%ecx),%edi
+    if(w - tb->r > NTRACE)
+80109666:	8b 91 04 60 00 00    	mov    0x6004(%ecx),%edx
+8010966c:	89 f8                	mov    %edi,%eax
+8010966e:	29 d0                	sub    %edx,%eax
+80109670:	3d 00 04 00 00       	cmp    $0x400,%eax
+80109675:	0f 87 b5 00 00 00    	ja     80109730 <traceread+0x100>
+      tb->r = w - NTRACE;
+    while(tb->r != w && i < n)
+8010967b:	39 fa                	cmp    %edi,%edx
+8010967d:	0f 95 45 e4          	setne  -0x1c(%ebp)
+80109681:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+80109684:	0f 9f c0             	setg   %al
+80109687:	89 c6                	mov    %eax,%esi
+80109689:	7e 70                	jle    801096fb <traceread+0xcb>
+8010968b:	80 7d e4 00          	cmpb   $0x0,-0x1c(%ebp)
+8010968f:	74 6a                	je     801096fb <traceread+0xcb>
+80109691:	8b 75 08             	mov    0x8(%ebp),%esi
+80109694:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+80109697:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+8010969a:	8d 04 c6             	lea    (%esi,%eax,8),%eax
+8010969d:	eb 05                	jmp    801096a4 <traceread+0x74>
+8010969f:	90                   	nop
+801096a0:	84 db                	test   %bl,%bl
+801096a2:	74 54                	je     801096f8 <traceread+0xc8>
+      ev[i++] = tb->ev[tb->r++ % NTRACE];
+801096a4:	8d 72 01             	lea    0x1(%edx),%esi
+801096a7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+801096ad:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+801096b1:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801096b4:	8d 14 52             	lea    (%edx,%edx,2),%edx
+801096b7:	89 b1 04 60 00 00    	mov    %esi,0x6004(%ecx)
+    while(tb->r != w && i < n)
+801096bd:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+      ev[i++] = tb->ev[tb->r++ % NTRACE];
+801096c0:	8d 14 d1             	lea    (%ecx,%edx,8),%edx
+    while(tb->r != w && i < n)
+801096c3:	0f 9f c3             	setg   %bl
+801096c6:	83 c0 18             	add    $0x18,%eax
+      ev[i++] = tb->ev[tb->r++ % NTRACE];
+801096c9:	8b 32                	mov    (%edx),%esi
+801096cb:	89 70 e8             	mov    %esi,-0x18(%eax)
+801096ce:	8b 72 04             	mov    0x4(%edx),%esi
+801096d1:	89 70 ec             	mov    %esi,-0x14(%eax)
+801096d4:	8b 72 08             	mov    0x8(%edx),%esi
+801096d7:	89 70 f0             	mov    %esi,-0x10(%eax)
+801096da:	8b 72 0c             	mov    0xc(%edx),%esi
+801096dd:	89 70 f4             	mov    %esi,-0xc(%eax)
+801096e0:	8b 72 10             	mov    0x10(%edx),%esi
+801096e3:	89 70 f8             	mov    %esi,-0x8(%eax)
+801096e6:	8b 52 14             	mov    0x14(%edx),%edx
+    while(tb->r != w && i < n)
+801096e9:	89 de                	mov    %ebx,%esi
+      ev[i++] = tb->ev[tb->r++ % NTRACE];
+801096eb:	89 50 fc             	mov    %edx,-0x4(%eax)
+    while(tb->r != w && i < n)
+801096ee:	8b 91 04 60 00 00    	mov    0x6004(%ecx),%edx
+801096f4:	39 fa                	cmp    %edi,%edx
+801096f6:	75 a8                	jne    801096a0 <traceread+0x70>
+801096f8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  for(tb = tbuf; tb < &tbuf[NCPU] && i < n; tb++){
+801096fb:	81 c1 08 60 00 00    	add    $0x6008,%ecx
+80109701:	81 f9 40 81 18 80    	cmp    $0x80188140,%ecx
+80109707:	73 0a                	jae    80109713 <traceread+0xe3>
+80109709:	89 f0                	mov    %esi,%eax
+8010970b:	84 c0                	test   %al,%al
+8010970d:	0f 85 4d ff ff ff    	jne    80109660 <traceread+0x30>
+  }
+  release(&tracelock);
+80109713:	83 ec 0c             	sub    $0xc,%esp
+80109716:	68 a0 80 15 80       	push   $0x801580a0
+8010971b:	e8 d0 d4 ff ff       	call   80106bf0 <release>
+  return i;
+}
+80109720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109723:	89 d8                	mov    %ebx,%eax
+80109725:	5b                   	pop    %ebx
+80109726:	5e                   	pop    %esi
+80109727:	5f                   	pop    %edi
+80109728:	5d                   	pop    %ebp
+80109729:	c3                   	ret
+8010972a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      tb->r = w - NTRACE;
+80109730:	8d 97 00 fc ff ff    	lea    -0x400(%edi),%edx
+80109736:	c6 45 e4 01          	movb   $0x1,-0x1c(%ebp)
+8010973a:	89 91 04 60 00 00    	mov    %edx,0x6004(%ecx)
+80109740:	e9 3c ff ff ff       	jmp    80109681 <traceread+0x51>
+
+80109745 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80109745:	1e                   	push   %ds
+  pushl %es
+80109746:	06                   	push   %es
+  pushl %fs
+80109747:	0f a0                	push   %fs
+  pushl %gs
+80109749:	0f a8                	push   %gs
+  pushal
+8010974b:	60                   	pusha
+  
+  # Set up data segments.
+  # The data segment registers are set to SEG_KDATA<<3, which refers to the
+  # kernel data segment.
+  movw $(SEG_KDATA<<3), %ax
+8010974c:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80109750:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109752:	8e c0                	mov    %eax,%es
+  # %gs addresses this CPU's struct cpu (see seginit).
+  movw $(SEG_KCPU<<3), %ax
+80109754:	66 b8 30 00          	mov    $0x30,%ax
+  movw %ax, %fs
+80109758:	8e e0                	mov    %eax,%fs
+  movw %ax, %gs
+8010975a:	8e e8                	mov    %eax,%gs
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+8010975c:	54                   	push   %esp
+  call trap
+8010975d:	e8 9e 01 00 00       	call   80109900 <trap>
+  addl $4, %esp
+80109762:	83 c4 04             	add    $0x4,%esp
+
+80109765 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80109765:	61                   	popa
+  popl %gs
+80109766:	0f a9                	pop    %gs
+  popl %fs
+80109768:	0f a1                	pop    %fs
+  popl %es
+8010976a:	07                   	pop    %es
+  popl %ds
+8010976b:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+8010976c:	83 c4 08             	add    $0x8,%esp
+  iret
+8010976f:	cf                   	iret
+
+80109770 <sysentry>:
+.globl sysentry
+sysentry:
+  # Unlike int, sysenter keeps the user's flags but for IF, and a
+  # user-set NT would make the kernel's next iret fault. No caller
+  # expects its flags kept across a call, so start afresh.
+  pushl $0
+80109770:	6a 00                	push   $0x0
+  popfl
+80109772:	9d                   	popf
+
+80109773 <sysentryflags>:
+.globl sysentryflags
+sysentryflags:                      # trap() knows TF may be set until here
+  pushl $(SEG_UDATA<<3 | DPL_USER)  # ss
+80109773:	6a 23                	push   $0x23
+  pushl %ecx                        # esp
+80109775:	51                   	push   %ecx
+  pushl $FL_IF                      # eflags
+80109776:	68 00 02 00 00       	push   $0x200
+  pushl $(SEG_UCODE<<3 | DPL_USER)  # cs
+8010977b:	6a 1b                	push   $0x1b
+  pushl %edx                        # eip
+8010977d:	52                   	push   %edx
+  pushl $0                          # errcode
+8010977e:	6a 00                	push   $0x0
+  pushl $T_SYSCALL                  # trapno
+80109780:	6a 40                	push   $0x40
+  pushl %ds
+80109782:	1e                   	push   %ds
+  pushl %es
+80109783:	06                   	push   %es
+  pushl %fs
+80109784:	0f a0                	push   %fs
+  pushl %gs
+80109786:	0f a8                	push   %gs
+  pushal
+80109788:	60                   	pusha
+
+  movw $(SEG_KDATA<<3), %ax
+80109789:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+8010978d:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+8010978f:	8e c0                	mov    %eax,%es
+  movw $(SEG_KCPU<<3), %ax
+80109791:	66 b8 30 00          	mov    $0x30,%ax
+  movw %ax, %fs
+80109795:	8e e0                	mov    %eax,%fs
+  movw %ax, %gs
+80109797:	8e e8                	mov    %eax,%gs
+  sti
+80109799:	fb                   	sti
+
+  pushl %esp
+8010979a:	54                   	push   %esp
+  call systrap
+8010979b:	e8 00 01 00 00       	call   801098a0 <systrap>
+  addl $4, %esp
+801097a0:	83 c4 04             	add    $0x4,%esp
+
+  # Return by sysexit, which takes the user's %eip from %edx and
+  # %esp from %ecx; the stubs don't expect either kept. Reload
+  # them from the trap frame, since exec() may have changed it.
+  cli
+801097a3:	fa                   	cli
+  popal
+801097a4:	61                   	popa
+  popl %gs
+801097a5:	0f a9                	pop    %gs
+  popl %fs
+801097a7:	0f a1                	pop    %fs
+  popl %es
+801097a9:	07                   	pop    %es
+  popl %ds
+801097aa:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801097ab:	83 c4 08             	add    $0x8,%esp
+  movl 0(%esp), %edx   # eip
+801097ae:	8b 14 24             	mov    (%esp),%edx
+  movl 12(%esp), %ecx  # esp
+801097b1:	8b 4c 24 0c          	mov    0xc(%esp),%ecx
+  sti              # takes effect after sysexit
+801097b5:	fb                   	sti
+  sysexit
+801097b6:	0f 35                	sysexit
+801097b8:	66 90                	xchg   %ax,%ax
+801097ba:	66 90                	xchg   %ax,%ax
+801097bc:	66 90                	xchg   %ax,%ax
+801097be:	66 90                	xchg   %ax,%ax
+
+801097c0 <tvinit>:
+void
+tvinit(void)
+{
+  int i;
+
+  for(i = 0; i < 256; i++)
+801097c0:	31 c0                	xor    %eax,%eax
+801097c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+801097c8:	8b 14 85 20 e2 10 80 	mov    -0x7fef1de0(,%eax,4),%edx
+801097cf:	c7 04 c5 42 81 18 80 	movl   $0x8e000008,-0x7fe77ebe(,%eax,8)
+801097d6:	08 00 00 8e 
+801097da:	66 89 14 c5 40 81 18 	mov    %dx,-0x7fe77ec0(,%eax,8)
+801097e1:	80 
+801097e2:	c1 ea 10             	shr    $0x10,%edx
+801097e5:	66 89 14 c5 46 81 18 	mov    %dx,-0x7fe77eba(,%eax,8)
+801097ec:	80 
+  for(i = 0; i < 256; i++)
+801097ed:	83 c0 01             	add    $0x1,%eax
+801097f0:	3d 00 01 00 00       	cmp    $0x100,%eax
+801097f5:	75 d1                	jne    801097c8 <tvinit+0x8>
+
+  // special case for syscall: need to be able to generate from userspace
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+801097f7:	a1 20 e3 10 80       	mov    0x8010e320,%eax
+801097fc:	c7 05 42 83 18 80 08 	movl   $0xef000008,0x80188342
+80109803:	00 00 ef 
+80109806:	66 a3 40 83 18 80    	mov    %ax,0x80188340
+8010980c:	c1 e8 10             	shr    $0x10,%eax
+8010980f:	66 a3 46 83 18 80    	mov    %ax,0x80188346
+}
+80109815:	c3                   	ret
+80109816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010981d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109820 <idtinit>:
+
+// Tells the hardware where to find the IDT
+void
+idtinit(void)
+{
+80109820:	55                   	push   %ebp
+  pd[0] = size-1;
+80109821:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80109826:	89 e5                	mov    %esp,%ebp
+80109828:	83 ec 10             	sub    $0x10,%esp
+8010982b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010982f:	b8 40 81 18 80       	mov    $0x80188140,%eax
+80109834:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109838:	c1 e8 10             	shr    $0x10,%eax
+8010983b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010983f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109842:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109845:	c9                   	leave
+80109846:	c3                   	ret
+80109847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010984e:	66 90                	xchg   %ax,%ax
+
+80109850 <sysenterinit>:
+// Let this CPU take system calls by sysenter, which costs less
+// than an interrupt. switchuvm() points MSR_SYSENTER_ESP at the
+// running process's kernel stack.
+void
+sysenterinit(void)
+{
+80109850:	55                   	push   %ebp
+  asm volatile("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+80109851:	b8 01 00 00 00       	mov    $0x1,%eax
+80109856:	89 e5                	mov    %esp,%ebp
+80109858:	53                   	push   %ebx
+80109859:	83 ec 04             	sub    $0x4,%esp
+8010985c:	0f a2                	cpuid
+  uint edx;
+
+  cpuinfo(1, 0, 0, 0, &edx);
+  if((edx & CPUID_SEP) == 0)
+8010985e:	80 e6 08             	and    $0x8,%dh
+80109861:	74 21                	je     80109884 <sysenterinit+0x34>
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+80109863:	b9 74 01 00 00       	mov    $0x174,%ecx
+80109868:	b8 08 00 00 00       	mov    $0x8,%eax
+8010986d:	31 d2                	xor    %edx,%edx
+8010986f:	0f 30                	wrmsr
+80109871:	b9 76 01 00 00       	mov    $0x176,%ecx
+80109876:	b8 70 97 10 80       	mov    $0x80109770,%eax
+8010987b:	31 d2                	xor    %edx,%edx
+8010987d:	0f 30                	wrmsr
+    panic("sysenterinit: no sysenter");
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+}
+8010987f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109882:	c9                   	leave
+80109883:	c3                   	ret
+    panic("sysenterinit: no sysenter");
+80109884:	83 ec 0c             	sub    $0xc,%esp
+80109887:	68 b5 ba 10 80       	push   $0x8010bab5
+8010988c:	e8 4f 6b ff ff       	call   801003e0 <panic>
+80109891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010989f:	90                   	nop
+
+801098a0 <systrap>:
+// Run a system call. Calls made by sysenter come straight here
+// from sysentry in trapasm.S, which builds the same trap frame an
+// int $T_SYSCALL would have.
+void
+systrap(struct trapframe *tf)
+{
+801098a0:	55                   	push   %ebp
+801098a1:	89 e5                	mov    %esp,%ebp
+801098a3:	53                   	push   %ebx
+801098a4:	83 ec 04             	sub    $0x4,%esp
+801098a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(myproc()->killed)
+801098aa:	e8 81 b7 ff ff       	call   80105030 <myproc>
+801098af:	8b 90 90 00 00 00    	mov    0x90(%eax),%edx
+801098b5:	85 d2                	test   %edx,%edx
+801098b7:	75 27                	jne    801098e0 <systrap+0x40>
+    exit();
+  myproc()->tf = tf;
+801098b9:	e8 72 b7 ff ff       	call   80105030 <myproc>
+801098be:	89 98 80 00 00 00    	mov    %ebx,0x80(%eax)
+  syscall();
+801098c4:	e8 57 de ff ff       	call   80107720 <syscall>
+  if(myproc()->killed) // for example, if exit() syscall
+801098c9:	e8 62 b7 ff ff       	call   80105030 <myproc>
+801098ce:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+801098d4:	85 c0                	test   %eax,%eax
+801098d6:	75 18                	jne    801098f0 <systrap+0x50>
+    exit();
+}
+801098d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801098db:	c9                   	leave
+801098dc:	c3                   	ret
+801098dd:	8d 76 00             	lea    0x0(%esi),%esi
+    exit();
+801098e0:	e8 eb c1 ff ff       	call   80105ad0 <exit>
+801098e5:	eb d2                	jmp    801098b9 <systrap+0x19>
+801098e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098ee:	66 90                	xchg   %ax,%ax
+}
+801098f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801098f3:	c9                   	leave
+    exit();
+801098f4:	e9 d7 c1 ff ff       	jmp    80105ad0 <exit>
+801098f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109900 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{ 
+80109900:	55                   	push   %ebp
+80109901:	89 e5                	mov    %esp,%ebp
+80109903:	57                   	push   %edi
+80109904:	56                   	push   %esi
+80109905:	53                   	push   %ebx
+80109906:	83 ec 1c             	sub    $0x1c,%esp
+80109909:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int tick = 0;  // ticks since this CPU's last timer interrupt
+
+  // Code to handle the case of a syscall
+  if (tf->trapno == T_SYSCALL) {
+8010990c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010990f:	83 f8 40             	cmp    $0x40,%eax
+80109912:	0f 84 c8 01 00 00    	je     80109ae0 <trap+0x1e0>
+    systrap(tf);
+    return;
+  }
+
+  switch (tf->trapno) {
+80109918:	83 f8 3f             	cmp    $0x3f,%eax
+8010991b:	77 1b                	ja     80109938 <trap+0x38>
+8010991d:	ff 24 85 70 bb 10 80 	jmp    *-0x7fef4490(,%eax,4)
+80109924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      break;
+
+    case T_DEBUG:
+      // sysenter leaves a user-set TF on, so the kernel single-steps
+      // until sysentry resets the flags. Turn it off and carry on.
+      if ((tf->cs&3) == 0 && tf->eip >= (uint)sysentry &&
+80109928:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+8010992c:	0f 84 ee 01 00 00    	je     80109b20 <trap+0x220>
+80109932:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      }
+      // FALL THROUGH
+
+    //PAGEBREAK: 13
+    default:
+      if (myproc() == 0 || (tf->cs&3) == 0) {
+80109938:	e8 f3 b6 ff ff       	call   80105030 <myproc>
+8010993d:	85 c0                	test   %eax,%eax
+8010993f:	0f 84 45 02 00 00    	je     80109b8a <trap+0x28a>
+80109945:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109949:	0f 84 3b 02 00 00    	je     80109b8a <trap+0x28a>
+        cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+                tf->trapno, cpuid(), tf->eip, rcr2());
+        panic("trap");
+      }
+      // In user space, assume process misbehaved.
+      myproc()->nfault++;
+8010994f:	e8 dc b6 ff ff       	call   80105030 <myproc>
+80109954:	83 80 1c 01 00 00 01 	addl   $0x1,0x11c(%eax)
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+8010995b:	0f 20 d1             	mov    %cr2,%ecx
+      cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010995e:	8b 53 38             	mov    0x38(%ebx),%edx
+80109961:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80109964:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80109967:	e8 94 b6 ff ff       	call   80105000 <cpuid>
+8010996c:	8b 73 30             	mov    0x30(%ebx),%esi
+8010996f:	89 c7                	mov    %eax,%edi
+80109971:	8b 43 34             	mov    0x34(%ebx),%eax
+80109974:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+              "eip 0x%x addr 0x%x--kill proc\n",
+              myproc()->pid, myproc()->name, tf->trapno,
+80109977:	e8 b4 b6 ff ff       	call   80105030 <myproc>
+8010997c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010997f:	e8 ac b6 ff ff       	call   80105030 <myproc>
+      cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109984:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109987:	51                   	push   %ecx
+80109988:	8b 55 dc             	mov    -0x24(%ebp),%edx
+8010998b:	52                   	push   %edx
+8010998c:	57                   	push   %edi
+8010998d:	ff 75 e4             	push   -0x1c(%ebp)
+80109990:	56                   	push   %esi
+              myproc()->pid, myproc()->name, tf->trapno,
+80109991:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80109994:	81 c6 d8 00 00 00    	add    $0xd8,%esi
+      cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010999a:	56                   	push   %esi
+8010999b:	ff 70 64             	push   0x64(%eax)
+8010999e:	68 2c bb 10 80       	push   $0x8010bb2c
+801099a3:	e8 68 6d ff ff       	call   80100710 <cprintf>
+              tf->err, cpuid(), tf->eip, rcr2());
+      myproc()->killed = 1;
+801099a8:	83 c4 20             	add    $0x20,%esp
+801099ab:	e8 80 b6 ff ff       	call   80105030 <myproc>
+801099b0:	c7 80 90 00 00 00 01 	movl   $0x1,0x90(%eax)
+801099b7:	00 00 00 
+{ 
+801099ba:	31 f6                	xor    %esi,%esi
+801099bc:	e9 7f 00 00 00       	jmp    80109a40 <trap+0x140>
+801099c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801099c8:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+801099cc:	8b 7b 38             	mov    0x38(%ebx),%edi
+801099cf:	e8 2c b6 ff ff       	call   80105000 <cpuid>
+801099d4:	57                   	push   %edi
+801099d5:	56                   	push   %esi
+{ 
+801099d6:	31 f6                	xor    %esi,%esi
+      cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801099d8:	50                   	push   %eax
+801099d9:	68 d4 ba 10 80       	push   $0x8010bad4
+801099de:	e8 2d 6d ff ff       	call   80100710 <cprintf>
+      lapiceoi();
+801099e3:	e8 08 9d ff ff       	call   801036f0 <lapiceoi>
+      break;
+801099e8:	83 c4 10             	add    $0x10,%esp
+801099eb:	eb 53                	jmp    80109a40 <trap+0x140>
+801099ed:	8d 76 00             	lea    0x0(%esi),%esi
+      ideintr();
+801099f0:	e8 eb 94 ff ff       	call   80102ee0 <ideintr>
+{ 
+801099f5:	31 f6                	xor    %esi,%esi
+      lapiceoi();
+801099f7:	e8 f4 9c ff ff       	call   801036f0 <lapiceoi>
+      break;
+801099fc:	eb 42                	jmp    80109a40 <trap+0x140>
+801099fe:	66 90                	xchg   %ax,%ax
+      uartintr();
+80109a00:	e8 3b 03 00 00       	call   80109d40 <uartintr>
+{ 
+80109a05:	31 f6                	xor    %esi,%esi
+      lapiceoi();
+80109a07:	e8 e4 9c ff ff       	call   801036f0 <lapiceoi>
+      break;
+80109a0c:	eb 32                	jmp    80109a40 <trap+0x140>
+80109a0e:	66 90                	xchg   %ax,%ax
+      lapiceoi();
+80109a10:	e8 db 9c ff ff       	call   801036f0 <lapiceoi>
+{ 
+80109a15:	31 f6                	xor    %esi,%esi
+80109a17:	eb 27                	jmp    80109a40 <trap+0x140>
+80109a19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      profintr(tf);
+80109a20:	83 ec 0c             	sub    $0xc,%esp
+80109a23:	53                   	push   %ebx
+80109a24:	e8 e7 c8 ff ff       	call   80106310 <profintr>
+      tick = timerintr(tf);
+80109a29:	89 1c 24             	mov    %ebx,(%esp)
+80109a2c:	e8 0f f7 ff ff       	call   80109140 <timerintr>
+80109a31:	89 c6                	mov    %eax,%esi
+      lapiceoi();
+80109a33:	e8 b8 9c ff ff       	call   801036f0 <lapiceoi>
+      break;
+80109a38:	83 c4 10             	add    $0x10,%esp
+80109a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109a3f:	90                   	nop
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if (myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109a40:	e8 eb b5 ff ff       	call   80105030 <myproc>
+80109a45:	85 c0                	test   %eax,%eax
+80109a47:	74 20                	je     80109a69 <trap+0x169>
+80109a49:	e8 e2 b5 ff ff       	call   80105030 <myproc>
+80109a4e:	8b 90 90 00 00 00    	mov    0x90(%eax),%edx
+80109a54:	85 d2                	test   %edx,%edx
+80109a56:	74 11                	je     80109a69 <trap+0x169>
+80109a58:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109a5c:	83 e0 03             	and    $0x3,%eax
+80109a5f:	66 83 f8 03          	cmp    $0x3,%ax
+80109a63:	0f 84 e7 00 00 00    	je     80109b50 <trap+0x250>
+
+  // Force process to give up CPU on clock tick, once it has
+  // used up its time slice. Otherwise, the timer is one-shot, so
+  // arm it again; see timer.c.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED){
+80109a69:	8b 43 30             	mov    0x30(%ebx),%eax
+80109a6c:	83 f8 20             	cmp    $0x20,%eax
+80109a6f:	74 4f                	je     80109ac0 <trap+0x1c0>
+80109a71:	83 f8 3e             	cmp    $0x3e,%eax
+80109a74:	74 4a                	je     80109ac0 <trap+0x1c0>
+    else
+      timerarm();
+  }
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109a76:	e8 b5 b5 ff ff       	call   80105030 <myproc>
+80109a7b:	85 c0                	test   %eax,%eax
+80109a7d:	74 1c                	je     80109a9b <trap+0x19b>
+80109a7f:	e8 ac b5 ff ff       	call   80105030 <myproc>
+80109a84:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80109a8a:	85 c0                	test   %eax,%eax
+80109a8c:	74 0d                	je     80109a9b <trap+0x19b>
+80109a8e:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109a92:	83 e0 03             	and    $0x3,%eax
+80109a95:	66 83 f8 03          	cmp    $0x3,%ax
+80109a99:	74 77                	je     80109b12 <trap+0x212>
+    exit();
+}
+80109a9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109a9e:	5b                   	pop    %ebx
+80109a9f:	5e                   	pop    %esi
+80109aa0:	5f                   	pop    %edi
+80109aa1:	5d                   	pop    %ebp
+80109aa2:	c3                   	ret
+80109aa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109aa7:	90                   	nop
+      kbdintr();
+80109aa8:	e8 03 9a ff ff       	call   801034b0 <kbdintr>
+{ 
+80109aad:	31 f6                	xor    %esi,%esi
+      lapiceoi();
+80109aaf:	e8 3c 9c ff ff       	call   801036f0 <lapiceoi>
+      break;
+80109ab4:	eb 8a                	jmp    80109a40 <trap+0x140>
+80109ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109abd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc() && myproc()->state == RUNNING && timeslice(tick))
+80109ac0:	e8 6b b5 ff ff       	call   80105030 <myproc>
+80109ac5:	85 c0                	test   %eax,%eax
+80109ac7:	74 0f                	je     80109ad8 <trap+0x1d8>
+80109ac9:	e8 62 b5 ff ff       	call   80105030 <myproc>
+80109ace:	83 78 60 04          	cmpl   $0x4,0x60(%eax)
+80109ad2:	0f 84 88 00 00 00    	je     80109b60 <trap+0x260>
+      timerarm();
+80109ad8:	e8 13 f8 ff ff       	call   801092f0 <timerarm>
+80109add:	eb 97                	jmp    80109a76 <trap+0x176>
+80109adf:	90                   	nop
+  if(myproc()->killed)
+80109ae0:	e8 4b b5 ff ff       	call   80105030 <myproc>
+80109ae5:	8b b0 90 00 00 00    	mov    0x90(%eax),%esi
+80109aeb:	85 f6                	test   %esi,%esi
+80109aed:	0f 85 8d 00 00 00    	jne    80109b80 <trap+0x280>
+  myproc()->tf = tf;
+80109af3:	e8 38 b5 ff ff       	call   80105030 <myproc>
+80109af8:	89 98 80 00 00 00    	mov    %ebx,0x80(%eax)
+  syscall();
+80109afe:	e8 1d dc ff ff       	call   80107720 <syscall>
+  if(myproc()->killed) // for example, if exit() syscall
+80109b03:	e8 28 b5 ff ff       	call   80105030 <myproc>
+80109b08:	8b 88 90 00 00 00    	mov    0x90(%eax),%ecx
+80109b0e:	85 c9                	test   %ecx,%ecx
+80109b10:	74 89                	je     80109a9b <trap+0x19b>
+}
+80109b12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109b15:	5b                   	pop    %ebx
+80109b16:	5e                   	pop    %esi
+80109b17:	5f                   	pop    %edi
+80109b18:	5d                   	pop    %ebp
+    exit();
+80109b19:	e9 b2 bf ff ff       	jmp    80105ad0 <exit>
+80109b1e:	66 90                	xchg   %ax,%ax
+      if ((tf->cs&3) == 0 && tf->eip >= (uint)sysentry &&
+80109b20:	8b 43 38             	mov    0x38(%ebx),%eax
+80109b23:	3d 70 97 10 80       	cmp    $0x80109770,%eax
+80109b28:	0f 82 0a fe ff ff    	jb     80109938 <trap+0x38>
+80109b2e:	3d 73 97 10 80       	cmp    $0x80109773,%eax
+80109b33:	0f 87 ff fd ff ff    	ja     80109938 <trap+0x38>
+        tf->eflags &= ~FL_TF;
+80109b39:	81 63 40 ff fe ff ff 	andl   $0xfffffeff,0x40(%ebx)
+{ 
+80109b40:	31 f6                	xor    %esi,%esi
+80109b42:	e9 f9 fe ff ff       	jmp    80109a40 <trap+0x140>
+80109b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109b4e:	66 90                	xchg   %ax,%ax
+    exit();
+80109b50:	e8 7b bf ff ff       	call   80105ad0 <exit>
+80109b55:	e9 0f ff ff ff       	jmp    80109a69 <trap+0x169>
+80109b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(myproc() && myproc()->state == RUNNING && timeslice(tick))
+80109b60:	83 ec 0c             	sub    $0xc,%esp
+80109b63:	56                   	push   %esi
+80109b64:	e8 97 bb ff ff       	call   80105700 <timeslice>
+80109b69:	83 c4 10             	add    $0x10,%esp
+80109b6c:	85 c0                	test   %eax,%eax
+80109b6e:	0f 84 64 ff ff ff    	je     80109ad8 <trap+0x1d8>
+      yield();
+80109b74:	e8 47 bb ff ff       	call   801056c0 <yield>
+80109b79:	e9 f8 fe ff ff       	jmp    80109a76 <trap+0x176>
+80109b7e:	66 90                	xchg   %ax,%ax
+    exit();
+80109b80:	e8 4b bf ff ff       	call   80105ad0 <exit>
+80109b85:	e9 69 ff ff ff       	jmp    80109af3 <trap+0x1f3>
+80109b8a:	0f 20 d7             	mov    %cr2,%edi
+        cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109b8d:	8b 73 38             	mov    0x38(%ebx),%esi
+80109b90:	e8 6b b4 ff ff       	call   80105000 <cpuid>
+80109b95:	83 ec 0c             	sub    $0xc,%esp
+80109b98:	57                   	push   %edi
+80109b99:	56                   	push   %esi
+80109b9a:	50                   	push   %eax
+80109b9b:	ff 73 30             	push   0x30(%ebx)
+80109b9e:	68 f8 ba 10 80       	push   $0x8010baf8
+80109ba3:	e8 68 6b ff ff       	call   80100710 <cprintf>
+        panic("trap");
+80109ba8:	83 c4 14             	add    $0x14,%esp
+80109bab:	68 cf ba 10 80       	push   $0x8010bacf
+80109bb0:	e8 2b 68 ff ff       	call   801003e0 <panic>
+80109bb5:	66 90                	xchg   %ax,%ax
+80109bb7:	66 90                	xchg   %ax,%ax
+80109bb9:	66 90                	xchg   %ax,%ax
+80109bbb:	66 90                	xchg   %ax,%ax
+80109bbd:	66 90                	xchg   %ax,%ax
+80109bbf:	90                   	nop
+
+80109bc0 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109bc0:	a1 40 89 18 80       	mov    0x80188940,%eax
+80109bc5:	85 c0                	test   %eax,%eax
+80109bc7:	74 17                	je     80109be0 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109bc9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109bce:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109bcf:	a8 01                	test   $0x1,%al
+80109bd1:	74 0d                	je     80109be0 <uartgetc+0x20>
+80109bd3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109bd8:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109bd9:	0f b6 c0             	movzbl %al,%eax
+80109bdc:	c3                   	ret
+80109bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109be0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109be5:	c3                   	ret
+80109be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109bed:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109bf0 <uartinit>:
+{
+80109bf0:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109bf1:	31 c9                	xor    %ecx,%ecx
+80109bf3:	89 c8                	mov    %ecx,%eax
+80109bf5:	89 e5                	mov    %esp,%ebp
+80109bf7:	57                   	push   %edi
+80109bf8:	bf fa 03 00 00       	mov    $0x3fa,%edi
+80109bfd:	56                   	push   %esi
+80109bfe:	89 fa                	mov    %edi,%edx
+80109c00:	53                   	push   %ebx
+80109c01:	83 ec 1c             	sub    $0x1c,%esp
+80109c04:	ee                   	out    %al,(%dx)
+80109c05:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109c0a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109c0f:	89 f2                	mov    %esi,%edx
+80109c11:	ee                   	out    %al,(%dx)
+80109c12:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109c17:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109c1c:	ee                   	out    %al,(%dx)
+80109c1d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109c22:	89 c8                	mov    %ecx,%eax
+80109c24:	89 da                	mov    %ebx,%edx
+80109c26:	ee                   	out    %al,(%dx)
+80109c27:	b8 03 00 00 00       	mov    $0x3,%eax
+80109c2c:	89 f2                	mov    %esi,%edx
+80109c2e:	ee                   	out    %al,(%dx)
+80109c2f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109c34:	89 c8                	mov    %ecx,%eax
+80109c36:	ee                   	out    %al,(%dx)
+80109c37:	b8 01 00 00 00       	mov    $0x1,%eax
+80109c3c:	89 da                	mov    %ebx,%edx
+80109c3e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109c3f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109c44:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109c45:	3c ff                	cmp    $0xff,%al
+80109c47:	0f 84 7c 00 00 00    	je     80109cc9 <uartinit+0xd9>
+  uart = 1;
+80109c4d:	c7 05 40 89 18 80 01 	movl   $0x1,0x80188940
+80109c54:	00 00 00 
+80109c57:	89 fa                	mov    %edi,%edx
+80109c59:	ec                   	in     (%dx),%al
+80109c5a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109c5f:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109c60:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80109c63:	bf 70 bc 10 80       	mov    $0x8010bc70,%edi
+80109c68:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+80109c6d:	6a 00                	push   $0x0
+80109c6f:	6a 04                	push   $0x4
+80109c71:	e8 da 94 ff ff       	call   80103150 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109c76:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80109c7a:	83 c4 10             	add    $0x10,%esp
+80109c7d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109c80:	a1 40 89 18 80       	mov    0x80188940,%eax
+80109c85:	85 c0                	test   %eax,%eax
+80109c87:	74 32                	je     80109cbb <uartinit+0xcb>
+80109c89:	89 f2                	mov    %esi,%edx
+80109c8b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109c8c:	a8 20                	test   $0x20,%al
+80109c8e:	75 21                	jne    80109cb1 <uartinit+0xc1>
+80109c90:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109c95:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80109c98:	83 ec 0c             	sub    $0xc,%esp
+80109c9b:	6a 0a                	push   $0xa
+80109c9d:	e8 6e 9a ff ff       	call   80103710 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109ca2:	83 c4 10             	add    $0x10,%esp
+80109ca5:	83 eb 01             	sub    $0x1,%ebx
+80109ca8:	74 07                	je     80109cb1 <uartinit+0xc1>
+80109caa:	89 f2                	mov    %esi,%edx
+80109cac:	ec                   	in     (%dx),%al
+80109cad:	a8 20                	test   $0x20,%al
+80109caf:	74 e7                	je     80109c98 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109cb1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109cb6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80109cba:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80109cbb:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80109cbf:	83 c7 01             	add    $0x1,%edi
+80109cc2:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109cc5:	84 c0                	test   %al,%al
+80109cc7:	75 b7                	jne    80109c80 <uartinit+0x90>
+}
+80109cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109ccc:	5b                   	pop    %ebx
+80109ccd:	5e                   	pop    %esi
+80109cce:	5f                   	pop    %edi
+80109ccf:	5d                   	pop    %ebp
+80109cd0:	c3                   	ret
+80109cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109cdf:	90                   	nop
+
+80109ce0 <uartputc>:
+  if(!uart)
+80109ce0:	a1 40 89 18 80       	mov    0x80188940,%eax
+80109ce5:	85 c0                	test   %eax,%eax
+80109ce7:	74 4f                	je     80109d38 <uartputc+0x58>
+{
+80109ce9:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109cea:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109cef:	89 e5                	mov    %esp,%ebp
+80109cf1:	56                   	push   %esi
+80109cf2:	53                   	push   %ebx
+80109cf3:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109cf4:	a8 20                	test   $0x20,%al
+80109cf6:	75 29                	jne    80109d21 <uartputc+0x41>
+80109cf8:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109cfd:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109d08:	83 ec 0c             	sub    $0xc,%esp
+80109d0b:	6a 0a                	push   $0xa
+80109d0d:	e8 fe 99 ff ff       	call   80103710 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109d12:	83 c4 10             	add    $0x10,%esp
+80109d15:	83 eb 01             	sub    $0x1,%ebx
+80109d18:	74 07                	je     80109d21 <uartputc+0x41>
+80109d1a:	89 f2                	mov    %esi,%edx
+80109d1c:	ec                   	in     (%dx),%al
+80109d1d:	a8 20                	test   $0x20,%al
+80109d1f:	74 e7                	je     80109d08 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109d21:	8b 45 08             	mov    0x8(%ebp),%eax
+80109d24:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109d29:	ee                   	out    %al,(%dx)
+}
+80109d2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109d2d:	5b                   	pop    %ebx
+80109d2e:	5e                   	pop    %esi
+80109d2f:	5d                   	pop    %ebp
+80109d30:	c3                   	ret
+80109d31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109d38:	c3                   	ret
+80109d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109d40 <uartintr>:
+
+void
+uartintr(void)
+{
+80109d40:	55                   	push   %ebp
+80109d41:	89 e5                	mov    %esp,%ebp
+80109d43:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109d46:	68 c0 9b 10 80       	push   $0x80109bc0
+80109d4b:	e8 d0 6b ff ff       	call   80100920 <consoleintr>
+}
+80109d50:	83 c4 10             	add    $0x10,%esp
+80109d53:	c9                   	leave
+80109d54:	c3                   	ret
+
+80109d55 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109d55:	6a 00                	push   $0x0
+  pushl $0
+80109d57:	6a 00                	push   $0x0
+  jmp alltraps
+80109d59:	e9 e7 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d5e <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80109d5e:	6a 00                	push   $0x0
+  pushl $1
+80109d60:	6a 01                	push   $0x1
+  jmp alltraps
+80109d62:	e9 de f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d67 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109d67:	6a 00                	push   $0x0
+  pushl $2
+80109d69:	6a 02                	push   $0x2
+  jmp alltraps
+80109d6b:	e9 d5 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d70 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109d70:	6a 00                	push   $0x0
+  pushl $3
+80109d72:	6a 03                	push   $0x3
+  jmp alltraps
+80109d74:	e9 cc f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d79 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109d79:	6a 00                	push   $0x0
+  pushl $4
+80109d7b:	6a 04                	push   $0x4
+  jmp alltraps
+80109d7d:	e9 c3 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d82 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109d82:	6a 00                	push   $0x0
+  pushl $5
+80109d84:	6a 05                	push   $0x5
+  jmp alltraps
+80109d86:	e9 ba f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d8b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80109d8b:	6a 00                	push   $0x0
+  pushl $6
+80109d8d:	6a 06                	push   $0x6
+  jmp alltraps
+80109d8f:	e9 b1 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d94 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109d94:	6a 00                	push   $0x0
+  pushl $7
+80109d96:	6a 07                	push   $0x7
+  jmp alltraps
+80109d98:	e9 a8 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109d9d <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109d9d:	6a 08                	push   $0x8
+  jmp alltraps
+80109d9f:	e9 a1 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109da4 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109da4:	6a 00                	push   $0x0
+  pushl $9
+80109da6:	6a 09                	push   $0x9
+  jmp alltraps
+80109da8:	e9 98 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dad <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109dad:	6a 0a                	push   $0xa
+  jmp alltraps
+80109daf:	e9 91 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109db4 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109db4:	6a 0b                	push   $0xb
+  jmp alltraps
+80109db6:	e9 8a f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dbb <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80109dbb:	6a 0c                	push   $0xc
+  jmp alltraps
+80109dbd:	e9 83 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dc2 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109dc2:	6a 0d                	push   $0xd
+  jmp alltraps
+80109dc4:	e9 7c f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dc9 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109dc9:	6a 0e                	push   $0xe
+  jmp alltraps
+80109dcb:	e9 75 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dd0 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109dd0:	6a 00                	push   $0x0
+  pushl $15
+80109dd2:	6a 0f                	push   $0xf
+  jmp alltraps
+80109dd4:	e9 6c f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dd9 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109dd9:	6a 00                	push   $0x0
+  pushl $16
+80109ddb:	6a 10                	push   $0x10
+  jmp alltraps
+80109ddd:	e9 63 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109de2 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109de2:	6a 11                	push   $0x11
+  jmp alltraps
+80109de4:	e9 5c f9 ff ff       	jmp    80109745 <alltraps>
+
+80109de9 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109de9:	6a 00                	push   $0x0
+  pushl $18
+80109deb:	6a 12                	push   $0x12
+  jmp alltraps
+80109ded:	e9 53 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109df2 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109df2:	6a 00                	push   $0x0
+  pushl $19
+80109df4:	6a 13                	push   $0x13
+  jmp alltraps
+80109df6:	e9 4a f9 ff ff       	jmp    80109745 <alltraps>
+
+80109dfb <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109dfb:	6a 00                	push   $0x0
+  pushl $20
+80109dfd:	6a 14                	push   $0x14
+  jmp alltraps
+80109dff:	e9 41 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e04 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109e04:	6a 00                	push   $0x0
+  pushl $21
+80109e06:	6a 15                	push   $0x15
+  jmp alltraps
+80109e08:	e9 38 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e0d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109e0d:	6a 00                	push   $0x0
+  pushl $22
+80109e0f:	6a 16                	push   $0x16
+  jmp alltraps
+80109e11:	e9 2f f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e16 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109e16:	6a 00                	push   $0x0
+  pushl $23
+80109e18:	6a 17                	push   $0x17
+  jmp alltraps
+80109e1a:	e9 26 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e1f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109e1f:	6a 00                	push   $0x0
+  pushl $24
+80109e21:	6a 18                	push   $0x18
+  jmp alltraps
+80109e23:	e9 1d f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e28 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109e28:	6a 00                	push   $0x0
+  pushl $25
+80109e2a:	6a 19                	push   $0x19
+  jmp alltraps
+80109e2c:	e9 14 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e31 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109e31:	6a 00                	push   $0x0
+  pushl $26
+80109e33:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109e35:	e9 0b f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e3a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80109e3a:	6a 00                	push   $0x0
+  pushl $27
+80109e3c:	6a 1b                	push   $0x1b
+  jmp alltraps
+80109e3e:	e9 02 f9 ff ff       	jmp    80109745 <alltraps>
+
+80109e43 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109e43:	6a 00                	push   $0x0
+  pushl $28
+80109e45:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109e47:	e9 f9 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e4c <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80109e4c:	6a 00                	push   $0x0
+  pushl $29
+80109e4e:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109e50:	e9 f0 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e55 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109e55:	6a 00                	push   $0x0
+  pushl $30
+80109e57:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109e59:	e9 e7 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e5e <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80109e5e:	6a 00                	push   $0x0
+  pushl $31
+80109e60:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109e62:	e9 de f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e67 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109e67:	6a 00                	push   $0x0
+  pushl $32
+80109e69:	6a 20                	push   $0x20
+  jmp alltraps
+80109e6b:	e9 d5 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e70 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109e70:	6a 00                	push   $0x0
+  pushl $33
+80109e72:	6a 21                	push   $0x21
+  jmp alltraps
+80109e74:	e9 cc f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e79 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109e79:	6a 00                	push   $0x0
+  pushl $34
+80109e7b:	6a 22                	push   $0x22
+  jmp alltraps
+80109e7d:	e9 c3 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e82 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109e82:	6a 00                	push   $0x0
+  pushl $35
+80109e84:	6a 23                	push   $0x23
+  jmp alltraps
+80109e86:	e9 ba f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e8b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80109e8b:	6a 00                	push   $0x0
+  pushl $36
+80109e8d:	6a 24                	push   $0x24
+  jmp alltraps
+80109e8f:	e9 b1 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e94 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109e94:	6a 00                	push   $0x0
+  pushl $37
+80109e96:	6a 25                	push   $0x25
+  jmp alltraps
+80109e98:	e9 a8 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109e9d <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109e9d:	6a 00                	push   $0x0
+  pushl $38
+80109e9f:	6a 26                	push   $0x26
+  jmp alltraps
+80109ea1:	e9 9f f8 ff ff       	jmp    80109745 <alltraps>
+
+80109ea6 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109ea6:	6a 00                	push   $0x0
+  pushl $39
+80109ea8:	6a 27                	push   $0x27
+  jmp alltraps
+80109eaa:	e9 96 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109eaf <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80109eaf:	6a 00                	push   $0x0
+  pushl $40
+80109eb1:	6a 28                	push   $0x28
+  jmp alltraps
+80109eb3:	e9 8d f8 ff ff       	jmp    80109745 <alltraps>
+
+80109eb8 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109eb8:	6a 00                	push   $0x0
+  pushl $41
+80109eba:	6a 29                	push   $0x29
+  jmp alltraps
+80109ebc:	e9 84 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109ec1 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109ec1:	6a 00                	push   $0x0
+  pushl $42
+80109ec3:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109ec5:	e9 7b f8 ff ff       	jmp    80109745 <alltraps>
+
+80109eca <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80109eca:	6a 00                	push   $0x0
+  pushl $43
+80109ecc:	6a 2b                	push   $0x2b
+  jmp alltraps
+80109ece:	e9 72 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109ed3 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109ed3:	6a 00                	push   $0x0
+  pushl $44
+80109ed5:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109ed7:	e9 69 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109edc <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80109edc:	6a 00                	push   $0x0
+  pushl $45
+80109ede:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109ee0:	e9 60 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109ee5 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109ee5:	6a 00                	push   $0x0
+  pushl $46
+80109ee7:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109ee9:	e9 57 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109eee <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80109eee:	6a 00                	push   $0x0
+  pushl $47
+80109ef0:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109ef2:	e9 4e f8 ff ff       	jmp    80109745 <alltraps>
+
+80109ef7 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109ef7:	6a 00                	push   $0x0
+  pushl $48
+80109ef9:	6a 30                	push   $0x30
+  jmp alltraps
+80109efb:	e9 45 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f00 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109f00:	6a 00                	push   $0x0
+  pushl $49
+80109f02:	6a 31                	push   $0x31
+  jmp alltraps
+80109f04:	e9 3c f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f09 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109f09:	6a 00                	push   $0x0
+  pushl $50
+80109f0b:	6a 32                	push   $0x32
+  jmp alltraps
+80109f0d:	e9 33 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f12 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109f12:	6a 00                	push   $0x0
+  pushl $51
+80109f14:	6a 33                	push   $0x33
+  jmp alltraps
+80109f16:	e9 2a f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f1b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+80109f1b:	6a 00                	push   $0x0
+  pushl $52
+80109f1d:	6a 34                	push   $0x34
+  jmp alltraps
+80109f1f:	e9 21 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f24 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109f24:	6a 00                	push   $0x0
+  pushl $53
+80109f26:	6a 35                	push   $0x35
+  jmp alltraps
+80109f28:	e9 18 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f2d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+80109f2d:	6a 00                	push   $0x0
+  pushl $54
+80109f2f:	6a 36                	push   $0x36
+  jmp alltraps
+80109f31:	e9 0f f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f36 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109f36:	6a 00                	push   $0x0
+  pushl $55
+80109f38:	6a 37                	push   $0x37
+  jmp alltraps
+80109f3a:	e9 06 f8 ff ff       	jmp    80109745 <alltraps>
+
+80109f3f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80109f3f:	6a 00                	push   $0x0
+  pushl $56
+80109f41:	6a 38                	push   $0x38
+  jmp alltraps
+80109f43:	e9 fd f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f48 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80109f48:	6a 00                	push   $0x0
+  pushl $57
+80109f4a:	6a 39                	push   $0x39
+  jmp alltraps
+80109f4c:	e9 f4 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f51 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80109f51:	6a 00                	push   $0x0
+  pushl $58
+80109f53:	6a 3a                	push   $0x3a
+  jmp alltraps
+80109f55:	e9 eb f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f5a <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80109f5a:	6a 00                	push   $0x0
+  pushl $59
+80109f5c:	6a 3b                	push   $0x3b
+  jmp alltraps
+80109f5e:	e9 e2 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f63 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80109f63:	6a 00                	push   $0x0
+  pushl $60
+80109f65:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109f67:	e9 d9 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f6c <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80109f6c:	6a 00                	push   $0x0
+  pushl $61
+80109f6e:	6a 3d                	push   $0x3d
+  jmp alltraps
+80109f70:	e9 d0 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f75 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109f75:	6a 00                	push   $0x0
+  pushl $62
+80109f77:	6a 3e                	push   $0x3e
+  jmp alltraps
+80109f79:	e9 c7 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f7e <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80109f7e:	6a 00                	push   $0x0
+  pushl $63
+80109f80:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109f82:	e9 be f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f87 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109f87:	6a 00                	push   $0x0
+  pushl $64
+80109f89:	6a 40                	push   $0x40
+  jmp alltraps
+80109f8b:	e9 b5 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f90 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109f90:	6a 00                	push   $0x0
+  pushl $65
+80109f92:	6a 41                	push   $0x41
+  jmp alltraps
+80109f94:	e9 ac f7 ff ff       	jmp    80109745 <alltraps>
+
+80109f99 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109f99:	6a 00                	push   $0x0
+  pushl $66
+80109f9b:	6a 42                	push   $0x42
+  jmp alltraps
+80109f9d:	e9 a3 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fa2 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109fa2:	6a 00                	push   $0x0
+  pushl $67
+80109fa4:	6a 43                	push   $0x43
+  jmp alltraps
+80109fa6:	e9 9a f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fab <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80109fab:	6a 00                	push   $0x0
+  pushl $68
+80109fad:	6a 44                	push   $0x44
+  jmp alltraps
+80109faf:	e9 91 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fb4 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109fb4:	6a 00                	push   $0x0
+  pushl $69
+80109fb6:	6a 45                	push   $0x45
+  jmp alltraps
+80109fb8:	e9 88 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fbd <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109fbd:	6a 00                	push   $0x0
+  pushl $70
+80109fbf:	6a 46                	push   $0x46
+  jmp alltraps
+80109fc1:	e9 7f f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fc6 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109fc6:	6a 00                	push   $0x0
+  pushl $71
+80109fc8:	6a 47                	push   $0x47
+  jmp alltraps
+80109fca:	e9 76 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fcf <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109fcf:	6a 00                	push   $0x0
+  pushl $72
+80109fd1:	6a 48                	push   $0x48
+  jmp alltraps
+80109fd3:	e9 6d f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fd8 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109fd8:	6a 00                	push   $0x0
+  pushl $73
+80109fda:	6a 49                	push   $0x49
+  jmp alltraps
+80109fdc:	e9 64 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fe1 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109fe1:	6a 00                	push   $0x0
+  pushl $74
+80109fe3:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109fe5:	e9 5b f7 ff ff       	jmp    80109745 <alltraps>
+
+80109fea <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80109fea:	6a 00                	push   $0x0
+  pushl $75
+80109fec:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109fee:	e9 52 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109ff3 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109ff3:	6a 00                	push   $0x0
+  pushl $76
+80109ff5:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109ff7:	e9 49 f7 ff ff       	jmp    80109745 <alltraps>
+
+80109ffc <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80109ffc:	6a 00                	push   $0x0
+  pushl $77
+80109ffe:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010a000:	e9 40 f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a005 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+8010a005:	6a 00                	push   $0x0
+  pushl $78
+8010a007:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010a009:	e9 37 f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a00e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010a00e:	6a 00                	push   $0x0
+  pushl $79
+8010a010:	6a 4f                	push   $0x4f
+  jmp alltraps
+8010a012:	e9 2e f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a017 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010a017:	6a 00                	push   $0x0
+  pushl $80
+8010a019:	6a 50                	push   $0x50
+  jmp alltraps
+8010a01b:	e9 25 f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a020 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+8010a020:	6a 00                	push   $0x0
+  pushl $81
+8010a022:	6a 51                	push   $0x51
+  jmp alltraps
+8010a024:	e9 1c f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a029 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010a029:	6a 00                	push   $0x0
+  pushl $82
+8010a02b:	6a 52                	push   $0x52
+  jmp alltraps
+8010a02d:	e9 13 f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a032 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+8010a032:	6a 00                	push   $0x0
+  pushl $83
+8010a034:	6a 53                	push   $0x53
+  jmp alltraps
+8010a036:	e9 0a f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a03b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010a03b:	6a 00                	push   $0x0
+  pushl $84
+8010a03d:	6a 54                	push   $0x54
+  jmp alltraps
+8010a03f:	e9 01 f7 ff ff       	jmp    80109745 <alltraps>
+
+8010a044 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+8010a044:	6a 00                	push   $0x0
+  pushl $85
+8010a046:	6a 55                	push   $0x55
+  jmp alltraps
+8010a048:	e9 f8 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a04d <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010a04d:	6a 00                	push   $0x0
+  pushl $86
+8010a04f:	6a 56                	push   $0x56
+  jmp alltraps
+8010a051:	e9 ef f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a056 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+8010a056:	6a 00                	push   $0x0
+  pushl $87
+8010a058:	6a 57                	push   $0x57
+  jmp alltraps
+8010a05a:	e9 e6 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a05f <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010a05f:	6a 00                	push   $0x0
+  pushl $88
+8010a061:	6a 58                	push   $0x58
+  jmp alltraps
+8010a063:	e9 dd f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a068 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+8010a068:	6a 00                	push   $0x0
+  pushl $89
+8010a06a:	6a 59                	push   $0x59
+  jmp alltraps
+8010a06c:	e9 d4 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a071 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010a071:	6a 00                	push   $0x0
+  pushl $90
+8010a073:	6a 5a                	push   $0x5a
+  jmp alltraps
+8010a075:	e9 cb f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a07a <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010a07a:	6a 00                	push   $0x0
+  pushl $91
+8010a07c:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010a07e:	e9 c2 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a083 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010a083:	6a 00                	push   $0x0
+  pushl $92
+8010a085:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010a087:	e9 b9 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a08c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010a08c:	6a 00                	push   $0x0
+  pushl $93
+8010a08e:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010a090:	e9 b0 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a095 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+8010a095:	6a 00                	push   $0x0
+  pushl $94
+8010a097:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010a099:	e9 a7 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a09e <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010a09e:	6a 00                	push   $0x0
+  pushl $95
+8010a0a0:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010a0a2:	e9 9e f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0a7 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010a0a7:	6a 00                	push   $0x0
+  pushl $96
+8010a0a9:	6a 60                	push   $0x60
+  jmp alltraps
+8010a0ab:	e9 95 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0b0 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010a0b0:	6a 00                	push   $0x0
+  pushl $97
+8010a0b2:	6a 61                	push   $0x61
+  jmp alltraps
+8010a0b4:	e9 8c f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0b9 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010a0b9:	6a 00                	push   $0x0
+  pushl $98
+8010a0bb:	6a 62                	push   $0x62
+  jmp alltraps
+8010a0bd:	e9 83 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0c2 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010a0c2:	6a 00                	push   $0x0
+  pushl $99
+8010a0c4:	6a 63                	push   $0x63
+  jmp alltraps
+8010a0c6:	e9 7a f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0cb <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010a0cb:	6a 00                	push   $0x0
+  pushl $100
+8010a0cd:	6a 64                	push   $0x64
+  jmp alltraps
+8010a0cf:	e9 71 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0d4 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a0d4:	6a 00                	push   $0x0
+  pushl $101
+8010a0d6:	6a 65                	push   $0x65
+  jmp alltraps
+8010a0d8:	e9 68 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0dd <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a0dd:	6a 00                	push   $0x0
+  pushl $102
+8010a0df:	6a 66                	push   $0x66
+  jmp alltraps
+8010a0e1:	e9 5f f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0e6 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a0e6:	6a 00                	push   $0x0
+  pushl $103
+8010a0e8:	6a 67                	push   $0x67
+  jmp alltraps
+8010a0ea:	e9 56 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0ef <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a0ef:	6a 00                	push   $0x0
+  pushl $104
+8010a0f1:	6a 68                	push   $0x68
+  jmp alltraps
+8010a0f3:	e9 4d f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a0f8 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a0f8:	6a 00                	push   $0x0
+  pushl $105
+8010a0fa:	6a 69                	push   $0x69
+  jmp alltraps
+8010a0fc:	e9 44 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a101 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a101:	6a 00                	push   $0x0
+  pushl $106
+8010a103:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a105:	e9 3b f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a10a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a10a:	6a 00                	push   $0x0
+  pushl $107
+8010a10c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a10e:	e9 32 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a113 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a113:	6a 00                	push   $0x0
+  pushl $108
+8010a115:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a117:	e9 29 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a11c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a11c:	6a 00                	push   $0x0
+  pushl $109
+8010a11e:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a120:	e9 20 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a125 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a125:	6a 00                	push   $0x0
+  pushl $110
+8010a127:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a129:	e9 17 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a12e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a12e:	6a 00                	push   $0x0
+  pushl $111
+8010a130:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a132:	e9 0e f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a137 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a137:	6a 00                	push   $0x0
+  pushl $112
+8010a139:	6a 70                	push   $0x70
+  jmp alltraps
+8010a13b:	e9 05 f6 ff ff       	jmp    80109745 <alltraps>
+
+8010a140 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a140:	6a 00                	push   $0x0
+  pushl $113
+8010a142:	6a 71                	push   $0x71
+  jmp alltraps
+8010a144:	e9 fc f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a149 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a149:	6a 00                	push   $0x0
+  pushl $114
+8010a14b:	6a 72                	push   $0x72
+  jmp alltraps
+8010a14d:	e9 f3 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a152 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a152:	6a 00                	push   $0x0
+  pushl $115
+8010a154:	6a 73                	push   $0x73
+  jmp alltraps
+8010a156:	e9 ea f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a15b <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a15b:	6a 00                	push   $0x0
+  pushl $116
+8010a15d:	6a 74                	push   $0x74
+  jmp alltraps
+8010a15f:	e9 e1 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a164 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a164:	6a 00                	push   $0x0
+  pushl $117
+8010a166:	6a 75                	push   $0x75
+  jmp alltraps
+8010a168:	e9 d8 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a16d <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a16d:	6a 00                	push   $0x0
+  pushl $118
+8010a16f:	6a 76                	push   $0x76
+  jmp alltraps
+8010a171:	e9 cf f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a176 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a176:	6a 00                	push   $0x0
+  pushl $119
+8010a178:	6a 77                	push   $0x77
+  jmp alltraps
+8010a17a:	e9 c6 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a17f <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a17f:	6a 00                	push   $0x0
+  pushl $120
+8010a181:	6a 78                	push   $0x78
+  jmp alltraps
+8010a183:	e9 bd f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a188 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a188:	6a 00                	push   $0x0
+  pushl $121
+8010a18a:	6a 79                	push   $0x79
+  jmp alltraps
+8010a18c:	e9 b4 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a191 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a191:	6a 00                	push   $0x0
+  pushl $122
+8010a193:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a195:	e9 ab f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a19a <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a19a:	6a 00                	push   $0x0
+  pushl $123
+8010a19c:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a19e:	e9 a2 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1a3 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a1a3:	6a 00                	push   $0x0
+  pushl $124
+8010a1a5:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a1a7:	e9 99 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1ac <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a1ac:	6a 00                	push   $0x0
+  pushl $125
+8010a1ae:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a1b0:	e9 90 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1b5 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a1b5:	6a 00                	push   $0x0
+  pushl $126
+8010a1b7:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a1b9:	e9 87 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1be <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a1be:	6a 00                	push   $0x0
+  pushl $127
+8010a1c0:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a1c2:	e9 7e f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1c7 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a1c7:	6a 00                	push   $0x0
+  pushl $128
+8010a1c9:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a1ce:	e9 72 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1d3 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a1d3:	6a 00                	push   $0x0
+  pushl $129
+8010a1d5:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a1da:	e9 66 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1df <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a1df:	6a 00                	push   $0x0
+  pushl $130
+8010a1e1:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a1e6:	e9 5a f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1eb <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a1eb:	6a 00                	push   $0x0
+  pushl $131
+8010a1ed:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a1f2:	e9 4e f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a1f7 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a1f7:	6a 00                	push   $0x0
+  pushl $132
+8010a1f9:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a1fe:	e9 42 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a203 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a203:	6a 00                	push   $0x0
+  pushl $133
+8010a205:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a20a:	e9 36 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a20f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a20f:	6a 00                	push   $0x0
+  pushl $134
+8010a211:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a216:	e9 2a f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a21b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a21b:	6a 00                	push   $0x0
+  pushl $135
+8010a21d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a222:	e9 1e f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a227 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a227:	6a 00                	push   $0x0
+  pushl $136
+8010a229:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a22e:	e9 12 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a233 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a233:	6a 00                	push   $0x0
+  pushl $137
+8010a235:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a23a:	e9 06 f5 ff ff       	jmp    80109745 <alltraps>
+
+8010a23f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a23f:	6a 00                	push   $0x0
+  pushl $138
+8010a241:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a246:	e9 fa f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a24b <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a24b:	6a 00                	push   $0x0
+  pushl $139
+8010a24d:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a252:	e9 ee f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a257 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a257:	6a 00                	push   $0x0
+  pushl $140
+8010a259:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a25e:	e9 e2 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a263 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a263:	6a 00                	push   $0x0
+  pushl $141
+8010a265:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a26a:	e9 d6 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a26f <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a26f:	6a 00                	push   $0x0
+  pushl $142
+8010a271:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a276:	e9 ca f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a27b <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a27b:	6a 00                	push   $0x0
+  pushl $143
+8010a27d:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a282:	e9 be f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a287 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a287:	6a 00                	push   $0x0
+  pushl $144
+8010a289:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a28e:	e9 b2 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a293 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a293:	6a 00                	push   $0x0
+  pushl $145
+8010a295:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a29a:	e9 a6 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a29f <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a29f:	6a 00                	push   $0x0
+  pushl $146
+8010a2a1:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a2a6:	e9 9a f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2ab <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a2ab:	6a 00                	push   $0x0
+  pushl $147
+8010a2ad:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a2b2:	e9 8e f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2b7 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a2b7:	6a 00                	push   $0x0
+  pushl $148
+8010a2b9:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a2be:	e9 82 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2c3 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a2c3:	6a 00                	push   $0x0
+  pushl $149
+8010a2c5:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a2ca:	e9 76 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2cf <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a2cf:	6a 00                	push   $0x0
+  pushl $150
+8010a2d1:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a2d6:	e9 6a f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2db <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a2db:	6a 00                	push   $0x0
+  pushl $151
+8010a2dd:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a2e2:	e9 5e f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2e7 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a2e7:	6a 00                	push   $0x0
+  pushl $152
+8010a2e9:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a2ee:	e9 52 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2f3 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a2f3:	6a 00                	push   $0x0
+  pushl $153
+8010a2f5:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a2fa:	e9 46 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a2ff <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a2ff:	6a 00                	push   $0x0
+  pushl $154
+8010a301:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a306:	e9 3a f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a30b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a30b:	6a 00                	push   $0x0
+  pushl $155
+8010a30d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a312:	e9 2e f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a317 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a317:	6a 00                	push   $0x0
+  pushl $156
+8010a319:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a31e:	e9 22 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a323 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a323:	6a 00                	push   $0x0
+  pushl $157
+8010a325:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a32a:	e9 16 f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a32f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a32f:	6a 00                	push   $0x0
+  pushl $158
+8010a331:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a336:	e9 0a f4 ff ff       	jmp    80109745 <alltraps>
+
+8010a33b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a33b:	6a 00                	push   $0x0
+  pushl $159
+8010a33d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a342:	e9 fe f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a347 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a347:	6a 00                	push   $0x0
+  pushl $160
+8010a349:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a34e:	e9 f2 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a353 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a353:	6a 00                	push   $0x0
+  pushl $161
+8010a355:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a35a:	e9 e6 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a35f <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a35f:	6a 00                	push   $0x0
+  pushl $162
+8010a361:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a366:	e9 da f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a36b <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a36b:	6a 00                	push   $0x0
+  pushl $163
+8010a36d:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a372:	e9 ce f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a377 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a377:	6a 00                	push   $0x0
+  pushl $164
+8010a379:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a37e:	e9 c2 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a383 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a383:	6a 00                	push   $0x0
+  pushl $165
+8010a385:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a38a:	e9 b6 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a38f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a38f:	6a 00                	push   $0x0
+  pushl $166
+8010a391:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a396:	e9 aa f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a39b <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a39b:	6a 00                	push   $0x0
+  pushl $167
+8010a39d:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a3a2:	e9 9e f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3a7 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a3a7:	6a 00                	push   $0x0
+  pushl $168
+8010a3a9:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a3ae:	e9 92 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3b3 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a3b3:	6a 00                	push   $0x0
+  pushl $169
+8010a3b5:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a3ba:	e9 86 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3bf <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a3bf:	6a 00                	push   $0x0
+  pushl $170
+8010a3c1:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a3c6:	e9 7a f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3cb <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a3cb:	6a 00                	push   $0x0
+  pushl $171
+8010a3cd:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a3d2:	e9 6e f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3d7 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a3d7:	6a 00                	push   $0x0
+  pushl $172
+8010a3d9:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a3de:	e9 62 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3e3 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a3e3:	6a 00                	push   $0x0
+  pushl $173
+8010a3e5:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a3ea:	e9 56 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3ef <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a3ef:	6a 00                	push   $0x0
+  pushl $174
+8010a3f1:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a3f6:	e9 4a f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a3fb <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a3fb:	6a 00                	push   $0x0
+  pushl $175
+8010a3fd:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a402:	e9 3e f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a407 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a407:	6a 00                	push   $0x0
+  pushl $176
+8010a409:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a40e:	e9 32 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a413 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a413:	6a 00                	push   $0x0
+  pushl $177
+8010a415:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a41a:	e9 26 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a41f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a41f:	6a 00                	push   $0x0
+  pushl $178
+8010a421:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a426:	e9 1a f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a42b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a42b:	6a 00                	push   $0x0
+  pushl $179
+8010a42d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a432:	e9 0e f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a437 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a437:	6a 00                	push   $0x0
+  pushl $180
+8010a439:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a43e:	e9 02 f3 ff ff       	jmp    80109745 <alltraps>
+
+8010a443 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a443:	6a 00                	push   $0x0
+  pushl $181
+8010a445:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a44a:	e9 f6 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a44f <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a44f:	6a 00                	push   $0x0
+  pushl $182
+8010a451:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a456:	e9 ea f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a45b <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a45b:	6a 00                	push   $0x0
+  pushl $183
+8010a45d:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a462:	e9 de f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a467 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a467:	6a 00                	push   $0x0
+  pushl $184
+8010a469:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a46e:	e9 d2 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a473 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a473:	6a 00                	push   $0x0
+  pushl $185
+8010a475:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a47a:	e9 c6 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a47f <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a47f:	6a 00                	push   $0x0
+  pushl $186
+8010a481:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a486:	e9 ba f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a48b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a48b:	6a 00                	push   $0x0
+  pushl $187
+8010a48d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a492:	e9 ae f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a497 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a497:	6a 00                	push   $0x0
+  pushl $188
+8010a499:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a49e:	e9 a2 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4a3 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a4a3:	6a 00                	push   $0x0
+  pushl $189
+8010a4a5:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a4aa:	e9 96 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4af <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a4af:	6a 00                	push   $0x0
+  pushl $190
+8010a4b1:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a4b6:	e9 8a f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4bb <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a4bb:	6a 00                	push   $0x0
+  pushl $191
+8010a4bd:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a4c2:	e9 7e f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4c7 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a4c7:	6a 00                	push   $0x0
+  pushl $192
+8010a4c9:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a4ce:	e9 72 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4d3 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a4d3:	6a 00                	push   $0x0
+  pushl $193
+8010a4d5:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a4da:	e9 66 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4df <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a4df:	6a 00                	push   $0x0
+  pushl $194
+8010a4e1:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a4e6:	e9 5a f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4eb <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a4eb:	6a 00                	push   $0x0
+  pushl $195
+8010a4ed:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a4f2:	e9 4e f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a4f7 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a4f7:	6a 00                	push   $0x0
+  pushl $196
+8010a4f9:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a4fe:	e9 42 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a503 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a503:	6a 00                	push   $0x0
+  pushl $197
+8010a505:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a50a:	e9 36 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a50f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a50f:	6a 00                	push   $0x0
+  pushl $198
+8010a511:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a516:	e9 2a f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a51b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a51b:	6a 00                	push   $0x0
+  pushl $199
+8010a51d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a522:	e9 1e f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a527 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a527:	6a 00                	push   $0x0
+  pushl $200
+8010a529:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a52e:	e9 12 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a533 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a533:	6a 00                	push   $0x0
+  pushl $201
+8010a535:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a53a:	e9 06 f2 ff ff       	jmp    80109745 <alltraps>
+
+8010a53f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a53f:	6a 00                	push   $0x0
+  pushl $202
+8010a541:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a546:	e9 fa f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a54b <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a54b:	6a 00                	push   $0x0
+  pushl $203
+8010a54d:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a552:	e9 ee f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a557 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a557:	6a 00                	push   $0x0
+  pushl $204
+8010a559:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a55e:	e9 e2 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a563 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a563:	6a 00                	push   $0x0
+  pushl $205
+8010a565:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a56a:	e9 d6 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a56f <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a56f:	6a 00                	push   $0x0
+  pushl $206
+8010a571:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a576:	e9 ca f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a57b <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a57b:	6a 00                	push   $0x0
+  pushl $207
+8010a57d:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a582:	e9 be f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a587 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a587:	6a 00                	push   $0x0
+  pushl $208
+8010a589:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a58e:	e9 b2 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a593 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a593:	6a 00                	push   $0x0
+  pushl $209
+8010a595:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a59a:	e9 a6 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a59f <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a59f:	6a 00                	push   $0x0
+  pushl $210
+8010a5a1:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a5a6:	e9 9a f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5ab <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a5ab:	6a 00                	push   $0x0
+  pushl $211
+8010a5ad:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a5b2:	e9 8e f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5b7 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a5b7:	6a 00                	push   $0x0
+  pushl $212
+8010a5b9:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a5be:	e9 82 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5c3 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a5c3:	6a 00                	push   $0x0
+  pushl $213
+8010a5c5:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a5ca:	e9 76 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5cf <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a5cf:	6a 00                	push   $0x0
+  pushl $214
+8010a5d1:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a5d6:	e9 6a f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5db <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a5db:	6a 00                	push   $0x0
+  pushl $215
+8010a5dd:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a5e2:	e9 5e f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5e7 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a5e7:	6a 00                	push   $0x0
+  pushl $216
+8010a5e9:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a5ee:	e9 52 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5f3 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a5f3:	6a 00                	push   $0x0
+  pushl $217
+8010a5f5:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a5fa:	e9 46 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a5ff <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a5ff:	6a 00                	push   $0x0
+  pushl $218
+8010a601:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a606:	e9 3a f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a60b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a60b:	6a 00                	push   $0x0
+  pushl $219
+8010a60d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a612:	e9 2e f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a617 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a617:	6a 00                	push   $0x0
+  pushl $220
+8010a619:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a61e:	e9 22 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a623 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a623:	6a 00                	push   $0x0
+  pushl $221
+8010a625:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a62a:	e9 16 f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a62f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a62f:	6a 00                	push   $0x0
+  pushl $222
+8010a631:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a636:	e9 0a f1 ff ff       	jmp    80109745 <alltraps>
+
+8010a63b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a63b:	6a 00                	push   $0x0
+  pushl $223
+8010a63d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a642:	e9 fe f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a647 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a647:	6a 00                	push   $0x0
+  pushl $224
+8010a649:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a64e:	e9 f2 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a653 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a653:	6a 00                	push   $0x0
+  pushl $225
+8010a655:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a65a:	e9 e6 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a65f <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a65f:	6a 00                	push   $0x0
+  pushl $226
+8010a661:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a666:	e9 da f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a66b <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a66b:	6a 00                	push   $0x0
+  pushl $227
+8010a66d:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a672:	e9 ce f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a677 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a677:	6a 00                	push   $0x0
+  pushl $228
+8010a679:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a67e:	e9 c2 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a683 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a683:	6a 00                	push   $0x0
+  pushl $229
+8010a685:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a68a:	e9 b6 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a68f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a68f:	6a 00                	push   $0x0
+  pushl $230
+8010a691:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a696:	e9 aa f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a69b <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a69b:	6a 00                	push   $0x0
+  pushl $231
+8010a69d:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a6a2:	e9 9e f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6a7 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a6a7:	6a 00                	push   $0x0
+  pushl $232
+8010a6a9:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a6ae:	e9 92 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6b3 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a6b3:	6a 00                	push   $0x0
+  pushl $233
+8010a6b5:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a6ba:	e9 86 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6bf <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a6bf:	6a 00                	push   $0x0
+  pushl $234
+8010a6c1:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a6c6:	e9 7a f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6cb <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a6cb:	6a 00                	push   $0x0
+  pushl $235
+8010a6cd:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a6d2:	e9 6e f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6d7 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a6d7:	6a 00                	push   $0x0
+  pushl $236
+8010a6d9:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a6de:	e9 62 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6e3 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a6e3:	6a 00                	push   $0x0
+  pushl $237
+8010a6e5:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a6ea:	e9 56 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6ef <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a6ef:	6a 00                	push   $0x0
+  pushl $238
+8010a6f1:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a6f6:	e9 4a f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a6fb <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a6fb:	6a 00                	push   $0x0
+  pushl $239
+8010a6fd:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a702:	e9 3e f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a707 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a707:	6a 00                	push   $0x0
+  pushl $240
+8010a709:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a70e:	e9 32 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a713 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a713:	6a 00                	push   $0x0
+  pushl $241
+8010a715:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a71a:	e9 26 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a71f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a71f:	6a 00                	push   $0x0
+  pushl $242
+8010a721:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a726:	e9 1a f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a72b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a72b:	6a 00                	push   $0x0
+  pushl $243
+8010a72d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a732:	e9 0e f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a737 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a737:	6a 00                	push   $0x0
+  pushl $244
+8010a739:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a73e:	e9 02 f0 ff ff       	jmp    80109745 <alltraps>
+
+8010a743 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a743:	6a 00                	push   $0x0
+  pushl $245
+8010a745:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a74a:	e9 f6 ef ff ff       	jmp    80109745 <alltraps>
+
+8010a74f <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a74f:	6a 00                	push   $0x0
+  pushl $246
+8010a751:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a756:	e9 ea ef ff ff       	jmp    80109745 <alltraps>
+
+8010a75b <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a75b:	6a 00                	push   $0x0
+  pushl $247
+8010a75d:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a762:	e9 de ef ff ff       	jmp    80109745 <alltraps>
+
+8010a767 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a767:	6a 00                	push   $0x0
+  pushl $248
+8010a769:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a76e:	e9 d2 ef ff ff       	jmp    80109745 <alltraps>
+
+8010a773 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a773:	6a 00                	push   $0x0
+  pushl $249
+8010a775:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a77a:	e9 c6 ef ff ff       	jmp    80109745 <alltraps>
+
+8010a77f <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a77f:	6a 00                	push   $0x0
+  pushl $250
+8010a781:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a786:	e9 ba ef ff ff       	jmp    80109745 <alltraps>
+
+8010a78b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a78b:	6a 00                	push   $0x0
+  pushl $251
+8010a78d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a792:	e9 ae ef ff ff       	jmp    80109745 <alltraps>
+
+8010a797 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a797:	6a 00                	push   $0x0
+  pushl $252
+8010a799:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a79e:	e9 a2 ef ff ff       	jmp    80109745 <alltraps>
+
+8010a7a3 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a7a3:	6a 00                	push   $0x0
+  pushl $253
+8010a7a5:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a7aa:	e9 96 ef ff ff       	jmp    80109745 <alltraps>
+
+8010a7af <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a7af:	6a 00                	push   $0x0
+  pushl $254
+8010a7b1:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a7b6:	e9 8a ef ff ff       	jmp    80109745 <alltraps>
+
+8010a7bb <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a7bb:	6a 00                	push   $0x0
+  pushl $255
+8010a7bd:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a7c2:	e9 7e ef ff ff       	jmp    80109745 <alltraps>
+8010a7c7:	66 90                	xchg   %ax,%ax
+8010a7c9:	66 90                	xchg   %ax,%ax
+8010a7cb:	66 90                	xchg   %ax,%ax
+8010a7cd:	66 90                	xchg   %ax,%ax
+8010a7cf:	90                   	nop
+
+8010a7d0 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a7d0:	55                   	push   %ebp
+8010a7d1:	89 e5                	mov    %esp,%ebp
+8010a7d3:	57                   	push   %edi
+8010a7d4:	56                   	push   %esi
+8010a7d5:	53                   	push   %ebx
+    return oldsz;
+
+  // Get the 'address' of the first page above newsz
+  // Note: 'a < oldsz' is due to zero indexing of addresses
+  // Recall: page directory has 1024 entries.
+  a = PGROUNDUP(newsz);
+8010a7d6:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a7dc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a7e2:	83 ec 1c             	sub    $0x1c,%esp
+  for (; a < oldsz; a += PGSIZE) {
+8010a7e5:	39 d3                	cmp    %edx,%ebx
+8010a7e7:	73 56                	jae    8010a83f <deallocuvm.part.0+0x6f>
+8010a7e9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a7ec:	89 c6                	mov    %eax,%esi
+8010a7ee:	89 d7                	mov    %edx,%edi
+8010a7f0:	eb 12                	jmp    8010a804 <deallocuvm.part.0+0x34>
+8010a7f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char *) a, 0);
+
+    // if NULL ptr, page table does not exist, so skip ahead to the next page
+    // dir entry. Subtract PGSIZE to cancel the for-loop's update statement.
+    if (!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a7f8:	83 c2 01             	add    $0x1,%edx
+8010a7fb:	89 d3                	mov    %edx,%ebx
+8010a7fd:	c1 e3 16             	shl    $0x16,%ebx
+  for (; a < oldsz; a += PGSIZE) {
+8010a800:	39 fb                	cmp    %edi,%ebx
+8010a802:	73 38                	jae    8010a83c <deallocuvm.part.0+0x6c>
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010a804:	89 da                	mov    %ebx,%edx
+8010a806:	c1 ea 16             	shr    $0x16,%edx
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010a809:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a80c:	a8 01                	test   $0x1,%al
+8010a80e:	74 e8                	je     8010a7f8 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a810:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010a812:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a817:	c1 e9 0a             	shr    $0xa,%ecx
+8010a81a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a820:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if (!pte)
+8010a827:	85 c0                	test   %eax,%eax
+8010a829:	74 cd                	je     8010a7f8 <deallocuvm.part.0+0x28>
+
+    else if ((*pte & PTE_P) != 0) { // check that the pte is actually present
+8010a82b:	8b 10                	mov    (%eax),%edx
+8010a82d:	f6 c2 01             	test   $0x1,%dl
+8010a830:	75 1e                	jne    8010a850 <deallocuvm.part.0+0x80>
+  for (; a < oldsz; a += PGSIZE) {
+8010a832:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a838:	39 fb                	cmp    %edi,%ebx
+8010a83a:	72 c8                	jb     8010a804 <deallocuvm.part.0+0x34>
+8010a83c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010a83f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a842:	89 c8                	mov    %ecx,%eax
+8010a844:	5b                   	pop    %ebx
+8010a845:	5e                   	pop    %esi
+8010a846:	5f                   	pop    %edi
+8010a847:	5d                   	pop    %ebp
+8010a848:	c3                   	ret
+8010a849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if (pa == 0)
+8010a850:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a856:	74 26                	je     8010a87e <deallocuvm.part.0+0xae>
+      kfree(v);
+8010a858:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a85b:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a861:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (; a < oldsz; a += PGSIZE) {
+8010a864:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010a86a:	52                   	push   %edx
+8010a86b:	e8 20 89 ff ff       	call   80103190 <kfree>
+      *pte = 0;
+8010a870:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (; a < oldsz; a += PGSIZE) {
+8010a873:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+8010a876:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010a87c:	eb 82                	jmp    8010a800 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010a87e:	83 ec 0c             	sub    $0xc,%esp
+8010a881:	68 ee b4 10 80       	push   $0x8010b4ee
+8010a886:	e8 55 5b ff ff       	call   801003e0 <panic>
+8010a88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a88f:	90                   	nop
+
+8010a890 <mappages>:
+{
+8010a890:	55                   	push   %ebp
+8010a891:	89 e5                	mov    %esp,%ebp
+8010a893:	57                   	push   %edi
+8010a894:	56                   	push   %esi
+8010a895:	53                   	push   %ebx
+  a = (char*) PGROUNDDOWN((uint) va);
+8010a896:	89 d3                	mov    %edx,%ebx
+8010a898:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010a89e:	83 ec 1c             	sub    $0x1c,%esp
+8010a8a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*) PGROUNDDOWN(((uint) va) + size - 1);
+8010a8a4:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a8a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a8ad:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010a8b0:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a8b3:	29 d8                	sub    %ebx,%eax
+8010a8b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a8b8:	eb 3f                	jmp    8010a8f9 <mappages+0x69>
+8010a8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a8c0:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010a8c2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a8c7:	c1 ea 0a             	shr    $0xa,%edx
+8010a8ca:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a8d0:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if ((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a8d7:	85 c0                	test   %eax,%eax
+8010a8d9:	74 75                	je     8010a950 <mappages+0xc0>
+    if (*pte & PTE_P)
+8010a8db:	f6 00 01             	testb  $0x1,(%eax)
+8010a8de:	0f 85 86 00 00 00    	jne    8010a96a <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010a8e4:	0b 75 0c             	or     0xc(%ebp),%esi
+8010a8e7:	83 ce 01             	or     $0x1,%esi
+8010a8ea:	89 30                	mov    %esi,(%eax)
+    if (a == last)
+8010a8ec:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010a8ef:	39 c3                	cmp    %eax,%ebx
+8010a8f1:	74 6d                	je     8010a960 <mappages+0xd0>
+    a += PGSIZE;
+8010a8f3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for (;;) {
+8010a8f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010a8fc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a8ff:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010a902:	89 d8                	mov    %ebx,%eax
+8010a904:	c1 e8 16             	shr    $0x16,%eax
+8010a907:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010a90a:	8b 07                	mov    (%edi),%eax
+8010a90c:	a8 01                	test   $0x1,%al
+8010a90e:	75 b0                	jne    8010a8c0 <mappages+0x30>
+    if (!alloc || (pgtab = (pte_t*) kalloc()) == 0)
+8010a910:	e8 3b 8a ff ff       	call   80103350 <kalloc>
+8010a915:	85 c0                	test   %eax,%eax
+8010a917:	74 37                	je     8010a950 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010a919:	83 ec 04             	sub    $0x4,%esp
+8010a91c:	68 00 10 00 00       	push   $0x1000
+8010a921:	6a 00                	push   $0x0
+8010a923:	50                   	push   %eax
+8010a924:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010a927:	e8 84 c9 ff ff       	call   801072b0 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a92c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010a92f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a932:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010a938:	83 c8 07             	or     $0x7,%eax
+8010a93b:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010a93d:	89 d8                	mov    %ebx,%eax
+8010a93f:	c1 e8 0a             	shr    $0xa,%eax
+8010a942:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a947:	01 d0                	add    %edx,%eax
+8010a949:	eb 90                	jmp    8010a8db <mappages+0x4b>
+8010a94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a94f:	90                   	nop
+}
+8010a950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a953:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a958:	5b                   	pop    %ebx
+8010a959:	5e                   	pop    %esi
+8010a95a:	5f                   	pop    %edi
+8010a95b:	5d                   	pop    %ebp
+8010a95c:	c3                   	ret
+8010a95d:	8d 76 00             	lea    0x0(%esi),%esi
+8010a960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a963:	31 c0                	xor    %eax,%eax
+}
+8010a965:	5b                   	pop    %ebx
+8010a966:	5e                   	pop    %esi
+8010a967:	5f                   	pop    %edi
+8010a968:	5d                   	pop    %ebp
+8010a969:	c3                   	ret
+      panic("remap");
+8010a96a:	83 ec 0c             	sub    $0xc,%esp
+8010a96d:	68 78 bc 10 80       	push   $0x8010bc78
+8010a972:	e8 69 5a ff ff       	call   801003e0 <panic>
+8010a977:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a97e:	66 90                	xchg   %ax,%ax
+
+8010a980 <seginit>:
+{
+8010a980:	55                   	push   %ebp
+8010a981:	89 e5                	mov    %esp,%ebp
+8010a983:	53                   	push   %ebx
+8010a984:	83 ec 14             	sub    $0x14,%esp
+  apicid = lapicid();
+8010a987:	e8 44 8c ff ff       	call   801035d0 <lapicid>
+  for(c = cpus; c < cpus+ncpu-1 && c->apicid != apicid; c++)
+8010a98c:	ba 80 68 11 80       	mov    $0x80116880,%edx
+8010a991:	69 1d 64 68 11 80 ec 	imul   $0xec,0x80116864,%ebx
+8010a998:	00 00 00 
+8010a99b:	81 c3 94 67 11 80    	add    $0x80116794,%ebx
+8010a9a1:	39 d3                	cmp    %edx,%ebx
+8010a9a3:	77 15                	ja     8010a9ba <seginit+0x3a>
+8010a9a5:	eb 1a                	jmp    8010a9c1 <seginit+0x41>
+8010a9a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a9ae:	66 90                	xchg   %ax,%ax
+8010a9b0:	81 c2 ec 00 00 00    	add    $0xec,%edx
+8010a9b6:	39 da                	cmp    %ebx,%edx
+8010a9b8:	73 07                	jae    8010a9c1 <seginit+0x41>
+8010a9ba:	0f b6 0a             	movzbl (%edx),%ecx
+8010a9bd:	39 c1                	cmp    %eax,%ecx
+8010a9bf:	75 ef                	jne    8010a9b0 <seginit+0x30>
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a9c1:	8d 82 e4 00 00 00    	lea    0xe4(%edx),%eax
+8010a9c7:	31 c9                	xor    %ecx,%ecx
+8010a9c9:	bb 92 c0 ff ff       	mov    $0xffffc092,%ebx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a9ce:	c7 42 78 ff ff 00 00 	movl   $0xffff,0x78(%edx)
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010a9d5:	66 89 8a a0 00 00 00 	mov    %cx,0xa0(%edx)
+8010a9dc:	89 c1                	mov    %eax,%ecx
+8010a9de:	c1 e9 10             	shr    $0x10,%ecx
+8010a9e1:	66 89 82 a2 00 00 00 	mov    %ax,0xa2(%edx)
+8010a9e8:	c1 e8 18             	shr    $0x18,%eax
+8010a9eb:	88 8a a4 00 00 00    	mov    %cl,0xa4(%edx)
+  pd[0] = size-1;
+8010a9f1:	b9 37 00 00 00       	mov    $0x37,%ecx
+8010a9f6:	88 82 a7 00 00 00    	mov    %al,0xa7(%edx)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a9fc:	8d 42 70             	lea    0x70(%edx),%eax
+8010a9ff:	66 89 4d f2          	mov    %cx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010aa03:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010aa07:	c1 e8 10             	shr    $0x10,%eax
+8010aa0a:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010aa0e:	8d 45 f2             	lea    -0xe(%ebp),%eax
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010aa11:	c7 42 7c 00 9a cf 00 	movl   $0xcf9a00,0x7c(%edx)
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010aa18:	c7 82 80 00 00 00 ff 	movl   $0xffff,0x80(%edx)
+8010aa1f:	ff 00 00 
+8010aa22:	c7 82 84 00 00 00 00 	movl   $0xcf9200,0x84(%edx)
+8010aa29:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010aa2c:	c7 82 88 00 00 00 ff 	movl   $0xffff,0x88(%edx)
+8010aa33:	ff 00 00 
+8010aa36:	c7 82 8c 00 00 00 00 	movl   $0xcffa00,0x8c(%edx)
+8010aa3d:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010aa40:	c7 82 90 00 00 00 ff 	movl   $0xffff,0x90(%edx)
+8010aa47:	ff 00 00 
+8010aa4a:	c7 82 94 00 00 00 00 	movl   $0xcff200,0x94(%edx)
+8010aa51:	f2 cf 00 
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
+8010aa54:	66 89 9a a5 00 00 00 	mov    %bx,0xa5(%edx)
+8010aa5b:	0f 01 10             	lgdtl  (%eax)
+  asm volatile("movw %0, %%gs" : : "r" (v));
+8010aa5e:	b8 30 00 00 00       	mov    $0x30,%eax
+8010aa63:	8e e8                	mov    %eax,%gs
+  c->cpu = c;
+8010aa65:	89 92 e4 00 00 00    	mov    %edx,0xe4(%edx)
+  c->proc = 0;
+8010aa6b:	c7 82 e8 00 00 00 00 	movl   $0x0,0xe8(%edx)
+8010aa72:	00 00 00 
+}
+8010aa75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010aa78:	c9                   	leave
+8010aa79:	c3                   	ret
+8010aa7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010aa80 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010aa80:	a1 44 89 18 80       	mov    0x80188944,%eax
+8010aa85:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010aa8a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010aa8d:	c3                   	ret
+8010aa8e:	66 90                	xchg   %ax,%ax
+
+8010aa90 <switchuvm>:
+{ 
+8010aa90:	55                   	push   %ebp
+8010aa91:	89 e5                	mov    %esp,%ebp
+8010aa93:	57                   	push   %edi
+8010aa94:	56                   	push   %esi
+8010aa95:	53                   	push   %ebx
+8010aa96:	83 ec 1c             	sub    $0x1c,%esp
+8010aa99:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (p == 0)
+8010aa9c:	85 f6                	test   %esi,%esi
+8010aa9e:	0f 84 dc 00 00 00    	je     8010ab80 <switchuvm+0xf0>
+  if (p->kstack == 0)
+8010aaa4:	8b 5e 5c             	mov    0x5c(%esi),%ebx
+8010aaa7:	85 db                	test   %ebx,%ebx
+8010aaa9:	0f 84 eb 00 00 00    	je     8010ab9a <switchuvm+0x10a>
+  if (p->pgdir == 0)
+8010aaaf:	8b 4e 58             	mov    0x58(%esi),%ecx
+8010aab2:	85 c9                	test   %ecx,%ecx
+8010aab4:	0f 84 d3 00 00 00    	je     8010ab8d <switchuvm+0xfd>
+  pushcli();
+8010aaba:	e8 41 c0 ff ff       	call   80106b00 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts, sizeof(mycpu()->ts)-1, 0);
+8010aabf:	e8 5c a5 ff ff       	call   80105020 <mycpu>
+8010aac4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010aac7:	e8 54 a5 ff ff       	call   80105020 <mycpu>
+8010aacc:	89 c7                	mov    %eax,%edi
+8010aace:	e8 4d a5 ff ff       	call   80105020 <mycpu>
+8010aad3:	83 c7 08             	add    $0x8,%edi
+8010aad6:	89 c3                	mov    %eax,%ebx
+8010aad8:	e8 43 a5 ff ff       	call   80105020 <mycpu>
+8010aadd:	83 c3 08             	add    $0x8,%ebx
+8010aae0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010aae3:	b9 67 00 00 00       	mov    $0x67,%ecx
+8010aae8:	c1 eb 10             	shr    $0x10,%ebx
+8010aaeb:	83 c0 08             	add    $0x8,%eax
+8010aaee:	88 9a 9c 00 00 00    	mov    %bl,0x9c(%edx)
+8010aaf4:	c1 e8 18             	shr    $0x18,%eax
+8010aaf7:	bb 99 40 00 00       	mov    $0x4099,%ebx
+8010aafc:	66 89 8a 98 00 00 00 	mov    %cx,0x98(%edx)
+8010ab03:	66 89 ba 9a 00 00 00 	mov    %di,0x9a(%edx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ab0a:	bf 10 00 00 00       	mov    $0x10,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts, sizeof(mycpu()->ts)-1, 0);
+8010ab0f:	66 89 9a 9d 00 00 00 	mov    %bx,0x9d(%edx)
+8010ab16:	88 82 9f 00 00 00    	mov    %al,0x9f(%edx)
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010ab1c:	e8 ff a4 ff ff       	call   80105020 <mycpu>
+8010ab21:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ab28:	e8 f3 a4 ff ff       	call   80105020 <mycpu>
+8010ab2d:	66 89 78 10          	mov    %di,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010ab31:	8b 5e 5c             	mov    0x5c(%esi),%ebx
+8010ab34:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010ab3a:	e8 e1 a4 ff ff       	call   80105020 <mycpu>
+8010ab3f:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010ab42:	e8 d9 a4 ff ff       	call   80105020 <mycpu>
+8010ab47:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+8010ab4c:	66 89 50 6e          	mov    %dx,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010ab50:	b8 28 00 00 00       	mov    $0x28,%eax
+8010ab55:	0f 00 d8             	ltr    %ax
+  wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
+8010ab58:	8b 46 5c             	mov    0x5c(%esi),%eax
+8010ab5b:	31 d2                	xor    %edx,%edx
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+8010ab5d:	b9 75 01 00 00       	mov    $0x175,%ecx
+8010ab62:	05 00 10 00 00       	add    $0x1000,%eax
+8010ab67:	0f 30                	wrmsr
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010ab69:	8b 46 58             	mov    0x58(%esi),%eax
+8010ab6c:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010ab71:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ab74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab77:	5b                   	pop    %ebx
+8010ab78:	5e                   	pop    %esi
+8010ab79:	5f                   	pop    %edi
+8010ab7a:	5d                   	pop    %ebp
+  popcli();
+8010ab7b:	e9 d0 bf ff ff       	jmp    80106b50 <popcli>
+    panic("switchuvm: no process");
+8010ab80:	83 ec 0c             	sub    $0xc,%esp
+8010ab83:	68 7e bc 10 80       	push   $0x8010bc7e
+8010ab88:	e8 53 58 ff ff       	call   801003e0 <panic>
+    panic("switchuvm: no pgdir");
+8010ab8d:	83 ec 0c             	sub    $0xc,%esp
+8010ab90:	68 a9 bc 10 80       	push   $0x8010bca9
+8010ab95:	e8 46 58 ff ff       	call   801003e0 <panic>
+    panic("switchuvm: no kstack");
+8010ab9a:	83 ec 0c             	sub    $0xc,%esp
+8010ab9d:	68 94 bc 10 80       	push   $0x8010bc94
+8010aba2:	e8 39 58 ff ff       	call   801003e0 <panic>
+8010aba7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010abae:	66 90                	xchg   %ax,%ax
+
+8010abb0 <inituvm>:
+{
+8010abb0:	55                   	push   %ebp
+8010abb1:	89 e5                	mov    %esp,%ebp
+8010abb3:	57                   	push   %edi
+8010abb4:	56                   	push   %esi
+8010abb5:	53                   	push   %ebx
+8010abb6:	83 ec 1c             	sub    $0x1c,%esp
+8010abb9:	8b 45 08             	mov    0x8(%ebp),%eax
+8010abbc:	8b 75 10             	mov    0x10(%ebp),%esi
+8010abbf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010abc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE) // function only sets up first page
+8010abc5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010abcb:	77 49                	ja     8010ac16 <inituvm+0x66>
+  mem = kalloc(); 
+8010abcd:	e8 7e 87 ff ff       	call   80103350 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010abd2:	83 ec 04             	sub    $0x4,%esp
+8010abd5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc(); 
+8010abda:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010abdc:	6a 00                	push   $0x0
+8010abde:	50                   	push   %eax
+8010abdf:	e8 cc c6 ff ff       	call   801072b0 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010abe4:	58                   	pop    %eax
+8010abe5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010abeb:	5a                   	pop    %edx
+8010abec:	6a 06                	push   $0x6
+8010abee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010abf3:	31 d2                	xor    %edx,%edx
+8010abf5:	50                   	push   %eax
+8010abf6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010abf9:	e8 92 fc ff ff       	call   8010a890 <mappages>
+  memmove(mem, init, sz);
+8010abfe:	89 75 10             	mov    %esi,0x10(%ebp)
+8010ac01:	83 c4 10             	add    $0x10,%esp
+8010ac04:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010ac07:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010ac0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac0d:	5b                   	pop    %ebx
+8010ac0e:	5e                   	pop    %esi
+8010ac0f:	5f                   	pop    %edi
+8010ac10:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010ac11:	e9 2a c7 ff ff       	jmp    80107340 <memmove>
+    panic("inituvm: more than a page");
+8010ac16:	83 ec 0c             	sub    $0xc,%esp
+8010ac19:	68 bd bc 10 80       	push   $0x8010bcbd
+8010ac1e:	e8 bd 57 ff ff       	call   801003e0 <panic>
+8010ac23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ac30 <loaduvm>:
+{
+8010ac30:	55                   	push   %ebp
+8010ac31:	89 e5                	mov    %esp,%ebp
+8010ac33:	57                   	push   %edi
+8010ac34:	56                   	push   %esi
+8010ac35:	53                   	push   %ebx
+8010ac36:	83 ec 0c             	sub    $0xc,%esp
+  if ((uint) addr % PGSIZE != 0)
+8010ac39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010ac3c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if ((uint) addr % PGSIZE != 0)
+8010ac3f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010ac45:	0f 85 a2 00 00 00    	jne    8010aced <loaduvm+0xbd>
+  for (i = 0; i < sz; i += PGSIZE) {
+8010ac4b:	85 ff                	test   %edi,%edi
+8010ac4d:	74 7d                	je     8010accc <loaduvm+0x9c>
+8010ac4f:	90                   	nop
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010ac50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010ac53:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ac56:	01 f0                	add    %esi,%eax
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010ac58:	89 c1                	mov    %eax,%ecx
+8010ac5a:	c1 e9 16             	shr    $0x16,%ecx
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010ac5d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010ac60:	f6 c1 01             	test   $0x1,%cl
+8010ac63:	75 13                	jne    8010ac78 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010ac65:	83 ec 0c             	sub    $0xc,%esp
+8010ac68:	68 d7 bc 10 80       	push   $0x8010bcd7
+8010ac6d:	e8 6e 57 ff ff       	call   801003e0 <panic>
+8010ac72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ac78:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010ac7b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ac81:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ac86:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if ((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010ac8d:	85 c9                	test   %ecx,%ecx
+8010ac8f:	74 d4                	je     8010ac65 <loaduvm+0x35>
+    if (sz - i < PGSIZE) // If remaining size is less than PGSIZE, change n
+8010ac91:	89 fb                	mov    %edi,%ebx
+8010ac93:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010ac98:	29 f3                	sub    %esi,%ebx
+8010ac9a:	39 c3                	cmp    %eax,%ebx
+8010ac9c:	0f 47 d8             	cmova  %eax,%ebx
+    if (readi(ip, P2V(pa), offset+i, n) != n)
+8010ac9f:	53                   	push   %ebx
+8010aca0:	8b 45 14             	mov    0x14(%ebp),%eax
+8010aca3:	01 f0                	add    %esi,%eax
+8010aca5:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010aca6:	8b 01                	mov    (%ecx),%eax
+8010aca8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if (readi(ip, P2V(pa), offset+i, n) != n)
+8010acad:	05 00 00 00 80       	add    $0x80000000,%eax
+8010acb2:	50                   	push   %eax
+8010acb3:	ff 75 10             	push   0x10(%ebp)
+8010acb6:	e8 85 77 ff ff       	call   80102440 <readi>
+8010acbb:	83 c4 10             	add    $0x10,%esp
+8010acbe:	39 d8                	cmp    %ebx,%eax
+8010acc0:	75 1e                	jne    8010ace0 <loaduvm+0xb0>
+  for (i = 0; i < sz; i += PGSIZE) {
+8010acc2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010acc8:	39 fe                	cmp    %edi,%esi
+8010acca:	72 84                	jb     8010ac50 <loaduvm+0x20>
+}
+8010accc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010accf:	31 c0                	xor    %eax,%eax
+}
+8010acd1:	5b                   	pop    %ebx
+8010acd2:	5e                   	pop    %esi
+8010acd3:	5f                   	pop    %edi
+8010acd4:	5d                   	pop    %ebp
+8010acd5:	c3                   	ret
+8010acd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010acdd:	8d 76 00             	lea    0x0(%esi),%esi
+8010ace0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010ace3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ace8:	5b                   	pop    %ebx
+8010ace9:	5e                   	pop    %esi
+8010acea:	5f                   	pop    %edi
+8010aceb:	5d                   	pop    %ebp
+8010acec:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010aced:	83 ec 0c             	sub    $0xc,%esp
+8010acf0:	68 78 bd 10 80       	push   $0x8010bd78
+8010acf5:	e8 e6 56 ff ff       	call   801003e0 <panic>
+8010acfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ad00 <allocuvm>:
+{
+8010ad00:	55                   	push   %ebp
+8010ad01:	89 e5                	mov    %esp,%ebp
+8010ad03:	57                   	push   %edi
+8010ad04:	56                   	push   %esi
+8010ad05:	53                   	push   %ebx
+8010ad06:	83 ec 0c             	sub    $0xc,%esp
+8010ad09:	8b 55 10             	mov    0x10(%ebp),%edx
+  if (newsz > VDSO)
+8010ad0c:	81 fa 00 f0 ff 7f    	cmp    $0x7ffff000,%edx
+8010ad12:	0f 87 a1 00 00 00    	ja     8010adb9 <allocuvm+0xb9>
+    return oldsz;
+8010ad18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (newsz < oldsz)
+8010ad1b:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010ad1e:	0f 82 97 00 00 00    	jb     8010adbb <allocuvm+0xbb>
+  a = PGROUNDUP(oldsz);
+8010ad24:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010ad29:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ad2e:	89 c6                	mov    %eax,%esi
+  for (; a < newsz; a += PGSIZE) {
+8010ad30:	39 d0                	cmp    %edx,%eax
+8010ad32:	0f 83 93 00 00 00    	jae    8010adcb <allocuvm+0xcb>
+8010ad38:	8d 4a ff             	lea    -0x1(%edx),%ecx
+8010ad3b:	89 55 10             	mov    %edx,0x10(%ebp)
+8010ad3e:	29 c1                	sub    %eax,%ecx
+8010ad40:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+8010ad46:	8d bc 08 00 10 00 00 	lea    0x1000(%eax,%ecx,1),%edi
+8010ad4d:	eb 3c                	jmp    8010ad8b <allocuvm+0x8b>
+8010ad4f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010ad50:	83 ec 04             	sub    $0x4,%esp
+8010ad53:	68 00 10 00 00       	push   $0x1000
+8010ad58:	6a 00                	push   $0x0
+8010ad5a:	50                   	push   %eax
+8010ad5b:	e8 50 c5 ff ff       	call   801072b0 <memset>
+    if (mappages(pgdir, (char *) a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0) {
+8010ad60:	58                   	pop    %eax
+8010ad61:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ad67:	5a                   	pop    %edx
+8010ad68:	6a 06                	push   $0x6
+8010ad6a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ad6f:	89 f2                	mov    %esi,%edx
+8010ad71:	50                   	push   %eax
+8010ad72:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ad75:	e8 16 fb ff ff       	call   8010a890 <mappages>
+8010ad7a:	83 c4 10             	add    $0x10,%esp
+8010ad7d:	85 c0                	test   %eax,%eax
+8010ad7f:	78 57                	js     8010add8 <allocuvm+0xd8>
+  for (; a < newsz; a += PGSIZE) {
+8010ad81:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010ad87:	39 fe                	cmp    %edi,%esi
+8010ad89:	74 3d                	je     8010adc8 <allocuvm+0xc8>
+    mem = kalloc();
+8010ad8b:	e8 c0 85 ff ff       	call   80103350 <kalloc>
+8010ad90:	89 c3                	mov    %eax,%ebx
+    if (mem == 0) {
+8010ad92:	85 c0                	test   %eax,%eax
+8010ad94:	75 ba                	jne    8010ad50 <allocuvm+0x50>
+      cprintf("allocuvm out of memory\n");
+8010ad96:	83 ec 0c             	sub    $0xc,%esp
+8010ad99:	68 f5 bc 10 80       	push   $0x8010bcf5
+8010ad9e:	e8 6d 59 ff ff       	call   80100710 <cprintf>
+  if (newsz >= oldsz)
+8010ada3:	8b 55 10             	mov    0x10(%ebp),%edx
+8010ada6:	83 c4 10             	add    $0x10,%esp
+8010ada9:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010adac:	74 0b                	je     8010adb9 <allocuvm+0xb9>
+8010adae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010adb1:	8b 45 08             	mov    0x8(%ebp),%eax
+8010adb4:	e8 17 fa ff ff       	call   8010a7d0 <deallocuvm.part.0>
+    return 0;
+8010adb9:	31 c0                	xor    %eax,%eax
+}
+8010adbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010adbe:	5b                   	pop    %ebx
+8010adbf:	5e                   	pop    %esi
+8010adc0:	5f                   	pop    %edi
+8010adc1:	5d                   	pop    %ebp
+8010adc2:	c3                   	ret
+8010adc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010adc7:	90                   	nop
+8010adc8:	8b 55 10             	mov    0x10(%ebp),%edx
+8010adcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return newsz;
+8010adce:	89 d0                	mov    %edx,%eax
+}
+8010add0:	5b                   	pop    %ebx
+8010add1:	5e                   	pop    %esi
+8010add2:	5f                   	pop    %edi
+8010add3:	5d                   	pop    %ebp
+8010add4:	c3                   	ret
+8010add5:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010add8:	83 ec 0c             	sub    $0xc,%esp
+8010addb:	68 0d bd 10 80       	push   $0x8010bd0d
+8010ade0:	e8 2b 59 ff ff       	call   80100710 <cprintf>
+  if (newsz >= oldsz)
+8010ade5:	8b 55 10             	mov    0x10(%ebp),%edx
+8010ade8:	83 c4 10             	add    $0x10,%esp
+8010adeb:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010adee:	74 0b                	je     8010adfb <allocuvm+0xfb>
+8010adf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010adf3:	8b 45 08             	mov    0x8(%ebp),%eax
+8010adf6:	e8 d5 f9 ff ff       	call   8010a7d0 <deallocuvm.part.0>
+      kfree(mem);
+8010adfb:	83 ec 0c             	sub    $0xc,%esp
+8010adfe:	53                   	push   %ebx
+8010adff:	e8 8c 83 ff ff       	call   80103190 <kfree>
+      return 0;
+8010ae04:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010ae07:	31 c0                	xor    %eax,%eax
+8010ae09:	eb b0                	jmp    8010adbb <allocuvm+0xbb>
+8010ae0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010ae0f:	90                   	nop
+
+8010ae10 <mapvdso>:
+{
+8010ae10:	55                   	push   %ebp
+8010ae11:	89 e5                	mov    %esp,%ebp
+8010ae13:	53                   	push   %ebx
+8010ae14:	83 ec 04             	sub    $0x4,%esp
+  if ((v = (struct vdso*) kalloc()) == 0)
+8010ae17:	e8 34 85 ff ff       	call   80103350 <kalloc>
+8010ae1c:	85 c0                	test   %eax,%eax
+8010ae1e:	74 56                	je     8010ae76 <mapvdso+0x66>
+  memset(v, 0, PGSIZE);
+8010ae20:	83 ec 04             	sub    $0x4,%esp
+8010ae23:	89 c3                	mov    %eax,%ebx
+8010ae25:	68 00 10 00 00       	push   $0x1000
+8010ae2a:	6a 00                	push   $0x0
+8010ae2c:	50                   	push   %eax
+8010ae2d:	e8 7e c4 ff ff       	call   801072b0 <memset>
+  v->pid = pid;
+8010ae32:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010ae35:	89 03                	mov    %eax,(%ebx)
+  timervdso(v);
+8010ae37:	89 1c 24             	mov    %ebx,(%esp)
+8010ae3a:	e8 f1 de ff ff       	call   80108d30 <timervdso>
+  if (mappages(pgdir, (char*) VDSO, PGSIZE, V2P(v), PTE_U) < 0) {
+8010ae3f:	58                   	pop    %eax
+8010ae40:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ae46:	5a                   	pop    %edx
+8010ae47:	6a 04                	push   $0x4
+8010ae49:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ae4e:	ba 00 f0 ff 7f       	mov    $0x7ffff000,%edx
+8010ae53:	50                   	push   %eax
+8010ae54:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ae57:	e8 34 fa ff ff       	call   8010a890 <mappages>
+8010ae5c:	83 c4 10             	add    $0x10,%esp
+8010ae5f:	85 c0                	test   %eax,%eax
+8010ae61:	78 07                	js     8010ae6a <mapvdso+0x5a>
+  return 0;
+8010ae63:	31 c0                	xor    %eax,%eax
+}
+8010ae65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010ae68:	c9                   	leave
+8010ae69:	c3                   	ret
+    kfree((char*) v);
+8010ae6a:	83 ec 0c             	sub    $0xc,%esp
+8010ae6d:	53                   	push   %ebx
+8010ae6e:	e8 1d 83 ff ff       	call   80103190 <kfree>
+    return -1;
+8010ae73:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010ae76:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ae7b:	eb e8                	jmp    8010ae65 <mapvdso+0x55>
+8010ae7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010ae80 <deallocuvm>:
+{
+8010ae80:	55                   	push   %ebp
+8010ae81:	89 e5                	mov    %esp,%ebp
+8010ae83:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010ae86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010ae89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if (newsz >= oldsz)
+8010ae8c:	39 d1                	cmp    %edx,%ecx
+8010ae8e:	73 10                	jae    8010aea0 <deallocuvm+0x20>
+}
+8010ae90:	5d                   	pop    %ebp
+8010ae91:	e9 3a f9 ff ff       	jmp    8010a7d0 <deallocuvm.part.0>
+8010ae96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ae9d:	8d 76 00             	lea    0x0(%esi),%esi
+8010aea0:	89 d0                	mov    %edx,%eax
+8010aea2:	5d                   	pop    %ebp
+8010aea3:	c3                   	ret
+8010aea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aeab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aeaf:	90                   	nop
+
+8010aeb0 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010aeb0:	55                   	push   %ebp
+8010aeb1:	89 e5                	mov    %esp,%ebp
+8010aeb3:	57                   	push   %edi
+8010aeb4:	56                   	push   %esi
+8010aeb5:	53                   	push   %ebx
+8010aeb6:	83 ec 0c             	sub    $0xc,%esp
+8010aeb9:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if (pgdir == 0)
+8010aebc:	85 f6                	test   %esi,%esi
+8010aebe:	74 59                	je     8010af19 <freevm+0x69>
+  if (newsz >= oldsz)
+8010aec0:	31 c9                	xor    %ecx,%ecx
+8010aec2:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010aec7:	89 f0                	mov    %esi,%eax
+8010aec9:	89 f3                	mov    %esi,%ebx
+8010aecb:	e8 00 f9 ff ff       	call   8010a7d0 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+
+  deallocuvm(pgdir, KERNBASE, 0); // oldsz = user vm size (KERNBASE)
+  for (i = 0; i < NPDENTRIES; i++) {
+8010aed0:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010aed6:	eb 0f                	jmp    8010aee7 <freevm+0x37>
+8010aed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aedf:	90                   	nop
+8010aee0:	83 c3 04             	add    $0x4,%ebx
+8010aee3:	39 fb                	cmp    %edi,%ebx
+8010aee5:	74 23                	je     8010af0a <freevm+0x5a>
+    // Iterate through page directory entries.
+    // If the page directory entry exists, kfree the page for the page table
+    // Note: the actual pages for the process (page table entries) are cleared
+    // as a result of deallocuvm()
+    if (pgdir[i] & PTE_P) {
+8010aee7:	8b 03                	mov    (%ebx),%eax
+8010aee9:	a8 01                	test   $0x1,%al
+8010aeeb:	74 f3                	je     8010aee0 <freevm+0x30>
+      char *v = P2V(PTE_ADDR(pgdir[i]));
+8010aeed:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010aef2:	83 ec 0c             	sub    $0xc,%esp
+  for (i = 0; i < NPDENTRIES; i++) {
+8010aef5:	83 c3 04             	add    $0x4,%ebx
+      char *v = P2V(PTE_ADDR(pgdir[i]));
+8010aef8:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010aefd:	50                   	push   %eax
+8010aefe:	e8 8d 82 ff ff       	call   80103190 <kfree>
+8010af03:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < NPDENTRIES; i++) {
+8010af06:	39 fb                	cmp    %edi,%ebx
+8010af08:	75 dd                	jne    8010aee7 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010af0a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010af0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af10:	5b                   	pop    %ebx
+8010af11:	5e                   	pop    %esi
+8010af12:	5f                   	pop    %edi
+8010af13:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010af14:	e9 77 82 ff ff       	jmp    80103190 <kfree>
+    panic("freevm: no pgdir");
+8010af19:	83 ec 0c             	sub    $0xc,%esp
+8010af1c:	68 29 bd 10 80       	push   $0x8010bd29
+8010af21:	e8 ba 54 ff ff       	call   801003e0 <panic>
+8010af26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010af30 <setupkvm>:
+{
+8010af30:	55                   	push   %ebp
+8010af31:	89 e5                	mov    %esp,%ebp
+8010af33:	56                   	push   %esi
+8010af34:	53                   	push   %ebx
+  if ((pgdir = (pde_t*) kalloc()) == 0)
+8010af35:	e8 16 84 ff ff       	call   80103350 <kalloc>
+8010af3a:	85 c0                	test   %eax,%eax
+8010af3c:	74 5e                	je     8010af9c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010af3e:	83 ec 04             	sub    $0x4,%esp
+8010af41:	89 c6                	mov    %eax,%esi
+  for (k = kmap; k < &kmap[NELEM(kmap)]; k++) {
+8010af43:	bb 20 e6 10 80       	mov    $0x8010e620,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010af48:	68 00 10 00 00       	push   $0x1000
+8010af4d:	6a 00                	push   $0x0
+8010af4f:	50                   	push   %eax
+8010af50:	e8 5b c3 ff ff       	call   801072b0 <memset>
+8010af55:	83 c4 10             	add    $0x10,%esp
+          (uint) k->phys_start, 
+8010af58:	8b 43 04             	mov    0x4(%ebx),%eax
+    if (mappages(
+8010af5b:	83 ec 08             	sub    $0x8,%esp
+8010af5e:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010af61:	8b 13                	mov    (%ebx),%edx
+8010af63:	ff 73 0c             	push   0xc(%ebx)
+8010af66:	50                   	push   %eax
+8010af67:	29 c1                	sub    %eax,%ecx
+8010af69:	89 f0                	mov    %esi,%eax
+8010af6b:	e8 20 f9 ff ff       	call   8010a890 <mappages>
+8010af70:	83 c4 10             	add    $0x10,%esp
+8010af73:	85 c0                	test   %eax,%eax
+8010af75:	78 19                	js     8010af90 <setupkvm+0x60>
+  for (k = kmap; k < &kmap[NELEM(kmap)]; k++) {
+8010af77:	83 c3 10             	add    $0x10,%ebx
+8010af7a:	81 fb 60 e6 10 80    	cmp    $0x8010e660,%ebx
+8010af80:	75 d6                	jne    8010af58 <setupkvm+0x28>
+}
+8010af82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010af85:	89 f0                	mov    %esi,%eax
+8010af87:	5b                   	pop    %ebx
+8010af88:	5e                   	pop    %esi
+8010af89:	5d                   	pop    %ebp
+8010af8a:	c3                   	ret
+8010af8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af8f:	90                   	nop
+      freevm(pgdir);
+8010af90:	83 ec 0c             	sub    $0xc,%esp
+8010af93:	56                   	push   %esi
+8010af94:	e8 17 ff ff ff       	call   8010aeb0 <freevm>
+      return 0;
+8010af99:	83 c4 10             	add    $0x10,%esp
+}
+8010af9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010af9f:	31 f6                	xor    %esi,%esi
+}
+8010afa1:	89 f0                	mov    %esi,%eax
+8010afa3:	5b                   	pop    %ebx
+8010afa4:	5e                   	pop    %esi
+8010afa5:	5d                   	pop    %ebp
+8010afa6:	c3                   	ret
+8010afa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010afae:	66 90                	xchg   %ax,%ax
+
+8010afb0 <kvmalloc>:
+{
+8010afb0:	55                   	push   %ebp
+8010afb1:	89 e5                	mov    %esp,%ebp
+8010afb3:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010afb6:	e8 75 ff ff ff       	call   8010af30 <setupkvm>
+8010afbb:	a3 44 89 18 80       	mov    %eax,0x80188944
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010afc0:	05 00 00 00 80       	add    $0x80000000,%eax
+8010afc5:	0f 22 d8             	mov    %eax,%cr3
+}
+8010afc8:	c9                   	leave
+8010afc9:	c3                   	ret
+8010afca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010afd0 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010afd0:	55                   	push   %ebp
+8010afd1:	89 e5                	mov    %esp,%ebp
+8010afd3:	83 ec 08             	sub    $0x8,%esp
+8010afd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010afd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010afdc:	89 c1                	mov    %eax,%ecx
+8010afde:	c1 e9 16             	shr    $0x16,%ecx
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010afe1:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010afe4:	f6 c2 01             	test   $0x1,%dl
+8010afe7:	75 17                	jne    8010b000 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0); // get pte for uva
+  if (pte == 0)
+    panic("clearpteu");
+8010afe9:	83 ec 0c             	sub    $0xc,%esp
+8010afec:	68 3a bd 10 80       	push   $0x8010bd3a
+8010aff1:	e8 ea 53 ff ff       	call   801003e0 <panic>
+8010aff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010affd:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b000:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010b003:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b009:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b00e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if (pte == 0)
+8010b015:	85 c0                	test   %eax,%eax
+8010b017:	74 d0                	je     8010afe9 <clearpteu+0x19>
+
+  *pte &= ~PTE_U; // clear flag
+8010b019:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010b01c:	c9                   	leave
+8010b01d:	c3                   	ret
+8010b01e:	66 90                	xchg   %ax,%ax
+
+8010b020 <copyuvm>:
+
+// Given a parent process's page directory, create a copy
+// of this pgedir for a child process.
+pde_t* 
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010b020:	55                   	push   %ebp
+8010b021:	89 e5                	mov    %esp,%ebp
+8010b023:	57                   	push   %edi
+8010b024:	56                   	push   %esi
+8010b025:	53                   	push   %ebx
+8010b026:	83 ec 1c             	sub    $0x1c,%esp
+  uint pa, i, flags;
+  char *mem;
+
+  // Set up kernel part of the new address space.
+  // All processes have the same kernel mappings.
+  if ((d = setupkvm()) == 0) 
+8010b029:	e8 02 ff ff ff       	call   8010af30 <setupkvm>
+8010b02e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b031:	85 c0                	test   %eax,%eax
+8010b033:	0f 84 e9 00 00 00    	je     8010b122 <copyuvm+0x102>
+    return 0;
+
+  // Iterate over parent process's address space, 0 to sz.
+  // proc.c: copyuvm(curproc->pgdir, curproc->sz)
+  for (i = 0; i < sz; i += PGSIZE) {
+8010b039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010b03c:	85 c9                	test   %ecx,%ecx
+8010b03e:	0f 84 b2 00 00 00    	je     8010b0f6 <copyuvm+0xd6>
+8010b044:	31 f6                	xor    %esi,%esi
+8010b046:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b04d:	8d 76 00             	lea    0x0(%esi),%esi
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b050:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010b053:	89 f0                	mov    %esi,%eax
+8010b055:	c1 e8 16             	shr    $0x16,%eax
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b058:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010b05b:	a8 01                	test   $0x1,%al
+8010b05d:	75 11                	jne    8010b070 <copyuvm+0x50>
+    if ((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+8010b05f:	83 ec 0c             	sub    $0xc,%esp
+8010b062:	68 44 bd 10 80       	push   $0x8010bd44
+8010b067:	e8 74 53 ff ff       	call   801003e0 <panic>
+8010b06c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b070:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010b072:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b077:	c1 ea 0a             	shr    $0xa,%edx
+8010b07a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b080:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if ((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+8010b087:	85 c0                	test   %eax,%eax
+8010b089:	74 d4                	je     8010b05f <copyuvm+0x3f>
+
+    if (!(*pte & PTE_P))
+8010b08b:	8b 00                	mov    (%eax),%eax
+8010b08d:	a8 01                	test   $0x1,%al
+8010b08f:	0f 84 9f 00 00 00    	je     8010b134 <copyuvm+0x114>
+      panic("copyuvm: page not present");
+
+    // Get the pa and flags from the parent pte.
+    // Then, get ptr to a kernel page for the child pte
+    pa = PTE_ADDR(*pte);
+8010b095:	89 c7                	mov    %eax,%edi
+    flags = PTE_FLAGS(*pte);
+8010b097:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010b09c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    pa = PTE_ADDR(*pte);
+8010b09f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+    if ((mem = kalloc()) == 0) 
+8010b0a5:	e8 a6 82 ff ff       	call   80103350 <kalloc>
+8010b0aa:	89 c3                	mov    %eax,%ebx
+8010b0ac:	85 c0                	test   %eax,%eax
+8010b0ae:	74 64                	je     8010b114 <copyuvm+0xf4>
+      goto bad;
+
+    // Copy bytes from parent to child page.
+    // Then, stick this newly alloc'd child page into its own page directory 'd'
+    memmove(mem, (char*) P2V(pa), PGSIZE);
+8010b0b0:	83 ec 04             	sub    $0x4,%esp
+8010b0b3:	81 c7 00 00 00 80    	add    $0x80000000,%edi
+8010b0b9:	68 00 10 00 00       	push   $0x1000
+8010b0be:	57                   	push   %edi
+8010b0bf:	50                   	push   %eax
+8010b0c0:	e8 7b c2 ff ff       	call   80107340 <memmove>
+    if (mappages(d, (void *) i, PGSIZE, V2P(mem), flags) < 0) {
+8010b0c5:	58                   	pop    %eax
+8010b0c6:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010b0cc:	5a                   	pop    %edx
+8010b0cd:	ff 75 e4             	push   -0x1c(%ebp)
+8010b0d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b0d5:	89 f2                	mov    %esi,%edx
+8010b0d7:	50                   	push   %eax
+8010b0d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b0db:	e8 b0 f7 ff ff       	call   8010a890 <mappages>
+8010b0e0:	83 c4 10             	add    $0x10,%esp
+8010b0e3:	85 c0                	test   %eax,%eax
+8010b0e5:	78 21                	js     8010b108 <copyuvm+0xe8>
+  for (i = 0; i < sz; i += PGSIZE) {
+8010b0e7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010b0ed:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010b0f0:	0f 82 5a ff ff ff    	jb     8010b050 <copyuvm+0x30>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+8010b0f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b0f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b0fc:	5b                   	pop    %ebx
+8010b0fd:	5e                   	pop    %esi
+8010b0fe:	5f                   	pop    %edi
+8010b0ff:	5d                   	pop    %ebp
+8010b100:	c3                   	ret
+8010b101:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      kfree(mem);
+8010b108:	83 ec 0c             	sub    $0xc,%esp
+8010b10b:	53                   	push   %ebx
+8010b10c:	e8 7f 80 ff ff       	call   80103190 <kfree>
+      goto bad;
+8010b111:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+8010b114:	83 ec 0c             	sub    $0xc,%esp
+8010b117:	ff 75 e0             	push   -0x20(%ebp)
+8010b11a:	e8 91 fd ff ff       	call   8010aeb0 <freevm>
+  return 0;
+8010b11f:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b122:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+8010b129:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b12c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b12f:	5b                   	pop    %ebx
+8010b130:	5e                   	pop    %esi
+8010b131:	5f                   	pop    %edi
+8010b132:	5d                   	pop    %ebp
+8010b133:	c3                   	ret
+      panic("copyuvm: page not present");
+8010b134:	83 ec 0c             	sub    $0xc,%esp
+8010b137:	68 5e bd 10 80       	push   $0x8010bd5e
+8010b13c:	e8 9f 52 ff ff       	call   801003e0 <panic>
+8010b141:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b14f:	90                   	nop
+
+8010b150 <uva2ka>:
+// Map user virtual address to kernel address.
+// This function only gets called by copyout(), which only gets called by exec().
+// exec() gets called by sys_exec(), the shell, and the initial userspace program
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b150:	55                   	push   %ebp
+8010b151:	89 e5                	mov    %esp,%ebp
+8010b153:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b156:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010b159:	89 c1                	mov    %eax,%ecx
+8010b15b:	c1 e9 16             	shr    $0x16,%ecx
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b15e:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b161:	f6 c2 01             	test   $0x1,%dl
+8010b164:	0f 84 00 01 00 00    	je     8010b26a <uva2ka.cold>
+  return &pgtab[PTX(va)];
+8010b16a:	c1 e8 0c             	shr    $0xc,%eax
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010b16d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+    return 0;
+  if ((*pte & PTE_U) == 0)
+    return 0;
+
+  return (char*) P2V(PTE_ADDR(*pte));
+}
+8010b173:	5d                   	pop    %ebp
+  return &pgtab[PTX(va)];
+8010b174:	25 ff 03 00 00       	and    $0x3ff,%eax
+  if ((*pte & PTE_P) == 0)
+8010b179:	8b 84 82 00 00 00 80 	mov    -0x80000000(%edx,%eax,4),%eax
+  if ((*pte & PTE_U) == 0)
+8010b180:	89 c2                	mov    %eax,%edx
+  return (char*) P2V(PTE_ADDR(*pte));
+8010b182:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if ((*pte & PTE_U) == 0)
+8010b187:	83 e2 05             	and    $0x5,%edx
+  return (char*) P2V(PTE_ADDR(*pte));
+8010b18a:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b18f:	83 fa 05             	cmp    $0x5,%edx
+8010b192:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b197:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b19a:	c3                   	ret
+8010b19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b19f:	90                   	nop
+
+8010b1a0 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b1a0:	55                   	push   %ebp
+8010b1a1:	89 e5                	mov    %esp,%ebp
+8010b1a3:	57                   	push   %edi
+8010b1a4:	56                   	push   %esi
+8010b1a5:	53                   	push   %ebx
+8010b1a6:	83 ec 0c             	sub    $0xc,%esp
+8010b1a9:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b1ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b1af:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char *) p;
+  while (len > 0) {
+8010b1b2:	85 f6                	test   %esi,%esi
+8010b1b4:	75 51                	jne    8010b207 <copyout+0x67>
+8010b1b6:	e9 a5 00 00 00       	jmp    8010b260 <copyout+0xc0>
+8010b1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b1bf:	90                   	nop
+  return (char*) P2V(PTE_ADDR(*pte));
+8010b1c0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b1c6:	8d 8b 00 00 00 80    	lea    -0x80000000(%ebx),%ecx
+    va0 = (uint) PGROUNDDOWN(va); // get page aligned va
+    pa0 = uva2ka(pgdir, (char*) va0); // get kernel virtual address for va
+
+    if (pa0 == 0)
+8010b1cc:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010b1d2:	74 75                	je     8010b249 <copyout+0xa9>
+      return -1;
+
+    // length of data is PGSIZE - amount that was pgrounded down
+    // if last page, copy len bytes -- len is the amount of B remaining to copy
+    n = PGSIZE - (va - va0); 
+8010b1d4:	89 fb                	mov    %edi,%ebx
+8010b1d6:	29 c3                	sub    %eax,%ebx
+8010b1d8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b1de:	39 f3                	cmp    %esi,%ebx
+8010b1e0:	0f 47 de             	cmova  %esi,%ebx
+    if (n > len)
+      n = len;
+
+    // copy from buf into target userspace va
+    memmove(pa0 + (va - va0), buf, n);
+8010b1e3:	29 f8                	sub    %edi,%eax
+8010b1e5:	83 ec 04             	sub    $0x4,%esp
+8010b1e8:	01 c1                	add    %eax,%ecx
+8010b1ea:	53                   	push   %ebx
+8010b1eb:	52                   	push   %edx
+8010b1ec:	89 55 10             	mov    %edx,0x10(%ebp)
+8010b1ef:	51                   	push   %ecx
+8010b1f0:	e8 4b c1 ff ff       	call   80107340 <memmove>
+
+    len -= n;
+    buf += n;
+8010b1f5:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+8010b1f8:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while (len > 0) {
+8010b1fe:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b201:	01 da                	add    %ebx,%edx
+  while (len > 0) {
+8010b203:	29 de                	sub    %ebx,%esi
+8010b205:	74 59                	je     8010b260 <copyout+0xc0>
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b207:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010b20a:	89 c1                	mov    %eax,%ecx
+    va0 = (uint) PGROUNDDOWN(va); // get page aligned va
+8010b20c:	89 c7                	mov    %eax,%edi
+  pde = &(pgdir[PDX(va)]); // get the virtual address of the the page directory entry
+8010b20e:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint) PGROUNDDOWN(va); // get page aligned va
+8010b211:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if (*pde & PTE_P) { // check if pde (ptr to page table + flags) has present flag set
+8010b217:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010b21a:	f6 c1 01             	test   $0x1,%cl
+8010b21d:	0f 84 4e 00 00 00    	je     8010b271 <copyout.cold>
+  return &pgtab[PTX(va)];
+8010b223:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*) P2V(PTE_ADDR(*pde));
+8010b225:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b22b:	c1 eb 0c             	shr    $0xc,%ebx
+8010b22e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  if ((*pte & PTE_P) == 0)
+8010b234:	8b 9c 99 00 00 00 80 	mov    -0x80000000(%ecx,%ebx,4),%ebx
+  if ((*pte & PTE_U) == 0)
+8010b23b:	89 d9                	mov    %ebx,%ecx
+8010b23d:	83 e1 05             	and    $0x5,%ecx
+8010b240:	83 f9 05             	cmp    $0x5,%ecx
+8010b243:	0f 84 77 ff ff ff    	je     8010b1c0 <copyout+0x20>
+  }
+  return 0;
+}
+8010b249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b24c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b251:	5b                   	pop    %ebx
+8010b252:	5e                   	pop    %esi
+8010b253:	5f                   	pop    %edi
+8010b254:	5d                   	pop    %ebp
+8010b255:	c3                   	ret
+8010b256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b25d:	8d 76 00             	lea    0x0(%esi),%esi
+8010b260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b263:	31 c0                	xor    %eax,%eax
+}
+8010b265:	5b                   	pop    %ebx
+8010b266:	5e                   	pop    %esi
+8010b267:	5f                   	pop    %edi
+8010b268:	5d                   	pop    %ebp
+8010b269:	c3                   	ret
+
+8010b26a <uva2ka.cold>:
+  if ((*pte & PTE_P) == 0)
+8010b26a:	a1 00 00 00 00       	mov    0x0,%eax
+8010b26f:	0f 0b                	ud2
+
+8010b271 <copyout.cold>:
+8010b271:	a1 00 00 00 00       	mov    0x0,%eax
+8010b276:	0f 0b                	ud2
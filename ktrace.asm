@@ -0,0 +1,1894 @@
+
+_ktrace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  int lost, n, pid;
+
+  if(argc < 2){
+  13:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 2){
+  19:	0f 8e b8 00 00 00    	jle    d7 <main+0xd7>
+    printf(2, "usage: ktrace cmd ...\n");
+    exit();
+  }
+  if((ev = malloc(MAXEV * sizeof(*ev))) == 0){
+  1f:	83 ec 0c             	sub    $0xc,%esp
+  22:	68 00 00 03 00       	push   $0x30000
+  27:	e8 84 0c 00 00       	call   cb0 <malloc>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	a3 08 14 00 00       	mov    %eax,0x1408
+  34:	85 c0                	test   %eax,%eax
+  36:	0f 84 ae 00 00 00    	je     ea <main+0xea>
+    printf(2, "ktrace: out of memory\n");
+    exit();
+  }
+
+  tracectl(1);
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	6a 01                	push   $0x1
+  41:	e8 58 09 00 00       	call   99e <tracectl>
+  if((pid = fork()) < 0){
+  46:	e8 73 07 00 00       	call   7be <fork>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	85 c0                	test   %eax,%eax
+  50:	0f 88 cc 00 00 00    	js     122 <main+0x122>
+    printf(2, "ktrace: fork failed\n");
+    tracectl(0);
+    exit();
+  }
+  if(pid == 0){
+  56:	0f 84 a1 00 00 00    	je     fd <main+0xfd>
+    exec(argv[1], argv + 1);
+    printf(2, "ktrace: exec %s failed\n", argv[1]);
+    exit();
+  }
+  wait();
+  5c:	e8 7b 07 00 00       	call   7dc <wait>
+  lost = tracectl(0);
+  61:	83 ec 0c             	sub    $0xc,%esp
+
+  while(nev < MAXEV && (n = traceread(ev + nev, MAXEV - nev)) > 0)
+  64:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  lost = tracectl(0);
+  69:	6a 00                	push   $0x0
+  6b:	e8 2e 09 00 00       	call   99e <tracectl>
+  while(nev < MAXEV && (n = traceread(ev + nev, MAXEV - nev)) > 0)
+  70:	83 c4 10             	add    $0x10,%esp
+  lost = tracectl(0);
+  73:	89 c6                	mov    %eax,%esi
+  while(nev < MAXEV && (n = traceread(ev + nev, MAXEV - nev)) > 0)
+  75:	a1 04 14 00 00       	mov    0x1404,%eax
+  7a:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+  7f:	7e 19                	jle    9a <main+0x9a>
+  81:	eb 37                	jmp    ba <main+0xba>
+  83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  87:	90                   	nop
+    nev += n;
+  88:	03 05 04 14 00 00    	add    0x1404,%eax
+  8e:	a3 04 14 00 00       	mov    %eax,0x1404
+  while(nev < MAXEV && (n = traceread(ev + nev, MAXEV - nev)) > 0)
+  93:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+  98:	7f 20                	jg     ba <main+0xba>
+  9a:	89 da                	mov    %ebx,%edx
+  9c:	83 ec 08             	sub    $0x8,%esp
+  9f:	29 c2                	sub    %eax,%edx
+  a1:	52                   	push   %edx
+  a2:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  a5:	a1 08 14 00 00       	mov    0x1408,%eax
+  aa:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+  ad:	50                   	push   %eax
+  ae:	e8 fa 08 00 00       	call   9ad <traceread>
+  b3:	83 c4 10             	add    $0x10,%esp
+  b6:	85 c0                	test   %eax,%eax
+  b8:	7f ce                	jg     88 <main+0x88>
+  printf(1, "%d events, %d overwritten\n", nev, lost);
+  ba:	56                   	push   %esi
+  bb:	ff 35 04 14 00 00    	push   0x1404
+  c1:	68 c4 0e 00 00       	push   $0xec4
+  c6:	6a 01                	push   $0x1
+  c8:	e8 a3 09 00 00       	call   a70 <printf>
+  timeline();
+  cd:	e8 3e 02 00 00       	call   310 <timeline>
+  exit();
+  d2:	e8 f6 06 00 00       	call   7cd <exit>
+    printf(2, "usage: ktrace cmd ...\n");
+  d7:	56                   	push   %esi
+  d8:	56                   	push   %esi
+  d9:	68 69 0e 00 00       	push   $0xe69
+  de:	6a 02                	push   $0x2
+  e0:	e8 8b 09 00 00       	call   a70 <printf>
+    exit();
+  e5:	e8 e3 06 00 00       	call   7cd <exit>
+    printf(2, "ktrace: out of memory\n");
+  ea:	53                   	push   %ebx
+  eb:	53                   	push   %ebx
+  ec:	68 80 0e 00 00       	push   $0xe80
+  f1:	6a 02                	push   $0x2
+  f3:	e8 78 09 00 00       	call   a70 <printf>
+    exit();
+  f8:	e8 d0 06 00 00       	call   7cd <exit>
+    exec(argv[1], argv + 1);
+  fd:	50                   	push   %eax
+  fe:	50                   	push   %eax
+  ff:	8d 43 04             	lea    0x4(%ebx),%eax
+ 102:	50                   	push   %eax
+ 103:	ff 73 04             	push   0x4(%ebx)
+ 106:	e8 2b 07 00 00       	call   836 <exec>
+    printf(2, "ktrace: exec %s failed\n", argv[1]);
+ 10b:	83 c4 0c             	add    $0xc,%esp
+ 10e:	ff 73 04             	push   0x4(%ebx)
+ 111:	68 ac 0e 00 00       	push   $0xeac
+ 116:	6a 02                	push   $0x2
+ 118:	e8 53 09 00 00       	call   a70 <printf>
+    exit();
+ 11d:	e8 ab 06 00 00       	call   7cd <exit>
+    printf(2, "ktrace: fork failed\n");
+ 122:	52                   	push   %edx
+ 123:	52                   	push   %edx
+ 124:	68 97 0e 00 00       	push   $0xe97
+ 129:	6a 02                	push   $0x2
+ 12b:	e8 40 09 00 00       	call   a70 <printf>
+    tracectl(0);
+ 130:	31 c9                	xor    %ecx,%ecx
+ 132:	89 0c 24             	mov    %ecx,(%esp)
+ 135:	e8 64 08 00 00       	call   99e <tracectl>
+    exit();
+ 13a:	e8 8e 06 00 00       	call   7cd <exit>
+ 13f:	90                   	nop
+
+00000140 <show>:
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	83 ec 10             	sub    $0x10,%esp
+ 147:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf(1, "%d cpu%d pid %d ", (uint)((e->tsc - t0) >> 10), e->cpu, e->pid);
+ 14a:	ff 73 0c             	push   0xc(%ebx)
+ 14d:	0f b7 43 0a          	movzwl 0xa(%ebx),%eax
+ 151:	50                   	push   %eax
+ 152:	8b 03                	mov    (%ebx),%eax
+ 154:	8b 53 04             	mov    0x4(%ebx),%edx
+ 157:	2b 45 0c             	sub    0xc(%ebp),%eax
+ 15a:	1b 55 10             	sbb    0x10(%ebp),%edx
+ 15d:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+ 161:	50                   	push   %eax
+ 162:	68 a7 0d 00 00       	push   $0xda7
+ 167:	6a 01                	push   $0x1
+ 169:	e8 02 09 00 00       	call   a70 <printf>
+  switch(e->type){
+ 16e:	0f b7 43 08          	movzwl 0x8(%ebx),%eax
+ 172:	83 c4 20             	add    $0x20,%esp
+ 175:	66 83 f8 0a          	cmp    $0xa,%ax
+ 179:	0f 87 6e 01 00 00    	ja     2ed <show+0x1ad>
+ 17f:	ff 24 85 08 0f 00 00 	jmp    *0xf08(,%eax,4)
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "commit done\n");
+ 190:	c7 45 0c 4c 0e 00 00 	movl   $0xe4c,0xc(%ebp)
+}
+ 197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "commit done\n");
+ 19a:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 1a1:	c9                   	leave
+    printf(1, "commit done\n");
+ 1a2:	e9 c9 08 00 00       	jmp    a70 <printf>
+ 1a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ae:	66 90                	xchg   %ax,%ax
+    printf(1, "syscall %d\n", e->a0);
+ 1b0:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 1b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "syscall %d\n", e->a0);
+ 1b6:	c7 45 0c b8 0d 00 00 	movl   $0xdb8,0xc(%ebp)
+ 1bd:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 1c4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 1c7:	c9                   	leave
+    printf(1, "syscall %d\n", e->a0);
+ 1c8:	e9 a3 08 00 00       	jmp    a70 <printf>
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "syscall %d returns %d\n", e->a0, e->a1);
+ 1d0:	ff 73 14             	push   0x14(%ebx)
+ 1d3:	ff 73 10             	push   0x10(%ebx)
+ 1d6:	68 c4 0d 00 00       	push   $0xdc4
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 8e 08 00 00       	call   a70 <printf>
+    break;
+ 1e2:	83 c4 10             	add    $0x10,%esp
+}
+ 1e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+ 1ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "run\n");
+ 1f0:	c7 45 0c db 0d 00 00 	movl   $0xddb,0xc(%ebp)
+}
+ 1f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "run\n");
+ 1fa:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 201:	c9                   	leave
+    printf(1, "run\n");
+ 202:	e9 69 08 00 00       	jmp    a70 <printf>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+           e->a0 < sizeof(states)/sizeof(states[0]) ? states[e->a0] : "???");
+ 210:	8b 53 10             	mov    0x10(%ebx),%edx
+    printf(1, "sched, now %s\n",
+ 213:	b8 98 0d 00 00       	mov    $0xd98,%eax
+ 218:	83 fa 05             	cmp    $0x5,%edx
+ 21b:	77 07                	ja     224 <show+0xe4>
+ 21d:	8b 04 95 78 13 00 00 	mov    0x1378(,%edx,4),%eax
+ 224:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 227:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "sched, now %s\n",
+ 22a:	c7 45 0c e0 0d 00 00 	movl   $0xde0,0xc(%ebp)
+ 231:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 238:	c9                   	leave
+    printf(1, "sched, now %s\n",
+ 239:	e9 32 08 00 00       	jmp    a70 <printf>
+ 23e:	66 90                	xchg   %ax,%ax
+    printf(1, "sleep on %x\n", e->a0);
+ 240:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 243:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "sleep on %x\n", e->a0);
+ 246:	c7 45 0c ef 0d 00 00 	movl   $0xdef,0xc(%ebp)
+ 24d:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 254:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 257:	c9                   	leave
+    printf(1, "sleep on %x\n", e->a0);
+ 258:	e9 13 08 00 00       	jmp    a70 <printf>
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "wakeup %x wakes pid %d\n", e->a0, e->a1);
+ 260:	ff 73 14             	push   0x14(%ebx)
+ 263:	ff 73 10             	push   0x10(%ebx)
+ 266:	68 fc 0d 00 00       	push   $0xdfc
+ 26b:	6a 01                	push   $0x1
+ 26d:	e8 fe 07 00 00       	call   a70 <printf>
+    break;
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	e9 6b ff ff ff       	jmp    1e5 <show+0xa5>
+ 27a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "disk %s block %d\n", e->a1 ? "write" : "read", e->a0);
+ 280:	8b 43 14             	mov    0x14(%ebx),%eax
+ 283:	ba 9c 0d 00 00       	mov    $0xd9c,%edx
+ 288:	ff 73 10             	push   0x10(%ebx)
+ 28b:	85 c0                	test   %eax,%eax
+ 28d:	b8 a2 0d 00 00       	mov    $0xda2,%eax
+ 292:	0f 45 c2             	cmovne %edx,%eax
+ 295:	50                   	push   %eax
+ 296:	68 14 0e 00 00       	push   $0xe14
+ 29b:	6a 01                	push   $0x1
+ 29d:	e8 ce 07 00 00       	call   a70 <printf>
+    break;
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	e9 3b ff ff ff       	jmp    1e5 <show+0xa5>
+ 2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, "disk done block %d\n", e->a0);
+ 2b0:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 2b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "disk done block %d\n", e->a0);
+ 2b6:	c7 45 0c 26 0e 00 00 	movl   $0xe26,0xc(%ebp)
+ 2bd:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 2c4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 2c7:	c9                   	leave
+    printf(1, "disk done block %d\n", e->a0);
+ 2c8:	e9 a3 07 00 00       	jmp    a70 <printf>
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "commit %d blocks\n", e->a0);
+ 2d0:	8b 43 10             	mov    0x10(%ebx),%eax
+}
+ 2d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    printf(1, "commit %d blocks\n", e->a0);
+ 2d6:	c7 45 0c 3a 0e 00 00 	movl   $0xe3a,0xc(%ebp)
+ 2dd:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+ 2e4:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+ 2e7:	c9                   	leave
+    printf(1, "commit %d blocks\n", e->a0);
+ 2e8:	e9 83 07 00 00       	jmp    a70 <printf>
+    printf(1, "event %d %x %x\n", e->type, e->a0, e->a1);
+ 2ed:	83 ec 0c             	sub    $0xc,%esp
+ 2f0:	ff 73 14             	push   0x14(%ebx)
+ 2f3:	ff 73 10             	push   0x10(%ebx)
+ 2f6:	50                   	push   %eax
+ 2f7:	68 59 0e 00 00       	push   $0xe59
+ 2fc:	6a 01                	push   $0x1
+ 2fe:	e8 6d 07 00 00       	call   a70 <printf>
+ 303:	83 c4 20             	add    $0x20,%esp
+}
+ 306:	e9 da fe ff ff       	jmp    1e5 <show+0xa5>
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <timeline>:
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+ 315:	53                   	push   %ebx
+ 316:	83 ec 1c             	sub    $0x1c,%esp
+  for(i = 0; i < nev; i++)
+ 319:	8b 35 04 14 00 00    	mov    0x1404,%esi
+  nseg = 0;
+ 31f:	c7 05 a0 13 00 00 00 	movl   $0x0,0x13a0
+ 326:	00 00 00 
+  for(i = 0; i < nev; i++)
+ 329:	85 f6                	test   %esi,%esi
+ 32b:	0f 8e 45 01 00 00    	jle    476 <timeline+0x166>
+ 331:	31 db                	xor    %ebx,%ebx
+ 333:	31 d2                	xor    %edx,%edx
+ 335:	a1 08 14 00 00       	mov    0x1408,%eax
+      seg[nseg++] = i;
+ 33a:	89 14 9d e0 13 00 00 	mov    %edx,0x13e0(,%ebx,4)
+ 341:	8d 4b 01             	lea    0x1(%ebx),%ecx
+ 344:	83 c0 0a             	add    $0xa,%eax
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < nev; i++)
+ 350:	83 c2 01             	add    $0x1,%edx
+ 353:	83 c0 18             	add    $0x18,%eax
+ 356:	39 f2                	cmp    %esi,%edx
+ 358:	74 26                	je     380 <timeline+0x70>
+    if(i == 0 || (ev[i].cpu != ev[i-1].cpu && nseg < NCPU))
+ 35a:	0f b7 78 e8          	movzwl -0x18(%eax),%edi
+ 35e:	66 39 38             	cmp    %di,(%eax)
+ 361:	74 ed                	je     350 <timeline+0x40>
+ 363:	83 f9 08             	cmp    $0x8,%ecx
+ 366:	74 e8                	je     350 <timeline+0x40>
+ 368:	89 cb                	mov    %ecx,%ebx
+  for(i = 0; i < nev; i++)
+ 36a:	83 c0 18             	add    $0x18,%eax
+      seg[nseg++] = i;
+ 36d:	89 14 9d e0 13 00 00 	mov    %edx,0x13e0(,%ebx,4)
+  for(i = 0; i < nev; i++)
+ 374:	83 c2 01             	add    $0x1,%edx
+      seg[nseg++] = i;
+ 377:	8d 4b 01             	lea    0x1(%ebx),%ecx
+  for(i = 0; i < nev; i++)
+ 37a:	39 f2                	cmp    %esi,%edx
+ 37c:	75 dc                	jne    35a <timeline+0x4a>
+ 37e:	66 90                	xchg   %ax,%ax
+ 380:	89 0d a0 13 00 00    	mov    %ecx,0x13a0
+  for(i = 0; i < nseg; i++)
+ 386:	31 ff                	xor    %edi,%edi
+  seg[nseg] = nev;
+ 388:	89 14 8d e0 13 00 00 	mov    %edx,0x13e0(,%ecx,4)
+  for(i = 0; i < nseg; i++)
+ 38f:	90                   	nop
+    next[i] = seg[i];
+ 390:	8b 04 bd e0 13 00 00 	mov    0x13e0(,%edi,4),%eax
+ 397:	89 04 bd c0 13 00 00 	mov    %eax,0x13c0(,%edi,4)
+  for(i = 0; i < nseg; i++)
+ 39e:	83 c7 01             	add    $0x1,%edi
+ 3a1:	39 f9                	cmp    %edi,%ecx
+ 3a3:	75 eb                	jne    390 <timeline+0x80>
+  e = 0;
+ 3a5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    for(i = 0; i < nseg; i++){
+ 3a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  e = 0;
+ 3ab:	31 db                	xor    %ebx,%ebx
+    for(i = 0; i < nseg; i++){
+ 3ad:	85 c0                	test   %eax,%eax
+ 3af:	0f 8e b9 00 00 00    	jle    46e <timeline+0x15e>
+ 3b5:	8d 76 00             	lea    0x0(%esi),%esi
+      if(best < 0 || ev[next[i]].tsc < ev[next[best]].tsc)
+ 3b8:	a1 08 14 00 00       	mov    0x1408,%eax
+    for(i = 0; i < nseg; i++){
+ 3bd:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    best = -1;
+ 3c0:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+      if(best < 0 || ev[next[i]].tsc < ev[next[best]].tsc)
+ 3c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for(i = 0; i < nseg; i++){
+ 3c8:	31 c0                	xor    %eax,%eax
+ 3ca:	eb 34                	jmp    400 <timeline+0xf0>
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(best < 0 || ev[next[i]].tsc < ev[next[best]].tsc)
+ 3d0:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 3d3:	8d 1c 5b             	lea    (%ebx,%ebx,2),%ebx
+ 3d6:	8d 3c de             	lea    (%esi,%ebx,8),%edi
+ 3d9:	8b 1c 95 c0 13 00 00 	mov    0x13c0(,%edx,4),%ebx
+ 3e0:	8d 1c 5b             	lea    (%ebx,%ebx,2),%ebx
+ 3e3:	8d 1c de             	lea    (%esi,%ebx,8),%ebx
+ 3e6:	8b 77 04             	mov    0x4(%edi),%esi
+ 3e9:	89 75 e0             	mov    %esi,-0x20(%ebp)
+ 3ec:	8b 33                	mov    (%ebx),%esi
+ 3ee:	39 37                	cmp    %esi,(%edi)
+ 3f0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+ 3f3:	1b 73 04             	sbb    0x4(%ebx),%esi
+ 3f6:	0f 42 d1             	cmovb  %ecx,%edx
+    for(i = 0; i < nseg; i++){
+ 3f9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 3fc:	39 f0                	cmp    %esi,%eax
+ 3fe:	74 22                	je     422 <timeline+0x112>
+      if(next[i] == seg[i+1])
+ 400:	8b 1c 85 c0 13 00 00 	mov    0x13c0(,%eax,4),%ebx
+ 407:	89 c1                	mov    %eax,%ecx
+ 409:	83 c0 01             	add    $0x1,%eax
+ 40c:	3b 1c 85 e0 13 00 00 	cmp    0x13e0(,%eax,4),%ebx
+ 413:	74 e4                	je     3f9 <timeline+0xe9>
+      if(best < 0 || ev[next[i]].tsc < ev[next[best]].tsc)
+ 415:	85 d2                	test   %edx,%edx
+ 417:	79 b7                	jns    3d0 <timeline+0xc0>
+    for(i = 0; i < nseg; i++){
+ 419:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 41c:	89 ca                	mov    %ecx,%edx
+ 41e:	39 f0                	cmp    %esi,%eax
+ 420:	75 de                	jne    400 <timeline+0xf0>
+    if(best < 0)
+ 422:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+ 425:	85 d2                	test   %edx,%edx
+ 427:	78 45                	js     46e <timeline+0x15e>
+      e = &ev[next[best]];
+ 429:	8b 04 95 c0 13 00 00 	mov    0x13c0(,%edx,4),%eax
+ 430:	8b 7d dc             	mov    -0x24(%ebp),%edi
+ 433:	85 db                	test   %ebx,%ebx
+ 435:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+ 438:	8d 0c cf             	lea    (%edi,%ecx,8),%ecx
+ 43b:	0f 44 d9             	cmove  %ecx,%ebx
+    show(&ev[next[best]++], e->tsc);
+ 43e:	83 ec 04             	sub    $0x4,%esp
+ 441:	83 c0 01             	add    $0x1,%eax
+ 444:	8b 33                	mov    (%ebx),%esi
+ 446:	8b 7b 04             	mov    0x4(%ebx),%edi
+ 449:	89 04 95 c0 13 00 00 	mov    %eax,0x13c0(,%edx,4)
+ 450:	57                   	push   %edi
+ 451:	56                   	push   %esi
+ 452:	51                   	push   %ecx
+ 453:	e8 e8 fc ff ff       	call   140 <show>
+    for(i = 0; i < nseg; i++){
+ 458:	a1 a0 13 00 00       	mov    0x13a0,%eax
+    best = -1;
+ 45d:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < nseg; i++){
+ 460:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 463:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 466:	85 c0                	test   %eax,%eax
+ 468:	0f 8f 4a ff ff ff    	jg     3b8 <timeline+0xa8>
+}
+ 46e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 471:	5b                   	pop    %ebx
+ 472:	5e                   	pop    %esi
+ 473:	5f                   	pop    %edi
+ 474:	5d                   	pop    %ebp
+ 475:	c3                   	ret
+  seg[nseg] = nev;
+ 476:	89 35 e0 13 00 00    	mov    %esi,0x13e0
+}
+ 47c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47f:	5b                   	pop    %ebx
+ 480:	5e                   	pop    %esi
+ 481:	5f                   	pop    %edi
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	66 90                	xchg   %ax,%ax
+ 486:	66 90                	xchg   %ax,%ax
+ 488:	66 90                	xchg   %ax,%ax
+ 48a:	66 90                	xchg   %ax,%ax
+ 48c:	66 90                	xchg   %ax,%ax
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 490:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 491:	31 c0                	xor    %eax,%eax
+{
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	53                   	push   %ebx
+ 496:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 4a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 4a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 4a7:	83 c0 01             	add    $0x1,%eax
+ 4aa:	84 d2                	test   %dl,%dl
+ 4ac:	75 f2                	jne    4a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 4ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4b1:	89 c8                	mov    %ecx,%eax
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+ 4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ca:	0f b6 02             	movzbl (%edx),%eax
+ 4cd:	84 c0                	test   %al,%al
+ 4cf:	75 17                	jne    4e8 <strcmp+0x28>
+ 4d1:	eb 3a                	jmp    50d <strcmp+0x4d>
+ 4d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4d7:	90                   	nop
+ 4d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4dc:	83 c2 01             	add    $0x1,%edx
+ 4df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4e2:	84 c0                	test   %al,%al
+ 4e4:	74 1a                	je     500 <strcmp+0x40>
+    p++, q++;
+ 4e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4eb:	38 c3                	cmp    %al,%bl
+ 4ed:	74 e9                	je     4d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4ef:	29 d8                	sub    %ebx,%eax
+}
+ 4f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4f4:	c9                   	leave
+ 4f5:	c3                   	ret
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 500:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 504:	31 c0                	xor    %eax,%eax
+ 506:	29 d8                	sub    %ebx,%eax
+}
+ 508:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 50b:	c9                   	leave
+ 50c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 50d:	0f b6 19             	movzbl (%ecx),%ebx
+ 510:	31 c0                	xor    %eax,%eax
+ 512:	eb db                	jmp    4ef <strcmp+0x2f>
+ 514:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+
+00000520 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 526:	80 3a 00             	cmpb   $0x0,(%edx)
+ 529:	74 15                	je     540 <strlen+0x20>
+ 52b:	31 c0                	xor    %eax,%eax
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+ 530:	83 c0 01             	add    $0x1,%eax
+ 533:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 537:	89 c1                	mov    %eax,%ecx
+ 539:	75 f5                	jne    530 <strlen+0x10>
+    ;
+  return n;
+}
+ 53b:	89 c8                	mov    %ecx,%eax
+ 53d:	5d                   	pop    %ebp
+ 53e:	c3                   	ret
+ 53f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 540:	31 c9                	xor    %ecx,%ecx
+}
+ 542:	5d                   	pop    %ebp
+ 543:	89 c8                	mov    %ecx,%eax
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 557:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 55a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55d:	89 d7                	mov    %edx,%edi
+ 55f:	fc                   	cld
+ 560:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 562:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	c9                   	leave
+ 568:	c3                   	ret
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 57a:	0f b6 10             	movzbl (%eax),%edx
+ 57d:	84 d2                	test   %dl,%dl
+ 57f:	75 12                	jne    593 <strchr+0x23>
+ 581:	eb 1d                	jmp    5a0 <strchr+0x30>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 58c:	83 c0 01             	add    $0x1,%eax
+ 58f:	84 d2                	test   %dl,%dl
+ 591:	74 0d                	je     5a0 <strchr+0x30>
+    if(*s == c)
+ 593:	38 d1                	cmp    %dl,%cl
+ 595:	75 f1                	jne    588 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 597:	5d                   	pop    %ebp
+ 598:	c3                   	ret
+ 599:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 5a0:	31 c0                	xor    %eax,%eax
+}
+ 5a2:	5d                   	pop    %ebp
+ 5a3:	c3                   	ret
+ 5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5b9:	31 db                	xor    %ebx,%ebx
+{
+ 5bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5be:	eb 27                	jmp    5e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	6a 01                	push   $0x1
+ 5c5:	56                   	push   %esi
+ 5c6:	6a 00                	push   $0x0
+ 5c8:	e8 2d 02 00 00       	call   7fa <read>
+    if(cc < 1)
+ 5cd:	83 c4 10             	add    $0x10,%esp
+ 5d0:	85 c0                	test   %eax,%eax
+ 5d2:	7e 1d                	jle    5f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5df:	3c 0a                	cmp    $0xa,%al
+ 5e1:	74 10                	je     5f3 <gets+0x43>
+ 5e3:	3c 0d                	cmp    $0xd,%al
+ 5e5:	74 0c                	je     5f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5e7:	89 df                	mov    %ebx,%edi
+ 5e9:	83 c3 01             	add    $0x1,%ebx
+ 5ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5ef:	7c cf                	jl     5c0 <gets+0x10>
+ 5f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fd:	5b                   	pop    %ebx
+ 5fe:	5e                   	pop    %esi
+ 5ff:	5f                   	pop    %edi
+ 600:	5d                   	pop    %ebp
+ 601:	c3                   	ret
+ 602:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 609:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	56                   	push   %esi
+ 614:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 615:	83 ec 08             	sub    $0x8,%esp
+ 618:	6a 00                	push   $0x0
+ 61a:	ff 75 08             	push   0x8(%ebp)
+ 61d:	e8 23 02 00 00       	call   845 <open>
+  if(fd < 0)
+ 622:	83 c4 10             	add    $0x10,%esp
+ 625:	85 c0                	test   %eax,%eax
+ 627:	78 27                	js     650 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 629:	83 ec 08             	sub    $0x8,%esp
+ 62c:	ff 75 0c             	push   0xc(%ebp)
+ 62f:	89 c3                	mov    %eax,%ebx
+ 631:	50                   	push   %eax
+ 632:	e8 3b 02 00 00       	call   872 <fstat>
+  close(fd);
+ 637:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 63a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 63c:	e8 d7 01 00 00       	call   818 <close>
+  return r;
+ 641:	83 c4 10             	add    $0x10,%esp
+}
+ 644:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 647:	89 f0                	mov    %esi,%eax
+ 649:	5b                   	pop    %ebx
+ 64a:	5e                   	pop    %esi
+ 64b:	5d                   	pop    %ebp
+ 64c:	c3                   	ret
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 650:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 655:	eb ed                	jmp    644 <stat+0x34>
+ 657:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65e:	66 90                	xchg   %ax,%ax
+
+00000660 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	53                   	push   %ebx
+ 664:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 667:	0f be 02             	movsbl (%edx),%eax
+ 66a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 66d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 670:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 675:	77 1e                	ja     695 <atoi+0x35>
+ 677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 680:	83 c2 01             	add    $0x1,%edx
+ 683:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 686:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 68a:	0f be 02             	movsbl (%edx),%eax
+ 68d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 690:	80 fb 09             	cmp    $0x9,%bl
+ 693:	76 eb                	jbe    680 <atoi+0x20>
+  return n;
+}
+ 695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 698:	89 c8                	mov    %ecx,%eax
+ 69a:	c9                   	leave
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 6ae:	85 c0                	test   %eax,%eax
+ 6b0:	7e 13                	jle    6c5 <memmove+0x25>
+ 6b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6b4:	89 d7                	mov    %edx,%edi
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6c1:	39 f8                	cmp    %edi,%eax
+ 6c3:	75 fb                	jne    6c0 <memmove+0x20>
+  return vdst;
+}
+ 6c5:	5e                   	pop    %esi
+ 6c6:	89 d0                	mov    %edx,%eax
+ 6c8:	5f                   	pop    %edi
+ 6c9:	5d                   	pop    %ebp
+ 6ca:	c3                   	ret
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+
+000006d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	56                   	push   %esi
+ 6d4:	53                   	push   %ebx
+ 6d5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 6d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 6de:	85 f6                	test   %esi,%esi
+ 6e0:	74 2e                	je     710 <memcmp+0x40>
+ 6e2:	01 c6                	add    %eax,%esi
+ 6e4:	eb 14                	jmp    6fa <memcmp+0x2a>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 6f0:	83 c0 01             	add    $0x1,%eax
+ 6f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 6f6:	39 f0                	cmp    %esi,%eax
+ 6f8:	74 16                	je     710 <memcmp+0x40>
+    if(*s1 != *s2)
+ 6fa:	0f b6 0a             	movzbl (%edx),%ecx
+ 6fd:	0f b6 18             	movzbl (%eax),%ebx
+ 700:	38 d9                	cmp    %bl,%cl
+ 702:	74 ec                	je     6f0 <memcmp+0x20>
+      return *s1 - *s2;
+ 704:	0f b6 c1             	movzbl %cl,%eax
+ 707:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 709:	5b                   	pop    %ebx
+ 70a:	5e                   	pop    %esi
+ 70b:	5d                   	pop    %ebp
+ 70c:	c3                   	ret
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+ 710:	5b                   	pop    %ebx
+  return 0;
+ 711:	31 c0                	xor    %eax,%eax
+}
+ 713:	5e                   	pop    %esi
+ 714:	5d                   	pop    %ebp
+ 715:	c3                   	ret
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000720 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 720:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 725:	c3                   	ret
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 730:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 732:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 738:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 73e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 744:	c3                   	ret
+ 745:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 750:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 752:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 758:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 75e:	c3                   	ret
+ 75f:	90                   	nop
+
+00000760 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 768:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 76d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 773:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 779:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 77f:	89 c6                	mov    %eax,%esi
+ 781:	f7 f7                	div    %edi
+ 783:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 785:	f7 e3                	mul    %ebx
+ 787:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 78a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 78d:	89 d3                	mov    %edx,%ebx
+ 78f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 792:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 794:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 796:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 79c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 7a1:	f7 e6                	mul    %esi
+ 7a3:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 7a9:	29 d9                	sub    %ebx,%ecx
+ 7ab:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 7b1:	01 c1                	add    %eax,%ecx
+ 7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b6:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 7b9:	5b                   	pop    %ebx
+ 7ba:	5e                   	pop    %esi
+ 7bb:	5f                   	pop    %edi
+ 7bc:	5d                   	pop    %ebp
+ 7bd:	c3                   	ret
+
+000007be <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 7be:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7c3:	89 e1                	mov    %esp,%ecx
+ 7c5:	ba cc 07 00 00       	mov    $0x7cc,%edx
+ 7ca:	0f 34                	sysenter
+ 7cc:	c3                   	ret
+
+000007cd <exit>:
+SYSCALL(exit)
+ 7cd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7d2:	89 e1                	mov    %esp,%ecx
+ 7d4:	ba db 07 00 00       	mov    $0x7db,%edx
+ 7d9:	0f 34                	sysenter
+ 7db:	c3                   	ret
+
+000007dc <wait>:
+SYSCALL(wait)
+ 7dc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7e1:	89 e1                	mov    %esp,%ecx
+ 7e3:	ba ea 07 00 00       	mov    $0x7ea,%edx
+ 7e8:	0f 34                	sysenter
+ 7ea:	c3                   	ret
+
+000007eb <pipe>:
+SYSCALL(pipe)
+ 7eb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f0:	89 e1                	mov    %esp,%ecx
+ 7f2:	ba f9 07 00 00       	mov    $0x7f9,%edx
+ 7f7:	0f 34                	sysenter
+ 7f9:	c3                   	ret
+
+000007fa <read>:
+SYSCALL(read)
+ 7fa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7ff:	89 e1                	mov    %esp,%ecx
+ 801:	ba 08 08 00 00       	mov    $0x808,%edx
+ 806:	0f 34                	sysenter
+ 808:	c3                   	ret
+
+00000809 <write>:
+SYSCALL(write)
+ 809:	b8 10 00 00 00       	mov    $0x10,%eax
+ 80e:	89 e1                	mov    %esp,%ecx
+ 810:	ba 17 08 00 00       	mov    $0x817,%edx
+ 815:	0f 34                	sysenter
+ 817:	c3                   	ret
+
+00000818 <close>:
+SYSCALL(close)
+ 818:	b8 15 00 00 00       	mov    $0x15,%eax
+ 81d:	89 e1                	mov    %esp,%ecx
+ 81f:	ba 26 08 00 00       	mov    $0x826,%edx
+ 824:	0f 34                	sysenter
+ 826:	c3                   	ret
+
+00000827 <kill>:
+SYSCALL(kill)
+ 827:	b8 06 00 00 00       	mov    $0x6,%eax
+ 82c:	89 e1                	mov    %esp,%ecx
+ 82e:	ba 35 08 00 00       	mov    $0x835,%edx
+ 833:	0f 34                	sysenter
+ 835:	c3                   	ret
+
+00000836 <exec>:
+SYSCALL(exec)
+ 836:	b8 07 00 00 00       	mov    $0x7,%eax
+ 83b:	89 e1                	mov    %esp,%ecx
+ 83d:	ba 44 08 00 00       	mov    $0x844,%edx
+ 842:	0f 34                	sysenter
+ 844:	c3                   	ret
+
+00000845 <open>:
+SYSCALL(open)
+ 845:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 84a:	89 e1                	mov    %esp,%ecx
+ 84c:	ba 53 08 00 00       	mov    $0x853,%edx
+ 851:	0f 34                	sysenter
+ 853:	c3                   	ret
+
+00000854 <mknod>:
+SYSCALL(mknod)
+ 854:	b8 11 00 00 00       	mov    $0x11,%eax
+ 859:	89 e1                	mov    %esp,%ecx
+ 85b:	ba 62 08 00 00       	mov    $0x862,%edx
+ 860:	0f 34                	sysenter
+ 862:	c3                   	ret
+
+00000863 <unlink>:
+SYSCALL(unlink)
+ 863:	b8 12 00 00 00       	mov    $0x12,%eax
+ 868:	89 e1                	mov    %esp,%ecx
+ 86a:	ba 71 08 00 00       	mov    $0x871,%edx
+ 86f:	0f 34                	sysenter
+ 871:	c3                   	ret
+
+00000872 <fstat>:
+SYSCALL(fstat)
+ 872:	b8 08 00 00 00       	mov    $0x8,%eax
+ 877:	89 e1                	mov    %esp,%ecx
+ 879:	ba 80 08 00 00       	mov    $0x880,%edx
+ 87e:	0f 34                	sysenter
+ 880:	c3                   	ret
+
+00000881 <link>:
+SYSCALL(link)
+ 881:	b8 13 00 00 00       	mov    $0x13,%eax
+ 886:	89 e1                	mov    %esp,%ecx
+ 888:	ba 8f 08 00 00       	mov    $0x88f,%edx
+ 88d:	0f 34                	sysenter
+ 88f:	c3                   	ret
+
+00000890 <mkdir>:
+SYSCALL(mkdir)
+ 890:	b8 14 00 00 00       	mov    $0x14,%eax
+ 895:	89 e1                	mov    %esp,%ecx
+ 897:	ba 9e 08 00 00       	mov    $0x89e,%edx
+ 89c:	0f 34                	sysenter
+ 89e:	c3                   	ret
+
+0000089f <chdir>:
+SYSCALL(chdir)
+ 89f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8a4:	89 e1                	mov    %esp,%ecx
+ 8a6:	ba ad 08 00 00       	mov    $0x8ad,%edx
+ 8ab:	0f 34                	sysenter
+ 8ad:	c3                   	ret
+
+000008ae <dup>:
+SYSCALL(dup)
+ 8ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8b3:	89 e1                	mov    %esp,%ecx
+ 8b5:	ba bc 08 00 00       	mov    $0x8bc,%edx
+ 8ba:	0f 34                	sysenter
+ 8bc:	c3                   	ret
+
+000008bd <sbrk>:
+SYSCALL(sbrk)
+ 8bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8c2:	89 e1                	mov    %esp,%ecx
+ 8c4:	ba cb 08 00 00       	mov    $0x8cb,%edx
+ 8c9:	0f 34                	sysenter
+ 8cb:	c3                   	ret
+
+000008cc <sleep>:
+SYSCALL(sleep)
+ 8cc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8d1:	89 e1                	mov    %esp,%ecx
+ 8d3:	ba da 08 00 00       	mov    $0x8da,%edx
+ 8d8:	0f 34                	sysenter
+ 8da:	c3                   	ret
+
+000008db <fallocate>:
+SYSCALL(fallocate)
+ 8db:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8e0:	89 e1                	mov    %esp,%ecx
+ 8e2:	ba e9 08 00 00       	mov    $0x8e9,%edx
+ 8e7:	0f 34                	sysenter
+ 8e9:	c3                   	ret
+
+000008ea <pread>:
+SYSCALL(pread)
+ 8ea:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8ef:	89 e1                	mov    %esp,%ecx
+ 8f1:	ba f8 08 00 00       	mov    $0x8f8,%edx
+ 8f6:	0f 34                	sysenter
+ 8f8:	c3                   	ret
+
+000008f9 <pwrite>:
+SYSCALL(pwrite)
+ 8f9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8fe:	89 e1                	mov    %esp,%ecx
+ 900:	ba 07 09 00 00       	mov    $0x907,%edx
+ 905:	0f 34                	sysenter
+ 907:	c3                   	ret
+
+00000908 <readv>:
+SYSCALL(readv)
+ 908:	b8 19 00 00 00       	mov    $0x19,%eax
+ 90d:	89 e1                	mov    %esp,%ecx
+ 90f:	ba 16 09 00 00       	mov    $0x916,%edx
+ 914:	0f 34                	sysenter
+ 916:	c3                   	ret
+
+00000917 <writev>:
+SYSCALL(writev)
+ 917:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 91c:	89 e1                	mov    %esp,%ecx
+ 91e:	ba 25 09 00 00       	mov    $0x925,%edx
+ 923:	0f 34                	sysenter
+ 925:	c3                   	ret
+
+00000926 <splice>:
+SYSCALL(splice)
+ 926:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 92b:	89 e1                	mov    %esp,%ecx
+ 92d:	ba 34 09 00 00       	mov    $0x934,%edx
+ 932:	0f 34                	sysenter
+ 934:	c3                   	ret
+
+00000935 <setpriority>:
+SYSCALL(setpriority)
+ 935:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 93a:	89 e1                	mov    %esp,%ecx
+ 93c:	ba 43 09 00 00       	mov    $0x943,%edx
+ 941:	0f 34                	sysenter
+ 943:	c3                   	ret
+
+00000944 <setaffinity>:
+SYSCALL(setaffinity)
+ 944:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 949:	89 e1                	mov    %esp,%ecx
+ 94b:	ba 52 09 00 00       	mov    $0x952,%edx
+ 950:	0f 34                	sysenter
+ 952:	c3                   	ret
+
+00000953 <lockstress>:
+SYSCALL(lockstress)
+ 953:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 958:	89 e1                	mov    %esp,%ecx
+ 95a:	ba 61 09 00 00       	mov    $0x961,%edx
+ 95f:	0f 34                	sysenter
+ 961:	c3                   	ret
+
+00000962 <lockstat>:
+SYSCALL(lockstat)
+ 962:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 967:	89 e1                	mov    %esp,%ecx
+ 969:	ba 70 09 00 00       	mov    $0x970,%edx
+ 96e:	0f 34                	sysenter
+ 970:	c3                   	ret
+
+00000971 <profctl>:
+SYSCALL(profctl)
+ 971:	b8 20 00 00 00       	mov    $0x20,%eax
+ 976:	89 e1                	mov    %esp,%ecx
+ 978:	ba 7f 09 00 00       	mov    $0x97f,%edx
+ 97d:	0f 34                	sysenter
+ 97f:	c3                   	ret
+
+00000980 <profread>:
+SYSCALL(profread)
+ 980:	b8 21 00 00 00       	mov    $0x21,%eax
+ 985:	89 e1                	mov    %esp,%ecx
+ 987:	ba 8e 09 00 00       	mov    $0x98e,%edx
+ 98c:	0f 34                	sysenter
+ 98e:	c3                   	ret
+
+0000098f <getrusage>:
+SYSCALL(getrusage)
+ 98f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 994:	89 e1                	mov    %esp,%ecx
+ 996:	ba 9d 09 00 00       	mov    $0x99d,%edx
+ 99b:	0f 34                	sysenter
+ 99d:	c3                   	ret
+
+0000099e <tracectl>:
+SYSCALL(tracectl)
+ 99e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9a3:	89 e1                	mov    %esp,%ecx
+ 9a5:	ba ac 09 00 00       	mov    $0x9ac,%edx
+ 9aa:	0f 34                	sysenter
+ 9ac:	c3                   	ret
+
+000009ad <traceread>:
+SYSCALL(traceread)
+ 9ad:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9b2:	89 e1                	mov    %esp,%ecx
+ 9b4:	ba bb 09 00 00       	mov    $0x9bb,%edx
+ 9b9:	0f 34                	sysenter
+ 9bb:	c3                   	ret
+
+000009bc <nanosleep>:
+SYSCALL(nanosleep)
+ 9bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9c1:	89 e1                	mov    %esp,%ecx
+ 9c3:	ba ca 09 00 00       	mov    $0x9ca,%edx
+ 9c8:	0f 34                	sysenter
+ 9ca:	c3                   	ret
+ 9cb:	66 90                	xchg   %ax,%ax
+ 9cd:	66 90                	xchg   %ax,%ax
+ 9cf:	90                   	nop
+
+000009d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+ 9d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9d8:	89 d1                	mov    %edx,%ecx
+{
+ 9da:	83 ec 3c             	sub    $0x3c,%esp
+ 9dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9e0:	85 d2                	test   %edx,%edx
+ 9e2:	0f 89 80 00 00 00    	jns    a68 <printint+0x98>
+ 9e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9ec:	74 7a                	je     a68 <printint+0x98>
+    x = -xx;
+ 9ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9f8:	31 f6                	xor    %esi,%esi
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a00:	89 c8                	mov    %ecx,%eax
+ a02:	31 d2                	xor    %edx,%edx
+ a04:	89 f7                	mov    %esi,%edi
+ a06:	f7 f3                	div    %ebx
+ a08:	8d 76 01             	lea    0x1(%esi),%esi
+ a0b:	0f b6 92 94 0f 00 00 	movzbl 0xf94(%edx),%edx
+ a12:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a16:	89 ca                	mov    %ecx,%edx
+ a18:	89 c1                	mov    %eax,%ecx
+ a1a:	39 da                	cmp    %ebx,%edx
+ a1c:	73 e2                	jae    a00 <printint+0x30>
+  if(neg)
+ a1e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a21:	85 c0                	test   %eax,%eax
+ a23:	74 07                	je     a2c <printint+0x5c>
+    buf[i++] = '-';
+ a25:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a2a:	89 f7                	mov    %esi,%edi
+ a2c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a2f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a32:	01 df                	add    %ebx,%edi
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a38:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a3b:	83 ec 04             	sub    $0x4,%esp
+ a3e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a41:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a44:	6a 01                	push   $0x1
+ a46:	50                   	push   %eax
+ a47:	56                   	push   %esi
+ a48:	e8 bc fd ff ff       	call   809 <write>
+  while(--i >= 0)
+ a4d:	89 f8                	mov    %edi,%eax
+ a4f:	83 c4 10             	add    $0x10,%esp
+ a52:	83 ef 01             	sub    $0x1,%edi
+ a55:	39 d8                	cmp    %ebx,%eax
+ a57:	75 df                	jne    a38 <printint+0x68>
+}
+ a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a5c:	5b                   	pop    %ebx
+ a5d:	5e                   	pop    %esi
+ a5e:	5f                   	pop    %edi
+ a5f:	5d                   	pop    %ebp
+ a60:	c3                   	ret
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a68:	31 c0                	xor    %eax,%eax
+ a6a:	eb 89                	jmp    9f5 <printint+0x25>
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a70 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a79:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a7f:	0f b6 1e             	movzbl (%esi),%ebx
+ a82:	83 c6 01             	add    $0x1,%esi
+ a85:	84 db                	test   %bl,%bl
+ a87:	74 67                	je     af0 <printf+0x80>
+ a89:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a8c:	31 d2                	xor    %edx,%edx
+ a8e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a91:	eb 34                	jmp    ac7 <printf+0x57>
+ a93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a97:	90                   	nop
+ a98:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a9b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ aa0:	83 f8 25             	cmp    $0x25,%eax
+ aa3:	74 18                	je     abd <printf+0x4d>
+  write(fd, &c, 1);
+ aa5:	83 ec 04             	sub    $0x4,%esp
+ aa8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ aab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ aae:	6a 01                	push   $0x1
+ ab0:	50                   	push   %eax
+ ab1:	57                   	push   %edi
+ ab2:	e8 52 fd ff ff       	call   809 <write>
+ ab7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ abd:	0f b6 1e             	movzbl (%esi),%ebx
+ ac0:	83 c6 01             	add    $0x1,%esi
+ ac3:	84 db                	test   %bl,%bl
+ ac5:	74 29                	je     af0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ac7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aca:	85 d2                	test   %edx,%edx
+ acc:	74 ca                	je     a98 <printf+0x28>
+      }
+    } else if(state == '%'){
+ ace:	83 fa 25             	cmp    $0x25,%edx
+ ad1:	75 ea                	jne    abd <printf+0x4d>
+      if(c == 'd'){
+ ad3:	83 f8 25             	cmp    $0x25,%eax
+ ad6:	0f 84 24 01 00 00    	je     c00 <printf+0x190>
+ adc:	83 e8 63             	sub    $0x63,%eax
+ adf:	83 f8 15             	cmp    $0x15,%eax
+ ae2:	77 1c                	ja     b00 <printf+0x90>
+ ae4:	ff 24 85 3c 0f 00 00 	jmp    *0xf3c(,%eax,4)
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ af3:	5b                   	pop    %ebx
+ af4:	5e                   	pop    %esi
+ af5:	5f                   	pop    %edi
+ af6:	5d                   	pop    %ebp
+ af7:	c3                   	ret
+ af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b0a:	6a 01                	push   $0x1
+ b0c:	52                   	push   %edx
+ b0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b10:	57                   	push   %edi
+ b11:	e8 f3 fc ff ff       	call   809 <write>
+ b16:	83 c4 0c             	add    $0xc,%esp
+ b19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b1c:	6a 01                	push   $0x1
+ b1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b21:	52                   	push   %edx
+ b22:	57                   	push   %edi
+ b23:	e8 e1 fc ff ff       	call   809 <write>
+        putc(fd, c);
+ b28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b2b:	31 d2                	xor    %edx,%edx
+ b2d:	eb 8e                	jmp    abd <printf+0x4d>
+ b2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b3b:	8b 13                	mov    (%ebx),%edx
+ b3d:	6a 00                	push   $0x0
+ b3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b44:	e8 87 fe ff ff       	call   9d0 <printint>
+        ap++;
+ b49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b4f:	31 d2                	xor    %edx,%edx
+ b51:	e9 67 ff ff ff       	jmp    abd <printf+0x4d>
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b65:	83 c0 04             	add    $0x4,%eax
+ b68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b6b:	85 db                	test   %ebx,%ebx
+ b6d:	0f 84 9d 00 00 00    	je     c10 <printf+0x1a0>
+        while(*s != 0){
+ b73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b78:	84 c0                	test   %al,%al
+ b7a:	0f 84 3d ff ff ff    	je     abd <printf+0x4d>
+ b80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b86:	89 de                	mov    %ebx,%esi
+ b88:	89 d3                	mov    %edx,%ebx
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	53                   	push   %ebx
+ b9c:	57                   	push   %edi
+ b9d:	e8 67 fc ff ff       	call   809 <write>
+        while(*s != 0){
+ ba2:	0f b6 06             	movzbl (%esi),%eax
+ ba5:	83 c4 10             	add    $0x10,%esp
+ ba8:	84 c0                	test   %al,%al
+ baa:	75 e4                	jne    b90 <printf+0x120>
+      state = 0;
+ bac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 07 ff ff ff       	jmp    abd <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bcb:	8b 13                	mov    (%ebx),%edx
+ bcd:	6a 01                	push   $0x1
+ bcf:	e9 6b ff ff ff       	jmp    b3f <printf+0xcf>
+ bd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bd8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bdb:	83 ec 04             	sub    $0x4,%esp
+ bde:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ be1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ be3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ be6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ be9:	6a 01                	push   $0x1
+ beb:	52                   	push   %edx
+ bec:	57                   	push   %edi
+ bed:	e8 17 fc ff ff       	call   809 <write>
+        ap++;
+ bf2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bf5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bf8:	31 d2                	xor    %edx,%edx
+ bfa:	e9 be fe ff ff       	jmp    abd <printf+0x4d>
+ bff:	90                   	nop
+  write(fd, &c, 1);
+ c00:	83 ec 04             	sub    $0x4,%esp
+ c03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c09:	6a 01                	push   $0x1
+ c0b:	e9 11 ff ff ff       	jmp    b21 <printf+0xb1>
+ c10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c15:	bb 34 0f 00 00       	mov    $0xf34,%ebx
+ c1a:	e9 61 ff ff ff       	jmp    b80 <printf+0x110>
+ c1f:	90                   	nop
+
+00000c20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c21:	a1 0c 14 00 00       	mov    0x140c,%eax
+{
+ c26:	89 e5                	mov    %esp,%ebp
+ c28:	57                   	push   %edi
+ c29:	56                   	push   %esi
+ c2a:	53                   	push   %ebx
+ c2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c3c:	39 ca                	cmp    %ecx,%edx
+ c3e:	73 30                	jae    c70 <free+0x50>
+ c40:	39 c1                	cmp    %eax,%ecx
+ c42:	72 04                	jb     c48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c44:	39 c2                	cmp    %eax,%edx
+ c46:	72 f0                	jb     c38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c4e:	39 f8                	cmp    %edi,%eax
+ c50:	74 2e                	je     c80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c55:	8b 42 04             	mov    0x4(%edx),%eax
+ c58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c5b:	39 f1                	cmp    %esi,%ecx
+ c5d:	74 38                	je     c97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c61:	5b                   	pop    %ebx
+  freep = p;
+ c62:	89 15 0c 14 00 00    	mov    %edx,0x140c
+}
+ c68:	5e                   	pop    %esi
+ c69:	5f                   	pop    %edi
+ c6a:	5d                   	pop    %ebp
+ c6b:	c3                   	ret
+ c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c70:	39 c1                	cmp    %eax,%ecx
+ c72:	72 d0                	jb     c44 <free+0x24>
+ c74:	eb c2                	jmp    c38 <free+0x18>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c80:	03 70 04             	add    0x4(%eax),%esi
+ c83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c86:	8b 02                	mov    (%edx),%eax
+ c88:	8b 00                	mov    (%eax),%eax
+ c8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c8d:	8b 42 04             	mov    0x4(%edx),%eax
+ c90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c93:	39 f1                	cmp    %esi,%ecx
+ c95:	75 c8                	jne    c5f <free+0x3f>
+    p->s.size += bp->s.size;
+ c97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c9a:	89 15 0c 14 00 00    	mov    %edx,0x140c
+    p->s.size += bp->s.size;
+ ca0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ca3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ca6:	89 0a                	mov    %ecx,(%edx)
+}
+ ca8:	5b                   	pop    %ebx
+ ca9:	5e                   	pop    %esi
+ caa:	5f                   	pop    %edi
+ cab:	5d                   	pop    %ebp
+ cac:	c3                   	ret
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000cb0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	57                   	push   %edi
+ cb4:	56                   	push   %esi
+ cb5:	53                   	push   %ebx
+ cb6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cbc:	8b 15 0c 14 00 00    	mov    0x140c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cc2:	8d 78 07             	lea    0x7(%eax),%edi
+ cc5:	c1 ef 03             	shr    $0x3,%edi
+ cc8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ ccb:	85 d2                	test   %edx,%edx
+ ccd:	0f 84 8d 00 00 00    	je     d60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd8:	39 f9                	cmp    %edi,%ecx
+ cda:	73 64                	jae    d40 <malloc+0x90>
+  if(nu < 4096)
+ cdc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ce1:	39 df                	cmp    %ebx,%edi
+ ce3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ce6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ced:	eb 0a                	jmp    cf9 <malloc+0x49>
+ cef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cf2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cf5:	39 f9                	cmp    %edi,%ecx
+ cf7:	73 47                	jae    d40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cf9:	89 c2                	mov    %eax,%edx
+ cfb:	39 05 0c 14 00 00    	cmp    %eax,0x140c
+ d01:	75 ed                	jne    cf0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d03:	83 ec 0c             	sub    $0xc,%esp
+ d06:	56                   	push   %esi
+ d07:	e8 b1 fb ff ff       	call   8bd <sbrk>
+  if(p == (char*)-1)
+ d0c:	83 c4 10             	add    $0x10,%esp
+ d0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d12:	74 1c                	je     d30 <malloc+0x80>
+  hp->s.size = nu;
+ d14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d17:	83 ec 0c             	sub    $0xc,%esp
+ d1a:	83 c0 08             	add    $0x8,%eax
+ d1d:	50                   	push   %eax
+ d1e:	e8 fd fe ff ff       	call   c20 <free>
+  return freep;
+ d23:	8b 15 0c 14 00 00    	mov    0x140c,%edx
+      if((p = morecore(nunits)) == 0)
+ d29:	83 c4 10             	add    $0x10,%esp
+ d2c:	85 d2                	test   %edx,%edx
+ d2e:	75 c0                	jne    cf0 <malloc+0x40>
+        return 0;
+  }
+}
+ d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d33:	31 c0                	xor    %eax,%eax
+}
+ d35:	5b                   	pop    %ebx
+ d36:	5e                   	pop    %esi
+ d37:	5f                   	pop    %edi
+ d38:	5d                   	pop    %ebp
+ d39:	c3                   	ret
+ d3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d40:	39 cf                	cmp    %ecx,%edi
+ d42:	74 4c                	je     d90 <malloc+0xe0>
+        p->s.size -= nunits;
+ d44:	29 f9                	sub    %edi,%ecx
+ d46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d4f:	89 15 0c 14 00 00    	mov    %edx,0x140c
+}
+ d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d58:	83 c0 08             	add    $0x8,%eax
+}
+ d5b:	5b                   	pop    %ebx
+ d5c:	5e                   	pop    %esi
+ d5d:	5f                   	pop    %edi
+ d5e:	5d                   	pop    %ebp
+ d5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d60:	c7 05 0c 14 00 00 10 	movl   $0x1410,0x140c
+ d67:	14 00 00 
+    base.s.size = 0;
+ d6a:	b8 10 14 00 00       	mov    $0x1410,%eax
+    base.s.ptr = freep = prevp = &base;
+ d6f:	c7 05 10 14 00 00 10 	movl   $0x1410,0x1410
+ d76:	14 00 00 
+    base.s.size = 0;
+ d79:	c7 05 14 14 00 00 00 	movl   $0x0,0x1414
+ d80:	00 00 00 
+    if(p->s.size >= nunits){
+ d83:	e9 54 ff ff ff       	jmp    cdc <malloc+0x2c>
+ d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d90:	8b 08                	mov    (%eax),%ecx
+ d92:	89 0a                	mov    %ecx,(%edx)
+ d94:	eb b9                	jmp    d4f <malloc+0x9f>
@@ -0,0 +1,133 @@
+// Kernel event trace.
+//   ktrace cmd ...
+// Runs cmd with kernel event tracing on, then prints the events
+// recorded on every CPU merged into one timeline. Each line gives
+// the time since the first event in units of 1024 cycles, the CPU,
+// the process running on it, and the event.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "trace.h"
+
+#define MAXEV (NCPU*NTRACE)  // all the kernel keeps
+
+char *states[] = { "unused", "embryo", "sleep", "runble", "run", "zombie" };
+
+struct traceev *ev;
+int nev;
+
+// traceread() returns each CPU's events together, in order;
+// seg[i] is where the i'th CPU's run of events starts and next[i]
+// is the first of them not yet printed.
+int seg[NCPU+1], next[NCPU];
+int nseg;
+
+void
+show(struct traceev *e, uint64 t0)
+{
+  printf(1, "%d cpu%d pid %d ", (uint)((e->tsc - t0) >> 10), e->cpu, e->pid);
+  switch(e->type){
+  case TR_SYSCALL:
+    printf(1, "syscall %d\n", e->a0);
+    break;
+  case TR_SYSRET:
+    printf(1, "syscall %d returns %d\n", e->a0, e->a1);
+    break;
+  case TR_RUN:
+    printf(1, "run\n");
+    break;
+  case TR_SCHED:
+    printf(1, "sched, now %s\n",
+           e->a0 < sizeof(states)/sizeof(states[0]) ? states[e->a0] : "???");
+    break;
+  case TR_SLEEP:
+    printf(1, "sleep on %x\n", e->a0);
+    break;
+  case TR_WAKEUP:
+    printf(1, "wakeup %x wakes pid %d\n", e->a0, e->a1);
+    break;
+  case TR_DISKREQ:
+    printf(1, "disk %s block %d\n", e->a1 ? "write" : "read", e->a0);
+    break;
+  case TR_DISKDONE:
+    printf(1, "disk done block %d\n", e->a0);
+    break;
+  case TR_COMMIT:
+    printf(1, "commit %d blocks\n", e->a0);
+    break;
+  case TR_COMMITDONE:
+    printf(1, "commit done\n");
+    break;
+  default:
+    printf(1, "event %d %x %x\n", e->type, e->a0, e->a1);
+  }
+}
+
+// Print the events oldest first, merging the CPUs' runs.
+void
+timeline(void)
+{
+  struct traceev *e;
+  int i, best;
+
+  nseg = 0;
+  for(i = 0; i < nev; i++)
+    if(i == 0 || (ev[i].cpu != ev[i-1].cpu && nseg < NCPU))
+      seg[nseg++] = i;
+  seg[nseg] = nev;
+  for(i = 0; i < nseg; i++)
+    next[i] = seg[i];
+
+  e = 0;
+  for(;;){
+    best = -1;
+    for(i = 0; i < nseg; i++){
+      if(next[i] == seg[i+1])
+        continue;
+      if(best < 0 || ev[next[i]].tsc < ev[next[best]].tsc)
+        best = i;
+    }
+    if(best < 0)
+      break;
+    if(e == 0)
+      e = &ev[next[best]];
+    show(&ev[next[best]++], e->tsc);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int lost, n, pid;
+
+  if(argc < 2){
+    printf(2, "usage: ktrace cmd ...\n");
+    exit();
+  }
+  if((ev = malloc(MAXEV * sizeof(*ev))) == 0){
+    printf(2, "ktrace: out of memory\n");
+    exit();
+  }
+
+  tracectl(1);
+  if((pid = fork()) < 0){
+    printf(2, "ktrace: fork failed\n");
+    tracectl(0);
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[1], argv + 1);
+    printf(2, "ktrace: exec %s failed\n", argv[1]);
+    exit();
+  }
+  wait();
+  lost = tracectl(0);
+
+  while(nev < MAXEV && (n = traceread(ev + nev, MAXEV - nev)) > 0)
+    nev += n;
+  printf(1, "%d events, %d overwritten\n", nev, lost);
+  timeline();
+  exit();
+}
@@ -41,6 +41,10 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define TICKCOUNT 10000000   // Timer counts per clock tick
+
+static uint tsctick;   // TSC cycles per clock tick; see lapiccalibrate()
+
 volatile uint *lapic;  // Initialized in mp.c
 
 //PAGEBREAK!
@@ -60,13 +64,12 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down at bus frequency from lapic[TICR]
+  // and then issues an interrupt. It starts out stopped; see
+  // lapiconeshot() and lapictimer().
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, 0);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -105,6 +108,54 @@ lapicid(void)
   return lapic[ID] >> 24;
 }
 
+// Measure how many TSC cycles the timer takes to count down one
+// clock tick, with its interrupt masked. A clock tick is
+// TICKCOUNT timer counts, which is 10ms at QEMU's 1GHz bus.
+// Returns the number of cycles.
+uint
+lapiccalibrate(void)
+{
+  uint64 t0;
+
+  if(!lapic)
+    return 0;
+  lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT);
+  t0 = rdtsc();
+  while(lapic[TCCR] != 0)
+    ;
+  tsctick = rdtsc() - t0;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  return tsctick;
+}
+
+// Make this CPU's timer interrupt n times per clock tick.
+void
+lapictimer(int n)
+{
+  if(!lapic)
+    return;
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT / n);
+}
+
+// Make this CPU's timer interrupt once, cycles TSC cycles from
+// now, or never if cycles is 0. cycles must be less than 400
+// clock ticks.
+void
+lapiconeshot(uint64 cycles)
+{
+  uint n;
+
+  if(!lapic)
+    return;
+  n = 0;
+  if(cycles)
+    n = divl(cycles * TICKCOUNT, tsctick) + 1;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n);
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
@@ -160,6 +211,18 @@ lapicstartap(uchar apicid, uint addr)
   }
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(uchar apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 #define CMOS_STATA   0x0a
 #define CMOS_STATB   0x0b
 #define CMOS_UIP    (1 << 7)        // RTC update in progress
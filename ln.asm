@@ -0,0 +1,1452 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 68 09 00 00       	push   $0x968
+  1e:	6a 02                	push   $0x2
+  20:	e8 1b 06 00 00       	call   640 <printf>
+    exit();
+  25:	e8 73 03 00 00       	call   39d <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 1a 04 00 00       	call   451 <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 5a 03 00 00       	call   39d <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 7b 09 00 00       	push   $0x97b
+  4e:	6a 02                	push   $0x2
+  50:	e8 eb 05 00 00       	call   640 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 2d 02 00 00       	call   3ca <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 23 02 00 00       	call   415 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 3b 02 00 00       	call   442 <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 d7 01 00 00       	call   3e8 <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+ 2a5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 2ae:	85 f6                	test   %esi,%esi
+ 2b0:	74 2e                	je     2e0 <memcmp+0x40>
+ 2b2:	01 c6                	add    %eax,%esi
+ 2b4:	eb 14                	jmp    2ca <memcmp+0x2a>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 2c6:	39 f0                	cmp    %esi,%eax
+ 2c8:	74 16                	je     2e0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 2ca:	0f b6 0a             	movzbl (%edx),%ecx
+ 2cd:	0f b6 18             	movzbl (%eax),%ebx
+ 2d0:	38 d9                	cmp    %bl,%cl
+ 2d2:	74 ec                	je     2c0 <memcmp+0x20>
+      return *s1 - *s2;
+ 2d4:	0f b6 c1             	movzbl %cl,%eax
+ 2d7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2e0:	5b                   	pop    %ebx
+  return 0;
+ 2e1:	31 c0                	xor    %eax,%eax
+}
+ 2e3:	5e                   	pop    %esi
+ 2e4:	5d                   	pop    %ebp
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 2f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 300:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 302:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 308:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 30e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 314:	c3                   	ret
+ 315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 320:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 322:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 328:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+
+00000330 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	53                   	push   %ebx
+ 336:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 338:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 33d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 343:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 349:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 34f:	89 c6                	mov    %eax,%esi
+ 351:	f7 f7                	div    %edi
+ 353:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 355:	f7 e3                	mul    %ebx
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 35a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 35d:	89 d3                	mov    %edx,%ebx
+ 35f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 362:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 364:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 366:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 36c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 371:	f7 e6                	mul    %esi
+ 373:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 379:	29 d9                	sub    %ebx,%ecx
+ 37b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 381:	01 c1                	add    %eax,%ecx
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5f                   	pop    %edi
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+
+0000038e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 38e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 393:	89 e1                	mov    %esp,%ecx
+ 395:	ba 9c 03 00 00       	mov    $0x39c,%edx
+ 39a:	0f 34                	sysenter
+ 39c:	c3                   	ret
+
+0000039d <exit>:
+SYSCALL(exit)
+ 39d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a2:	89 e1                	mov    %esp,%ecx
+ 3a4:	ba ab 03 00 00       	mov    $0x3ab,%edx
+ 3a9:	0f 34                	sysenter
+ 3ab:	c3                   	ret
+
+000003ac <wait>:
+SYSCALL(wait)
+ 3ac:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b1:	89 e1                	mov    %esp,%ecx
+ 3b3:	ba ba 03 00 00       	mov    $0x3ba,%edx
+ 3b8:	0f 34                	sysenter
+ 3ba:	c3                   	ret
+
+000003bb <pipe>:
+SYSCALL(pipe)
+ 3bb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3c0:	89 e1                	mov    %esp,%ecx
+ 3c2:	ba c9 03 00 00       	mov    $0x3c9,%edx
+ 3c7:	0f 34                	sysenter
+ 3c9:	c3                   	ret
+
+000003ca <read>:
+SYSCALL(read)
+ 3ca:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3cf:	89 e1                	mov    %esp,%ecx
+ 3d1:	ba d8 03 00 00       	mov    $0x3d8,%edx
+ 3d6:	0f 34                	sysenter
+ 3d8:	c3                   	ret
+
+000003d9 <write>:
+SYSCALL(write)
+ 3d9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3de:	89 e1                	mov    %esp,%ecx
+ 3e0:	ba e7 03 00 00       	mov    $0x3e7,%edx
+ 3e5:	0f 34                	sysenter
+ 3e7:	c3                   	ret
+
+000003e8 <close>:
+SYSCALL(close)
+ 3e8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ed:	89 e1                	mov    %esp,%ecx
+ 3ef:	ba f6 03 00 00       	mov    $0x3f6,%edx
+ 3f4:	0f 34                	sysenter
+ 3f6:	c3                   	ret
+
+000003f7 <kill>:
+SYSCALL(kill)
+ 3f7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3fc:	89 e1                	mov    %esp,%ecx
+ 3fe:	ba 05 04 00 00       	mov    $0x405,%edx
+ 403:	0f 34                	sysenter
+ 405:	c3                   	ret
+
+00000406 <exec>:
+SYSCALL(exec)
+ 406:	b8 07 00 00 00       	mov    $0x7,%eax
+ 40b:	89 e1                	mov    %esp,%ecx
+ 40d:	ba 14 04 00 00       	mov    $0x414,%edx
+ 412:	0f 34                	sysenter
+ 414:	c3                   	ret
+
+00000415 <open>:
+SYSCALL(open)
+ 415:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 41a:	89 e1                	mov    %esp,%ecx
+ 41c:	ba 23 04 00 00       	mov    $0x423,%edx
+ 421:	0f 34                	sysenter
+ 423:	c3                   	ret
+
+00000424 <mknod>:
+SYSCALL(mknod)
+ 424:	b8 11 00 00 00       	mov    $0x11,%eax
+ 429:	89 e1                	mov    %esp,%ecx
+ 42b:	ba 32 04 00 00       	mov    $0x432,%edx
+ 430:	0f 34                	sysenter
+ 432:	c3                   	ret
+
+00000433 <unlink>:
+SYSCALL(unlink)
+ 433:	b8 12 00 00 00       	mov    $0x12,%eax
+ 438:	89 e1                	mov    %esp,%ecx
+ 43a:	ba 41 04 00 00       	mov    $0x441,%edx
+ 43f:	0f 34                	sysenter
+ 441:	c3                   	ret
+
+00000442 <fstat>:
+SYSCALL(fstat)
+ 442:	b8 08 00 00 00       	mov    $0x8,%eax
+ 447:	89 e1                	mov    %esp,%ecx
+ 449:	ba 50 04 00 00       	mov    $0x450,%edx
+ 44e:	0f 34                	sysenter
+ 450:	c3                   	ret
+
+00000451 <link>:
+SYSCALL(link)
+ 451:	b8 13 00 00 00       	mov    $0x13,%eax
+ 456:	89 e1                	mov    %esp,%ecx
+ 458:	ba 5f 04 00 00       	mov    $0x45f,%edx
+ 45d:	0f 34                	sysenter
+ 45f:	c3                   	ret
+
+00000460 <mkdir>:
+SYSCALL(mkdir)
+ 460:	b8 14 00 00 00       	mov    $0x14,%eax
+ 465:	89 e1                	mov    %esp,%ecx
+ 467:	ba 6e 04 00 00       	mov    $0x46e,%edx
+ 46c:	0f 34                	sysenter
+ 46e:	c3                   	ret
+
+0000046f <chdir>:
+SYSCALL(chdir)
+ 46f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 474:	89 e1                	mov    %esp,%ecx
+ 476:	ba 7d 04 00 00       	mov    $0x47d,%edx
+ 47b:	0f 34                	sysenter
+ 47d:	c3                   	ret
+
+0000047e <dup>:
+SYSCALL(dup)
+ 47e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 483:	89 e1                	mov    %esp,%ecx
+ 485:	ba 8c 04 00 00       	mov    $0x48c,%edx
+ 48a:	0f 34                	sysenter
+ 48c:	c3                   	ret
+
+0000048d <sbrk>:
+SYSCALL(sbrk)
+ 48d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 492:	89 e1                	mov    %esp,%ecx
+ 494:	ba 9b 04 00 00       	mov    $0x49b,%edx
+ 499:	0f 34                	sysenter
+ 49b:	c3                   	ret
+
+0000049c <sleep>:
+SYSCALL(sleep)
+ 49c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a1:	89 e1                	mov    %esp,%ecx
+ 4a3:	ba aa 04 00 00       	mov    $0x4aa,%edx
+ 4a8:	0f 34                	sysenter
+ 4aa:	c3                   	ret
+
+000004ab <fallocate>:
+SYSCALL(fallocate)
+ 4ab:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b0:	89 e1                	mov    %esp,%ecx
+ 4b2:	ba b9 04 00 00       	mov    $0x4b9,%edx
+ 4b7:	0f 34                	sysenter
+ 4b9:	c3                   	ret
+
+000004ba <pread>:
+SYSCALL(pread)
+ 4ba:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4bf:	89 e1                	mov    %esp,%ecx
+ 4c1:	ba c8 04 00 00       	mov    $0x4c8,%edx
+ 4c6:	0f 34                	sysenter
+ 4c8:	c3                   	ret
+
+000004c9 <pwrite>:
+SYSCALL(pwrite)
+ 4c9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4ce:	89 e1                	mov    %esp,%ecx
+ 4d0:	ba d7 04 00 00       	mov    $0x4d7,%edx
+ 4d5:	0f 34                	sysenter
+ 4d7:	c3                   	ret
+
+000004d8 <readv>:
+SYSCALL(readv)
+ 4d8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4dd:	89 e1                	mov    %esp,%ecx
+ 4df:	ba e6 04 00 00       	mov    $0x4e6,%edx
+ 4e4:	0f 34                	sysenter
+ 4e6:	c3                   	ret
+
+000004e7 <writev>:
+SYSCALL(writev)
+ 4e7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ec:	89 e1                	mov    %esp,%ecx
+ 4ee:	ba f5 04 00 00       	mov    $0x4f5,%edx
+ 4f3:	0f 34                	sysenter
+ 4f5:	c3                   	ret
+
+000004f6 <splice>:
+SYSCALL(splice)
+ 4f6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4fb:	89 e1                	mov    %esp,%ecx
+ 4fd:	ba 04 05 00 00       	mov    $0x504,%edx
+ 502:	0f 34                	sysenter
+ 504:	c3                   	ret
+
+00000505 <setpriority>:
+SYSCALL(setpriority)
+ 505:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 50a:	89 e1                	mov    %esp,%ecx
+ 50c:	ba 13 05 00 00       	mov    $0x513,%edx
+ 511:	0f 34                	sysenter
+ 513:	c3                   	ret
+
+00000514 <setaffinity>:
+SYSCALL(setaffinity)
+ 514:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 519:	89 e1                	mov    %esp,%ecx
+ 51b:	ba 22 05 00 00       	mov    $0x522,%edx
+ 520:	0f 34                	sysenter
+ 522:	c3                   	ret
+
+00000523 <lockstress>:
+SYSCALL(lockstress)
+ 523:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 528:	89 e1                	mov    %esp,%ecx
+ 52a:	ba 31 05 00 00       	mov    $0x531,%edx
+ 52f:	0f 34                	sysenter
+ 531:	c3                   	ret
+
+00000532 <lockstat>:
+SYSCALL(lockstat)
+ 532:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 537:	89 e1                	mov    %esp,%ecx
+ 539:	ba 40 05 00 00       	mov    $0x540,%edx
+ 53e:	0f 34                	sysenter
+ 540:	c3                   	ret
+
+00000541 <profctl>:
+SYSCALL(profctl)
+ 541:	b8 20 00 00 00       	mov    $0x20,%eax
+ 546:	89 e1                	mov    %esp,%ecx
+ 548:	ba 4f 05 00 00       	mov    $0x54f,%edx
+ 54d:	0f 34                	sysenter
+ 54f:	c3                   	ret
+
+00000550 <profread>:
+SYSCALL(profread)
+ 550:	b8 21 00 00 00       	mov    $0x21,%eax
+ 555:	89 e1                	mov    %esp,%ecx
+ 557:	ba 5e 05 00 00       	mov    $0x55e,%edx
+ 55c:	0f 34                	sysenter
+ 55e:	c3                   	ret
+
+0000055f <getrusage>:
+SYSCALL(getrusage)
+ 55f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 564:	89 e1                	mov    %esp,%ecx
+ 566:	ba 6d 05 00 00       	mov    $0x56d,%edx
+ 56b:	0f 34                	sysenter
+ 56d:	c3                   	ret
+
+0000056e <tracectl>:
+SYSCALL(tracectl)
+ 56e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 573:	89 e1                	mov    %esp,%ecx
+ 575:	ba 7c 05 00 00       	mov    $0x57c,%edx
+ 57a:	0f 34                	sysenter
+ 57c:	c3                   	ret
+
+0000057d <traceread>:
+SYSCALL(traceread)
+ 57d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 582:	89 e1                	mov    %esp,%ecx
+ 584:	ba 8b 05 00 00       	mov    $0x58b,%edx
+ 589:	0f 34                	sysenter
+ 58b:	c3                   	ret
+
+0000058c <nanosleep>:
+SYSCALL(nanosleep)
+ 58c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 591:	89 e1                	mov    %esp,%ecx
+ 593:	ba 9a 05 00 00       	mov    $0x59a,%edx
+ 598:	0f 34                	sysenter
+ 59a:	c3                   	ret
+ 59b:	66 90                	xchg   %ax,%ax
+ 59d:	66 90                	xchg   %ax,%ax
+ 59f:	90                   	nop
+
+000005a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5a8:	89 d1                	mov    %edx,%ecx
+{
+ 5aa:	83 ec 3c             	sub    $0x3c,%esp
+ 5ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5b0:	85 d2                	test   %edx,%edx
+ 5b2:	0f 89 80 00 00 00    	jns    638 <printint+0x98>
+ 5b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5bc:	74 7a                	je     638 <printint+0x98>
+    x = -xx;
+ 5be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5c8:	31 f6                	xor    %esi,%esi
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5d0:	89 c8                	mov    %ecx,%eax
+ 5d2:	31 d2                	xor    %edx,%edx
+ 5d4:	89 f7                	mov    %esi,%edi
+ 5d6:	f7 f3                	div    %ebx
+ 5d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5db:	0f b6 92 f0 09 00 00 	movzbl 0x9f0(%edx),%edx
+ 5e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5e6:	89 ca                	mov    %ecx,%edx
+ 5e8:	89 c1                	mov    %eax,%ecx
+ 5ea:	39 da                	cmp    %ebx,%edx
+ 5ec:	73 e2                	jae    5d0 <printint+0x30>
+  if(neg)
+ 5ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5f1:	85 c0                	test   %eax,%eax
+ 5f3:	74 07                	je     5fc <printint+0x5c>
+    buf[i++] = '-';
+ 5f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5fa:	89 f7                	mov    %esi,%edi
+ 5fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 602:	01 df                	add    %ebx,%edi
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 608:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 611:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 614:	6a 01                	push   $0x1
+ 616:	50                   	push   %eax
+ 617:	56                   	push   %esi
+ 618:	e8 bc fd ff ff       	call   3d9 <write>
+  while(--i >= 0)
+ 61d:	89 f8                	mov    %edi,%eax
+ 61f:	83 c4 10             	add    $0x10,%esp
+ 622:	83 ef 01             	sub    $0x1,%edi
+ 625:	39 d8                	cmp    %ebx,%eax
+ 627:	75 df                	jne    608 <printint+0x68>
+}
+ 629:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62c:	5b                   	pop    %ebx
+ 62d:	5e                   	pop    %esi
+ 62e:	5f                   	pop    %edi
+ 62f:	5d                   	pop    %ebp
+ 630:	c3                   	ret
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 638:	31 c0                	xor    %eax,%eax
+ 63a:	eb 89                	jmp    5c5 <printint+0x25>
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 649:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 64c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 64f:	0f b6 1e             	movzbl (%esi),%ebx
+ 652:	83 c6 01             	add    $0x1,%esi
+ 655:	84 db                	test   %bl,%bl
+ 657:	74 67                	je     6c0 <printf+0x80>
+ 659:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 65c:	31 d2                	xor    %edx,%edx
+ 65e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 661:	eb 34                	jmp    697 <printf+0x57>
+ 663:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 667:	90                   	nop
+ 668:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 66b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 670:	83 f8 25             	cmp    $0x25,%eax
+ 673:	74 18                	je     68d <printf+0x4d>
+  write(fd, &c, 1);
+ 675:	83 ec 04             	sub    $0x4,%esp
+ 678:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 67b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67e:	6a 01                	push   $0x1
+ 680:	50                   	push   %eax
+ 681:	57                   	push   %edi
+ 682:	e8 52 fd ff ff       	call   3d9 <write>
+ 687:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 68a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 68d:	0f b6 1e             	movzbl (%esi),%ebx
+ 690:	83 c6 01             	add    $0x1,%esi
+ 693:	84 db                	test   %bl,%bl
+ 695:	74 29                	je     6c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 697:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 69a:	85 d2                	test   %edx,%edx
+ 69c:	74 ca                	je     668 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 69e:	83 fa 25             	cmp    $0x25,%edx
+ 6a1:	75 ea                	jne    68d <printf+0x4d>
+      if(c == 'd'){
+ 6a3:	83 f8 25             	cmp    $0x25,%eax
+ 6a6:	0f 84 24 01 00 00    	je     7d0 <printf+0x190>
+ 6ac:	83 e8 63             	sub    $0x63,%eax
+ 6af:	83 f8 15             	cmp    $0x15,%eax
+ 6b2:	77 1c                	ja     6d0 <printf+0x90>
+ 6b4:	ff 24 85 98 09 00 00 	jmp    *0x998(,%eax,4)
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c3:	5b                   	pop    %ebx
+ 6c4:	5e                   	pop    %esi
+ 6c5:	5f                   	pop    %edi
+ 6c6:	5d                   	pop    %ebp
+ 6c7:	c3                   	ret
+ 6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6da:	6a 01                	push   $0x1
+ 6dc:	52                   	push   %edx
+ 6dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6e0:	57                   	push   %edi
+ 6e1:	e8 f3 fc ff ff       	call   3d9 <write>
+ 6e6:	83 c4 0c             	add    $0xc,%esp
+ 6e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ec:	6a 01                	push   $0x1
+ 6ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6f1:	52                   	push   %edx
+ 6f2:	57                   	push   %edi
+ 6f3:	e8 e1 fc ff ff       	call   3d9 <write>
+        putc(fd, c);
+ 6f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6fb:	31 d2                	xor    %edx,%edx
+ 6fd:	eb 8e                	jmp    68d <printf+0x4d>
+ 6ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 00                	push   $0x0
+ 70f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 711:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 714:	e8 87 fe ff ff       	call   5a0 <printint>
+        ap++;
+ 719:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 71c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 67 ff ff ff       	jmp    68d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 730:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 733:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 735:	83 c0 04             	add    $0x4,%eax
+ 738:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 73b:	85 db                	test   %ebx,%ebx
+ 73d:	0f 84 9d 00 00 00    	je     7e0 <printf+0x1a0>
+        while(*s != 0){
+ 743:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 746:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 748:	84 c0                	test   %al,%al
+ 74a:	0f 84 3d ff ff ff    	je     68d <printf+0x4d>
+ 750:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 753:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 756:	89 de                	mov    %ebx,%esi
+ 758:	89 d3                	mov    %edx,%ebx
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 766:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	53                   	push   %ebx
+ 76c:	57                   	push   %edi
+ 76d:	e8 67 fc ff ff       	call   3d9 <write>
+        while(*s != 0){
+ 772:	0f b6 06             	movzbl (%esi),%eax
+ 775:	83 c4 10             	add    $0x10,%esp
+ 778:	84 c0                	test   %al,%al
+ 77a:	75 e4                	jne    760 <printf+0x120>
+      state = 0;
+ 77c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 07 ff ff ff       	jmp    68d <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 01                	push   $0x1
+ 79f:	e9 6b ff ff ff       	jmp    70f <printf+0xcf>
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7ab:	83 ec 04             	sub    $0x4,%esp
+ 7ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	52                   	push   %edx
+ 7bc:	57                   	push   %edi
+ 7bd:	e8 17 fc ff ff       	call   3d9 <write>
+        ap++;
+ 7c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7c8:	31 d2                	xor    %edx,%edx
+ 7ca:	e9 be fe ff ff       	jmp    68d <printf+0x4d>
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d9:	6a 01                	push   $0x1
+ 7db:	e9 11 ff ff ff       	jmp    6f1 <printf+0xb1>
+ 7e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7e5:	bb 8f 09 00 00       	mov    $0x98f,%ebx
+ 7ea:	e9 61 ff ff ff       	jmp    750 <printf+0x110>
+ 7ef:	90                   	nop
+
+000007f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	a1 2c 0d 00 00       	mov    0xd2c,%eax
+{
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	57                   	push   %edi
+ 7f9:	56                   	push   %esi
+ 7fa:	53                   	push   %ebx
+ 7fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 808:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 80a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80c:	39 ca                	cmp    %ecx,%edx
+ 80e:	73 30                	jae    840 <free+0x50>
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 04                	jb     818 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 814:	39 c2                	cmp    %eax,%edx
+ 816:	72 f0                	jb     808 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 818:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 81b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 81e:	39 f8                	cmp    %edi,%eax
+ 820:	74 2e                	je     850 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 822:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 825:	8b 42 04             	mov    0x4(%edx),%eax
+ 828:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 82b:	39 f1                	cmp    %esi,%ecx
+ 82d:	74 38                	je     867 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 82f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 831:	5b                   	pop    %ebx
+  freep = p;
+ 832:	89 15 2c 0d 00 00    	mov    %edx,0xd2c
+}
+ 838:	5e                   	pop    %esi
+ 839:	5f                   	pop    %edi
+ 83a:	5d                   	pop    %ebp
+ 83b:	c3                   	ret
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 d0                	jb     814 <free+0x24>
+ 844:	eb c2                	jmp    808 <free+0x18>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 850:	03 70 04             	add    0x4(%eax),%esi
+ 853:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 02                	mov    (%edx),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 85d:	8b 42 04             	mov    0x4(%edx),%eax
+ 860:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 863:	39 f1                	cmp    %esi,%ecx
+ 865:	75 c8                	jne    82f <free+0x3f>
+    p->s.size += bp->s.size;
+ 867:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 86a:	89 15 2c 0d 00 00    	mov    %edx,0xd2c
+    p->s.size += bp->s.size;
+ 870:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 873:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 876:	89 0a                	mov    %ecx,(%edx)
+}
+ 878:	5b                   	pop    %ebx
+ 879:	5e                   	pop    %esi
+ 87a:	5f                   	pop    %edi
+ 87b:	5d                   	pop    %ebp
+ 87c:	c3                   	ret
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 889:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 88c:	8b 15 2c 0d 00 00    	mov    0xd2c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 892:	8d 78 07             	lea    0x7(%eax),%edi
+ 895:	c1 ef 03             	shr    $0x3,%edi
+ 898:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 89b:	85 d2                	test   %edx,%edx
+ 89d:	0f 84 8d 00 00 00    	je     930 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a8:	39 f9                	cmp    %edi,%ecx
+ 8aa:	73 64                	jae    910 <malloc+0x90>
+  if(nu < 4096)
+ 8ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8b1:	39 df                	cmp    %ebx,%edi
+ 8b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8bd:	eb 0a                	jmp    8c9 <malloc+0x49>
+ 8bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c5:	39 f9                	cmp    %edi,%ecx
+ 8c7:	73 47                	jae    910 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8c9:	89 c2                	mov    %eax,%edx
+ 8cb:	39 05 2c 0d 00 00    	cmp    %eax,0xd2c
+ 8d1:	75 ed                	jne    8c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	56                   	push   %esi
+ 8d7:	e8 b1 fb ff ff       	call   48d <sbrk>
+  if(p == (char*)-1)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+ 8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e2:	74 1c                	je     900 <malloc+0x80>
+  hp->s.size = nu;
+ 8e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	83 c0 08             	add    $0x8,%eax
+ 8ed:	50                   	push   %eax
+ 8ee:	e8 fd fe ff ff       	call   7f0 <free>
+  return freep;
+ 8f3:	8b 15 2c 0d 00 00    	mov    0xd2c,%edx
+      if((p = morecore(nunits)) == 0)
+ 8f9:	83 c4 10             	add    $0x10,%esp
+ 8fc:	85 d2                	test   %edx,%edx
+ 8fe:	75 c0                	jne    8c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 903:	31 c0                	xor    %eax,%eax
+}
+ 905:	5b                   	pop    %ebx
+ 906:	5e                   	pop    %esi
+ 907:	5f                   	pop    %edi
+ 908:	5d                   	pop    %ebp
+ 909:	c3                   	ret
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 910:	39 cf                	cmp    %ecx,%edi
+ 912:	74 4c                	je     960 <malloc+0xe0>
+        p->s.size -= nunits;
+ 914:	29 f9                	sub    %edi,%ecx
+ 916:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 919:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 91c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 91f:	89 15 2c 0d 00 00    	mov    %edx,0xd2c
+}
+ 925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 928:	83 c0 08             	add    $0x8,%eax
+}
+ 92b:	5b                   	pop    %ebx
+ 92c:	5e                   	pop    %esi
+ 92d:	5f                   	pop    %edi
+ 92e:	5d                   	pop    %ebp
+ 92f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 930:	c7 05 2c 0d 00 00 30 	movl   $0xd30,0xd2c
+ 937:	0d 00 00 
+    base.s.size = 0;
+ 93a:	b8 30 0d 00 00       	mov    $0xd30,%eax
+    base.s.ptr = freep = prevp = &base;
+ 93f:	c7 05 30 0d 00 00 30 	movl   $0xd30,0xd30
+ 946:	0d 00 00 
+    base.s.size = 0;
+ 949:	c7 05 34 0d 00 00 00 	movl   $0x0,0xd34
+ 950:	00 00 00 
+    if(p->s.size >= nunits){
+ 953:	e9 54 ff ff ff       	jmp    8ac <malloc+0x2c>
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 960:	8b 08                	mov    (%eax),%ecx
+ 962:	89 0a                	mov    %ecx,(%edx)
+ 964:	eb b9                	jmp    91f <malloc+0x9f>
@@ -0,0 +1,1674 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+  int kind, nproc;
+
+  for(kind = 0; kind < sizeof(kinds)/sizeof(kinds[0]); kind++)
+   e:	31 f6                	xor    %esi,%esi
+{
+  10:	53                   	push   %ebx
+  11:	51                   	push   %ecx
+  12:	83 ec 0c             	sub    $0xc,%esp
+    for(nproc = 1; nproc <= 8; nproc++)
+  15:	bb 01 00 00 00       	mov    $0x1,%ebx
+  1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(bench(kind, nproc) < 0)
+  20:	83 ec 08             	sub    $0x8,%esp
+  23:	53                   	push   %ebx
+  24:	56                   	push   %esi
+  25:	e8 26 00 00 00       	call   50 <bench>
+  2a:	83 c4 10             	add    $0x10,%esp
+  2d:	85 c0                	test   %eax,%eax
+  2f:	78 08                	js     39 <main+0x39>
+    for(nproc = 1; nproc <= 8; nproc++)
+  31:	83 c3 01             	add    $0x1,%ebx
+  34:	83 fb 09             	cmp    $0x9,%ebx
+  37:	75 e7                	jne    20 <main+0x20>
+  for(kind = 0; kind < sizeof(kinds)/sizeof(kinds[0]); kind++)
+  39:	83 c6 01             	add    $0x1,%esi
+  3c:	83 fe 03             	cmp    $0x3,%esi
+  3f:	75 d4                	jne    15 <main+0x15>
+        break;
+  exit();
+  41:	e8 37 05 00 00       	call   57d <exit>
+  46:	66 90                	xchg   %ax,%ax
+  48:	66 90                	xchg   %ax,%ax
+  4a:	66 90                	xchg   %ax,%ax
+  4c:	66 90                	xchg   %ax,%ax
+  4e:	66 90                	xchg   %ax,%ax
+
+00000050 <bench>:
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	57                   	push   %edi
+  54:	56                   	push   %esi
+  if(pipe(fds) < 0){
+  55:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+  58:	53                   	push   %ebx
+  59:	83 ec 38             	sub    $0x38,%esp
+  5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(pipe(fds) < 0){
+  5f:	50                   	push   %eax
+  60:	e8 36 05 00 00       	call   59b <pipe>
+  65:	83 c4 10             	add    $0x10,%esp
+  68:	85 c0                	test   %eax,%eax
+  6a:	0f 88 b2 01 00 00    	js     222 <bench+0x1d2>
+  start = uptime();
+  70:	e8 6b 04 00 00       	call   4e0 <uptime>
+  75:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < nproc; i++){
+  78:	85 f6                	test   %esi,%esi
+  7a:	0f 8e fe 00 00 00    	jle    17e <bench+0x12e>
+  80:	31 db                	xor    %ebx,%ebx
+  82:	eb 06                	jmp    8a <bench+0x3a>
+  84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  88:	89 c3                	mov    %eax,%ebx
+    if((pid = fork()) < 0){
+  8a:	e8 df 04 00 00       	call   56e <fork>
+  8f:	85 c0                	test   %eax,%eax
+  91:	0f 88 5f 01 00 00    	js     1f6 <bench+0x1a6>
+    if(pid == 0){
+  97:	0f 84 11 01 00 00    	je     1ae <bench+0x15e>
+  for(i = 0; i < nproc; i++){
+  9d:	8d 43 01             	lea    0x1(%ebx),%eax
+  a0:	39 c6                	cmp    %eax,%esi
+  a2:	75 e4                	jne    88 <bench+0x38>
+  close(fds[1]);
+  a4:	83 ec 0c             	sub    $0xc,%esp
+  a7:	ff 75 e4             	push   -0x1c(%ebp)
+  maxw = 0;
+  aa:	31 ff                	xor    %edi,%edi
+  close(fds[1]);
+  ac:	e8 17 05 00 00       	call   5c8 <close>
+  for(i = 0; i < nproc; i++){
+  b1:	31 d2                	xor    %edx,%edx
+  b3:	89 75 0c             	mov    %esi,0xc(%ebp)
+  close(fds[1]);
+  b6:	83 c4 10             	add    $0x10,%esp
+  b9:	89 d6                	mov    %edx,%esi
+  bb:	eb 11                	jmp    ce <bench+0x7e>
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+      maxw = -1;
+  c0:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  for(i = 0; i < nproc; i++){
+  c5:	8d 46 01             	lea    0x1(%esi),%eax
+  c8:	39 f3                	cmp    %esi,%ebx
+  ca:	74 34                	je     100 <bench+0xb0>
+  cc:	89 c6                	mov    %eax,%esi
+    if(read(fds[0], &w, sizeof(w)) != sizeof(w) || w < 0)
+  ce:	83 ec 04             	sub    $0x4,%esp
+  d1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  d4:	6a 04                	push   $0x4
+  d6:	50                   	push   %eax
+  d7:	ff 75 e0             	push   -0x20(%ebp)
+  da:	e8 cb 04 00 00       	call   5aa <read>
+  df:	83 c4 10             	add    $0x10,%esp
+  e2:	83 f8 04             	cmp    $0x4,%eax
+  e5:	75 d9                	jne    c0 <bench+0x70>
+  e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    else if(maxw >= 0 && w > maxw)
+  ea:	83 ff ff             	cmp    $0xffffffff,%edi
+  ed:	74 d1                	je     c0 <bench+0x70>
+  ef:	85 c0                	test   %eax,%eax
+  f1:	78 cd                	js     c0 <bench+0x70>
+  f3:	39 c7                	cmp    %eax,%edi
+  f5:	0f 4c f8             	cmovl  %eax,%edi
+  for(i = 0; i < nproc; i++){
+  f8:	8d 46 01             	lea    0x1(%esi),%eax
+  fb:	39 f3                	cmp    %esi,%ebx
+  fd:	75 cd                	jne    cc <bench+0x7c>
+  ff:	90                   	nop
+  close(fds[0]);
+ 100:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 103:	83 ec 0c             	sub    $0xc,%esp
+ 106:	ff 75 e0             	push   -0x20(%ebp)
+ 109:	e8 ba 04 00 00       	call   5c8 <close>
+  for(i = 0; i < nproc; i++)
+ 10e:	31 d2                	xor    %edx,%edx
+ 110:	89 75 0c             	mov    %esi,0xc(%ebp)
+  close(fds[0]);
+ 113:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+ 116:	89 d6                	mov    %edx,%esi
+ 118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+    wait();
+ 120:	e8 67 04 00 00       	call   58c <wait>
+  for(i = 0; i < nproc; i++)
+ 125:	89 f0                	mov    %esi,%eax
+ 127:	83 c6 01             	add    $0x1,%esi
+ 12a:	39 c3                	cmp    %eax,%ebx
+ 12c:	75 f2                	jne    120 <bench+0xd0>
+  ticks = uptime() - start;
+ 12e:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 131:	e8 aa 03 00 00       	call   4e0 <uptime>
+    ticks = 1;
+ 136:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 139:	29 c8                	sub    %ecx,%eax
+ 13b:	89 c1                	mov    %eax,%ecx
+ 13d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 142:	0f 44 c8             	cmove  %eax,%ecx
+  if(maxw < 0)
+ 145:	83 ff ff             	cmp    $0xffffffff,%edi
+ 148:	74 2a                	je     174 <bench+0x124>
+         kinds[kind], nproc, nproc * N / ticks, maxw);
+ 14a:	69 c6 a0 86 01 00    	imul   $0x186a0,%esi,%eax
+  printf(1, "%s, %d cpus: %d acquires/tick, max wait %d cycles\n",
+ 150:	83 ec 08             	sub    $0x8,%esp
+ 153:	57                   	push   %edi
+  return 0;
+ 154:	31 ff                	xor    %edi,%edi
+  printf(1, "%s, %d cpus: %d acquires/tick, max wait %d cycles\n",
+ 156:	99                   	cltd
+ 157:	f7 f9                	idiv   %ecx
+ 159:	50                   	push   %eax
+ 15a:	56                   	push   %esi
+ 15b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15e:	ff 34 85 8c 0f 00 00 	push   0xf8c(,%eax,4)
+ 165:	68 88 0b 00 00       	push   $0xb88
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 af 06 00 00       	call   820 <printf>
+  return 0;
+ 171:	83 c4 20             	add    $0x20,%esp
+}
+ 174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 177:	89 f8                	mov    %edi,%eax
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5f                   	pop    %edi
+ 17c:	5d                   	pop    %ebp
+ 17d:	c3                   	ret
+  close(fds[1]);
+ 17e:	83 ec 0c             	sub    $0xc,%esp
+ 181:	ff 75 e4             	push   -0x1c(%ebp)
+ 184:	e8 3f 04 00 00       	call   5c8 <close>
+  close(fds[0]);
+ 189:	58                   	pop    %eax
+ 18a:	ff 75 e0             	push   -0x20(%ebp)
+ 18d:	e8 36 04 00 00       	call   5c8 <close>
+  ticks = uptime() - start;
+ 192:	e8 49 03 00 00       	call   4e0 <uptime>
+  if(ticks == 0)
+ 197:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 19a:	83 c4 10             	add    $0x10,%esp
+    ticks = 1;
+ 19d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if(ticks == 0)
+ 1a2:	29 d0                	sub    %edx,%eax
+ 1a4:	89 c7                	mov    %eax,%edi
+ 1a6:	74 a2                	je     14a <bench+0xfa>
+  ticks = uptime() - start;
+ 1a8:	89 c1                	mov    %eax,%ecx
+  maxw = 0;
+ 1aa:	31 ff                	xor    %edi,%edi
+ 1ac:	eb 9c                	jmp    14a <bench+0xfa>
+      close(fds[0]);
+ 1ae:	83 ec 0c             	sub    $0xc,%esp
+ 1b1:	ff 75 e0             	push   -0x20(%ebp)
+ 1b4:	e8 0f 04 00 00       	call   5c8 <close>
+      w = -1;
+ 1b9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%ebp)
+      if(setaffinity(getpid(), 1 << i) == 0)
+ 1c0:	e8 0b 03 00 00       	call   4d0 <getpid>
+ 1c5:	59                   	pop    %ecx
+ 1c6:	89 d9                	mov    %ebx,%ecx
+ 1c8:	5e                   	pop    %esi
+ 1c9:	89 c2                	mov    %eax,%edx
+ 1cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1d0:	d3 e0                	shl    %cl,%eax
+ 1d2:	50                   	push   %eax
+ 1d3:	52                   	push   %edx
+ 1d4:	e8 1b 05 00 00       	call   6f4 <setaffinity>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+ 1dc:	85 c0                	test   %eax,%eax
+ 1de:	74 2a                	je     20a <bench+0x1ba>
+      write(fds[1], &w, sizeof(w));
+ 1e0:	83 ec 04             	sub    $0x4,%esp
+ 1e3:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 1e6:	6a 04                	push   $0x4
+ 1e8:	50                   	push   %eax
+ 1e9:	ff 75 e4             	push   -0x1c(%ebp)
+ 1ec:	e8 c8 03 00 00       	call   5b9 <write>
+      exit();
+ 1f1:	e8 87 03 00 00       	call   57d <exit>
+      printf(2, "lockbench: fork failed\n");
+ 1f6:	83 ec 08             	sub    $0x8,%esp
+ 1f9:	68 60 0b 00 00       	push   $0xb60
+ 1fe:	6a 02                	push   $0x2
+ 200:	e8 1b 06 00 00       	call   820 <printf>
+      exit();
+ 205:	e8 73 03 00 00       	call   57d <exit>
+        w = lockstress(kind, N);
+ 20a:	83 ec 08             	sub    $0x8,%esp
+ 20d:	68 a0 86 01 00       	push   $0x186a0
+ 212:	ff 75 08             	push   0x8(%ebp)
+ 215:	e8 e9 04 00 00       	call   703 <lockstress>
+ 21a:	83 c4 10             	add    $0x10,%esp
+ 21d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 220:	eb be                	jmp    1e0 <bench+0x190>
+    printf(2, "lockbench: pipe failed\n");
+ 222:	57                   	push   %edi
+ 223:	57                   	push   %edi
+ 224:	68 48 0b 00 00       	push   $0xb48
+ 229:	6a 02                	push   $0x2
+ 22b:	e8 f0 05 00 00       	call   820 <printf>
+    exit();
+ 230:	e8 48 03 00 00       	call   57d <exit>
+ 235:	66 90                	xchg   %ax,%ax
+ 237:	66 90                	xchg   %ax,%ax
+ 239:	66 90                	xchg   %ax,%ax
+ 23b:	66 90                	xchg   %ax,%ax
+ 23d:	66 90                	xchg   %ax,%ax
+ 23f:	90                   	nop
+
+00000240 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 240:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 241:	31 c0                	xor    %eax,%eax
+{
+ 243:	89 e5                	mov    %esp,%ebp
+ 245:	53                   	push   %ebx
+ 246:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 249:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 250:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 254:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 257:	83 c0 01             	add    $0x1,%eax
+ 25a:	84 d2                	test   %dl,%dl
+ 25c:	75 f2                	jne    250 <strcpy+0x10>
+    ;
+  return os;
+}
+ 25e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 261:	89 c8                	mov    %ecx,%eax
+ 263:	c9                   	leave
+ 264:	c3                   	ret
+ 265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	53                   	push   %ebx
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+ 277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 27a:	0f b6 02             	movzbl (%edx),%eax
+ 27d:	84 c0                	test   %al,%al
+ 27f:	75 17                	jne    298 <strcmp+0x28>
+ 281:	eb 3a                	jmp    2bd <strcmp+0x4d>
+ 283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 287:	90                   	nop
+ 288:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 28c:	83 c2 01             	add    $0x1,%edx
+ 28f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 292:	84 c0                	test   %al,%al
+ 294:	74 1a                	je     2b0 <strcmp+0x40>
+    p++, q++;
+ 296:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 298:	0f b6 19             	movzbl (%ecx),%ebx
+ 29b:	38 c3                	cmp    %al,%bl
+ 29d:	74 e9                	je     288 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 29f:	29 d8                	sub    %ebx,%eax
+}
+ 2a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a4:	c9                   	leave
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2b4:	31 c0                	xor    %eax,%eax
+ 2b6:	29 d8                	sub    %ebx,%eax
+}
+ 2b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2bb:	c9                   	leave
+ 2bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2c0:	31 c0                	xor    %eax,%eax
+ 2c2:	eb db                	jmp    29f <strcmp+0x2f>
+ 2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2d9:	74 15                	je     2f0 <strlen+0x20>
+ 2db:	31 c0                	xor    %eax,%eax
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2e0:	83 c0 01             	add    $0x1,%eax
+ 2e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2e7:	89 c1                	mov    %eax,%ecx
+ 2e9:	75 f5                	jne    2e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2eb:	89 c8                	mov    %ecx,%eax
+ 2ed:	5d                   	pop    %ebp
+ 2ee:	c3                   	ret
+ 2ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2f0:	31 c9                	xor    %ecx,%ecx
+}
+ 2f2:	5d                   	pop    %ebp
+ 2f3:	89 c8                	mov    %ecx,%eax
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 307:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 30a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30d:	89 d7                	mov    %edx,%edi
+ 30f:	fc                   	cld
+ 310:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 312:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 315:	89 d0                	mov    %edx,%eax
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 32a:	0f b6 10             	movzbl (%eax),%edx
+ 32d:	84 d2                	test   %dl,%dl
+ 32f:	75 12                	jne    343 <strchr+0x23>
+ 331:	eb 1d                	jmp    350 <strchr+0x30>
+ 333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 337:	90                   	nop
+ 338:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 33c:	83 c0 01             	add    $0x1,%eax
+ 33f:	84 d2                	test   %dl,%dl
+ 341:	74 0d                	je     350 <strchr+0x30>
+    if(*s == c)
+ 343:	38 d1                	cmp    %dl,%cl
+ 345:	75 f1                	jne    338 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 347:	5d                   	pop    %ebp
+ 348:	c3                   	ret
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 350:	31 c0                	xor    %eax,%eax
+}
+ 352:	5d                   	pop    %ebp
+ 353:	c3                   	ret
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 365:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 368:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 369:	31 db                	xor    %ebx,%ebx
+{
+ 36b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 36e:	eb 27                	jmp    397 <gets+0x37>
+    cc = read(0, &c, 1);
+ 370:	83 ec 04             	sub    $0x4,%esp
+ 373:	6a 01                	push   $0x1
+ 375:	56                   	push   %esi
+ 376:	6a 00                	push   $0x0
+ 378:	e8 2d 02 00 00       	call   5aa <read>
+    if(cc < 1)
+ 37d:	83 c4 10             	add    $0x10,%esp
+ 380:	85 c0                	test   %eax,%eax
+ 382:	7e 1d                	jle    3a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 384:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 388:	8b 55 08             	mov    0x8(%ebp),%edx
+ 38b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 38f:	3c 0a                	cmp    $0xa,%al
+ 391:	74 10                	je     3a3 <gets+0x43>
+ 393:	3c 0d                	cmp    $0xd,%al
+ 395:	74 0c                	je     3a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 397:	89 df                	mov    %ebx,%edi
+ 399:	83 c3 01             	add    $0x1,%ebx
+ 39c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 39f:	7c cf                	jl     370 <gets+0x10>
+ 3a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ad:	5b                   	pop    %ebx
+ 3ae:	5e                   	pop    %esi
+ 3af:	5f                   	pop    %edi
+ 3b0:	5d                   	pop    %ebp
+ 3b1:	c3                   	ret
+ 3b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	56                   	push   %esi
+ 3c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3c5:	83 ec 08             	sub    $0x8,%esp
+ 3c8:	6a 00                	push   $0x0
+ 3ca:	ff 75 08             	push   0x8(%ebp)
+ 3cd:	e8 23 02 00 00       	call   5f5 <open>
+  if(fd < 0)
+ 3d2:	83 c4 10             	add    $0x10,%esp
+ 3d5:	85 c0                	test   %eax,%eax
+ 3d7:	78 27                	js     400 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3d9:	83 ec 08             	sub    $0x8,%esp
+ 3dc:	ff 75 0c             	push   0xc(%ebp)
+ 3df:	89 c3                	mov    %eax,%ebx
+ 3e1:	50                   	push   %eax
+ 3e2:	e8 3b 02 00 00       	call   622 <fstat>
+  close(fd);
+ 3e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ec:	e8 d7 01 00 00       	call   5c8 <close>
+  return r;
+ 3f1:	83 c4 10             	add    $0x10,%esp
+}
+ 3f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3f7:	89 f0                	mov    %esi,%eax
+ 3f9:	5b                   	pop    %ebx
+ 3fa:	5e                   	pop    %esi
+ 3fb:	5d                   	pop    %ebp
+ 3fc:	c3                   	ret
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 400:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 405:	eb ed                	jmp    3f4 <stat+0x34>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 417:	0f be 02             	movsbl (%edx),%eax
+ 41a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 41d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 420:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 425:	77 1e                	ja     445 <atoi+0x35>
+ 427:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 430:	83 c2 01             	add    $0x1,%edx
+ 433:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 436:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 43a:	0f be 02             	movsbl (%edx),%eax
+ 43d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 440:	80 fb 09             	cmp    $0x9,%bl
+ 443:	76 eb                	jbe    430 <atoi+0x20>
+  return n;
+}
+ 445:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 448:	89 c8                	mov    %ecx,%eax
+ 44a:	c9                   	leave
+ 44b:	c3                   	ret
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	8b 45 10             	mov    0x10(%ebp),%eax
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 45e:	85 c0                	test   %eax,%eax
+ 460:	7e 13                	jle    475 <memmove+0x25>
+ 462:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 464:	89 d7                	mov    %edx,%edi
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 470:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 471:	39 f8                	cmp    %edi,%eax
+ 473:	75 fb                	jne    470 <memmove+0x20>
+  return vdst;
+}
+ 475:	5e                   	pop    %esi
+ 476:	89 d0                	mov    %edx,%eax
+ 478:	5f                   	pop    %edi
+ 479:	5d                   	pop    %ebp
+ 47a:	c3                   	ret
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	56                   	push   %esi
+ 484:	53                   	push   %ebx
+ 485:	8b 75 10             	mov    0x10(%ebp),%esi
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 48e:	85 f6                	test   %esi,%esi
+ 490:	74 2e                	je     4c0 <memcmp+0x40>
+ 492:	01 c6                	add    %eax,%esi
+ 494:	eb 14                	jmp    4aa <memcmp+0x2a>
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 4a0:	83 c0 01             	add    $0x1,%eax
+ 4a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 4a6:	39 f0                	cmp    %esi,%eax
+ 4a8:	74 16                	je     4c0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 4aa:	0f b6 0a             	movzbl (%edx),%ecx
+ 4ad:	0f b6 18             	movzbl (%eax),%ebx
+ 4b0:	38 d9                	cmp    %bl,%cl
+ 4b2:	74 ec                	je     4a0 <memcmp+0x20>
+      return *s1 - *s2;
+ 4b4:	0f b6 c1             	movzbl %cl,%eax
+ 4b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 4b9:	5b                   	pop    %ebx
+ 4ba:	5e                   	pop    %esi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4c0:	5b                   	pop    %ebx
+  return 0;
+ 4c1:	31 c0                	xor    %eax,%eax
+}
+ 4c3:	5e                   	pop    %esi
+ 4c4:	5d                   	pop    %ebp
+ 4c5:	c3                   	ret
+ 4c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004d0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 4d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 4e0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 4e2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 4e8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 4ee:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 4f4:	c3                   	ret
+ 4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 500:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 502:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 508:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 50e:	c3                   	ret
+ 50f:	90                   	nop
+
+00000510 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 518:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 51d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 523:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 529:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 52f:	89 c6                	mov    %eax,%esi
+ 531:	f7 f7                	div    %edi
+ 533:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 535:	f7 e3                	mul    %ebx
+ 537:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 53a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 53d:	89 d3                	mov    %edx,%ebx
+ 53f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 542:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 544:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 546:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 54c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 551:	f7 e6                	mul    %esi
+ 553:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 559:	29 d9                	sub    %ebx,%ecx
+ 55b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 561:	01 c1                	add    %eax,%ecx
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5f                   	pop    %edi
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+
+0000056e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 56e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 573:	89 e1                	mov    %esp,%ecx
+ 575:	ba 7c 05 00 00       	mov    $0x57c,%edx
+ 57a:	0f 34                	sysenter
+ 57c:	c3                   	ret
+
+0000057d <exit>:
+SYSCALL(exit)
+ 57d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 582:	89 e1                	mov    %esp,%ecx
+ 584:	ba 8b 05 00 00       	mov    $0x58b,%edx
+ 589:	0f 34                	sysenter
+ 58b:	c3                   	ret
+
+0000058c <wait>:
+SYSCALL(wait)
+ 58c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 591:	89 e1                	mov    %esp,%ecx
+ 593:	ba 9a 05 00 00       	mov    $0x59a,%edx
+ 598:	0f 34                	sysenter
+ 59a:	c3                   	ret
+
+0000059b <pipe>:
+SYSCALL(pipe)
+ 59b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a0:	89 e1                	mov    %esp,%ecx
+ 5a2:	ba a9 05 00 00       	mov    $0x5a9,%edx
+ 5a7:	0f 34                	sysenter
+ 5a9:	c3                   	ret
+
+000005aa <read>:
+SYSCALL(read)
+ 5aa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5af:	89 e1                	mov    %esp,%ecx
+ 5b1:	ba b8 05 00 00       	mov    $0x5b8,%edx
+ 5b6:	0f 34                	sysenter
+ 5b8:	c3                   	ret
+
+000005b9 <write>:
+SYSCALL(write)
+ 5b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5be:	89 e1                	mov    %esp,%ecx
+ 5c0:	ba c7 05 00 00       	mov    $0x5c7,%edx
+ 5c5:	0f 34                	sysenter
+ 5c7:	c3                   	ret
+
+000005c8 <close>:
+SYSCALL(close)
+ 5c8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5cd:	89 e1                	mov    %esp,%ecx
+ 5cf:	ba d6 05 00 00       	mov    $0x5d6,%edx
+ 5d4:	0f 34                	sysenter
+ 5d6:	c3                   	ret
+
+000005d7 <kill>:
+SYSCALL(kill)
+ 5d7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5dc:	89 e1                	mov    %esp,%ecx
+ 5de:	ba e5 05 00 00       	mov    $0x5e5,%edx
+ 5e3:	0f 34                	sysenter
+ 5e5:	c3                   	ret
+
+000005e6 <exec>:
+SYSCALL(exec)
+ 5e6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5eb:	89 e1                	mov    %esp,%ecx
+ 5ed:	ba f4 05 00 00       	mov    $0x5f4,%edx
+ 5f2:	0f 34                	sysenter
+ 5f4:	c3                   	ret
+
+000005f5 <open>:
+SYSCALL(open)
+ 5f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5fa:	89 e1                	mov    %esp,%ecx
+ 5fc:	ba 03 06 00 00       	mov    $0x603,%edx
+ 601:	0f 34                	sysenter
+ 603:	c3                   	ret
+
+00000604 <mknod>:
+SYSCALL(mknod)
+ 604:	b8 11 00 00 00       	mov    $0x11,%eax
+ 609:	89 e1                	mov    %esp,%ecx
+ 60b:	ba 12 06 00 00       	mov    $0x612,%edx
+ 610:	0f 34                	sysenter
+ 612:	c3                   	ret
+
+00000613 <unlink>:
+SYSCALL(unlink)
+ 613:	b8 12 00 00 00       	mov    $0x12,%eax
+ 618:	89 e1                	mov    %esp,%ecx
+ 61a:	ba 21 06 00 00       	mov    $0x621,%edx
+ 61f:	0f 34                	sysenter
+ 621:	c3                   	ret
+
+00000622 <fstat>:
+SYSCALL(fstat)
+ 622:	b8 08 00 00 00       	mov    $0x8,%eax
+ 627:	89 e1                	mov    %esp,%ecx
+ 629:	ba 30 06 00 00       	mov    $0x630,%edx
+ 62e:	0f 34                	sysenter
+ 630:	c3                   	ret
+
+00000631 <link>:
+SYSCALL(link)
+ 631:	b8 13 00 00 00       	mov    $0x13,%eax
+ 636:	89 e1                	mov    %esp,%ecx
+ 638:	ba 3f 06 00 00       	mov    $0x63f,%edx
+ 63d:	0f 34                	sysenter
+ 63f:	c3                   	ret
+
+00000640 <mkdir>:
+SYSCALL(mkdir)
+ 640:	b8 14 00 00 00       	mov    $0x14,%eax
+ 645:	89 e1                	mov    %esp,%ecx
+ 647:	ba 4e 06 00 00       	mov    $0x64e,%edx
+ 64c:	0f 34                	sysenter
+ 64e:	c3                   	ret
+
+0000064f <chdir>:
+SYSCALL(chdir)
+ 64f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 654:	89 e1                	mov    %esp,%ecx
+ 656:	ba 5d 06 00 00       	mov    $0x65d,%edx
+ 65b:	0f 34                	sysenter
+ 65d:	c3                   	ret
+
+0000065e <dup>:
+SYSCALL(dup)
+ 65e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 663:	89 e1                	mov    %esp,%ecx
+ 665:	ba 6c 06 00 00       	mov    $0x66c,%edx
+ 66a:	0f 34                	sysenter
+ 66c:	c3                   	ret
+
+0000066d <sbrk>:
+SYSCALL(sbrk)
+ 66d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 672:	89 e1                	mov    %esp,%ecx
+ 674:	ba 7b 06 00 00       	mov    $0x67b,%edx
+ 679:	0f 34                	sysenter
+ 67b:	c3                   	ret
+
+0000067c <sleep>:
+SYSCALL(sleep)
+ 67c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 681:	89 e1                	mov    %esp,%ecx
+ 683:	ba 8a 06 00 00       	mov    $0x68a,%edx
+ 688:	0f 34                	sysenter
+ 68a:	c3                   	ret
+
+0000068b <fallocate>:
+SYSCALL(fallocate)
+ 68b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 690:	89 e1                	mov    %esp,%ecx
+ 692:	ba 99 06 00 00       	mov    $0x699,%edx
+ 697:	0f 34                	sysenter
+ 699:	c3                   	ret
+
+0000069a <pread>:
+SYSCALL(pread)
+ 69a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 69f:	89 e1                	mov    %esp,%ecx
+ 6a1:	ba a8 06 00 00       	mov    $0x6a8,%edx
+ 6a6:	0f 34                	sysenter
+ 6a8:	c3                   	ret
+
+000006a9 <pwrite>:
+SYSCALL(pwrite)
+ 6a9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6ae:	89 e1                	mov    %esp,%ecx
+ 6b0:	ba b7 06 00 00       	mov    $0x6b7,%edx
+ 6b5:	0f 34                	sysenter
+ 6b7:	c3                   	ret
+
+000006b8 <readv>:
+SYSCALL(readv)
+ 6b8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6bd:	89 e1                	mov    %esp,%ecx
+ 6bf:	ba c6 06 00 00       	mov    $0x6c6,%edx
+ 6c4:	0f 34                	sysenter
+ 6c6:	c3                   	ret
+
+000006c7 <writev>:
+SYSCALL(writev)
+ 6c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6cc:	89 e1                	mov    %esp,%ecx
+ 6ce:	ba d5 06 00 00       	mov    $0x6d5,%edx
+ 6d3:	0f 34                	sysenter
+ 6d5:	c3                   	ret
+
+000006d6 <splice>:
+SYSCALL(splice)
+ 6d6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6db:	89 e1                	mov    %esp,%ecx
+ 6dd:	ba e4 06 00 00       	mov    $0x6e4,%edx
+ 6e2:	0f 34                	sysenter
+ 6e4:	c3                   	ret
+
+000006e5 <setpriority>:
+SYSCALL(setpriority)
+ 6e5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6ea:	89 e1                	mov    %esp,%ecx
+ 6ec:	ba f3 06 00 00       	mov    $0x6f3,%edx
+ 6f1:	0f 34                	sysenter
+ 6f3:	c3                   	ret
+
+000006f4 <setaffinity>:
+SYSCALL(setaffinity)
+ 6f4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6f9:	89 e1                	mov    %esp,%ecx
+ 6fb:	ba 02 07 00 00       	mov    $0x702,%edx
+ 700:	0f 34                	sysenter
+ 702:	c3                   	ret
+
+00000703 <lockstress>:
+SYSCALL(lockstress)
+ 703:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 708:	89 e1                	mov    %esp,%ecx
+ 70a:	ba 11 07 00 00       	mov    $0x711,%edx
+ 70f:	0f 34                	sysenter
+ 711:	c3                   	ret
+
+00000712 <lockstat>:
+SYSCALL(lockstat)
+ 712:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 717:	89 e1                	mov    %esp,%ecx
+ 719:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71e:	0f 34                	sysenter
+ 720:	c3                   	ret
+
+00000721 <profctl>:
+SYSCALL(profctl)
+ 721:	b8 20 00 00 00       	mov    $0x20,%eax
+ 726:	89 e1                	mov    %esp,%ecx
+ 728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+ 72d:	0f 34                	sysenter
+ 72f:	c3                   	ret
+
+00000730 <profread>:
+SYSCALL(profread)
+ 730:	b8 21 00 00 00       	mov    $0x21,%eax
+ 735:	89 e1                	mov    %esp,%ecx
+ 737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+ 73c:	0f 34                	sysenter
+ 73e:	c3                   	ret
+
+0000073f <getrusage>:
+SYSCALL(getrusage)
+ 73f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 744:	89 e1                	mov    %esp,%ecx
+ 746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+ 74b:	0f 34                	sysenter
+ 74d:	c3                   	ret
+
+0000074e <tracectl>:
+SYSCALL(tracectl)
+ 74e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 753:	89 e1                	mov    %esp,%ecx
+ 755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+ 75a:	0f 34                	sysenter
+ 75c:	c3                   	ret
+
+0000075d <traceread>:
+SYSCALL(traceread)
+ 75d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 762:	89 e1                	mov    %esp,%ecx
+ 764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+ 769:	0f 34                	sysenter
+ 76b:	c3                   	ret
+
+0000076c <nanosleep>:
+SYSCALL(nanosleep)
+ 76c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 771:	89 e1                	mov    %esp,%ecx
+ 773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+ 778:	0f 34                	sysenter
+ 77a:	c3                   	ret
+ 77b:	66 90                	xchg   %ax,%ax
+ 77d:	66 90                	xchg   %ax,%ax
+ 77f:	90                   	nop
+
+00000780 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 788:	89 d1                	mov    %edx,%ecx
+{
+ 78a:	83 ec 3c             	sub    $0x3c,%esp
+ 78d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 790:	85 d2                	test   %edx,%edx
+ 792:	0f 89 80 00 00 00    	jns    818 <printint+0x98>
+ 798:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79c:	74 7a                	je     818 <printint+0x98>
+    x = -xx;
+ 79e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7a8:	31 f6                	xor    %esi,%esi
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f7                	mov    %esi,%edi
+ 7b6:	f7 f3                	div    %ebx
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 1c 0c 00 00 	movzbl 0xc1c(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 da                	cmp    %ebx,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7d1:	85 c0                	test   %eax,%eax
+ 7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+ 7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7da:	89 f7                	mov    %esi,%edi
+ 7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7e2:	01 df                	add    %ebx,%edi
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7f4:	6a 01                	push   $0x1
+ 7f6:	50                   	push   %eax
+ 7f7:	56                   	push   %esi
+ 7f8:	e8 bc fd ff ff       	call   5b9 <write>
+  while(--i >= 0)
+ 7fd:	89 f8                	mov    %edi,%eax
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	83 ef 01             	sub    $0x1,%edi
+ 805:	39 d8                	cmp    %ebx,%eax
+ 807:	75 df                	jne    7e8 <printint+0x68>
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 818:	31 c0                	xor    %eax,%eax
+ 81a:	eb 89                	jmp    7a5 <printint+0x25>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 829:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 82c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 82f:	0f b6 1e             	movzbl (%esi),%ebx
+ 832:	83 c6 01             	add    $0x1,%esi
+ 835:	84 db                	test   %bl,%bl
+ 837:	74 67                	je     8a0 <printf+0x80>
+ 839:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 83c:	31 d2                	xor    %edx,%edx
+ 83e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 841:	eb 34                	jmp    877 <printf+0x57>
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+ 848:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 84b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 850:	83 f8 25             	cmp    $0x25,%eax
+ 853:	74 18                	je     86d <printf+0x4d>
+  write(fd, &c, 1);
+ 855:	83 ec 04             	sub    $0x4,%esp
+ 858:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 85b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85e:	6a 01                	push   $0x1
+ 860:	50                   	push   %eax
+ 861:	57                   	push   %edi
+ 862:	e8 52 fd ff ff       	call   5b9 <write>
+ 867:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 86a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 86d:	0f b6 1e             	movzbl (%esi),%ebx
+ 870:	83 c6 01             	add    $0x1,%esi
+ 873:	84 db                	test   %bl,%bl
+ 875:	74 29                	je     8a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 877:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 87a:	85 d2                	test   %edx,%edx
+ 87c:	74 ca                	je     848 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 87e:	83 fa 25             	cmp    $0x25,%edx
+ 881:	75 ea                	jne    86d <printf+0x4d>
+      if(c == 'd'){
+ 883:	83 f8 25             	cmp    $0x25,%eax
+ 886:	0f 84 24 01 00 00    	je     9b0 <printf+0x190>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 1c                	ja     8b0 <printf+0x90>
+ 894:	ff 24 85 c4 0b 00 00 	jmp    *0xbc4(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ba:	6a 01                	push   $0x1
+ 8bc:	52                   	push   %edx
+ 8bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8c0:	57                   	push   %edi
+ 8c1:	e8 f3 fc ff ff       	call   5b9 <write>
+ 8c6:	83 c4 0c             	add    $0xc,%esp
+ 8c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8cc:	6a 01                	push   $0x1
+ 8ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8d1:	52                   	push   %edx
+ 8d2:	57                   	push   %edi
+ 8d3:	e8 e1 fc ff ff       	call   5b9 <write>
+        putc(fd, c);
+ 8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8db:	31 d2                	xor    %edx,%edx
+ 8dd:	eb 8e                	jmp    86d <printf+0x4d>
+ 8df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 00                	push   $0x0
+ 8ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8f4:	e8 87 fe ff ff       	call   780 <printint>
+        ap++;
+ 8f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 67 ff ff ff       	jmp    86d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 913:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 91b:	85 db                	test   %ebx,%ebx
+ 91d:	0f 84 9d 00 00 00    	je     9c0 <printf+0x1a0>
+        while(*s != 0){
+ 923:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 926:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 928:	84 c0                	test   %al,%al
+ 92a:	0f 84 3d ff ff ff    	je     86d <printf+0x4d>
+ 930:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 933:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 936:	89 de                	mov    %ebx,%esi
+ 938:	89 d3                	mov    %edx,%ebx
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 946:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	53                   	push   %ebx
+ 94c:	57                   	push   %edi
+ 94d:	e8 67 fc ff ff       	call   5b9 <write>
+        while(*s != 0){
+ 952:	0f b6 06             	movzbl (%esi),%eax
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	84 c0                	test   %al,%al
+ 95a:	75 e4                	jne    940 <printf+0x120>
+      state = 0;
+ 95c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 07 ff ff ff       	jmp    86d <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	e9 6b ff ff ff       	jmp    8ef <printf+0xcf>
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 988:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 991:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 993:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 996:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	52                   	push   %edx
+ 99c:	57                   	push   %edi
+ 99d:	e8 17 fc ff ff       	call   5b9 <write>
+        ap++;
+ 9a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	e9 be fe ff ff       	jmp    86d <printf+0x4d>
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	e9 11 ff ff ff       	jmp    8d1 <printf+0xb1>
+ 9c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9c5:	bb bb 0b 00 00       	mov    $0xbbb,%ebx
+ 9ca:	e9 61 ff ff ff       	jmp    930 <printf+0x110>
+ 9cf:	90                   	nop
+
+000009d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	a1 98 0f 00 00       	mov    0xf98,%eax
+{
+ 9d6:	89 e5                	mov    %esp,%ebp
+ 9d8:	57                   	push   %edi
+ 9d9:	56                   	push   %esi
+ 9da:	53                   	push   %ebx
+ 9db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ec:	39 ca                	cmp    %ecx,%edx
+ 9ee:	73 30                	jae    a20 <free+0x50>
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 04                	jb     9f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f4:	39 c2                	cmp    %eax,%edx
+ 9f6:	72 f0                	jb     9e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9fe:	39 f8                	cmp    %edi,%eax
+ a00:	74 2e                	je     a30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a05:	8b 42 04             	mov    0x4(%edx),%eax
+ a08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a0b:	39 f1                	cmp    %esi,%ecx
+ a0d:	74 38                	je     a47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a11:	5b                   	pop    %ebx
+  freep = p;
+ a12:	89 15 98 0f 00 00    	mov    %edx,0xf98
+}
+ a18:	5e                   	pop    %esi
+ a19:	5f                   	pop    %edi
+ a1a:	5d                   	pop    %ebp
+ a1b:	c3                   	ret
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 d0                	jb     9f4 <free+0x24>
+ a24:	eb c2                	jmp    9e8 <free+0x18>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a30:	03 70 04             	add    0x4(%eax),%esi
+ a33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a36:	8b 02                	mov    (%edx),%eax
+ a38:	8b 00                	mov    (%eax),%eax
+ a3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a3d:	8b 42 04             	mov    0x4(%edx),%eax
+ a40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a43:	39 f1                	cmp    %esi,%ecx
+ a45:	75 c8                	jne    a0f <free+0x3f>
+    p->s.size += bp->s.size;
+ a47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a4a:	89 15 98 0f 00 00    	mov    %edx,0xf98
+    p->s.size += bp->s.size;
+ a50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a56:	89 0a                	mov    %ecx,(%edx)
+}
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a6c:	8b 15 98 0f 00 00    	mov    0xf98,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a72:	8d 78 07             	lea    0x7(%eax),%edi
+ a75:	c1 ef 03             	shr    $0x3,%edi
+ a78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a7b:	85 d2                	test   %edx,%edx
+ a7d:	0f 84 8d 00 00 00    	je     b10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a85:	8b 48 04             	mov    0x4(%eax),%ecx
+ a88:	39 f9                	cmp    %edi,%ecx
+ a8a:	73 64                	jae    af0 <malloc+0x90>
+  if(nu < 4096)
+ a8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a91:	39 df                	cmp    %ebx,%edi
+ a93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a9d:	eb 0a                	jmp    aa9 <malloc+0x49>
+ a9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa2:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa5:	39 f9                	cmp    %edi,%ecx
+ aa7:	73 47                	jae    af0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ aa9:	89 c2                	mov    %eax,%edx
+ aab:	39 05 98 0f 00 00    	cmp    %eax,0xf98
+ ab1:	75 ed                	jne    aa0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	56                   	push   %esi
+ ab7:	e8 b1 fb ff ff       	call   66d <sbrk>
+  if(p == (char*)-1)
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ac2:	74 1c                	je     ae0 <malloc+0x80>
+  hp->s.size = nu;
+ ac4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ac7:	83 ec 0c             	sub    $0xc,%esp
+ aca:	83 c0 08             	add    $0x8,%eax
+ acd:	50                   	push   %eax
+ ace:	e8 fd fe ff ff       	call   9d0 <free>
+  return freep;
+ ad3:	8b 15 98 0f 00 00    	mov    0xf98,%edx
+      if((p = morecore(nunits)) == 0)
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	85 d2                	test   %edx,%edx
+ ade:	75 c0                	jne    aa0 <malloc+0x40>
+        return 0;
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ae3:	31 c0                	xor    %eax,%eax
+}
+ ae5:	5b                   	pop    %ebx
+ ae6:	5e                   	pop    %esi
+ ae7:	5f                   	pop    %edi
+ ae8:	5d                   	pop    %ebp
+ ae9:	c3                   	ret
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ af0:	39 cf                	cmp    %ecx,%edi
+ af2:	74 4c                	je     b40 <malloc+0xe0>
+        p->s.size -= nunits;
+ af4:	29 f9                	sub    %edi,%ecx
+ af6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ af9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ afc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aff:	89 15 98 0f 00 00    	mov    %edx,0xf98
+}
+ b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b08:	83 c0 08             	add    $0x8,%eax
+}
+ b0b:	5b                   	pop    %ebx
+ b0c:	5e                   	pop    %esi
+ b0d:	5f                   	pop    %edi
+ b0e:	5d                   	pop    %ebp
+ b0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b10:	c7 05 98 0f 00 00 9c 	movl   $0xf9c,0xf98
+ b17:	0f 00 00 
+    base.s.size = 0;
+ b1a:	b8 9c 0f 00 00       	mov    $0xf9c,%eax
+    base.s.ptr = freep = prevp = &base;
+ b1f:	c7 05 9c 0f 00 00 9c 	movl   $0xf9c,0xf9c
+ b26:	0f 00 00 
+    base.s.size = 0;
+ b29:	c7 05 a0 0f 00 00 00 	movl   $0x0,0xfa0
+ b30:	00 00 00 
+    if(p->s.size >= nunits){
+ b33:	e9 54 ff ff ff       	jmp    a8c <malloc+0x2c>
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b40:	8b 08                	mov    (%eax),%ecx
+ b42:	89 0a                	mov    %ecx,(%edx)
+ b44:	eb b9                	jmp    aff <malloc+0x9f>
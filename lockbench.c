@@ -0,0 +1,73 @@
+// Kernel spin lock benchmark.
+// For each kind of lock and for 1 up to 8 CPUs, one process
+// pinned to each CPU hammers the same kernel lock through
+// lockstress(). Reports acquisitions per tick and the longest
+// any CPU waited for the lock.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define N 100000  // acquisitions per process
+
+char *kinds[] = { "tas", "ticket", "mcs" };  // LK_TAS, LK_TICKET, LK_MCS
+
+// Run nproc processes on CPUs 0..nproc-1 against lock kind.
+// Returns -1 if there aren't that many CPUs.
+int
+bench(int kind, int nproc)
+{
+  int fds[2], i, pid, start, ticks, w, maxw;
+
+  if(pipe(fds) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < nproc; i++){
+    if((pid = fork()) < 0){
+      printf(2, "lockbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(fds[0]);
+      w = -1;
+      if(setaffinity(getpid(), 1 << i) == 0)
+        w = lockstress(kind, N);
+      write(fds[1], &w, sizeof(w));
+      exit();
+    }
+  }
+  close(fds[1]);
+  maxw = 0;
+  for(i = 0; i < nproc; i++){
+    if(read(fds[0], &w, sizeof(w)) != sizeof(w) || w < 0)
+      maxw = -1;
+    else if(maxw >= 0 && w > maxw)
+      maxw = w;
+  }
+  close(fds[0]);
+  for(i = 0; i < nproc; i++)
+    wait();
+  ticks = uptime() - start;
+  if(ticks == 0)
+    ticks = 1;
+
+  if(maxw < 0)
+    return -1;
+  printf(1, "%s, %d cpus: %d acquires/tick, max wait %d cycles\n",
+         kinds[kind], nproc, nproc * N / ticks, maxw);
+  return 0;
+}
+
+int
+main(void)
+{
+  int kind, nproc;
+
+  for(kind = 0; kind < sizeof(kinds)/sizeof(kinds[0]); kind++)
+    for(nproc = 1; nproc <= 8; nproc++)
+      if(bench(kind, nproc) < 0)
+        break;
+  exit();
+}
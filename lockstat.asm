@@ -0,0 +1,1741 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	31 c0                	xor    %eax,%eax
+   9:	ff 71 fc             	push   -0x4(%ecx)
+   c:	55                   	push   %ebp
+   d:	89 e5                	mov    %esp,%ebp
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  int n, pid;
+
+  if(argc > 1 && strcmp(argv[1], "-r") != 0){
+  11:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  14:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1 && strcmp(argv[1], "-r") != 0){
+  17:	7f 25                	jg     3e <main+0x3e>
+      exit();
+    }
+    wait();
+  }
+
+  n = lockstat(st, NLOCKSTAT, argc > 1 && strcmp(argv[1], "-r") == 0);
+  19:	83 ec 04             	sub    $0x4,%esp
+  1c:	50                   	push   %eax
+  1d:	6a 40                	push   $0x40
+  1f:	68 e0 10 00 00       	push   $0x10e0
+  24:	e8 f9 07 00 00       	call   822 <lockstat>
+  if(n < 0){
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	85 c0                	test   %eax,%eax
+  2e:	78 66                	js     96 <main+0x96>
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  report(n);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  33:	50                   	push   %eax
+  34:	e8 a7 00 00 00       	call   e0 <report>
+  exit();
+  39:	e8 4f 06 00 00       	call   68d <exit>
+  if(argc > 1 && strcmp(argv[1], "-r") != 0){
+  3e:	50                   	push   %eax
+  3f:	50                   	push   %eax
+  40:	68 bc 0c 00 00       	push   $0xcbc
+  45:	ff 73 04             	push   0x4(%ebx)
+  48:	e8 33 03 00 00       	call   380 <strcmp>
+  4d:	83 c4 10             	add    $0x10,%esp
+  50:	85 c0                	test   %eax,%eax
+  52:	74 5a                	je     ae <main+0xae>
+    lockstat(st, 0, 1);
+  54:	50                   	push   %eax
+  55:	6a 01                	push   $0x1
+  57:	6a 00                	push   $0x0
+  59:	68 e0 10 00 00       	push   $0x10e0
+  5e:	e8 bf 07 00 00       	call   822 <lockstat>
+    if((pid = fork()) < 0){
+  63:	e8 16 06 00 00       	call   67e <fork>
+  68:	83 c4 10             	add    $0x10,%esp
+  6b:	85 c0                	test   %eax,%eax
+  6d:	78 5e                	js     cd <main+0xcd>
+    if(pid == 0){
+  6f:	75 38                	jne    a9 <main+0xa9>
+      exec(argv[1], argv + 1);
+  71:	8d 43 04             	lea    0x4(%ebx),%eax
+  74:	51                   	push   %ecx
+  75:	51                   	push   %ecx
+  76:	50                   	push   %eax
+  77:	ff 73 04             	push   0x4(%ebx)
+  7a:	e8 77 06 00 00       	call   6f6 <exec>
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+  7f:	83 c4 0c             	add    $0xc,%esp
+  82:	ff 73 04             	push   0x4(%ebx)
+  85:	68 d6 0c 00 00       	push   $0xcd6
+  8a:	6a 02                	push   $0x2
+  8c:	e8 9f 08 00 00       	call   930 <printf>
+      exit();
+  91:	e8 f7 05 00 00       	call   68d <exit>
+    printf(2, "lockstat: failed\n");
+  96:	50                   	push   %eax
+  97:	50                   	push   %eax
+  98:	68 f0 0c 00 00       	push   $0xcf0
+  9d:	6a 02                	push   $0x2
+  9f:	e8 8c 08 00 00       	call   930 <printf>
+    exit();
+  a4:	e8 e4 05 00 00       	call   68d <exit>
+    wait();
+  a9:	e8 ee 05 00 00       	call   69c <wait>
+  n = lockstat(st, NLOCKSTAT, argc > 1 && strcmp(argv[1], "-r") == 0);
+  ae:	52                   	push   %edx
+  af:	52                   	push   %edx
+  b0:	68 bc 0c 00 00       	push   $0xcbc
+  b5:	ff 73 04             	push   0x4(%ebx)
+  b8:	e8 c3 02 00 00       	call   380 <strcmp>
+  bd:	83 c4 10             	add    $0x10,%esp
+  c0:	85 c0                	test   %eax,%eax
+  c2:	0f 94 c0             	sete   %al
+  c5:	0f b6 c0             	movzbl %al,%eax
+  c8:	e9 4c ff ff ff       	jmp    19 <main+0x19>
+      printf(2, "lockstat: fork failed\n");
+  cd:	53                   	push   %ebx
+  ce:	53                   	push   %ebx
+  cf:	68 bf 0c 00 00       	push   $0xcbf
+  d4:	6a 02                	push   $0x2
+  d6:	e8 55 08 00 00       	call   930 <printf>
+      exit();
+  db:	e8 ad 05 00 00       	call   68d <exit>
+
+000000e0 <report>:
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	57                   	push   %edi
+  e4:	56                   	push   %esi
+  e5:	53                   	push   %ebx
+  e6:	83 ec 5c             	sub    $0x5c,%esp
+  for(i = 1; i < n; i++){
+  e9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  ed:	0f 8e 32 02 00 00    	jle    325 <report+0x245>
+  f3:	bf 20 11 00 00       	mov    $0x1120,%edi
+  f8:	be 01 00 00 00       	mov    $0x1,%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+    t = st[i];
+ 100:	8b 07                	mov    (%edi),%eax
+ 102:	8b 4f 20             	mov    0x20(%edi),%ecx
+ 105:	89 f2                	mov    %esi,%edx
+ 107:	89 45 a8             	mov    %eax,-0x58(%ebp)
+ 10a:	8b 47 04             	mov    0x4(%edi),%eax
+ 10d:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+ 110:	89 45 ac             	mov    %eax,-0x54(%ebp)
+ 113:	8b 47 08             	mov    0x8(%edi),%eax
+ 116:	89 45 b0             	mov    %eax,-0x50(%ebp)
+ 119:	8b 47 0c             	mov    0xc(%edi),%eax
+ 11c:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+ 11f:	8b 47 10             	mov    0x10(%edi),%eax
+ 122:	89 45 b8             	mov    %eax,-0x48(%ebp)
+ 125:	8b 47 14             	mov    0x14(%edi),%eax
+ 128:	89 45 bc             	mov    %eax,-0x44(%ebp)
+ 12b:	8b 47 18             	mov    0x18(%edi),%eax
+ 12e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 131:	8b 47 1c             	mov    0x1c(%edi),%eax
+ 134:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 137:	8b 47 24             	mov    0x24(%edi),%eax
+ 13a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+ 13d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 140:	8b 47 28             	mov    0x28(%edi),%eax
+ 143:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 146:	8b 47 2c             	mov    0x2c(%edi),%eax
+ 149:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 14c:	8b 47 30             	mov    0x30(%edi),%eax
+ 14f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 152:	8b 47 34             	mov    0x34(%edi),%eax
+ 155:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 158:	8b 47 38             	mov    0x38(%edi),%eax
+ 15b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 15e:	8b 47 3c             	mov    0x3c(%edi),%eax
+ 161:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 164:	89 f8                	mov    %edi,%eax
+ 166:	89 75 a0             	mov    %esi,-0x60(%ebp)
+ 169:	89 ce                	mov    %ecx,%esi
+ 16b:	89 7d 9c             	mov    %edi,-0x64(%ebp)
+ 16e:	eb 68                	jmp    1d8 <report+0xf8>
+      st[j] = st[j-1];
+ 170:	8b 58 c0             	mov    -0x40(%eax),%ebx
+ 173:	89 48 24             	mov    %ecx,0x24(%eax)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 176:	83 e8 40             	sub    $0x40,%eax
+      st[j] = st[j-1];
+ 179:	8b 48 28             	mov    0x28(%eax),%ecx
+ 17c:	89 58 40             	mov    %ebx,0x40(%eax)
+ 17f:	8b 58 04             	mov    0x4(%eax),%ebx
+ 182:	89 48 68             	mov    %ecx,0x68(%eax)
+ 185:	8b 48 2c             	mov    0x2c(%eax),%ecx
+ 188:	89 58 44             	mov    %ebx,0x44(%eax)
+ 18b:	8b 58 08             	mov    0x8(%eax),%ebx
+ 18e:	89 48 6c             	mov    %ecx,0x6c(%eax)
+ 191:	8b 48 30             	mov    0x30(%eax),%ecx
+ 194:	89 58 48             	mov    %ebx,0x48(%eax)
+ 197:	8b 58 0c             	mov    0xc(%eax),%ebx
+ 19a:	89 48 70             	mov    %ecx,0x70(%eax)
+ 19d:	8b 48 34             	mov    0x34(%eax),%ecx
+ 1a0:	89 58 4c             	mov    %ebx,0x4c(%eax)
+ 1a3:	8b 58 10             	mov    0x10(%eax),%ebx
+ 1a6:	89 48 74             	mov    %ecx,0x74(%eax)
+ 1a9:	8b 48 38             	mov    0x38(%eax),%ecx
+ 1ac:	89 58 50             	mov    %ebx,0x50(%eax)
+ 1af:	8b 58 14             	mov    0x14(%eax),%ebx
+ 1b2:	89 48 78             	mov    %ecx,0x78(%eax)
+ 1b5:	8b 48 3c             	mov    0x3c(%eax),%ecx
+ 1b8:	89 58 54             	mov    %ebx,0x54(%eax)
+ 1bb:	8b 58 18             	mov    0x18(%eax),%ebx
+ 1be:	89 48 7c             	mov    %ecx,0x7c(%eax)
+ 1c1:	89 58 58             	mov    %ebx,0x58(%eax)
+ 1c4:	8b 58 1c             	mov    0x1c(%eax),%ebx
+ 1c7:	89 58 5c             	mov    %ebx,0x5c(%eax)
+ 1ca:	8b 58 20             	mov    0x20(%eax),%ebx
+ 1cd:	89 58 60             	mov    %ebx,0x60(%eax)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 1d0:	85 d2                	test   %edx,%edx
+ 1d2:	0f 84 40 01 00 00    	je     318 <report+0x238>
+ 1d8:	8b 48 e4             	mov    -0x1c(%eax),%ecx
+ 1db:	39 70 e0             	cmp    %esi,-0x20(%eax)
+ 1de:	89 d3                	mov    %edx,%ebx
+ 1e0:	8d 52 ff             	lea    -0x1(%edx),%edx
+ 1e3:	89 cf                	mov    %ecx,%edi
+ 1e5:	1b 7d a4             	sbb    -0x5c(%ebp),%edi
+ 1e8:	72 86                	jb     170 <report+0x90>
+ 1ea:	8b 75 a0             	mov    -0x60(%ebp),%esi
+ 1ed:	8b 7d 9c             	mov    -0x64(%ebp),%edi
+    st[j] = t;
+ 1f0:	8b 55 a8             	mov    -0x58(%ebp),%edx
+ 1f3:	c1 e3 06             	shl    $0x6,%ebx
+  for(i = 1; i < n; i++){
+ 1f6:	83 c6 01             	add    $0x1,%esi
+ 1f9:	83 c7 40             	add    $0x40,%edi
+    st[j] = t;
+ 1fc:	89 93 e0 10 00 00    	mov    %edx,0x10e0(%ebx)
+ 202:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 205:	89 93 e4 10 00 00    	mov    %edx,0x10e4(%ebx)
+ 20b:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 20e:	89 93 e8 10 00 00    	mov    %edx,0x10e8(%ebx)
+ 214:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 217:	89 93 ec 10 00 00    	mov    %edx,0x10ec(%ebx)
+ 21d:	8b 55 b8             	mov    -0x48(%ebp),%edx
+ 220:	89 93 f0 10 00 00    	mov    %edx,0x10f0(%ebx)
+ 226:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ 229:	89 93 f4 10 00 00    	mov    %edx,0x10f4(%ebx)
+ 22f:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ 232:	89 93 f8 10 00 00    	mov    %edx,0x10f8(%ebx)
+ 238:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 23b:	89 93 fc 10 00 00    	mov    %edx,0x10fc(%ebx)
+ 241:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 244:	89 93 00 11 00 00    	mov    %edx,0x1100(%ebx)
+ 24a:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 24d:	89 93 04 11 00 00    	mov    %edx,0x1104(%ebx)
+ 253:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 256:	89 93 08 11 00 00    	mov    %edx,0x1108(%ebx)
+ 25c:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 25f:	89 93 0c 11 00 00    	mov    %edx,0x110c(%ebx)
+ 265:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 268:	89 93 10 11 00 00    	mov    %edx,0x1110(%ebx)
+ 26e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 271:	89 93 14 11 00 00    	mov    %edx,0x1114(%ebx)
+ 277:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 27a:	89 93 18 11 00 00    	mov    %edx,0x1118(%ebx)
+ 280:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 283:	89 93 1c 11 00 00    	mov    %edx,0x111c(%ebx)
+  for(i = 1; i < n; i++){
+ 289:	39 75 08             	cmp    %esi,0x8(%ebp)
+ 28c:	0f 85 6e fe ff ff    	jne    100 <report+0x20>
+  printf(1, "name acquires contended spun slept spin maxspin hold maxhold (Kcycles)\n");
+ 292:	83 ec 08             	sub    $0x8,%esp
+ 295:	68 58 0c 00 00       	push   $0xc58
+ 29a:	6a 01                	push   $0x1
+ 29c:	e8 8f 06 00 00       	call   930 <printf>
+ 2a1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 2a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 2a7:	bb e0 10 00 00       	mov    $0x10e0,%ebx
+ 2ac:	31 f6                	xor    %esi,%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    if(st[i].acquires == 0)
+ 2b0:	8b 4b 10             	mov    0x10(%ebx),%ecx
+ 2b3:	85 c9                	test   %ecx,%ecx
+ 2b5:	74 49                	je     300 <report+0x220>
+           (uint)(st[i].hold >> 10), (uint)(st[i].maxhold >> 10));
+ 2b7:	8b 53 3c             	mov    0x3c(%ebx),%edx
+ 2ba:	8b 43 38             	mov    0x38(%ebx),%eax
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+ 2bd:	83 ec 04             	sub    $0x4,%esp
+           (uint)(st[i].hold >> 10), (uint)(st[i].maxhold >> 10));
+ 2c0:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+ 2c4:	50                   	push   %eax
+           (uint)(st[i].hold >> 10), (uint)(st[i].maxhold >> 10));
+ 2c5:	8b 53 34             	mov    0x34(%ebx),%edx
+ 2c8:	8b 43 30             	mov    0x30(%ebx),%eax
+ 2cb:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+ 2cf:	50                   	push   %eax
+           (uint)(st[i].spin >> 10), (uint)(st[i].maxspin >> 10),
+ 2d0:	8b 53 2c             	mov    0x2c(%ebx),%edx
+ 2d3:	8b 43 28             	mov    0x28(%ebx),%eax
+ 2d6:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+ 2da:	50                   	push   %eax
+           (uint)(st[i].spin >> 10), (uint)(st[i].maxspin >> 10),
+ 2db:	8b 43 20             	mov    0x20(%ebx),%eax
+ 2de:	8b 53 24             	mov    0x24(%ebx),%edx
+ 2e1:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+ 2e5:	50                   	push   %eax
+ 2e6:	ff 73 1c             	push   0x1c(%ebx)
+ 2e9:	ff 73 18             	push   0x18(%ebx)
+ 2ec:	ff 73 14             	push   0x14(%ebx)
+ 2ef:	51                   	push   %ecx
+ 2f0:	53                   	push   %ebx
+ 2f1:	68 a0 0c 00 00       	push   $0xca0
+ 2f6:	6a 01                	push   $0x1
+ 2f8:	e8 33 06 00 00       	call   930 <printf>
+ 2fd:	83 c4 30             	add    $0x30,%esp
+  for(i = 0; i < n; i++){
+ 300:	83 c6 01             	add    $0x1,%esi
+ 303:	83 c3 40             	add    $0x40,%ebx
+ 306:	39 f7                	cmp    %esi,%edi
+ 308:	75 a6                	jne    2b0 <report+0x1d0>
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 318:	8b 75 a0             	mov    -0x60(%ebp),%esi
+ 31b:	8b 7d 9c             	mov    -0x64(%ebp),%edi
+ 31e:	31 db                	xor    %ebx,%ebx
+ 320:	e9 cb fe ff ff       	jmp    1f0 <report+0x110>
+  printf(1, "name acquires contended spun slept spin maxspin hold maxhold (Kcycles)\n");
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	68 58 0c 00 00       	push   $0xc58
+ 32d:	6a 01                	push   $0x1
+ 32f:	e8 fc 05 00 00       	call   930 <printf>
+  for(i = 0; i < n; i++){
+ 334:	83 c4 10             	add    $0x10,%esp
+ 337:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 33b:	0f 84 63 ff ff ff    	je     2a4 <report+0x1c4>
+ 341:	eb c7                	jmp    30a <report+0x22a>
+ 343:	66 90                	xchg   %ax,%ax
+ 345:	66 90                	xchg   %ax,%ax
+ 347:	66 90                	xchg   %ax,%ax
+ 349:	66 90                	xchg   %ax,%ax
+ 34b:	66 90                	xchg   %ax,%ax
+ 34d:	66 90                	xchg   %ax,%ax
+ 34f:	90                   	nop
+
+00000350 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 350:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 351:	31 c0                	xor    %eax,%eax
+{
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	53                   	push   %ebx
+ 356:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 359:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 360:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 364:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 367:	83 c0 01             	add    $0x1,%eax
+ 36a:	84 d2                	test   %dl,%dl
+ 36c:	75 f2                	jne    360 <strcpy+0x10>
+    ;
+  return os;
+}
+ 36e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 371:	89 c8                	mov    %ecx,%eax
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+ 375:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+ 387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 38a:	0f b6 02             	movzbl (%edx),%eax
+ 38d:	84 c0                	test   %al,%al
+ 38f:	75 17                	jne    3a8 <strcmp+0x28>
+ 391:	eb 3a                	jmp    3cd <strcmp+0x4d>
+ 393:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 397:	90                   	nop
+ 398:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 39c:	83 c2 01             	add    $0x1,%edx
+ 39f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3a2:	84 c0                	test   %al,%al
+ 3a4:	74 1a                	je     3c0 <strcmp+0x40>
+    p++, q++;
+ 3a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3ab:	38 c3                	cmp    %al,%bl
+ 3ad:	74 e9                	je     398 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3af:	29 d8                	sub    %ebx,%eax
+}
+ 3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3c4:	31 c0                	xor    %eax,%eax
+ 3c6:	29 d8                	sub    %ebx,%eax
+}
+ 3c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cb:	c9                   	leave
+ 3cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3d0:	31 c0                	xor    %eax,%eax
+ 3d2:	eb db                	jmp    3af <strcmp+0x2f>
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3e9:	74 15                	je     400 <strlen+0x20>
+ 3eb:	31 c0                	xor    %eax,%eax
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	83 c0 01             	add    $0x1,%eax
+ 3f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3f7:	89 c1                	mov    %eax,%ecx
+ 3f9:	75 f5                	jne    3f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3fb:	89 c8                	mov    %ecx,%eax
+ 3fd:	5d                   	pop    %ebp
+ 3fe:	c3                   	ret
+ 3ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 400:	31 c9                	xor    %ecx,%ecx
+}
+ 402:	5d                   	pop    %ebp
+ 403:	89 c8                	mov    %ecx,%eax
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000410 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 417:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 41a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41d:	89 d7                	mov    %edx,%edi
+ 41f:	fc                   	cld
+ 420:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 422:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 425:	89 d0                	mov    %edx,%eax
+ 427:	c9                   	leave
+ 428:	c3                   	ret
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 43a:	0f b6 10             	movzbl (%eax),%edx
+ 43d:	84 d2                	test   %dl,%dl
+ 43f:	75 12                	jne    453 <strchr+0x23>
+ 441:	eb 1d                	jmp    460 <strchr+0x30>
+ 443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 447:	90                   	nop
+ 448:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 44c:	83 c0 01             	add    $0x1,%eax
+ 44f:	84 d2                	test   %dl,%dl
+ 451:	74 0d                	je     460 <strchr+0x30>
+    if(*s == c)
+ 453:	38 d1                	cmp    %dl,%cl
+ 455:	75 f1                	jne    448 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 457:	5d                   	pop    %ebp
+ 458:	c3                   	ret
+ 459:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 460:	31 c0                	xor    %eax,%eax
+}
+ 462:	5d                   	pop    %ebp
+ 463:	c3                   	ret
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 475:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 478:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 479:	31 db                	xor    %ebx,%ebx
+{
+ 47b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 47e:	eb 27                	jmp    4a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 01                	push   $0x1
+ 485:	56                   	push   %esi
+ 486:	6a 00                	push   $0x0
+ 488:	e8 2d 02 00 00       	call   6ba <read>
+    if(cc < 1)
+ 48d:	83 c4 10             	add    $0x10,%esp
+ 490:	85 c0                	test   %eax,%eax
+ 492:	7e 1d                	jle    4b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 494:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 49f:	3c 0a                	cmp    $0xa,%al
+ 4a1:	74 10                	je     4b3 <gets+0x43>
+ 4a3:	3c 0d                	cmp    $0xd,%al
+ 4a5:	74 0c                	je     4b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4a7:	89 df                	mov    %ebx,%edi
+ 4a9:	83 c3 01             	add    $0x1,%ebx
+ 4ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4af:	7c cf                	jl     480 <gets+0x10>
+ 4b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bd:	5b                   	pop    %ebx
+ 4be:	5e                   	pop    %esi
+ 4bf:	5f                   	pop    %edi
+ 4c0:	5d                   	pop    %ebp
+ 4c1:	c3                   	ret
+ 4c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	56                   	push   %esi
+ 4d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d5:	83 ec 08             	sub    $0x8,%esp
+ 4d8:	6a 00                	push   $0x0
+ 4da:	ff 75 08             	push   0x8(%ebp)
+ 4dd:	e8 23 02 00 00       	call   705 <open>
+  if(fd < 0)
+ 4e2:	83 c4 10             	add    $0x10,%esp
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	78 27                	js     510 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4e9:	83 ec 08             	sub    $0x8,%esp
+ 4ec:	ff 75 0c             	push   0xc(%ebp)
+ 4ef:	89 c3                	mov    %eax,%ebx
+ 4f1:	50                   	push   %eax
+ 4f2:	e8 3b 02 00 00       	call   732 <fstat>
+  close(fd);
+ 4f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4fc:	e8 d7 01 00 00       	call   6d8 <close>
+  return r;
+ 501:	83 c4 10             	add    $0x10,%esp
+}
+ 504:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 507:	89 f0                	mov    %esi,%eax
+ 509:	5b                   	pop    %ebx
+ 50a:	5e                   	pop    %esi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 510:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 515:	eb ed                	jmp    504 <stat+0x34>
+ 517:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	53                   	push   %ebx
+ 524:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 527:	0f be 02             	movsbl (%edx),%eax
+ 52a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 52d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 530:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 535:	77 1e                	ja     555 <atoi+0x35>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 540:	83 c2 01             	add    $0x1,%edx
+ 543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 54a:	0f be 02             	movsbl (%edx),%eax
+ 54d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 550:	80 fb 09             	cmp    $0x9,%bl
+ 553:	76 eb                	jbe    540 <atoi+0x20>
+  return n;
+}
+ 555:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 558:	89 c8                	mov    %ecx,%eax
+ 55a:	c9                   	leave
+ 55b:	c3                   	ret
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	8b 45 10             	mov    0x10(%ebp),%eax
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 56e:	85 c0                	test   %eax,%eax
+ 570:	7e 13                	jle    585 <memmove+0x25>
+ 572:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 580:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 581:	39 f8                	cmp    %edi,%eax
+ 583:	75 fb                	jne    580 <memmove+0x20>
+  return vdst;
+}
+ 585:	5e                   	pop    %esi
+ 586:	89 d0                	mov    %edx,%eax
+ 588:	5f                   	pop    %edi
+ 589:	5d                   	pop    %ebp
+ 58a:	c3                   	ret
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+
+00000590 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	56                   	push   %esi
+ 594:	53                   	push   %ebx
+ 595:	8b 75 10             	mov    0x10(%ebp),%esi
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 59e:	85 f6                	test   %esi,%esi
+ 5a0:	74 2e                	je     5d0 <memcmp+0x40>
+ 5a2:	01 c6                	add    %eax,%esi
+ 5a4:	eb 14                	jmp    5ba <memcmp+0x2a>
+ 5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 5b0:	83 c0 01             	add    $0x1,%eax
+ 5b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 5b6:	39 f0                	cmp    %esi,%eax
+ 5b8:	74 16                	je     5d0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 5ba:	0f b6 0a             	movzbl (%edx),%ecx
+ 5bd:	0f b6 18             	movzbl (%eax),%ebx
+ 5c0:	38 d9                	cmp    %bl,%cl
+ 5c2:	74 ec                	je     5b0 <memcmp+0x20>
+      return *s1 - *s2;
+ 5c4:	0f b6 c1             	movzbl %cl,%eax
+ 5c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 5c9:	5b                   	pop    %ebx
+ 5ca:	5e                   	pop    %esi
+ 5cb:	5d                   	pop    %ebp
+ 5cc:	c3                   	ret
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5d0:	5b                   	pop    %ebx
+  return 0;
+ 5d1:	31 c0                	xor    %eax,%eax
+}
+ 5d3:	5e                   	pop    %esi
+ 5d4:	5d                   	pop    %ebp
+ 5d5:	c3                   	ret
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 5e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 5f0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 5f2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 5f8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 5fe:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 604:	c3                   	ret
+ 605:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 610:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 612:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 618:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 61e:	c3                   	ret
+ 61f:	90                   	nop
+
+00000620 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 628:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 62d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 633:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 639:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 63f:	89 c6                	mov    %eax,%esi
+ 641:	f7 f7                	div    %edi
+ 643:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 645:	f7 e3                	mul    %ebx
+ 647:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 64a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 64d:	89 d3                	mov    %edx,%ebx
+ 64f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 652:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 654:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 656:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 65c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 661:	f7 e6                	mul    %esi
+ 663:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 669:	29 d9                	sub    %ebx,%ecx
+ 66b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 671:	01 c1                	add    %eax,%ecx
+ 673:	8b 45 08             	mov    0x8(%ebp),%eax
+ 676:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 679:	5b                   	pop    %ebx
+ 67a:	5e                   	pop    %esi
+ 67b:	5f                   	pop    %edi
+ 67c:	5d                   	pop    %ebp
+ 67d:	c3                   	ret
+
+0000067e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 67e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 683:	89 e1                	mov    %esp,%ecx
+ 685:	ba 8c 06 00 00       	mov    $0x68c,%edx
+ 68a:	0f 34                	sysenter
+ 68c:	c3                   	ret
+
+0000068d <exit>:
+SYSCALL(exit)
+ 68d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 692:	89 e1                	mov    %esp,%ecx
+ 694:	ba 9b 06 00 00       	mov    $0x69b,%edx
+ 699:	0f 34                	sysenter
+ 69b:	c3                   	ret
+
+0000069c <wait>:
+SYSCALL(wait)
+ 69c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6a1:	89 e1                	mov    %esp,%ecx
+ 6a3:	ba aa 06 00 00       	mov    $0x6aa,%edx
+ 6a8:	0f 34                	sysenter
+ 6aa:	c3                   	ret
+
+000006ab <pipe>:
+SYSCALL(pipe)
+ 6ab:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6b0:	89 e1                	mov    %esp,%ecx
+ 6b2:	ba b9 06 00 00       	mov    $0x6b9,%edx
+ 6b7:	0f 34                	sysenter
+ 6b9:	c3                   	ret
+
+000006ba <read>:
+SYSCALL(read)
+ 6ba:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6bf:	89 e1                	mov    %esp,%ecx
+ 6c1:	ba c8 06 00 00       	mov    $0x6c8,%edx
+ 6c6:	0f 34                	sysenter
+ 6c8:	c3                   	ret
+
+000006c9 <write>:
+SYSCALL(write)
+ 6c9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6ce:	89 e1                	mov    %esp,%ecx
+ 6d0:	ba d7 06 00 00       	mov    $0x6d7,%edx
+ 6d5:	0f 34                	sysenter
+ 6d7:	c3                   	ret
+
+000006d8 <close>:
+SYSCALL(close)
+ 6d8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6dd:	89 e1                	mov    %esp,%ecx
+ 6df:	ba e6 06 00 00       	mov    $0x6e6,%edx
+ 6e4:	0f 34                	sysenter
+ 6e6:	c3                   	ret
+
+000006e7 <kill>:
+SYSCALL(kill)
+ 6e7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6ec:	89 e1                	mov    %esp,%ecx
+ 6ee:	ba f5 06 00 00       	mov    $0x6f5,%edx
+ 6f3:	0f 34                	sysenter
+ 6f5:	c3                   	ret
+
+000006f6 <exec>:
+SYSCALL(exec)
+ 6f6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6fb:	89 e1                	mov    %esp,%ecx
+ 6fd:	ba 04 07 00 00       	mov    $0x704,%edx
+ 702:	0f 34                	sysenter
+ 704:	c3                   	ret
+
+00000705 <open>:
+SYSCALL(open)
+ 705:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 70a:	89 e1                	mov    %esp,%ecx
+ 70c:	ba 13 07 00 00       	mov    $0x713,%edx
+ 711:	0f 34                	sysenter
+ 713:	c3                   	ret
+
+00000714 <mknod>:
+SYSCALL(mknod)
+ 714:	b8 11 00 00 00       	mov    $0x11,%eax
+ 719:	89 e1                	mov    %esp,%ecx
+ 71b:	ba 22 07 00 00       	mov    $0x722,%edx
+ 720:	0f 34                	sysenter
+ 722:	c3                   	ret
+
+00000723 <unlink>:
+SYSCALL(unlink)
+ 723:	b8 12 00 00 00       	mov    $0x12,%eax
+ 728:	89 e1                	mov    %esp,%ecx
+ 72a:	ba 31 07 00 00       	mov    $0x731,%edx
+ 72f:	0f 34                	sysenter
+ 731:	c3                   	ret
+
+00000732 <fstat>:
+SYSCALL(fstat)
+ 732:	b8 08 00 00 00       	mov    $0x8,%eax
+ 737:	89 e1                	mov    %esp,%ecx
+ 739:	ba 40 07 00 00       	mov    $0x740,%edx
+ 73e:	0f 34                	sysenter
+ 740:	c3                   	ret
+
+00000741 <link>:
+SYSCALL(link)
+ 741:	b8 13 00 00 00       	mov    $0x13,%eax
+ 746:	89 e1                	mov    %esp,%ecx
+ 748:	ba 4f 07 00 00       	mov    $0x74f,%edx
+ 74d:	0f 34                	sysenter
+ 74f:	c3                   	ret
+
+00000750 <mkdir>:
+SYSCALL(mkdir)
+ 750:	b8 14 00 00 00       	mov    $0x14,%eax
+ 755:	89 e1                	mov    %esp,%ecx
+ 757:	ba 5e 07 00 00       	mov    $0x75e,%edx
+ 75c:	0f 34                	sysenter
+ 75e:	c3                   	ret
+
+0000075f <chdir>:
+SYSCALL(chdir)
+ 75f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 764:	89 e1                	mov    %esp,%ecx
+ 766:	ba 6d 07 00 00       	mov    $0x76d,%edx
+ 76b:	0f 34                	sysenter
+ 76d:	c3                   	ret
+
+0000076e <dup>:
+SYSCALL(dup)
+ 76e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 773:	89 e1                	mov    %esp,%ecx
+ 775:	ba 7c 07 00 00       	mov    $0x77c,%edx
+ 77a:	0f 34                	sysenter
+ 77c:	c3                   	ret
+
+0000077d <sbrk>:
+SYSCALL(sbrk)
+ 77d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 782:	89 e1                	mov    %esp,%ecx
+ 784:	ba 8b 07 00 00       	mov    $0x78b,%edx
+ 789:	0f 34                	sysenter
+ 78b:	c3                   	ret
+
+0000078c <sleep>:
+SYSCALL(sleep)
+ 78c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 791:	89 e1                	mov    %esp,%ecx
+ 793:	ba 9a 07 00 00       	mov    $0x79a,%edx
+ 798:	0f 34                	sysenter
+ 79a:	c3                   	ret
+
+0000079b <fallocate>:
+SYSCALL(fallocate)
+ 79b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7a0:	89 e1                	mov    %esp,%ecx
+ 7a2:	ba a9 07 00 00       	mov    $0x7a9,%edx
+ 7a7:	0f 34                	sysenter
+ 7a9:	c3                   	ret
+
+000007aa <pread>:
+SYSCALL(pread)
+ 7aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7af:	89 e1                	mov    %esp,%ecx
+ 7b1:	ba b8 07 00 00       	mov    $0x7b8,%edx
+ 7b6:	0f 34                	sysenter
+ 7b8:	c3                   	ret
+
+000007b9 <pwrite>:
+SYSCALL(pwrite)
+ 7b9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7be:	89 e1                	mov    %esp,%ecx
+ 7c0:	ba c7 07 00 00       	mov    $0x7c7,%edx
+ 7c5:	0f 34                	sysenter
+ 7c7:	c3                   	ret
+
+000007c8 <readv>:
+SYSCALL(readv)
+ 7c8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7cd:	89 e1                	mov    %esp,%ecx
+ 7cf:	ba d6 07 00 00       	mov    $0x7d6,%edx
+ 7d4:	0f 34                	sysenter
+ 7d6:	c3                   	ret
+
+000007d7 <writev>:
+SYSCALL(writev)
+ 7d7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7dc:	89 e1                	mov    %esp,%ecx
+ 7de:	ba e5 07 00 00       	mov    $0x7e5,%edx
+ 7e3:	0f 34                	sysenter
+ 7e5:	c3                   	ret
+
+000007e6 <splice>:
+SYSCALL(splice)
+ 7e6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7eb:	89 e1                	mov    %esp,%ecx
+ 7ed:	ba f4 07 00 00       	mov    $0x7f4,%edx
+ 7f2:	0f 34                	sysenter
+ 7f4:	c3                   	ret
+
+000007f5 <setpriority>:
+SYSCALL(setpriority)
+ 7f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7fa:	89 e1                	mov    %esp,%ecx
+ 7fc:	ba 03 08 00 00       	mov    $0x803,%edx
+ 801:	0f 34                	sysenter
+ 803:	c3                   	ret
+
+00000804 <setaffinity>:
+SYSCALL(setaffinity)
+ 804:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 809:	89 e1                	mov    %esp,%ecx
+ 80b:	ba 12 08 00 00       	mov    $0x812,%edx
+ 810:	0f 34                	sysenter
+ 812:	c3                   	ret
+
+00000813 <lockstress>:
+SYSCALL(lockstress)
+ 813:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 818:	89 e1                	mov    %esp,%ecx
+ 81a:	ba 21 08 00 00       	mov    $0x821,%edx
+ 81f:	0f 34                	sysenter
+ 821:	c3                   	ret
+
+00000822 <lockstat>:
+SYSCALL(lockstat)
+ 822:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 827:	89 e1                	mov    %esp,%ecx
+ 829:	ba 30 08 00 00       	mov    $0x830,%edx
+ 82e:	0f 34                	sysenter
+ 830:	c3                   	ret
+
+00000831 <profctl>:
+SYSCALL(profctl)
+ 831:	b8 20 00 00 00       	mov    $0x20,%eax
+ 836:	89 e1                	mov    %esp,%ecx
+ 838:	ba 3f 08 00 00       	mov    $0x83f,%edx
+ 83d:	0f 34                	sysenter
+ 83f:	c3                   	ret
+
+00000840 <profread>:
+SYSCALL(profread)
+ 840:	b8 21 00 00 00       	mov    $0x21,%eax
+ 845:	89 e1                	mov    %esp,%ecx
+ 847:	ba 4e 08 00 00       	mov    $0x84e,%edx
+ 84c:	0f 34                	sysenter
+ 84e:	c3                   	ret
+
+0000084f <getrusage>:
+SYSCALL(getrusage)
+ 84f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 854:	89 e1                	mov    %esp,%ecx
+ 856:	ba 5d 08 00 00       	mov    $0x85d,%edx
+ 85b:	0f 34                	sysenter
+ 85d:	c3                   	ret
+
+0000085e <tracectl>:
+SYSCALL(tracectl)
+ 85e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 863:	89 e1                	mov    %esp,%ecx
+ 865:	ba 6c 08 00 00       	mov    $0x86c,%edx
+ 86a:	0f 34                	sysenter
+ 86c:	c3                   	ret
+
+0000086d <traceread>:
+SYSCALL(traceread)
+ 86d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 872:	89 e1                	mov    %esp,%ecx
+ 874:	ba 7b 08 00 00       	mov    $0x87b,%edx
+ 879:	0f 34                	sysenter
+ 87b:	c3                   	ret
+
+0000087c <nanosleep>:
+SYSCALL(nanosleep)
+ 87c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 881:	89 e1                	mov    %esp,%ecx
+ 883:	ba 8a 08 00 00       	mov    $0x88a,%edx
+ 888:	0f 34                	sysenter
+ 88a:	c3                   	ret
+ 88b:	66 90                	xchg   %ax,%ax
+ 88d:	66 90                	xchg   %ax,%ax
+ 88f:	90                   	nop
+
+00000890 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 890:	55                   	push   %ebp
+ 891:	89 e5                	mov    %esp,%ebp
+ 893:	57                   	push   %edi
+ 894:	56                   	push   %esi
+ 895:	53                   	push   %ebx
+ 896:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 898:	89 d1                	mov    %edx,%ecx
+{
+ 89a:	83 ec 3c             	sub    $0x3c,%esp
+ 89d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8a0:	85 d2                	test   %edx,%edx
+ 8a2:	0f 89 80 00 00 00    	jns    928 <printint+0x98>
+ 8a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ac:	74 7a                	je     928 <printint+0x98>
+    x = -xx;
+ 8ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8b8:	31 f6                	xor    %esi,%esi
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8c0:	89 c8                	mov    %ecx,%eax
+ 8c2:	31 d2                	xor    %edx,%edx
+ 8c4:	89 f7                	mov    %esi,%edi
+ 8c6:	f7 f3                	div    %ebx
+ 8c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8cb:	0f b6 92 64 0d 00 00 	movzbl 0xd64(%edx),%edx
+ 8d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8d6:	89 ca                	mov    %ecx,%edx
+ 8d8:	89 c1                	mov    %eax,%ecx
+ 8da:	39 da                	cmp    %ebx,%edx
+ 8dc:	73 e2                	jae    8c0 <printint+0x30>
+  if(neg)
+ 8de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8e1:	85 c0                	test   %eax,%eax
+ 8e3:	74 07                	je     8ec <printint+0x5c>
+    buf[i++] = '-';
+ 8e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8ea:	89 f7                	mov    %esi,%edi
+ 8ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8f2:	01 df                	add    %ebx,%edi
+ 8f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8fb:	83 ec 04             	sub    $0x4,%esp
+ 8fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 901:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 904:	6a 01                	push   $0x1
+ 906:	50                   	push   %eax
+ 907:	56                   	push   %esi
+ 908:	e8 bc fd ff ff       	call   6c9 <write>
+  while(--i >= 0)
+ 90d:	89 f8                	mov    %edi,%eax
+ 90f:	83 c4 10             	add    $0x10,%esp
+ 912:	83 ef 01             	sub    $0x1,%edi
+ 915:	39 d8                	cmp    %ebx,%eax
+ 917:	75 df                	jne    8f8 <printint+0x68>
+}
+ 919:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 91c:	5b                   	pop    %ebx
+ 91d:	5e                   	pop    %esi
+ 91e:	5f                   	pop    %edi
+ 91f:	5d                   	pop    %ebp
+ 920:	c3                   	ret
+ 921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 928:	31 c0                	xor    %eax,%eax
+ 92a:	eb 89                	jmp    8b5 <printint+0x25>
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000930 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 939:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 93c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 93f:	0f b6 1e             	movzbl (%esi),%ebx
+ 942:	83 c6 01             	add    $0x1,%esi
+ 945:	84 db                	test   %bl,%bl
+ 947:	74 67                	je     9b0 <printf+0x80>
+ 949:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 94c:	31 d2                	xor    %edx,%edx
+ 94e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 951:	eb 34                	jmp    987 <printf+0x57>
+ 953:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 957:	90                   	nop
+ 958:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 95b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 960:	83 f8 25             	cmp    $0x25,%eax
+ 963:	74 18                	je     97d <printf+0x4d>
+  write(fd, &c, 1);
+ 965:	83 ec 04             	sub    $0x4,%esp
+ 968:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 96b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 96e:	6a 01                	push   $0x1
+ 970:	50                   	push   %eax
+ 971:	57                   	push   %edi
+ 972:	e8 52 fd ff ff       	call   6c9 <write>
+ 977:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 97a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 97d:	0f b6 1e             	movzbl (%esi),%ebx
+ 980:	83 c6 01             	add    $0x1,%esi
+ 983:	84 db                	test   %bl,%bl
+ 985:	74 29                	je     9b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 987:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 98a:	85 d2                	test   %edx,%edx
+ 98c:	74 ca                	je     958 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 98e:	83 fa 25             	cmp    $0x25,%edx
+ 991:	75 ea                	jne    97d <printf+0x4d>
+      if(c == 'd'){
+ 993:	83 f8 25             	cmp    $0x25,%eax
+ 996:	0f 84 24 01 00 00    	je     ac0 <printf+0x190>
+ 99c:	83 e8 63             	sub    $0x63,%eax
+ 99f:	83 f8 15             	cmp    $0x15,%eax
+ 9a2:	77 1c                	ja     9c0 <printf+0x90>
+ 9a4:	ff 24 85 0c 0d 00 00 	jmp    *0xd0c(,%eax,4)
+ 9ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9b3:	5b                   	pop    %ebx
+ 9b4:	5e                   	pop    %esi
+ 9b5:	5f                   	pop    %edi
+ 9b6:	5d                   	pop    %ebp
+ 9b7:	c3                   	ret
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ca:	6a 01                	push   $0x1
+ 9cc:	52                   	push   %edx
+ 9cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9d0:	57                   	push   %edi
+ 9d1:	e8 f3 fc ff ff       	call   6c9 <write>
+ 9d6:	83 c4 0c             	add    $0xc,%esp
+ 9d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9dc:	6a 01                	push   $0x1
+ 9de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9e1:	52                   	push   %edx
+ 9e2:	57                   	push   %edi
+ 9e3:	e8 e1 fc ff ff       	call   6c9 <write>
+        putc(fd, c);
+ 9e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9eb:	31 d2                	xor    %edx,%edx
+ 9ed:	eb 8e                	jmp    97d <printf+0x4d>
+ 9ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9fb:	8b 13                	mov    (%ebx),%edx
+ 9fd:	6a 00                	push   $0x0
+ 9ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ a01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a04:	e8 87 fe ff ff       	call   890 <printint>
+        ap++;
+ a09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a0f:	31 d2                	xor    %edx,%edx
+ a11:	e9 67 ff ff ff       	jmp    97d <printf+0x4d>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a25:	83 c0 04             	add    $0x4,%eax
+ a28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a2b:	85 db                	test   %ebx,%ebx
+ a2d:	0f 84 9d 00 00 00    	je     ad0 <printf+0x1a0>
+        while(*s != 0){
+ a33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a38:	84 c0                	test   %al,%al
+ a3a:	0f 84 3d ff ff ff    	je     97d <printf+0x4d>
+ a40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a46:	89 de                	mov    %ebx,%esi
+ a48:	89 d3                	mov    %edx,%ebx
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a50:	83 ec 04             	sub    $0x4,%esp
+ a53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a59:	6a 01                	push   $0x1
+ a5b:	53                   	push   %ebx
+ a5c:	57                   	push   %edi
+ a5d:	e8 67 fc ff ff       	call   6c9 <write>
+        while(*s != 0){
+ a62:	0f b6 06             	movzbl (%esi),%eax
+ a65:	83 c4 10             	add    $0x10,%esp
+ a68:	84 c0                	test   %al,%al
+ a6a:	75 e4                	jne    a50 <printf+0x120>
+      state = 0;
+ a6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a6f:	31 d2                	xor    %edx,%edx
+ a71:	e9 07 ff ff ff       	jmp    97d <printf+0x4d>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a8b:	8b 13                	mov    (%ebx),%edx
+ a8d:	6a 01                	push   $0x1
+ a8f:	e9 6b ff ff ff       	jmp    9ff <printf+0xcf>
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ aa1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ aa3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ aa6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ aa9:	6a 01                	push   $0x1
+ aab:	52                   	push   %edx
+ aac:	57                   	push   %edi
+ aad:	e8 17 fc ff ff       	call   6c9 <write>
+        ap++;
+ ab2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ab5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ab8:	31 d2                	xor    %edx,%edx
+ aba:	e9 be fe ff ff       	jmp    97d <printf+0x4d>
+ abf:	90                   	nop
+  write(fd, &c, 1);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ac6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ac9:	6a 01                	push   $0x1
+ acb:	e9 11 ff ff ff       	jmp    9e1 <printf+0xb1>
+ ad0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ad5:	bb 02 0d 00 00       	mov    $0xd02,%ebx
+ ada:	e9 61 ff ff ff       	jmp    a40 <printf+0x110>
+ adf:	90                   	nop
+
+00000ae0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ae0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae1:	a1 e0 20 00 00       	mov    0x20e0,%eax
+{
+ ae6:	89 e5                	mov    %esp,%ebp
+ ae8:	57                   	push   %edi
+ ae9:	56                   	push   %esi
+ aea:	53                   	push   %ebx
+ aeb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ aee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ af8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ afa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ afc:	39 ca                	cmp    %ecx,%edx
+ afe:	73 30                	jae    b30 <free+0x50>
+ b00:	39 c1                	cmp    %eax,%ecx
+ b02:	72 04                	jb     b08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b04:	39 c2                	cmp    %eax,%edx
+ b06:	72 f0                	jb     af8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b0e:	39 f8                	cmp    %edi,%eax
+ b10:	74 2e                	je     b40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b15:	8b 42 04             	mov    0x4(%edx),%eax
+ b18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b1b:	39 f1                	cmp    %esi,%ecx
+ b1d:	74 38                	je     b57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b21:	5b                   	pop    %ebx
+  freep = p;
+ b22:	89 15 e0 20 00 00    	mov    %edx,0x20e0
+}
+ b28:	5e                   	pop    %esi
+ b29:	5f                   	pop    %edi
+ b2a:	5d                   	pop    %ebp
+ b2b:	c3                   	ret
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b30:	39 c1                	cmp    %eax,%ecx
+ b32:	72 d0                	jb     b04 <free+0x24>
+ b34:	eb c2                	jmp    af8 <free+0x18>
+ b36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b40:	03 70 04             	add    0x4(%eax),%esi
+ b43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b46:	8b 02                	mov    (%edx),%eax
+ b48:	8b 00                	mov    (%eax),%eax
+ b4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b4d:	8b 42 04             	mov    0x4(%edx),%eax
+ b50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b53:	39 f1                	cmp    %esi,%ecx
+ b55:	75 c8                	jne    b1f <free+0x3f>
+    p->s.size += bp->s.size;
+ b57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b5a:	89 15 e0 20 00 00    	mov    %edx,0x20e0
+    p->s.size += bp->s.size;
+ b60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b66:	89 0a                	mov    %ecx,(%edx)
+}
+ b68:	5b                   	pop    %ebx
+ b69:	5e                   	pop    %esi
+ b6a:	5f                   	pop    %edi
+ b6b:	5d                   	pop    %ebp
+ b6c:	c3                   	ret
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+ b76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b7c:	8b 15 e0 20 00 00    	mov    0x20e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b82:	8d 78 07             	lea    0x7(%eax),%edi
+ b85:	c1 ef 03             	shr    $0x3,%edi
+ b88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b8b:	85 d2                	test   %edx,%edx
+ b8d:	0f 84 8d 00 00 00    	je     c20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b95:	8b 48 04             	mov    0x4(%eax),%ecx
+ b98:	39 f9                	cmp    %edi,%ecx
+ b9a:	73 64                	jae    c00 <malloc+0x90>
+  if(nu < 4096)
+ b9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ba1:	39 df                	cmp    %ebx,%edi
+ ba3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ba6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bad:	eb 0a                	jmp    bb9 <malloc+0x49>
+ baf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bb2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bb5:	39 f9                	cmp    %edi,%ecx
+ bb7:	73 47                	jae    c00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bb9:	89 c2                	mov    %eax,%edx
+ bbb:	39 05 e0 20 00 00    	cmp    %eax,0x20e0
+ bc1:	75 ed                	jne    bb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	56                   	push   %esi
+ bc7:	e8 b1 fb ff ff       	call   77d <sbrk>
+  if(p == (char*)-1)
+ bcc:	83 c4 10             	add    $0x10,%esp
+ bcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bd2:	74 1c                	je     bf0 <malloc+0x80>
+  hp->s.size = nu;
+ bd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bd7:	83 ec 0c             	sub    $0xc,%esp
+ bda:	83 c0 08             	add    $0x8,%eax
+ bdd:	50                   	push   %eax
+ bde:	e8 fd fe ff ff       	call   ae0 <free>
+  return freep;
+ be3:	8b 15 e0 20 00 00    	mov    0x20e0,%edx
+      if((p = morecore(nunits)) == 0)
+ be9:	83 c4 10             	add    $0x10,%esp
+ bec:	85 d2                	test   %edx,%edx
+ bee:	75 c0                	jne    bb0 <malloc+0x40>
+        return 0;
+  }
+}
+ bf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bf3:	31 c0                	xor    %eax,%eax
+}
+ bf5:	5b                   	pop    %ebx
+ bf6:	5e                   	pop    %esi
+ bf7:	5f                   	pop    %edi
+ bf8:	5d                   	pop    %ebp
+ bf9:	c3                   	ret
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c00:	39 cf                	cmp    %ecx,%edi
+ c02:	74 4c                	je     c50 <malloc+0xe0>
+        p->s.size -= nunits;
+ c04:	29 f9                	sub    %edi,%ecx
+ c06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c0f:	89 15 e0 20 00 00    	mov    %edx,0x20e0
+}
+ c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c18:	83 c0 08             	add    $0x8,%eax
+}
+ c1b:	5b                   	pop    %ebx
+ c1c:	5e                   	pop    %esi
+ c1d:	5f                   	pop    %edi
+ c1e:	5d                   	pop    %ebp
+ c1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c20:	c7 05 e0 20 00 00 e4 	movl   $0x20e4,0x20e0
+ c27:	20 00 00 
+    base.s.size = 0;
+ c2a:	b8 e4 20 00 00       	mov    $0x20e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c2f:	c7 05 e4 20 00 00 e4 	movl   $0x20e4,0x20e4
+ c36:	20 00 00 
+    base.s.size = 0;
+ c39:	c7 05 e8 20 00 00 00 	movl   $0x0,0x20e8
+ c40:	00 00 00 
+    if(p->s.size >= nunits){
+ c43:	e9 54 ff ff ff       	jmp    b9c <malloc+0x2c>
+ c48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c50:	8b 08                	mov    (%eax),%ecx
+ c52:	89 0a                	mov    %ecx,(%edx)
+ c54:	eb b9                	jmp    c0f <malloc+0x9f>
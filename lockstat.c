@@ -0,0 +1,66 @@
+// Print a report of spin and sleep lock contention, worst first.
+//   lockstat          counts since boot or the last reset
+//   lockstat -r       the same, then reset the counts
+//   lockstat cmd ...  counts while cmd runs
+// Cycle counts are shown in units of 1024 cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "lockstat.h"
+
+struct lockstat st[NLOCKSTAT];
+
+void
+report(int n)
+{
+  struct lockstat t;
+  int i, j;
+
+  // Sort by total time spent waiting, largest first.
+  for(i = 1; i < n; i++){
+    t = st[i];
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+      st[j] = st[j-1];
+    st[j] = t;
+  }
+
+  printf(1, "name acquires contended spun slept spin maxspin hold maxhold (Kcycles)\n");
+  for(i = 0; i < n; i++){
+    if(st[i].acquires == 0)
+      continue;
+    printf(1, "%s %d %d %d %d %d %d %d %d\n", st[i].name,
+           st[i].acquires, st[i].contended, st[i].spun, st[i].slept,
+           (uint)(st[i].spin >> 10), (uint)(st[i].maxspin >> 10),
+           (uint)(st[i].hold >> 10), (uint)(st[i].maxhold >> 10));
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, pid;
+
+  if(argc > 1 && strcmp(argv[1], "-r") != 0){
+    lockstat(st, 0, 1);
+    if((pid = fork()) < 0){
+      printf(2, "lockstat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv + 1);
+      printf(2, "lockstat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+
+  n = lockstat(st, NLOCKSTAT, argc > 1 && strcmp(argv[1], "-r") == 0);
+  if(n < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+  report(n);
+  exit();
+}
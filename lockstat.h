@@ -0,0 +1,15 @@
+// Contention statistics for all the spin locks, or all the sleep
+// locks, with one name, as returned by the lockstat system call.
+// Times are in cycles. A sleep lock's waits include time spent
+// asleep, and only sleep locks count spun and slept.
+struct lockstat {
+  char name[16];     // Name the locks were given by initlock()
+  uint acquires;     // Times acquired
+  uint contended;    // Times acquire() had to wait
+  uint spun;         // Waits that ended while still spinning
+  uint slept;        // Waits that had to sleep
+  uint64 spin;       // Total time spent waiting
+  uint64 maxspin;    // Longest wait
+  uint64 hold;       // Total time held
+  uint64 maxhold;    // Longest hold
+};
@@ -0,0 +1,1737 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 3b 06 00 00       	call   67d <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 90 0c 00 00       	push   $0xc90
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 29 06 00 00       	call   67d <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 b4 10 00 00       	push   $0x10b4
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb b4 10 00 00       	mov    $0x10b4,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 b4 10 00 00       	add    $0x10b4,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 de 05 00 00       	call   6f5 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 ee 05 00 00       	call   722 <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 6d 05 00 00       	call   6c8 <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 70 0c 00 00       	push   $0xc70
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 7c 07 00 00       	call   920 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 98 04 00 00       	call   6aa <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 70 0c 00 00       	push   $0xc70
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 72 06 00 00       	call   920 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 48 0c 00 00       	push   $0xc48
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 50 06 00 00       	call   920 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 7d 0c 00 00       	push   $0xc7d
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 31 06 00 00       	call   920 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 5c 0c 00 00       	push   $0xc5c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 10 06 00 00       	call   920 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 b0 03 00 00       	call   6c8 <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 5c 0c 00 00       	push   $0xc5c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 e8 05 00 00       	call   920 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 2d 02 00 00       	call   6aa <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 23 02 00 00       	call   6f5 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 3b 02 00 00       	call   722 <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 d7 01 00 00       	call   6c8 <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	56                   	push   %esi
+ 584:	53                   	push   %ebx
+ 585:	8b 75 10             	mov    0x10(%ebp),%esi
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 58e:	85 f6                	test   %esi,%esi
+ 590:	74 2e                	je     5c0 <memcmp+0x40>
+ 592:	01 c6                	add    %eax,%esi
+ 594:	eb 14                	jmp    5aa <memcmp+0x2a>
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 5a0:	83 c0 01             	add    $0x1,%eax
+ 5a3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 5a6:	39 f0                	cmp    %esi,%eax
+ 5a8:	74 16                	je     5c0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 5aa:	0f b6 0a             	movzbl (%edx),%ecx
+ 5ad:	0f b6 18             	movzbl (%eax),%ebx
+ 5b0:	38 d9                	cmp    %bl,%cl
+ 5b2:	74 ec                	je     5a0 <memcmp+0x20>
+      return *s1 - *s2;
+ 5b4:	0f b6 c1             	movzbl %cl,%eax
+ 5b7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 5b9:	5b                   	pop    %ebx
+ 5ba:	5e                   	pop    %esi
+ 5bb:	5d                   	pop    %ebp
+ 5bc:	c3                   	ret
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 5c0:	5b                   	pop    %ebx
+  return 0;
+ 5c1:	31 c0                	xor    %eax,%eax
+}
+ 5c3:	5e                   	pop    %esi
+ 5c4:	5d                   	pop    %ebp
+ 5c5:	c3                   	ret
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 5d0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 5d5:	c3                   	ret
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 5e0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 5e2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 5e8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 5ee:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 5f4:	c3                   	ret
+ 5f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 600:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 602:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 608:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 60e:	c3                   	ret
+ 60f:	90                   	nop
+
+00000610 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 618:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 61d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 623:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 629:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 62f:	89 c6                	mov    %eax,%esi
+ 631:	f7 f7                	div    %edi
+ 633:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 635:	f7 e3                	mul    %ebx
+ 637:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 63a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 63d:	89 d3                	mov    %edx,%ebx
+ 63f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 642:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 644:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 646:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 64c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 651:	f7 e6                	mul    %esi
+ 653:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 659:	29 d9                	sub    %ebx,%ecx
+ 65b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 661:	01 c1                	add    %eax,%ecx
+ 663:	8b 45 08             	mov    0x8(%ebp),%eax
+ 666:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 669:	5b                   	pop    %ebx
+ 66a:	5e                   	pop    %esi
+ 66b:	5f                   	pop    %edi
+ 66c:	5d                   	pop    %ebp
+ 66d:	c3                   	ret
+
+0000066e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 66e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 673:	89 e1                	mov    %esp,%ecx
+ 675:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 67a:	0f 34                	sysenter
+ 67c:	c3                   	ret
+
+0000067d <exit>:
+SYSCALL(exit)
+ 67d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 682:	89 e1                	mov    %esp,%ecx
+ 684:	ba 8b 06 00 00       	mov    $0x68b,%edx
+ 689:	0f 34                	sysenter
+ 68b:	c3                   	ret
+
+0000068c <wait>:
+SYSCALL(wait)
+ 68c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 691:	89 e1                	mov    %esp,%ecx
+ 693:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 698:	0f 34                	sysenter
+ 69a:	c3                   	ret
+
+0000069b <pipe>:
+SYSCALL(pipe)
+ 69b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a0:	89 e1                	mov    %esp,%ecx
+ 6a2:	ba a9 06 00 00       	mov    $0x6a9,%edx
+ 6a7:	0f 34                	sysenter
+ 6a9:	c3                   	ret
+
+000006aa <read>:
+SYSCALL(read)
+ 6aa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6af:	89 e1                	mov    %esp,%ecx
+ 6b1:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b6:	0f 34                	sysenter
+ 6b8:	c3                   	ret
+
+000006b9 <write>:
+SYSCALL(write)
+ 6b9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6be:	89 e1                	mov    %esp,%ecx
+ 6c0:	ba c7 06 00 00       	mov    $0x6c7,%edx
+ 6c5:	0f 34                	sysenter
+ 6c7:	c3                   	ret
+
+000006c8 <close>:
+SYSCALL(close)
+ 6c8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6cd:	89 e1                	mov    %esp,%ecx
+ 6cf:	ba d6 06 00 00       	mov    $0x6d6,%edx
+ 6d4:	0f 34                	sysenter
+ 6d6:	c3                   	ret
+
+000006d7 <kill>:
+SYSCALL(kill)
+ 6d7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6dc:	89 e1                	mov    %esp,%ecx
+ 6de:	ba e5 06 00 00       	mov    $0x6e5,%edx
+ 6e3:	0f 34                	sysenter
+ 6e5:	c3                   	ret
+
+000006e6 <exec>:
+SYSCALL(exec)
+ 6e6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6eb:	89 e1                	mov    %esp,%ecx
+ 6ed:	ba f4 06 00 00       	mov    $0x6f4,%edx
+ 6f2:	0f 34                	sysenter
+ 6f4:	c3                   	ret
+
+000006f5 <open>:
+SYSCALL(open)
+ 6f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6fa:	89 e1                	mov    %esp,%ecx
+ 6fc:	ba 03 07 00 00       	mov    $0x703,%edx
+ 701:	0f 34                	sysenter
+ 703:	c3                   	ret
+
+00000704 <mknod>:
+SYSCALL(mknod)
+ 704:	b8 11 00 00 00       	mov    $0x11,%eax
+ 709:	89 e1                	mov    %esp,%ecx
+ 70b:	ba 12 07 00 00       	mov    $0x712,%edx
+ 710:	0f 34                	sysenter
+ 712:	c3                   	ret
+
+00000713 <unlink>:
+SYSCALL(unlink)
+ 713:	b8 12 00 00 00       	mov    $0x12,%eax
+ 718:	89 e1                	mov    %esp,%ecx
+ 71a:	ba 21 07 00 00       	mov    $0x721,%edx
+ 71f:	0f 34                	sysenter
+ 721:	c3                   	ret
+
+00000722 <fstat>:
+SYSCALL(fstat)
+ 722:	b8 08 00 00 00       	mov    $0x8,%eax
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 30 07 00 00       	mov    $0x730,%edx
+ 72e:	0f 34                	sysenter
+ 730:	c3                   	ret
+
+00000731 <link>:
+SYSCALL(link)
+ 731:	b8 13 00 00 00       	mov    $0x13,%eax
+ 736:	89 e1                	mov    %esp,%ecx
+ 738:	ba 3f 07 00 00       	mov    $0x73f,%edx
+ 73d:	0f 34                	sysenter
+ 73f:	c3                   	ret
+
+00000740 <mkdir>:
+SYSCALL(mkdir)
+ 740:	b8 14 00 00 00       	mov    $0x14,%eax
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 4e 07 00 00       	mov    $0x74e,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	c3                   	ret
+
+0000074f <chdir>:
+SYSCALL(chdir)
+ 74f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 754:	89 e1                	mov    %esp,%ecx
+ 756:	ba 5d 07 00 00       	mov    $0x75d,%edx
+ 75b:	0f 34                	sysenter
+ 75d:	c3                   	ret
+
+0000075e <dup>:
+SYSCALL(dup)
+ 75e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 763:	89 e1                	mov    %esp,%ecx
+ 765:	ba 6c 07 00 00       	mov    $0x76c,%edx
+ 76a:	0f 34                	sysenter
+ 76c:	c3                   	ret
+
+0000076d <sbrk>:
+SYSCALL(sbrk)
+ 76d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 772:	89 e1                	mov    %esp,%ecx
+ 774:	ba 7b 07 00 00       	mov    $0x77b,%edx
+ 779:	0f 34                	sysenter
+ 77b:	c3                   	ret
+
+0000077c <sleep>:
+SYSCALL(sleep)
+ 77c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 781:	89 e1                	mov    %esp,%ecx
+ 783:	ba 8a 07 00 00       	mov    $0x78a,%edx
+ 788:	0f 34                	sysenter
+ 78a:	c3                   	ret
+
+0000078b <fallocate>:
+SYSCALL(fallocate)
+ 78b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 790:	89 e1                	mov    %esp,%ecx
+ 792:	ba 99 07 00 00       	mov    $0x799,%edx
+ 797:	0f 34                	sysenter
+ 799:	c3                   	ret
+
+0000079a <pread>:
+SYSCALL(pread)
+ 79a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 79f:	89 e1                	mov    %esp,%ecx
+ 7a1:	ba a8 07 00 00       	mov    $0x7a8,%edx
+ 7a6:	0f 34                	sysenter
+ 7a8:	c3                   	ret
+
+000007a9 <pwrite>:
+SYSCALL(pwrite)
+ 7a9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7ae:	89 e1                	mov    %esp,%ecx
+ 7b0:	ba b7 07 00 00       	mov    $0x7b7,%edx
+ 7b5:	0f 34                	sysenter
+ 7b7:	c3                   	ret
+
+000007b8 <readv>:
+SYSCALL(readv)
+ 7b8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7bd:	89 e1                	mov    %esp,%ecx
+ 7bf:	ba c6 07 00 00       	mov    $0x7c6,%edx
+ 7c4:	0f 34                	sysenter
+ 7c6:	c3                   	ret
+
+000007c7 <writev>:
+SYSCALL(writev)
+ 7c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7cc:	89 e1                	mov    %esp,%ecx
+ 7ce:	ba d5 07 00 00       	mov    $0x7d5,%edx
+ 7d3:	0f 34                	sysenter
+ 7d5:	c3                   	ret
+
+000007d6 <splice>:
+SYSCALL(splice)
+ 7d6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7db:	89 e1                	mov    %esp,%ecx
+ 7dd:	ba e4 07 00 00       	mov    $0x7e4,%edx
+ 7e2:	0f 34                	sysenter
+ 7e4:	c3                   	ret
+
+000007e5 <setpriority>:
+SYSCALL(setpriority)
+ 7e5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7ea:	89 e1                	mov    %esp,%ecx
+ 7ec:	ba f3 07 00 00       	mov    $0x7f3,%edx
+ 7f1:	0f 34                	sysenter
+ 7f3:	c3                   	ret
+
+000007f4 <setaffinity>:
+SYSCALL(setaffinity)
+ 7f4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7f9:	89 e1                	mov    %esp,%ecx
+ 7fb:	ba 02 08 00 00       	mov    $0x802,%edx
+ 800:	0f 34                	sysenter
+ 802:	c3                   	ret
+
+00000803 <lockstress>:
+SYSCALL(lockstress)
+ 803:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 808:	89 e1                	mov    %esp,%ecx
+ 80a:	ba 11 08 00 00       	mov    $0x811,%edx
+ 80f:	0f 34                	sysenter
+ 811:	c3                   	ret
+
+00000812 <lockstat>:
+SYSCALL(lockstat)
+ 812:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 817:	89 e1                	mov    %esp,%ecx
+ 819:	ba 20 08 00 00       	mov    $0x820,%edx
+ 81e:	0f 34                	sysenter
+ 820:	c3                   	ret
+
+00000821 <profctl>:
+SYSCALL(profctl)
+ 821:	b8 20 00 00 00       	mov    $0x20,%eax
+ 826:	89 e1                	mov    %esp,%ecx
+ 828:	ba 2f 08 00 00       	mov    $0x82f,%edx
+ 82d:	0f 34                	sysenter
+ 82f:	c3                   	ret
+
+00000830 <profread>:
+SYSCALL(profread)
+ 830:	b8 21 00 00 00       	mov    $0x21,%eax
+ 835:	89 e1                	mov    %esp,%ecx
+ 837:	ba 3e 08 00 00       	mov    $0x83e,%edx
+ 83c:	0f 34                	sysenter
+ 83e:	c3                   	ret
+
+0000083f <getrusage>:
+SYSCALL(getrusage)
+ 83f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 844:	89 e1                	mov    %esp,%ecx
+ 846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+ 84b:	0f 34                	sysenter
+ 84d:	c3                   	ret
+
+0000084e <tracectl>:
+SYSCALL(tracectl)
+ 84e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 853:	89 e1                	mov    %esp,%ecx
+ 855:	ba 5c 08 00 00       	mov    $0x85c,%edx
+ 85a:	0f 34                	sysenter
+ 85c:	c3                   	ret
+
+0000085d <traceread>:
+SYSCALL(traceread)
+ 85d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 862:	89 e1                	mov    %esp,%ecx
+ 864:	ba 6b 08 00 00       	mov    $0x86b,%edx
+ 869:	0f 34                	sysenter
+ 86b:	c3                   	ret
+
+0000086c <nanosleep>:
+SYSCALL(nanosleep)
+ 86c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 871:	89 e1                	mov    %esp,%ecx
+ 873:	ba 7a 08 00 00       	mov    $0x87a,%edx
+ 878:	0f 34                	sysenter
+ 87a:	c3                   	ret
+ 87b:	66 90                	xchg   %ax,%ax
+ 87d:	66 90                	xchg   %ax,%ax
+ 87f:	90                   	nop
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 888:	89 d1                	mov    %edx,%ecx
+{
+ 88a:	83 ec 3c             	sub    $0x3c,%esp
+ 88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 890:	85 d2                	test   %edx,%edx
+ 892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+ 898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+ 89e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8b0:	89 c8                	mov    %ecx,%eax
+ 8b2:	31 d2                	xor    %edx,%edx
+ 8b4:	89 f7                	mov    %esi,%edi
+ 8b6:	f7 f3                	div    %ebx
+ 8b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8bb:	0f b6 92 f4 0c 00 00 	movzbl 0xcf4(%edx),%edx
+ 8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8c6:	89 ca                	mov    %ecx,%edx
+ 8c8:	89 c1                	mov    %eax,%ecx
+ 8ca:	39 da                	cmp    %ebx,%edx
+ 8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+ 8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8d1:	85 c0                	test   %eax,%eax
+ 8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+ 8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8da:	89 f7                	mov    %esi,%edi
+ 8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e2:	01 df                	add    %ebx,%edi
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8f4:	6a 01                	push   $0x1
+ 8f6:	50                   	push   %eax
+ 8f7:	56                   	push   %esi
+ 8f8:	e8 bc fd ff ff       	call   6b9 <write>
+  while(--i >= 0)
+ 8fd:	89 f8                	mov    %edi,%eax
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	83 ef 01             	sub    $0x1,%edi
+ 905:	39 d8                	cmp    %ebx,%eax
+ 907:	75 df                	jne    8e8 <printint+0x68>
+}
+ 909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 918:	31 c0                	xor    %eax,%eax
+ 91a:	eb 89                	jmp    8a5 <printint+0x25>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 92f:	0f b6 1e             	movzbl (%esi),%ebx
+ 932:	83 c6 01             	add    $0x1,%esi
+ 935:	84 db                	test   %bl,%bl
+ 937:	74 67                	je     9a0 <printf+0x80>
+ 939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 93c:	31 d2                	xor    %edx,%edx
+ 93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 941:	eb 34                	jmp    977 <printf+0x57>
+ 943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 947:	90                   	nop
+ 948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+ 955:	83 ec 04             	sub    $0x4,%esp
+ 958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95e:	6a 01                	push   $0x1
+ 960:	50                   	push   %eax
+ 961:	57                   	push   %edi
+ 962:	e8 52 fd ff ff       	call   6b9 <write>
+ 967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 96d:	0f b6 1e             	movzbl (%esi),%ebx
+ 970:	83 c6 01             	add    $0x1,%esi
+ 973:	84 db                	test   %bl,%bl
+ 975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 97a:	85 d2                	test   %edx,%edx
+ 97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 97e:	83 fa 25             	cmp    $0x25,%edx
+ 981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+ 983:	83 f8 25             	cmp    $0x25,%eax
+ 986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+ 98c:	83 e8 63             	sub    $0x63,%eax
+ 98f:	83 f8 15             	cmp    $0x15,%eax
+ 992:	77 1c                	ja     9b0 <printf+0x90>
+ 994:	ff 24 85 9c 0c 00 00 	jmp    *0xc9c(,%eax,4)
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	52                   	push   %edx
+ 9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9c0:	57                   	push   %edi
+ 9c1:	e8 f3 fc ff ff       	call   6b9 <write>
+ 9c6:	83 c4 0c             	add    $0xc,%esp
+ 9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9cc:	6a 01                	push   $0x1
+ 9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9d1:	52                   	push   %edx
+ 9d2:	57                   	push   %edi
+ 9d3:	e8 e1 fc ff ff       	call   6b9 <write>
+        putc(fd, c);
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9db:	31 d2                	xor    %edx,%edx
+ 9dd:	eb 8e                	jmp    96d <printf+0x4d>
+ 9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 00                	push   $0x0
+ 9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+ 9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a15:	83 c0 04             	add    $0x4,%eax
+ a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a1b:	85 db                	test   %ebx,%ebx
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+ a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a28:	84 c0                	test   %al,%al
+ a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+ a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	89 d3                	mov    %edx,%ebx
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	53                   	push   %ebx
+ a4c:	57                   	push   %edi
+ a4d:	e8 67 fc ff ff       	call   6b9 <write>
+        while(*s != 0){
+ a52:	0f b6 06             	movzbl (%esi),%eax
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+ a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	52                   	push   %edx
+ a9c:	57                   	push   %edi
+ a9d:	e8 17 fc ff ff       	call   6b9 <write>
+        ap++;
+ aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab9:	6a 01                	push   $0x1
+ abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+ ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ac5:	bb 92 0c 00 00       	mov    $0xc92,%ebx
+ aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+ acf:	90                   	nop
+
+00000ad0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ad0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	a1 c4 10 00 00       	mov    0x10c4,%eax
+{
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	57                   	push   %edi
+ ad9:	56                   	push   %esi
+ ada:	53                   	push   %ebx
+ adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ade:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ae8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aec:	39 ca                	cmp    %ecx,%edx
+ aee:	73 30                	jae    b20 <free+0x50>
+ af0:	39 c1                	cmp    %eax,%ecx
+ af2:	72 04                	jb     af8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af4:	39 c2                	cmp    %eax,%edx
+ af6:	72 f0                	jb     ae8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ af8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ afb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ afe:	39 f8                	cmp    %edi,%eax
+ b00:	74 2e                	je     b30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b05:	8b 42 04             	mov    0x4(%edx),%eax
+ b08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b0b:	39 f1                	cmp    %esi,%ecx
+ b0d:	74 38                	je     b47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b11:	5b                   	pop    %ebx
+  freep = p;
+ b12:	89 15 c4 10 00 00    	mov    %edx,0x10c4
+}
+ b18:	5e                   	pop    %esi
+ b19:	5f                   	pop    %edi
+ b1a:	5d                   	pop    %ebp
+ b1b:	c3                   	ret
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b20:	39 c1                	cmp    %eax,%ecx
+ b22:	72 d0                	jb     af4 <free+0x24>
+ b24:	eb c2                	jmp    ae8 <free+0x18>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b30:	03 70 04             	add    0x4(%eax),%esi
+ b33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b36:	8b 02                	mov    (%edx),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b3d:	8b 42 04             	mov    0x4(%edx),%eax
+ b40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b43:	39 f1                	cmp    %esi,%ecx
+ b45:	75 c8                	jne    b0f <free+0x3f>
+    p->s.size += bp->s.size;
+ b47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b4a:	89 15 c4 10 00 00    	mov    %edx,0x10c4
+    p->s.size += bp->s.size;
+ b50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b56:	89 0a                	mov    %ecx,(%edx)
+}
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b6c:	8b 15 c4 10 00 00    	mov    0x10c4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b72:	8d 78 07             	lea    0x7(%eax),%edi
+ b75:	c1 ef 03             	shr    $0x3,%edi
+ b78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b7b:	85 d2                	test   %edx,%edx
+ b7d:	0f 84 8d 00 00 00    	je     c10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b85:	8b 48 04             	mov    0x4(%eax),%ecx
+ b88:	39 f9                	cmp    %edi,%ecx
+ b8a:	73 64                	jae    bf0 <malloc+0x90>
+  if(nu < 4096)
+ b8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b91:	39 df                	cmp    %ebx,%edi
+ b93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b9d:	eb 0a                	jmp    ba9 <malloc+0x49>
+ b9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba5:	39 f9                	cmp    %edi,%ecx
+ ba7:	73 47                	jae    bf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ba9:	89 c2                	mov    %eax,%edx
+ bab:	39 05 c4 10 00 00    	cmp    %eax,0x10c4
+ bb1:	75 ed                	jne    ba0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	56                   	push   %esi
+ bb7:	e8 b1 fb ff ff       	call   76d <sbrk>
+  if(p == (char*)-1)
+ bbc:	83 c4 10             	add    $0x10,%esp
+ bbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bc2:	74 1c                	je     be0 <malloc+0x80>
+  hp->s.size = nu;
+ bc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bc7:	83 ec 0c             	sub    $0xc,%esp
+ bca:	83 c0 08             	add    $0x8,%eax
+ bcd:	50                   	push   %eax
+ bce:	e8 fd fe ff ff       	call   ad0 <free>
+  return freep;
+ bd3:	8b 15 c4 10 00 00    	mov    0x10c4,%edx
+      if((p = morecore(nunits)) == 0)
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	85 d2                	test   %edx,%edx
+ bde:	75 c0                	jne    ba0 <malloc+0x40>
+        return 0;
+  }
+}
+ be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ be3:	31 c0                	xor    %eax,%eax
+}
+ be5:	5b                   	pop    %ebx
+ be6:	5e                   	pop    %esi
+ be7:	5f                   	pop    %edi
+ be8:	5d                   	pop    %ebp
+ be9:	c3                   	ret
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bf0:	39 cf                	cmp    %ecx,%edi
+ bf2:	74 4c                	je     c40 <malloc+0xe0>
+        p->s.size -= nunits;
+ bf4:	29 f9                	sub    %edi,%ecx
+ bf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bff:	89 15 c4 10 00 00    	mov    %edx,0x10c4
+}
+ c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c08:	83 c0 08             	add    $0x8,%eax
+}
+ c0b:	5b                   	pop    %ebx
+ c0c:	5e                   	pop    %esi
+ c0d:	5f                   	pop    %edi
+ c0e:	5d                   	pop    %ebp
+ c0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c10:	c7 05 c4 10 00 00 c8 	movl   $0x10c8,0x10c4
+ c17:	10 00 00 
+    base.s.size = 0;
+ c1a:	b8 c8 10 00 00       	mov    $0x10c8,%eax
+    base.s.ptr = freep = prevp = &base;
+ c1f:	c7 05 c8 10 00 00 c8 	movl   $0x10c8,0x10c8
+ c26:	10 00 00 
+    base.s.size = 0;
+ c29:	c7 05 cc 10 00 00 00 	movl   $0x0,0x10cc
+ c30:	00 00 00 
+    if(p->s.size >= nunits){
+ c33:	e9 54 ff ff ff       	jmp    b8c <malloc+0x2c>
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c40:	8b 08                	mov    (%eax),%ecx
+ c42:	89 0a                	mov    %ecx,(%edx)
+ c44:	eb b9                	jmp    bff <malloc+0x9f>
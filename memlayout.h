@@ -7,6 +7,7 @@
 // Key addresses for address space layout (see kmap in vm.c for layout)
 #define KERNBASE 0x80000000         // First kernel virtual address
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
+#define VDSO (KERNBASE-0x1000)      // User-readable page (see vdso.h)
 
 #define V2P(a) (((uint) (a)) - KERNBASE)
 #define P2V(a) ((void *) (((char *) (a)) + KERNBASE))
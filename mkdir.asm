@@ -0,0 +1,1472 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 3c 04 00 00       	call   480 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 9f 09 00 00       	push   $0x99f
+  53:	6a 02                	push   $0x2
+  55:	e8 06 06 00 00       	call   660 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 5b 03 00 00       	call   3bd <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 88 09 00 00       	push   $0x988
+  69:	6a 02                	push   $0x2
+  6b:	e8 f0 05 00 00       	call   660 <printf>
+    exit();
+  70:	e8 48 03 00 00       	call   3bd <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 2d 02 00 00       	call   3ea <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 23 02 00 00       	call   435 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 3b 02 00 00       	call   462 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 d7 01 00 00       	call   408 <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+ 2c5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 2ce:	85 f6                	test   %esi,%esi
+ 2d0:	74 2e                	je     300 <memcmp+0x40>
+ 2d2:	01 c6                	add    %eax,%esi
+ 2d4:	eb 14                	jmp    2ea <memcmp+0x2a>
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 2e0:	83 c0 01             	add    $0x1,%eax
+ 2e3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 2e6:	39 f0                	cmp    %esi,%eax
+ 2e8:	74 16                	je     300 <memcmp+0x40>
+    if(*s1 != *s2)
+ 2ea:	0f b6 0a             	movzbl (%edx),%ecx
+ 2ed:	0f b6 18             	movzbl (%eax),%ebx
+ 2f0:	38 d9                	cmp    %bl,%cl
+ 2f2:	74 ec                	je     2e0 <memcmp+0x20>
+      return *s1 - *s2;
+ 2f4:	0f b6 c1             	movzbl %cl,%eax
+ 2f7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	5b                   	pop    %ebx
+  return 0;
+ 301:	31 c0                	xor    %eax,%eax
+}
+ 303:	5e                   	pop    %esi
+ 304:	5d                   	pop    %ebp
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 310:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 320:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 322:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 328:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 32e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 334:	c3                   	ret
+ 335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 340:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 342:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 348:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 34e:	c3                   	ret
+ 34f:	90                   	nop
+
+00000350 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 358:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 35d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 363:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 369:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 36f:	89 c6                	mov    %eax,%esi
+ 371:	f7 f7                	div    %edi
+ 373:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 375:	f7 e3                	mul    %ebx
+ 377:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 37a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 37d:	89 d3                	mov    %edx,%ebx
+ 37f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 382:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 384:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 386:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 38c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 391:	f7 e6                	mul    %esi
+ 393:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 399:	29 d9                	sub    %ebx,%ecx
+ 39b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 3a1:	01 c1                	add    %eax,%ecx
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5f                   	pop    %edi
+ 3ac:	5d                   	pop    %ebp
+ 3ad:	c3                   	ret
+
+000003ae <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 3ae:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b3:	89 e1                	mov    %esp,%ecx
+ 3b5:	ba bc 03 00 00       	mov    $0x3bc,%edx
+ 3ba:	0f 34                	sysenter
+ 3bc:	c3                   	ret
+
+000003bd <exit>:
+SYSCALL(exit)
+ 3bd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c2:	89 e1                	mov    %esp,%ecx
+ 3c4:	ba cb 03 00 00       	mov    $0x3cb,%edx
+ 3c9:	0f 34                	sysenter
+ 3cb:	c3                   	ret
+
+000003cc <wait>:
+SYSCALL(wait)
+ 3cc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3d1:	89 e1                	mov    %esp,%ecx
+ 3d3:	ba da 03 00 00       	mov    $0x3da,%edx
+ 3d8:	0f 34                	sysenter
+ 3da:	c3                   	ret
+
+000003db <pipe>:
+SYSCALL(pipe)
+ 3db:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e0:	89 e1                	mov    %esp,%ecx
+ 3e2:	ba e9 03 00 00       	mov    $0x3e9,%edx
+ 3e7:	0f 34                	sysenter
+ 3e9:	c3                   	ret
+
+000003ea <read>:
+SYSCALL(read)
+ 3ea:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3ef:	89 e1                	mov    %esp,%ecx
+ 3f1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+ 3f6:	0f 34                	sysenter
+ 3f8:	c3                   	ret
+
+000003f9 <write>:
+SYSCALL(write)
+ 3f9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3fe:	89 e1                	mov    %esp,%ecx
+ 400:	ba 07 04 00 00       	mov    $0x407,%edx
+ 405:	0f 34                	sysenter
+ 407:	c3                   	ret
+
+00000408 <close>:
+SYSCALL(close)
+ 408:	b8 15 00 00 00       	mov    $0x15,%eax
+ 40d:	89 e1                	mov    %esp,%ecx
+ 40f:	ba 16 04 00 00       	mov    $0x416,%edx
+ 414:	0f 34                	sysenter
+ 416:	c3                   	ret
+
+00000417 <kill>:
+SYSCALL(kill)
+ 417:	b8 06 00 00 00       	mov    $0x6,%eax
+ 41c:	89 e1                	mov    %esp,%ecx
+ 41e:	ba 25 04 00 00       	mov    $0x425,%edx
+ 423:	0f 34                	sysenter
+ 425:	c3                   	ret
+
+00000426 <exec>:
+SYSCALL(exec)
+ 426:	b8 07 00 00 00       	mov    $0x7,%eax
+ 42b:	89 e1                	mov    %esp,%ecx
+ 42d:	ba 34 04 00 00       	mov    $0x434,%edx
+ 432:	0f 34                	sysenter
+ 434:	c3                   	ret
+
+00000435 <open>:
+SYSCALL(open)
+ 435:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 43a:	89 e1                	mov    %esp,%ecx
+ 43c:	ba 43 04 00 00       	mov    $0x443,%edx
+ 441:	0f 34                	sysenter
+ 443:	c3                   	ret
+
+00000444 <mknod>:
+SYSCALL(mknod)
+ 444:	b8 11 00 00 00       	mov    $0x11,%eax
+ 449:	89 e1                	mov    %esp,%ecx
+ 44b:	ba 52 04 00 00       	mov    $0x452,%edx
+ 450:	0f 34                	sysenter
+ 452:	c3                   	ret
+
+00000453 <unlink>:
+SYSCALL(unlink)
+ 453:	b8 12 00 00 00       	mov    $0x12,%eax
+ 458:	89 e1                	mov    %esp,%ecx
+ 45a:	ba 61 04 00 00       	mov    $0x461,%edx
+ 45f:	0f 34                	sysenter
+ 461:	c3                   	ret
+
+00000462 <fstat>:
+SYSCALL(fstat)
+ 462:	b8 08 00 00 00       	mov    $0x8,%eax
+ 467:	89 e1                	mov    %esp,%ecx
+ 469:	ba 70 04 00 00       	mov    $0x470,%edx
+ 46e:	0f 34                	sysenter
+ 470:	c3                   	ret
+
+00000471 <link>:
+SYSCALL(link)
+ 471:	b8 13 00 00 00       	mov    $0x13,%eax
+ 476:	89 e1                	mov    %esp,%ecx
+ 478:	ba 7f 04 00 00       	mov    $0x47f,%edx
+ 47d:	0f 34                	sysenter
+ 47f:	c3                   	ret
+
+00000480 <mkdir>:
+SYSCALL(mkdir)
+ 480:	b8 14 00 00 00       	mov    $0x14,%eax
+ 485:	89 e1                	mov    %esp,%ecx
+ 487:	ba 8e 04 00 00       	mov    $0x48e,%edx
+ 48c:	0f 34                	sysenter
+ 48e:	c3                   	ret
+
+0000048f <chdir>:
+SYSCALL(chdir)
+ 48f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 494:	89 e1                	mov    %esp,%ecx
+ 496:	ba 9d 04 00 00       	mov    $0x49d,%edx
+ 49b:	0f 34                	sysenter
+ 49d:	c3                   	ret
+
+0000049e <dup>:
+SYSCALL(dup)
+ 49e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a3:	89 e1                	mov    %esp,%ecx
+ 4a5:	ba ac 04 00 00       	mov    $0x4ac,%edx
+ 4aa:	0f 34                	sysenter
+ 4ac:	c3                   	ret
+
+000004ad <sbrk>:
+SYSCALL(sbrk)
+ 4ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b2:	89 e1                	mov    %esp,%ecx
+ 4b4:	ba bb 04 00 00       	mov    $0x4bb,%edx
+ 4b9:	0f 34                	sysenter
+ 4bb:	c3                   	ret
+
+000004bc <sleep>:
+SYSCALL(sleep)
+ 4bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4c1:	89 e1                	mov    %esp,%ecx
+ 4c3:	ba ca 04 00 00       	mov    $0x4ca,%edx
+ 4c8:	0f 34                	sysenter
+ 4ca:	c3                   	ret
+
+000004cb <fallocate>:
+SYSCALL(fallocate)
+ 4cb:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d0:	89 e1                	mov    %esp,%ecx
+ 4d2:	ba d9 04 00 00       	mov    $0x4d9,%edx
+ 4d7:	0f 34                	sysenter
+ 4d9:	c3                   	ret
+
+000004da <pread>:
+SYSCALL(pread)
+ 4da:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4df:	89 e1                	mov    %esp,%ecx
+ 4e1:	ba e8 04 00 00       	mov    $0x4e8,%edx
+ 4e6:	0f 34                	sysenter
+ 4e8:	c3                   	ret
+
+000004e9 <pwrite>:
+SYSCALL(pwrite)
+ 4e9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4ee:	89 e1                	mov    %esp,%ecx
+ 4f0:	ba f7 04 00 00       	mov    $0x4f7,%edx
+ 4f5:	0f 34                	sysenter
+ 4f7:	c3                   	ret
+
+000004f8 <readv>:
+SYSCALL(readv)
+ 4f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4fd:	89 e1                	mov    %esp,%ecx
+ 4ff:	ba 06 05 00 00       	mov    $0x506,%edx
+ 504:	0f 34                	sysenter
+ 506:	c3                   	ret
+
+00000507 <writev>:
+SYSCALL(writev)
+ 507:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 50c:	89 e1                	mov    %esp,%ecx
+ 50e:	ba 15 05 00 00       	mov    $0x515,%edx
+ 513:	0f 34                	sysenter
+ 515:	c3                   	ret
+
+00000516 <splice>:
+SYSCALL(splice)
+ 516:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 51b:	89 e1                	mov    %esp,%ecx
+ 51d:	ba 24 05 00 00       	mov    $0x524,%edx
+ 522:	0f 34                	sysenter
+ 524:	c3                   	ret
+
+00000525 <setpriority>:
+SYSCALL(setpriority)
+ 525:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 52a:	89 e1                	mov    %esp,%ecx
+ 52c:	ba 33 05 00 00       	mov    $0x533,%edx
+ 531:	0f 34                	sysenter
+ 533:	c3                   	ret
+
+00000534 <setaffinity>:
+SYSCALL(setaffinity)
+ 534:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 539:	89 e1                	mov    %esp,%ecx
+ 53b:	ba 42 05 00 00       	mov    $0x542,%edx
+ 540:	0f 34                	sysenter
+ 542:	c3                   	ret
+
+00000543 <lockstress>:
+SYSCALL(lockstress)
+ 543:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 548:	89 e1                	mov    %esp,%ecx
+ 54a:	ba 51 05 00 00       	mov    $0x551,%edx
+ 54f:	0f 34                	sysenter
+ 551:	c3                   	ret
+
+00000552 <lockstat>:
+SYSCALL(lockstat)
+ 552:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 557:	89 e1                	mov    %esp,%ecx
+ 559:	ba 60 05 00 00       	mov    $0x560,%edx
+ 55e:	0f 34                	sysenter
+ 560:	c3                   	ret
+
+00000561 <profctl>:
+SYSCALL(profctl)
+ 561:	b8 20 00 00 00       	mov    $0x20,%eax
+ 566:	89 e1                	mov    %esp,%ecx
+ 568:	ba 6f 05 00 00       	mov    $0x56f,%edx
+ 56d:	0f 34                	sysenter
+ 56f:	c3                   	ret
+
+00000570 <profread>:
+SYSCALL(profread)
+ 570:	b8 21 00 00 00       	mov    $0x21,%eax
+ 575:	89 e1                	mov    %esp,%ecx
+ 577:	ba 7e 05 00 00       	mov    $0x57e,%edx
+ 57c:	0f 34                	sysenter
+ 57e:	c3                   	ret
+
+0000057f <getrusage>:
+SYSCALL(getrusage)
+ 57f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 584:	89 e1                	mov    %esp,%ecx
+ 586:	ba 8d 05 00 00       	mov    $0x58d,%edx
+ 58b:	0f 34                	sysenter
+ 58d:	c3                   	ret
+
+0000058e <tracectl>:
+SYSCALL(tracectl)
+ 58e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 593:	89 e1                	mov    %esp,%ecx
+ 595:	ba 9c 05 00 00       	mov    $0x59c,%edx
+ 59a:	0f 34                	sysenter
+ 59c:	c3                   	ret
+
+0000059d <traceread>:
+SYSCALL(traceread)
+ 59d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5a2:	89 e1                	mov    %esp,%ecx
+ 5a4:	ba ab 05 00 00       	mov    $0x5ab,%edx
+ 5a9:	0f 34                	sysenter
+ 5ab:	c3                   	ret
+
+000005ac <nanosleep>:
+SYSCALL(nanosleep)
+ 5ac:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5b1:	89 e1                	mov    %esp,%ecx
+ 5b3:	ba ba 05 00 00       	mov    $0x5ba,%edx
+ 5b8:	0f 34                	sysenter
+ 5ba:	c3                   	ret
+ 5bb:	66 90                	xchg   %ax,%ax
+ 5bd:	66 90                	xchg   %ax,%ax
+ 5bf:	90                   	nop
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 1c 0a 00 00 	movzbl 0xa1c(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 bc fd ff ff       	call   3f9 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 52 fd ff ff       	call   3f9 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 c4 09 00 00 	jmp    *0x9c4(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 f3 fc ff ff       	call   3f9 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 e1 fc ff ff       	call   3f9 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 67 fc ff ff       	call   3f9 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 17 fc ff ff       	call   3f9 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb bb 09 00 00       	mov    $0x9bb,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 810:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	a1 64 0d 00 00       	mov    0xd64,%eax
+{
+ 816:	89 e5                	mov    %esp,%ebp
+ 818:	57                   	push   %edi
+ 819:	56                   	push   %esi
+ 81a:	53                   	push   %ebx
+ 81b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 81e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 828:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 82c:	39 ca                	cmp    %ecx,%edx
+ 82e:	73 30                	jae    860 <free+0x50>
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 04                	jb     838 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 834:	39 c2                	cmp    %eax,%edx
+ 836:	72 f0                	jb     828 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 838:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 83b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 83e:	39 f8                	cmp    %edi,%eax
+ 840:	74 2e                	je     870 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 842:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 845:	8b 42 04             	mov    0x4(%edx),%eax
+ 848:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 84b:	39 f1                	cmp    %esi,%ecx
+ 84d:	74 38                	je     887 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 84f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 851:	5b                   	pop    %ebx
+  freep = p;
+ 852:	89 15 64 0d 00 00    	mov    %edx,0xd64
+}
+ 858:	5e                   	pop    %esi
+ 859:	5f                   	pop    %edi
+ 85a:	5d                   	pop    %ebp
+ 85b:	c3                   	ret
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 860:	39 c1                	cmp    %eax,%ecx
+ 862:	72 d0                	jb     834 <free+0x24>
+ 864:	eb c2                	jmp    828 <free+0x18>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 870:	03 70 04             	add    0x4(%eax),%esi
+ 873:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 876:	8b 02                	mov    (%edx),%eax
+ 878:	8b 00                	mov    (%eax),%eax
+ 87a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 87d:	8b 42 04             	mov    0x4(%edx),%eax
+ 880:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 883:	39 f1                	cmp    %esi,%ecx
+ 885:	75 c8                	jne    84f <free+0x3f>
+    p->s.size += bp->s.size;
+ 887:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 88a:	89 15 64 0d 00 00    	mov    %edx,0xd64
+    p->s.size += bp->s.size;
+ 890:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 893:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 896:	89 0a                	mov    %ecx,(%edx)
+}
+ 898:	5b                   	pop    %ebx
+ 899:	5e                   	pop    %esi
+ 89a:	5f                   	pop    %edi
+ 89b:	5d                   	pop    %ebp
+ 89c:	c3                   	ret
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ac:	8b 15 64 0d 00 00    	mov    0xd64,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8b5:	c1 ef 03             	shr    $0x3,%edi
+ 8b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8bb:	85 d2                	test   %edx,%edx
+ 8bd:	0f 84 8d 00 00 00    	je     950 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c8:	39 f9                	cmp    %edi,%ecx
+ 8ca:	73 64                	jae    930 <malloc+0x90>
+  if(nu < 4096)
+ 8cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8d1:	39 df                	cmp    %ebx,%edi
+ 8d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8dd:	eb 0a                	jmp    8e9 <malloc+0x49>
+ 8df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e5:	39 f9                	cmp    %edi,%ecx
+ 8e7:	73 47                	jae    930 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8e9:	89 c2                	mov    %eax,%edx
+ 8eb:	39 05 64 0d 00 00    	cmp    %eax,0xd64
+ 8f1:	75 ed                	jne    8e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	56                   	push   %esi
+ 8f7:	e8 b1 fb ff ff       	call   4ad <sbrk>
+  if(p == (char*)-1)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 902:	74 1c                	je     920 <malloc+0x80>
+  hp->s.size = nu;
+ 904:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 907:	83 ec 0c             	sub    $0xc,%esp
+ 90a:	83 c0 08             	add    $0x8,%eax
+ 90d:	50                   	push   %eax
+ 90e:	e8 fd fe ff ff       	call   810 <free>
+  return freep;
+ 913:	8b 15 64 0d 00 00    	mov    0xd64,%edx
+      if((p = morecore(nunits)) == 0)
+ 919:	83 c4 10             	add    $0x10,%esp
+ 91c:	85 d2                	test   %edx,%edx
+ 91e:	75 c0                	jne    8e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 923:	31 c0                	xor    %eax,%eax
+}
+ 925:	5b                   	pop    %ebx
+ 926:	5e                   	pop    %esi
+ 927:	5f                   	pop    %edi
+ 928:	5d                   	pop    %ebp
+ 929:	c3                   	ret
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 930:	39 cf                	cmp    %ecx,%edi
+ 932:	74 4c                	je     980 <malloc+0xe0>
+        p->s.size -= nunits;
+ 934:	29 f9                	sub    %edi,%ecx
+ 936:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 939:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 93c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 93f:	89 15 64 0d 00 00    	mov    %edx,0xd64
+}
+ 945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 948:	83 c0 08             	add    $0x8,%eax
+}
+ 94b:	5b                   	pop    %ebx
+ 94c:	5e                   	pop    %esi
+ 94d:	5f                   	pop    %edi
+ 94e:	5d                   	pop    %ebp
+ 94f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 950:	c7 05 64 0d 00 00 68 	movl   $0xd68,0xd64
+ 957:	0d 00 00 
+    base.s.size = 0;
+ 95a:	b8 68 0d 00 00       	mov    $0xd68,%eax
+    base.s.ptr = freep = prevp = &base;
+ 95f:	c7 05 68 0d 00 00 68 	movl   $0xd68,0xd68
+ 966:	0d 00 00 
+    base.s.size = 0;
+ 969:	c7 05 6c 0d 00 00 00 	movl   $0x0,0xd6c
+ 970:	00 00 00 
+    if(p->s.size >= nunits){
+ 973:	e9 54 ff ff ff       	jmp    8cc <malloc+0x2c>
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 980:	8b 08                	mov    (%eax),%ecx
+ 982:	89 0a                	mov    %ecx,(%edx)
+ 984:	eb b9                	jmp    93f <malloc+0x9f>
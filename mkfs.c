@@ -265,6 +265,23 @@ iappend(uint inum, void *xp, int n)
   rinode(inum, &din);
   off = xint(din.size);
   // printf("append inum %d at off %d sz %d\n", inum, off, n);
+  if(xshort(din.type) == T_FILE && off <= MAXINLINE){
+    if(off + n <= MAXINLINE){
+      // Small enough to live in the inode (see MAXINLINE in fs.h).
+      bcopy(p, (char*)din.addrs + off, n);
+      din.size = xint(off + n);
+      winode(inum, &din);
+      return;
+    }
+    // Outgrowing the inode: move the inline bytes to a data block.
+    if(off > 0){
+      bzero(buf, sizeof(buf));
+      bcopy(din.addrs, buf, off);
+      bzero(din.addrs, sizeof(din.addrs));
+      din.addrs[0] = xint(freeblock++);
+      wsect(xint(din.addrs[0]), buf);
+    }
+  }
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
@@ -2,6 +2,7 @@
 // x86 memory management unit (MMU).
 
 // Eflags register
+#define FL_TF           0x00000100      // Trap Flag
 #define FL_IF           0x00000200      // Interrupt Enable
 
 // Control Register flags
@@ -11,15 +12,24 @@
 
 #define CR4_PSE         0x00000010      // Page size extension
 
+// Model-specific registers for sysenter
+#define MSR_SYSENTER_CS  0x174          // Kernel code segment
+#define MSR_SYSENTER_ESP 0x175          // Kernel stack pointer
+#define MSR_SYSENTER_EIP 0x176          // Kernel entry point
+
+#define CPUID_SEP       0x00000800      // cpuid 1 %edx: has sysenter
+
 // various segment selectors.
+// sysexit needs SEG_UCODE and SEG_UDATA right after SEG_KDATA.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
 #define SEG_UCODE 3  // user code
 #define SEG_UDATA 4  // user data+stack
 #define SEG_TSS   5  // this process's task state
+#define SEG_KCPU  6  // kernel per-cpu data, addressed through %gs
 
 // cpu->gdt[NSEGS] holds the above segments.
-#define NSEGS     6
+#define NSEGS     7
 
 #ifndef __ASSEMBLER__
 // Segment Descriptor
@@ -0,0 +1,1474 @@
+
+_nice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+
+// Run a command at the given priority, 0 being the highest.
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  if(argc < 3){
+  13:	83 39 02             	cmpl   $0x2,(%ecx)
+{
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc < 3){
+  19:	7f 13                	jg     2e <main+0x2e>
+    printf(2, "usage: nice prio command [arg...]\n");
+  1b:	51                   	push   %ecx
+  1c:	51                   	push   %ecx
+  1d:	68 98 09 00 00       	push   $0x998
+  22:	6a 02                	push   $0x2
+  24:	e8 47 06 00 00       	call   670 <printf>
+    exit();
+  29:	e8 9f 03 00 00       	call   3cd <exit>
+  }
+  if(setpriority(getpid(), atoi(argv[1])) < 0){
+  2e:	83 ec 0c             	sub    $0xc,%esp
+  31:	ff 73 04             	push   0x4(%ebx)
+  34:	e8 27 02 00 00       	call   260 <atoi>
+  39:	89 c6                	mov    %eax,%esi
+  3b:	e8 e0 02 00 00       	call   320 <getpid>
+  40:	59                   	pop    %ecx
+  41:	5a                   	pop    %edx
+  42:	56                   	push   %esi
+  43:	50                   	push   %eax
+  44:	e8 ec 04 00 00       	call   535 <setpriority>
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	85 c0                	test   %eax,%eax
+  4e:	78 25                	js     75 <main+0x75>
+    printf(2, "nice: bad priority %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  50:	50                   	push   %eax
+  51:	50                   	push   %eax
+  52:	8d 43 08             	lea    0x8(%ebx),%eax
+  55:	50                   	push   %eax
+  56:	ff 73 08             	push   0x8(%ebx)
+  59:	e8 d8 03 00 00       	call   436 <exec>
+  printf(2, "nice: exec %s failed\n", argv[2]);
+  5e:	83 c4 0c             	add    $0xc,%esp
+  61:	ff 73 08             	push   0x8(%ebx)
+  64:	68 d2 09 00 00       	push   $0x9d2
+  69:	6a 02                	push   $0x2
+  6b:	e8 00 06 00 00       	call   670 <printf>
+  exit();
+  70:	e8 58 03 00 00       	call   3cd <exit>
+    printf(2, "nice: bad priority %s\n", argv[1]);
+  75:	52                   	push   %edx
+  76:	ff 73 04             	push   0x4(%ebx)
+  79:	68 bb 09 00 00       	push   $0x9bb
+  7e:	6a 02                	push   $0x2
+  80:	e8 eb 05 00 00       	call   670 <printf>
+    exit();
+  85:	e8 43 03 00 00       	call   3cd <exit>
+  8a:	66 90                	xchg   %ax,%ax
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  90:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  91:	31 c0                	xor    %eax,%eax
+{
+  93:	89 e5                	mov    %esp,%ebp
+  95:	53                   	push   %ebx
+  96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  a7:	83 c0 01             	add    $0x1,%eax
+  aa:	84 d2                	test   %dl,%dl
+  ac:	75 f2                	jne    a0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b1:	89 c8                	mov    %ecx,%eax
+  b3:	c9                   	leave
+  b4:	c3                   	ret
+  b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	53                   	push   %ebx
+  c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ca:	0f b6 02             	movzbl (%edx),%eax
+  cd:	84 c0                	test   %al,%al
+  cf:	75 17                	jne    e8 <strcmp+0x28>
+  d1:	eb 3a                	jmp    10d <strcmp+0x4d>
+  d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  d7:	90                   	nop
+  d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  dc:	83 c2 01             	add    $0x1,%edx
+  df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  e2:	84 c0                	test   %al,%al
+  e4:	74 1a                	je     100 <strcmp+0x40>
+    p++, q++;
+  e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  e8:	0f b6 19             	movzbl (%ecx),%ebx
+  eb:	38 c3                	cmp    %al,%bl
+  ed:	74 e9                	je     d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  ef:	29 d8                	sub    %ebx,%eax
+}
+  f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f4:	c9                   	leave
+  f5:	c3                   	ret
+  f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 100:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 104:	31 c0                	xor    %eax,%eax
+ 106:	29 d8                	sub    %ebx,%eax
+}
+ 108:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 10b:	c9                   	leave
+ 10c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 10d:	0f b6 19             	movzbl (%ecx),%ebx
+ 110:	31 c0                	xor    %eax,%eax
+ 112:	eb db                	jmp    ef <strcmp+0x2f>
+ 114:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+
+00000120 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 126:	80 3a 00             	cmpb   $0x0,(%edx)
+ 129:	74 15                	je     140 <strlen+0x20>
+ 12b:	31 c0                	xor    %eax,%eax
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+ 130:	83 c0 01             	add    $0x1,%eax
+ 133:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 137:	89 c1                	mov    %eax,%ecx
+ 139:	75 f5                	jne    130 <strlen+0x10>
+    ;
+  return n;
+}
+ 13b:	89 c8                	mov    %ecx,%eax
+ 13d:	5d                   	pop    %ebp
+ 13e:	c3                   	ret
+ 13f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 140:	31 c9                	xor    %ecx,%ecx
+}
+ 142:	5d                   	pop    %ebp
+ 143:	89 c8                	mov    %ecx,%eax
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000150 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 15a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15d:	89 d7                	mov    %edx,%edi
+ 15f:	fc                   	cld
+ 160:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 162:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 165:	89 d0                	mov    %edx,%eax
+ 167:	c9                   	leave
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 45 08             	mov    0x8(%ebp),%eax
+ 176:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 17a:	0f b6 10             	movzbl (%eax),%edx
+ 17d:	84 d2                	test   %dl,%dl
+ 17f:	75 12                	jne    193 <strchr+0x23>
+ 181:	eb 1d                	jmp    1a0 <strchr+0x30>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 18c:	83 c0 01             	add    $0x1,%eax
+ 18f:	84 d2                	test   %dl,%dl
+ 191:	74 0d                	je     1a0 <strchr+0x30>
+    if(*s == c)
+ 193:	38 d1                	cmp    %dl,%cl
+ 195:	75 f1                	jne    188 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 197:	5d                   	pop    %ebp
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1a0:	31 c0                	xor    %eax,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1b9:	31 db                	xor    %ebx,%ebx
+{
+ 1bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1be:	eb 27                	jmp    1e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	56                   	push   %esi
+ 1c6:	6a 00                	push   $0x0
+ 1c8:	e8 2d 02 00 00       	call   3fa <read>
+    if(cc < 1)
+ 1cd:	83 c4 10             	add    $0x10,%esp
+ 1d0:	85 c0                	test   %eax,%eax
+ 1d2:	7e 1d                	jle    1f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1df:	3c 0a                	cmp    $0xa,%al
+ 1e1:	74 10                	je     1f3 <gets+0x43>
+ 1e3:	3c 0d                	cmp    $0xd,%al
+ 1e5:	74 0c                	je     1f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1e7:	89 df                	mov    %ebx,%edi
+ 1e9:	83 c3 01             	add    $0x1,%ebx
+ 1ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ef:	7c cf                	jl     1c0 <gets+0x10>
+ 1f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1fd:	5b                   	pop    %ebx
+ 1fe:	5e                   	pop    %esi
+ 1ff:	5f                   	pop    %edi
+ 200:	5d                   	pop    %ebp
+ 201:	c3                   	ret
+ 202:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000210 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	56                   	push   %esi
+ 214:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 215:	83 ec 08             	sub    $0x8,%esp
+ 218:	6a 00                	push   $0x0
+ 21a:	ff 75 08             	push   0x8(%ebp)
+ 21d:	e8 23 02 00 00       	call   445 <open>
+  if(fd < 0)
+ 222:	83 c4 10             	add    $0x10,%esp
+ 225:	85 c0                	test   %eax,%eax
+ 227:	78 27                	js     250 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 229:	83 ec 08             	sub    $0x8,%esp
+ 22c:	ff 75 0c             	push   0xc(%ebp)
+ 22f:	89 c3                	mov    %eax,%ebx
+ 231:	50                   	push   %eax
+ 232:	e8 3b 02 00 00       	call   472 <fstat>
+  close(fd);
+ 237:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 23a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 23c:	e8 d7 01 00 00       	call   418 <close>
+  return r;
+ 241:	83 c4 10             	add    $0x10,%esp
+}
+ 244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 247:	89 f0                	mov    %esi,%eax
+ 249:	5b                   	pop    %ebx
+ 24a:	5e                   	pop    %esi
+ 24b:	5d                   	pop    %ebp
+ 24c:	c3                   	ret
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 250:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 255:	eb ed                	jmp    244 <stat+0x34>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+
+00000260 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 267:	0f be 02             	movsbl (%edx),%eax
+ 26a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 26d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 275:	77 1e                	ja     295 <atoi+0x35>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 280:	83 c2 01             	add    $0x1,%edx
+ 283:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 286:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 28a:	0f be 02             	movsbl (%edx),%eax
+ 28d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 290:	80 fb 09             	cmp    $0x9,%bl
+ 293:	76 eb                	jbe    280 <atoi+0x20>
+  return n;
+}
+ 295:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 298:	89 c8                	mov    %ecx,%eax
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ae:	85 c0                	test   %eax,%eax
+ 2b0:	7e 13                	jle    2c5 <memmove+0x25>
+ 2b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2b4:	89 d7                	mov    %edx,%edi
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2c1:	39 f8                	cmp    %edi,%eax
+ 2c3:	75 fb                	jne    2c0 <memmove+0x20>
+  return vdst;
+}
+ 2c5:	5e                   	pop    %esi
+ 2c6:	89 d0                	mov    %edx,%eax
+ 2c8:	5f                   	pop    %edi
+ 2c9:	5d                   	pop    %ebp
+ 2ca:	c3                   	ret
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+ 2d5:	8b 75 10             	mov    0x10(%ebp),%esi
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 2de:	85 f6                	test   %esi,%esi
+ 2e0:	74 2e                	je     310 <memcmp+0x40>
+ 2e2:	01 c6                	add    %eax,%esi
+ 2e4:	eb 14                	jmp    2fa <memcmp+0x2a>
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 2f6:	39 f0                	cmp    %esi,%eax
+ 2f8:	74 16                	je     310 <memcmp+0x40>
+    if(*s1 != *s2)
+ 2fa:	0f b6 0a             	movzbl (%edx),%ecx
+ 2fd:	0f b6 18             	movzbl (%eax),%ebx
+ 300:	38 d9                	cmp    %bl,%cl
+ 302:	74 ec                	je     2f0 <memcmp+0x20>
+      return *s1 - *s2;
+ 304:	0f b6 c1             	movzbl %cl,%eax
+ 307:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	5b                   	pop    %ebx
+  return 0;
+ 311:	31 c0                	xor    %eax,%eax
+}
+ 313:	5e                   	pop    %esi
+ 314:	5d                   	pop    %ebp
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000320 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 320:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 330:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 332:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 338:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 33e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 344:	c3                   	ret
+ 345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 350:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 352:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 358:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 35e:	c3                   	ret
+ 35f:	90                   	nop
+
+00000360 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	53                   	push   %ebx
+ 366:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 368:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 36d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 373:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 379:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 37f:	89 c6                	mov    %eax,%esi
+ 381:	f7 f7                	div    %edi
+ 383:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 385:	f7 e3                	mul    %ebx
+ 387:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 38a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 38d:	89 d3                	mov    %edx,%ebx
+ 38f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 392:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 394:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 396:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 39c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3a1:	f7 e6                	mul    %esi
+ 3a3:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 3a9:	29 d9                	sub    %ebx,%ecx
+ 3ab:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 3b1:	01 c1                	add    %eax,%ecx
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5f                   	pop    %edi
+ 3bc:	5d                   	pop    %ebp
+ 3bd:	c3                   	ret
+
+000003be <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 3be:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3c3:	89 e1                	mov    %esp,%ecx
+ 3c5:	ba cc 03 00 00       	mov    $0x3cc,%edx
+ 3ca:	0f 34                	sysenter
+ 3cc:	c3                   	ret
+
+000003cd <exit>:
+SYSCALL(exit)
+ 3cd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d2:	89 e1                	mov    %esp,%ecx
+ 3d4:	ba db 03 00 00       	mov    $0x3db,%edx
+ 3d9:	0f 34                	sysenter
+ 3db:	c3                   	ret
+
+000003dc <wait>:
+SYSCALL(wait)
+ 3dc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e1:	89 e1                	mov    %esp,%ecx
+ 3e3:	ba ea 03 00 00       	mov    $0x3ea,%edx
+ 3e8:	0f 34                	sysenter
+ 3ea:	c3                   	ret
+
+000003eb <pipe>:
+SYSCALL(pipe)
+ 3eb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f0:	89 e1                	mov    %esp,%ecx
+ 3f2:	ba f9 03 00 00       	mov    $0x3f9,%edx
+ 3f7:	0f 34                	sysenter
+ 3f9:	c3                   	ret
+
+000003fa <read>:
+SYSCALL(read)
+ 3fa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3ff:	89 e1                	mov    %esp,%ecx
+ 401:	ba 08 04 00 00       	mov    $0x408,%edx
+ 406:	0f 34                	sysenter
+ 408:	c3                   	ret
+
+00000409 <write>:
+SYSCALL(write)
+ 409:	b8 10 00 00 00       	mov    $0x10,%eax
+ 40e:	89 e1                	mov    %esp,%ecx
+ 410:	ba 17 04 00 00       	mov    $0x417,%edx
+ 415:	0f 34                	sysenter
+ 417:	c3                   	ret
+
+00000418 <close>:
+SYSCALL(close)
+ 418:	b8 15 00 00 00       	mov    $0x15,%eax
+ 41d:	89 e1                	mov    %esp,%ecx
+ 41f:	ba 26 04 00 00       	mov    $0x426,%edx
+ 424:	0f 34                	sysenter
+ 426:	c3                   	ret
+
+00000427 <kill>:
+SYSCALL(kill)
+ 427:	b8 06 00 00 00       	mov    $0x6,%eax
+ 42c:	89 e1                	mov    %esp,%ecx
+ 42e:	ba 35 04 00 00       	mov    $0x435,%edx
+ 433:	0f 34                	sysenter
+ 435:	c3                   	ret
+
+00000436 <exec>:
+SYSCALL(exec)
+ 436:	b8 07 00 00 00       	mov    $0x7,%eax
+ 43b:	89 e1                	mov    %esp,%ecx
+ 43d:	ba 44 04 00 00       	mov    $0x444,%edx
+ 442:	0f 34                	sysenter
+ 444:	c3                   	ret
+
+00000445 <open>:
+SYSCALL(open)
+ 445:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 44a:	89 e1                	mov    %esp,%ecx
+ 44c:	ba 53 04 00 00       	mov    $0x453,%edx
+ 451:	0f 34                	sysenter
+ 453:	c3                   	ret
+
+00000454 <mknod>:
+SYSCALL(mknod)
+ 454:	b8 11 00 00 00       	mov    $0x11,%eax
+ 459:	89 e1                	mov    %esp,%ecx
+ 45b:	ba 62 04 00 00       	mov    $0x462,%edx
+ 460:	0f 34                	sysenter
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	89 e1                	mov    %esp,%ecx
+ 46a:	ba 71 04 00 00       	mov    $0x471,%edx
+ 46f:	0f 34                	sysenter
+ 471:	c3                   	ret
+
+00000472 <fstat>:
+SYSCALL(fstat)
+ 472:	b8 08 00 00 00       	mov    $0x8,%eax
+ 477:	89 e1                	mov    %esp,%ecx
+ 479:	ba 80 04 00 00       	mov    $0x480,%edx
+ 47e:	0f 34                	sysenter
+ 480:	c3                   	ret
+
+00000481 <link>:
+SYSCALL(link)
+ 481:	b8 13 00 00 00       	mov    $0x13,%eax
+ 486:	89 e1                	mov    %esp,%ecx
+ 488:	ba 8f 04 00 00       	mov    $0x48f,%edx
+ 48d:	0f 34                	sysenter
+ 48f:	c3                   	ret
+
+00000490 <mkdir>:
+SYSCALL(mkdir)
+ 490:	b8 14 00 00 00       	mov    $0x14,%eax
+ 495:	89 e1                	mov    %esp,%ecx
+ 497:	ba 9e 04 00 00       	mov    $0x49e,%edx
+ 49c:	0f 34                	sysenter
+ 49e:	c3                   	ret
+
+0000049f <chdir>:
+SYSCALL(chdir)
+ 49f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4a4:	89 e1                	mov    %esp,%ecx
+ 4a6:	ba ad 04 00 00       	mov    $0x4ad,%edx
+ 4ab:	0f 34                	sysenter
+ 4ad:	c3                   	ret
+
+000004ae <dup>:
+SYSCALL(dup)
+ 4ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4b3:	89 e1                	mov    %esp,%ecx
+ 4b5:	ba bc 04 00 00       	mov    $0x4bc,%edx
+ 4ba:	0f 34                	sysenter
+ 4bc:	c3                   	ret
+
+000004bd <sbrk>:
+SYSCALL(sbrk)
+ 4bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4c2:	89 e1                	mov    %esp,%ecx
+ 4c4:	ba cb 04 00 00       	mov    $0x4cb,%edx
+ 4c9:	0f 34                	sysenter
+ 4cb:	c3                   	ret
+
+000004cc <sleep>:
+SYSCALL(sleep)
+ 4cc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d1:	89 e1                	mov    %esp,%ecx
+ 4d3:	ba da 04 00 00       	mov    $0x4da,%edx
+ 4d8:	0f 34                	sysenter
+ 4da:	c3                   	ret
+
+000004db <fallocate>:
+SYSCALL(fallocate)
+ 4db:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e0:	89 e1                	mov    %esp,%ecx
+ 4e2:	ba e9 04 00 00       	mov    $0x4e9,%edx
+ 4e7:	0f 34                	sysenter
+ 4e9:	c3                   	ret
+
+000004ea <pread>:
+SYSCALL(pread)
+ 4ea:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4ef:	89 e1                	mov    %esp,%ecx
+ 4f1:	ba f8 04 00 00       	mov    $0x4f8,%edx
+ 4f6:	0f 34                	sysenter
+ 4f8:	c3                   	ret
+
+000004f9 <pwrite>:
+SYSCALL(pwrite)
+ 4f9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4fe:	89 e1                	mov    %esp,%ecx
+ 500:	ba 07 05 00 00       	mov    $0x507,%edx
+ 505:	0f 34                	sysenter
+ 507:	c3                   	ret
+
+00000508 <readv>:
+SYSCALL(readv)
+ 508:	b8 19 00 00 00       	mov    $0x19,%eax
+ 50d:	89 e1                	mov    %esp,%ecx
+ 50f:	ba 16 05 00 00       	mov    $0x516,%edx
+ 514:	0f 34                	sysenter
+ 516:	c3                   	ret
+
+00000517 <writev>:
+SYSCALL(writev)
+ 517:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 51c:	89 e1                	mov    %esp,%ecx
+ 51e:	ba 25 05 00 00       	mov    $0x525,%edx
+ 523:	0f 34                	sysenter
+ 525:	c3                   	ret
+
+00000526 <splice>:
+SYSCALL(splice)
+ 526:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 52b:	89 e1                	mov    %esp,%ecx
+ 52d:	ba 34 05 00 00       	mov    $0x534,%edx
+ 532:	0f 34                	sysenter
+ 534:	c3                   	ret
+
+00000535 <setpriority>:
+SYSCALL(setpriority)
+ 535:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 53a:	89 e1                	mov    %esp,%ecx
+ 53c:	ba 43 05 00 00       	mov    $0x543,%edx
+ 541:	0f 34                	sysenter
+ 543:	c3                   	ret
+
+00000544 <setaffinity>:
+SYSCALL(setaffinity)
+ 544:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 549:	89 e1                	mov    %esp,%ecx
+ 54b:	ba 52 05 00 00       	mov    $0x552,%edx
+ 550:	0f 34                	sysenter
+ 552:	c3                   	ret
+
+00000553 <lockstress>:
+SYSCALL(lockstress)
+ 553:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 558:	89 e1                	mov    %esp,%ecx
+ 55a:	ba 61 05 00 00       	mov    $0x561,%edx
+ 55f:	0f 34                	sysenter
+ 561:	c3                   	ret
+
+00000562 <lockstat>:
+SYSCALL(lockstat)
+ 562:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 567:	89 e1                	mov    %esp,%ecx
+ 569:	ba 70 05 00 00       	mov    $0x570,%edx
+ 56e:	0f 34                	sysenter
+ 570:	c3                   	ret
+
+00000571 <profctl>:
+SYSCALL(profctl)
+ 571:	b8 20 00 00 00       	mov    $0x20,%eax
+ 576:	89 e1                	mov    %esp,%ecx
+ 578:	ba 7f 05 00 00       	mov    $0x57f,%edx
+ 57d:	0f 34                	sysenter
+ 57f:	c3                   	ret
+
+00000580 <profread>:
+SYSCALL(profread)
+ 580:	b8 21 00 00 00       	mov    $0x21,%eax
+ 585:	89 e1                	mov    %esp,%ecx
+ 587:	ba 8e 05 00 00       	mov    $0x58e,%edx
+ 58c:	0f 34                	sysenter
+ 58e:	c3                   	ret
+
+0000058f <getrusage>:
+SYSCALL(getrusage)
+ 58f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 594:	89 e1                	mov    %esp,%ecx
+ 596:	ba 9d 05 00 00       	mov    $0x59d,%edx
+ 59b:	0f 34                	sysenter
+ 59d:	c3                   	ret
+
+0000059e <tracectl>:
+SYSCALL(tracectl)
+ 59e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5a3:	89 e1                	mov    %esp,%ecx
+ 5a5:	ba ac 05 00 00       	mov    $0x5ac,%edx
+ 5aa:	0f 34                	sysenter
+ 5ac:	c3                   	ret
+
+000005ad <traceread>:
+SYSCALL(traceread)
+ 5ad:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5b2:	89 e1                	mov    %esp,%ecx
+ 5b4:	ba bb 05 00 00       	mov    $0x5bb,%edx
+ 5b9:	0f 34                	sysenter
+ 5bb:	c3                   	ret
+
+000005bc <nanosleep>:
+SYSCALL(nanosleep)
+ 5bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5c1:	89 e1                	mov    %esp,%ecx
+ 5c3:	ba ca 05 00 00       	mov    $0x5ca,%edx
+ 5c8:	0f 34                	sysenter
+ 5ca:	c3                   	ret
+ 5cb:	66 90                	xchg   %ax,%ax
+ 5cd:	66 90                	xchg   %ax,%ax
+ 5cf:	90                   	nop
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5d8:	89 d1                	mov    %edx,%ecx
+{
+ 5da:	83 ec 3c             	sub    $0x3c,%esp
+ 5dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	85 d2                	test   %edx,%edx
+ 5e2:	0f 89 80 00 00 00    	jns    668 <printint+0x98>
+ 5e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ec:	74 7a                	je     668 <printint+0x98>
+    x = -xx;
+ 5ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5f8:	31 f6                	xor    %esi,%esi
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+ 604:	89 f7                	mov    %esi,%edi
+ 606:	f7 f3                	div    %ebx
+ 608:	8d 76 01             	lea    0x1(%esi),%esi
+ 60b:	0f b6 92 48 0a 00 00 	movzbl 0xa48(%edx),%edx
+ 612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 616:	89 ca                	mov    %ecx,%edx
+ 618:	89 c1                	mov    %eax,%ecx
+ 61a:	39 da                	cmp    %ebx,%edx
+ 61c:	73 e2                	jae    600 <printint+0x30>
+  if(neg)
+ 61e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 621:	85 c0                	test   %eax,%eax
+ 623:	74 07                	je     62c <printint+0x5c>
+    buf[i++] = '-';
+ 625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 62a:	89 f7                	mov    %esi,%edi
+ 62c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 62f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 632:	01 df                	add    %ebx,%edi
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 644:	6a 01                	push   $0x1
+ 646:	50                   	push   %eax
+ 647:	56                   	push   %esi
+ 648:	e8 bc fd ff ff       	call   409 <write>
+  while(--i >= 0)
+ 64d:	89 f8                	mov    %edi,%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	83 ef 01             	sub    $0x1,%edi
+ 655:	39 d8                	cmp    %ebx,%eax
+ 657:	75 df                	jne    638 <printint+0x68>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 668:	31 c0                	xor    %eax,%eax
+ 66a:	eb 89                	jmp    5f5 <printint+0x25>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 67c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 67f:	0f b6 1e             	movzbl (%esi),%ebx
+ 682:	83 c6 01             	add    $0x1,%esi
+ 685:	84 db                	test   %bl,%bl
+ 687:	74 67                	je     6f0 <printf+0x80>
+ 689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 691:	eb 34                	jmp    6c7 <printf+0x57>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 69b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6a0:	83 f8 25             	cmp    $0x25,%eax
+ 6a3:	74 18                	je     6bd <printf+0x4d>
+  write(fd, &c, 1);
+ 6a5:	83 ec 04             	sub    $0x4,%esp
+ 6a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	50                   	push   %eax
+ 6b1:	57                   	push   %edi
+ 6b2:	e8 52 fd ff ff       	call   409 <write>
+ 6b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c0:	83 c6 01             	add    $0x1,%esi
+ 6c3:	84 db                	test   %bl,%bl
+ 6c5:	74 29                	je     6f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ca:	85 d2                	test   %edx,%edx
+ 6cc:	74 ca                	je     698 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ce:	83 fa 25             	cmp    $0x25,%edx
+ 6d1:	75 ea                	jne    6bd <printf+0x4d>
+      if(c == 'd'){
+ 6d3:	83 f8 25             	cmp    $0x25,%eax
+ 6d6:	0f 84 24 01 00 00    	je     800 <printf+0x190>
+ 6dc:	83 e8 63             	sub    $0x63,%eax
+ 6df:	83 f8 15             	cmp    $0x15,%eax
+ 6e2:	77 1c                	ja     700 <printf+0x90>
+ 6e4:	ff 24 85 f0 09 00 00 	jmp    *0x9f0(,%eax,4)
+ 6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 70a:	6a 01                	push   $0x1
+ 70c:	52                   	push   %edx
+ 70d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 710:	57                   	push   %edi
+ 711:	e8 f3 fc ff ff       	call   409 <write>
+ 716:	83 c4 0c             	add    $0xc,%esp
+ 719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71c:	6a 01                	push   $0x1
+ 71e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 721:	52                   	push   %edx
+ 722:	57                   	push   %edi
+ 723:	e8 e1 fc ff ff       	call   409 <write>
+        putc(fd, c);
+ 728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72b:	31 d2                	xor    %edx,%edx
+ 72d:	eb 8e                	jmp    6bd <printf+0x4d>
+ 72f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 00                	push   $0x0
+ 73f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 744:	e8 87 fe ff ff       	call   5d0 <printint>
+        ap++;
+ 749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 67 ff ff ff       	jmp    6bd <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 765:	83 c0 04             	add    $0x4,%eax
+ 768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 76b:	85 db                	test   %ebx,%ebx
+ 76d:	0f 84 9d 00 00 00    	je     810 <printf+0x1a0>
+        while(*s != 0){
+ 773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 778:	84 c0                	test   %al,%al
+ 77a:	0f 84 3d ff ff ff    	je     6bd <printf+0x4d>
+ 780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 786:	89 de                	mov    %ebx,%esi
+ 788:	89 d3                	mov    %edx,%ebx
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	53                   	push   %ebx
+ 79c:	57                   	push   %edi
+ 79d:	e8 67 fc ff ff       	call   409 <write>
+        while(*s != 0){
+ 7a2:	0f b6 06             	movzbl (%esi),%eax
+ 7a5:	83 c4 10             	add    $0x10,%esp
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	75 e4                	jne    790 <printf+0x120>
+      state = 0;
+ 7ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 07 ff ff ff       	jmp    6bd <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 01                	push   $0x1
+ 7cf:	e9 6b ff ff ff       	jmp    73f <printf+0xcf>
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	52                   	push   %edx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 17 fc ff ff       	call   409 <write>
+        ap++;
+ 7f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f8:	31 d2                	xor    %edx,%edx
+ 7fa:	e9 be fe ff ff       	jmp    6bd <printf+0x4d>
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 809:	6a 01                	push   $0x1
+ 80b:	e9 11 ff ff ff       	jmp    721 <printf+0xb1>
+ 810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 815:	bb e8 09 00 00       	mov    $0x9e8,%ebx
+ 81a:	e9 61 ff ff ff       	jmp    780 <printf+0x110>
+ 81f:	90                   	nop
+
+00000820 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	a1 88 0d 00 00       	mov    0xd88,%eax
+{
+ 826:	89 e5                	mov    %esp,%ebp
+ 828:	57                   	push   %edi
+ 829:	56                   	push   %esi
+ 82a:	53                   	push   %ebx
+ 82b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 82e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 838:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 83a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 83c:	39 ca                	cmp    %ecx,%edx
+ 83e:	73 30                	jae    870 <free+0x50>
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 04                	jb     848 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 844:	39 c2                	cmp    %eax,%edx
+ 846:	72 f0                	jb     838 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 848:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 84b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 84e:	39 f8                	cmp    %edi,%eax
+ 850:	74 2e                	je     880 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 852:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 855:	8b 42 04             	mov    0x4(%edx),%eax
+ 858:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 85b:	39 f1                	cmp    %esi,%ecx
+ 85d:	74 38                	je     897 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 85f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 861:	5b                   	pop    %ebx
+  freep = p;
+ 862:	89 15 88 0d 00 00    	mov    %edx,0xd88
+}
+ 868:	5e                   	pop    %esi
+ 869:	5f                   	pop    %edi
+ 86a:	5d                   	pop    %ebp
+ 86b:	c3                   	ret
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 d0                	jb     844 <free+0x24>
+ 874:	eb c2                	jmp    838 <free+0x18>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 880:	03 70 04             	add    0x4(%eax),%esi
+ 883:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 886:	8b 02                	mov    (%edx),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 88d:	8b 42 04             	mov    0x4(%edx),%eax
+ 890:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 893:	39 f1                	cmp    %esi,%ecx
+ 895:	75 c8                	jne    85f <free+0x3f>
+    p->s.size += bp->s.size;
+ 897:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 89a:	89 15 88 0d 00 00    	mov    %edx,0xd88
+    p->s.size += bp->s.size;
+ 8a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8a8:	5b                   	pop    %ebx
+ 8a9:	5e                   	pop    %esi
+ 8aa:	5f                   	pop    %edi
+ 8ab:	5d                   	pop    %ebp
+ 8ac:	c3                   	ret
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8bc:	8b 15 88 0d 00 00    	mov    0xd88,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8c5:	c1 ef 03             	shr    $0x3,%edi
+ 8c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8cb:	85 d2                	test   %edx,%edx
+ 8cd:	0f 84 8d 00 00 00    	je     960 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d8:	39 f9                	cmp    %edi,%ecx
+ 8da:	73 64                	jae    940 <malloc+0x90>
+  if(nu < 4096)
+ 8dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8e1:	39 df                	cmp    %ebx,%edi
+ 8e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ed:	eb 0a                	jmp    8f9 <malloc+0x49>
+ 8ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f5:	39 f9                	cmp    %edi,%ecx
+ 8f7:	73 47                	jae    940 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8f9:	89 c2                	mov    %eax,%edx
+ 8fb:	39 05 88 0d 00 00    	cmp    %eax,0xd88
+ 901:	75 ed                	jne    8f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	56                   	push   %esi
+ 907:	e8 b1 fb ff ff       	call   4bd <sbrk>
+  if(p == (char*)-1)
+ 90c:	83 c4 10             	add    $0x10,%esp
+ 90f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 912:	74 1c                	je     930 <malloc+0x80>
+  hp->s.size = nu;
+ 914:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 917:	83 ec 0c             	sub    $0xc,%esp
+ 91a:	83 c0 08             	add    $0x8,%eax
+ 91d:	50                   	push   %eax
+ 91e:	e8 fd fe ff ff       	call   820 <free>
+  return freep;
+ 923:	8b 15 88 0d 00 00    	mov    0xd88,%edx
+      if((p = morecore(nunits)) == 0)
+ 929:	83 c4 10             	add    $0x10,%esp
+ 92c:	85 d2                	test   %edx,%edx
+ 92e:	75 c0                	jne    8f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 933:	31 c0                	xor    %eax,%eax
+}
+ 935:	5b                   	pop    %ebx
+ 936:	5e                   	pop    %esi
+ 937:	5f                   	pop    %edi
+ 938:	5d                   	pop    %ebp
+ 939:	c3                   	ret
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 940:	39 cf                	cmp    %ecx,%edi
+ 942:	74 4c                	je     990 <malloc+0xe0>
+        p->s.size -= nunits;
+ 944:	29 f9                	sub    %edi,%ecx
+ 946:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 949:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 94c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 94f:	89 15 88 0d 00 00    	mov    %edx,0xd88
+}
+ 955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 958:	83 c0 08             	add    $0x8,%eax
+}
+ 95b:	5b                   	pop    %ebx
+ 95c:	5e                   	pop    %esi
+ 95d:	5f                   	pop    %edi
+ 95e:	5d                   	pop    %ebp
+ 95f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 960:	c7 05 88 0d 00 00 8c 	movl   $0xd8c,0xd88
+ 967:	0d 00 00 
+    base.s.size = 0;
+ 96a:	b8 8c 0d 00 00       	mov    $0xd8c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 96f:	c7 05 8c 0d 00 00 8c 	movl   $0xd8c,0xd8c
+ 976:	0d 00 00 
+    base.s.size = 0;
+ 979:	c7 05 90 0d 00 00 00 	movl   $0x0,0xd90
+ 980:	00 00 00 
+    if(p->s.size >= nunits){
+ 983:	e9 54 ff ff ff       	jmp    8dc <malloc+0x2c>
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 990:	8b 08                	mov    (%eax),%ecx
+ 992:	89 0a                	mov    %ecx,(%edx)
+ 994:	eb b9                	jmp    94f <malloc+0x9f>
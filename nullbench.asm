@@ -0,0 +1,1514 @@
+
+_nullbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         how, N, ticks, (uint)(t >> LOGN));
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+  run("sysenter", sysgetpid);
+  11:	68 50 00 00 00       	push   $0x50
+  16:	68 1d 0a 00 00       	push   $0xa1d
+  1b:	e8 50 00 00 00       	call   70 <run>
+  run("int", intgetpid);
+  20:	58                   	pop    %eax
+  21:	5a                   	pop    %edx
+  22:	68 60 00 00 00       	push   $0x60
+  27:	68 26 0a 00 00       	push   $0xa26
+  2c:	e8 3f 00 00 00       	call   70 <run>
+  run("vdso", getpid);
+  31:	59                   	pop    %ecx
+  32:	58                   	pop    %eax
+  33:	68 70 03 00 00       	push   $0x370
+  38:	68 2a 0a 00 00       	push   $0xa2a
+  3d:	e8 2e 00 00 00       	call   70 <run>
+  exit();
+  42:	e8 d6 03 00 00       	call   41d <exit>
+  47:	66 90                	xchg   %ax,%ax
+  49:	66 90                	xchg   %ax,%ax
+  4b:	66 90                	xchg   %ax,%ax
+  4d:	66 90                	xchg   %ax,%ax
+  4f:	90                   	nop
+
+00000050 <sysgetpid>:
+  asm volatile("movl %%esp, %%ecx\n"
+  50:	b8 0b 00 00 00       	mov    $0xb,%eax
+  55:	89 e1                	mov    %esp,%ecx
+  57:	ba 5e 00 00 00       	mov    $0x5e,%edx
+  5c:	0f 34                	sysenter
+}
+  5e:	c3                   	ret
+  5f:	90                   	nop
+
+00000060 <intgetpid>:
+  asm volatile("int %1" : "=a" (pid) : "n" (T_SYSCALL), "0" (SYS_getpid) :
+  60:	b8 0b 00 00 00       	mov    $0xb,%eax
+  65:	cd 40                	int    $0x40
+}
+  67:	c3                   	ret
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+
+00000070 <run>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	53                   	push   %ebx
+  t0 = cycles();
+  76:	bb 00 00 08 00       	mov    $0x80000,%ebx
+{
+  7b:	83 ec 1c             	sub    $0x1c,%esp
+  7e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  start = uptime();
+  81:	e8 fa 02 00 00       	call   380 <uptime>
+  86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  t0 = cycles();
+  89:	e8 12 03 00 00       	call   3a0 <cycles>
+  8e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  91:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  for(i = 0; i < N; i++)
+  94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    fn();
+  98:	ff d6                	call   *%esi
+  for(i = 0; i < N; i++)
+  9a:	83 eb 01             	sub    $0x1,%ebx
+  9d:	75 f9                	jne    98 <run+0x28>
+  t = cycles() - t0;
+  9f:	e8 fc 02 00 00       	call   3a0 <cycles>
+  a4:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  a7:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+  aa:	89 d7                	mov    %edx,%edi
+  ac:	89 c6                	mov    %eax,%esi
+  ticks = uptime() - start;
+  ae:	e8 cd 02 00 00       	call   380 <uptime>
+         how, N, ticks, (uint)(t >> LOGN));
+  b3:	0f ac fe 13          	shrd   $0x13,%edi,%esi
+  printf(1, "%s: %d getpid calls in %d ticks, %d cycles per call\n",
+  b7:	83 ec 08             	sub    $0x8,%esp
+  ba:	56                   	push   %esi
+  ticks = uptime() - start;
+  bb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  be:	29 c8                	sub    %ecx,%eax
+  printf(1, "%s: %d getpid calls in %d ticks, %d cycles per call\n",
+  c0:	50                   	push   %eax
+  c1:	68 00 00 08 00       	push   $0x80000
+  c6:	ff 75 08             	push   0x8(%ebp)
+  c9:	68 e8 09 00 00       	push   $0x9e8
+  ce:	6a 01                	push   $0x1
+  d0:	e8 eb 05 00 00       	call   6c0 <printf>
+}
+  d5:	83 c4 20             	add    $0x20,%esp
+  d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  db:	5b                   	pop    %ebx
+  dc:	5e                   	pop    %esi
+  dd:	5f                   	pop    %edi
+  de:	5d                   	pop    %ebp
+  df:	c3                   	ret
+
+000000e0 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	75 12                	jne    1e3 <strchr+0x23>
+ 1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	84 d2                	test   %dl,%dl
+ 1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+ 1e3:	38 d1                	cmp    %dl,%cl
+ 1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1f0:	31 c0                	xor    %eax,%eax
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 209:	31 db                	xor    %ebx,%ebx
+{
+ 20b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 20e:	eb 27                	jmp    237 <gets+0x37>
+    cc = read(0, &c, 1);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	56                   	push   %esi
+ 216:	6a 00                	push   $0x0
+ 218:	e8 2d 02 00 00       	call   44a <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 1d                	jle    241 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22f:	3c 0a                	cmp    $0xa,%al
+ 231:	74 10                	je     243 <gets+0x43>
+ 233:	3c 0d                	cmp    $0xd,%al
+ 235:	74 0c                	je     243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 237:	89 df                	mov    %ebx,%edi
+ 239:	83 c3 01             	add    $0x1,%ebx
+ 23c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23f:	7c cf                	jl     210 <gets+0x10>
+ 241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 24a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24d:	5b                   	pop    %ebx
+ 24e:	5e                   	pop    %esi
+ 24f:	5f                   	pop    %edi
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+ 252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 23 02 00 00       	call   495 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	ff 75 0c             	push   0xc(%ebp)
+ 27f:	89 c3                	mov    %eax,%ebx
+ 281:	50                   	push   %eax
+ 282:	e8 3b 02 00 00       	call   4c2 <fstat>
+  close(fd);
+ 287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 28c:	e8 d7 01 00 00       	call   468 <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	89 f0                	mov    %esi,%eax
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ed                	jmp    294 <stat+0x34>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c5:	77 1e                	ja     2e5 <atoi+0x35>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2d0:	83 c2 01             	add    $0x1,%edx
+ 2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2da:	0f be 02             	movsbl (%edx),%eax
+ 2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	89 c8                	mov    %ecx,%eax
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+ 325:	8b 75 10             	mov    0x10(%ebp),%esi
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 32e:	85 f6                	test   %esi,%esi
+ 330:	74 2e                	je     360 <memcmp+0x40>
+ 332:	01 c6                	add    %eax,%esi
+ 334:	eb 14                	jmp    34a <memcmp+0x2a>
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 340:	83 c0 01             	add    $0x1,%eax
+ 343:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 346:	39 f0                	cmp    %esi,%eax
+ 348:	74 16                	je     360 <memcmp+0x40>
+    if(*s1 != *s2)
+ 34a:	0f b6 0a             	movzbl (%edx),%ecx
+ 34d:	0f b6 18             	movzbl (%eax),%ebx
+ 350:	38 d9                	cmp    %bl,%cl
+ 352:	74 ec                	je     340 <memcmp+0x20>
+      return *s1 - *s2;
+ 354:	0f b6 c1             	movzbl %cl,%eax
+ 357:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+ 360:	5b                   	pop    %ebx
+  return 0;
+ 361:	31 c0                	xor    %eax,%eax
+}
+ 363:	5e                   	pop    %esi
+ 364:	5d                   	pop    %ebp
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 370:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 375:	c3                   	ret
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000380 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 380:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 382:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 388:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 38e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 3a0:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 3a2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 3a8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 3ae:	c3                   	ret
+ 3af:	90                   	nop
+
+000003b0 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	53                   	push   %ebx
+ 3b6:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 3b8:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 3bd:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 3c3:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 3c9:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 3cf:	89 c6                	mov    %eax,%esi
+ 3d1:	f7 f7                	div    %edi
+ 3d3:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 3d5:	f7 e3                	mul    %ebx
+ 3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 3da:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 3dd:	89 d3                	mov    %edx,%ebx
+ 3df:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 3e2:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 3e4:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 3e6:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 3ec:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 3f1:	f7 e6                	mul    %esi
+ 3f3:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 3f9:	29 d9                	sub    %ebx,%ecx
+ 3fb:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 401:	01 c1                	add    %eax,%ecx
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5f                   	pop    %edi
+ 40c:	5d                   	pop    %ebp
+ 40d:	c3                   	ret
+
+0000040e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 40e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 413:	89 e1                	mov    %esp,%ecx
+ 415:	ba 1c 04 00 00       	mov    $0x41c,%edx
+ 41a:	0f 34                	sysenter
+ 41c:	c3                   	ret
+
+0000041d <exit>:
+SYSCALL(exit)
+ 41d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 422:	89 e1                	mov    %esp,%ecx
+ 424:	ba 2b 04 00 00       	mov    $0x42b,%edx
+ 429:	0f 34                	sysenter
+ 42b:	c3                   	ret
+
+0000042c <wait>:
+SYSCALL(wait)
+ 42c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 431:	89 e1                	mov    %esp,%ecx
+ 433:	ba 3a 04 00 00       	mov    $0x43a,%edx
+ 438:	0f 34                	sysenter
+ 43a:	c3                   	ret
+
+0000043b <pipe>:
+SYSCALL(pipe)
+ 43b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 440:	89 e1                	mov    %esp,%ecx
+ 442:	ba 49 04 00 00       	mov    $0x449,%edx
+ 447:	0f 34                	sysenter
+ 449:	c3                   	ret
+
+0000044a <read>:
+SYSCALL(read)
+ 44a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 44f:	89 e1                	mov    %esp,%ecx
+ 451:	ba 58 04 00 00       	mov    $0x458,%edx
+ 456:	0f 34                	sysenter
+ 458:	c3                   	ret
+
+00000459 <write>:
+SYSCALL(write)
+ 459:	b8 10 00 00 00       	mov    $0x10,%eax
+ 45e:	89 e1                	mov    %esp,%ecx
+ 460:	ba 67 04 00 00       	mov    $0x467,%edx
+ 465:	0f 34                	sysenter
+ 467:	c3                   	ret
+
+00000468 <close>:
+SYSCALL(close)
+ 468:	b8 15 00 00 00       	mov    $0x15,%eax
+ 46d:	89 e1                	mov    %esp,%ecx
+ 46f:	ba 76 04 00 00       	mov    $0x476,%edx
+ 474:	0f 34                	sysenter
+ 476:	c3                   	ret
+
+00000477 <kill>:
+SYSCALL(kill)
+ 477:	b8 06 00 00 00       	mov    $0x6,%eax
+ 47c:	89 e1                	mov    %esp,%ecx
+ 47e:	ba 85 04 00 00       	mov    $0x485,%edx
+ 483:	0f 34                	sysenter
+ 485:	c3                   	ret
+
+00000486 <exec>:
+SYSCALL(exec)
+ 486:	b8 07 00 00 00       	mov    $0x7,%eax
+ 48b:	89 e1                	mov    %esp,%ecx
+ 48d:	ba 94 04 00 00       	mov    $0x494,%edx
+ 492:	0f 34                	sysenter
+ 494:	c3                   	ret
+
+00000495 <open>:
+SYSCALL(open)
+ 495:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 49a:	89 e1                	mov    %esp,%ecx
+ 49c:	ba a3 04 00 00       	mov    $0x4a3,%edx
+ 4a1:	0f 34                	sysenter
+ 4a3:	c3                   	ret
+
+000004a4 <mknod>:
+SYSCALL(mknod)
+ 4a4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a9:	89 e1                	mov    %esp,%ecx
+ 4ab:	ba b2 04 00 00       	mov    $0x4b2,%edx
+ 4b0:	0f 34                	sysenter
+ 4b2:	c3                   	ret
+
+000004b3 <unlink>:
+SYSCALL(unlink)
+ 4b3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b8:	89 e1                	mov    %esp,%ecx
+ 4ba:	ba c1 04 00 00       	mov    $0x4c1,%edx
+ 4bf:	0f 34                	sysenter
+ 4c1:	c3                   	ret
+
+000004c2 <fstat>:
+SYSCALL(fstat)
+ 4c2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c7:	89 e1                	mov    %esp,%ecx
+ 4c9:	ba d0 04 00 00       	mov    $0x4d0,%edx
+ 4ce:	0f 34                	sysenter
+ 4d0:	c3                   	ret
+
+000004d1 <link>:
+SYSCALL(link)
+ 4d1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d6:	89 e1                	mov    %esp,%ecx
+ 4d8:	ba df 04 00 00       	mov    $0x4df,%edx
+ 4dd:	0f 34                	sysenter
+ 4df:	c3                   	ret
+
+000004e0 <mkdir>:
+SYSCALL(mkdir)
+ 4e0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e5:	89 e1                	mov    %esp,%ecx
+ 4e7:	ba ee 04 00 00       	mov    $0x4ee,%edx
+ 4ec:	0f 34                	sysenter
+ 4ee:	c3                   	ret
+
+000004ef <chdir>:
+SYSCALL(chdir)
+ 4ef:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f4:	89 e1                	mov    %esp,%ecx
+ 4f6:	ba fd 04 00 00       	mov    $0x4fd,%edx
+ 4fb:	0f 34                	sysenter
+ 4fd:	c3                   	ret
+
+000004fe <dup>:
+SYSCALL(dup)
+ 4fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 503:	89 e1                	mov    %esp,%ecx
+ 505:	ba 0c 05 00 00       	mov    $0x50c,%edx
+ 50a:	0f 34                	sysenter
+ 50c:	c3                   	ret
+
+0000050d <sbrk>:
+SYSCALL(sbrk)
+ 50d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 512:	89 e1                	mov    %esp,%ecx
+ 514:	ba 1b 05 00 00       	mov    $0x51b,%edx
+ 519:	0f 34                	sysenter
+ 51b:	c3                   	ret
+
+0000051c <sleep>:
+SYSCALL(sleep)
+ 51c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 521:	89 e1                	mov    %esp,%ecx
+ 523:	ba 2a 05 00 00       	mov    $0x52a,%edx
+ 528:	0f 34                	sysenter
+ 52a:	c3                   	ret
+
+0000052b <fallocate>:
+SYSCALL(fallocate)
+ 52b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 530:	89 e1                	mov    %esp,%ecx
+ 532:	ba 39 05 00 00       	mov    $0x539,%edx
+ 537:	0f 34                	sysenter
+ 539:	c3                   	ret
+
+0000053a <pread>:
+SYSCALL(pread)
+ 53a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 53f:	89 e1                	mov    %esp,%ecx
+ 541:	ba 48 05 00 00       	mov    $0x548,%edx
+ 546:	0f 34                	sysenter
+ 548:	c3                   	ret
+
+00000549 <pwrite>:
+SYSCALL(pwrite)
+ 549:	b8 18 00 00 00       	mov    $0x18,%eax
+ 54e:	89 e1                	mov    %esp,%ecx
+ 550:	ba 57 05 00 00       	mov    $0x557,%edx
+ 555:	0f 34                	sysenter
+ 557:	c3                   	ret
+
+00000558 <readv>:
+SYSCALL(readv)
+ 558:	b8 19 00 00 00       	mov    $0x19,%eax
+ 55d:	89 e1                	mov    %esp,%ecx
+ 55f:	ba 66 05 00 00       	mov    $0x566,%edx
+ 564:	0f 34                	sysenter
+ 566:	c3                   	ret
+
+00000567 <writev>:
+SYSCALL(writev)
+ 567:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 56c:	89 e1                	mov    %esp,%ecx
+ 56e:	ba 75 05 00 00       	mov    $0x575,%edx
+ 573:	0f 34                	sysenter
+ 575:	c3                   	ret
+
+00000576 <splice>:
+SYSCALL(splice)
+ 576:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 57b:	89 e1                	mov    %esp,%ecx
+ 57d:	ba 84 05 00 00       	mov    $0x584,%edx
+ 582:	0f 34                	sysenter
+ 584:	c3                   	ret
+
+00000585 <setpriority>:
+SYSCALL(setpriority)
+ 585:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 58a:	89 e1                	mov    %esp,%ecx
+ 58c:	ba 93 05 00 00       	mov    $0x593,%edx
+ 591:	0f 34                	sysenter
+ 593:	c3                   	ret
+
+00000594 <setaffinity>:
+SYSCALL(setaffinity)
+ 594:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 599:	89 e1                	mov    %esp,%ecx
+ 59b:	ba a2 05 00 00       	mov    $0x5a2,%edx
+ 5a0:	0f 34                	sysenter
+ 5a2:	c3                   	ret
+
+000005a3 <lockstress>:
+SYSCALL(lockstress)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	89 e1                	mov    %esp,%ecx
+ 5aa:	ba b1 05 00 00       	mov    $0x5b1,%edx
+ 5af:	0f 34                	sysenter
+ 5b1:	c3                   	ret
+
+000005b2 <lockstat>:
+SYSCALL(lockstat)
+ 5b2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b7:	89 e1                	mov    %esp,%ecx
+ 5b9:	ba c0 05 00 00       	mov    $0x5c0,%edx
+ 5be:	0f 34                	sysenter
+ 5c0:	c3                   	ret
+
+000005c1 <profctl>:
+SYSCALL(profctl)
+ 5c1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5c6:	89 e1                	mov    %esp,%ecx
+ 5c8:	ba cf 05 00 00       	mov    $0x5cf,%edx
+ 5cd:	0f 34                	sysenter
+ 5cf:	c3                   	ret
+
+000005d0 <profread>:
+SYSCALL(profread)
+ 5d0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba de 05 00 00       	mov    $0x5de,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	c3                   	ret
+
+000005df <getrusage>:
+SYSCALL(getrusage)
+ 5df:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e4:	89 e1                	mov    %esp,%ecx
+ 5e6:	ba ed 05 00 00       	mov    $0x5ed,%edx
+ 5eb:	0f 34                	sysenter
+ 5ed:	c3                   	ret
+
+000005ee <tracectl>:
+SYSCALL(tracectl)
+ 5ee:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f3:	89 e1                	mov    %esp,%ecx
+ 5f5:	ba fc 05 00 00       	mov    $0x5fc,%edx
+ 5fa:	0f 34                	sysenter
+ 5fc:	c3                   	ret
+
+000005fd <traceread>:
+SYSCALL(traceread)
+ 5fd:	b8 24 00 00 00       	mov    $0x24,%eax
+ 602:	89 e1                	mov    %esp,%ecx
+ 604:	ba 0b 06 00 00       	mov    $0x60b,%edx
+ 609:	0f 34                	sysenter
+ 60b:	c3                   	ret
+
+0000060c <nanosleep>:
+SYSCALL(nanosleep)
+ 60c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 611:	89 e1                	mov    %esp,%ecx
+ 613:	ba 1a 06 00 00       	mov    $0x61a,%edx
+ 618:	0f 34                	sysenter
+ 61a:	c3                   	ret
+ 61b:	66 90                	xchg   %ax,%ax
+ 61d:	66 90                	xchg   %ax,%ax
+ 61f:	90                   	nop
+
+00000620 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 628:	89 d1                	mov    %edx,%ecx
+{
+ 62a:	83 ec 3c             	sub    $0x3c,%esp
+ 62d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 630:	85 d2                	test   %edx,%edx
+ 632:	0f 89 80 00 00 00    	jns    6b8 <printint+0x98>
+ 638:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 63c:	74 7a                	je     6b8 <printint+0x98>
+    x = -xx;
+ 63e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 640:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 645:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 648:	31 f6                	xor    %esi,%esi
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	31 d2                	xor    %edx,%edx
+ 654:	89 f7                	mov    %esi,%edi
+ 656:	f7 f3                	div    %ebx
+ 658:	8d 76 01             	lea    0x1(%esi),%esi
+ 65b:	0f b6 92 90 0a 00 00 	movzbl 0xa90(%edx),%edx
+ 662:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 666:	89 ca                	mov    %ecx,%edx
+ 668:	89 c1                	mov    %eax,%ecx
+ 66a:	39 da                	cmp    %ebx,%edx
+ 66c:	73 e2                	jae    650 <printint+0x30>
+  if(neg)
+ 66e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 07                	je     67c <printint+0x5c>
+    buf[i++] = '-';
+ 675:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 67a:	89 f7                	mov    %esi,%edi
+ 67c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 67f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 682:	01 df                	add    %ebx,%edi
+ 684:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 688:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 691:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 694:	6a 01                	push   $0x1
+ 696:	50                   	push   %eax
+ 697:	56                   	push   %esi
+ 698:	e8 bc fd ff ff       	call   459 <write>
+  while(--i >= 0)
+ 69d:	89 f8                	mov    %edi,%eax
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	83 ef 01             	sub    $0x1,%edi
+ 6a5:	39 d8                	cmp    %ebx,%eax
+ 6a7:	75 df                	jne    688 <printint+0x68>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6b8:	31 c0                	xor    %eax,%eax
+ 6ba:	eb 89                	jmp    645 <printint+0x25>
+ 6bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d2:	83 c6 01             	add    $0x1,%esi
+ 6d5:	84 db                	test   %bl,%bl
+ 6d7:	74 67                	je     740 <printf+0x80>
+ 6d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6dc:	31 d2                	xor    %edx,%edx
+ 6de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6e1:	eb 34                	jmp    717 <printf+0x57>
+ 6e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6e7:	90                   	nop
+ 6e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6f0:	83 f8 25             	cmp    $0x25,%eax
+ 6f3:	74 18                	je     70d <printf+0x4d>
+  write(fd, &c, 1);
+ 6f5:	83 ec 04             	sub    $0x4,%esp
+ 6f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fe:	6a 01                	push   $0x1
+ 700:	50                   	push   %eax
+ 701:	57                   	push   %edi
+ 702:	e8 52 fd ff ff       	call   459 <write>
+ 707:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 70a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 70d:	0f b6 1e             	movzbl (%esi),%ebx
+ 710:	83 c6 01             	add    $0x1,%esi
+ 713:	84 db                	test   %bl,%bl
+ 715:	74 29                	je     740 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 717:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 71a:	85 d2                	test   %edx,%edx
+ 71c:	74 ca                	je     6e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 71e:	83 fa 25             	cmp    $0x25,%edx
+ 721:	75 ea                	jne    70d <printf+0x4d>
+      if(c == 'd'){
+ 723:	83 f8 25             	cmp    $0x25,%eax
+ 726:	0f 84 24 01 00 00    	je     850 <printf+0x190>
+ 72c:	83 e8 63             	sub    $0x63,%eax
+ 72f:	83 f8 15             	cmp    $0x15,%eax
+ 732:	77 1c                	ja     750 <printf+0x90>
+ 734:	ff 24 85 38 0a 00 00 	jmp    *0xa38(,%eax,4)
+ 73b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 73f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 740:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 743:	5b                   	pop    %ebx
+ 744:	5e                   	pop    %esi
+ 745:	5f                   	pop    %edi
+ 746:	5d                   	pop    %ebp
+ 747:	c3                   	ret
+ 748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 756:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 75a:	6a 01                	push   $0x1
+ 75c:	52                   	push   %edx
+ 75d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 760:	57                   	push   %edi
+ 761:	e8 f3 fc ff ff       	call   459 <write>
+ 766:	83 c4 0c             	add    $0xc,%esp
+ 769:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 76c:	6a 01                	push   $0x1
+ 76e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 771:	52                   	push   %edx
+ 772:	57                   	push   %edi
+ 773:	e8 e1 fc ff ff       	call   459 <write>
+        putc(fd, c);
+ 778:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77b:	31 d2                	xor    %edx,%edx
+ 77d:	eb 8e                	jmp    70d <printf+0x4d>
+ 77f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 00                	push   $0x0
+ 78f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 791:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 794:	e8 87 fe ff ff       	call   620 <printint>
+        ap++;
+ 799:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 79c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 67 ff ff ff       	jmp    70d <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7b5:	83 c0 04             	add    $0x4,%eax
+ 7b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7bb:	85 db                	test   %ebx,%ebx
+ 7bd:	0f 84 9d 00 00 00    	je     860 <printf+0x1a0>
+        while(*s != 0){
+ 7c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7c8:	84 c0                	test   %al,%al
+ 7ca:	0f 84 3d ff ff ff    	je     70d <printf+0x4d>
+ 7d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7d6:	89 de                	mov    %ebx,%esi
+ 7d8:	89 d3                	mov    %edx,%ebx
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	53                   	push   %ebx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 67 fc ff ff       	call   459 <write>
+        while(*s != 0){
+ 7f2:	0f b6 06             	movzbl (%esi),%eax
+ 7f5:	83 c4 10             	add    $0x10,%esp
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	75 e4                	jne    7e0 <printf+0x120>
+      state = 0;
+ 7fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7ff:	31 d2                	xor    %edx,%edx
+ 801:	e9 07 ff ff ff       	jmp    70d <printf+0x4d>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 810:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 81b:	8b 13                	mov    (%ebx),%edx
+ 81d:	6a 01                	push   $0x1
+ 81f:	e9 6b ff ff ff       	jmp    78f <printf+0xcf>
+ 824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 828:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 82b:	83 ec 04             	sub    $0x4,%esp
+ 82e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 831:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 833:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 836:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	52                   	push   %edx
+ 83c:	57                   	push   %edi
+ 83d:	e8 17 fc ff ff       	call   459 <write>
+        ap++;
+ 842:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 845:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 848:	31 d2                	xor    %edx,%edx
+ 84a:	e9 be fe ff ff       	jmp    70d <printf+0x4d>
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 856:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 859:	6a 01                	push   $0x1
+ 85b:	e9 11 ff ff ff       	jmp    771 <printf+0xb1>
+ 860:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 865:	bb 2f 0a 00 00       	mov    $0xa2f,%ebx
+ 86a:	e9 61 ff ff ff       	jmp    7d0 <printf+0x110>
+ 86f:	90                   	nop
+
+00000870 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 870:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	a1 1c 0e 00 00       	mov    0xe1c,%eax
+{
+ 876:	89 e5                	mov    %esp,%ebp
+ 878:	57                   	push   %edi
+ 879:	56                   	push   %esi
+ 87a:	53                   	push   %ebx
+ 87b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 87e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 888:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88c:	39 ca                	cmp    %ecx,%edx
+ 88e:	73 30                	jae    8c0 <free+0x50>
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 04                	jb     898 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 894:	39 c2                	cmp    %eax,%edx
+ 896:	72 f0                	jb     888 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 898:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 89b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 89e:	39 f8                	cmp    %edi,%eax
+ 8a0:	74 2e                	je     8d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8ab:	39 f1                	cmp    %esi,%ecx
+ 8ad:	74 38                	je     8e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b1:	5b                   	pop    %ebx
+  freep = p;
+ 8b2:	89 15 1c 0e 00 00    	mov    %edx,0xe1c
+}
+ 8b8:	5e                   	pop    %esi
+ 8b9:	5f                   	pop    %edi
+ 8ba:	5d                   	pop    %ebp
+ 8bb:	c3                   	ret
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 d0                	jb     894 <free+0x24>
+ 8c4:	eb c2                	jmp    888 <free+0x18>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 70 04             	add    0x4(%eax),%esi
+ 8d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8e3:	39 f1                	cmp    %esi,%ecx
+ 8e5:	75 c8                	jne    8af <free+0x3f>
+    p->s.size += bp->s.size;
+ 8e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ea:	89 15 1c 0e 00 00    	mov    %edx,0xe1c
+    p->s.size += bp->s.size;
+ 8f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f8:	5b                   	pop    %ebx
+ 8f9:	5e                   	pop    %esi
+ 8fa:	5f                   	pop    %edi
+ 8fb:	5d                   	pop    %ebp
+ 8fc:	c3                   	ret
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 909:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 90c:	8b 15 1c 0e 00 00    	mov    0xe1c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 912:	8d 78 07             	lea    0x7(%eax),%edi
+ 915:	c1 ef 03             	shr    $0x3,%edi
+ 918:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 91b:	85 d2                	test   %edx,%edx
+ 91d:	0f 84 8d 00 00 00    	je     9b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 923:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 925:	8b 48 04             	mov    0x4(%eax),%ecx
+ 928:	39 f9                	cmp    %edi,%ecx
+ 92a:	73 64                	jae    990 <malloc+0x90>
+  if(nu < 4096)
+ 92c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 931:	39 df                	cmp    %ebx,%edi
+ 933:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 936:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 93d:	eb 0a                	jmp    949 <malloc+0x49>
+ 93f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 942:	8b 48 04             	mov    0x4(%eax),%ecx
+ 945:	39 f9                	cmp    %edi,%ecx
+ 947:	73 47                	jae    990 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 949:	89 c2                	mov    %eax,%edx
+ 94b:	39 05 1c 0e 00 00    	cmp    %eax,0xe1c
+ 951:	75 ed                	jne    940 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	56                   	push   %esi
+ 957:	e8 b1 fb ff ff       	call   50d <sbrk>
+  if(p == (char*)-1)
+ 95c:	83 c4 10             	add    $0x10,%esp
+ 95f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 962:	74 1c                	je     980 <malloc+0x80>
+  hp->s.size = nu;
+ 964:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 967:	83 ec 0c             	sub    $0xc,%esp
+ 96a:	83 c0 08             	add    $0x8,%eax
+ 96d:	50                   	push   %eax
+ 96e:	e8 fd fe ff ff       	call   870 <free>
+  return freep;
+ 973:	8b 15 1c 0e 00 00    	mov    0xe1c,%edx
+      if((p = morecore(nunits)) == 0)
+ 979:	83 c4 10             	add    $0x10,%esp
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	75 c0                	jne    940 <malloc+0x40>
+        return 0;
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 983:	31 c0                	xor    %eax,%eax
+}
+ 985:	5b                   	pop    %ebx
+ 986:	5e                   	pop    %esi
+ 987:	5f                   	pop    %edi
+ 988:	5d                   	pop    %ebp
+ 989:	c3                   	ret
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 990:	39 cf                	cmp    %ecx,%edi
+ 992:	74 4c                	je     9e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 994:	29 f9                	sub    %edi,%ecx
+ 996:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 999:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 99c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 99f:	89 15 1c 0e 00 00    	mov    %edx,0xe1c
+}
+ 9a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9a8:	83 c0 08             	add    $0x8,%eax
+}
+ 9ab:	5b                   	pop    %ebx
+ 9ac:	5e                   	pop    %esi
+ 9ad:	5f                   	pop    %edi
+ 9ae:	5d                   	pop    %ebp
+ 9af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9b0:	c7 05 1c 0e 00 00 20 	movl   $0xe20,0xe1c
+ 9b7:	0e 00 00 
+    base.s.size = 0;
+ 9ba:	b8 20 0e 00 00       	mov    $0xe20,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 05 20 0e 00 00 20 	movl   $0xe20,0xe20
+ 9c6:	0e 00 00 
+    base.s.size = 0;
+ 9c9:	c7 05 24 0e 00 00 00 	movl   $0x0,0xe24
+ 9d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9d3:	e9 54 ff ff ff       	jmp    92c <malloc+0x2c>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9e0:	8b 08                	mov    (%eax),%ecx
+ 9e2:	89 0a                	mov    %ecx,(%edx)
+ 9e4:	eb b9                	jmp    99f <malloc+0x9f>
@@ -0,0 +1,66 @@
+// System call latency benchmark.
+// Times a loop of getpid system calls, which do almost nothing
+// but enter and leave the kernel: once by sysenter, as the stubs
+// in usys.S do, and once through the int $T_SYSCALL trap gate.
+// For comparison, also times ulib's getpid(), which reads the
+// vdso page and doesn't enter the kernel at all.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+
+#define LOGN 19
+#define N    (1 << LOGN)  // calls per run
+
+// The getpid system call, made the way usys.S would.
+int
+sysgetpid(void)
+{
+  int pid;
+
+  asm volatile("movl %%esp, %%ecx\n"
+               "movl $1f, %%edx\n"
+               "sysenter\n"
+               "1:" : "=a" (pid) : "0" (SYS_getpid) :
+               "ecx", "edx", "memory", "cc");
+  return pid;
+}
+
+// The getpid system call, by the old road.
+int
+intgetpid(void)
+{
+  int pid;
+
+  asm volatile("int %1" : "=a" (pid) : "n" (T_SYSCALL), "0" (SYS_getpid) :
+               "memory");
+  return pid;
+}
+
+void
+run(char *how, int (*fn)(void))
+{
+  uint64 t0, t;
+  int i, start, ticks;
+
+  start = uptime();
+  t0 = cycles();
+  for(i = 0; i < N; i++)
+    fn();
+  t = cycles() - t0;
+  ticks = uptime() - start;
+
+  printf(1, "%s: %d getpid calls in %d ticks, %d cycles per call\n",
+         how, N, ticks, (uint)(t >> LOGN));
+}
+
+int
+main(void)
+{
+  run("sysenter", sysgetpid);
+  run("int", intgetpid);
+  run("vdso", getpid);
+  exit();
+}
@@ -1,14 +1,23 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NMCS          4  // MCS locks a CPU can hold at once
+#define NLOCKSTAT    64  // lock names that lockstat keeps apart
+#define NPROF      1024  // profiler samples buffered per CPU
+#define NTRACE     1024  // trace events kept per CPU
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
+#define NFILE       100  // open files per system before the table grows
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define MAXIOV       16  // max buffers per readv/writev
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define NSYSCALL     38  // system call numbers are below this
+#define FSSIZE       2000  // size of file system in blocks
+#define PIPEPAGES    1  // pages in a pipe's buffer; must be a power of 2
+#define NPRIO         4  // MLFQ priority levels; level i runs 2^i ticks
+#define BOOSTTICKS  100  // MLFQ: ticks between boosts to the top level
 
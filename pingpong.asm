@@ -0,0 +1,1657 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nidle, ROUNDS, ticks);
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+  int i;
+
+  for(i = 0; i < sizeof(idlers)/sizeof(idlers[0]); i++)
+   e:	31 db                	xor    %ebx,%ebx
+{
+  10:	51                   	push   %ecx
+  11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bench(idlers[i]);
+  18:	83 ec 0c             	sub    $0xc,%esp
+  1b:	ff 34 9d 9c 0f 00 00 	push   0xf9c(,%ebx,4)
+  for(i = 0; i < sizeof(idlers)/sizeof(idlers[0]); i++)
+  22:	83 c3 01             	add    $0x1,%ebx
+    bench(idlers[i]);
+  25:	e8 16 00 00 00       	call   40 <bench>
+  for(i = 0; i < sizeof(idlers)/sizeof(idlers[0]); i++)
+  2a:	83 c4 10             	add    $0x10,%esp
+  2d:	83 fb 05             	cmp    $0x5,%ebx
+  30:	75 e6                	jne    18 <main+0x18>
+  exit();
+  32:	e8 56 05 00 00       	call   58d <exit>
+  37:	66 90                	xchg   %ax,%ax
+  39:	66 90                	xchg   %ax,%ax
+  3b:	66 90                	xchg   %ax,%ax
+  3d:	66 90                	xchg   %ax,%ax
+  3f:	90                   	nop
+
+00000040 <bench>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  if(pipe(hold) < 0 || pipe(ping) < 0 || pipe(pong) < 0){
+  45:	8d 45 d0             	lea    -0x30(%ebp),%eax
+{
+  48:	53                   	push   %ebx
+  49:	83 ec 48             	sub    $0x48,%esp
+  4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if(pipe(hold) < 0 || pipe(ping) < 0 || pipe(pong) < 0){
+  4f:	50                   	push   %eax
+  50:	e8 56 05 00 00       	call   5ab <pipe>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	0f 88 d7 01 00 00    	js     237 <bench+0x1f7>
+  60:	83 ec 0c             	sub    $0xc,%esp
+  63:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  66:	50                   	push   %eax
+  67:	e8 3f 05 00 00       	call   5ab <pipe>
+  6c:	83 c4 10             	add    $0x10,%esp
+  6f:	85 c0                	test   %eax,%eax
+  71:	0f 88 c0 01 00 00    	js     237 <bench+0x1f7>
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  7d:	50                   	push   %eax
+  7e:	e8 28 05 00 00       	call   5ab <pipe>
+  83:	83 c4 10             	add    $0x10,%esp
+  86:	85 c0                	test   %eax,%eax
+  88:	0f 88 a9 01 00 00    	js     237 <bench+0x1f7>
+  for(i = 0; i < nidle; i++){
+  8e:	31 db                	xor    %ebx,%ebx
+  90:	85 ff                	test   %edi,%edi
+  92:	7e 1e                	jle    b2 <bench+0x72>
+  94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pid = fork()) < 0){
+  98:	e8 e1 04 00 00       	call   57e <fork>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	0f 88 0c 01 00 00    	js     1b1 <bench+0x171>
+    if(pid == 0){
+  a5:	0f 84 1a 01 00 00    	je     1c5 <bench+0x185>
+  for(i = 0; i < nidle; i++){
+  ab:	83 c3 01             	add    $0x1,%ebx
+  ae:	39 df                	cmp    %ebx,%edi
+  b0:	75 e6                	jne    98 <bench+0x58>
+  close(hold[0]);
+  b2:	83 ec 0c             	sub    $0xc,%esp
+  b5:	ff 75 d0             	push   -0x30(%ebp)
+  b8:	e8 1b 05 00 00       	call   5d8 <close>
+  if((pid = fork()) < 0){
+  bd:	e8 bc 04 00 00       	call   57e <fork>
+  c2:	83 c4 10             	add    $0x10,%esp
+  c5:	85 c0                	test   %eax,%eax
+  c7:	0f 88 e4 00 00 00    	js     1b1 <bench+0x171>
+  if(pid == 0){
+  cd:	0f 84 13 01 00 00    	je     1e6 <bench+0x1a6>
+  close(ping[0]);
+  d3:	83 ec 0c             	sub    $0xc,%esp
+  d6:	ff 75 d8             	push   -0x28(%ebp)
+  start = uptime();
+  d9:	bb d0 07 00 00       	mov    $0x7d0,%ebx
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+  de:	8d 75 cf             	lea    -0x31(%ebp),%esi
+  close(ping[0]);
+  e1:	e8 f2 04 00 00       	call   5d8 <close>
+  close(pong[1]);
+  e6:	59                   	pop    %ecx
+  e7:	ff 75 e4             	push   -0x1c(%ebp)
+  ea:	e8 e9 04 00 00       	call   5d8 <close>
+  start = uptime();
+  ef:	e8 fc 03 00 00       	call   4f0 <uptime>
+  f4:	83 c4 10             	add    $0x10,%esp
+  f7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < ROUNDS; i++){
+  fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	6a 01                	push   $0x1
+ 105:	68 86 0b 00 00       	push   $0xb86
+ 10a:	ff 75 dc             	push   -0x24(%ebp)
+ 10d:	e8 b7 04 00 00       	call   5c9 <write>
+ 112:	83 c4 10             	add    $0x10,%esp
+ 115:	83 f8 01             	cmp    $0x1,%eax
+ 118:	0f 85 7f 00 00 00    	jne    19d <bench+0x15d>
+ 11e:	83 ec 04             	sub    $0x4,%esp
+ 121:	6a 01                	push   $0x1
+ 123:	56                   	push   %esi
+ 124:	ff 75 e0             	push   -0x20(%ebp)
+ 127:	e8 8e 04 00 00       	call   5ba <read>
+ 12c:	83 c4 10             	add    $0x10,%esp
+ 12f:	83 f8 01             	cmp    $0x1,%eax
+ 132:	75 69                	jne    19d <bench+0x15d>
+  for(i = 0; i < ROUNDS; i++){
+ 134:	83 eb 01             	sub    $0x1,%ebx
+ 137:	75 c7                	jne    100 <bench+0xc0>
+  ticks = uptime() - start;
+ 139:	e8 b2 03 00 00       	call   4f0 <uptime>
+  close(ping[1]);
+ 13e:	83 ec 0c             	sub    $0xc,%esp
+  ticks = uptime() - start;
+ 141:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  close(ping[1]);
+ 144:	ff 75 dc             	push   -0x24(%ebp)
+  ticks = uptime() - start;
+ 147:	29 d0                	sub    %edx,%eax
+ 149:	89 c3                	mov    %eax,%ebx
+  close(ping[1]);
+ 14b:	e8 88 04 00 00       	call   5d8 <close>
+  close(pong[0]);
+ 150:	58                   	pop    %eax
+ 151:	ff 75 e0             	push   -0x20(%ebp)
+ 154:	e8 7f 04 00 00       	call   5d8 <close>
+  close(hold[1]);
+ 159:	5a                   	pop    %edx
+ 15a:	ff 75 d4             	push   -0x2c(%ebp)
+ 15d:	e8 76 04 00 00       	call   5d8 <close>
+  for(i = 0; i < nidle + 1; i++)
+ 162:	83 c4 10             	add    $0x10,%esp
+ 165:	85 ff                	test   %edi,%edi
+ 167:	78 13                	js     17c <bench+0x13c>
+ 169:	31 f6                	xor    %esi,%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+    wait();
+ 170:	e8 27 04 00 00       	call   59c <wait>
+  for(i = 0; i < nidle + 1; i++)
+ 175:	83 c6 01             	add    $0x1,%esi
+ 178:	39 f7                	cmp    %esi,%edi
+ 17a:	7d f4                	jge    170 <bench+0x130>
+  printf(1, "%d sleeping: %d round trips in %d ticks\n",
+ 17c:	83 ec 0c             	sub    $0xc,%esp
+ 17f:	53                   	push   %ebx
+ 180:	68 d0 07 00 00       	push   $0x7d0
+ 185:	57                   	push   %edi
+ 186:	68 a8 0b 00 00       	push   $0xba8
+ 18b:	6a 01                	push   $0x1
+ 18d:	e8 9e 06 00 00       	call   830 <printf>
+}
+ 192:	83 c4 20             	add    $0x20,%esp
+ 195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 198:	5b                   	pop    %ebx
+ 199:	5e                   	pop    %esi
+ 19a:	5f                   	pop    %edi
+ 19b:	5d                   	pop    %ebp
+ 19c:	c3                   	ret
+      printf(2, "pingpong: round trip failed\n");
+ 19d:	83 ec 08             	sub    $0x8,%esp
+ 1a0:	68 88 0b 00 00       	push   $0xb88
+ 1a5:	6a 02                	push   $0x2
+ 1a7:	e8 84 06 00 00       	call   830 <printf>
+      exit();
+ 1ac:	e8 dc 03 00 00       	call   58d <exit>
+      printf(2, "pingpong: fork failed\n");
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	68 6f 0b 00 00       	push   $0xb6f
+ 1b9:	6a 02                	push   $0x2
+ 1bb:	e8 70 06 00 00       	call   830 <printf>
+      exit();
+ 1c0:	e8 c8 03 00 00       	call   58d <exit>
+      close(hold[1]);
+ 1c5:	83 ec 0c             	sub    $0xc,%esp
+ 1c8:	ff 75 d4             	push   -0x2c(%ebp)
+ 1cb:	e8 08 04 00 00       	call   5d8 <close>
+      read(hold[0], &c, 1);
+ 1d0:	83 c4 0c             	add    $0xc,%esp
+ 1d3:	8d 45 cf             	lea    -0x31(%ebp),%eax
+ 1d6:	6a 01                	push   $0x1
+ 1d8:	50                   	push   %eax
+ 1d9:	ff 75 d0             	push   -0x30(%ebp)
+ 1dc:	e8 d9 03 00 00       	call   5ba <read>
+      exit();
+ 1e1:	e8 a7 03 00 00       	call   58d <exit>
+    close(hold[1]);
+ 1e6:	83 ec 0c             	sub    $0xc,%esp
+ 1e9:	ff 75 d4             	push   -0x2c(%ebp)
+ 1ec:	e8 e7 03 00 00       	call   5d8 <close>
+    close(ping[1]);
+ 1f1:	5b                   	pop    %ebx
+ 1f2:	ff 75 dc             	push   -0x24(%ebp)
+ 1f5:	8d 5d cf             	lea    -0x31(%ebp),%ebx
+ 1f8:	e8 db 03 00 00       	call   5d8 <close>
+    close(pong[0]);
+ 1fd:	5e                   	pop    %esi
+ 1fe:	ff 75 e0             	push   -0x20(%ebp)
+ 201:	e8 d2 03 00 00       	call   5d8 <close>
+    while(read(ping[0], &c, 1) == 1)
+ 206:	83 c4 10             	add    $0x10,%esp
+ 209:	eb 11                	jmp    21c <bench+0x1dc>
+      write(pong[1], &c, 1);
+ 20b:	83 ec 04             	sub    $0x4,%esp
+ 20e:	6a 01                	push   $0x1
+ 210:	53                   	push   %ebx
+ 211:	ff 75 e4             	push   -0x1c(%ebp)
+ 214:	e8 b0 03 00 00       	call   5c9 <write>
+ 219:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+ 21c:	83 ec 04             	sub    $0x4,%esp
+ 21f:	6a 01                	push   $0x1
+ 221:	53                   	push   %ebx
+ 222:	ff 75 d8             	push   -0x28(%ebp)
+ 225:	e8 90 03 00 00       	call   5ba <read>
+ 22a:	83 c4 10             	add    $0x10,%esp
+ 22d:	83 f8 01             	cmp    $0x1,%eax
+ 230:	74 d9                	je     20b <bench+0x1cb>
+    exit();
+ 232:	e8 56 03 00 00       	call   58d <exit>
+    printf(2, "pingpong: pipe failed\n");
+ 237:	83 ec 08             	sub    $0x8,%esp
+ 23a:	68 58 0b 00 00       	push   $0xb58
+ 23f:	6a 02                	push   $0x2
+ 241:	e8 ea 05 00 00       	call   830 <printf>
+    exit();
+ 246:	e8 42 03 00 00       	call   58d <exit>
+ 24b:	66 90                	xchg   %ax,%ax
+ 24d:	66 90                	xchg   %ax,%ax
+ 24f:	90                   	nop
+
+00000250 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 2d 02 00 00       	call   5ba <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 23 02 00 00       	call   605 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 3b 02 00 00       	call   632 <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 d7 01 00 00       	call   5d8 <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	56                   	push   %esi
+ 494:	53                   	push   %ebx
+ 495:	8b 75 10             	mov    0x10(%ebp),%esi
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 49e:	85 f6                	test   %esi,%esi
+ 4a0:	74 2e                	je     4d0 <memcmp+0x40>
+ 4a2:	01 c6                	add    %eax,%esi
+ 4a4:	eb 14                	jmp    4ba <memcmp+0x2a>
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 4b0:	83 c0 01             	add    $0x1,%eax
+ 4b3:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 4b6:	39 f0                	cmp    %esi,%eax
+ 4b8:	74 16                	je     4d0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 4ba:	0f b6 0a             	movzbl (%edx),%ecx
+ 4bd:	0f b6 18             	movzbl (%eax),%ebx
+ 4c0:	38 d9                	cmp    %bl,%cl
+ 4c2:	74 ec                	je     4b0 <memcmp+0x20>
+      return *s1 - *s2;
+ 4c4:	0f b6 c1             	movzbl %cl,%eax
+ 4c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 4c9:	5b                   	pop    %ebx
+ 4ca:	5e                   	pop    %esi
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4d0:	5b                   	pop    %ebx
+  return 0;
+ 4d1:	31 c0                	xor    %eax,%eax
+}
+ 4d3:	5e                   	pop    %esi
+ 4d4:	5d                   	pop    %ebp
+ 4d5:	c3                   	ret
+ 4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004e0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 4e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 4f0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 4f2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 4f8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 4fe:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 504:	c3                   	ret
+ 505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 510:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 512:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 518:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 51e:	c3                   	ret
+ 51f:	90                   	nop
+
+00000520 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 528:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 52d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 533:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 539:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 53f:	89 c6                	mov    %eax,%esi
+ 541:	f7 f7                	div    %edi
+ 543:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 545:	f7 e3                	mul    %ebx
+ 547:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 54a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 54d:	89 d3                	mov    %edx,%ebx
+ 54f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 552:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 554:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 556:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 55c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 561:	f7 e6                	mul    %esi
+ 563:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 569:	29 d9                	sub    %ebx,%ecx
+ 56b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 571:	01 c1                	add    %eax,%ecx
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 579:	5b                   	pop    %ebx
+ 57a:	5e                   	pop    %esi
+ 57b:	5f                   	pop    %edi
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+
+0000057e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 57e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 583:	89 e1                	mov    %esp,%ecx
+ 585:	ba 8c 05 00 00       	mov    $0x58c,%edx
+ 58a:	0f 34                	sysenter
+ 58c:	c3                   	ret
+
+0000058d <exit>:
+SYSCALL(exit)
+ 58d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 592:	89 e1                	mov    %esp,%ecx
+ 594:	ba 9b 05 00 00       	mov    $0x59b,%edx
+ 599:	0f 34                	sysenter
+ 59b:	c3                   	ret
+
+0000059c <wait>:
+SYSCALL(wait)
+ 59c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5a1:	89 e1                	mov    %esp,%ecx
+ 5a3:	ba aa 05 00 00       	mov    $0x5aa,%edx
+ 5a8:	0f 34                	sysenter
+ 5aa:	c3                   	ret
+
+000005ab <pipe>:
+SYSCALL(pipe)
+ 5ab:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5b0:	89 e1                	mov    %esp,%ecx
+ 5b2:	ba b9 05 00 00       	mov    $0x5b9,%edx
+ 5b7:	0f 34                	sysenter
+ 5b9:	c3                   	ret
+
+000005ba <read>:
+SYSCALL(read)
+ 5ba:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5bf:	89 e1                	mov    %esp,%ecx
+ 5c1:	ba c8 05 00 00       	mov    $0x5c8,%edx
+ 5c6:	0f 34                	sysenter
+ 5c8:	c3                   	ret
+
+000005c9 <write>:
+SYSCALL(write)
+ 5c9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5ce:	89 e1                	mov    %esp,%ecx
+ 5d0:	ba d7 05 00 00       	mov    $0x5d7,%edx
+ 5d5:	0f 34                	sysenter
+ 5d7:	c3                   	ret
+
+000005d8 <close>:
+SYSCALL(close)
+ 5d8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5dd:	89 e1                	mov    %esp,%ecx
+ 5df:	ba e6 05 00 00       	mov    $0x5e6,%edx
+ 5e4:	0f 34                	sysenter
+ 5e6:	c3                   	ret
+
+000005e7 <kill>:
+SYSCALL(kill)
+ 5e7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5ec:	89 e1                	mov    %esp,%ecx
+ 5ee:	ba f5 05 00 00       	mov    $0x5f5,%edx
+ 5f3:	0f 34                	sysenter
+ 5f5:	c3                   	ret
+
+000005f6 <exec>:
+SYSCALL(exec)
+ 5f6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5fb:	89 e1                	mov    %esp,%ecx
+ 5fd:	ba 04 06 00 00       	mov    $0x604,%edx
+ 602:	0f 34                	sysenter
+ 604:	c3                   	ret
+
+00000605 <open>:
+SYSCALL(open)
+ 605:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 60a:	89 e1                	mov    %esp,%ecx
+ 60c:	ba 13 06 00 00       	mov    $0x613,%edx
+ 611:	0f 34                	sysenter
+ 613:	c3                   	ret
+
+00000614 <mknod>:
+SYSCALL(mknod)
+ 614:	b8 11 00 00 00       	mov    $0x11,%eax
+ 619:	89 e1                	mov    %esp,%ecx
+ 61b:	ba 22 06 00 00       	mov    $0x622,%edx
+ 620:	0f 34                	sysenter
+ 622:	c3                   	ret
+
+00000623 <unlink>:
+SYSCALL(unlink)
+ 623:	b8 12 00 00 00       	mov    $0x12,%eax
+ 628:	89 e1                	mov    %esp,%ecx
+ 62a:	ba 31 06 00 00       	mov    $0x631,%edx
+ 62f:	0f 34                	sysenter
+ 631:	c3                   	ret
+
+00000632 <fstat>:
+SYSCALL(fstat)
+ 632:	b8 08 00 00 00       	mov    $0x8,%eax
+ 637:	89 e1                	mov    %esp,%ecx
+ 639:	ba 40 06 00 00       	mov    $0x640,%edx
+ 63e:	0f 34                	sysenter
+ 640:	c3                   	ret
+
+00000641 <link>:
+SYSCALL(link)
+ 641:	b8 13 00 00 00       	mov    $0x13,%eax
+ 646:	89 e1                	mov    %esp,%ecx
+ 648:	ba 4f 06 00 00       	mov    $0x64f,%edx
+ 64d:	0f 34                	sysenter
+ 64f:	c3                   	ret
+
+00000650 <mkdir>:
+SYSCALL(mkdir)
+ 650:	b8 14 00 00 00       	mov    $0x14,%eax
+ 655:	89 e1                	mov    %esp,%ecx
+ 657:	ba 5e 06 00 00       	mov    $0x65e,%edx
+ 65c:	0f 34                	sysenter
+ 65e:	c3                   	ret
+
+0000065f <chdir>:
+SYSCALL(chdir)
+ 65f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 664:	89 e1                	mov    %esp,%ecx
+ 666:	ba 6d 06 00 00       	mov    $0x66d,%edx
+ 66b:	0f 34                	sysenter
+ 66d:	c3                   	ret
+
+0000066e <dup>:
+SYSCALL(dup)
+ 66e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 673:	89 e1                	mov    %esp,%ecx
+ 675:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 67a:	0f 34                	sysenter
+ 67c:	c3                   	ret
+
+0000067d <sbrk>:
+SYSCALL(sbrk)
+ 67d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 682:	89 e1                	mov    %esp,%ecx
+ 684:	ba 8b 06 00 00       	mov    $0x68b,%edx
+ 689:	0f 34                	sysenter
+ 68b:	c3                   	ret
+
+0000068c <sleep>:
+SYSCALL(sleep)
+ 68c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 691:	89 e1                	mov    %esp,%ecx
+ 693:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 698:	0f 34                	sysenter
+ 69a:	c3                   	ret
+
+0000069b <fallocate>:
+SYSCALL(fallocate)
+ 69b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6a0:	89 e1                	mov    %esp,%ecx
+ 6a2:	ba a9 06 00 00       	mov    $0x6a9,%edx
+ 6a7:	0f 34                	sysenter
+ 6a9:	c3                   	ret
+
+000006aa <pread>:
+SYSCALL(pread)
+ 6aa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6af:	89 e1                	mov    %esp,%ecx
+ 6b1:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b6:	0f 34                	sysenter
+ 6b8:	c3                   	ret
+
+000006b9 <pwrite>:
+SYSCALL(pwrite)
+ 6b9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6be:	89 e1                	mov    %esp,%ecx
+ 6c0:	ba c7 06 00 00       	mov    $0x6c7,%edx
+ 6c5:	0f 34                	sysenter
+ 6c7:	c3                   	ret
+
+000006c8 <readv>:
+SYSCALL(readv)
+ 6c8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6cd:	89 e1                	mov    %esp,%ecx
+ 6cf:	ba d6 06 00 00       	mov    $0x6d6,%edx
+ 6d4:	0f 34                	sysenter
+ 6d6:	c3                   	ret
+
+000006d7 <writev>:
+SYSCALL(writev)
+ 6d7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6dc:	89 e1                	mov    %esp,%ecx
+ 6de:	ba e5 06 00 00       	mov    $0x6e5,%edx
+ 6e3:	0f 34                	sysenter
+ 6e5:	c3                   	ret
+
+000006e6 <splice>:
+SYSCALL(splice)
+ 6e6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6eb:	89 e1                	mov    %esp,%ecx
+ 6ed:	ba f4 06 00 00       	mov    $0x6f4,%edx
+ 6f2:	0f 34                	sysenter
+ 6f4:	c3                   	ret
+
+000006f5 <setpriority>:
+SYSCALL(setpriority)
+ 6f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6fa:	89 e1                	mov    %esp,%ecx
+ 6fc:	ba 03 07 00 00       	mov    $0x703,%edx
+ 701:	0f 34                	sysenter
+ 703:	c3                   	ret
+
+00000704 <setaffinity>:
+SYSCALL(setaffinity)
+ 704:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 709:	89 e1                	mov    %esp,%ecx
+ 70b:	ba 12 07 00 00       	mov    $0x712,%edx
+ 710:	0f 34                	sysenter
+ 712:	c3                   	ret
+
+00000713 <lockstress>:
+SYSCALL(lockstress)
+ 713:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 718:	89 e1                	mov    %esp,%ecx
+ 71a:	ba 21 07 00 00       	mov    $0x721,%edx
+ 71f:	0f 34                	sysenter
+ 721:	c3                   	ret
+
+00000722 <lockstat>:
+SYSCALL(lockstat)
+ 722:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 30 07 00 00       	mov    $0x730,%edx
+ 72e:	0f 34                	sysenter
+ 730:	c3                   	ret
+
+00000731 <profctl>:
+SYSCALL(profctl)
+ 731:	b8 20 00 00 00       	mov    $0x20,%eax
+ 736:	89 e1                	mov    %esp,%ecx
+ 738:	ba 3f 07 00 00       	mov    $0x73f,%edx
+ 73d:	0f 34                	sysenter
+ 73f:	c3                   	ret
+
+00000740 <profread>:
+SYSCALL(profread)
+ 740:	b8 21 00 00 00       	mov    $0x21,%eax
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 4e 07 00 00       	mov    $0x74e,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	c3                   	ret
+
+0000074f <getrusage>:
+SYSCALL(getrusage)
+ 74f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 754:	89 e1                	mov    %esp,%ecx
+ 756:	ba 5d 07 00 00       	mov    $0x75d,%edx
+ 75b:	0f 34                	sysenter
+ 75d:	c3                   	ret
+
+0000075e <tracectl>:
+SYSCALL(tracectl)
+ 75e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 763:	89 e1                	mov    %esp,%ecx
+ 765:	ba 6c 07 00 00       	mov    $0x76c,%edx
+ 76a:	0f 34                	sysenter
+ 76c:	c3                   	ret
+
+0000076d <traceread>:
+SYSCALL(traceread)
+ 76d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 772:	89 e1                	mov    %esp,%ecx
+ 774:	ba 7b 07 00 00       	mov    $0x77b,%edx
+ 779:	0f 34                	sysenter
+ 77b:	c3                   	ret
+
+0000077c <nanosleep>:
+SYSCALL(nanosleep)
+ 77c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 781:	89 e1                	mov    %esp,%ecx
+ 783:	ba 8a 07 00 00       	mov    $0x78a,%edx
+ 788:	0f 34                	sysenter
+ 78a:	c3                   	ret
+ 78b:	66 90                	xchg   %ax,%ax
+ 78d:	66 90                	xchg   %ax,%ax
+ 78f:	90                   	nop
+
+00000790 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 798:	89 d1                	mov    %edx,%ecx
+{
+ 79a:	83 ec 3c             	sub    $0x3c,%esp
+ 79d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7a0:	85 d2                	test   %edx,%edx
+ 7a2:	0f 89 80 00 00 00    	jns    828 <printint+0x98>
+ 7a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ac:	74 7a                	je     828 <printint+0x98>
+    x = -xx;
+ 7ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7b8:	31 f6                	xor    %esi,%esi
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7c0:	89 c8                	mov    %ecx,%eax
+ 7c2:	31 d2                	xor    %edx,%edx
+ 7c4:	89 f7                	mov    %esi,%edi
+ 7c6:	f7 f3                	div    %ebx
+ 7c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7cb:	0f b6 92 30 0c 00 00 	movzbl 0xc30(%edx),%edx
+ 7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7d6:	89 ca                	mov    %ecx,%edx
+ 7d8:	89 c1                	mov    %eax,%ecx
+ 7da:	39 da                	cmp    %ebx,%edx
+ 7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+ 7de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7e1:	85 c0                	test   %eax,%eax
+ 7e3:	74 07                	je     7ec <printint+0x5c>
+    buf[i++] = '-';
+ 7e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ea:	89 f7                	mov    %esi,%edi
+ 7ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7f2:	01 df                	add    %ebx,%edi
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 801:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 804:	6a 01                	push   $0x1
+ 806:	50                   	push   %eax
+ 807:	56                   	push   %esi
+ 808:	e8 bc fd ff ff       	call   5c9 <write>
+  while(--i >= 0)
+ 80d:	89 f8                	mov    %edi,%eax
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	83 ef 01             	sub    $0x1,%edi
+ 815:	39 d8                	cmp    %ebx,%eax
+ 817:	75 df                	jne    7f8 <printint+0x68>
+}
+ 819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81c:	5b                   	pop    %ebx
+ 81d:	5e                   	pop    %esi
+ 81e:	5f                   	pop    %edi
+ 81f:	5d                   	pop    %ebp
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 828:	31 c0                	xor    %eax,%eax
+ 82a:	eb 89                	jmp    7b5 <printint+0x25>
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 839:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 83c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 83f:	0f b6 1e             	movzbl (%esi),%ebx
+ 842:	83 c6 01             	add    $0x1,%esi
+ 845:	84 db                	test   %bl,%bl
+ 847:	74 67                	je     8b0 <printf+0x80>
+ 849:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 84c:	31 d2                	xor    %edx,%edx
+ 84e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 851:	eb 34                	jmp    887 <printf+0x57>
+ 853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 857:	90                   	nop
+ 858:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 85b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 18                	je     87d <printf+0x4d>
+  write(fd, &c, 1);
+ 865:	83 ec 04             	sub    $0x4,%esp
+ 868:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 86b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86e:	6a 01                	push   $0x1
+ 870:	50                   	push   %eax
+ 871:	57                   	push   %edi
+ 872:	e8 52 fd ff ff       	call   5c9 <write>
+ 877:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 87a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 87d:	0f b6 1e             	movzbl (%esi),%ebx
+ 880:	83 c6 01             	add    $0x1,%esi
+ 883:	84 db                	test   %bl,%bl
+ 885:	74 29                	je     8b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 887:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 88a:	85 d2                	test   %edx,%edx
+ 88c:	74 ca                	je     858 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 88e:	83 fa 25             	cmp    $0x25,%edx
+ 891:	75 ea                	jne    87d <printf+0x4d>
+      if(c == 'd'){
+ 893:	83 f8 25             	cmp    $0x25,%eax
+ 896:	0f 84 24 01 00 00    	je     9c0 <printf+0x190>
+ 89c:	83 e8 63             	sub    $0x63,%eax
+ 89f:	83 f8 15             	cmp    $0x15,%eax
+ 8a2:	77 1c                	ja     8c0 <printf+0x90>
+ 8a4:	ff 24 85 d8 0b 00 00 	jmp    *0xbd8(,%eax,4)
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b3:	5b                   	pop    %ebx
+ 8b4:	5e                   	pop    %esi
+ 8b5:	5f                   	pop    %edi
+ 8b6:	5d                   	pop    %ebp
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ca:	6a 01                	push   $0x1
+ 8cc:	52                   	push   %edx
+ 8cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8d0:	57                   	push   %edi
+ 8d1:	e8 f3 fc ff ff       	call   5c9 <write>
+ 8d6:	83 c4 0c             	add    $0xc,%esp
+ 8d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8dc:	6a 01                	push   $0x1
+ 8de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8e1:	52                   	push   %edx
+ 8e2:	57                   	push   %edi
+ 8e3:	e8 e1 fc ff ff       	call   5c9 <write>
+        putc(fd, c);
+ 8e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8eb:	31 d2                	xor    %edx,%edx
+ 8ed:	eb 8e                	jmp    87d <printf+0x4d>
+ 8ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 00                	push   $0x0
+ 8ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 901:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 904:	e8 87 fe ff ff       	call   790 <printint>
+        ap++;
+ 909:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 90c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 67 ff ff ff       	jmp    87d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 920:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 923:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 925:	83 c0 04             	add    $0x4,%eax
+ 928:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 92b:	85 db                	test   %ebx,%ebx
+ 92d:	0f 84 9d 00 00 00    	je     9d0 <printf+0x1a0>
+        while(*s != 0){
+ 933:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 936:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 938:	84 c0                	test   %al,%al
+ 93a:	0f 84 3d ff ff ff    	je     87d <printf+0x4d>
+ 940:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 943:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 946:	89 de                	mov    %ebx,%esi
+ 948:	89 d3                	mov    %edx,%ebx
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 956:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	53                   	push   %ebx
+ 95c:	57                   	push   %edi
+ 95d:	e8 67 fc ff ff       	call   5c9 <write>
+        while(*s != 0){
+ 962:	0f b6 06             	movzbl (%esi),%eax
+ 965:	83 c4 10             	add    $0x10,%esp
+ 968:	84 c0                	test   %al,%al
+ 96a:	75 e4                	jne    950 <printf+0x120>
+      state = 0;
+ 96c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 07 ff ff ff       	jmp    87d <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	e9 6b ff ff ff       	jmp    8ff <printf+0xcf>
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 998:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 99b:	83 ec 04             	sub    $0x4,%esp
+ 99e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	52                   	push   %edx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 17 fc ff ff       	call   5c9 <write>
+        ap++;
+ 9b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9b8:	31 d2                	xor    %edx,%edx
+ 9ba:	e9 be fe ff ff       	jmp    87d <printf+0x4d>
+ 9bf:	90                   	nop
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	e9 11 ff ff ff       	jmp    8e1 <printf+0xb1>
+ 9d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9d5:	bb d1 0b 00 00       	mov    $0xbd1,%ebx
+ 9da:	e9 61 ff ff ff       	jmp    940 <printf+0x110>
+ 9df:	90                   	nop
+
+000009e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	a1 b0 0f 00 00       	mov    0xfb0,%eax
+{
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	57                   	push   %edi
+ 9e9:	56                   	push   %esi
+ 9ea:	53                   	push   %ebx
+ 9eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9fc:	39 ca                	cmp    %ecx,%edx
+ 9fe:	73 30                	jae    a30 <free+0x50>
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 04                	jb     a08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a04:	39 c2                	cmp    %eax,%edx
+ a06:	72 f0                	jb     9f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a0e:	39 f8                	cmp    %edi,%eax
+ a10:	74 2e                	je     a40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a15:	8b 42 04             	mov    0x4(%edx),%eax
+ a18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a1b:	39 f1                	cmp    %esi,%ecx
+ a1d:	74 38                	je     a57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a21:	5b                   	pop    %ebx
+  freep = p;
+ a22:	89 15 b0 0f 00 00    	mov    %edx,0xfb0
+}
+ a28:	5e                   	pop    %esi
+ a29:	5f                   	pop    %edi
+ a2a:	5d                   	pop    %ebp
+ a2b:	c3                   	ret
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a30:	39 c1                	cmp    %eax,%ecx
+ a32:	72 d0                	jb     a04 <free+0x24>
+ a34:	eb c2                	jmp    9f8 <free+0x18>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 70 04             	add    0x4(%eax),%esi
+ a43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a4d:	8b 42 04             	mov    0x4(%edx),%eax
+ a50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a53:	39 f1                	cmp    %esi,%ecx
+ a55:	75 c8                	jne    a1f <free+0x3f>
+    p->s.size += bp->s.size;
+ a57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a5a:	89 15 b0 0f 00 00    	mov    %edx,0xfb0
+    p->s.size += bp->s.size;
+ a60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a66:	89 0a                	mov    %ecx,(%edx)
+}
+ a68:	5b                   	pop    %ebx
+ a69:	5e                   	pop    %esi
+ a6a:	5f                   	pop    %edi
+ a6b:	5d                   	pop    %ebp
+ a6c:	c3                   	ret
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a7c:	8b 15 b0 0f 00 00    	mov    0xfb0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a82:	8d 78 07             	lea    0x7(%eax),%edi
+ a85:	c1 ef 03             	shr    $0x3,%edi
+ a88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a8b:	85 d2                	test   %edx,%edx
+ a8d:	0f 84 8d 00 00 00    	je     b20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a95:	8b 48 04             	mov    0x4(%eax),%ecx
+ a98:	39 f9                	cmp    %edi,%ecx
+ a9a:	73 64                	jae    b00 <malloc+0x90>
+  if(nu < 4096)
+ a9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ aa1:	39 df                	cmp    %ebx,%edi
+ aa3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ aa6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aad:	eb 0a                	jmp    ab9 <malloc+0x49>
+ aaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab5:	39 f9                	cmp    %edi,%ecx
+ ab7:	73 47                	jae    b00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ab9:	89 c2                	mov    %eax,%edx
+ abb:	39 05 b0 0f 00 00    	cmp    %eax,0xfb0
+ ac1:	75 ed                	jne    ab0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	56                   	push   %esi
+ ac7:	e8 b1 fb ff ff       	call   67d <sbrk>
+  if(p == (char*)-1)
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ad2:	74 1c                	je     af0 <malloc+0x80>
+  hp->s.size = nu;
+ ad4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ad7:	83 ec 0c             	sub    $0xc,%esp
+ ada:	83 c0 08             	add    $0x8,%eax
+ add:	50                   	push   %eax
+ ade:	e8 fd fe ff ff       	call   9e0 <free>
+  return freep;
+ ae3:	8b 15 b0 0f 00 00    	mov    0xfb0,%edx
+      if((p = morecore(nunits)) == 0)
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	85 d2                	test   %edx,%edx
+ aee:	75 c0                	jne    ab0 <malloc+0x40>
+        return 0;
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ af3:	31 c0                	xor    %eax,%eax
+}
+ af5:	5b                   	pop    %ebx
+ af6:	5e                   	pop    %esi
+ af7:	5f                   	pop    %edi
+ af8:	5d                   	pop    %ebp
+ af9:	c3                   	ret
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b00:	39 cf                	cmp    %ecx,%edi
+ b02:	74 4c                	je     b50 <malloc+0xe0>
+        p->s.size -= nunits;
+ b04:	29 f9                	sub    %edi,%ecx
+ b06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b0f:	89 15 b0 0f 00 00    	mov    %edx,0xfb0
+}
+ b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b18:	83 c0 08             	add    $0x8,%eax
+}
+ b1b:	5b                   	pop    %ebx
+ b1c:	5e                   	pop    %esi
+ b1d:	5f                   	pop    %edi
+ b1e:	5d                   	pop    %ebp
+ b1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b20:	c7 05 b0 0f 00 00 b4 	movl   $0xfb4,0xfb0
+ b27:	0f 00 00 
+    base.s.size = 0;
+ b2a:	b8 b4 0f 00 00       	mov    $0xfb4,%eax
+    base.s.ptr = freep = prevp = &base;
+ b2f:	c7 05 b4 0f 00 00 b4 	movl   $0xfb4,0xfb4
+ b36:	0f 00 00 
+    base.s.size = 0;
+ b39:	c7 05 b8 0f 00 00 00 	movl   $0x0,0xfb8
+ b40:	00 00 00 
+    if(p->s.size >= nunits){
+ b43:	e9 54 ff ff ff       	jmp    a9c <malloc+0x2c>
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b50:	8b 08                	mov    (%eax),%ecx
+ b52:	89 0a                	mov    %ecx,(%edx)
+ b54:	eb b9                	jmp    b0f <malloc+0x9f>
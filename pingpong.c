@@ -0,0 +1,84 @@
+// Pipe ping-pong latency benchmark.
+// Two processes bounce a byte back and forth over a pair of
+// pipes while a growing number of other processes sit asleep
+// on pipes of their own, to show how the cost of a wakeup
+// depends on the number of sleeping processes.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+#define ROUNDS 2000  // round trips per measurement
+
+int idlers[] = { 0, 8, 16, 32, NPROC - 8 };
+
+void
+bench(int nidle)
+{
+  int hold[2], ping[2], pong[2], i, pid, start, ticks;
+  char c;
+
+  if(pipe(hold) < 0 || pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "pingpong: pipe failed\n");
+    exit();
+  }
+
+  // Idle processes block reading hold until it is closed.
+  for(i = 0; i < nidle; i++){
+    if((pid = fork()) < 0){
+      printf(2, "pingpong: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(hold[1]);
+      read(hold[0], &c, 1);
+      exit();
+    }
+  }
+  close(hold[0]);
+
+  if((pid = fork()) < 0){
+    printf(2, "pingpong: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Close our copy of ping's write end, or read never sees EOF.
+    close(hold[1]);
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      write(pong[1], &c, 1);
+    exit();
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  start = uptime();
+  for(i = 0; i < ROUNDS; i++){
+    if(write(ping[1], "x", 1) != 1 || read(pong[0], &c, 1) != 1){
+      printf(2, "pingpong: round trip failed\n");
+      exit();
+    }
+  }
+  ticks = uptime() - start;
+
+  close(ping[1]);
+  close(pong[0]);
+  close(hold[1]);
+  for(i = 0; i < nidle + 1; i++)
+    wait();
+
+  printf(1, "%d sleeping: %d round trips in %d ticks\n",
+         nidle, ROUNDS, ticks);
+}
+
+int
+main(void)
+{
+  int i;
+
+  for(i = 0; i < sizeof(idlers)/sizeof(idlers[0]); i++)
+    bench(idlers[i]);
+  exit();
+}
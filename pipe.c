@@ -2,27 +2,52 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 
-#define PIPESIZE 512
+#define PIPESIZE (PIPEPAGES*PGSIZE)
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+// The buffer is a ring of PIPEPAGES separately allocated pages.
+// Data moves in and out with memmove(), a contiguous chunk at a
+// time, splitting only where the ring wraps to its next page.
+// nread and nwrite count bytes forever; PIPESIZE is a power of
+// 2 so that they can be taken modulo PIPESIZE even as they wrap.
+//
+// splice() moves file data straight into or out of the ring
+// (see pipebeginwrite). While it does, it owns that end of the
+// pipe: wbusy or rbusy is set and other writers or readers wait.
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *data[PIPEPAGES];
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int wbusy;      // splice is filling the free space
+  int rbusy;      // splice is draining the data
 };
 
+static void
+pipefree(struct pipe *p)
+{
+  int i;
+
+  for(i = 0; i < PIPEPAGES; i++)
+    if(p->data[i])
+      kfree(p->data[i]);
+  kfree((char*)p);
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
   struct pipe *p;
+  int i;
 
   p = 0;
   *f0 = *f1 = 0;
@@ -30,6 +55,10 @@ pipealloc(struct file **f0, struct file **f1)
     goto bad;
   if((p = (struct pipe*)kalloc()) == 0)
     goto bad;
+  memset(p, 0, sizeof(*p));
+  for(i = 0; i < PIPEPAGES; i++)
+    if((p->data[i] = kalloc()) == 0)
+      goto bad;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -48,7 +77,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    pipefree(p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,7 +98,7 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    pipefree(p);
   } else
     release(&p->lock);
 }
@@ -78,11 +107,12 @@ pipeclose(struct pipe *p, int writable)
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint w;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  for(i = 0; i < n; i += m){
+    while(p->wbusy || p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
@@ -90,7 +120,12 @@ pipewrite(struct pipe *p, char *addr, int n)
       wakeup(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    // Copy as much as fits, up to the end of the current page.
+    w = p->nwrite % PIPESIZE;
+    m = min(n - i, PIPESIZE - (p->nwrite - p->nread));
+    m = min(m, PGSIZE - w % PGSIZE);
+    memmove(p->data[w / PGSIZE] + w % PGSIZE, addr + i, m);
+    p->nwrite += m;
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
@@ -100,22 +135,120 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, m;
+  uint r;
 
   acquire(&p->lock);
-  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){  //DOC: pipe-empty
     if(myproc()->killed){
       release(&p->lock);
       return -1;
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    r = p->nread % PIPESIZE;
+    m = min(n - i, p->nwrite - p->nread);
+    m = min(m, PGSIZE - r % PGSIZE);
+    memmove(addr + i, p->data[r / PGSIZE] + r % PGSIZE, m);
+    p->nread += m;
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
+
+//PAGEBREAK: 40
+// Wait for free space in the pipe and reserve it for the caller,
+// which becomes the only writer until pipeendwrite(). Sets *pp to
+// a contiguous run of free space and returns its length, at most
+// n. Returns -1 if the read end is closed or the caller killed.
+int
+pipebeginwrite(struct pipe *p, char **pp, int n)
+{
+  int m;
+  uint w;
+
+  acquire(&p->lock);
+  while(p->wbusy || p->nwrite == p->nread + PIPESIZE){
+    if(p->readopen == 0 || myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    wakeup(&p->nread);
+    sleep(&p->nwrite, &p->lock);
+  }
+  if(p->readopen == 0){
+    release(&p->lock);
+    return -1;
+  }
+  p->wbusy = 1;
+  w = p->nwrite % PIPESIZE;
+  m = min(n, PIPESIZE - (p->nwrite - p->nread));
+  m = min(m, PGSIZE - w % PGSIZE);
+  *pp = p->data[w / PGSIZE] + w % PGSIZE;
+  release(&p->lock);
+  return m;
+}
+
+// Publish the first m bytes of the space reserved by
+// pipebeginwrite() and give up the reservation.
+void
+pipeendwrite(struct pipe *p, int m)
+{
+  acquire(&p->lock);
+  p->nwrite += m;
+  p->wbusy = 0;
+  wakeup(&p->nread);
+  wakeup(&p->nwrite);
+  release(&p->lock);
+}
+
+// Wait for data in the pipe and reserve it for the caller,
+// which becomes the only reader until pipeendread(). Sets *pp to
+// a contiguous run of data and returns its length, at most n.
+// Returns 0 at end of file and -1 if the caller was killed.
+int
+pipebeginread(struct pipe *p, char **pp, int n)
+{
+  int m;
+  uint r;
+
+  acquire(&p->lock);
+  while(p->rbusy || (p->nread == p->nwrite && p->writeopen)){
+    if(myproc()->killed){
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock);
+  }
+  if(p->nread == p->nwrite){
+    release(&p->lock);
+    return 0;
+  }
+  p->rbusy = 1;
+  r = p->nread % PIPESIZE;
+  m = min(n, p->nwrite - p->nread);
+  m = min(m, PGSIZE - r % PGSIZE);
+  *pp = p->data[r / PGSIZE] + r % PGSIZE;
+  release(&p->lock);
+  return m;
+}
+
+// Consume the first m bytes of the data reserved by
+// pipebeginread() and give up the reservation.
+// Returns the number of bytes still in the pipe.
+int
+pipeendread(struct pipe *p, int m)
+{
+  int left;
+
+  acquire(&p->lock);
+  p->nread += m;
+  p->rbusy = 0;
+  left = p->nwrite - p->nread;
+  wakeup(&p->nwrite);
+  wakeup(&p->nread);
+  release(&p->lock);
+  return left;
+}
@@ -0,0 +1,62 @@
+// Pipe throughput benchmark.
+// For each write size, a parent writes TOTAL bytes into a pipe
+// in chunks of that size while a child drains it, and the rate
+// is reported from the elapsed clock ticks.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define TOTAL (512*1024)  // bytes moved per write size
+#define HZ    100         // approximate timer ticks per second
+
+char buf[8192];
+int sizes[] = { 1, 16, 128, 512, 1024, 4096, 8192 };
+
+void
+bench(int size)
+{
+  int fds[2], pid, n, start, ticks;
+
+  if(pipe(fds) < 0){
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  start = uptime();
+  pid = fork();
+  if(pid < 0){
+    printf(2, "pipebench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[1]);
+    while(read(fds[0], buf, sizeof(buf)) > 0)
+      ;
+    exit();
+  }
+  close(fds[0]);
+  for(n = 0; n < TOTAL; n += size){
+    if(write(fds[1], buf, size) != size){
+      printf(2, "pipebench: write failed\n");
+      exit();
+    }
+  }
+  close(fds[1]);
+  wait();
+  ticks = uptime() - start;
+  if(ticks == 0)
+    ticks = 1;
+
+  printf(1, "write size %d: %d bytes in %d ticks, %d KB/s\n",
+         size, TOTAL, ticks, TOTAL / 1024 * HZ / ticks);
+}
+
+int
+main(void)
+{
+  int i;
+
+  for(i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++)
+    bench(sizes[i]);
+  exit();
+}
@@ -4,26 +4,97 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
-
+#include "proc.h"
+#include "rwlock.h"
+#include "rusage.h"
+#include "trace.h"
+
+// Each process has its own lock, which protects its state and is
+// held across the switch into and out of it, so CPUs scheduling
+// different processes don't contend. ptable.lock only guards
+// p->parent and the lists of children, so that wait() and exit()
+// can't miss each other. Locks are always taken in the order
+// ptable.lock, pid hash lock, sleep queue lock, p->lock, run
+// queue lock.
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Per-CPU run queues of RUNNABLE processes, linked through
+// p->rqnext. A process is on at most one queue, and only while it
+// is RUNNABLE; the scheduler takes it off before running it. A CPU
+// whose own queue is empty steals from the longest other queue.
+// A process is queued on the CPU it last ran on, while its cache
+// is warm, and is only ever taken by CPUs in its p->affinity.
+//
+// Each queue has a list per priority level, and the scheduler
+// takes from the highest non-empty one. With SCHED_RR every
+// process stays at level 0, so this is plain round robin. With
+// SCHED_MLFQ a process starts at its nice level and drops a level
+// each time it uses up a time slice, which doubles per level.
+// Every BOOSTTICKS ticks all processes go back to their nice
+// level. The boost is applied lazily: boost() only bumps
+// boostgen, and queues and processes catch up when next used.
+struct runq {
+  struct spinlock lock;
+  struct {
+    struct proc *head;
+    struct proc *tail;
+  } q[NPRIO];
+  volatile int n;     // number of queued processes
+  uint boostgen;      // last boost applied to the queue
+} runq[NCPU];
+
+static volatile uint boostgen;  // number of boosts so far
+
+// Sleeping processes, hashed by the channel they sleep on, so
+// wakeup() looks only at processes waiting on its channel. A
+// process is on its channel's queue, linked through p->chnext,
+// while p->chan is set; both are protected by the queue's lock.
+#define NSLEEPQ 64
+
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+} sleepq[NSLEEPQ];
+
+// Processes hashed by pid, linked through p->pidnext, so kill()
+// and friends don't search the whole table. A process is in the
+// hash from fork() until wait() reaps it. Lookups far outnumber
+// forks and reaps, so they only read-lock a bucket.
+#define NPIDHASH 64
+
+struct pidhash {
+  struct rwlock lock;
+  struct proc *head;
+} pidhash[NPIDHASH];
+
 static struct proc *initproc; // ptr to first process
 
 int nextpid = 1; // global counter for pids
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+  struct proc *p;
+  struct runq *rq;
+  struct sleepq *sq;
+  struct pidhash *ph;
+
   initlock(&ptable.lock, "ptable"); // see spinlock.c for function def
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
+  for(rq = runq; rq < &runq[NCPU]; rq++)
+    initlock(&rq->lock, "runq");
+  for(sq = sleepq; sq < &sleepq[NSLEEPQ]; sq++)
+    initlock(&sq->lock, "sleepq");
+  for(ph = pidhash; ph < &pidhash[NPIDHASH]; ph++)
+    initrwlock(&ph->lock, "pidhash");
 }
 
 // Must be called with interrupts disabled
@@ -35,43 +106,333 @@ cpuid() {
   return mycpu()-cpus;
 }
 
-// Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// %gs is a per-CPU segment whose base is &c->cpu (see seginit
+// in vm.c), so this is a single load. Should be called with
+// interrupts disabled, or the caller may be rescheduled onto
+// another CPU before it uses the result.
 struct cpu*
 mycpu(void)
 {
-  int apicid, i;
-  
-  if (readeflags() & FL_IF)
-    panic("mycpu called with interrupts enabled\n");
-  
-  apicid = lapicid(); // get the local interrupt controller ID
-
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  // Iterate through CPU list until matching interrupt controller ID found
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid)
-      return &cpus[i];
-  }
-  panic("unknown apicid\n");
+  struct cpu *c;
+
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// Also a single load through %gs, so no need to disable
+// interrupts: if we are rescheduled onto another CPU, the
+// process there is still this one.
 struct proc*
 myproc(void) {
-  struct cpu *c;
   struct proc *p;
 
-  pushcli();
-  c = mycpu();
-  p = c->proc;
-  popcli();
+  asm volatile("movl %%gs:4, %0" : "=r" (p));
+  return p;
+}
+
+// Reset p's priority if there has been a boost since it last
+// looked. Caller must hold p->lock.
+static void
+boostproc(struct proc *p)
+{
+  if(p->boostgen != boostgen){
+    p->boostgen = boostgen;
+    p->prio = p->nice;
+    p->slice = 0;
+  }
+}
+
+// p has just been queued on CPU c. If c is halted, wake it up;
+// if c is busy, wake some other idle CPU that may steal p. The
+// xchg claims the idle CPU so that only one IPI is sent, and
+// pairs with the one in scheduler() so either it sees p queued
+// or we see it idle. Failing that, if c is running a process
+// without a time slice (see timerarm()), have it arm one so that
+// p gets a turn.
+static void
+kickidle(struct proc *p, int c)
+{
+  int i;
+
+  if(c != cpuid() && xchg(&cpus[c].idle, 0)){
+    lapicipi(cpus[c].apicid, T_IRQ0 + IRQ_RESCHED);
+    return;
+  }
+  for(i = 0; i < ncpu; i++){
+    if(i != cpuid() && (p->affinity & (1 << i)) && xchg(&cpus[i].idle, 0)){
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+      return;
+    }
+  }
+  if(xchg(&cpus[c].unsliced, 0)){
+    if(c == cpuid())
+      timerarm();
+    else
+      lapicipi(cpus[c].apicid, T_IRQ0 + IRQ_RESCHED);
+  }
+}
+
+// Make p RUNNABLE and append it to a CPU's run queue.
+// Caller must hold p->lock.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq;
+  int c, n;
+
+  if(!holding(&p->lock))
+    panic("setrunnable");
+  boostproc(p);
+  p->state = RUNNABLE;
+  p->rqnext = 0;
+
+  // Prefer the CPU p last ran on, then this one, then any it may use.
+  c = cpuid();  // interrupts are off while p->lock is held
+  if(p->lastcpu >= 0 && (p->affinity & (1 << p->lastcpu)))
+    c = p->lastcpu;
+  else if((p->affinity & (1 << c)) == 0)
+    for(c = 0; c < ncpu-1 && (p->affinity & (1 << c)) == 0; c++)
+      ;
+  rq = &runq[c];
+  acquire(&rq->lock);
+  if(rq->q[p->prio].tail)
+    rq->q[p->prio].tail->rqnext = p;
+  else
+    rq->q[p->prio].head = p;
+  rq->q[p->prio].tail = p;
+  n = ++rq->n;
+  release(&rq->lock);
+
+  // A yielding process alone on its queue is about to be
+  // picked straight back up by this CPU.
+  if(p != myproc() || n > 1)
+    kickidle(p, c);
+}
+
+// Catch rq up with a boost: take every process off it and queue
+// each again with setrunnable(), whose boostproc() puts it back
+// at its nice level. p->lock comes before the run queue's lock,
+// so the lists are emptied first and the processes requeued one
+// at a time under their own locks.
+static void
+rqboost(struct runq *rq)
+{
+  struct proc *list, **tail, *p, *next;
+  int i;
+
+  acquire(&rq->lock);
+  if(rq->boostgen == boostgen){
+    release(&rq->lock);
+    return;
+  }
+  rq->boostgen = boostgen;
+  list = 0;
+  tail = &list;
+  for(i = 0; i < NPRIO; i++){
+    if(rq->q[i].head){
+      *tail = rq->q[i].head;
+      tail = &rq->q[i].tail->rqnext;
+    }
+    rq->q[i].head = rq->q[i].tail = 0;
+  }
+  rq->n = 0;
+  release(&rq->lock);
+
+  for(p = list; p; p = next){
+    next = p->rqnext;
+    acquire(&p->lock);
+    setrunnable(p);
+    release(&p->lock);
+  }
+}
+
+// Take the first process at the highest level of rq that may
+// run on CPU id off it, or return 0. p->affinity is read without
+// p->lock; setaffinity() moves the caller itself if need be, and
+// requeues a RUNNABLE process that is queued out of bounds.
+static struct proc*
+dequeue(struct runq *rq, int id)
+{
+  struct proc *p, *prev;
+  int i;
+
+  if(rq->n == 0)  // peek without the lock, so idle CPUs leave it alone
+    return 0;
+  if(rq->boostgen != boostgen)
+    rqboost(rq);
+  acquire(&rq->lock);
+  p = 0;
+  for(i = 0; i < NPRIO && p == 0; i++){
+    prev = 0;
+    for(p = rq->q[i].head; p; prev = p, p = p->rqnext)
+      if(p->affinity & (1 << id))
+        break;
+    if(p == 0)
+      continue;
+    if(prev)
+      prev->rqnext = p->rqnext;
+    else
+      rq->q[i].head = p->rqnext;
+    if(rq->q[i].tail == p)
+      rq->q[i].tail = prev;
+    rq->n--;
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// If RUNNABLE p is queued on a CPU outside p->affinity, take it
+// off that queue and return 1. A process some scheduler has just
+// dequeued isn't found; it runs once and then moves itself.
+// Caller must hold p->lock.
+static int
+rqremove(struct proc *p)
+{
+  struct runq *rq;
+  struct proc **pp, *prev;
+  int c, i;
+
+  for(c = 0; c < ncpu; c++){
+    if(p->affinity & (1 << c))
+      continue;
+    rq = &runq[c];
+    acquire(&rq->lock);
+    for(i = 0; i < NPRIO; i++){
+      prev = 0;
+      for(pp = &rq->q[i].head; *pp; prev = *pp, pp = &(*pp)->rqnext){
+        if(*pp != p)
+          continue;
+        *pp = p->rqnext;
+        if(rq->q[i].tail == p)
+          rq->q[i].tail = prev;
+        rq->n--;
+        release(&rq->lock);
+        return 1;
+      }
+    }
+    release(&rq->lock);
+  }
+  return 0;
+}
+
+// Choose the next process for CPU id to run: the head of its own
+// run queue, or failing that one stolen from the busiest CPU, or
+// from any CPU if the busiest has nothing this CPU may run.
+static struct proc*
+pickproc(int id)
+{
+  struct runq *rq, *busiest;
+  struct proc *p;
+
+  if((p = dequeue(&runq[id], id)) != 0)
+    return p;
+  busiest = 0;
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+    if(rq->n > 0 && (busiest == 0 || rq->n > busiest->n))
+      busiest = rq;
+  if(busiest == 0)
+    return 0;
+  if((p = dequeue(busiest, id)) != 0)
+    return p;
+  for(rq = runq; rq < &runq[ncpu]; rq++)
+    if(rq != busiest && (p = dequeue(rq, id)) != 0)
+      return p;
+  return 0;
+}
+
+// Sleep queue for chan. Channels are addresses, so mix the bits
+// to spread neighbouring ones over the queues.
+static struct sleepq*
+chanq(void *chan)
+{
+  return &sleepq[(((uint)chan * 2654435761U) >> 16) % NSLEEPQ];
+}
+
+// Take p off sq if it is still there. Caller must hold sq->lock.
+static void
+unqueue(struct sleepq *sq, struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &sq->head; *pp; pp = &(*pp)->chnext){
+    if(*pp == p){
+      *pp = p->chnext;
+      break;
+    }
+  }
+  p->chan = 0;
+}
+
+// Add p to the pid hash.
+static void
+pidhashadd(struct proc *p)
+{
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+
+  acquirewrite(&ph->lock);
+  p->pidnext = ph->head;
+  ph->head = p;
+  releasewrite(&ph->lock);
+}
+
+// Take p out of the pid hash.
+static void
+pidhashdel(struct proc *p)
+{
+  struct pidhash *ph = &pidhash[p->pid % NPIDHASH];
+  struct proc **pp;
+
+  acquirewrite(&ph->lock);
+  for(pp = &ph->head; *pp; pp = &(*pp)->pidnext){
+    if(*pp == p){
+      *pp = p->pidnext;
+      break;
+    }
+  }
+  releasewrite(&ph->lock);
+}
 
+// Find the process with the given pid and return it with its
+// lock held, or return 0.
+static struct proc*
+findproc(int pid)
+{
+  struct pidhash *ph = &pidhash[(uint)pid % NPIDHASH];
+  struct proc *p;
+
+  acquireread(&ph->lock);
+  for(p = ph->head; p; p = p->pidnext){
+    if(p->pid == pid){
+      acquire(&p->lock);
+      break;
+    }
+  }
+  releaseread(&ph->lock);
   return p;
 }
 
+// Put p at the front of list, one of a parent's lists of
+// children. Caller must hold ptable.lock.
+static void
+childpush(struct proc **list, struct proc *p)
+{
+  p->sibling = *list;
+  p->sibprev = list;
+  if(*list)
+    (*list)->sibprev = &p->sibling;
+  *list = p;
+}
+
+// Take p off the list of children it is on.
+// Caller must hold ptable.lock.
+static void
+childunlink(struct proc *p)
+{
+  *p->sibprev = p->sibling;
+  if(p->sibling)
+    p->sibling->sibprev = p->sibprev;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -83,21 +444,31 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock); // acquire lock of process table
-
   // Iterate through process table. Find an unused slot, jump to 'found'
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+    acquire(&p->lock);
     if (p->state == UNUSED)
       goto found;
-
-  release(&ptable.lock);
+    release(&p->lock);
+  }
   return 0;
 
 found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
-
-  release(&ptable.lock); // process table slot isn't modifiable or runnable now
+  p->pid = xadd(&nextpid, 1);
+  p->nice = 0;
+  p->prio = 0;
+  p->slice = 0;
+  p->boostgen = boostgen;
+  p->lastcpu = -1;
+  p->affinity = ~0;
+  p->uticks = p->sticks = 0;
+  p->cycles = 0;
+  p->nvcsw = p->nivcsw = 0;
+  p->nfault = 0;
+  memset(p->syscalls, 0, sizeof(p->syscalls));
+
+  release(&p->lock); // process table slot isn't modifiable or runnable now
 
   // Allocate kernel stack. Gets a free page of memory, 
   if ((p->kstack = kalloc()) == 0) {
@@ -140,6 +511,8 @@ userinit(void)
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  if(mapvdso(p->pgdir, p->pid) < 0)
+    panic("userinit: out of memory?");
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
@@ -152,16 +525,17 @@ userinit(void)
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
+  pidhashadd(p);
 
   // this assignment to p->state lets other cores
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -202,14 +576,16 @@ fork(void)
 
   // Copy parent's pgdir. If copyuvm fails, free the kernel stack and
   // set child process state to UNUSED.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+     mapvdso(np->pgdir, np->pid) < 0){
+    if(np->pgdir)
+      freevm(np->pgdir);
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -224,15 +600,28 @@ fork(void)
   // Copy parent process's name
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
+  // Child starts at the parent's nice level, on the same CPUs.
+  np->nice = curproc->nice;
+  np->affinity = curproc->affinity;
+#ifdef SCHED_MLFQ
+  np->prio = np->nice;
+#endif
+
   // Parent return child's PID. 
   pid = np->pid;
 
-  // Set child process state to runnable.
   acquire(&ptable.lock);
+  np->parent = curproc;
+  childpush(&curproc->kids, np);
+  release(&ptable.lock);
+  pidhashadd(np);
 
-  np->state = RUNNABLE;
+  // Set child process state to runnable.
+  acquire(&np->lock);
 
-  release(&ptable.lock);
+  setrunnable(np);
+
+  release(&np->lock);
 
   return pid;
 }
@@ -265,23 +654,35 @@ exit(void)
 
   acquire(&ptable.lock);
 
+  // Move to the parent's list of exited children.
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  childunlink(curproc);
+  childpush(&curproc->parent->zombies, curproc);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init, making initproc the parent.
   // All processes need a parent to reap their resources, hence this portion.
   // initproc is designed to periodically call wait(), which cleans up any
   // processes in the ZOMBIE state.
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (p->parent == curproc) { // condition indicates curproc is child
+  while ((p = curproc->kids) != 0) {
+    childunlink(p);
+    p->parent = initproc;
+    childpush(&initproc->kids, p);
+  }
+  if (curproc->zombies) {
+    while ((p = curproc->zombies) != 0) {
+      childunlink(p);
       p->parent = initproc;
-      if (p->state == ZOMBIE)
-        wakeup1(initproc);
+      childpush(&initproc->zombies, p);
     }
+    wakeup(initproc);
   }
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return. The parent can't
+  // free our stack until sched() gives up curproc->lock.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -293,42 +694,39 @@ int
 wait(void)
 {
   struct proc *p;
-  int havekids, pid;
+  int pid;
   struct proc *curproc = myproc();
   
   acquire(&ptable.lock);
   for(;;) {
-    // Scan through table looking for exited children.
-    havekids = 0;
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-      if (p->parent != curproc)
-        continue;
-
-      havekids = 1;
-      if (p->state == ZOMBIE) {
-        // Found one.
-        pid = p->pid;
-        kfree(p->kstack); // free kernel stack
-        p->kstack = 0;
-        freevm(p->pgdir); // free pgdir
-        p->pid = 0; // reset the struct proc (p-> instructions)
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        release(&ptable.lock);
-        return pid;
-      }
+    // Take the first exited child, if any.
+    if ((p = curproc->zombies) != 0) {
+      childunlink(p);
+      pidhashdel(p);
+      pid = p->pid;
+      // Waits until the child has switched off its kernel stack.
+      acquire(&p->lock);
+      kfree(p->kstack); // free kernel stack
+      p->kstack = 0;
+      freevm(p->pgdir); // free pgdir
+      p->pid = 0; // reset the struct proc (p-> instructions)
+      p->parent = 0;
+      p->name[0] = 0;
+      p->killed = 0;
+      p->state = UNUSED;
+      release(&p->lock);
+      release(&ptable.lock);
+      return pid;
     }
 
     // No point waiting if we don't have any children.
-    if (!havekids || curproc->killed) {
+    if (curproc->kids == 0 || curproc->killed) {
       release(&ptable.lock);
       return -1;
     }
 
     // Process has children but none have exited.
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -346,43 +744,59 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int id = cpuid();
+  uint64 t0;
   c->proc = 0; // set current cpu's process pointer to be null
   
   for(;;) {
-    // Enable interrupts on this processor.
-    sti();
-
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-
-    // Iterate over process table, looking for a RUNNABLE process
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-
-      // Execution will eventually return here with another swtch call but with
-      // arguments in reverse, so switch back to kernel pgdir
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    // Look for work with interrupts off and c->idle set, so that
+    // setrunnable() on another CPU either finds c->idle set and
+    // sends an IPI, or has queued a process that pickproc() sees.
+    // With nothing to run, halt instead of spinning on the run
+    // queue locks; any interrupt, or that IPI, wakes us up.
+    cli();
+    xchg(&c->idle, 1);
+
+    // Take a RUNNABLE process off a run queue.
+    if((p = pickproc(id)) == 0){
+      timerarm();
+      stihlt();
+      continue;
     }
-
-    release(&ptable.lock);
+    c->idle = 0;
+
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler");
+    c->proc = p;
+    switchuvm(p);
+    p->state = RUNNING;
+    p->lastcpu = id;
+    trace(TR_RUN, 0, 0);
+    // Nothing advances ticks while a CPU idles, so catch up
+    // rather than charge p for the idle time.
+    c->lasttick = readticks();
+    timerarm();
+
+    t0 = rdtsc();
+    swtch(&(c->scheduler), p->context);
+    p->cycles += rdtsc() - t0;
+
+    // Execution will eventually return here with another swtch call but with
+    // arguments in reverse, so switch back to kernel pgdir
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -395,8 +809,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if (!holding(&ptable.lock)) // should be called after acquiring process table lock
-    panic("sched ptable.lock");
+  if (!holding(&p->lock)) // should be called after acquiring the process's lock
+    panic("sched p->lock");
   if (mycpu()->ncli != 1) // should not be holding any other locks
     panic("sched locks");
   if (p->state == RUNNING) // state should be changed beforehand
@@ -404,6 +818,8 @@ sched(void)
   if (readeflags()&FL_IF) // interrupts should be disabled
     panic("sched interruptible");
 
+  trace(TR_SCHED, p->state, 0);
+
   // pushcli stack is property of kernel thread, so save current value
   intena = mycpu()->intena; 
   swtch(&p->context, mycpu()->scheduler);
@@ -417,10 +833,75 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  setrunnable(p);
+  p->nivcsw++;
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
+}
+
+// Charge the current process for n clock ticks. Returns 1 if it
+// should give up the CPU: with SCHED_RR after any tick, with
+// SCHED_MLFQ once it has used up its slice or a higher level is
+// waiting.
+int
+timeslice(int n)
+{
+#ifdef SCHED_MLFQ
+  struct proc *p = myproc();
+  struct runq *rq;
+  int i, r;
+
+  r = 0;
+  acquire(&p->lock);
+  boostproc(p);
+  if((p->slice += n) >= (1 << p->prio)){
+    p->slice = 0;
+    if(p->prio < NPRIO-1)
+      p->prio++;
+    r = 1;
+  }
+  rq = &runq[cpuid()];
+  for(i = 0; i < p->prio; i++)
+    if(rq->q[i].head)  // unlocked peek
+      r = 1;
+  release(&p->lock);
+  return r;
+#else
+  return n > 0;
+#endif
+}
+
+// How many more ticks the current process may run before
+// timeslice() has it give up the CPU, or 0 if no other process
+// is waiting for this CPU, in which case it may run until one
+// is. Interrupts must be off.
+int
+quantum(void)
+{
+  struct proc *p = myproc();
+
+  if(p == 0 || runq[cpuid()].n == 0)
+    return 0;
+#ifdef SCHED_MLFQ
+  if(p->slice >= (1 << p->prio))
+    return 1;
+  return (1 << p->prio) - p->slice;
+#else
+  return 1;
+#endif
+}
+
+// Move every process back to its nice level. Called by
+// tickupdate() every BOOSTTICKS ticks.
+void
+boost(void)
+{
+#ifdef SCHED_MLFQ
+  boostgen++;
+#endif
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -430,8 +911,8 @@ forkret(void)
 {
   static int first = 1;
 
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -451,6 +932,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct sleepq *sq;
   
   if (p == 0) // check that cpu is actually running a process
     panic("sleep");
@@ -458,59 +940,71 @@ sleep(void *chan, struct spinlock *lk)
   if (lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Must get onto chan's sleep queue, and acquire p->lock in
+  // order to change p->state and then call sched.
+  // Once we hold the queue's lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup runs with the queue's lock locked),
   // so it's okay to release lk.
-  if(lk != &ptable.lock) {  //DOC: sleeplock0
-  
-    // This specific order is needed because it ensures a smooth transition from
-    // the checking of the condition to sleeping.
-    // If lk was released before, there is a period of time when another process
-    // would acquire the ptable lock and change the process's state.
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+
+  // This specific order is needed because it ensures a smooth transition from
+  // the checking of the condition to sleeping.
+  // If lk was released before, there is a period of time when another process
+  // could change the condition and call wakeup before p is on the queue.
+  sq = chanq(chan);
+  acquire(&sq->lock);  //DOC: sleeplock1
+  acquire(&p->lock);
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
+  p->chnext = sq->head;
+  sq->head = p;
   p->state = SLEEPING;
+  p->nvcsw++;
+  trace(TR_SLEEP, (uint)chan, 0);
+  release(&sq->lock);
 
-  sched(); // recall: must hold ptable lock
+  sched(); // recall: must hold p->lock
 
-  // Tidy up.
-  p->chan = 0;
+  // Tidy up. wakeup() takes p off the queue, but kill() leaves
+  // that to us, since it can't take the queue lock after p->lock.
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(&sq->lock);
+  if(p->chan)
+    unqueue(sq, p);
+  release(&sq->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
-{
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
-}
-
-// Wake up all processes sleeping on chan.
+// Only chan's sleep queue is searched; other channels that
+// hash to the same queue are left alone.
 void
 wakeup(void *chan)
 {
-  // acquire lock to let process that might be holding this lock
-  // and doing wakeup() complete their tasks. Requiring modifying process state.
-  acquire(&ptable.lock); 
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct sleepq *sq = chanq(chan);
+  struct proc *p, **pp;
+
+  acquire(&sq->lock);
+  for(pp = &sq->head; (p = *pp) != 0; ){
+    if(p->chan != chan){
+      pp = &p->chnext;
+      continue;
+    }
+    *pp = p->chnext;
+    p->chan = 0;
+    acquire(&p->lock);
+    if(p->state == SLEEPING){  // not if kill() got there first
+      trace(TR_WAKEUP, (uint)chan, p->pid);
+      setrunnable(p);
+    }
+    release(&p->lock);
+  }
+  release(&sq->lock);
 }
 
 // Kill the process with the given pid.
@@ -521,20 +1015,123 @@ kill(int pid)
 {
   struct proc *p;
 
-  acquire(&ptable.lock);
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    // If match, set killed flag and return 0.
-    if (p->pid == pid) {
-      p->killed = 1;
-      // Wake process from sleep if necessary. Ensures it gets terminated quickly.
-      if (p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if ((p = findproc(pid)) == 0)
+    return -1; // no PID match found
+
+  // Set killed flag and return 0.
+  p->killed = 1;
+  // Wake process from sleep if necessary. Ensures it gets terminated quickly.
+  if (p->state == SLEEPING)
+    setrunnable(p);
+  release(&p->lock);
+  return 0;
+}
+
+// Set the priority of the process with the given pid to prio,
+// from 0 (highest) to NPRIO-1. Only SCHED_MLFQ pays attention.
+// A prio of -1 changes nothing and returns the level the process
+// is at now.
+int
+setpriority(int pid, int prio)
+{
+  struct proc *p;
+
+  if(prio < -1 || prio >= NPRIO || (p = findproc(pid)) == 0)
+    return -1;
+  if(prio < 0){
+    boostproc(p);
+    prio = p->prio;
+    release(&p->lock);
+    return prio;
   }
-  release(&ptable.lock);
-  return -1; // no PID match found
+  p->nice = prio;
+#ifdef SCHED_MLFQ
+  p->prio = prio;
+  p->slice = 0;
+#endif
+  release(&p->lock);
+  return 0;
+}
+
+// Restrict the process with the given pid to the CPUs in mask,
+// bit i standing for CPU i. If that excludes the CPU the caller
+// is running on, the caller moves at once, as does a process
+// waiting on an excluded CPU's run queue; any other process moves
+// the next time it is scheduled.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  int move;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0 || (p = findproc(pid)) == 0)
+    return -1;
+  p->affinity = mask;
+  move = p == myproc() && (mask & (1 << cpuid())) == 0;
+  // A queued process could otherwise wait for a steal that a busy
+  // system never gets round to.
+  if(p->state == RUNNABLE && rqremove(p))
+    setrunnable(p);
+  release(&p->lock);
+  if(move)
+    yield();
+  return 0;
+}
+
+// Fill in ru from p, which must be locked.
+static void
+rusagefill(struct proc *p, struct rusage *ru)
+{
+  int i;
+
+  ru->pid = p->pid;
+  ru->state = p->state;
+  safestrcpy(ru->name, p->name, sizeof(ru->name));
+  ru->uticks = p->uticks;
+  ru->sticks = p->sticks;
+  ru->cycles = p->cycles;
+  ru->nvcsw = p->nvcsw;
+  ru->nivcsw = p->nivcsw;
+  ru->nfault = p->nfault;
+  ru->nsyscall = 0;
+  for(i = 0; i < NSYSCALL; i++){
+    ru->syscalls[i] = p->syscalls[i];
+    ru->nsyscall += p->syscalls[i];
+  }
+}
+
+// Copy out the resource usage of the process with the given pid,
+// or of the caller if pid is 0, or if pid is -1, of up to n
+// processes. Returns how many were copied, or -1 if there is no
+// process pid.
+int
+getrusage(int pid, struct rusage *ru, int n)
+{
+  struct proc *p;
+  int i;
+
+  if(pid != -1){
+    if(n < 1)
+      return -1;
+    if(pid == 0){
+      p = myproc();
+      acquire(&p->lock);
+    } else if((p = findproc(pid)) == 0)
+      return -1;
+    rusagefill(p, ru);
+    release(&p->lock);
+    return 1;
+  }
+
+  i = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+    acquire(&p->lock);
+    if(p->state != UNUSED)
+      rusagefill(p, &ru[i++]);
+    release(&p->lock);
+  }
+  return i;
 }
 
 //PAGEBREAK: 36
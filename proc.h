@@ -7,7 +7,15 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
-  struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted in scheduler() waiting for work
+  volatile uint unsliced;      // Running a process with no time slice armed
+  uint lasttick;               // ticks when it last charged a process
+  struct mcsnode mcs[NMCS];    // Queue nodes for the MCS locks it waits on
+  uint mcsused;                // Which of mcs[] are in use
+
+  // Cpu-local storage variables, read through %gs; see seginit().
+  struct cpu *cpu;             // This cpu, at %gs:0
+  struct proc *proc;           // The process running on this cpu or null, at %gs:4
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,19 +44,43 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, killed
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *kids;           // Children that haven't exited
+  struct proc *zombies;        // Children that have exited
+  struct proc *sibling;        // Next on parent's kids or zombies
+  struct proc **sibprev;       // What points to us on that list
+  struct proc *pidnext;        // Next in the same pid hash bucket
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *chnext;         // Next process on chan's sleep queue
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct proc *rqnext;         // Next process on the same run queue
+  int nice;                    // Priority set by setpriority()
+  int prio;                    // MLFQ level; 0 is the highest
+  int slice;                   // Ticks used at this level
+  uint boostgen;               // Last priority boost seen
+  int lastcpu;                 // CPU it last ran on, or -1
+  uint affinity;               // CPUs it may run on, bit i for CPU i
+
+  // Resource usage, for getrusage(). Only the CPU running the
+  // process updates these, so they need no lock.
+  uint uticks;                 // Clock ticks that found it in user space
+  uint sticks;                 // Clock ticks that found it in the kernel
+  uint64 cycles;               // Time it has run, in cycles
+  uint nvcsw;                  // Times it slept
+  uint nivcsw;                 // Times it was preempted
+  uint nfault;                 // Exceptions it took in user space
+  uint syscalls[NSYSCALL];     // System calls made, by number
 };
 
 // Process memory is laid out contiguously, low addresses first:
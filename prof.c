@@ -0,0 +1,126 @@
+// Sampling profiler.
+//
+// While profiling is on, each CPU's LAPIC timer runs periodically,
+// profrate times a tick, rather than one-shot (see timer.c), and
+// every timer interrupt records the interrupted %eip in that
+// CPU's ring of samples. The clock comes from the TSC, so the
+// extra interrupts don't change the length of a tick.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "prof.h"
+
+#define MAXPROFRATE 100  // samples per tick, at most
+
+struct profbuf {
+  struct spinlock lock;
+  struct profsample s[NPROF];
+  uint r;        // samples read
+  uint w;        // samples written
+  uint dropped;  // samples lost because the ring was full
+};
+
+static struct profbuf prof[NCPU];
+static int profrate;  // samples per tick, or 0 if not profiling
+
+void
+profinit(void)
+{
+  struct profbuf *pb;
+
+  for(pb = prof; pb < &prof[NCPU]; pb++)
+    initlock(&pb->lock, "prof");
+}
+
+// Samples per tick, or 0 if the profiler is off.
+int
+profiling(void)
+{
+  return profrate;
+}
+
+// Called on every timer interrupt, with interrupts off.
+void
+profintr(struct trapframe *tf)
+{
+  struct profbuf *pb = &prof[cpuid()];
+  struct profsample *s;
+  struct proc *p;
+
+  if(profrate == 0)
+    return;
+
+  acquire(&pb->lock);
+  if(pb->w - pb->r < NPROF){
+    s = &pb->s[pb->w++ % NPROF];
+    s->eip = tf->eip;
+    if((p = myproc()) != 0){
+      s->pid = p->pid;
+      safestrcpy(s->name, p->name, sizeof(s->name));
+    } else {
+      s->pid = 0;
+      s->name[0] = 0;
+    }
+  } else
+    pb->dropped++;
+  release(&pb->lock);
+}
+
+// Start profiling at rate samples per tick, throwing away any
+// samples not yet read, or stop if rate is 0. Returns the number
+// of samples lost since profiling started because a CPU's ring
+// was full, or -1 if rate is out of range.
+int
+profctl(int rate)
+{
+  struct profbuf *pb;
+  int dropped, i;
+
+  if(rate < 0 || rate > MAXPROFRATE)
+    return -1;
+  dropped = 0;
+  for(pb = prof; pb < &prof[NCPU]; pb++){
+    acquire(&pb->lock);
+    dropped += pb->dropped;
+    if(rate){
+      pb->r = pb->w = 0;
+      pb->dropped = 0;
+    }
+    release(&pb->lock);
+  }
+  profrate = rate;
+
+  // Have every CPU rearm its timer.
+  pushcli();
+  timerarm();
+  for(i = 0; i < ncpu; i++)
+    if(i != cpuid())
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_RESCHED);
+  popcli();
+  return dropped;
+}
+
+// Copy out up to n samples, taking them out of the rings.
+// Returns how many were copied.
+int
+profread(struct profsample *s, int n)
+{
+  struct profbuf *pb;
+  int i;
+
+  i = 0;
+  for(pb = prof; pb < &prof[NCPU] && i < n; pb++){
+    acquire(&pb->lock);
+    while(pb->r != pb->w && i < n)
+      s[i++] = pb->s[pb->r++ % NPROF];
+    release(&pb->lock);
+  }
+  return i;
+}
@@ -0,0 +1,7 @@
+// A profiler sample, as returned by the profread system call:
+// where a CPU was when its timer interrupted it.
+struct profsample {
+  uint eip;        // Interrupted instruction, user or kernel
+  int pid;         // Process running on the CPU, or 0 if none
+  char name[16];   // That process's name, to find its symbols
+};
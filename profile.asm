@@ -0,0 +1,2361 @@
+
+_profile:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+           lines[i].prog, lines[i].fn);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+  int dropped, n, pid, rate;
+
+  rate = 10;
+      10:	bb 0a 00 00 00       	mov    $0xa,%ebx
+{
+      15:	51                   	push   %ecx
+      16:	83 ec 18             	sub    $0x18,%esp
+      19:	8b 39                	mov    (%ecx),%edi
+      1b:	8b 51 04             	mov    0x4(%ecx),%edx
+  argv++;
+  argc--;
+      1e:	8d 47 ff             	lea    -0x1(%edi),%eax
+  argv++;
+      21:	8d 72 04             	lea    0x4(%edx),%esi
+  if(argc > 1 && strcmp(argv[0], "-r") == 0){
+      24:	83 f8 01             	cmp    $0x1,%eax
+      27:	7f 17                	jg     40 <main+0x40>
+    rate = atoi(argv[1]);
+    argv += 2;
+    argc -= 2;
+  }
+  if(argc < 1){
+      29:	85 c0                	test   %eax,%eax
+      2b:	7f 2f                	jg     5c <main+0x5c>
+    printf(2, "usage: profile [-r rate] cmd ...\n");
+      2d:	50                   	push   %eax
+      2e:	50                   	push   %eax
+      2f:	68 d4 11 00 00       	push   $0x11d4
+      34:	6a 02                	push   $0x2
+      36:	e8 c5 0d 00 00       	call   e00 <printf>
+    exit();
+      3b:	e8 1d 0b 00 00       	call   b5d <exit>
+  if(argc > 1 && strcmp(argv[0], "-r") == 0){
+      40:	50                   	push   %eax
+      41:	50                   	push   %eax
+      42:	68 72 11 00 00       	push   $0x1172
+      47:	ff 72 04             	push   0x4(%edx)
+      4a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+      4d:	e8 fe 07 00 00       	call   850 <strcmp>
+      52:	83 c4 10             	add    $0x10,%esp
+      55:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      58:	85 c0                	test   %eax,%eax
+      5a:	74 6b                	je     c7 <main+0xc7>
+  }
+  if((samples = malloc(MAXSAMPLE * sizeof(*samples))) == 0){
+      5c:	83 ec 0c             	sub    $0xc,%esp
+      5f:	68 00 00 03 00       	push   $0x30000
+      64:	e8 d7 0f 00 00       	call   1040 <malloc>
+      69:	83 c4 10             	add    $0x10,%esp
+      6c:	a3 ac 16 00 00       	mov    %eax,0x16ac
+      71:	85 c0                	test   %eax,%eax
+      73:	74 3f                	je     b4 <main+0xb4>
+    printf(2, "profile: out of memory\n");
+    exit();
+  }
+
+  if(profctl(rate) < 0){
+      75:	83 ec 0c             	sub    $0xc,%esp
+      78:	53                   	push   %ebx
+      79:	e8 83 0c 00 00       	call   d01 <profctl>
+      7e:	83 c4 10             	add    $0x10,%esp
+      81:	85 c0                	test   %eax,%eax
+      83:	78 7d                	js     102 <main+0x102>
+    printf(2, "profile: bad rate %d\n", rate);
+    exit();
+  }
+  if((pid = fork()) < 0){
+      85:	e8 c4 0a 00 00       	call   b4e <fork>
+      8a:	85 c0                	test   %eax,%eax
+      8c:	78 57                	js     e5 <main+0xe5>
+    printf(2, "profile: fork failed\n");
+    profctl(0);
+    exit();
+  }
+  if(pid == 0){
+      8e:	0f 85 81 00 00 00    	jne    115 <main+0x115>
+    exec(argv[0], argv);
+      94:	50                   	push   %eax
+      95:	50                   	push   %eax
+      96:	56                   	push   %esi
+      97:	ff 36                	push   (%esi)
+      99:	e8 28 0b 00 00       	call   bc6 <exec>
+    printf(2, "profile: exec %s failed\n", argv[0]);
+      9e:	83 c4 0c             	add    $0xc,%esp
+      a1:	ff 36                	push   (%esi)
+      a3:	68 b9 11 00 00       	push   $0x11b9
+      a8:	6a 02                	push   $0x2
+      aa:	e8 51 0d 00 00       	call   e00 <printf>
+    exit();
+      af:	e8 a9 0a 00 00       	call   b5d <exit>
+    printf(2, "profile: out of memory\n");
+      b4:	57                   	push   %edi
+      b5:	57                   	push   %edi
+      b6:	68 75 11 00 00       	push   $0x1175
+      bb:	6a 02                	push   $0x2
+      bd:	e8 3e 0d 00 00       	call   e00 <printf>
+    exit();
+      c2:	e8 96 0a 00 00       	call   b5d <exit>
+    rate = atoi(argv[1]);
+      c7:	83 ec 0c             	sub    $0xc,%esp
+      ca:	ff 72 08             	push   0x8(%edx)
+      cd:	e8 1e 09 00 00       	call   9f0 <atoi>
+    argv += 2;
+      d2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    argc -= 2;
+      d5:	83 c4 10             	add    $0x10,%esp
+    rate = atoi(argv[1]);
+      d8:	89 c3                	mov    %eax,%ebx
+    argc -= 2;
+      da:	8d 47 fd             	lea    -0x3(%edi),%eax
+    argv += 2;
+      dd:	8d 72 0c             	lea    0xc(%edx),%esi
+    argc -= 2;
+      e0:	e9 44 ff ff ff       	jmp    29 <main+0x29>
+    printf(2, "profile: fork failed\n");
+      e5:	52                   	push   %edx
+      e6:	52                   	push   %edx
+      e7:	68 a3 11 00 00       	push   $0x11a3
+      ec:	6a 02                	push   $0x2
+      ee:	e8 0d 0d 00 00       	call   e00 <printf>
+    profctl(0);
+      f3:	31 c9                	xor    %ecx,%ecx
+      f5:	89 0c 24             	mov    %ecx,(%esp)
+      f8:	e8 04 0c 00 00       	call   d01 <profctl>
+    exit();
+      fd:	e8 5b 0a 00 00       	call   b5d <exit>
+    printf(2, "profile: bad rate %d\n", rate);
+     102:	56                   	push   %esi
+     103:	53                   	push   %ebx
+     104:	68 8d 11 00 00       	push   $0x118d
+     109:	6a 02                	push   $0x2
+     10b:	e8 f0 0c 00 00       	call   e00 <printf>
+    exit();
+     110:	e8 48 0a 00 00       	call   b5d <exit>
+  }
+  wait();
+     115:	e8 52 0a 00 00       	call   b6c <wait>
+  dropped = profctl(0);
+     11a:	83 ec 0c             	sub    $0xc,%esp
+
+  while(nsample < MAXSAMPLE &&
+        (n = profread(samples + nsample, MAXSAMPLE - nsample)) > 0)
+     11d:	bb 00 20 00 00       	mov    $0x2000,%ebx
+  dropped = profctl(0);
+     122:	6a 00                	push   $0x0
+     124:	e8 d8 0b 00 00       	call   d01 <profctl>
+  while(nsample < MAXSAMPLE &&
+     129:	83 c4 10             	add    $0x10,%esp
+  dropped = profctl(0);
+     12c:	89 c6                	mov    %eax,%esi
+  while(nsample < MAXSAMPLE &&
+     12e:	a1 a8 16 00 00       	mov    0x16a8,%eax
+     133:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+     138:	7e 18                	jle    152 <main+0x152>
+     13a:	eb 36                	jmp    172 <main+0x172>
+     13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    nsample += n;
+     140:	03 05 a8 16 00 00    	add    0x16a8,%eax
+     146:	a3 a8 16 00 00       	mov    %eax,0x16a8
+  while(nsample < MAXSAMPLE &&
+     14b:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+     150:	7f 20                	jg     172 <main+0x172>
+        (n = profread(samples + nsample, MAXSAMPLE - nsample)) > 0)
+     152:	89 da                	mov    %ebx,%edx
+     154:	83 ec 08             	sub    $0x8,%esp
+     157:	29 c2                	sub    %eax,%edx
+     159:	52                   	push   %edx
+     15a:	8d 14 40             	lea    (%eax,%eax,2),%edx
+     15d:	a1 ac 16 00 00       	mov    0x16ac,%eax
+     162:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+     165:	50                   	push   %eax
+     166:	e8 a5 0b 00 00       	call   d10 <profread>
+  while(nsample < MAXSAMPLE &&
+     16b:	83 c4 10             	add    $0x10,%esp
+     16e:	85 c0                	test   %eax,%eax
+     170:	7f ce                	jg     140 <main+0x140>
+  report(dropped);
+     172:	83 ec 0c             	sub    $0xc,%esp
+     175:	56                   	push   %esi
+     176:	e8 15 05 00 00       	call   690 <report>
+  exit();
+     17b:	e8 dd 09 00 00       	call   b5d <exit>
+
+00000180 <atox>:
+{
+     180:	55                   	push   %ebp
+  for(x = 0; ; s++){
+     181:	31 c0                	xor    %eax,%eax
+{
+     183:	89 e5                	mov    %esp,%ebp
+     185:	53                   	push   %ebx
+     186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     189:	eb 0f                	jmp    19a <atox+0x1a>
+     18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     18f:	90                   	nop
+      x = x*16 + *s - '0';
+     190:	c1 e0 04             	shl    $0x4,%eax
+     193:	8d 44 10 d0          	lea    -0x30(%eax,%edx,1),%eax
+  for(x = 0; ; s++){
+     197:	83 c1 01             	add    $0x1,%ecx
+    if('0' <= *s && *s <= '9')
+     19a:	0f be 11             	movsbl (%ecx),%edx
+     19d:	8d 5a d0             	lea    -0x30(%edx),%ebx
+     1a0:	80 fb 09             	cmp    $0x9,%bl
+     1a3:	76 eb                	jbe    190 <atox+0x10>
+    else if('a' <= *s && *s <= 'f')
+     1a5:	8d 5a 9f             	lea    -0x61(%edx),%ebx
+     1a8:	80 fb 05             	cmp    $0x5,%bl
+     1ab:	77 13                	ja     1c0 <atox+0x40>
+      x = x*16 + *s - 'a' + 10;
+     1ad:	c1 e0 04             	shl    $0x4,%eax
+     1b0:	8d 44 10 a9          	lea    -0x57(%eax,%edx,1),%eax
+     1b4:	eb e1                	jmp    197 <atox+0x17>
+     1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1bd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     1c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1c3:	c9                   	leave
+     1c4:	c3                   	ret
+     1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <loadsyms>:
+{
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	57                   	push   %edi
+     1d4:	56                   	push   %esi
+     1d5:	53                   	push   %ebx
+     1d6:	83 ec 44             	sub    $0x44,%esp
+  if((fd = open(file, O_RDONLY)) < 0)
+     1d9:	6a 00                	push   $0x0
+     1db:	ff 75 08             	push   0x8(%ebp)
+     1de:	e8 f2 09 00 00       	call   bd5 <open>
+     1e3:	83 c4 10             	add    $0x10,%esp
+     1e6:	85 c0                	test   %eax,%eax
+     1e8:	0f 88 07 02 00 00    	js     3f5 <loadsyms+0x225>
+  if(fstat(fd, &st) < 0 || (buf = malloc(st.size + 1)) == 0){
+     1ee:	83 ec 08             	sub    $0x8,%esp
+     1f1:	89 c3                	mov    %eax,%ebx
+     1f3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     1f6:	50                   	push   %eax
+     1f7:	53                   	push   %ebx
+     1f8:	e8 05 0a 00 00       	call   c02 <fstat>
+     1fd:	83 c4 10             	add    $0x10,%esp
+     200:	85 c0                	test   %eax,%eax
+     202:	0f 88 e1 01 00 00    	js     3e9 <loadsyms+0x219>
+     208:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     20b:	83 ec 0c             	sub    $0xc,%esp
+     20e:	83 c0 01             	add    $0x1,%eax
+     211:	50                   	push   %eax
+     212:	e8 29 0e 00 00       	call   1040 <malloc>
+     217:	83 c4 10             	add    $0x10,%esp
+     21a:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     21d:	89 c7                	mov    %eax,%edi
+     21f:	85 c0                	test   %eax,%eax
+     221:	0f 84 c2 01 00 00    	je     3e9 <loadsyms+0x219>
+  n = read(fd, buf, st.size);
+     227:	83 ec 04             	sub    $0x4,%esp
+     22a:	ff 75 e4             	push   -0x1c(%ebp)
+     22d:	50                   	push   %eax
+     22e:	53                   	push   %ebx
+     22f:	e8 56 09 00 00       	call   b8a <read>
+  close(fd);
+     234:	89 1c 24             	mov    %ebx,(%esp)
+  n = read(fd, buf, st.size);
+     237:	89 c6                	mov    %eax,%esi
+  close(fd);
+     239:	e8 6a 09 00 00       	call   ba8 <close>
+  if(n != st.size)
+     23e:	83 c4 10             	add    $0x10,%esp
+     241:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+     244:	0f 85 ab 01 00 00    	jne    3f5 <loadsyms+0x225>
+  buf[n] = 0;
+     24a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  for(p = buf; *p; p++)
+     24e:	0f b6 07             	movzbl (%edi),%eax
+     251:	89 fa                	mov    %edi,%edx
+     253:	84 c0                	test   %al,%al
+     255:	0f 84 84 01 00 00    	je     3df <loadsyms+0x20f>
+  n = 0;
+     25b:	31 c9                	xor    %ecx,%ecx
+     25d:	8d 76 00             	lea    0x0(%esi),%esi
+      n++;
+     260:	3c 0a                	cmp    $0xa,%al
+     262:	0f 94 c0             	sete   %al
+  for(p = buf; *p; p++)
+     265:	83 c2 01             	add    $0x1,%edx
+      n++;
+     268:	0f b6 c0             	movzbl %al,%eax
+     26b:	01 c1                	add    %eax,%ecx
+  for(p = buf; *p; p++)
+     26d:	0f b6 02             	movzbl (%edx),%eax
+     270:	84 c0                	test   %al,%al
+     272:	75 ec                	jne    260 <loadsyms+0x90>
+  syms = malloc((n + 1) * sizeof(*syms));
+     274:	8d 44 49 03          	lea    0x3(%ecx,%ecx,2),%eax
+     278:	c1 e0 02             	shl    $0x2,%eax
+     27b:	83 ec 0c             	sub    $0xc,%esp
+     27e:	50                   	push   %eax
+     27f:	e8 bc 0d 00 00       	call   1040 <malloc>
+  for(p = buf; *p; p = q + 1){
+     284:	83 c4 10             	add    $0x10,%esp
+  syms = malloc((n + 1) * sizeof(*syms));
+     287:	89 c7                	mov    %eax,%edi
+  for(p = buf; *p; p = q + 1){
+     289:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  n = 0;
+     28c:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+  for(p = buf; *p; p = q + 1){
+     293:	80 38 00             	cmpb   $0x0,(%eax)
+     296:	0f 84 29 01 00 00    	je     3c5 <loadsyms+0x1f5>
+  n = 0;
+     29c:	89 7d bc             	mov    %edi,-0x44(%ebp)
+     29f:	89 c7                	mov    %eax,%edi
+     2a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((q = strchr(p, '\n')) == 0)
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	6a 0a                	push   $0xa
+     2ad:	57                   	push   %edi
+     2ae:	e8 4d 06 00 00       	call   900 <strchr>
+     2b3:	83 c4 10             	add    $0x10,%esp
+     2b6:	89 c3                	mov    %eax,%ebx
+     2b8:	85 c0                	test   %eax,%eax
+     2ba:	0f 84 9b 00 00 00    	je     35b <loadsyms+0x18b>
+    *q = 0;
+     2c0:	c6 00 00             	movb   $0x0,(%eax)
+    syms[n].addr = atox(p);
+     2c3:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     2c6:	89 f9                	mov    %edi,%ecx
+  for(x = 0; ; s++){
+     2c8:	31 d2                	xor    %edx,%edx
+    syms[n].addr = atox(p);
+     2ca:	8b 75 bc             	mov    -0x44(%ebp),%esi
+     2cd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     2d0:	8d 34 86             	lea    (%esi,%eax,4),%esi
+  for(x = 0; ; s++){
+     2d3:	89 75 c0             	mov    %esi,-0x40(%ebp)
+     2d6:	89 de                	mov    %ebx,%esi
+     2d8:	eb 10                	jmp    2ea <loadsyms+0x11a>
+     2da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      x = x*16 + *s - '0';
+     2e0:	c1 e2 04             	shl    $0x4,%edx
+     2e3:	8d 54 02 d0          	lea    -0x30(%edx,%eax,1),%edx
+  for(x = 0; ; s++){
+     2e7:	83 c1 01             	add    $0x1,%ecx
+    if('0' <= *s && *s <= '9')
+     2ea:	0f be 01             	movsbl (%ecx),%eax
+     2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2f0:	80 fb 09             	cmp    $0x9,%bl
+     2f3:	76 eb                	jbe    2e0 <loadsyms+0x110>
+    else if('a' <= *s && *s <= 'f')
+     2f5:	8d 58 9f             	lea    -0x61(%eax),%ebx
+     2f8:	80 fb 05             	cmp    $0x5,%bl
+     2fb:	77 13                	ja     310 <loadsyms+0x140>
+      x = x*16 + *s - 'a' + 10;
+     2fd:	c1 e2 04             	shl    $0x4,%edx
+     300:	8d 54 02 a9          	lea    -0x57(%edx,%eax,1),%edx
+     304:	eb e1                	jmp    2e7 <loadsyms+0x117>
+     306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30d:	8d 76 00             	lea    0x0(%esi),%esi
+    syms[n].addr = atox(p);
+     310:	89 f3                	mov    %esi,%ebx
+     312:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    syms[n].name = strchr(p, ' ');
+     315:	83 ec 08             	sub    $0x8,%esp
+    syms[n].addr = atox(p);
+     318:	89 16                	mov    %edx,(%esi)
+    syms[n].name = strchr(p, ' ');
+     31a:	6a 20                	push   $0x20
+     31c:	57                   	push   %edi
+     31d:	e8 de 05 00 00       	call   900 <strchr>
+    syms[n].n = 0;
+     322:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+    if(syms[n].name == 0 || strchr(++syms[n].name, '.') != 0)
+     329:	83 c4 10             	add    $0x10,%esp
+    syms[n].name = strchr(p, ' ');
+     32c:	89 46 04             	mov    %eax,0x4(%esi)
+    if(syms[n].name == 0 || strchr(++syms[n].name, '.') != 0)
+     32f:	85 c0                	test   %eax,%eax
+     331:	74 1b                	je     34e <loadsyms+0x17e>
+     333:	83 ec 08             	sub    $0x8,%esp
+     336:	83 c0 01             	add    $0x1,%eax
+     339:	89 46 04             	mov    %eax,0x4(%esi)
+     33c:	6a 2e                	push   $0x2e
+     33e:	50                   	push   %eax
+     33f:	e8 bc 05 00 00       	call   900 <strchr>
+     344:	83 c4 10             	add    $0x10,%esp
+    n++;
+     347:	83 f8 01             	cmp    $0x1,%eax
+     34a:	83 55 c4 00          	adcl   $0x0,-0x3c(%ebp)
+  for(p = buf; *p; p = q + 1){
+     34e:	80 7b 01 00          	cmpb   $0x0,0x1(%ebx)
+     352:	8d 7b 01             	lea    0x1(%ebx),%edi
+     355:	0f 85 4d ff ff ff    	jne    2a8 <loadsyms+0xd8>
+     35b:	8b 7d bc             	mov    -0x44(%ebp),%edi
+  for(i = 1; i < n; i++){
+     35e:	83 7d c4 01          	cmpl   $0x1,-0x3c(%ebp)
+     362:	be 01 00 00 00       	mov    $0x1,%esi
+     367:	8d 5f 0c             	lea    0xc(%edi),%ebx
+     36a:	7e 59                	jle    3c5 <loadsyms+0x1f5>
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    t = syms[i];
+     370:	8b 43 04             	mov    0x4(%ebx),%eax
+     373:	8b 0b                	mov    (%ebx),%ecx
+     375:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+     378:	89 45 bc             	mov    %eax,-0x44(%ebp)
+     37b:	8b 43 08             	mov    0x8(%ebx),%eax
+     37e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     381:	89 d8                	mov    %ebx,%eax
+     383:	eb 1b                	jmp    3a0 <loadsyms+0x1d0>
+     385:	8d 76 00             	lea    0x0(%esi),%esi
+      syms[j] = syms[j-1];
+     388:	8b 58 f4             	mov    -0xc(%eax),%ebx
+     38b:	89 18                	mov    %ebx,(%eax)
+     38d:	8b 58 f8             	mov    -0x8(%eax),%ebx
+     390:	89 58 04             	mov    %ebx,0x4(%eax)
+     393:	8b 58 fc             	mov    -0x4(%eax),%ebx
+     396:	89 58 08             	mov    %ebx,0x8(%eax)
+    for(j = i; j > 0 && syms[j-1].addr > t.addr; j--)
+     399:	8d 42 f4             	lea    -0xc(%edx),%eax
+     39c:	39 c7                	cmp    %eax,%edi
+     39e:	74 38                	je     3d8 <loadsyms+0x208>
+     3a0:	89 c2                	mov    %eax,%edx
+     3a2:	3b 48 f4             	cmp    -0xc(%eax),%ecx
+     3a5:	72 e1                	jb     388 <loadsyms+0x1b8>
+     3a7:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+    syms[j] = t;
+     3aa:	8b 45 bc             	mov    -0x44(%ebp),%eax
+  for(i = 1; i < n; i++){
+     3ad:	83 c6 01             	add    $0x1,%esi
+    syms[j] = t;
+     3b0:	89 0a                	mov    %ecx,(%edx)
+  for(i = 1; i < n; i++){
+     3b2:	83 c3 0c             	add    $0xc,%ebx
+    syms[j] = t;
+     3b5:	89 42 04             	mov    %eax,0x4(%edx)
+     3b8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     3bb:	89 42 08             	mov    %eax,0x8(%edx)
+  for(i = 1; i < n; i++){
+     3be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     3c1:	39 c6                	cmp    %eax,%esi
+     3c3:	75 ab                	jne    370 <loadsyms+0x1a0>
+  *psyms = syms;
+     3c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3c8:	89 38                	mov    %edi,(%eax)
+}
+     3ca:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     3cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     3d0:	5b                   	pop    %ebx
+     3d1:	5e                   	pop    %esi
+     3d2:	5f                   	pop    %edi
+     3d3:	5d                   	pop    %ebp
+     3d4:	c3                   	ret
+     3d5:	8d 76 00             	lea    0x0(%esi),%esi
+     3d8:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+     3db:	89 fa                	mov    %edi,%edx
+     3dd:	eb cb                	jmp    3aa <loadsyms+0x1da>
+  for(p = buf; *p; p++)
+     3df:	b8 0c 00 00 00       	mov    $0xc,%eax
+     3e4:	e9 92 fe ff ff       	jmp    27b <loadsyms+0xab>
+    close(fd);
+     3e9:	83 ec 0c             	sub    $0xc,%esp
+     3ec:	53                   	push   %ebx
+     3ed:	e8 b6 07 00 00       	call   ba8 <close>
+    return -1;
+     3f2:	83 c4 10             	add    $0x10,%esp
+    return -1;
+     3f5:	c7 45 c4 ff ff ff ff 	movl   $0xffffffff,-0x3c(%ebp)
+     3fc:	eb cc                	jmp    3ca <loadsyms+0x1fa>
+     3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <lookup>:
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	56                   	push   %esi
+     405:	53                   	push   %ebx
+     406:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     409:	8b 75 08             	mov    0x8(%ebp),%esi
+     40c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(n == 0 || eip < syms[0].addr)
+     40f:	85 db                	test   %ebx,%ebx
+     411:	74 3d                	je     450 <lookup+0x50>
+     413:	3b 3e                	cmp    (%esi),%edi
+     415:	72 39                	jb     450 <lookup+0x50>
+  hi = n - 1;
+     417:	83 eb 01             	sub    $0x1,%ebx
+  lo = 0;
+     41a:	31 d2                	xor    %edx,%edx
+  while(lo < hi){
+     41c:	eb 16                	jmp    434 <lookup+0x34>
+     41e:	66 90                	xchg   %ax,%ax
+    mid = (lo + hi + 1) / 2;
+     420:	8d 44 13 01          	lea    0x1(%ebx,%edx,1),%eax
+     424:	89 c1                	mov    %eax,%ecx
+    if(syms[mid].addr <= eip)
+     426:	83 e0 fe             	and    $0xfffffffe,%eax
+    mid = (lo + hi + 1) / 2;
+     429:	d1 f9                	sar    %ecx
+    if(syms[mid].addr <= eip)
+     42b:	01 c8                	add    %ecx,%eax
+     42d:	3b 3c 86             	cmp    (%esi,%eax,4),%edi
+     430:	72 16                	jb     448 <lookup+0x48>
+    mid = (lo + hi + 1) / 2;
+     432:	89 ca                	mov    %ecx,%edx
+  while(lo < hi){
+     434:	39 da                	cmp    %ebx,%edx
+     436:	7c e8                	jl     420 <lookup+0x20>
+  return &syms[lo];
+     438:	8d 04 52             	lea    (%edx,%edx,2),%eax
+}
+     43b:	5b                   	pop    %ebx
+  return &syms[lo];
+     43c:	8d 04 86             	lea    (%esi,%eax,4),%eax
+}
+     43f:	5e                   	pop    %esi
+     440:	5f                   	pop    %edi
+     441:	5d                   	pop    %ebp
+     442:	c3                   	ret
+     443:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     447:	90                   	nop
+      hi = mid - 1;
+     448:	8d 59 ff             	lea    -0x1(%ecx),%ebx
+     44b:	eb e7                	jmp    434 <lookup+0x34>
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+     450:	5b                   	pop    %ebx
+    return 0;
+     451:	31 c0                	xor    %eax,%eax
+}
+     453:	5e                   	pop    %esi
+     454:	5f                   	pop    %edi
+     455:	5d                   	pop    %ebp
+     456:	c3                   	ret
+     457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45e:	66 90                	xchg   %ax,%ax
+
+00000460 <symbolize>:
+{
+     460:	55                   	push   %ebp
+  strcpy(file, prog ? prog : "kernel");
+     461:	b8 28 11 00 00       	mov    $0x1128,%eax
+{
+     466:	89 e5                	mov    %esp,%ebp
+     468:	57                   	push   %edi
+     469:	56                   	push   %esi
+     46a:	53                   	push   %ebx
+  strcpy(file, prog ? prog : "kernel");
+     46b:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+{
+     46e:	83 ec 64             	sub    $0x64,%esp
+  strcpy(file, prog ? prog : "kernel");
+     471:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     474:	85 c9                	test   %ecx,%ecx
+     476:	0f 45 45 08          	cmovne 0x8(%ebp),%eax
+     47a:	50                   	push   %eax
+     47b:	89 c7                	mov    %eax,%edi
+     47d:	53                   	push   %ebx
+     47e:	e8 9d 03 00 00       	call   820 <strcpy>
+  strcpy(file + strlen(file), ".sym");
+     483:	89 1c 24             	mov    %ebx,(%esp)
+     486:	e8 25 04 00 00       	call   8b0 <strlen>
+     48b:	5e                   	pop    %esi
+     48c:	5a                   	pop    %edx
+     48d:	68 2f 11 00 00       	push   $0x112f
+     492:	01 d8                	add    %ebx,%eax
+     494:	50                   	push   %eax
+     495:	e8 86 03 00 00       	call   820 <strcpy>
+  n = loadsyms(file, &syms);
+     49a:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     49d:	59                   	pop    %ecx
+     49e:	5e                   	pop    %esi
+     49f:	50                   	push   %eax
+     4a0:	53                   	push   %ebx
+     4a1:	e8 2a fd ff ff       	call   1d0 <loadsyms>
+  for(s = samples; s < samples + nsample; s++){
+     4a6:	8b 1d ac 16 00 00    	mov    0x16ac,%ebx
+     4ac:	83 c4 10             	add    $0x10,%esp
+  n = loadsyms(file, &syms);
+     4af:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  for(s = samples; s < samples + nsample; s++){
+     4b2:	a1 a8 16 00 00       	mov    0x16a8,%eax
+     4b7:	8d 14 40             	lea    (%eax,%eax,2),%edx
+     4ba:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+     4bd:	39 d3                	cmp    %edx,%ebx
+     4bf:	0f 83 b3 01 00 00    	jae    678 <symbolize+0x218>
+  unknown = 0;
+     4c5:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+     4cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4cf:	89 de                	mov    %ebx,%esi
+     4d1:	89 7d a8             	mov    %edi,-0x58(%ebp)
+     4d4:	eb 56                	jmp    52c <symbolize+0xcc>
+     4d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    if(prog ? s->eip >= KERNBASE || strcmp(s->name, prog) != 0
+     4e0:	85 d2                	test   %edx,%edx
+     4e2:	78 37                	js     51b <symbolize+0xbb>
+     4e4:	83 ec 08             	sub    $0x8,%esp
+     4e7:	8d 46 08             	lea    0x8(%esi),%eax
+     4ea:	51                   	push   %ecx
+     4eb:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     4ee:	50                   	push   %eax
+     4ef:	e8 5c 03 00 00       	call   850 <strcmp>
+     4f4:	83 c4 10             	add    $0x10,%esp
+     4f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4fa:	85 c0                	test   %eax,%eax
+     4fc:	75 12                	jne    510 <symbolize+0xb0>
+    if(n > 0 && (sym = lookup(syms, n, s->eip)) != 0)
+     4fe:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    s->pid = -1;
+     501:	c7 46 04 ff ff ff ff 	movl   $0xffffffff,0x4(%esi)
+    if(n > 0 && (sym = lookup(syms, n, s->eip)) != 0)
+     508:	85 c0                	test   %eax,%eax
+     50a:	7f 3f                	jg     54b <symbolize+0xeb>
+      unknown++;
+     50c:	83 45 ac 01          	addl   $0x1,-0x54(%ebp)
+     510:	8b 1d ac 16 00 00    	mov    0x16ac,%ebx
+     516:	a1 a8 16 00 00       	mov    0x16a8,%eax
+  for(s = samples; s < samples + nsample; s++){
+     51b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+     51e:	83 c6 18             	add    $0x18,%esi
+     521:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+     524:	39 d6                	cmp    %edx,%esi
+     526:	0f 83 94 00 00 00    	jae    5c0 <symbolize+0x160>
+    if(s->pid < 0)
+     52c:	8b 56 04             	mov    0x4(%esi),%edx
+     52f:	85 d2                	test   %edx,%edx
+     531:	78 e8                	js     51b <symbolize+0xbb>
+    if(prog ? s->eip >= KERNBASE || strcmp(s->name, prog) != 0
+     533:	8b 16                	mov    (%esi),%edx
+     535:	85 c9                	test   %ecx,%ecx
+     537:	75 a7                	jne    4e0 <symbolize+0x80>
+     539:	85 d2                	test   %edx,%edx
+     53b:	79 de                	jns    51b <symbolize+0xbb>
+    if(n > 0 && (sym = lookup(syms, n, s->eip)) != 0)
+     53d:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    s->pid = -1;
+     540:	c7 46 04 ff ff ff ff 	movl   $0xffffffff,0x4(%esi)
+    if(n > 0 && (sym = lookup(syms, n, s->eip)) != 0)
+     547:	85 c0                	test   %eax,%eax
+     549:	7e c1                	jle    50c <symbolize+0xac>
+     54b:	8b 06                	mov    (%esi),%eax
+     54d:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+     550:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  if(n == 0 || eip < syms[0].addr)
+     553:	3b 07                	cmp    (%edi),%eax
+     555:	72 b5                	jb     50c <symbolize+0xac>
+  hi = n - 1;
+     557:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     55a:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+  lo = 0;
+     55d:	31 d2                	xor    %edx,%edx
+     55f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  hi = n - 1;
+     562:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  while(lo < hi){
+     565:	eb 24                	jmp    58b <symbolize+0x12b>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+    mid = (lo + hi + 1) / 2;
+     570:	8d 44 13 01          	lea    0x1(%ebx,%edx,1),%eax
+    if(syms[mid].addr <= eip)
+     574:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+    mid = (lo + hi + 1) / 2;
+     577:	89 c6                	mov    %eax,%esi
+    if(syms[mid].addr <= eip)
+     579:	83 e0 fe             	and    $0xfffffffe,%eax
+    mid = (lo + hi + 1) / 2;
+     57c:	d1 fe                	sar    %esi
+    if(syms[mid].addr <= eip)
+     57e:	01 f0                	add    %esi,%eax
+     580:	3b 0c 87             	cmp    (%edi,%eax,4),%ecx
+     583:	0f 82 e7 00 00 00    	jb     670 <symbolize+0x210>
+    mid = (lo + hi + 1) / 2;
+     589:	89 f2                	mov    %esi,%edx
+  while(lo < hi){
+     58b:	39 da                	cmp    %ebx,%edx
+     58d:	7c e1                	jl     570 <symbolize+0x110>
+  return &syms[lo];
+     58f:	8d 04 52             	lea    (%edx,%edx,2),%eax
+     592:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+     595:	8b 1d ac 16 00 00    	mov    0x16ac,%ebx
+      sym->n++;
+     59b:	83 44 87 08 01       	addl   $0x1,0x8(%edi,%eax,4)
+     5a0:	a1 a8 16 00 00       	mov    0x16a8,%eax
+  for(s = samples; s < samples + nsample; s++){
+     5a5:	83 c6 18             	add    $0x18,%esi
+  return &syms[lo];
+     5a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(s = samples; s < samples + nsample; s++){
+     5ab:	8d 14 40             	lea    (%eax,%eax,2),%edx
+     5ae:	8d 14 d3             	lea    (%ebx,%edx,8),%edx
+     5b1:	39 d6                	cmp    %edx,%esi
+     5b3:	0f 82 73 ff ff ff    	jb     52c <symbolize+0xcc>
+     5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++){
+     5c0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+     5c3:	8b 7d a8             	mov    -0x58(%ebp),%edi
+     5c6:	85 c0                	test   %eax,%eax
+     5c8:	7e 59                	jle    623 <symbolize+0x1c3>
+     5ca:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     5cd:	31 c9                	xor    %ecx,%ecx
+     5cf:	83 c0 08             	add    $0x8,%eax
+     5d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(syms[i].n > 0){
+     5d8:	8b 30                	mov    (%eax),%esi
+     5da:	85 f6                	test   %esi,%esi
+     5dc:	7e 3a                	jle    618 <symbolize+0x1b8>
+      lines[nline].prog = prog;
+     5de:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+     5e4:	8b 1d a4 16 00 00    	mov    0x16a4,%ebx
+     5ea:	8d 14 52             	lea    (%edx,%edx,2),%edx
+     5ed:	8d 14 93             	lea    (%ebx,%edx,4),%edx
+     5f0:	89 3a                	mov    %edi,(%edx)
+      lines[nline].fn = syms[i].name;
+     5f2:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+     5f8:	8b 1d a4 16 00 00    	mov    0x16a4,%ebx
+     5fe:	8d 34 52             	lea    (%edx,%edx,2),%esi
+      lines[nline++].n = syms[i].n;
+     601:	83 c2 01             	add    $0x1,%edx
+      lines[nline].fn = syms[i].name;
+     604:	8d 1c b3             	lea    (%ebx,%esi,4),%ebx
+     607:	8b 70 fc             	mov    -0x4(%eax),%esi
+      lines[nline++].n = syms[i].n;
+     60a:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+      lines[nline].fn = syms[i].name;
+     610:	89 73 04             	mov    %esi,0x4(%ebx)
+      lines[nline++].n = syms[i].n;
+     613:	8b 10                	mov    (%eax),%edx
+     615:	89 53 08             	mov    %edx,0x8(%ebx)
+  for(i = 0; i < n; i++){
+     618:	83 c1 01             	add    $0x1,%ecx
+     61b:	83 c0 0c             	add    $0xc,%eax
+     61e:	39 4d b0             	cmp    %ecx,-0x50(%ebp)
+     621:	7f b5                	jg     5d8 <symbolize+0x178>
+  if(unknown > 0){
+     623:	8b 5d ac             	mov    -0x54(%ebp),%ebx
+     626:	85 db                	test   %ebx,%ebx
+     628:	74 36                	je     660 <symbolize+0x200>
+    lines[nline].prog = prog;
+     62a:	a1 a0 16 00 00       	mov    0x16a0,%eax
+     62f:	8b 15 a4 16 00 00    	mov    0x16a4,%edx
+     635:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     638:	8d 04 82             	lea    (%edx,%eax,4),%eax
+     63b:	89 38                	mov    %edi,(%eax)
+    lines[nline].fn = "?";
+     63d:	a1 a0 16 00 00       	mov    0x16a0,%eax
+     642:	8b 15 a4 16 00 00    	mov    0x16a4,%edx
+     648:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+    lines[nline++].n = unknown;
+     64b:	83 c0 01             	add    $0x1,%eax
+    lines[nline].fn = "?";
+     64e:	8d 14 8a             	lea    (%edx,%ecx,4),%edx
+    lines[nline++].n = unknown;
+     651:	a3 a0 16 00 00       	mov    %eax,0x16a0
+    lines[nline].fn = "?";
+     656:	c7 42 04 34 11 00 00 	movl   $0x1134,0x4(%edx)
+    lines[nline++].n = unknown;
+     65d:	89 5a 08             	mov    %ebx,0x8(%edx)
+}
+     660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     663:	5b                   	pop    %ebx
+     664:	5e                   	pop    %esi
+     665:	5f                   	pop    %edi
+     666:	5d                   	pop    %ebp
+     667:	c3                   	ret
+     668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66f:	90                   	nop
+      hi = mid - 1;
+     670:	8d 5e ff             	lea    -0x1(%esi),%ebx
+     673:	e9 13 ff ff ff       	jmp    58b <symbolize+0x12b>
+  for(i = 0; i < n; i++){
+     678:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  unknown = 0;
+     67b:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%ebp)
+  for(i = 0; i < n; i++){
+     682:	85 c0                	test   %eax,%eax
+     684:	0f 8f 40 ff ff ff    	jg     5ca <symbolize+0x16a>
+     68a:	eb d4                	jmp    660 <symbolize+0x200>
+     68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <report>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	57                   	push   %edi
+     694:	56                   	push   %esi
+     695:	53                   	push   %ebx
+     696:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "%d samples, %d dropped\n", nsample, dropped);
+     699:	ff 75 08             	push   0x8(%ebp)
+     69c:	ff 35 a8 16 00 00    	push   0x16a8
+     6a2:	68 36 11 00 00       	push   $0x1136
+     6a7:	6a 01                	push   $0x1
+     6a9:	e8 52 07 00 00       	call   e00 <printf>
+  if(nsample == 0)
+     6ae:	a1 a8 16 00 00       	mov    0x16a8,%eax
+     6b3:	83 c4 10             	add    $0x10,%esp
+     6b6:	85 c0                	test   %eax,%eax
+     6b8:	75 0e                	jne    6c8 <report+0x38>
+}
+     6ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6bd:	5b                   	pop    %ebx
+     6be:	5e                   	pop    %esi
+     6bf:	5f                   	pop    %edi
+     6c0:	5d                   	pop    %ebp
+     6c1:	c3                   	ret
+     6c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  lines = malloc(nsample * sizeof(*lines));
+     6c8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+     6cb:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < nsample; i++)
+     6ce:	31 db                	xor    %ebx,%ebx
+  lines = malloc(nsample * sizeof(*lines));
+     6d0:	c1 e0 02             	shl    $0x2,%eax
+     6d3:	50                   	push   %eax
+     6d4:	e8 67 09 00 00       	call   1040 <malloc>
+     6d9:	a3 a4 16 00 00       	mov    %eax,0x16a4
+  symbolize(0);
+     6de:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     6e5:	e8 76 fd ff ff       	call   460 <symbolize>
+  for(i = 0; i < nsample; i++)
+     6ea:	8b 0d a8 16 00 00    	mov    0x16a8,%ecx
+     6f0:	83 c4 10             	add    $0x10,%esp
+     6f3:	85 c9                	test   %ecx,%ecx
+     6f5:	7e 36                	jle    72d <report+0x9d>
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+    if(samples[i].pid >= 0)
+     700:	8b 15 ac 16 00 00    	mov    0x16ac,%edx
+     706:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+     709:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+     70c:	8b 50 04             	mov    0x4(%eax),%edx
+     70f:	85 d2                	test   %edx,%edx
+     711:	78 0f                	js     722 <report+0x92>
+      symbolize(samples[i].name);
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	83 c0 08             	add    $0x8,%eax
+     719:	50                   	push   %eax
+     71a:	e8 41 fd ff ff       	call   460 <symbolize>
+     71f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nsample; i++)
+     722:	83 c3 01             	add    $0x1,%ebx
+     725:	3b 1d a8 16 00 00    	cmp    0x16a8,%ebx
+     72b:	7c d3                	jl     700 <report+0x70>
+  for(i = 1; i < nline; i++){
+     72d:	83 3d a0 16 00 00 01 	cmpl   $0x1,0x16a0
+     734:	be 0c 00 00 00       	mov    $0xc,%esi
+     739:	bf 01 00 00 00       	mov    $0x1,%edi
+     73e:	7e 63                	jle    7a3 <report+0x113>
+    t = lines[i];
+     740:	a1 a4 16 00 00       	mov    0x16a4,%eax
+     745:	89 75 dc             	mov    %esi,-0x24(%ebp)
+     748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     74b:	01 f0                	add    %esi,%eax
+     74d:	8b 10                	mov    (%eax),%edx
+     74f:	8b 58 08             	mov    0x8(%eax),%ebx
+     752:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     755:	8b 50 04             	mov    0x4(%eax),%edx
+     758:	89 55 e0             	mov    %edx,-0x20(%ebp)
+     75b:	89 fa                	mov    %edi,%edx
+     75d:	eb 1e                	jmp    77d <report+0xed>
+     75f:	90                   	nop
+      lines[j] = lines[j-1];
+     760:	8b 70 f4             	mov    -0xc(%eax),%esi
+     763:	89 30                	mov    %esi,(%eax)
+     765:	8b 70 f8             	mov    -0x8(%eax),%esi
+     768:	89 70 04             	mov    %esi,0x4(%eax)
+     76b:	8b 70 fc             	mov    -0x4(%eax),%esi
+     76e:	89 70 08             	mov    %esi,0x8(%eax)
+    for(j = i; j > 0 && lines[j-1].n < t.n; j--)
+     771:	8d 41 f4             	lea    -0xc(%ecx),%eax
+     774:	83 ea 01             	sub    $0x1,%edx
+     777:	0f 84 93 00 00 00    	je     810 <report+0x180>
+     77d:	89 c1                	mov    %eax,%ecx
+     77f:	3b 58 fc             	cmp    -0x4(%eax),%ebx
+     782:	7f dc                	jg     760 <report+0xd0>
+     784:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    lines[j] = t;
+     787:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     78a:	89 59 08             	mov    %ebx,0x8(%ecx)
+  for(i = 1; i < nline; i++){
+     78d:	83 c7 01             	add    $0x1,%edi
+     790:	83 c6 0c             	add    $0xc,%esi
+    lines[j] = t;
+     793:	89 01                	mov    %eax,(%ecx)
+     795:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     798:	89 41 04             	mov    %eax,0x4(%ecx)
+  for(i = 1; i < nline; i++){
+     79b:	3b 3d a0 16 00 00    	cmp    0x16a0,%edi
+     7a1:	7c 9d                	jl     740 <report+0xb0>
+  printf(1, "samples %% function\n");
+     7a3:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < nline; i++)
+     7a6:	31 db                	xor    %ebx,%ebx
+  printf(1, "samples %% function\n");
+     7a8:	68 4e 11 00 00       	push   $0x114e
+     7ad:	6a 01                	push   $0x1
+     7af:	e8 4c 06 00 00       	call   e00 <printf>
+  for(i = 0; i < nline; i++)
+     7b4:	a1 a0 16 00 00       	mov    0x16a0,%eax
+     7b9:	83 c4 10             	add    $0x10,%esp
+     7bc:	85 c0                	test   %eax,%eax
+     7be:	0f 8e f6 fe ff ff    	jle    6ba <report+0x2a>
+     7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+           lines[i].prog, lines[i].fn);
+     7c8:	a1 a4 16 00 00       	mov    0x16a4,%eax
+     7cd:	8d 14 5b             	lea    (%ebx,%ebx,2),%edx
+    printf(1, "%d %d%% %s:%s\n", lines[i].n, lines[i].n * 100 / nsample,
+     7d0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < nline; i++)
+     7d3:	83 c3 01             	add    $0x1,%ebx
+           lines[i].prog, lines[i].fn);
+     7d6:	8d 04 90             	lea    (%eax,%edx,4),%eax
+    printf(1, "%d %d%% %s:%s\n", lines[i].n, lines[i].n * 100 / nsample,
+     7d9:	8b 48 08             	mov    0x8(%eax),%ecx
+     7dc:	ff 70 04             	push   0x4(%eax)
+     7df:	ff 30                	push   (%eax)
+     7e1:	6b c1 64             	imul   $0x64,%ecx,%eax
+     7e4:	99                   	cltd
+     7e5:	f7 3d a8 16 00 00    	idivl  0x16a8
+     7eb:	50                   	push   %eax
+     7ec:	51                   	push   %ecx
+     7ed:	68 63 11 00 00       	push   $0x1163
+     7f2:	6a 01                	push   $0x1
+     7f4:	e8 07 06 00 00       	call   e00 <printf>
+  for(i = 0; i < nline; i++)
+     7f9:	83 c4 20             	add    $0x20,%esp
+     7fc:	3b 1d a0 16 00 00    	cmp    0x16a0,%ebx
+     802:	7c c4                	jl     7c8 <report+0x138>
+}
+     804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     807:	5b                   	pop    %ebx
+     808:	5e                   	pop    %esi
+     809:	5f                   	pop    %edi
+     80a:	5d                   	pop    %ebp
+     80b:	c3                   	ret
+     80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     810:	8b 75 dc             	mov    -0x24(%ebp),%esi
+     813:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+     816:	e9 6c ff ff ff       	jmp    787 <report+0xf7>
+     81b:	66 90                	xchg   %ax,%ax
+     81d:	66 90                	xchg   %ax,%ax
+     81f:	90                   	nop
+
+00000820 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+     820:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     821:	31 c0                	xor    %eax,%eax
+{
+     823:	89 e5                	mov    %esp,%ebp
+     825:	53                   	push   %ebx
+     826:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     829:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     830:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     834:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     837:	83 c0 01             	add    $0x1,%eax
+     83a:	84 d2                	test   %dl,%dl
+     83c:	75 f2                	jne    830 <strcpy+0x10>
+    ;
+  return os;
+}
+     83e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     841:	89 c8                	mov    %ecx,%eax
+     843:	c9                   	leave
+     844:	c3                   	ret
+     845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+     854:	8b 55 08             	mov    0x8(%ebp),%edx
+     857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     85a:	0f b6 02             	movzbl (%edx),%eax
+     85d:	84 c0                	test   %al,%al
+     85f:	75 17                	jne    878 <strcmp+0x28>
+     861:	eb 3a                	jmp    89d <strcmp+0x4d>
+     863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     867:	90                   	nop
+     868:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     86c:	83 c2 01             	add    $0x1,%edx
+     86f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     872:	84 c0                	test   %al,%al
+     874:	74 1a                	je     890 <strcmp+0x40>
+    p++, q++;
+     876:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     878:	0f b6 19             	movzbl (%ecx),%ebx
+     87b:	38 c3                	cmp    %al,%bl
+     87d:	74 e9                	je     868 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     87f:	29 d8                	sub    %ebx,%eax
+}
+     881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     884:	c9                   	leave
+     885:	c3                   	ret
+     886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     890:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     894:	31 c0                	xor    %eax,%eax
+     896:	29 d8                	sub    %ebx,%eax
+}
+     898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     89b:	c9                   	leave
+     89c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     89d:	0f b6 19             	movzbl (%ecx),%ebx
+     8a0:	31 c0                	xor    %eax,%eax
+     8a2:	eb db                	jmp    87f <strcmp+0x2f>
+     8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8af:	90                   	nop
+
+000008b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     8b6:	80 3a 00             	cmpb   $0x0,(%edx)
+     8b9:	74 15                	je     8d0 <strlen+0x20>
+     8bb:	31 c0                	xor    %eax,%eax
+     8bd:	8d 76 00             	lea    0x0(%esi),%esi
+     8c0:	83 c0 01             	add    $0x1,%eax
+     8c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     8c7:	89 c1                	mov    %eax,%ecx
+     8c9:	75 f5                	jne    8c0 <strlen+0x10>
+    ;
+  return n;
+}
+     8cb:	89 c8                	mov    %ecx,%eax
+     8cd:	5d                   	pop    %ebp
+     8ce:	c3                   	ret
+     8cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+     8d0:	31 c9                	xor    %ecx,%ecx
+}
+     8d2:	5d                   	pop    %ebp
+     8d3:	89 c8                	mov    %ecx,%eax
+     8d5:	c3                   	ret
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	57                   	push   %edi
+     8e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     8e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     8ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     8ed:	89 d7                	mov    %edx,%edi
+     8ef:	fc                   	cld
+     8f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     8f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     8f5:	89 d0                	mov    %edx,%eax
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	8b 45 08             	mov    0x8(%ebp),%eax
+     906:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     90a:	0f b6 10             	movzbl (%eax),%edx
+     90d:	84 d2                	test   %dl,%dl
+     90f:	75 12                	jne    923 <strchr+0x23>
+     911:	eb 1d                	jmp    930 <strchr+0x30>
+     913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     917:	90                   	nop
+     918:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     91c:	83 c0 01             	add    $0x1,%eax
+     91f:	84 d2                	test   %dl,%dl
+     921:	74 0d                	je     930 <strchr+0x30>
+    if(*s == c)
+     923:	38 d1                	cmp    %dl,%cl
+     925:	75 f1                	jne    918 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     927:	5d                   	pop    %ebp
+     928:	c3                   	ret
+     929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     930:	31 c0                	xor    %eax,%eax
+}
+     932:	5d                   	pop    %ebp
+     933:	c3                   	ret
+     934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     93f:	90                   	nop
+
+00000940 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     945:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     948:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     949:	31 db                	xor    %ebx,%ebx
+{
+     94b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     94e:	eb 27                	jmp    977 <gets+0x37>
+    cc = read(0, &c, 1);
+     950:	83 ec 04             	sub    $0x4,%esp
+     953:	6a 01                	push   $0x1
+     955:	56                   	push   %esi
+     956:	6a 00                	push   $0x0
+     958:	e8 2d 02 00 00       	call   b8a <read>
+    if(cc < 1)
+     95d:	83 c4 10             	add    $0x10,%esp
+     960:	85 c0                	test   %eax,%eax
+     962:	7e 1d                	jle    981 <gets+0x41>
+      break;
+    buf[i++] = c;
+     964:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     968:	8b 55 08             	mov    0x8(%ebp),%edx
+     96b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     96f:	3c 0a                	cmp    $0xa,%al
+     971:	74 10                	je     983 <gets+0x43>
+     973:	3c 0d                	cmp    $0xd,%al
+     975:	74 0c                	je     983 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     977:	89 df                	mov    %ebx,%edi
+     979:	83 c3 01             	add    $0x1,%ebx
+     97c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     97f:	7c cf                	jl     950 <gets+0x10>
+     981:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     983:	8b 45 08             	mov    0x8(%ebp),%eax
+     986:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     98a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     98d:	5b                   	pop    %ebx
+     98e:	5e                   	pop    %esi
+     98f:	5f                   	pop    %edi
+     990:	5d                   	pop    %ebp
+     991:	c3                   	ret
+     992:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	56                   	push   %esi
+     9a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     9a5:	83 ec 08             	sub    $0x8,%esp
+     9a8:	6a 00                	push   $0x0
+     9aa:	ff 75 08             	push   0x8(%ebp)
+     9ad:	e8 23 02 00 00       	call   bd5 <open>
+  if(fd < 0)
+     9b2:	83 c4 10             	add    $0x10,%esp
+     9b5:	85 c0                	test   %eax,%eax
+     9b7:	78 27                	js     9e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     9b9:	83 ec 08             	sub    $0x8,%esp
+     9bc:	ff 75 0c             	push   0xc(%ebp)
+     9bf:	89 c3                	mov    %eax,%ebx
+     9c1:	50                   	push   %eax
+     9c2:	e8 3b 02 00 00       	call   c02 <fstat>
+  close(fd);
+     9c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     9ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+     9cc:	e8 d7 01 00 00       	call   ba8 <close>
+  return r;
+     9d1:	83 c4 10             	add    $0x10,%esp
+}
+     9d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9d7:	89 f0                	mov    %esi,%eax
+     9d9:	5b                   	pop    %ebx
+     9da:	5e                   	pop    %esi
+     9db:	5d                   	pop    %ebp
+     9dc:	c3                   	ret
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     9e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9e5:	eb ed                	jmp    9d4 <stat+0x34>
+     9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	53                   	push   %ebx
+     9f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     9f7:	0f be 02             	movsbl (%edx),%eax
+     9fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     9fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     a00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     a05:	77 1e                	ja     a25 <atoi+0x35>
+     a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a0e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     a10:	83 c2 01             	add    $0x1,%edx
+     a13:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     a16:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     a1a:	0f be 02             	movsbl (%edx),%eax
+     a1d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     a20:	80 fb 09             	cmp    $0x9,%bl
+     a23:	76 eb                	jbe    a10 <atoi+0x20>
+  return n;
+}
+     a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a28:	89 c8                	mov    %ecx,%eax
+     a2a:	c9                   	leave
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	8b 45 10             	mov    0x10(%ebp),%eax
+     a38:	8b 55 08             	mov    0x8(%ebp),%edx
+     a3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     a3e:	85 c0                	test   %eax,%eax
+     a40:	7e 13                	jle    a55 <memmove+0x25>
+     a42:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     a44:	89 d7                	mov    %edx,%edi
+     a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     a50:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     a51:	39 f8                	cmp    %edi,%eax
+     a53:	75 fb                	jne    a50 <memmove+0x20>
+  return vdst;
+}
+     a55:	5e                   	pop    %esi
+     a56:	89 d0                	mov    %edx,%eax
+     a58:	5f                   	pop    %edi
+     a59:	5d                   	pop    %ebp
+     a5a:	c3                   	ret
+     a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a5f:	90                   	nop
+
+00000a60 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	56                   	push   %esi
+     a64:	53                   	push   %ebx
+     a65:	8b 75 10             	mov    0x10(%ebp),%esi
+     a68:	8b 55 08             	mov    0x8(%ebp),%edx
+     a6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+     a6e:	85 f6                	test   %esi,%esi
+     a70:	74 2e                	je     aa0 <memcmp+0x40>
+     a72:	01 c6                	add    %eax,%esi
+     a74:	eb 14                	jmp    a8a <memcmp+0x2a>
+     a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+     a80:	83 c0 01             	add    $0x1,%eax
+     a83:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+     a86:	39 f0                	cmp    %esi,%eax
+     a88:	74 16                	je     aa0 <memcmp+0x40>
+    if(*s1 != *s2)
+     a8a:	0f b6 0a             	movzbl (%edx),%ecx
+     a8d:	0f b6 18             	movzbl (%eax),%ebx
+     a90:	38 d9                	cmp    %bl,%cl
+     a92:	74 ec                	je     a80 <memcmp+0x20>
+      return *s1 - *s2;
+     a94:	0f b6 c1             	movzbl %cl,%eax
+     a97:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     a99:	5b                   	pop    %ebx
+     a9a:	5e                   	pop    %esi
+     a9b:	5d                   	pop    %ebp
+     a9c:	c3                   	ret
+     a9d:	8d 76 00             	lea    0x0(%esi),%esi
+     aa0:	5b                   	pop    %ebx
+  return 0;
+     aa1:	31 c0                	xor    %eax,%eax
+}
+     aa3:	5e                   	pop    %esi
+     aa4:	5d                   	pop    %ebp
+     aa5:	c3                   	ret
+     aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+     ab0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     ab5:	c3                   	ret
+     ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     ac0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+     ac2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+     ac8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+     ace:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+     ad4:	c3                   	ret
+     ad5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ae0 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+     ae0:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+     ae2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+     ae8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+     aee:	c3                   	ret
+     aef:	90                   	nop
+
+00000af0 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	57                   	push   %edi
+     af4:	56                   	push   %esi
+     af5:	53                   	push   %ebx
+     af6:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+     af8:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+     afd:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+     b03:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+     b09:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+     b0f:	89 c6                	mov    %eax,%esi
+     b11:	f7 f7                	div    %edi
+     b13:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+     b15:	f7 e3                	mul    %ebx
+     b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+     b1a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+     b1d:	89 d3                	mov    %edx,%ebx
+     b1f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+     b22:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+     b24:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+     b26:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+     b2c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+     b31:	f7 e6                	mul    %esi
+     b33:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+     b39:	29 d9                	sub    %ebx,%ecx
+     b3b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+     b41:	01 c1                	add    %eax,%ecx
+     b43:	8b 45 08             	mov    0x8(%ebp),%eax
+     b46:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+     b49:	5b                   	pop    %ebx
+     b4a:	5e                   	pop    %esi
+     b4b:	5f                   	pop    %edi
+     b4c:	5d                   	pop    %ebp
+     b4d:	c3                   	ret
+
+00000b4e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+     b4e:	b8 01 00 00 00       	mov    $0x1,%eax
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5c 0b 00 00       	mov    $0xb5c,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	c3                   	ret
+
+00000b5d <exit>:
+SYSCALL(exit)
+     b5d:	b8 02 00 00 00       	mov    $0x2,%eax
+     b62:	89 e1                	mov    %esp,%ecx
+     b64:	ba 6b 0b 00 00       	mov    $0xb6b,%edx
+     b69:	0f 34                	sysenter
+     b6b:	c3                   	ret
+
+00000b6c <wait>:
+SYSCALL(wait)
+     b6c:	b8 03 00 00 00       	mov    $0x3,%eax
+     b71:	89 e1                	mov    %esp,%ecx
+     b73:	ba 7a 0b 00 00       	mov    $0xb7a,%edx
+     b78:	0f 34                	sysenter
+     b7a:	c3                   	ret
+
+00000b7b <pipe>:
+SYSCALL(pipe)
+     b7b:	b8 04 00 00 00       	mov    $0x4,%eax
+     b80:	89 e1                	mov    %esp,%ecx
+     b82:	ba 89 0b 00 00       	mov    $0xb89,%edx
+     b87:	0f 34                	sysenter
+     b89:	c3                   	ret
+
+00000b8a <read>:
+SYSCALL(read)
+     b8a:	b8 05 00 00 00       	mov    $0x5,%eax
+     b8f:	89 e1                	mov    %esp,%ecx
+     b91:	ba 98 0b 00 00       	mov    $0xb98,%edx
+     b96:	0f 34                	sysenter
+     b98:	c3                   	ret
+
+00000b99 <write>:
+SYSCALL(write)
+     b99:	b8 10 00 00 00       	mov    $0x10,%eax
+     b9e:	89 e1                	mov    %esp,%ecx
+     ba0:	ba a7 0b 00 00       	mov    $0xba7,%edx
+     ba5:	0f 34                	sysenter
+     ba7:	c3                   	ret
+
+00000ba8 <close>:
+SYSCALL(close)
+     ba8:	b8 15 00 00 00       	mov    $0x15,%eax
+     bad:	89 e1                	mov    %esp,%ecx
+     baf:	ba b6 0b 00 00       	mov    $0xbb6,%edx
+     bb4:	0f 34                	sysenter
+     bb6:	c3                   	ret
+
+00000bb7 <kill>:
+SYSCALL(kill)
+     bb7:	b8 06 00 00 00       	mov    $0x6,%eax
+     bbc:	89 e1                	mov    %esp,%ecx
+     bbe:	ba c5 0b 00 00       	mov    $0xbc5,%edx
+     bc3:	0f 34                	sysenter
+     bc5:	c3                   	ret
+
+00000bc6 <exec>:
+SYSCALL(exec)
+     bc6:	b8 07 00 00 00       	mov    $0x7,%eax
+     bcb:	89 e1                	mov    %esp,%ecx
+     bcd:	ba d4 0b 00 00       	mov    $0xbd4,%edx
+     bd2:	0f 34                	sysenter
+     bd4:	c3                   	ret
+
+00000bd5 <open>:
+SYSCALL(open)
+     bd5:	b8 0f 00 00 00       	mov    $0xf,%eax
+     bda:	89 e1                	mov    %esp,%ecx
+     bdc:	ba e3 0b 00 00       	mov    $0xbe3,%edx
+     be1:	0f 34                	sysenter
+     be3:	c3                   	ret
+
+00000be4 <mknod>:
+SYSCALL(mknod)
+     be4:	b8 11 00 00 00       	mov    $0x11,%eax
+     be9:	89 e1                	mov    %esp,%ecx
+     beb:	ba f2 0b 00 00       	mov    $0xbf2,%edx
+     bf0:	0f 34                	sysenter
+     bf2:	c3                   	ret
+
+00000bf3 <unlink>:
+SYSCALL(unlink)
+     bf3:	b8 12 00 00 00       	mov    $0x12,%eax
+     bf8:	89 e1                	mov    %esp,%ecx
+     bfa:	ba 01 0c 00 00       	mov    $0xc01,%edx
+     bff:	0f 34                	sysenter
+     c01:	c3                   	ret
+
+00000c02 <fstat>:
+SYSCALL(fstat)
+     c02:	b8 08 00 00 00       	mov    $0x8,%eax
+     c07:	89 e1                	mov    %esp,%ecx
+     c09:	ba 10 0c 00 00       	mov    $0xc10,%edx
+     c0e:	0f 34                	sysenter
+     c10:	c3                   	ret
+
+00000c11 <link>:
+SYSCALL(link)
+     c11:	b8 13 00 00 00       	mov    $0x13,%eax
+     c16:	89 e1                	mov    %esp,%ecx
+     c18:	ba 1f 0c 00 00       	mov    $0xc1f,%edx
+     c1d:	0f 34                	sysenter
+     c1f:	c3                   	ret
+
+00000c20 <mkdir>:
+SYSCALL(mkdir)
+     c20:	b8 14 00 00 00       	mov    $0x14,%eax
+     c25:	89 e1                	mov    %esp,%ecx
+     c27:	ba 2e 0c 00 00       	mov    $0xc2e,%edx
+     c2c:	0f 34                	sysenter
+     c2e:	c3                   	ret
+
+00000c2f <chdir>:
+SYSCALL(chdir)
+     c2f:	b8 09 00 00 00       	mov    $0x9,%eax
+     c34:	89 e1                	mov    %esp,%ecx
+     c36:	ba 3d 0c 00 00       	mov    $0xc3d,%edx
+     c3b:	0f 34                	sysenter
+     c3d:	c3                   	ret
+
+00000c3e <dup>:
+SYSCALL(dup)
+     c3e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     c43:	89 e1                	mov    %esp,%ecx
+     c45:	ba 4c 0c 00 00       	mov    $0xc4c,%edx
+     c4a:	0f 34                	sysenter
+     c4c:	c3                   	ret
+
+00000c4d <sbrk>:
+SYSCALL(sbrk)
+     c4d:	b8 0c 00 00 00       	mov    $0xc,%eax
+     c52:	89 e1                	mov    %esp,%ecx
+     c54:	ba 5b 0c 00 00       	mov    $0xc5b,%edx
+     c59:	0f 34                	sysenter
+     c5b:	c3                   	ret
+
+00000c5c <sleep>:
+SYSCALL(sleep)
+     c5c:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c61:	89 e1                	mov    %esp,%ecx
+     c63:	ba 6a 0c 00 00       	mov    $0xc6a,%edx
+     c68:	0f 34                	sysenter
+     c6a:	c3                   	ret
+
+00000c6b <fallocate>:
+SYSCALL(fallocate)
+     c6b:	b8 16 00 00 00       	mov    $0x16,%eax
+     c70:	89 e1                	mov    %esp,%ecx
+     c72:	ba 79 0c 00 00       	mov    $0xc79,%edx
+     c77:	0f 34                	sysenter
+     c79:	c3                   	ret
+
+00000c7a <pread>:
+SYSCALL(pread)
+     c7a:	b8 17 00 00 00       	mov    $0x17,%eax
+     c7f:	89 e1                	mov    %esp,%ecx
+     c81:	ba 88 0c 00 00       	mov    $0xc88,%edx
+     c86:	0f 34                	sysenter
+     c88:	c3                   	ret
+
+00000c89 <pwrite>:
+SYSCALL(pwrite)
+     c89:	b8 18 00 00 00       	mov    $0x18,%eax
+     c8e:	89 e1                	mov    %esp,%ecx
+     c90:	ba 97 0c 00 00       	mov    $0xc97,%edx
+     c95:	0f 34                	sysenter
+     c97:	c3                   	ret
+
+00000c98 <readv>:
+SYSCALL(readv)
+     c98:	b8 19 00 00 00       	mov    $0x19,%eax
+     c9d:	89 e1                	mov    %esp,%ecx
+     c9f:	ba a6 0c 00 00       	mov    $0xca6,%edx
+     ca4:	0f 34                	sysenter
+     ca6:	c3                   	ret
+
+00000ca7 <writev>:
+SYSCALL(writev)
+     ca7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     cac:	89 e1                	mov    %esp,%ecx
+     cae:	ba b5 0c 00 00       	mov    $0xcb5,%edx
+     cb3:	0f 34                	sysenter
+     cb5:	c3                   	ret
+
+00000cb6 <splice>:
+SYSCALL(splice)
+     cb6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     cbb:	89 e1                	mov    %esp,%ecx
+     cbd:	ba c4 0c 00 00       	mov    $0xcc4,%edx
+     cc2:	0f 34                	sysenter
+     cc4:	c3                   	ret
+
+00000cc5 <setpriority>:
+SYSCALL(setpriority)
+     cc5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     cca:	89 e1                	mov    %esp,%ecx
+     ccc:	ba d3 0c 00 00       	mov    $0xcd3,%edx
+     cd1:	0f 34                	sysenter
+     cd3:	c3                   	ret
+
+00000cd4 <setaffinity>:
+SYSCALL(setaffinity)
+     cd4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     cd9:	89 e1                	mov    %esp,%ecx
+     cdb:	ba e2 0c 00 00       	mov    $0xce2,%edx
+     ce0:	0f 34                	sysenter
+     ce2:	c3                   	ret
+
+00000ce3 <lockstress>:
+SYSCALL(lockstress)
+     ce3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ce8:	89 e1                	mov    %esp,%ecx
+     cea:	ba f1 0c 00 00       	mov    $0xcf1,%edx
+     cef:	0f 34                	sysenter
+     cf1:	c3                   	ret
+
+00000cf2 <lockstat>:
+SYSCALL(lockstat)
+     cf2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     cf7:	89 e1                	mov    %esp,%ecx
+     cf9:	ba 00 0d 00 00       	mov    $0xd00,%edx
+     cfe:	0f 34                	sysenter
+     d00:	c3                   	ret
+
+00000d01 <profctl>:
+SYSCALL(profctl)
+     d01:	b8 20 00 00 00       	mov    $0x20,%eax
+     d06:	89 e1                	mov    %esp,%ecx
+     d08:	ba 0f 0d 00 00       	mov    $0xd0f,%edx
+     d0d:	0f 34                	sysenter
+     d0f:	c3                   	ret
+
+00000d10 <profread>:
+SYSCALL(profread)
+     d10:	b8 21 00 00 00       	mov    $0x21,%eax
+     d15:	89 e1                	mov    %esp,%ecx
+     d17:	ba 1e 0d 00 00       	mov    $0xd1e,%edx
+     d1c:	0f 34                	sysenter
+     d1e:	c3                   	ret
+
+00000d1f <getrusage>:
+SYSCALL(getrusage)
+     d1f:	b8 22 00 00 00       	mov    $0x22,%eax
+     d24:	89 e1                	mov    %esp,%ecx
+     d26:	ba 2d 0d 00 00       	mov    $0xd2d,%edx
+     d2b:	0f 34                	sysenter
+     d2d:	c3                   	ret
+
+00000d2e <tracectl>:
+SYSCALL(tracectl)
+     d2e:	b8 23 00 00 00       	mov    $0x23,%eax
+     d33:	89 e1                	mov    %esp,%ecx
+     d35:	ba 3c 0d 00 00       	mov    $0xd3c,%edx
+     d3a:	0f 34                	sysenter
+     d3c:	c3                   	ret
+
+00000d3d <traceread>:
+SYSCALL(traceread)
+     d3d:	b8 24 00 00 00       	mov    $0x24,%eax
+     d42:	89 e1                	mov    %esp,%ecx
+     d44:	ba 4b 0d 00 00       	mov    $0xd4b,%edx
+     d49:	0f 34                	sysenter
+     d4b:	c3                   	ret
+
+00000d4c <nanosleep>:
+SYSCALL(nanosleep)
+     d4c:	b8 25 00 00 00       	mov    $0x25,%eax
+     d51:	89 e1                	mov    %esp,%ecx
+     d53:	ba 5a 0d 00 00       	mov    $0xd5a,%edx
+     d58:	0f 34                	sysenter
+     d5a:	c3                   	ret
+     d5b:	66 90                	xchg   %ax,%ax
+     d5d:	66 90                	xchg   %ax,%ax
+     d5f:	90                   	nop
+
+00000d60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+     d65:	53                   	push   %ebx
+     d66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     d68:	89 d1                	mov    %edx,%ecx
+{
+     d6a:	83 ec 3c             	sub    $0x3c,%esp
+     d6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     d70:	85 d2                	test   %edx,%edx
+     d72:	0f 89 80 00 00 00    	jns    df8 <printint+0x98>
+     d78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     d7c:	74 7a                	je     df8 <printint+0x98>
+    x = -xx;
+     d7e:	f7 d9                	neg    %ecx
+    neg = 1;
+     d80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     d85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     d88:	31 f6                	xor    %esi,%esi
+     d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     d90:	89 c8                	mov    %ecx,%eax
+     d92:	31 d2                	xor    %edx,%edx
+     d94:	89 f7                	mov    %esi,%edi
+     d96:	f7 f3                	div    %ebx
+     d98:	8d 76 01             	lea    0x1(%esi),%esi
+     d9b:	0f b6 92 58 12 00 00 	movzbl 0x1258(%edx),%edx
+     da2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     da6:	89 ca                	mov    %ecx,%edx
+     da8:	89 c1                	mov    %eax,%ecx
+     daa:	39 da                	cmp    %ebx,%edx
+     dac:	73 e2                	jae    d90 <printint+0x30>
+  if(neg)
+     dae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     db1:	85 c0                	test   %eax,%eax
+     db3:	74 07                	je     dbc <printint+0x5c>
+    buf[i++] = '-';
+     db5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     dba:	89 f7                	mov    %esi,%edi
+     dbc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     dbf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     dc2:	01 df                	add    %ebx,%edi
+     dc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     dc8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     dcb:	83 ec 04             	sub    $0x4,%esp
+     dce:	88 45 d7             	mov    %al,-0x29(%ebp)
+     dd1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     dd4:	6a 01                	push   $0x1
+     dd6:	50                   	push   %eax
+     dd7:	56                   	push   %esi
+     dd8:	e8 bc fd ff ff       	call   b99 <write>
+  while(--i >= 0)
+     ddd:	89 f8                	mov    %edi,%eax
+     ddf:	83 c4 10             	add    $0x10,%esp
+     de2:	83 ef 01             	sub    $0x1,%edi
+     de5:	39 d8                	cmp    %ebx,%eax
+     de7:	75 df                	jne    dc8 <printint+0x68>
+}
+     de9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dec:	5b                   	pop    %ebx
+     ded:	5e                   	pop    %esi
+     dee:	5f                   	pop    %edi
+     def:	5d                   	pop    %ebp
+     df0:	c3                   	ret
+     df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     df8:	31 c0                	xor    %eax,%eax
+     dfa:	eb 89                	jmp    d85 <printint+0x25>
+     dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e00:	55                   	push   %ebp
+     e01:	89 e5                	mov    %esp,%ebp
+     e03:	57                   	push   %edi
+     e04:	56                   	push   %esi
+     e05:	53                   	push   %ebx
+     e06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     e09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     e0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     e0f:	0f b6 1e             	movzbl (%esi),%ebx
+     e12:	83 c6 01             	add    $0x1,%esi
+     e15:	84 db                	test   %bl,%bl
+     e17:	74 67                	je     e80 <printf+0x80>
+     e19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e1c:	31 d2                	xor    %edx,%edx
+     e1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     e21:	eb 34                	jmp    e57 <printf+0x57>
+     e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e27:	90                   	nop
+     e28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     e2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     e30:	83 f8 25             	cmp    $0x25,%eax
+     e33:	74 18                	je     e4d <printf+0x4d>
+  write(fd, &c, 1);
+     e35:	83 ec 04             	sub    $0x4,%esp
+     e38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     e3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e3e:	6a 01                	push   $0x1
+     e40:	50                   	push   %eax
+     e41:	57                   	push   %edi
+     e42:	e8 52 fd ff ff       	call   b99 <write>
+     e47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     e4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     e4d:	0f b6 1e             	movzbl (%esi),%ebx
+     e50:	83 c6 01             	add    $0x1,%esi
+     e53:	84 db                	test   %bl,%bl
+     e55:	74 29                	je     e80 <printf+0x80>
+    c = fmt[i] & 0xff;
+     e57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     e5a:	85 d2                	test   %edx,%edx
+     e5c:	74 ca                	je     e28 <printf+0x28>
+      }
+    } else if(state == '%'){
+     e5e:	83 fa 25             	cmp    $0x25,%edx
+     e61:	75 ea                	jne    e4d <printf+0x4d>
+      if(c == 'd'){
+     e63:	83 f8 25             	cmp    $0x25,%eax
+     e66:	0f 84 24 01 00 00    	je     f90 <printf+0x190>
+     e6c:	83 e8 63             	sub    $0x63,%eax
+     e6f:	83 f8 15             	cmp    $0x15,%eax
+     e72:	77 1c                	ja     e90 <printf+0x90>
+     e74:	ff 24 85 00 12 00 00 	jmp    *0x1200(,%eax,4)
+     e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     e80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e83:	5b                   	pop    %ebx
+     e84:	5e                   	pop    %esi
+     e85:	5f                   	pop    %edi
+     e86:	5d                   	pop    %ebp
+     e87:	c3                   	ret
+     e88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e8f:	90                   	nop
+  write(fd, &c, 1);
+     e90:	83 ec 04             	sub    $0x4,%esp
+     e93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     e9a:	6a 01                	push   $0x1
+     e9c:	52                   	push   %edx
+     e9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     ea0:	57                   	push   %edi
+     ea1:	e8 f3 fc ff ff       	call   b99 <write>
+     ea6:	83 c4 0c             	add    $0xc,%esp
+     ea9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     eac:	6a 01                	push   $0x1
+     eae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     eb1:	52                   	push   %edx
+     eb2:	57                   	push   %edi
+     eb3:	e8 e1 fc ff ff       	call   b99 <write>
+        putc(fd, c);
+     eb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ebb:	31 d2                	xor    %edx,%edx
+     ebd:	eb 8e                	jmp    e4d <printf+0x4d>
+     ebf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     ec0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ec3:	83 ec 0c             	sub    $0xc,%esp
+     ec6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ecb:	8b 13                	mov    (%ebx),%edx
+     ecd:	6a 00                	push   $0x0
+     ecf:	89 f8                	mov    %edi,%eax
+        ap++;
+     ed1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     ed4:	e8 87 fe ff ff       	call   d60 <printint>
+        ap++;
+     ed9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     edc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     edf:	31 d2                	xor    %edx,%edx
+     ee1:	e9 67 ff ff ff       	jmp    e4d <printf+0x4d>
+     ee6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     ef0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     ef3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     ef5:	83 c0 04             	add    $0x4,%eax
+     ef8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     efb:	85 db                	test   %ebx,%ebx
+     efd:	0f 84 9d 00 00 00    	je     fa0 <printf+0x1a0>
+        while(*s != 0){
+     f03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     f06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     f08:	84 c0                	test   %al,%al
+     f0a:	0f 84 3d ff ff ff    	je     e4d <printf+0x4d>
+     f10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     f16:	89 de                	mov    %ebx,%esi
+     f18:	89 d3                	mov    %edx,%ebx
+     f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     f20:	83 ec 04             	sub    $0x4,%esp
+     f23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     f26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     f29:	6a 01                	push   $0x1
+     f2b:	53                   	push   %ebx
+     f2c:	57                   	push   %edi
+     f2d:	e8 67 fc ff ff       	call   b99 <write>
+        while(*s != 0){
+     f32:	0f b6 06             	movzbl (%esi),%eax
+     f35:	83 c4 10             	add    $0x10,%esp
+     f38:	84 c0                	test   %al,%al
+     f3a:	75 e4                	jne    f20 <printf+0x120>
+      state = 0;
+     f3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     f3f:	31 d2                	xor    %edx,%edx
+     f41:	e9 07 ff ff ff       	jmp    e4d <printf+0x4d>
+     f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     f50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     f53:	83 ec 0c             	sub    $0xc,%esp
+     f56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     f5b:	8b 13                	mov    (%ebx),%edx
+     f5d:	6a 01                	push   $0x1
+     f5f:	e9 6b ff ff ff       	jmp    ecf <printf+0xcf>
+     f64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     f68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     f6b:	83 ec 04             	sub    $0x4,%esp
+     f6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     f71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     f73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     f76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     f79:	6a 01                	push   $0x1
+     f7b:	52                   	push   %edx
+     f7c:	57                   	push   %edi
+     f7d:	e8 17 fc ff ff       	call   b99 <write>
+        ap++;
+     f82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     f85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f88:	31 d2                	xor    %edx,%edx
+     f8a:	e9 be fe ff ff       	jmp    e4d <printf+0x4d>
+     f8f:	90                   	nop
+  write(fd, &c, 1);
+     f90:	83 ec 04             	sub    $0x4,%esp
+     f93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f99:	6a 01                	push   $0x1
+     f9b:	e9 11 ff ff ff       	jmp    eb1 <printf+0xb1>
+     fa0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     fa5:	bb f6 11 00 00       	mov    $0x11f6,%ebx
+     faa:	e9 61 ff ff ff       	jmp    f10 <printf+0x110>
+     faf:	90                   	nop
+
+00000fb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     fb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fb1:	a1 b0 16 00 00       	mov    0x16b0,%eax
+{
+     fb6:	89 e5                	mov    %esp,%ebp
+     fb8:	57                   	push   %edi
+     fb9:	56                   	push   %esi
+     fba:	53                   	push   %ebx
+     fbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     fbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     fcc:	39 ca                	cmp    %ecx,%edx
+     fce:	73 30                	jae    1000 <free+0x50>
+     fd0:	39 c1                	cmp    %eax,%ecx
+     fd2:	72 04                	jb     fd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fd4:	39 c2                	cmp    %eax,%edx
+     fd6:	72 f0                	jb     fc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     fd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     fdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     fde:	39 f8                	cmp    %edi,%eax
+     fe0:	74 2e                	je     1010 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fe2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     fe5:	8b 42 04             	mov    0x4(%edx),%eax
+     fe8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     feb:	39 f1                	cmp    %esi,%ecx
+     fed:	74 38                	je     1027 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     fef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ff1:	5b                   	pop    %ebx
+  freep = p;
+     ff2:	89 15 b0 16 00 00    	mov    %edx,0x16b0
+}
+     ff8:	5e                   	pop    %esi
+     ff9:	5f                   	pop    %edi
+     ffa:	5d                   	pop    %ebp
+     ffb:	c3                   	ret
+     ffc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1000:	39 c1                	cmp    %eax,%ecx
+    1002:	72 d0                	jb     fd4 <free+0x24>
+    1004:	eb c2                	jmp    fc8 <free+0x18>
+    1006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1010:	03 70 04             	add    0x4(%eax),%esi
+    1013:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1016:	8b 02                	mov    (%edx),%eax
+    1018:	8b 00                	mov    (%eax),%eax
+    101a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    101d:	8b 42 04             	mov    0x4(%edx),%eax
+    1020:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1023:	39 f1                	cmp    %esi,%ecx
+    1025:	75 c8                	jne    fef <free+0x3f>
+    p->s.size += bp->s.size;
+    1027:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    102a:	89 15 b0 16 00 00    	mov    %edx,0x16b0
+    p->s.size += bp->s.size;
+    1030:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1033:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1036:	89 0a                	mov    %ecx,(%edx)
+}
+    1038:	5b                   	pop    %ebx
+    1039:	5e                   	pop    %esi
+    103a:	5f                   	pop    %edi
+    103b:	5d                   	pop    %ebp
+    103c:	c3                   	ret
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001040 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	57                   	push   %edi
+    1044:	56                   	push   %esi
+    1045:	53                   	push   %ebx
+    1046:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1049:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    104c:	8b 15 b0 16 00 00    	mov    0x16b0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1052:	8d 78 07             	lea    0x7(%eax),%edi
+    1055:	c1 ef 03             	shr    $0x3,%edi
+    1058:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    105b:	85 d2                	test   %edx,%edx
+    105d:	0f 84 8d 00 00 00    	je     10f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1063:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1065:	8b 48 04             	mov    0x4(%eax),%ecx
+    1068:	39 f9                	cmp    %edi,%ecx
+    106a:	73 64                	jae    10d0 <malloc+0x90>
+  if(nu < 4096)
+    106c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1071:	39 df                	cmp    %ebx,%edi
+    1073:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1076:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    107d:	eb 0a                	jmp    1089 <malloc+0x49>
+    107f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1080:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1082:	8b 48 04             	mov    0x4(%eax),%ecx
+    1085:	39 f9                	cmp    %edi,%ecx
+    1087:	73 47                	jae    10d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1089:	89 c2                	mov    %eax,%edx
+    108b:	39 05 b0 16 00 00    	cmp    %eax,0x16b0
+    1091:	75 ed                	jne    1080 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1093:	83 ec 0c             	sub    $0xc,%esp
+    1096:	56                   	push   %esi
+    1097:	e8 b1 fb ff ff       	call   c4d <sbrk>
+  if(p == (char*)-1)
+    109c:	83 c4 10             	add    $0x10,%esp
+    109f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10a2:	74 1c                	je     10c0 <malloc+0x80>
+  hp->s.size = nu;
+    10a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    10a7:	83 ec 0c             	sub    $0xc,%esp
+    10aa:	83 c0 08             	add    $0x8,%eax
+    10ad:	50                   	push   %eax
+    10ae:	e8 fd fe ff ff       	call   fb0 <free>
+  return freep;
+    10b3:	8b 15 b0 16 00 00    	mov    0x16b0,%edx
+      if((p = morecore(nunits)) == 0)
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	85 d2                	test   %edx,%edx
+    10be:	75 c0                	jne    1080 <malloc+0x40>
+        return 0;
+  }
+}
+    10c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    10c3:	31 c0                	xor    %eax,%eax
+}
+    10c5:	5b                   	pop    %ebx
+    10c6:	5e                   	pop    %esi
+    10c7:	5f                   	pop    %edi
+    10c8:	5d                   	pop    %ebp
+    10c9:	c3                   	ret
+    10ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    10d0:	39 cf                	cmp    %ecx,%edi
+    10d2:	74 4c                	je     1120 <malloc+0xe0>
+        p->s.size -= nunits;
+    10d4:	29 f9                	sub    %edi,%ecx
+    10d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    10d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    10dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    10df:	89 15 b0 16 00 00    	mov    %edx,0x16b0
+}
+    10e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10e8:	83 c0 08             	add    $0x8,%eax
+}
+    10eb:	5b                   	pop    %ebx
+    10ec:	5e                   	pop    %esi
+    10ed:	5f                   	pop    %edi
+    10ee:	5d                   	pop    %ebp
+    10ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    10f0:	c7 05 b0 16 00 00 b4 	movl   $0x16b4,0x16b0
+    10f7:	16 00 00 
+    base.s.size = 0;
+    10fa:	b8 b4 16 00 00       	mov    $0x16b4,%eax
+    base.s.ptr = freep = prevp = &base;
+    10ff:	c7 05 b4 16 00 00 b4 	movl   $0x16b4,0x16b4
+    1106:	16 00 00 
+    base.s.size = 0;
+    1109:	c7 05 b8 16 00 00 00 	movl   $0x0,0x16b8
+    1110:	00 00 00 
+    if(p->s.size >= nunits){
+    1113:	e9 54 ff ff ff       	jmp    106c <malloc+0x2c>
+    1118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1120:	8b 08                	mov    (%eax),%ecx
+    1122:	89 0a                	mov    %ecx,(%edx)
+    1124:	eb b9                	jmp    10df <malloc+0x9f>
@@ -0,0 +1,243 @@
+// Sampling profiler.
+//   profile [-r rate] cmd ...
+// Runs cmd while the kernel's profiler takes rate samples per
+// clock tick on every CPU (10 by default), then prints a flat
+// profile: how many samples landed in each kernel and user
+// function, most first. Symbols come from kernel.sym and
+// <program>.sym, which the Makefile puts in the file system.
+
+#include "types.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "user.h"
+#include "param.h"
+#include "memlayout.h"
+#include "prof.h"
+
+#define MAXSAMPLE (NCPU*NPROF)  // all the kernel can buffer
+
+struct sym {
+  uint addr;
+  char *name;
+  int n;        // samples in this function
+};
+
+// One line of the profile.
+struct line {
+  char *prog;
+  char *fn;
+  int n;
+};
+
+struct profsample *samples;
+int nsample;
+struct line *lines;
+int nline;
+
+uint
+atox(char *s)
+{
+  uint x;
+
+  for(x = 0; ; s++){
+    if('0' <= *s && *s <= '9')
+      x = x*16 + *s - '0';
+    else if('a' <= *s && *s <= 'f')
+      x = x*16 + *s - 'a' + 10;
+    else
+      return x;
+  }
+}
+
+// Read the functions from a symbol table made by the Makefile,
+// one "address name" per line, sorted by address. Names with a
+// dot are files and sections rather than functions.
+// Returns the number of symbols, or -1 if file can't be read.
+int
+loadsyms(char *file, struct sym **psyms)
+{
+  struct stat st;
+  struct sym *syms, t;
+  char *buf, *p, *q;
+  int fd, i, j, n;
+
+  if((fd = open(file, O_RDONLY)) < 0)
+    return -1;
+  if(fstat(fd, &st) < 0 || (buf = malloc(st.size + 1)) == 0){
+    close(fd);
+    return -1;
+  }
+  n = read(fd, buf, st.size);
+  close(fd);
+  if(n != st.size)
+    return -1;
+  buf[n] = 0;
+
+  n = 0;
+  for(p = buf; *p; p++)
+    if(*p == '\n')
+      n++;
+  syms = malloc((n + 1) * sizeof(*syms));
+
+  n = 0;
+  for(p = buf; *p; p = q + 1){
+    if((q = strchr(p, '\n')) == 0)
+      break;
+    *q = 0;
+    syms[n].addr = atox(p);
+    syms[n].name = strchr(p, ' ');
+    syms[n].n = 0;
+    if(syms[n].name == 0 || strchr(++syms[n].name, '.') != 0)
+      continue;
+    n++;
+  }
+
+  for(i = 1; i < n; i++){
+    t = syms[i];
+    for(j = i; j > 0 && syms[j-1].addr > t.addr; j--)
+      syms[j] = syms[j-1];
+    syms[j] = t;
+  }
+  *psyms = syms;
+  return n;
+}
+
+// Find the function containing eip: the last one starting at or
+// below it.
+struct sym*
+lookup(struct sym *syms, int n, uint eip)
+{
+  int lo, hi, mid;
+
+  if(n == 0 || eip < syms[0].addr)
+    return 0;
+  lo = 0;
+  hi = n - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(syms[mid].addr <= eip)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return &syms[lo];
+}
+
+// Count the samples of one program, or of the kernel if prog is
+// 0, against its symbols, and add a line for each function hit.
+// Marks the samples counted by setting their pid to -1.
+void
+symbolize(char *prog)
+{
+  char file[32];
+  struct profsample *s;
+  struct sym *syms, *sym;
+  int i, n, unknown;
+
+  strcpy(file, prog ? prog : "kernel");
+  strcpy(file + strlen(file), ".sym");
+  n = loadsyms(file, &syms);
+
+  unknown = 0;
+  for(s = samples; s < samples + nsample; s++){
+    if(s->pid < 0)
+      continue;
+    if(prog ? s->eip >= KERNBASE || strcmp(s->name, prog) != 0
+            : s->eip < KERNBASE)
+      continue;
+    s->pid = -1;
+    if(n > 0 && (sym = lookup(syms, n, s->eip)) != 0)
+      sym->n++;
+    else
+      unknown++;
+  }
+
+  if(prog == 0)
+    prog = "kernel";
+  for(i = 0; i < n; i++){
+    if(syms[i].n > 0){
+      lines[nline].prog = prog;
+      lines[nline].fn = syms[i].name;
+      lines[nline++].n = syms[i].n;
+    }
+  }
+  if(unknown > 0){
+    lines[nline].prog = prog;
+    lines[nline].fn = "?";
+    lines[nline++].n = unknown;
+  }
+}
+
+void
+report(int dropped)
+{
+  struct line t;
+  int i, j;
+
+  printf(1, "%d samples, %d dropped\n", nsample, dropped);
+  if(nsample == 0)
+    return;
+
+  lines = malloc(nsample * sizeof(*lines));
+  symbolize(0);
+  for(i = 0; i < nsample; i++)
+    if(samples[i].pid >= 0)
+      symbolize(samples[i].name);
+
+  for(i = 1; i < nline; i++){
+    t = lines[i];
+    for(j = i; j > 0 && lines[j-1].n < t.n; j--)
+      lines[j] = lines[j-1];
+    lines[j] = t;
+  }
+  printf(1, "samples %% function\n");
+  for(i = 0; i < nline; i++)
+    printf(1, "%d %d%% %s:%s\n", lines[i].n, lines[i].n * 100 / nsample,
+           lines[i].prog, lines[i].fn);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int dropped, n, pid, rate;
+
+  rate = 10;
+  argv++;
+  argc--;
+  if(argc > 1 && strcmp(argv[0], "-r") == 0){
+    rate = atoi(argv[1]);
+    argv += 2;
+    argc -= 2;
+  }
+  if(argc < 1){
+    printf(2, "usage: profile [-r rate] cmd ...\n");
+    exit();
+  }
+  if((samples = malloc(MAXSAMPLE * sizeof(*samples))) == 0){
+    printf(2, "profile: out of memory\n");
+    exit();
+  }
+
+  if(profctl(rate) < 0){
+    printf(2, "profile: bad rate %d\n", rate);
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(2, "profile: fork failed\n");
+    profctl(0);
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[0], argv);
+    printf(2, "profile: exec %s failed\n", argv[0]);
+    exit();
+  }
+  wait();
+  dropped = profctl(0);
+
+  while(nsample < MAXSAMPLE &&
+        (n = profread(samples + nsample, MAXSAMPLE - nsample)) > 0)
+    nsample += n;
+  report(dropped);
+  exit();
+}
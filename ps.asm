@@ -0,0 +1,1613 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	8b 01                	mov    (%ecx),%eax
+  11:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc == 3 && strcmp(argv[1], "-s") == 0)
+  14:	83 f8 03             	cmp    $0x3,%eax
+  17:	74 22                	je     3b <main+0x3b>
+    calls(atoi(argv[2]));
+  else if(argc == 1)
+  19:	83 f8 01             	cmp    $0x1,%eax
+  1c:	74 16                	je     34 <main+0x34>
+    list();
+  else
+    printf(2, "usage: ps [-s pid]\n");
+  1e:	50                   	push   %eax
+  1f:	50                   	push   %eax
+  20:	68 17 0b 00 00       	push   $0xb17
+  25:	6a 02                	push   $0x2
+  27:	e8 74 07 00 00       	call   7a0 <printf>
+  2c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  2f:	e8 c9 04 00 00       	call   4fd <exit>
+    list();
+  34:	e8 37 00 00 00       	call   70 <list>
+  39:	eb f4                	jmp    2f <main+0x2f>
+  if(argc == 3 && strcmp(argv[1], "-s") == 0)
+  3b:	52                   	push   %edx
+  3c:	52                   	push   %edx
+  3d:	68 14 0b 00 00       	push   $0xb14
+  42:	ff 73 04             	push   0x4(%ebx)
+  45:	e8 a6 01 00 00       	call   1f0 <strcmp>
+  4a:	83 c4 10             	add    $0x10,%esp
+  4d:	85 c0                	test   %eax,%eax
+  4f:	75 cd                	jne    1e <main+0x1e>
+    calls(atoi(argv[2]));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 73 08             	push   0x8(%ebx)
+  57:	e8 34 03 00 00       	call   390 <atoi>
+  5c:	89 04 24             	mov    %eax,(%esp)
+  5f:	e8 bc 00 00 00       	call   120 <calls>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	eb c6                	jmp    2f <main+0x2f>
+  69:	66 90                	xchg   %ax,%ax
+  6b:	66 90                	xchg   %ax,%ax
+  6d:	66 90                	xchg   %ax,%ax
+  6f:	90                   	nop
+
+00000070 <list>:
+{
+  70:	55                   	push   %ebp
+  71:	89 e5                	mov    %esp,%ebp
+  73:	57                   	push   %edi
+  74:	56                   	push   %esi
+  75:	53                   	push   %ebx
+  76:	83 ec 10             	sub    $0x10,%esp
+  if((n = getrusage(-1, ru, NPROC)) < 0){
+  79:	6a 40                	push   $0x40
+  7b:	68 60 11 00 00       	push   $0x1160
+  80:	6a ff                	push   $0xffffffff
+  82:	e8 38 06 00 00       	call   6bf <getrusage>
+  87:	83 c4 10             	add    $0x10,%esp
+  8a:	85 c0                	test   %eax,%eax
+  8c:	78 7f                	js     10d <list+0x9d>
+  printf(1, "pid state name user sys Mcycles vcsw ivcsw syscalls faults\n");
+  8e:	83 ec 08             	sub    $0x8,%esp
+  91:	89 c7                	mov    %eax,%edi
+  93:	68 3c 0c 00 00       	push   $0xc3c
+  98:	6a 01                	push   $0x1
+  9a:	e8 01 07 00 00       	call   7a0 <printf>
+  for(i = 0; i < n; i++){
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	85 ff                	test   %edi,%edi
+  a4:	74 5f                	je     105 <list+0x95>
+  a6:	bb 68 11 00 00       	mov    $0x1168,%ebx
+  ab:	31 f6                	xor    %esi,%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ru[i].state < sizeof(states)/sizeof(states[0]))
+  b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    state = "???";
+  b3:	b9 c8 0a 00 00       	mov    $0xac8,%ecx
+    if(ru[i].state < sizeof(states)/sizeof(states[0]))
+  b8:	83 f8 05             	cmp    $0x5,%eax
+  bb:	77 07                	ja     c4 <list+0x54>
+      state = states[ru[i].state];
+  bd:	8b 0c 85 38 11 00 00 	mov    0x1138(,%eax,4),%ecx
+    printf(1, "%d %s %s %d %d %d %d %d %d %d\n", ru[i].pid, state,
+  c4:	ff 73 28             	push   0x28(%ebx)
+  for(i = 0; i < n; i++){
+  c7:	83 c6 01             	add    $0x1,%esi
+    printf(1, "%d %s %s %d %d %d %d %d %d %d\n", ru[i].pid, state,
+  ca:	ff 73 2c             	push   0x2c(%ebx)
+  cd:	ff 73 24             	push   0x24(%ebx)
+  d0:	ff 73 20             	push   0x20(%ebx)
+           (uint)(ru[i].cycles >> 20), ru[i].nvcsw, ru[i].nivcsw,
+  d3:	8b 43 18             	mov    0x18(%ebx),%eax
+  d6:	8b 53 1c             	mov    0x1c(%ebx),%edx
+  d9:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+    printf(1, "%d %s %s %d %d %d %d %d %d %d\n", ru[i].pid, state,
+  dd:	50                   	push   %eax
+  de:	ff 73 14             	push   0x14(%ebx)
+  e1:	ff 73 10             	push   0x10(%ebx)
+  e4:	53                   	push   %ebx
+  for(i = 0; i < n; i++){
+  e5:	81 c3 d0 00 00 00    	add    $0xd0,%ebx
+    printf(1, "%d %s %s %d %d %d %d %d %d %d\n", ru[i].pid, state,
+  eb:	51                   	push   %ecx
+  ec:	ff b3 28 ff ff ff    	push   -0xd8(%ebx)
+  f2:	68 78 0c 00 00       	push   $0xc78
+  f7:	6a 01                	push   $0x1
+  f9:	e8 a2 06 00 00       	call   7a0 <printf>
+  for(i = 0; i < n; i++){
+  fe:	83 c4 30             	add    $0x30,%esp
+ 101:	39 f7                	cmp    %esi,%edi
+ 103:	75 ab                	jne    b0 <list+0x40>
+}
+ 105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 108:	5b                   	pop    %ebx
+ 109:	5e                   	pop    %esi
+ 10a:	5f                   	pop    %edi
+ 10b:	5d                   	pop    %ebp
+ 10c:	c3                   	ret
+    printf(2, "ps: getrusage failed\n");
+ 10d:	50                   	push   %eax
+ 10e:	50                   	push   %eax
+ 10f:	68 cc 0a 00 00       	push   $0xacc
+ 114:	6a 02                	push   $0x2
+ 116:	e8 85 06 00 00       	call   7a0 <printf>
+    exit();
+ 11b:	e8 dd 03 00 00       	call   4fd <exit>
+
+00000120 <calls>:
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	56                   	push   %esi
+ 124:	53                   	push   %ebx
+ 125:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(getrusage(pid, ru, 1) != 1){
+ 128:	83 ec 04             	sub    $0x4,%esp
+ 12b:	6a 01                	push   $0x1
+ 12d:	68 60 11 00 00       	push   $0x1160
+ 132:	53                   	push   %ebx
+ 133:	e8 87 05 00 00       	call   6bf <getrusage>
+ 138:	83 c4 10             	add    $0x10,%esp
+ 13b:	83 f8 01             	cmp    $0x1,%eax
+ 13e:	75 5f                	jne    19f <calls+0x7f>
+  printf(1, "%d %s: %d system calls\n", pid, ru[0].name, ru[0].nsyscall);
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	ff 35 94 11 00 00    	push   0x1194
+    printf(1, "%s %d\n", syscalls[i] ? syscalls[i] : "?", ru[0].syscalls[i]);
+ 149:	be ca 0a 00 00       	mov    $0xaca,%esi
+  printf(1, "%d %s: %d system calls\n", pid, ru[0].name, ru[0].nsyscall);
+ 14e:	68 68 11 00 00       	push   $0x1168
+ 153:	53                   	push   %ebx
+  for(i = 0; i < NSYSCALL; i++){
+ 154:	31 db                	xor    %ebx,%ebx
+  printf(1, "%d %s: %d system calls\n", pid, ru[0].name, ru[0].nsyscall);
+ 156:	68 f5 0a 00 00       	push   $0xaf5
+ 15b:	6a 01                	push   $0x1
+ 15d:	e8 3e 06 00 00       	call   7a0 <printf>
+ 162:	83 c4 20             	add    $0x20,%esp
+ 165:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ru[0].syscalls[i] == 0)
+ 168:	8b 14 9d 98 11 00 00 	mov    0x1198(,%ebx,4),%edx
+ 16f:	85 d2                	test   %edx,%edx
+ 171:	74 1d                	je     190 <calls+0x70>
+    printf(1, "%s %d\n", syscalls[i] ? syscalls[i] : "?", ru[0].syscalls[i]);
+ 173:	8b 04 9d a0 10 00 00 	mov    0x10a0(,%ebx,4),%eax
+ 17a:	52                   	push   %edx
+ 17b:	85 c0                	test   %eax,%eax
+ 17d:	0f 44 c6             	cmove  %esi,%eax
+ 180:	50                   	push   %eax
+ 181:	68 0d 0b 00 00       	push   $0xb0d
+ 186:	6a 01                	push   $0x1
+ 188:	e8 13 06 00 00       	call   7a0 <printf>
+ 18d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSYSCALL; i++){
+ 190:	83 c3 01             	add    $0x1,%ebx
+ 193:	83 fb 26             	cmp    $0x26,%ebx
+ 196:	75 d0                	jne    168 <calls+0x48>
+}
+ 198:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 19b:	5b                   	pop    %ebx
+ 19c:	5e                   	pop    %esi
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+    printf(2, "ps: no process %d\n", pid);
+ 19f:	50                   	push   %eax
+ 1a0:	53                   	push   %ebx
+ 1a1:	68 e2 0a 00 00       	push   $0xae2
+ 1a6:	6a 02                	push   $0x2
+ 1a8:	e8 f3 05 00 00       	call   7a0 <printf>
+    exit();
+ 1ad:	e8 4b 03 00 00       	call   4fd <exit>
+ 1b2:	66 90                	xchg   %ax,%ax
+ 1b4:	66 90                	xchg   %ax,%ax
+ 1b6:	66 90                	xchg   %ax,%ax
+ 1b8:	66 90                	xchg   %ax,%ax
+ 1ba:	66 90                	xchg   %ax,%ax
+ 1bc:	66 90                	xchg   %ax,%ax
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 2d 02 00 00       	call   52a <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 23 02 00 00       	call   575 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 3b 02 00 00       	call   5a2 <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 d7 01 00 00       	call   548 <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+ 405:	8b 75 10             	mov    0x10(%ebp),%esi
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 40e:	85 f6                	test   %esi,%esi
+ 410:	74 2e                	je     440 <memcmp+0x40>
+ 412:	01 c6                	add    %eax,%esi
+ 414:	eb 14                	jmp    42a <memcmp+0x2a>
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 420:	83 c0 01             	add    $0x1,%eax
+ 423:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 426:	39 f0                	cmp    %esi,%eax
+ 428:	74 16                	je     440 <memcmp+0x40>
+    if(*s1 != *s2)
+ 42a:	0f b6 0a             	movzbl (%edx),%ecx
+ 42d:	0f b6 18             	movzbl (%eax),%ebx
+ 430:	38 d9                	cmp    %bl,%cl
+ 432:	74 ec                	je     420 <memcmp+0x20>
+      return *s1 - *s2;
+ 434:	0f b6 c1             	movzbl %cl,%eax
+ 437:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	5b                   	pop    %ebx
+  return 0;
+ 441:	31 c0                	xor    %eax,%eax
+}
+ 443:	5e                   	pop    %esi
+ 444:	5d                   	pop    %ebp
+ 445:	c3                   	ret
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 450:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 460:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 462:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 468:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 46e:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 474:	c3                   	ret
+ 475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 480:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 482:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 488:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 48e:	c3                   	ret
+ 48f:	90                   	nop
+
+00000490 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 498:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 49d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 4a3:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 4a9:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 4af:	89 c6                	mov    %eax,%esi
+ 4b1:	f7 f7                	div    %edi
+ 4b3:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 4b5:	f7 e3                	mul    %ebx
+ 4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 4ba:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 4bd:	89 d3                	mov    %edx,%ebx
+ 4bf:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 4c2:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 4c4:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 4c6:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 4cc:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 4d1:	f7 e6                	mul    %esi
+ 4d3:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 4d9:	29 d9                	sub    %ebx,%ecx
+ 4db:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 4e1:	01 c1                	add    %eax,%ecx
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 4e9:	5b                   	pop    %ebx
+ 4ea:	5e                   	pop    %esi
+ 4eb:	5f                   	pop    %edi
+ 4ec:	5d                   	pop    %ebp
+ 4ed:	c3                   	ret
+
+000004ee <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 4ee:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4f3:	89 e1                	mov    %esp,%ecx
+ 4f5:	ba fc 04 00 00       	mov    $0x4fc,%edx
+ 4fa:	0f 34                	sysenter
+ 4fc:	c3                   	ret
+
+000004fd <exit>:
+SYSCALL(exit)
+ 4fd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 502:	89 e1                	mov    %esp,%ecx
+ 504:	ba 0b 05 00 00       	mov    $0x50b,%edx
+ 509:	0f 34                	sysenter
+ 50b:	c3                   	ret
+
+0000050c <wait>:
+SYSCALL(wait)
+ 50c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 511:	89 e1                	mov    %esp,%ecx
+ 513:	ba 1a 05 00 00       	mov    $0x51a,%edx
+ 518:	0f 34                	sysenter
+ 51a:	c3                   	ret
+
+0000051b <pipe>:
+SYSCALL(pipe)
+ 51b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 520:	89 e1                	mov    %esp,%ecx
+ 522:	ba 29 05 00 00       	mov    $0x529,%edx
+ 527:	0f 34                	sysenter
+ 529:	c3                   	ret
+
+0000052a <read>:
+SYSCALL(read)
+ 52a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 52f:	89 e1                	mov    %esp,%ecx
+ 531:	ba 38 05 00 00       	mov    $0x538,%edx
+ 536:	0f 34                	sysenter
+ 538:	c3                   	ret
+
+00000539 <write>:
+SYSCALL(write)
+ 539:	b8 10 00 00 00       	mov    $0x10,%eax
+ 53e:	89 e1                	mov    %esp,%ecx
+ 540:	ba 47 05 00 00       	mov    $0x547,%edx
+ 545:	0f 34                	sysenter
+ 547:	c3                   	ret
+
+00000548 <close>:
+SYSCALL(close)
+ 548:	b8 15 00 00 00       	mov    $0x15,%eax
+ 54d:	89 e1                	mov    %esp,%ecx
+ 54f:	ba 56 05 00 00       	mov    $0x556,%edx
+ 554:	0f 34                	sysenter
+ 556:	c3                   	ret
+
+00000557 <kill>:
+SYSCALL(kill)
+ 557:	b8 06 00 00 00       	mov    $0x6,%eax
+ 55c:	89 e1                	mov    %esp,%ecx
+ 55e:	ba 65 05 00 00       	mov    $0x565,%edx
+ 563:	0f 34                	sysenter
+ 565:	c3                   	ret
+
+00000566 <exec>:
+SYSCALL(exec)
+ 566:	b8 07 00 00 00       	mov    $0x7,%eax
+ 56b:	89 e1                	mov    %esp,%ecx
+ 56d:	ba 74 05 00 00       	mov    $0x574,%edx
+ 572:	0f 34                	sysenter
+ 574:	c3                   	ret
+
+00000575 <open>:
+SYSCALL(open)
+ 575:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 57a:	89 e1                	mov    %esp,%ecx
+ 57c:	ba 83 05 00 00       	mov    $0x583,%edx
+ 581:	0f 34                	sysenter
+ 583:	c3                   	ret
+
+00000584 <mknod>:
+SYSCALL(mknod)
+ 584:	b8 11 00 00 00       	mov    $0x11,%eax
+ 589:	89 e1                	mov    %esp,%ecx
+ 58b:	ba 92 05 00 00       	mov    $0x592,%edx
+ 590:	0f 34                	sysenter
+ 592:	c3                   	ret
+
+00000593 <unlink>:
+SYSCALL(unlink)
+ 593:	b8 12 00 00 00       	mov    $0x12,%eax
+ 598:	89 e1                	mov    %esp,%ecx
+ 59a:	ba a1 05 00 00       	mov    $0x5a1,%edx
+ 59f:	0f 34                	sysenter
+ 5a1:	c3                   	ret
+
+000005a2 <fstat>:
+SYSCALL(fstat)
+ 5a2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5a7:	89 e1                	mov    %esp,%ecx
+ 5a9:	ba b0 05 00 00       	mov    $0x5b0,%edx
+ 5ae:	0f 34                	sysenter
+ 5b0:	c3                   	ret
+
+000005b1 <link>:
+SYSCALL(link)
+ 5b1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5b6:	89 e1                	mov    %esp,%ecx
+ 5b8:	ba bf 05 00 00       	mov    $0x5bf,%edx
+ 5bd:	0f 34                	sysenter
+ 5bf:	c3                   	ret
+
+000005c0 <mkdir>:
+SYSCALL(mkdir)
+ 5c0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5c5:	89 e1                	mov    %esp,%ecx
+ 5c7:	ba ce 05 00 00       	mov    $0x5ce,%edx
+ 5cc:	0f 34                	sysenter
+ 5ce:	c3                   	ret
+
+000005cf <chdir>:
+SYSCALL(chdir)
+ 5cf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5d4:	89 e1                	mov    %esp,%ecx
+ 5d6:	ba dd 05 00 00       	mov    $0x5dd,%edx
+ 5db:	0f 34                	sysenter
+ 5dd:	c3                   	ret
+
+000005de <dup>:
+SYSCALL(dup)
+ 5de:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e3:	89 e1                	mov    %esp,%ecx
+ 5e5:	ba ec 05 00 00       	mov    $0x5ec,%edx
+ 5ea:	0f 34                	sysenter
+ 5ec:	c3                   	ret
+
+000005ed <sbrk>:
+SYSCALL(sbrk)
+ 5ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5f2:	89 e1                	mov    %esp,%ecx
+ 5f4:	ba fb 05 00 00       	mov    $0x5fb,%edx
+ 5f9:	0f 34                	sysenter
+ 5fb:	c3                   	ret
+
+000005fc <sleep>:
+SYSCALL(sleep)
+ 5fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 601:	89 e1                	mov    %esp,%ecx
+ 603:	ba 0a 06 00 00       	mov    $0x60a,%edx
+ 608:	0f 34                	sysenter
+ 60a:	c3                   	ret
+
+0000060b <fallocate>:
+SYSCALL(fallocate)
+ 60b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 610:	89 e1                	mov    %esp,%ecx
+ 612:	ba 19 06 00 00       	mov    $0x619,%edx
+ 617:	0f 34                	sysenter
+ 619:	c3                   	ret
+
+0000061a <pread>:
+SYSCALL(pread)
+ 61a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 61f:	89 e1                	mov    %esp,%ecx
+ 621:	ba 28 06 00 00       	mov    $0x628,%edx
+ 626:	0f 34                	sysenter
+ 628:	c3                   	ret
+
+00000629 <pwrite>:
+SYSCALL(pwrite)
+ 629:	b8 18 00 00 00       	mov    $0x18,%eax
+ 62e:	89 e1                	mov    %esp,%ecx
+ 630:	ba 37 06 00 00       	mov    $0x637,%edx
+ 635:	0f 34                	sysenter
+ 637:	c3                   	ret
+
+00000638 <readv>:
+SYSCALL(readv)
+ 638:	b8 19 00 00 00       	mov    $0x19,%eax
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 46 06 00 00       	mov    $0x646,%edx
+ 644:	0f 34                	sysenter
+ 646:	c3                   	ret
+
+00000647 <writev>:
+SYSCALL(writev)
+ 647:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 64c:	89 e1                	mov    %esp,%ecx
+ 64e:	ba 55 06 00 00       	mov    $0x655,%edx
+ 653:	0f 34                	sysenter
+ 655:	c3                   	ret
+
+00000656 <splice>:
+SYSCALL(splice)
+ 656:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 65b:	89 e1                	mov    %esp,%ecx
+ 65d:	ba 64 06 00 00       	mov    $0x664,%edx
+ 662:	0f 34                	sysenter
+ 664:	c3                   	ret
+
+00000665 <setpriority>:
+SYSCALL(setpriority)
+ 665:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 66a:	89 e1                	mov    %esp,%ecx
+ 66c:	ba 73 06 00 00       	mov    $0x673,%edx
+ 671:	0f 34                	sysenter
+ 673:	c3                   	ret
+
+00000674 <setaffinity>:
+SYSCALL(setaffinity)
+ 674:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 679:	89 e1                	mov    %esp,%ecx
+ 67b:	ba 82 06 00 00       	mov    $0x682,%edx
+ 680:	0f 34                	sysenter
+ 682:	c3                   	ret
+
+00000683 <lockstress>:
+SYSCALL(lockstress)
+ 683:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 688:	89 e1                	mov    %esp,%ecx
+ 68a:	ba 91 06 00 00       	mov    $0x691,%edx
+ 68f:	0f 34                	sysenter
+ 691:	c3                   	ret
+
+00000692 <lockstat>:
+SYSCALL(lockstat)
+ 692:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 697:	89 e1                	mov    %esp,%ecx
+ 699:	ba a0 06 00 00       	mov    $0x6a0,%edx
+ 69e:	0f 34                	sysenter
+ 6a0:	c3                   	ret
+
+000006a1 <profctl>:
+SYSCALL(profctl)
+ 6a1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6a6:	89 e1                	mov    %esp,%ecx
+ 6a8:	ba af 06 00 00       	mov    $0x6af,%edx
+ 6ad:	0f 34                	sysenter
+ 6af:	c3                   	ret
+
+000006b0 <profread>:
+SYSCALL(profread)
+ 6b0:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b5:	89 e1                	mov    %esp,%ecx
+ 6b7:	ba be 06 00 00       	mov    $0x6be,%edx
+ 6bc:	0f 34                	sysenter
+ 6be:	c3                   	ret
+
+000006bf <getrusage>:
+SYSCALL(getrusage)
+ 6bf:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c4:	89 e1                	mov    %esp,%ecx
+ 6c6:	ba cd 06 00 00       	mov    $0x6cd,%edx
+ 6cb:	0f 34                	sysenter
+ 6cd:	c3                   	ret
+
+000006ce <tracectl>:
+SYSCALL(tracectl)
+ 6ce:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6d3:	89 e1                	mov    %esp,%ecx
+ 6d5:	ba dc 06 00 00       	mov    $0x6dc,%edx
+ 6da:	0f 34                	sysenter
+ 6dc:	c3                   	ret
+
+000006dd <traceread>:
+SYSCALL(traceread)
+ 6dd:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6e2:	89 e1                	mov    %esp,%ecx
+ 6e4:	ba eb 06 00 00       	mov    $0x6eb,%edx
+ 6e9:	0f 34                	sysenter
+ 6eb:	c3                   	ret
+
+000006ec <nanosleep>:
+SYSCALL(nanosleep)
+ 6ec:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6f1:	89 e1                	mov    %esp,%ecx
+ 6f3:	ba fa 06 00 00       	mov    $0x6fa,%edx
+ 6f8:	0f 34                	sysenter
+ 6fa:	c3                   	ret
+ 6fb:	66 90                	xchg   %ax,%ax
+ 6fd:	66 90                	xchg   %ax,%ax
+ 6ff:	90                   	nop
+
+00000700 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	57                   	push   %edi
+ 704:	56                   	push   %esi
+ 705:	53                   	push   %ebx
+ 706:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 708:	89 d1                	mov    %edx,%ecx
+{
+ 70a:	83 ec 3c             	sub    $0x3c,%esp
+ 70d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 710:	85 d2                	test   %edx,%edx
+ 712:	0f 89 80 00 00 00    	jns    798 <printint+0x98>
+ 718:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 71c:	74 7a                	je     798 <printint+0x98>
+    x = -xx;
+ 71e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 720:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 725:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 728:	31 f6                	xor    %esi,%esi
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 730:	89 c8                	mov    %ecx,%eax
+ 732:	31 d2                	xor    %edx,%edx
+ 734:	89 f7                	mov    %esi,%edi
+ 736:	f7 f3                	div    %ebx
+ 738:	8d 76 01             	lea    0x1(%esi),%esi
+ 73b:	0f b6 92 f8 0c 00 00 	movzbl 0xcf8(%edx),%edx
+ 742:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 746:	89 ca                	mov    %ecx,%edx
+ 748:	89 c1                	mov    %eax,%ecx
+ 74a:	39 da                	cmp    %ebx,%edx
+ 74c:	73 e2                	jae    730 <printint+0x30>
+  if(neg)
+ 74e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 751:	85 c0                	test   %eax,%eax
+ 753:	74 07                	je     75c <printint+0x5c>
+    buf[i++] = '-';
+ 755:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 75a:	89 f7                	mov    %esi,%edi
+ 75c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 75f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 762:	01 df                	add    %ebx,%edi
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 768:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 771:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 774:	6a 01                	push   $0x1
+ 776:	50                   	push   %eax
+ 777:	56                   	push   %esi
+ 778:	e8 bc fd ff ff       	call   539 <write>
+  while(--i >= 0)
+ 77d:	89 f8                	mov    %edi,%eax
+ 77f:	83 c4 10             	add    $0x10,%esp
+ 782:	83 ef 01             	sub    $0x1,%edi
+ 785:	39 d8                	cmp    %ebx,%eax
+ 787:	75 df                	jne    768 <printint+0x68>
+}
+ 789:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 78c:	5b                   	pop    %ebx
+ 78d:	5e                   	pop    %esi
+ 78e:	5f                   	pop    %edi
+ 78f:	5d                   	pop    %ebp
+ 790:	c3                   	ret
+ 791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 798:	31 c0                	xor    %eax,%eax
+ 79a:	eb 89                	jmp    725 <printint+0x25>
+ 79c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7af:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b2:	83 c6 01             	add    $0x1,%esi
+ 7b5:	84 db                	test   %bl,%bl
+ 7b7:	74 67                	je     820 <printf+0x80>
+ 7b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7bc:	31 d2                	xor    %edx,%edx
+ 7be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7c1:	eb 34                	jmp    7f7 <printf+0x57>
+ 7c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7c7:	90                   	nop
+ 7c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7d0:	83 f8 25             	cmp    $0x25,%eax
+ 7d3:	74 18                	je     7ed <printf+0x4d>
+  write(fd, &c, 1);
+ 7d5:	83 ec 04             	sub    $0x4,%esp
+ 7d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7de:	6a 01                	push   $0x1
+ 7e0:	50                   	push   %eax
+ 7e1:	57                   	push   %edi
+ 7e2:	e8 52 fd ff ff       	call   539 <write>
+ 7e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 7f0:	83 c6 01             	add    $0x1,%esi
+ 7f3:	84 db                	test   %bl,%bl
+ 7f5:	74 29                	je     820 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7fa:	85 d2                	test   %edx,%edx
+ 7fc:	74 ca                	je     7c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7fe:	83 fa 25             	cmp    $0x25,%edx
+ 801:	75 ea                	jne    7ed <printf+0x4d>
+      if(c == 'd'){
+ 803:	83 f8 25             	cmp    $0x25,%eax
+ 806:	0f 84 24 01 00 00    	je     930 <printf+0x190>
+ 80c:	83 e8 63             	sub    $0x63,%eax
+ 80f:	83 f8 15             	cmp    $0x15,%eax
+ 812:	77 1c                	ja     830 <printf+0x90>
+ 814:	ff 24 85 a0 0c 00 00 	jmp    *0xca0(,%eax,4)
+ 81b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 820:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 823:	5b                   	pop    %ebx
+ 824:	5e                   	pop    %esi
+ 825:	5f                   	pop    %edi
+ 826:	5d                   	pop    %ebp
+ 827:	c3                   	ret
+ 828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 836:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 83a:	6a 01                	push   $0x1
+ 83c:	52                   	push   %edx
+ 83d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 840:	57                   	push   %edi
+ 841:	e8 f3 fc ff ff       	call   539 <write>
+ 846:	83 c4 0c             	add    $0xc,%esp
+ 849:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84c:	6a 01                	push   $0x1
+ 84e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 851:	52                   	push   %edx
+ 852:	57                   	push   %edi
+ 853:	e8 e1 fc ff ff       	call   539 <write>
+        putc(fd, c);
+ 858:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 85b:	31 d2                	xor    %edx,%edx
+ 85d:	eb 8e                	jmp    7ed <printf+0x4d>
+ 85f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 00                	push   $0x0
+ 86f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 871:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 874:	e8 87 fe ff ff       	call   700 <printint>
+        ap++;
+ 879:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 87c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87f:	31 d2                	xor    %edx,%edx
+ 881:	e9 67 ff ff ff       	jmp    7ed <printf+0x4d>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 890:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 893:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 895:	83 c0 04             	add    $0x4,%eax
+ 898:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 89b:	85 db                	test   %ebx,%ebx
+ 89d:	0f 84 9d 00 00 00    	je     940 <printf+0x1a0>
+        while(*s != 0){
+ 8a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8a8:	84 c0                	test   %al,%al
+ 8aa:	0f 84 3d ff ff ff    	je     7ed <printf+0x4d>
+ 8b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8b6:	89 de                	mov    %ebx,%esi
+ 8b8:	89 d3                	mov    %edx,%ebx
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8c9:	6a 01                	push   $0x1
+ 8cb:	53                   	push   %ebx
+ 8cc:	57                   	push   %edi
+ 8cd:	e8 67 fc ff ff       	call   539 <write>
+        while(*s != 0){
+ 8d2:	0f b6 06             	movzbl (%esi),%eax
+ 8d5:	83 c4 10             	add    $0x10,%esp
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	75 e4                	jne    8c0 <printf+0x120>
+      state = 0;
+ 8dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	e9 07 ff ff ff       	jmp    7ed <printf+0x4d>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 01                	push   $0x1
+ 8ff:	e9 6b ff ff ff       	jmp    86f <printf+0xcf>
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 908:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 90b:	83 ec 04             	sub    $0x4,%esp
+ 90e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 911:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 913:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 916:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	52                   	push   %edx
+ 91c:	57                   	push   %edi
+ 91d:	e8 17 fc ff ff       	call   539 <write>
+        ap++;
+ 922:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 925:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 928:	31 d2                	xor    %edx,%edx
+ 92a:	e9 be fe ff ff       	jmp    7ed <printf+0x4d>
+ 92f:	90                   	nop
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 936:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 939:	6a 01                	push   $0x1
+ 93b:	e9 11 ff ff ff       	jmp    851 <printf+0xb1>
+ 940:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 945:	bb 97 0c 00 00       	mov    $0xc97,%ebx
+ 94a:	e9 61 ff ff ff       	jmp    8b0 <printf+0x110>
+ 94f:	90                   	nop
+
+00000950 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 950:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 951:	a1 60 45 00 00       	mov    0x4560,%eax
+{
+ 956:	89 e5                	mov    %esp,%ebp
+ 958:	57                   	push   %edi
+ 959:	56                   	push   %esi
+ 95a:	53                   	push   %ebx
+ 95b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 95e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 968:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 96a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 96c:	39 ca                	cmp    %ecx,%edx
+ 96e:	73 30                	jae    9a0 <free+0x50>
+ 970:	39 c1                	cmp    %eax,%ecx
+ 972:	72 04                	jb     978 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 974:	39 c2                	cmp    %eax,%edx
+ 976:	72 f0                	jb     968 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 978:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 97b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 97e:	39 f8                	cmp    %edi,%eax
+ 980:	74 2e                	je     9b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 982:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 985:	8b 42 04             	mov    0x4(%edx),%eax
+ 988:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 98b:	39 f1                	cmp    %esi,%ecx
+ 98d:	74 38                	je     9c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 98f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 991:	5b                   	pop    %ebx
+  freep = p;
+ 992:	89 15 60 45 00 00    	mov    %edx,0x4560
+}
+ 998:	5e                   	pop    %esi
+ 999:	5f                   	pop    %edi
+ 99a:	5d                   	pop    %ebp
+ 99b:	c3                   	ret
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9a0:	39 c1                	cmp    %eax,%ecx
+ 9a2:	72 d0                	jb     974 <free+0x24>
+ 9a4:	eb c2                	jmp    968 <free+0x18>
+ 9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9b0:	03 70 04             	add    0x4(%eax),%esi
+ 9b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9b6:	8b 02                	mov    (%edx),%eax
+ 9b8:	8b 00                	mov    (%eax),%eax
+ 9ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9c3:	39 f1                	cmp    %esi,%ecx
+ 9c5:	75 c8                	jne    98f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ca:	89 15 60 45 00 00    	mov    %edx,0x4560
+    p->s.size += bp->s.size;
+ 9d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9d8:	5b                   	pop    %ebx
+ 9d9:	5e                   	pop    %esi
+ 9da:	5f                   	pop    %edi
+ 9db:	5d                   	pop    %ebp
+ 9dc:	c3                   	ret
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9ec:	8b 15 60 45 00 00    	mov    0x4560,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9f5:	c1 ef 03             	shr    $0x3,%edi
+ 9f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9fb:	85 d2                	test   %edx,%edx
+ 9fd:	0f 84 8d 00 00 00    	je     a90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a05:	8b 48 04             	mov    0x4(%eax),%ecx
+ a08:	39 f9                	cmp    %edi,%ecx
+ a0a:	73 64                	jae    a70 <malloc+0x90>
+  if(nu < 4096)
+ a0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a11:	39 df                	cmp    %ebx,%edi
+ a13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a1d:	eb 0a                	jmp    a29 <malloc+0x49>
+ a1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a22:	8b 48 04             	mov    0x4(%eax),%ecx
+ a25:	39 f9                	cmp    %edi,%ecx
+ a27:	73 47                	jae    a70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a29:	89 c2                	mov    %eax,%edx
+ a2b:	39 05 60 45 00 00    	cmp    %eax,0x4560
+ a31:	75 ed                	jne    a20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	56                   	push   %esi
+ a37:	e8 b1 fb ff ff       	call   5ed <sbrk>
+  if(p == (char*)-1)
+ a3c:	83 c4 10             	add    $0x10,%esp
+ a3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a42:	74 1c                	je     a60 <malloc+0x80>
+  hp->s.size = nu;
+ a44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a47:	83 ec 0c             	sub    $0xc,%esp
+ a4a:	83 c0 08             	add    $0x8,%eax
+ a4d:	50                   	push   %eax
+ a4e:	e8 fd fe ff ff       	call   950 <free>
+  return freep;
+ a53:	8b 15 60 45 00 00    	mov    0x4560,%edx
+      if((p = morecore(nunits)) == 0)
+ a59:	83 c4 10             	add    $0x10,%esp
+ a5c:	85 d2                	test   %edx,%edx
+ a5e:	75 c0                	jne    a20 <malloc+0x40>
+        return 0;
+  }
+}
+ a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a63:	31 c0                	xor    %eax,%eax
+}
+ a65:	5b                   	pop    %ebx
+ a66:	5e                   	pop    %esi
+ a67:	5f                   	pop    %edi
+ a68:	5d                   	pop    %ebp
+ a69:	c3                   	ret
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a70:	39 cf                	cmp    %ecx,%edi
+ a72:	74 4c                	je     ac0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a74:	29 f9                	sub    %edi,%ecx
+ a76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a7f:	89 15 60 45 00 00    	mov    %edx,0x4560
+}
+ a85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a88:	83 c0 08             	add    $0x8,%eax
+}
+ a8b:	5b                   	pop    %ebx
+ a8c:	5e                   	pop    %esi
+ a8d:	5f                   	pop    %edi
+ a8e:	5d                   	pop    %ebp
+ a8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a90:	c7 05 60 45 00 00 64 	movl   $0x4564,0x4560
+ a97:	45 00 00 
+    base.s.size = 0;
+ a9a:	b8 64 45 00 00       	mov    $0x4564,%eax
+    base.s.ptr = freep = prevp = &base;
+ a9f:	c7 05 64 45 00 00 64 	movl   $0x4564,0x4564
+ aa6:	45 00 00 
+    base.s.size = 0;
+ aa9:	c7 05 68 45 00 00 00 	movl   $0x0,0x4568
+ ab0:	00 00 00 
+    if(p->s.size >= nunits){
+ ab3:	e9 54 ff ff ff       	jmp    a0c <malloc+0x2c>
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ac0:	8b 08                	mov    (%eax),%ecx
+ ac2:	89 0a                	mov    %ecx,(%edx)
+ ac4:	eb b9                	jmp    a7f <malloc+0x9f>
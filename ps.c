@@ -0,0 +1,106 @@
+// List processes and the resources they have used.
+//   ps          one line per process
+//   ps -s pid   the system calls pid has made, by name
+// Times are in clock ticks, run time in units of 2^20 cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "syscall.h"
+#include "rusage.h"
+
+char *states[] = { "unused", "embryo", "sleep", "runble", "run", "zombie" };
+
+char *syscalls[NSYSCALL] = {
+[SYS_fork]        "fork",
+[SYS_exit]        "exit",
+[SYS_wait]        "wait",
+[SYS_pipe]        "pipe",
+[SYS_read]        "read",
+[SYS_kill]        "kill",
+[SYS_exec]        "exec",
+[SYS_fstat]       "fstat",
+[SYS_chdir]       "chdir",
+[SYS_dup]         "dup",
+[SYS_getpid]      "getpid",
+[SYS_sbrk]        "sbrk",
+[SYS_sleep]       "sleep",
+[SYS_uptime]      "uptime",
+[SYS_open]        "open",
+[SYS_write]       "write",
+[SYS_mknod]       "mknod",
+[SYS_unlink]      "unlink",
+[SYS_link]        "link",
+[SYS_mkdir]       "mkdir",
+[SYS_close]       "close",
+[SYS_fallocate]   "fallocate",
+[SYS_pread]       "pread",
+[SYS_pwrite]      "pwrite",
+[SYS_readv]       "readv",
+[SYS_writev]      "writev",
+[SYS_splice]      "splice",
+[SYS_setpriority] "setpriority",
+[SYS_setaffinity] "setaffinity",
+[SYS_lockstress]  "lockstress",
+[SYS_lockstat]    "lockstat",
+[SYS_profctl]     "profctl",
+[SYS_profread]    "profread",
+[SYS_getrusage]   "getrusage",
+[SYS_tracectl]    "tracectl",
+[SYS_traceread]   "traceread",
+[SYS_nanosleep]   "nanosleep",
+};
+
+struct rusage ru[NPROC];
+
+void
+list(void)
+{
+  char *state;
+  int i, n;
+
+  if((n = getrusage(-1, ru, NPROC)) < 0){
+    printf(2, "ps: getrusage failed\n");
+    exit();
+  }
+  printf(1, "pid state name user sys Mcycles vcsw ivcsw syscalls faults\n");
+  for(i = 0; i < n; i++){
+    state = "???";
+    if(ru[i].state < sizeof(states)/sizeof(states[0]))
+      state = states[ru[i].state];
+    printf(1, "%d %s %s %d %d %d %d %d %d %d\n", ru[i].pid, state,
+           ru[i].name, ru[i].uticks, ru[i].sticks,
+           (uint)(ru[i].cycles >> 20), ru[i].nvcsw, ru[i].nivcsw,
+           ru[i].nsyscall, ru[i].nfault);
+  }
+}
+
+void
+calls(int pid)
+{
+  int i;
+
+  if(getrusage(pid, ru, 1) != 1){
+    printf(2, "ps: no process %d\n", pid);
+    exit();
+  }
+  printf(1, "%d %s: %d system calls\n", pid, ru[0].name, ru[0].nsyscall);
+  for(i = 0; i < NSYSCALL; i++){
+    if(ru[0].syscalls[i] == 0)
+      continue;
+    printf(1, "%s %d\n", syscalls[i] ? syscalls[i] : "?", ru[0].syscalls[i]);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc == 3 && strcmp(argv[1], "-s") == 0)
+    calls(atoi(argv[2]));
+  else if(argc == 1)
+    list();
+  else
+    printf(2, "usage: ps [-s pid]\n");
+  exit();
+}
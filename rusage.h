@@ -0,0 +1,15 @@
+// Resource usage of a process, as returned by the getrusage
+// system call.
+struct rusage {
+  int pid;
+  int state;                // UNUSED, EMBRYO, ... as in proc.h
+  char name[16];
+  uint uticks;              // Clock ticks that found it in user space
+  uint sticks;              // Clock ticks that found it in the kernel
+  uint64 cycles;            // Time it has run, in cycles
+  uint nvcsw;               // Times it slept
+  uint nivcsw;              // Times it was preempted
+  uint nfault;              // Exceptions it took in user space
+  uint nsyscall;            // System calls made
+  uint syscalls[NSYSCALL];  // System calls made, by number
+};
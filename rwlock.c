@@ -0,0 +1,89 @@
+// Reader-writer spin locks.
+//
+// The whole lock is one word, changed with cmpxchg. Readers add
+// one to the count as long as no writer holds the lock or waits
+// for it, so a stream of readers can't starve a writer: a writer
+// first sets RW_WAIT, which turns new readers away, and then
+// waits for the readers already inside to leave.
+//
+// Like spin locks, these keep interrupts off while held.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+  lk->name = name;
+  lk->word = 0;
+  lk->cpu = 0;
+}
+
+// Acquire the lock for reading.
+void
+acquireread(struct rwlock *lk)
+{
+  uint w;
+
+  pushcli();
+  if(lk->cpu == mycpu())
+    panic("acquireread");
+  for(;;){
+    w = lk->word;
+    if((w & (RW_WRITER|RW_WAIT)) == 0 && cmpxchg(&lk->word, w, w+1) == w)
+      break;
+    asm volatile("pause");
+  }
+  // cmpxchg is a full barrier, so the critical section's loads
+  // can't move above it.
+}
+
+void
+releaseread(struct rwlock *lk)
+{
+  if((lk->word & RW_READERS) == 0)
+    panic("releaseread");
+  xadd((volatile int*)&lk->word, -1);
+  popcli();
+}
+
+// Acquire the lock for writing, waiting for any readers to leave.
+void
+acquirewrite(struct rwlock *lk)
+{
+  uint w;
+
+  pushcli();
+  if(lk->cpu == mycpu())
+    panic("acquirewrite");
+  for(;;){
+    w = lk->word;
+    if((w & ~RW_WAIT) == 0){
+      if(cmpxchg(&lk->word, w, RW_WRITER) == w)
+        break;
+    } else if((w & RW_WAIT) == 0)
+      cmpxchg(&lk->word, w, w | RW_WAIT);
+    asm volatile("pause");
+  }
+  lk->cpu = mycpu();
+}
+
+void
+releasewrite(struct rwlock *lk)
+{
+  if((lk->word & RW_WRITER) == 0 || lk->cpu != mycpu())
+    panic("releasewrite");
+  lk->cpu = 0;
+
+  // Any other writer still waiting sets RW_WAIT again.
+  __sync_synchronize();
+  lk->word = 0;
+  popcli();
+}
@@ -0,0 +1,14 @@
+// Reader-writer spin locks, for data that is looked up far more
+// often than it changes. Any number of readers may hold the lock
+// at once; a writer holds it alone.
+#define RW_WRITER  0x80000000  // A writer holds the lock
+#define RW_WAIT    0x40000000  // A writer is waiting; readers hold off
+#define RW_READERS 0x3fffffff  // Number of readers holding the lock
+
+struct rwlock {
+  volatile uint word;  // RW_WRITER | RW_WAIT | number of readers
+
+  // For debugging:
+  char *name;          // Name of lock.
+  struct cpu *cpu;     // The cpu holding the lock for writing.
+};
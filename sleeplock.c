@@ -6,28 +6,73 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 
+// Most sleep locks, such as those of inodes and buffers, are held
+// only for a short copy. Going to sleep on one costs two trips
+// through the scheduler, which takes much longer than waiting for
+// the holder to finish when it is running on another CPU. So a
+// waiter first spins while the holder is running, for at most
+// SPINCYCLES, and only sleeps if that doesn't work out.
+#define SPINCYCLES 50000
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
   lk->locked = 0;
+  lk->owner = 0;
+  lk->class = lockclass(name);
   lk->pid = 0;
 }
 
+// Wait without lk->lk for lk to come free, as long as its holder
+// is running on another CPU. The holder's struct proc is never
+// freed, so it's safe to peek at its state without its lock; at
+// worst the guess about whether to keep spinning is wrong.
+static void
+spinwait(struct sleeplock *lk)
+{
+  struct proc *p;
+  uint64 t0;
+
+  t0 = rdtsc();
+  while(lk->locked){
+    p = lk->owner;
+    if(p && p->state != RUNNING)
+      break;
+    if(rdtsc() - t0 > SPINCYCLES)
+      break;
+    asm volatile("pause" : : : "memory");
+  }
+}
+
 void
 acquiresleep(struct sleeplock *lk)
 {
+  uint64 t0;
+  int how;
+
+  t0 = rdtsc();
+  how = SL_FREE;
   acquire(&lk->lk);
+  if(lk->locked){
+    release(&lk->lk);
+    spinwait(lk);
+    acquire(&lk->lk);
+    how = SL_SPUN;
+  }
   while (lk->locked) {
+    how = SL_SLEPT;
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
+  lk->owner = myproc();
   lk->pid = myproc()->pid;
+  lockstatsleep(lk->class, how, rdtsc() - t0);
   release(&lk->lk);
 }
 
@@ -36,6 +81,7 @@ releasesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
   lk->locked = 0;
+  lk->owner = 0;
   lk->pid = 0;
   wakeup(lk);
   release(&lk->lk);
@@ -1,7 +1,14 @@
+// How acquiresleep() got a sleep lock, for lockstat.
+#define SL_FREE   0  // It was free
+#define SL_SPUN   1  // Its holder released it while we spun
+#define SL_SLEPT  2  // We had to sleep
+
 // Long-term locks for processes
 struct sleeplock {
   uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
+  struct proc *owner; // Process holding lock, for spinning waiters
+  int class;         // Statistics slot for locks with this name
   
   // For debugging:
   char *name;        // Name of lock.
@@ -6,17 +6,140 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "sleeplock.h"
+#include "lockstat.h"
+
+// Lock statistics. Locks that share a name, such as all the
+// "proc" locks, share a class, and each CPU counts separately for
+// every class so that no atomic updates are needed: interrupts
+// are off from acquire() through release(). Class 0 collects
+// locks that couldn't get a class of their own.
+static char *classname[NLOCKSTAT] = { "(other)" };
+static int nclass = 1;
+static uint classlock;  // protects classname and nclass
+static struct lockstat stats[NCPU][NLOCKSTAT];
+
+// Find or make the statistics class for locks named name.
+// kinit1() initializes locks before seginit() sets up %gs, so
+// this mustn't use pushcli(), which calls mycpu(); it turns
+// interrupts off by hand instead.
+int
+lockclass(char *name)
+{
+  uint eflags;
+  int i;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&classlock, 1) != 0)
+    ;
+  for(i = 1; i < nclass; i++)
+    if(strncmp(classname[i], name, sizeof(stats[0][0].name)) == 0)
+      break;
+  if(i == nclass){
+    if(nclass < NLOCKSTAT)
+      classname[nclass++] = name;
+    else
+      i = 0;
+  }
+  xchg(&classlock, 0);
+  if(eflags & FL_IF)
+    sti();
+  return i;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
+{
+  initlockkind(lk, name, LK_TAS);
+}
+
+// Initialize a lock of the given kind. A test-and-set lock is
+// cheapest when uncontended, but lets any waiter win. Ticket and
+// MCS locks are handed to waiters in the order they arrived, and
+// MCS waiters each spin on their own cache line rather than all
+// on the lock's.
+void
+initlockkind(struct spinlock *lk, char *name, int kind)
 {
   lk->name = name;
+  lk->kind = kind;
   lk->locked = 0;
+  lk->next = 0;
+  lk->served = 0;
+  lk->tail = 0;
+  lk->node = 0;
+  lk->class = lockclass(name);
   lk->cpu = 0;
 }
 
+// MCS queue nodes come from a small pool in struct cpu; a lock
+// is always released on the CPU that acquired it, and interrupts
+// are off in between.
+static struct mcsnode*
+mcsalloc(void)
+{
+  struct cpu *c = mycpu();
+  int i;
+
+  for(i = 0; i < NMCS; i++){
+    if((c->mcsused & (1 << i)) == 0){
+      c->mcsused |= 1 << i;
+      return &c->mcs[i];
+    }
+  }
+  panic("mcsalloc");
+}
+
+static void
+mcsfree(struct mcsnode *n)
+{
+  struct cpu *c = mycpu();
+
+  c->mcsused &= ~(1 << (n - c->mcs));
+}
+
+// Join the end of lk's queue and wait to reach its head.
+// Returns 1 if it had to wait.
+static int
+mcsacquire(struct spinlock *lk)
+{
+  struct mcsnode *n, *prev;
+
+  n = mcsalloc();
+  n->next = 0;
+  n->wait = 1;
+  prev = (struct mcsnode*)xchg((volatile uint*)&lk->tail, (uint)n);
+  if(prev){
+    prev->next = n;
+    while(n->wait)
+      ;
+  }
+  lk->node = n;
+  return prev != 0;
+}
+
+// Pass lk to the next CPU in its queue, if there is one.
+static void
+mcsrelease(struct spinlock *lk)
+{
+  struct mcsnode *n = lk->node;
+
+  if(n->next == 0){
+    if(cmpxchg((volatile uint*)&lk->tail, (uint)n, 0) == (uint)n){
+      mcsfree(n);
+      return;
+    }
+    // A CPU has joined the queue but not yet linked itself in.
+    while(n->next == 0)
+      ;
+  }
+  n->next->wait = 0;
+  mcsfree(n);
+}
+
 // Acquire the lock.
 // Loops (spins) until the lock is acquired.
 // Holding a lock for a long time may cause
@@ -24,13 +147,33 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  uint t;
+  uint64 t0, spin;
+  int waited;
+  struct lockstat *st;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk)) // check that not already holding lock
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  t0 = rdtsc();
+  waited = 0;
+  switch(lk->kind){
+  case LK_TICKET:
+    t = xadd((volatile int*)&lk->next, 1);
+    while(lk->served != t)
+      waited = 1;
+    lk->locked = 1;
+    break;
+  case LK_MCS:
+    waited = mcsacquire(lk);
+    lk->locked = 1;
+    break;
+  default:
+    // The xchg is atomic.
+    while(xchg(&lk->locked, 1) != 0)
+      waited = 1;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,15 +183,36 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+
+  // Count it for lockstat.
+  lk->tacquired = rdtsc();
+  st = &stats[cpuid()][lk->class];
+  st->acquires++;
+  if(waited){
+    spin = lk->tacquired - t0;
+    st->contended++;
+    st->spin += spin;
+    if(spin > st->maxspin)
+      st->maxspin = spin;
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64 hold;
+  struct lockstat *st;
+
   if(!holding(lk))
     panic("release");
 
+  hold = rdtsc() - lk->tacquired;
+  st = &stats[cpuid()][lk->class];
+  st->hold += hold;
+  if(hold > st->maxhold)
+    st->maxhold = hold;
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,10 +223,21 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  switch(lk->kind){
+  case LK_TICKET:
+    lk->locked = 0;
+    lk->served = lk->served + 1;  // only the holder writes served
+    break;
+  case LK_MCS:
+    lk->locked = 0;
+    mcsrelease(lk);
+    break;
+  default:
+    // Release the lock, equivalent to lk->locked = 0.
+    // This code can't use a C assignment, since it might
+    // not be atomic. A real OS would use C atomics here.
+    asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  }
 
   popcli();
 }
@@ -125,3 +300,96 @@ popcli(void)
     sti();
 }
 
+
+//PAGEBREAK!
+// Copy the statistics for up to n lock classes, summed over all
+// CPUs, to st. If reset is set, then start counting again from
+// zero; counts from other CPUs that are in the middle of an
+// update may survive. Returns the number of classes copied.
+int
+lockstatread(struct lockstat *st, int n, int reset)
+{
+  struct lockstat *s;
+  int i, c;
+
+  if(n > nclass)
+    n = nclass;
+  for(i = 0; i < n; i++){
+    memset(&st[i], 0, sizeof(st[i]));
+    safestrcpy(st[i].name, classname[i], sizeof(st[i].name));
+    for(c = 0; c < ncpu; c++){
+      s = &stats[c][i];
+      st[i].acquires += s->acquires;
+      st[i].contended += s->contended;
+      st[i].spun += s->spun;
+      st[i].slept += s->slept;
+      st[i].spin += s->spin;
+      st[i].hold += s->hold;
+      if(s->maxspin > st[i].maxspin)
+        st[i].maxspin = s->maxspin;
+      if(s->maxhold > st[i].maxhold)
+        st[i].maxhold = s->maxhold;
+    }
+  }
+  if(reset)
+    memset(stats, 0, sizeof(stats));
+  return n;
+}
+
+// Count an acquisition of a sleep lock in class for lockstat.
+// how is SL_FREE, SL_SPUN or SL_SLEPT, and wait is how many
+// cycles it took. Caller must have interrupts off.
+void
+lockstatsleep(int class, int how, uint64 wait)
+{
+  struct lockstat *st;
+
+  st = &stats[cpuid()][class];
+  st->acquires++;
+  if(how == SL_FREE)
+    return;
+  st->contended++;
+  if(how == SL_SPUN)
+    st->spun++;
+  else
+    st->slept++;
+  st->spin += wait;
+  if(wait > st->maxspin)
+    st->maxspin = wait;
+}
+
+// Locks for lockstress(), one of each kind.
+static struct spinlock stresslk[] = {
+[LK_TAS]    { .kind = LK_TAS,    .name = "stress tas" },
+[LK_TICKET] { .kind = LK_TICKET, .name = "stress ticket" },
+[LK_MCS]    { .kind = LK_MCS,    .name = "stress mcs" },
+};
+static uint stresscount;
+
+// Acquire and release the stress lock of the given kind n times,
+// doing a little work while holding it, for the lockbench program.
+// Returns the longest wait for the lock in clock cycles.
+int
+lockstress(int kind, int n)
+{
+  struct spinlock *lk;
+  uint64 t0, w, maxw;
+  int i;
+
+  if(kind < 0 || kind >= NELEM(stresslk) || n < 0)
+    return -1;
+  lk = &stresslk[kind];
+  if(lk->class == 0)
+    lk->class = lockclass(lk->name);
+  maxw = 0;
+  for(i = 0; i < n; i++){
+    t0 = rdtsc();
+    acquire(lk);
+    w = rdtsc() - t0;
+    if(w > maxw)
+      maxw = w;
+    stresscount++;
+    release(lk);
+  }
+  return maxw > 0x7fffffff ? 0x7fffffff : maxw;
+}
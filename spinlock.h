@@ -1,6 +1,30 @@
+// Kinds of spin lock; see initlockkind().
+#define LK_TAS     0  // test-and-set: all waiters spin on one word; unfair
+#define LK_TICKET  1  // ticket: first come, first served
+#define LK_MCS     2  // MCS queue: FIFO, each waiter spins on its own node
+
+// A waiting CPU's place in an MCS lock's queue.
+struct mcsnode {
+  struct mcsnode *volatile next;  // CPU waiting behind this one
+  volatile uint wait;             // Set until the lock is passed on
+};
+
 // Mutual exclusion lock.
 struct spinlock {
   uint locked;       // Is the lock held?
+  int kind;          // LK_TAS, LK_TICKET or LK_MCS
+
+  // LK_TICKET: take a ticket from next, wait until it is served.
+  volatile uint next;
+  volatile uint served;
+
+  // LK_MCS: queue of waiting CPUs.
+  struct mcsnode *volatile tail;  // Last in the queue, or 0
+  struct mcsnode *node;           // Holder's node
+
+  // For lockstat:
+  int class;         // Statistics slot for locks with this name
+  uint64 tacquired;  // When the holder acquired it (rdtsc)
 
   // For debugging:
   char *name;        // Name of lock.
@@ -8,4 +32,3 @@ struct spinlock {
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
 };
-
@@ -0,0 +1,77 @@
+// File lookup benchmark.
+// For 1 up to 8 CPUs, one process pinned to each CPU repeatedly
+// stats a file and opens and closes it, so every CPU looks the
+// same inodes up in the kernel's inode cache at once. Reports
+// lookups per tick: with lookups that don't exclude each other
+// this should grow with the number of CPUs.
+
+#include "types.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "user.h"
+
+#define N 2000  // stat/open pairs per process
+
+char *file = "README";
+
+// Run nproc processes on CPUs 0..nproc-1.
+// Returns -1 if there aren't that many CPUs.
+int
+bench(int nproc)
+{
+  int fds[2], fd, i, j, pid, start, ticks, ok, r;
+  struct stat st;
+
+  if(pipe(fds) < 0){
+    printf(2, "statbench: pipe failed\n");
+    exit();
+  }
+  start = uptime();
+  for(i = 0; i < nproc; i++){
+    if((pid = fork()) < 0){
+      printf(2, "statbench: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(fds[0]);
+      r = -1;
+      if(setaffinity(getpid(), 1 << i) == 0){
+        for(j = 0; j < N; j++){
+          if(stat(file, &st) < 0 || (fd = open(file, O_RDONLY)) < 0)
+            break;
+          close(fd);
+        }
+        r = j;
+      }
+      write(fds[1], &r, sizeof(r));
+      exit();
+    }
+  }
+  close(fds[1]);
+  ok = 1;
+  for(i = 0; i < nproc; i++)
+    if(read(fds[0], &r, sizeof(r)) != sizeof(r) || r != N)
+      ok = 0;
+  close(fds[0]);
+  for(i = 0; i < nproc; i++)
+    wait();
+  ticks = uptime() - start;
+  if(ticks == 0)
+    ticks = 1;
+
+  if(!ok)
+    return -1;
+  printf(1, "%d cpus: %d lookups/tick\n", nproc, 2 * nproc * N / ticks);
+  return 0;
+}
+
+int
+main(void)
+{
+  int nproc;
+
+  for(nproc = 1; nproc <= 8; nproc++)
+    if(bench(nproc) < 0)
+      break;
+  exit();
+}
@@ -3,9 +3,11 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "trace.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -81,6 +83,17 @@ argptr(int n, char **pp, int size)
   return 0;
 }
 
+// Fetch the nth word-sized system call argument as a pointer
+// to count elements of size bytes each.  count must be between
+// 0 and max, which keeps count*size from wrapping.
+int
+argarray(int n, void **pp, int count, int size, int max)
+{
+  if (count < 0 || count > max)
+    return -1;
+  return argptr(n, (char**)pp, count*size);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -99,6 +112,7 @@ extern int sys_close(void);
 extern int sys_dup(void);
 extern int sys_exec(void);
 extern int sys_exit(void);
+extern int sys_fallocate(void);
 extern int sys_fork(void);
 extern int sys_fstat(void);
 extern int sys_getpid(void);
@@ -108,12 +122,27 @@ extern int sys_mkdir(void);
 extern int sys_mknod(void);
 extern int sys_open(void);
 extern int sys_pipe(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
 extern int sys_read(void);
+extern int sys_readv(void);
 extern int sys_sbrk(void);
 extern int sys_sleep(void);
 extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
+extern int sys_writev(void);
+extern int sys_splice(void);
+extern int sys_setpriority(void);
+extern int sys_setaffinity(void);
+extern int sys_lockstress(void);
+extern int sys_lockstat(void);
+extern int sys_profctl(void);
+extern int sys_profread(void);
+extern int sys_getrusage(void);
+extern int sys_tracectl(void);
+extern int sys_traceread(void);
+extern int sys_nanosleep(void);
 extern int sys_uptime(void);
 
 static int (*syscalls[])(void) = {
@@ -138,8 +167,28 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_fallocate] sys_fallocate,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_splice]  sys_splice,
+[SYS_setpriority] sys_setpriority,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_lockstress] sys_lockstress,
+[SYS_lockstat] sys_lockstat,
+[SYS_profctl] sys_profctl,
+[SYS_profread] sys_profread,
+[SYS_getrusage] sys_getrusage,
+[SYS_tracectl] sys_tracectl,
+[SYS_traceread] sys_traceread,
+[SYS_nanosleep] sys_nanosleep,
 };
 
+// p->syscalls and struct rusage count calls by number, so param.h
+// must keep up with this table.
+_Static_assert(NELEM(syscalls) == NSYSCALL, "NSYSCALL does not match syscalls[]");
+
 void
 syscall(void)
 {
@@ -149,7 +198,10 @@ syscall(void)
   num = curproc->tf->eax;
   // Check that the syscall number is between 1 and 21
   if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    curproc->syscalls[num]++;
+    trace(TR_SYSCALL, num, 0);
     curproc->tf->eax = syscalls[num]();
+    trace(TR_SYSRET, num, curproc->tf->eax);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
@@ -20,3 +20,19 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_fallocate 22
+#define SYS_pread  23
+#define SYS_pwrite 24
+#define SYS_readv  25
+#define SYS_writev 26
+#define SYS_splice 27
+#define SYS_setpriority 28
+#define SYS_setaffinity 29
+#define SYS_lockstress 30
+#define SYS_lockstat 31
+#define SYS_profctl 32
+#define SYS_profread 33
+#define SYS_getrusage 34
+#define SYS_tracectl 35
+#define SYS_traceread 36
+#define SYS_nanosleep 37
@@ -9,12 +9,13 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "uio.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -35,6 +36,31 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
+// Fetch the nth system call argument as an array of cnt iovecs,
+// and check that every buffer they describe lies within the
+// process address space.
+static int
+argiov(int n, int cnt, struct iovec **piov)
+{
+  int i;
+  uint base;
+  struct iovec *iov;
+  struct proc *curproc = myproc();
+
+  if(cnt < 0 || cnt > MAXIOV)
+    return -1;
+  if(argptr(n, (void*)&iov, cnt*sizeof(*iov)) < 0)
+    return -1;
+  for(i = 0; i < cnt; i++){
+    base = (uint)iov[i].iov_base;
+    if(iov[i].iov_len < 0 || base >= curproc->sz ||
+       base + iov[i].iov_len > curproc->sz)
+      return -1;
+  }
+  *piov = iov;
+  return 0;
+}
+
 // Allocate a file descriptor for the given file.
 // Takes over file reference from caller on success.
 static int
@@ -90,6 +116,73 @@ sys_write(void)
   return filewrite(f, p, n);
 }
 
+// Positional read: like read(), but at offset off and
+// without moving the file's offset.
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepwrite(f, p, n, off);
+}
+
+// Scatter read: fill several buffers with one system call.
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec *iov;
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, &iov) < 0)
+    return -1;
+  return filereadv(f, iov, cnt);
+}
+
+// Gather write: write several buffers with one system call.
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec *iov;
+  int cnt;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &cnt) < 0 || argiov(1, cnt, &iov) < 0)
+    return -1;
+  return filewritev(f, iov, cnt);
+}
+
+// Move up to n bytes from one open file to another inside the
+// kernel, as if by read() followed by write().
+int
+sys_splice(void)
+{
+  struct file *in, *out;
+  int n;
+
+  if(argfd(0, 0, &in) < 0 || argfd(1, 0, &out) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  return filesplice(in, out, n);
+}
+
 int
 sys_close(void)
 {
@@ -103,6 +196,28 @@ sys_close(void)
   return 0;
 }
 
+// Reserve disk space for bytes [off, off+len) of an open file
+// in a single transaction, growing the file if needed. Appends
+// into the reserved range then need no block allocation.
+int
+sys_fallocate(void)
+{
+  struct file *f;
+  int off, len, r;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &len) < 0)
+    return -1;
+  if(off < 0 || len <= 0 || f->type != FD_INODE || f->writable == 0)
+    return -1;
+
+  begin_op();
+  ilock(f->ip);
+  r = reservei(f->ip, off, len);
+  iunlock(f->ip);
+  end_op();
+  return r;
+}
+
 int
 sys_fstat(void)
 {
@@ -5,7 +5,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "lockstat.h"
+#include "prof.h"
+#include "rusage.h"
+#include "trace.h"
 
 int
 sys_fork(void)
@@ -37,6 +42,111 @@ sys_kill(void)
   return kill(pid);
 }
 
+int
+sys_setpriority(void)
+{
+  int pid, prio;
+
+  if (argint(0, &pid) < 0 || argint(1, &prio) < 0)
+    return -1;
+  return setpriority(pid, prio);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if (argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_lockstress(void)
+{
+  int kind, n;
+
+  if (argint(0, &kind) < 0 || argint(1, &n) < 0)
+    return -1;
+  return lockstress(kind, n);
+}
+
+// Copy out lock statistics, resetting them if asked to.
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n, reset;
+
+  if (argint(1, &n) < 0 ||
+      argarray(0, (void*)&st, n, sizeof(*st), NLOCKSTAT) < 0 ||
+      argint(2, &reset) < 0)
+    return -1;
+  return lockstatread(st, n, reset);
+}
+
+// Start or stop the profiler.
+int
+sys_profctl(void)
+{
+  int rate;
+
+  if(argint(0, &rate) < 0)
+    return -1;
+  return profctl(rate);
+}
+
+// Copy out profiler samples.
+int
+sys_profread(void)
+{
+  struct profsample *s;
+  int n;
+
+  if(argint(1, &n) < 0 ||
+     argarray(0, (void*)&s, n, sizeof(*s), NCPU*NPROF) < 0)
+    return -1;
+  return profread(s, n);
+}
+
+// Copy out resource usage of one process or all of them.
+int
+sys_getrusage(void)
+{
+  struct rusage *ru;
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(2, &n) < 0 ||
+     argarray(1, (void*)&ru, n, sizeof(*ru), NPROC) < 0)
+    return -1;
+  return getrusage(pid, ru, n);
+}
+
+// Turn event tracing on or off.
+int
+sys_tracectl(void)
+{
+  int on;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  return tracectl(on);
+}
+
+// Copy out trace events.
+int
+sys_traceread(void)
+{
+  struct traceev *ev;
+  int n;
+
+  if(argint(1, &n) < 0 ||
+     argarray(0, (void*)&ev, n, sizeof(*ev), NCPU*NTRACE) < 0)
+    return -1;
+  return traceread(ev, n);
+}
+
 int
 sys_getpid(void)
 {
@@ -67,28 +177,29 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if (argint(0, &n) < 0)
     return -1;
+  if (n <= 0)
+    return 0;
+  // Wakes when the timer queue says so; see timer.c.
+  return sleepticks(n);
+}
 
-  acquire(&tickslock);
-
-  ticks0 = ticks; // Get the current val of ticks
-  while (ticks - ticks0 < n) { // Loop until elaped ticks is >= to n
-    if (myproc()->killed) {
-      release(&tickslock);
-      return -1;
-    } 
-    // will release and reacquire the lock so sleeping process doesn't hog the lock
-    sleep(&ticks, &tickslock);
-  }
+// Sleep for the time in *req, to the resolution of the TSC.
+int
+sys_nanosleep(void)
+{
+  struct timespec *req;
 
-  release(&tickslock);
-  return 0;
+  if (argptr(0, (void*)&req, sizeof(*req)) < 0)
+    return -1;
+  if (req->tv_nsec >= 1000000000)
+    return -1;
+  return sleepns(req->tv_sec, req->tv_nsec);
 }
 
-// return how many clock tick interrupts have occurred
+// return how many clock ticks have passed
 // since start.
 int
 sys_uptime(void)
@@ -96,6 +207,7 @@ sys_uptime(void)
   uint xticks;
 
   acquire(&tickslock);
+  tickupdate();
   xticks = ticks;
   release(&tickslock);
   return xticks;
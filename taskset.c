@@ -0,0 +1,20 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Run a command on the CPUs in mask, bit i standing for CPU i.
+int
+main(int argc, char **argv)
+{
+  if(argc < 3){
+    printf(2, "usage: taskset mask command [arg...]\n");
+    exit();
+  }
+  if(setaffinity(getpid(), atoi(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,330 @@
+// The clock and timer interrupts.
+//
+// The clock is the TSC, calibrated at boot against the LAPIC
+// timer, whose count has always defined the length of a tick.
+// ticks counts whole ticks since boot; it is brought up to date
+// from the TSC whenever someone looks at it, rather than being
+// bumped by an interrupt every tick.
+//
+// Processes sleeping for a while (sys_sleep, sys_nanosleep) put a
+// struct timer on the timer queue, sorted by the TSC value they
+// want to wake at, and a timer interrupt wakes each sleeper whose
+// time has come and nobody else. For sleeps given in real time,
+// the TSC is also calibrated against the PIT, whose frequency is
+// fixed.
+//
+// Each CPU runs its LAPIC timer in one-shot mode, armed for the
+// next time it has something to do: the end of the running
+// process's time slice, if another process is waiting for the
+// CPU, or the first timer on the queue. An idle CPU, or one
+// running a lone CPU-bound process, takes no timer interrupts at
+// all unless a sleeper is due. While the profiler is on, the
+// timer is periodic instead.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "vdso.h"
+
+#define MAXIDLE 100     // most ticks a CPU's timer is armed for
+#define PITHZ 1193182   // PIT input clock
+#define NEVER (~(uint64)0)
+
+// A sleeping process's place on the timer queue.
+struct timer {
+  uint64 when;          // TSC value to wake at
+  struct timer *next;
+  int pending;          // Still on the queue
+};
+
+struct spinlock tickslock;
+uint ticks;
+
+static uint tickcycles;  // TSC cycles per tick
+static uint tsckhz;      // TSC cycles per millisecond
+static uint64 tsc0;      // TSC at boot
+
+// The timer queue. The scheduler arms timers with other locks
+// held, so the first deadline is also kept in next, which
+// timerarm() reads without tq.lock: seq is odd while next is
+// being changed, so a reader can spot a torn read and retry.
+static struct {
+  struct spinlock lock;
+  struct timer *head;
+  volatile uint seq;
+  volatile uint64 next;
+} tq;
+
+// Count TSC cycles while the PIT counts down 10ms.
+static uint
+pitcalibrate(void)
+{
+  uint64 t0;
+  uint latch = PITHZ / 100;
+
+  outb(0x61, (inb(0x61) & ~0x02) | 0x01);  // gate channel 2 on, speaker off
+  outb(0x43, 0xB0);                        // channel 2, mode 0, 16 bits
+  outb(0x42, latch & 0xFF);
+  outb(0x42, latch >> 8);
+  t0 = rdtsc();
+  while((inb(0x61) & 0x20) == 0)           // until channel 2 reaches 0
+    ;
+  return divl(rdtsc() - t0, 10);
+}
+
+void
+timerinit(void)
+{
+  initlock(&tickslock, "time");
+  initlock(&tq.lock, "timerq");
+  tq.next = NEVER;
+  tickcycles = lapiccalibrate();
+  tsckhz = pitcalibrate();
+  tsc0 = rdtsc();
+  if(tickcycles == 0 || tsckhz == 0)
+    panic("timerinit");
+}
+
+// Fill in the clock in a process's vdso page.
+void
+timervdso(struct vdso *v)
+{
+  v->tickcycles = tickcycles;
+  v->tsckhz = tsckhz;
+  v->tsc0 = tsc0;
+}
+
+// TSC cycles in sec seconds and nsec nanoseconds, or NEVER if
+// that is more than 64 bits can count. Whole milliseconds are
+// converted apart from the rest, so that divl()'s quotient stays
+// under tsckhz and can't overflow on a fast TSC.
+static uint64
+nstocycles(uint sec, uint nsec)
+{
+  uint64 ms, hi, c, d;
+
+  ms = (uint64)sec * 1000 + nsec / 1000000;
+  hi = (ms >> 32) * tsckhz;
+  if(hi >> 32)
+    return NEVER;
+  c = (hi << 32) + (uint)ms * (uint64)tsckhz;
+  d = divl((uint64)(nsec % 1000000) * tsckhz, 1000000);
+  if(c < (hi << 32) || c + d < c)
+    return NEVER;
+  return c + d;
+}
+
+// Ticks since boot, by the clock.
+static uint
+clockticks(void)
+{
+  return divl(rdtsc() - tsc0, tickcycles);
+}
+
+// Bring ticks up to date with the clock, boosting MLFQ
+// priorities when it passes a multiple of BOOSTTICKS.
+// Caller must hold tickslock.
+void
+tickupdate(void)
+{
+  uint now;
+
+  now = clockticks();
+  if(now == ticks)
+    return;
+  if(now / BOOSTTICKS != ticks / BOOSTTICKS)
+    boost();
+  ticks = now;
+}
+
+// Bring ticks up to date, if it isn't, and return it.
+uint
+readticks(void)
+{
+  if(clockticks() != ticks){  // unlocked peek
+    acquire(&tickslock);
+    tickupdate();
+    release(&tickslock);
+  }
+  return ticks;
+}
+
+// Publish the queue's first deadline. Caller must hold tq.lock.
+static void
+tqsetnext(void)
+{
+  tq.seq++;
+  __sync_synchronize();
+  tq.next = tq.head ? tq.head->when : NEVER;
+  __sync_synchronize();
+  tq.seq++;
+}
+
+// The queue's first deadline, read without tq.lock.
+static uint64
+tqpeek(void)
+{
+  uint seq;
+  uint64 next;
+
+  do {
+    seq = tq.seq;
+    __sync_synchronize();
+    next = tq.next;
+    __sync_synchronize();
+  } while((seq & 1) || seq != tq.seq);
+  return next;
+}
+
+// Sleep until the TSC reaches when.
+// Returns -1 if killed first, otherwise 0.
+int
+sleepuntil(uint64 when)
+{
+  struct timer t, **pp;
+
+  if(rdtsc() >= when)
+    return 0;
+  t.when = when;
+  t.pending = 1;
+  acquire(&tq.lock);
+  for(pp = &tq.head; *pp && (*pp)->when <= when; pp = &(*pp)->next)
+    ;
+  t.next = *pp;
+  *pp = &t;
+  if(tq.head == &t)
+    tqsetnext();
+
+  // The scheduler arms this CPU's timer for t, if need be, when
+  // it looks for something else to run.
+  while(t.pending){
+    if(myproc()->killed){
+      for(pp = &tq.head; *pp != &t; pp = &(*pp)->next)
+        ;
+      *pp = t.next;
+      tqsetnext();
+      release(&tq.lock);
+      return -1;
+    }
+    sleep(&t, &tq.lock);
+  }
+  release(&tq.lock);
+  return 0;
+}
+
+// Sleep until n ticks after the start of the current one.
+int
+sleepticks(uint n)
+{
+  uint t0;
+
+  acquire(&tickslock);
+  tickupdate();
+  t0 = ticks;
+  release(&tickslock);
+  return sleepuntil(tsc0 + ((uint64)t0 + n) * tickcycles);
+}
+
+// Sleep for sec seconds and nsec nanoseconds. A sleep too long
+// for the TSC to count to lasts until the process is killed.
+int
+sleepns(uint sec, uint nsec)
+{
+  uint64 now, d;
+
+  now = rdtsc();
+  d = nstocycles(sec, nsec);
+  return sleepuntil(d > NEVER - now ? NEVER : now + d);
+}
+
+// Wake the sleepers whose time has come. wakeup() is called after
+// tq.lock is released, by which time a killed sleeper may have
+// gone; that at worst wakes something else sleeping on the same
+// address for no reason, which sleep() callers must allow for.
+static void
+tqexpire(void)
+{
+  struct timer *t;
+
+  for(;;){
+    acquire(&tq.lock);
+    if((t = tq.head) == 0 || t->when > rdtsc()){
+      release(&tq.lock);
+      return;
+    }
+    tq.head = t->next;
+    t->pending = 0;
+    tqsetnext();
+    release(&tq.lock);
+    wakeup(t);
+  }
+}
+
+// Handle a timer interrupt. Charges the ticks since this CPU last
+// looked to the process running on it, and returns how many
+// there were.
+int
+timerintr(struct trapframe *tf)
+{
+  struct cpu *c = mycpu();
+  struct proc *p = myproc();
+  uint now;
+  int n;
+
+  now = readticks();
+  if(tqpeek() <= rdtsc())
+    tqexpire();
+  n = now - c->lasttick;
+  c->lasttick = now;
+  if(p && n > 0){
+    if((tf->cs&3) == DPL_USER)
+      p->uticks += n;
+    else
+      p->sticks += n;
+  }
+  return n;
+}
+
+// Arm this CPU's timer for the next thing it has to do, at most
+// MAXIDLE ticks away. Interrupts must be off.
+void
+timerarm(void)
+{
+  struct cpu *c = mycpu();
+  uint64 now, when, end;
+  int q;
+
+  if(profiling()){
+    c->unsliced = 0;
+    lapictimer(profiling());
+    return;
+  }
+
+  // Say we're running without a time slice before looking for
+  // waiting processes, so that setrunnable() either sees the
+  // flag and sends an IPI, or queued a process quantum() sees.
+  when = tqpeek();
+  if(c->proc){
+    xchg(&c->unsliced, 1);
+    if((q = quantum()) > 0){
+      c->unsliced = 0;
+      end = tsc0 + (uint64)(c->lasttick + q) * tickcycles;
+      if(end < when)
+        when = end;
+    }
+  }
+  if(when == NEVER && c->proc == 0){
+    lapiconeshot(0);  // idle until an interrupt
+    return;
+  }
+
+  now = rdtsc();
+  if(when > now + (uint64)MAXIDLE * tickcycles)
+    when = now + (uint64)MAXIDLE * tickcycles;
+  lapiconeshot(when > now ? when - now : 1);
+}
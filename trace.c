@@ -0,0 +1,109 @@
+// Kernel event tracing.
+//
+// Tracepoints in the scheduler, sleep and wakeup, the disk driver,
+// the log and the system call path call trace(), which appends an
+// event stamped with rdtsc to the running CPU's ring. A ring is
+// only ever written by its own CPU, with interrupts off, so
+// recording an event takes no lock and never waits. A full ring
+// overwrites its oldest events: the rings hold the most recent
+// history, which is what's wanted when chasing a latency spike.
+//
+// traceread() copies the rings out. Events being written while
+// they're read may come out torn, so ktrace turns tracing off
+// before reading.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "trace.h"
+
+struct tracebuf {
+  struct traceev ev[NTRACE];
+  volatile uint w;  // events written; only this CPU writes it
+  uint r;           // events read, or skipped as overwritten
+};
+
+static struct tracebuf tbuf[NCPU];
+static struct spinlock tracelock;  // serializes readers, protects r
+static int tracing;
+
+void
+traceinit(void)
+{
+  initlock(&tracelock, "trace");
+}
+
+// Record an event on this CPU, if tracing is on.
+void
+trace(int type, uint a0, uint a1)
+{
+  struct tracebuf *tb;
+  struct traceev *e;
+  struct proc *p;
+
+  if(!tracing)
+    return;
+  pushcli();
+  tb = &tbuf[cpuid()];
+  e = &tb->ev[tb->w % NTRACE];
+  e->tsc = rdtsc();
+  e->type = type;
+  e->cpu = cpuid();
+  e->pid = (p = myproc()) ? p->pid : 0;
+  e->a0 = a0;
+  e->a1 = a1;
+  tb->w++;
+  popcli();
+}
+
+// Turn tracing on, forgetting any events not yet read, or off if
+// on is 0. Returns how many events have been overwritten before
+// they could be read.
+int
+tracectl(int on)
+{
+  struct tracebuf *tb;
+  int lost;
+
+  acquire(&tracelock);
+  if(on)
+    tracing = 0;
+  lost = 0;
+  for(tb = tbuf; tb < &tbuf[NCPU]; tb++){
+    if(on)
+      tb->r = tb->w;
+    else if(tb->w - tb->r > NTRACE)
+      lost += tb->w - tb->r - NTRACE;
+  }
+  tracing = on != 0;
+  release(&tracelock);
+  return lost;
+}
+
+// Copy out up to n events, one CPU after another; each CPU's
+// events come out in the order they happened. Returns how many
+// were copied.
+int
+traceread(struct traceev *ev, int n)
+{
+  struct tracebuf *tb;
+  uint w;
+  int i;
+
+  i = 0;
+  acquire(&tracelock);
+  for(tb = tbuf; tb < &tbuf[NCPU] && i < n; tb++){
+    w = tb->w;
+    if(w - tb->r > NTRACE)
+      tb->r = w - NTRACE;
+    while(tb->r != w && i < n)
+      ev[i++] = tb->ev[tb->r++ % NTRACE];
+  }
+  release(&tracelock);
+  return i;
+}
@@ -0,0 +1,20 @@
+// Kernel trace events, as returned by the traceread system call.
+#define TR_SYSCALL     1  // entering a system call; a0: its number
+#define TR_SYSRET      2  // leaving it; a0: its number, a1: return value
+#define TR_RUN         3  // the scheduler switched to the process
+#define TR_SCHED       4  // the process gave up the CPU; a0: new state
+#define TR_SLEEP       5  // a0: chan
+#define TR_WAKEUP      6  // a0: chan, a1: pid of the process woken
+#define TR_DISKREQ     7  // disk request queued; a0: block, a1: 1 if write
+#define TR_DISKDONE    8  // disk request finished; a0: block
+#define TR_COMMIT      9  // log commit starting; a0: blocks logged
+#define TR_COMMITDONE 10  // log commit finished
+
+struct traceev {
+  uint64 tsc;      // When it happened, from rdtsc
+  ushort type;     // TR_...
+  ushort cpu;      // CPU it happened on
+  int pid;         // Process running on that CPU, or 0 if none
+  uint a0;         // Arguments; see above
+  uint a1;
+};
@@ -3,16 +3,16 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
-struct spinlock tickslock;
-uint ticks;
+extern void sysentry(void);  // in trapasm.S
+extern char sysentryflags[];  // in trapasm.S
 
 // Loads all the assembly trap handler functions in vectors into the IDT.
 // The SETGATE() marcor will organize each entry correctly.
@@ -26,8 +26,6 @@ tvinit(void)
 
   // special case for syscall: need to be able to generate from userspace
   SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
-
-  initlock(&tickslock, "time");
 }
 
 // Tells the hardware where to find the IDT
@@ -37,29 +35,51 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Let this CPU take system calls by sysenter, which costs less
+// than an interrupt. switchuvm() points MSR_SYSENTER_ESP at the
+// running process's kernel stack.
+void
+sysenterinit(void)
+{
+  uint edx;
+
+  cpuinfo(1, 0, 0, 0, &edx);
+  if((edx & CPUID_SEP) == 0)
+    panic("sysenterinit: no sysenter");
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+}
+
+// Run a system call. Calls made by sysenter come straight here
+// from sysentry in trapasm.S, which builds the same trap frame an
+// int $T_SYSCALL would have.
+void
+systrap(struct trapframe *tf)
+{
+  if(myproc()->killed)
+    exit();
+  myproc()->tf = tf;
+  syscall();
+  if(myproc()->killed) // for example, if exit() syscall
+    exit();
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 { 
+  int tick = 0;  // ticks since this CPU's last timer interrupt
+
   // Code to handle the case of a syscall
   if (tf->trapno == T_SYSCALL) {
-    if(myproc()->killed)
-      exit();
-    myproc()->tf = tf;
-    syscall();
-    if(myproc()->killed) // for example, if exit() syscall
-      exit();
+    systrap(tf);
     return;
   }
 
   switch (tf->trapno) {
     case T_IRQ0 + IRQ_TIMER: // trap number for timer interrupts
-      if (cpuid() == 0) {
-        acquire(&tickslock);
-        ticks++;
-        wakeup(&ticks);
-        release(&tickslock);
-      }
+      profintr(tf);
+      tick = timerintr(tf);
       // Tells the local interrupt controller that we've read and acknowledged
       // the current interrupt so it can clear it and get ready for more interrupts
       lapiceoi();
@@ -78,6 +98,9 @@ trap(struct trapframe *tf)
       uartintr();
       lapiceoi();
       break;
+    case T_IRQ0 + IRQ_RESCHED: // woken from hlt to look at the run queues
+      lapiceoi();
+      break;
     case T_IRQ0 + 7: // spurious interrupt-no break, FALL THROUGH
     case T_IRQ0 + IRQ_SPURIOUS: // spurious interrupt
       cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -85,6 +108,16 @@ trap(struct trapframe *tf)
       lapiceoi();
       break;
 
+    case T_DEBUG:
+      // sysenter leaves a user-set TF on, so the kernel single-steps
+      // until sysentry resets the flags. Turn it off and carry on.
+      if ((tf->cs&3) == 0 && tf->eip >= (uint)sysentry &&
+          tf->eip <= (uint)sysentryflags) {
+        tf->eflags &= ~FL_TF;
+        break;
+      }
+      // FALL THROUGH
+
     //PAGEBREAK: 13
     default:
       if (myproc() == 0 || (tf->cs&3) == 0) {
@@ -94,6 +127,7 @@ trap(struct trapframe *tf)
         panic("trap");
       }
       // In user space, assume process misbehaved.
+      myproc()->nfault++;
       cprintf("pid %d %s: trap %d err %d on cpu %d "
               "eip 0x%x addr 0x%x--kill proc\n",
               myproc()->pid, myproc()->name, tf->trapno,
@@ -107,11 +141,16 @@ trap(struct trapframe *tf)
   if (myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, once it has
+  // used up its time slice. Otherwise, the timer is one-shot, so
+  // arm it again; see timer.c.
   // If interrupts were on while locks held, would need to check nlock.
-  if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
-    yield();
+  if(tf->trapno == T_IRQ0+IRQ_TIMER || tf->trapno == T_IRQ0+IRQ_RESCHED){
+    if(myproc() && myproc()->state == RUNNING && timeslice(tick))
+      yield();
+    else
+      timerarm();
+  }
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
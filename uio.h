@@ -0,0 +1,5 @@
+// One buffer of a readv() or writev() request.
+struct iovec {
+  void *iov_base;  // Start of buffer
+  int iov_len;     // Length of buffer in bytes
+};
@@ -1,5 +1,11 @@
 struct stat;
 struct rtcdate;
+struct iovec;
+struct lockstat;
+struct profsample;
+struct rusage;
+struct traceev;
+struct timespec;
 
 // system calls
 int fork(void);
@@ -19,15 +25,30 @@ int link(const char*, const char*);
 int mkdir(const char*);
 int chdir(const char*);
 int dup(int);
-int getpid(void);
 char* sbrk(int);
 int sleep(int);
-int uptime(void);
+int fallocate(int, int, int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int readv(int, const struct iovec*, int);
+int writev(int, const struct iovec*, int);
+int splice(int, int, int);
+int setpriority(int, int);
+int setaffinity(int, uint);
+int lockstress(int, int);
+int lockstat(struct lockstat*, int, int);
+int profctl(int);
+int profread(struct profsample*, int);
+int getrusage(int, struct rusage*, int);
+int tracectl(int);
+int traceread(struct traceev*, int);
+int nanosleep(struct timespec*);
 
 // ulib.c
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
+int memcmp(const void*, const void*, uint);
 char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
 void printf(int, const char*, ...);
@@ -37,3 +58,7 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int getpid(void);
+int uptime(void);
+uint64 cycles(void);
+void nanouptime(struct timespec*);
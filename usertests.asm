@@ -0,0 +1,8123 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 b1 5f 00 00       	push   $0x5fb1
+      16:	6a 01                	push   $0x1
+      18:	e8 d3 48 00 00       	call   48f0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 c5 5f 00 00       	push   $0x5fc5
+      26:	e8 9a 46 00 00       	call   46c5 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 fc 67 00 00       	push   $0x67fc
+      39:	6a 01                	push   $0x1
+      3b:	e8 b0 48 00 00       	call   48f0 <printf>
+    exit();
+      40:	e8 08 46 00 00       	call   464d <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 c5 5f 00 00       	push   $0x5fc5
+      51:	e8 6f 46 00 00       	call   46c5 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 3a 46 00 00       	call   4698 <close>
+
+  argptest();
+      5e:	e8 1d 42 00 00       	call   4280 <argptest>
+  createdelete();
+      63:	e8 f8 11 00 00       	call   1260 <createdelete>
+  linkunlink();
+      68:	e8 93 1a 00 00       	call   1b00 <linkunlink>
+  concreate();
+      6d:	e8 8e 17 00 00       	call   1800 <concreate>
+  fourfiles();
+      72:	e8 e9 0f 00 00       	call   1060 <fourfiles>
+  sharedfd();
+      77:	e8 24 0e 00 00       	call   ea0 <sharedfd>
+
+  bigargtest();
+      7c:	e8 bf 3e 00 00       	call   3f40 <bigargtest>
+  bigwrite();
+      81:	e8 9a 23 00 00       	call   2420 <bigwrite>
+  bigargtest();
+      86:	e8 b5 3e 00 00       	call   3f40 <bigargtest>
+  bsstest();
+      8b:	e8 40 3e 00 00       	call   3ed0 <bsstest>
+  sbrktest();
+      90:	e8 3b 39 00 00       	call   39d0 <sbrktest>
+  validatetest();
+      95:	e8 86 3d 00 00       	call   3e20 <validatetest>
+
+  opentest();
+      9a:	e8 81 03 00 00       	call   420 <opentest>
+  writetest();
+      9f:	e8 0c 04 00 00       	call   4b0 <writetest>
+  writetest1();
+      a4:	e8 e7 05 00 00       	call   690 <writetest1>
+  createtest();
+      a9:	e8 b2 07 00 00       	call   860 <createtest>
+
+  openiputtest();
+      ae:	e8 6d 02 00 00       	call   320 <openiputtest>
+  exitiputtest();
+      b3:	e8 68 01 00 00       	call   220 <exitiputtest>
+  iputtest();
+      b8:	e8 83 00 00 00       	call   140 <iputtest>
+
+  mem();
+      bd:	e8 0e 0d 00 00       	call   dd0 <mem>
+  pipe1();
+      c2:	e8 79 09 00 00       	call   a40 <pipe1>
+  preempt();
+      c7:	e8 14 0b 00 00       	call   be0 <preempt>
+  mlfqtest();
+  exitwait();
+      cc:	e8 7f 0c 00 00       	call   d50 <exitwait>
+
+  rmdot();
+      d1:	e8 aa 33 00 00       	call   3480 <rmdot>
+  fourteen();
+      d6:	e8 65 32 00 00       	call   3340 <fourteen>
+  inlinetest();
+      db:	e8 f0 25 00 00       	call   26d0 <inlinetest>
+  fallocatetest();
+      e0:	e8 7b 27 00 00       	call   2860 <fallocatetest>
+  uiovtest();
+      e5:	e8 86 29 00 00       	call   2a70 <uiovtest>
+  splicetest();
+      ea:	e8 71 2c 00 00       	call   2d60 <splicetest>
+  nanosleeptest();
+      ef:	e8 0c 2f 00 00       	call   3000 <nanosleeptest>
+  sysentertest();
+      f4:	e8 b7 30 00 00       	call   31b0 <sysentertest>
+  vdsotest();
+      f9:	e8 22 31 00 00       	call   3220 <vdsotest>
+  bigfile();
+      fe:	e8 fd 23 00 00       	call   2500 <bigfile>
+  subdir();
+     103:	e8 38 1c 00 00       	call   1d40 <subdir>
+  linktest();
+     108:	e8 e3 14 00 00       	call   15f0 <linktest>
+  unlinkread();
+     10d:	e8 4e 13 00 00       	call   1460 <unlinkread>
+  dirfile();
+     112:	e8 e9 34 00 00       	call   3600 <dirfile>
+  iref();
+     117:	e8 e4 36 00 00       	call   3800 <iref>
+  forktest();
+     11c:	e8 ff 37 00 00       	call   3920 <forktest>
+  bigdir(); // slow
+     121:	e8 ea 1a 00 00       	call   1c10 <bigdir>
+
+  uio();
+     126:	e8 e5 40 00 00       	call   4210 <uio>
+
+  exectest();
+     12b:	e8 c0 08 00 00       	call   9f0 <exectest>
+
+  exit();
+     130:	e8 18 45 00 00       	call   464d <exit>
+     135:	66 90                	xchg   %ax,%ax
+     137:	66 90                	xchg   %ax,%ax
+     139:	66 90                	xchg   %ax,%ax
+     13b:	66 90                	xchg   %ax,%ax
+     13d:	66 90                	xchg   %ax,%ax
+     13f:	90                   	nop
+
+00000140 <iputtest>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     146:	68 ac 4c 00 00       	push   $0x4cac
+     14b:	ff 35 58 73 00 00    	push   0x7358
+     151:	e8 9a 47 00 00       	call   48f0 <printf>
+  if(mkdir("iputdir") < 0){
+     156:	c7 04 24 3f 4c 00 00 	movl   $0x4c3f,(%esp)
+     15d:	e8 ae 45 00 00       	call   4710 <mkdir>
+     162:	83 c4 10             	add    $0x10,%esp
+     165:	85 c0                	test   %eax,%eax
+     167:	78 58                	js     1c1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	68 3f 4c 00 00       	push   $0x4c3f
+     171:	e8 a9 45 00 00       	call   471f <chdir>
+     176:	83 c4 10             	add    $0x10,%esp
+     179:	85 c0                	test   %eax,%eax
+     17b:	0f 88 85 00 00 00    	js     206 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     181:	83 ec 0c             	sub    $0xc,%esp
+     184:	68 3c 4c 00 00       	push   $0x4c3c
+     189:	e8 55 45 00 00       	call   46e3 <unlink>
+     18e:	83 c4 10             	add    $0x10,%esp
+     191:	85 c0                	test   %eax,%eax
+     193:	78 5a                	js     1ef <iputtest+0xaf>
+  if(chdir("/") < 0){
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	68 61 4c 00 00       	push   $0x4c61
+     19d:	e8 7d 45 00 00       	call   471f <chdir>
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	78 2f                	js     1d8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1a9:	83 ec 08             	sub    $0x8,%esp
+     1ac:	68 e4 4c 00 00       	push   $0x4ce4
+     1b1:	ff 35 58 73 00 00    	push   0x7358
+     1b7:	e8 34 47 00 00       	call   48f0 <printf>
+}
+     1bc:	83 c4 10             	add    $0x10,%esp
+     1bf:	c9                   	leave
+     1c0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1c1:	50                   	push   %eax
+     1c2:	50                   	push   %eax
+     1c3:	68 18 4c 00 00       	push   $0x4c18
+     1c8:	ff 35 58 73 00 00    	push   0x7358
+     1ce:	e8 1d 47 00 00       	call   48f0 <printf>
+    exit();
+     1d3:	e8 75 44 00 00       	call   464d <exit>
+    printf(stdout, "chdir / failed\n");
+     1d8:	50                   	push   %eax
+     1d9:	50                   	push   %eax
+     1da:	68 63 4c 00 00       	push   $0x4c63
+     1df:	ff 35 58 73 00 00    	push   0x7358
+     1e5:	e8 06 47 00 00       	call   48f0 <printf>
+    exit();
+     1ea:	e8 5e 44 00 00       	call   464d <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1ef:	52                   	push   %edx
+     1f0:	52                   	push   %edx
+     1f1:	68 47 4c 00 00       	push   $0x4c47
+     1f6:	ff 35 58 73 00 00    	push   0x7358
+     1fc:	e8 ef 46 00 00       	call   48f0 <printf>
+    exit();
+     201:	e8 47 44 00 00       	call   464d <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     206:	51                   	push   %ecx
+     207:	51                   	push   %ecx
+     208:	68 26 4c 00 00       	push   $0x4c26
+     20d:	ff 35 58 73 00 00    	push   0x7358
+     213:	e8 d8 46 00 00       	call   48f0 <printf>
+    exit();
+     218:	e8 30 44 00 00       	call   464d <exit>
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <exitiputtest>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     226:	68 73 4c 00 00       	push   $0x4c73
+     22b:	ff 35 58 73 00 00    	push   0x7358
+     231:	e8 ba 46 00 00       	call   48f0 <printf>
+  pid = fork();
+     236:	e8 03 44 00 00       	call   463e <fork>
+  if(pid < 0){
+     23b:	83 c4 10             	add    $0x10,%esp
+     23e:	85 c0                	test   %eax,%eax
+     240:	0f 88 8a 00 00 00    	js     2d0 <exitiputtest+0xb0>
+  if(pid == 0){
+     246:	75 50                	jne    298 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     248:	83 ec 0c             	sub    $0xc,%esp
+     24b:	68 3f 4c 00 00       	push   $0x4c3f
+     250:	e8 bb 44 00 00       	call   4710 <mkdir>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	0f 88 87 00 00 00    	js     2e7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     260:	83 ec 0c             	sub    $0xc,%esp
+     263:	68 3f 4c 00 00       	push   $0x4c3f
+     268:	e8 b2 44 00 00       	call   471f <chdir>
+     26d:	83 c4 10             	add    $0x10,%esp
+     270:	85 c0                	test   %eax,%eax
+     272:	0f 88 86 00 00 00    	js     2fe <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     278:	83 ec 0c             	sub    $0xc,%esp
+     27b:	68 3c 4c 00 00       	push   $0x4c3c
+     280:	e8 5e 44 00 00       	call   46e3 <unlink>
+     285:	83 c4 10             	add    $0x10,%esp
+     288:	85 c0                	test   %eax,%eax
+     28a:	78 2c                	js     2b8 <exitiputtest+0x98>
+    exit();
+     28c:	e8 bc 43 00 00       	call   464d <exit>
+     291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     298:	e8 bf 43 00 00       	call   465c <wait>
+  printf(stdout, "exitiput test ok\n");
+     29d:	83 ec 08             	sub    $0x8,%esp
+     2a0:	68 96 4c 00 00       	push   $0x4c96
+     2a5:	ff 35 58 73 00 00    	push   0x7358
+     2ab:	e8 40 46 00 00       	call   48f0 <printf>
+}
+     2b0:	83 c4 10             	add    $0x10,%esp
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+     2b5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2b8:	83 ec 08             	sub    $0x8,%esp
+     2bb:	68 47 4c 00 00       	push   $0x4c47
+     2c0:	ff 35 58 73 00 00    	push   0x7358
+     2c6:	e8 25 46 00 00       	call   48f0 <printf>
+      exit();
+     2cb:	e8 7d 43 00 00       	call   464d <exit>
+    printf(stdout, "fork failed\n");
+     2d0:	51                   	push   %ecx
+     2d1:	51                   	push   %ecx
+     2d2:	68 04 5f 00 00       	push   $0x5f04
+     2d7:	ff 35 58 73 00 00    	push   0x7358
+     2dd:	e8 0e 46 00 00       	call   48f0 <printf>
+    exit();
+     2e2:	e8 66 43 00 00       	call   464d <exit>
+      printf(stdout, "mkdir failed\n");
+     2e7:	52                   	push   %edx
+     2e8:	52                   	push   %edx
+     2e9:	68 18 4c 00 00       	push   $0x4c18
+     2ee:	ff 35 58 73 00 00    	push   0x7358
+     2f4:	e8 f7 45 00 00       	call   48f0 <printf>
+      exit();
+     2f9:	e8 4f 43 00 00       	call   464d <exit>
+      printf(stdout, "child chdir failed\n");
+     2fe:	50                   	push   %eax
+     2ff:	50                   	push   %eax
+     300:	68 82 4c 00 00       	push   $0x4c82
+     305:	ff 35 58 73 00 00    	push   0x7358
+     30b:	e8 e0 45 00 00       	call   48f0 <printf>
+      exit();
+     310:	e8 38 43 00 00       	call   464d <exit>
+     315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <openiputtest>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     326:	68 a8 4c 00 00       	push   $0x4ca8
+     32b:	ff 35 58 73 00 00    	push   0x7358
+     331:	e8 ba 45 00 00       	call   48f0 <printf>
+  if(mkdir("oidir") < 0){
+     336:	c7 04 24 b7 4c 00 00 	movl   $0x4cb7,(%esp)
+     33d:	e8 ce 43 00 00       	call   4710 <mkdir>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	85 c0                	test   %eax,%eax
+     347:	0f 88 9f 00 00 00    	js     3ec <openiputtest+0xcc>
+  pid = fork();
+     34d:	e8 ec 42 00 00       	call   463e <fork>
+  if(pid < 0){
+     352:	85 c0                	test   %eax,%eax
+     354:	78 7f                	js     3d5 <openiputtest+0xb5>
+  if(pid == 0){
+     356:	75 38                	jne    390 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	6a 02                	push   $0x2
+     35d:	68 b7 4c 00 00       	push   $0x4cb7
+     362:	e8 5e 43 00 00       	call   46c5 <open>
+    if(fd >= 0){
+     367:	83 c4 10             	add    $0x10,%esp
+     36a:	85 c0                	test   %eax,%eax
+     36c:	78 62                	js     3d0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     36e:	83 ec 08             	sub    $0x8,%esp
+     371:	68 e4 5f 00 00       	push   $0x5fe4
+     376:	ff 35 58 73 00 00    	push   0x7358
+     37c:	e8 6f 45 00 00       	call   48f0 <printf>
+      exit();
+     381:	e8 c7 42 00 00       	call   464d <exit>
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	6a 01                	push   $0x1
+     395:	e8 b2 43 00 00       	call   474c <sleep>
+  if(unlink("oidir") != 0){
+     39a:	c7 04 24 b7 4c 00 00 	movl   $0x4cb7,(%esp)
+     3a1:	e8 3d 43 00 00       	call   46e3 <unlink>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	85 c0                	test   %eax,%eax
+     3ab:	75 56                	jne    403 <openiputtest+0xe3>
+  wait();
+     3ad:	e8 aa 42 00 00       	call   465c <wait>
+  printf(stdout, "openiput test ok\n");
+     3b2:	83 ec 08             	sub    $0x8,%esp
+     3b5:	68 e0 4c 00 00       	push   $0x4ce0
+     3ba:	ff 35 58 73 00 00    	push   0x7358
+     3c0:	e8 2b 45 00 00       	call   48f0 <printf>
+}
+     3c5:	83 c4 10             	add    $0x10,%esp
+     3c8:	c9                   	leave
+     3c9:	c3                   	ret
+     3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3d0:	e8 78 42 00 00       	call   464d <exit>
+    printf(stdout, "fork failed\n");
+     3d5:	52                   	push   %edx
+     3d6:	52                   	push   %edx
+     3d7:	68 04 5f 00 00       	push   $0x5f04
+     3dc:	ff 35 58 73 00 00    	push   0x7358
+     3e2:	e8 09 45 00 00       	call   48f0 <printf>
+    exit();
+     3e7:	e8 61 42 00 00       	call   464d <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3ec:	51                   	push   %ecx
+     3ed:	51                   	push   %ecx
+     3ee:	68 bd 4c 00 00       	push   $0x4cbd
+     3f3:	ff 35 58 73 00 00    	push   0x7358
+     3f9:	e8 f2 44 00 00       	call   48f0 <printf>
+    exit();
+     3fe:	e8 4a 42 00 00       	call   464d <exit>
+    printf(stdout, "unlink failed\n");
+     403:	50                   	push   %eax
+     404:	50                   	push   %eax
+     405:	68 d1 4c 00 00       	push   $0x4cd1
+     40a:	ff 35 58 73 00 00    	push   0x7358
+     410:	e8 db 44 00 00       	call   48f0 <printf>
+    exit();
+     415:	e8 33 42 00 00       	call   464d <exit>
+     41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <opentest>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     426:	68 f2 4c 00 00       	push   $0x4cf2
+     42b:	ff 35 58 73 00 00    	push   0x7358
+     431:	e8 ba 44 00 00       	call   48f0 <printf>
+  fd = open("echo", 0);
+     436:	58                   	pop    %eax
+     437:	5a                   	pop    %edx
+     438:	6a 00                	push   $0x0
+     43a:	68 fd 4c 00 00       	push   $0x4cfd
+     43f:	e8 81 42 00 00       	call   46c5 <open>
+  if(fd < 0){
+     444:	83 c4 10             	add    $0x10,%esp
+     447:	85 c0                	test   %eax,%eax
+     449:	78 36                	js     481 <opentest+0x61>
+  close(fd);
+     44b:	83 ec 0c             	sub    $0xc,%esp
+     44e:	50                   	push   %eax
+     44f:	e8 44 42 00 00       	call   4698 <close>
+  fd = open("doesnotexist", 0);
+     454:	5a                   	pop    %edx
+     455:	59                   	pop    %ecx
+     456:	6a 00                	push   $0x0
+     458:	68 15 4d 00 00       	push   $0x4d15
+     45d:	e8 63 42 00 00       	call   46c5 <open>
+  if(fd >= 0){
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	79 2f                	jns    498 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     469:	83 ec 08             	sub    $0x8,%esp
+     46c:	68 40 4d 00 00       	push   $0x4d40
+     471:	ff 35 58 73 00 00    	push   0x7358
+     477:	e8 74 44 00 00       	call   48f0 <printf>
+}
+     47c:	83 c4 10             	add    $0x10,%esp
+     47f:	c9                   	leave
+     480:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     481:	50                   	push   %eax
+     482:	50                   	push   %eax
+     483:	68 02 4d 00 00       	push   $0x4d02
+     488:	ff 35 58 73 00 00    	push   0x7358
+     48e:	e8 5d 44 00 00       	call   48f0 <printf>
+    exit();
+     493:	e8 b5 41 00 00       	call   464d <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     498:	50                   	push   %eax
+     499:	50                   	push   %eax
+     49a:	68 22 4d 00 00       	push   $0x4d22
+     49f:	ff 35 58 73 00 00    	push   0x7358
+     4a5:	e8 46 44 00 00       	call   48f0 <printf>
+    exit();
+     4aa:	e8 9e 41 00 00       	call   464d <exit>
+     4af:	90                   	nop
+
+000004b0 <writetest>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+     4b4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4b5:	83 ec 08             	sub    $0x8,%esp
+     4b8:	68 4e 4d 00 00       	push   $0x4d4e
+     4bd:	ff 35 58 73 00 00    	push   0x7358
+     4c3:	e8 28 44 00 00       	call   48f0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4c8:	58                   	pop    %eax
+     4c9:	5a                   	pop    %edx
+     4ca:	68 02 02 00 00       	push   $0x202
+     4cf:	68 5f 4d 00 00       	push   $0x4d5f
+     4d4:	e8 ec 41 00 00       	call   46c5 <open>
+  if(fd >= 0){
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	85 c0                	test   %eax,%eax
+     4de:	0f 88 88 01 00 00    	js     66c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4e4:	83 ec 08             	sub    $0x8,%esp
+     4e7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4e9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4eb:	68 65 4d 00 00       	push   $0x4d65
+     4f0:	ff 35 58 73 00 00    	push   0x7358
+     4f6:	e8 f5 43 00 00       	call   48f0 <printf>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	6a 0a                	push   $0xa
+     505:	68 9c 4d 00 00       	push   $0x4d9c
+     50a:	56                   	push   %esi
+     50b:	e8 79 41 00 00       	call   4689 <write>
+     510:	83 c4 10             	add    $0x10,%esp
+     513:	83 f8 0a             	cmp    $0xa,%eax
+     516:	0f 85 d9 00 00 00    	jne    5f5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     51c:	83 ec 04             	sub    $0x4,%esp
+     51f:	6a 0a                	push   $0xa
+     521:	68 a7 4d 00 00       	push   $0x4da7
+     526:	56                   	push   %esi
+     527:	e8 5d 41 00 00       	call   4689 <write>
+     52c:	83 c4 10             	add    $0x10,%esp
+     52f:	83 f8 0a             	cmp    $0xa,%eax
+     532:	0f 85 d6 00 00 00    	jne    60e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     538:	83 c3 01             	add    $0x1,%ebx
+     53b:	83 fb 64             	cmp    $0x64,%ebx
+     53e:	75 c0                	jne    500 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     540:	83 ec 08             	sub    $0x8,%esp
+     543:	68 b2 4d 00 00       	push   $0x4db2
+     548:	ff 35 58 73 00 00    	push   0x7358
+     54e:	e8 9d 43 00 00       	call   48f0 <printf>
+  close(fd);
+     553:	89 34 24             	mov    %esi,(%esp)
+     556:	e8 3d 41 00 00       	call   4698 <close>
+  fd = open("small", O_RDONLY);
+     55b:	5b                   	pop    %ebx
+     55c:	5e                   	pop    %esi
+     55d:	6a 00                	push   $0x0
+     55f:	68 5f 4d 00 00       	push   $0x4d5f
+     564:	e8 5c 41 00 00       	call   46c5 <open>
+  if(fd >= 0){
+     569:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     56c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     56e:	85 c0                	test   %eax,%eax
+     570:	0f 88 b1 00 00 00    	js     627 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     576:	83 ec 08             	sub    $0x8,%esp
+     579:	68 bd 4d 00 00       	push   $0x4dbd
+     57e:	ff 35 58 73 00 00    	push   0x7358
+     584:	e8 67 43 00 00       	call   48f0 <printf>
+  i = read(fd, buf, 2000);
+     589:	83 c4 0c             	add    $0xc,%esp
+     58c:	68 d0 07 00 00       	push   $0x7d0
+     591:	68 a0 9a 00 00       	push   $0x9aa0
+     596:	53                   	push   %ebx
+     597:	e8 de 40 00 00       	call   467a <read>
+  if(i == 2000){
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5a4:	0f 85 94 00 00 00    	jne    63e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 f1 4d 00 00       	push   $0x4df1
+     5b2:	ff 35 58 73 00 00    	push   0x7358
+     5b8:	e8 33 43 00 00       	call   48f0 <printf>
+  close(fd);
+     5bd:	89 1c 24             	mov    %ebx,(%esp)
+     5c0:	e8 d3 40 00 00       	call   4698 <close>
+  if(unlink("small") < 0){
+     5c5:	c7 04 24 5f 4d 00 00 	movl   $0x4d5f,(%esp)
+     5cc:	e8 12 41 00 00       	call   46e3 <unlink>
+     5d1:	83 c4 10             	add    $0x10,%esp
+     5d4:	85 c0                	test   %eax,%eax
+     5d6:	78 7d                	js     655 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5d8:	83 ec 08             	sub    $0x8,%esp
+     5db:	68 19 4e 00 00       	push   $0x4e19
+     5e0:	ff 35 58 73 00 00    	push   0x7358
+     5e6:	e8 05 43 00 00       	call   48f0 <printf>
+}
+     5eb:	83 c4 10             	add    $0x10,%esp
+     5ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5f1:	5b                   	pop    %ebx
+     5f2:	5e                   	pop    %esi
+     5f3:	5d                   	pop    %ebp
+     5f4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5f5:	83 ec 04             	sub    $0x4,%esp
+     5f8:	53                   	push   %ebx
+     5f9:	68 08 60 00 00       	push   $0x6008
+     5fe:	ff 35 58 73 00 00    	push   0x7358
+     604:	e8 e7 42 00 00       	call   48f0 <printf>
+      exit();
+     609:	e8 3f 40 00 00       	call   464d <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     60e:	83 ec 04             	sub    $0x4,%esp
+     611:	53                   	push   %ebx
+     612:	68 2c 60 00 00       	push   $0x602c
+     617:	ff 35 58 73 00 00    	push   0x7358
+     61d:	e8 ce 42 00 00       	call   48f0 <printf>
+      exit();
+     622:	e8 26 40 00 00       	call   464d <exit>
+    printf(stdout, "error: open small failed!\n");
+     627:	51                   	push   %ecx
+     628:	51                   	push   %ecx
+     629:	68 d6 4d 00 00       	push   $0x4dd6
+     62e:	ff 35 58 73 00 00    	push   0x7358
+     634:	e8 b7 42 00 00       	call   48f0 <printf>
+    exit();
+     639:	e8 0f 40 00 00       	call   464d <exit>
+    printf(stdout, "read failed\n");
+     63e:	52                   	push   %edx
+     63f:	52                   	push   %edx
+     640:	68 1d 51 00 00       	push   $0x511d
+     645:	ff 35 58 73 00 00    	push   0x7358
+     64b:	e8 a0 42 00 00       	call   48f0 <printf>
+    exit();
+     650:	e8 f8 3f 00 00       	call   464d <exit>
+    printf(stdout, "unlink small failed\n");
+     655:	50                   	push   %eax
+     656:	50                   	push   %eax
+     657:	68 04 4e 00 00       	push   $0x4e04
+     65c:	ff 35 58 73 00 00    	push   0x7358
+     662:	e8 89 42 00 00       	call   48f0 <printf>
+    exit();
+     667:	e8 e1 3f 00 00       	call   464d <exit>
+    printf(stdout, "error: creat small failed!\n");
+     66c:	50                   	push   %eax
+     66d:	50                   	push   %eax
+     66e:	68 80 4d 00 00       	push   $0x4d80
+     673:	ff 35 58 73 00 00    	push   0x7358
+     679:	e8 72 42 00 00       	call   48f0 <printf>
+    exit();
+     67e:	e8 ca 3f 00 00       	call   464d <exit>
+     683:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000690 <writetest1>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     695:	83 ec 08             	sub    $0x8,%esp
+     698:	68 2d 4e 00 00       	push   $0x4e2d
+     69d:	ff 35 58 73 00 00    	push   0x7358
+     6a3:	e8 48 42 00 00       	call   48f0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6a8:	58                   	pop    %eax
+     6a9:	5a                   	pop    %edx
+     6aa:	68 02 02 00 00       	push   $0x202
+     6af:	68 a7 4e 00 00       	push   $0x4ea7
+     6b4:	e8 0c 40 00 00       	call   46c5 <open>
+  if(fd < 0){
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	0f 88 61 01 00 00    	js     825 <writetest1+0x195>
+     6c4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6c6:	31 db                	xor    %ebx,%ebx
+     6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6d0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6d3:	89 1d a0 9a 00 00    	mov    %ebx,0x9aa0
+    if(write(fd, buf, 512) != 512){
+     6d9:	68 00 02 00 00       	push   $0x200
+     6de:	68 a0 9a 00 00       	push   $0x9aa0
+     6e3:	56                   	push   %esi
+     6e4:	e8 a0 3f 00 00       	call   4689 <write>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6f1:	0f 85 b3 00 00 00    	jne    7aa <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6f7:	83 c3 01             	add    $0x1,%ebx
+     6fa:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     700:	75 ce                	jne    6d0 <writetest1+0x40>
+  close(fd);
+     702:	83 ec 0c             	sub    $0xc,%esp
+     705:	56                   	push   %esi
+     706:	e8 8d 3f 00 00       	call   4698 <close>
+  fd = open("big", O_RDONLY);
+     70b:	5b                   	pop    %ebx
+     70c:	5e                   	pop    %esi
+     70d:	6a 00                	push   $0x0
+     70f:	68 a7 4e 00 00       	push   $0x4ea7
+     714:	e8 ac 3f 00 00       	call   46c5 <open>
+  if(fd < 0){
+     719:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     71c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     71e:	85 c0                	test   %eax,%eax
+     720:	0f 88 e8 00 00 00    	js     80e <writetest1+0x17e>
+  n = 0;
+     726:	31 f6                	xor    %esi,%esi
+     728:	eb 1d                	jmp    747 <writetest1+0xb7>
+     72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     730:	3d 00 02 00 00       	cmp    $0x200,%eax
+     735:	0f 85 9f 00 00 00    	jne    7da <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     73b:	a1 a0 9a 00 00       	mov    0x9aa0,%eax
+     740:	39 f0                	cmp    %esi,%eax
+     742:	75 7f                	jne    7c3 <writetest1+0x133>
+    n++;
+     744:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     747:	83 ec 04             	sub    $0x4,%esp
+     74a:	68 00 02 00 00       	push   $0x200
+     74f:	68 a0 9a 00 00       	push   $0x9aa0
+     754:	53                   	push   %ebx
+     755:	e8 20 3f 00 00       	call   467a <read>
+    if(i == 0){
+     75a:	83 c4 10             	add    $0x10,%esp
+     75d:	85 c0                	test   %eax,%eax
+     75f:	75 cf                	jne    730 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     761:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     767:	0f 84 86 00 00 00    	je     7f3 <writetest1+0x163>
+  close(fd);
+     76d:	83 ec 0c             	sub    $0xc,%esp
+     770:	53                   	push   %ebx
+     771:	e8 22 3f 00 00       	call   4698 <close>
+  if(unlink("big") < 0){
+     776:	c7 04 24 a7 4e 00 00 	movl   $0x4ea7,(%esp)
+     77d:	e8 61 3f 00 00       	call   46e3 <unlink>
+     782:	83 c4 10             	add    $0x10,%esp
+     785:	85 c0                	test   %eax,%eax
+     787:	0f 88 af 00 00 00    	js     83c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     78d:	83 ec 08             	sub    $0x8,%esp
+     790:	68 ce 4e 00 00       	push   $0x4ece
+     795:	ff 35 58 73 00 00    	push   0x7358
+     79b:	e8 50 41 00 00       	call   48f0 <printf>
+}
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7a6:	5b                   	pop    %ebx
+     7a7:	5e                   	pop    %esi
+     7a8:	5d                   	pop    %ebp
+     7a9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7aa:	83 ec 04             	sub    $0x4,%esp
+     7ad:	53                   	push   %ebx
+     7ae:	68 57 4e 00 00       	push   $0x4e57
+     7b3:	ff 35 58 73 00 00    	push   0x7358
+     7b9:	e8 32 41 00 00       	call   48f0 <printf>
+      exit();
+     7be:	e8 8a 3e 00 00       	call   464d <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7c3:	50                   	push   %eax
+     7c4:	56                   	push   %esi
+     7c5:	68 50 60 00 00       	push   $0x6050
+     7ca:	ff 35 58 73 00 00    	push   0x7358
+     7d0:	e8 1b 41 00 00       	call   48f0 <printf>
+      exit();
+     7d5:	e8 73 3e 00 00       	call   464d <exit>
+      printf(stdout, "read failed %d\n", i);
+     7da:	83 ec 04             	sub    $0x4,%esp
+     7dd:	50                   	push   %eax
+     7de:	68 ab 4e 00 00       	push   $0x4eab
+     7e3:	ff 35 58 73 00 00    	push   0x7358
+     7e9:	e8 02 41 00 00       	call   48f0 <printf>
+      exit();
+     7ee:	e8 5a 3e 00 00       	call   464d <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7f3:	52                   	push   %edx
+     7f4:	68 8b 00 00 00       	push   $0x8b
+     7f9:	68 8e 4e 00 00       	push   $0x4e8e
+     7fe:	ff 35 58 73 00 00    	push   0x7358
+     804:	e8 e7 40 00 00       	call   48f0 <printf>
+        exit();
+     809:	e8 3f 3e 00 00       	call   464d <exit>
+    printf(stdout, "error: open big failed!\n");
+     80e:	51                   	push   %ecx
+     80f:	51                   	push   %ecx
+     810:	68 75 4e 00 00       	push   $0x4e75
+     815:	ff 35 58 73 00 00    	push   0x7358
+     81b:	e8 d0 40 00 00       	call   48f0 <printf>
+    exit();
+     820:	e8 28 3e 00 00       	call   464d <exit>
+    printf(stdout, "error: creat big failed!\n");
+     825:	50                   	push   %eax
+     826:	50                   	push   %eax
+     827:	68 3d 4e 00 00       	push   $0x4e3d
+     82c:	ff 35 58 73 00 00    	push   0x7358
+     832:	e8 b9 40 00 00       	call   48f0 <printf>
+    exit();
+     837:	e8 11 3e 00 00       	call   464d <exit>
+    printf(stdout, "unlink big failed\n");
+     83c:	50                   	push   %eax
+     83d:	50                   	push   %eax
+     83e:	68 bb 4e 00 00       	push   $0x4ebb
+     843:	ff 35 58 73 00 00    	push   0x7358
+     849:	e8 a2 40 00 00       	call   48f0 <printf>
+    exit();
+     84e:	e8 fa 3d 00 00       	call   464d <exit>
+     853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <createtest>:
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+  name[2] = '\0';
+     864:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     869:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     86c:	68 70 60 00 00       	push   $0x6070
+     871:	ff 35 58 73 00 00    	push   0x7358
+     877:	e8 74 40 00 00       	call   48f0 <printf>
+  name[0] = 'a';
+     87c:	c6 05 90 9a 00 00 61 	movb   $0x61,0x9a90
+  name[2] = '\0';
+     883:	83 c4 10             	add    $0x10,%esp
+     886:	c6 05 92 9a 00 00 00 	movb   $0x0,0x9a92
+  for(i = 0; i < 52; i++){
+     88d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     890:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     893:	88 1d 91 9a 00 00    	mov    %bl,0x9a91
+  for(i = 0; i < 52; i++){
+     899:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     89c:	68 02 02 00 00       	push   $0x202
+     8a1:	68 90 9a 00 00       	push   $0x9a90
+     8a6:	e8 1a 3e 00 00       	call   46c5 <open>
+    close(fd);
+     8ab:	89 04 24             	mov    %eax,(%esp)
+     8ae:	e8 e5 3d 00 00       	call   4698 <close>
+  for(i = 0; i < 52; i++){
+     8b3:	83 c4 10             	add    $0x10,%esp
+     8b6:	80 fb 64             	cmp    $0x64,%bl
+     8b9:	75 d5                	jne    890 <createtest+0x30>
+  name[0] = 'a';
+     8bb:	c6 05 90 9a 00 00 61 	movb   $0x61,0x9a90
+  name[2] = '\0';
+     8c2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8c7:	c6 05 92 9a 00 00 00 	movb   $0x0,0x9a92
+  for(i = 0; i < 52; i++){
+     8ce:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8d0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8d3:	88 1d 91 9a 00 00    	mov    %bl,0x9a91
+  for(i = 0; i < 52; i++){
+     8d9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8dc:	68 90 9a 00 00       	push   $0x9a90
+     8e1:	e8 fd 3d 00 00       	call   46e3 <unlink>
+  for(i = 0; i < 52; i++){
+     8e6:	83 c4 10             	add    $0x10,%esp
+     8e9:	80 fb 64             	cmp    $0x64,%bl
+     8ec:	75 e2                	jne    8d0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8ee:	83 ec 08             	sub    $0x8,%esp
+     8f1:	68 98 60 00 00       	push   $0x6098
+     8f6:	ff 35 58 73 00 00    	push   0x7358
+     8fc:	e8 ef 3f 00 00       	call   48f0 <printf>
+}
+     901:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	c9                   	leave
+     908:	c3                   	ret
+     909:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <dirtest>:
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     916:	68 dc 4e 00 00       	push   $0x4edc
+     91b:	ff 35 58 73 00 00    	push   0x7358
+     921:	e8 ca 3f 00 00       	call   48f0 <printf>
+  if(mkdir("dir0") < 0){
+     926:	c7 04 24 e8 4e 00 00 	movl   $0x4ee8,(%esp)
+     92d:	e8 de 3d 00 00       	call   4710 <mkdir>
+     932:	83 c4 10             	add    $0x10,%esp
+     935:	85 c0                	test   %eax,%eax
+     937:	78 58                	js     991 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     939:	83 ec 0c             	sub    $0xc,%esp
+     93c:	68 e8 4e 00 00       	push   $0x4ee8
+     941:	e8 d9 3d 00 00       	call   471f <chdir>
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	85 c0                	test   %eax,%eax
+     94b:	0f 88 85 00 00 00    	js     9d6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     951:	83 ec 0c             	sub    $0xc,%esp
+     954:	68 8d 54 00 00       	push   $0x548d
+     959:	e8 c1 3d 00 00       	call   471f <chdir>
+     95e:	83 c4 10             	add    $0x10,%esp
+     961:	85 c0                	test   %eax,%eax
+     963:	78 5a                	js     9bf <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     965:	83 ec 0c             	sub    $0xc,%esp
+     968:	68 e8 4e 00 00       	push   $0x4ee8
+     96d:	e8 71 3d 00 00       	call   46e3 <unlink>
+     972:	83 c4 10             	add    $0x10,%esp
+     975:	85 c0                	test   %eax,%eax
+     977:	78 2f                	js     9a8 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 25 4f 00 00       	push   $0x4f25
+     981:	ff 35 58 73 00 00    	push   0x7358
+     987:	e8 64 3f 00 00       	call   48f0 <printf>
+}
+     98c:	83 c4 10             	add    $0x10,%esp
+     98f:	c9                   	leave
+     990:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     991:	50                   	push   %eax
+     992:	50                   	push   %eax
+     993:	68 18 4c 00 00       	push   $0x4c18
+     998:	ff 35 58 73 00 00    	push   0x7358
+     99e:	e8 4d 3f 00 00       	call   48f0 <printf>
+    exit();
+     9a3:	e8 a5 3c 00 00       	call   464d <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     9a8:	50                   	push   %eax
+     9a9:	50                   	push   %eax
+     9aa:	68 11 4f 00 00       	push   $0x4f11
+     9af:	ff 35 58 73 00 00    	push   0x7358
+     9b5:	e8 36 3f 00 00       	call   48f0 <printf>
+    exit();
+     9ba:	e8 8e 3c 00 00       	call   464d <exit>
+    printf(stdout, "chdir .. failed\n");
+     9bf:	52                   	push   %edx
+     9c0:	52                   	push   %edx
+     9c1:	68 00 4f 00 00       	push   $0x4f00
+     9c6:	ff 35 58 73 00 00    	push   0x7358
+     9cc:	e8 1f 3f 00 00       	call   48f0 <printf>
+    exit();
+     9d1:	e8 77 3c 00 00       	call   464d <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9d6:	51                   	push   %ecx
+     9d7:	51                   	push   %ecx
+     9d8:	68 ed 4e 00 00       	push   $0x4eed
+     9dd:	ff 35 58 73 00 00    	push   0x7358
+     9e3:	e8 08 3f 00 00       	call   48f0 <printf>
+    exit();
+     9e8:	e8 60 3c 00 00       	call   464d <exit>
+     9ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009f0 <exectest>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9f6:	68 34 4f 00 00       	push   $0x4f34
+     9fb:	ff 35 58 73 00 00    	push   0x7358
+     a01:	e8 ea 3e 00 00       	call   48f0 <printf>
+  if(exec("echo", echoargv) < 0){
+     a06:	5a                   	pop    %edx
+     a07:	59                   	pop    %ecx
+     a08:	68 5c 73 00 00       	push   $0x735c
+     a0d:	68 fd 4c 00 00       	push   $0x4cfd
+     a12:	e8 9f 3c 00 00       	call   46b6 <exec>
+     a17:	83 c4 10             	add    $0x10,%esp
+     a1a:	85 c0                	test   %eax,%eax
+     a1c:	78 02                	js     a20 <exectest+0x30>
+}
+     a1e:	c9                   	leave
+     a1f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a20:	50                   	push   %eax
+     a21:	50                   	push   %eax
+     a22:	68 3f 4f 00 00       	push   $0x4f3f
+     a27:	ff 35 58 73 00 00    	push   0x7358
+     a2d:	e8 be 3e 00 00       	call   48f0 <printf>
+    exit();
+     a32:	e8 16 3c 00 00       	call   464d <exit>
+     a37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <pipe1>:
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	57                   	push   %edi
+     a44:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a45:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a48:	53                   	push   %ebx
+     a49:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a4c:	50                   	push   %eax
+     a4d:	e8 19 3c 00 00       	call   466b <pipe>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	0f 85 41 01 00 00    	jne    b9e <pipe1+0x15e>
+     a5d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a5f:	e8 da 3b 00 00       	call   463e <fork>
+  if(pid == 0){
+     a64:	85 c0                	test   %eax,%eax
+     a66:	0f 84 92 00 00 00    	je     afe <pipe1+0xbe>
+  } else if(pid > 0){
+     a6c:	0f 8e 3f 01 00 00    	jle    bb1 <pipe1+0x171>
+    close(fds[1]);
+     a72:	83 ec 0c             	sub    $0xc,%esp
+     a75:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a78:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a7a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a7f:	e8 14 3c 00 00       	call   4698 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a84:	83 c4 10             	add    $0x10,%esp
+     a87:	83 ec 04             	sub    $0x4,%esp
+     a8a:	57                   	push   %edi
+     a8b:	68 a0 9a 00 00       	push   $0x9aa0
+     a90:	ff 75 e0             	push   -0x20(%ebp)
+     a93:	e8 e2 3b 00 00       	call   467a <read>
+     a98:	83 c4 10             	add    $0x10,%esp
+     a9b:	89 c1                	mov    %eax,%ecx
+     a9d:	85 c0                	test   %eax,%eax
+     a9f:	0f 8e b8 00 00 00    	jle    b5d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     aa5:	89 f0                	mov    %esi,%eax
+     aa7:	32 05 a0 9a 00 00    	xor    0x9aa0,%al
+     aad:	0f b6 c0             	movzbl %al,%eax
+     ab0:	85 c0                	test   %eax,%eax
+     ab2:	75 30                	jne    ae4 <pipe1+0xa4>
+     ab4:	83 c6 01             	add    $0x1,%esi
+     ab7:	eb 0f                	jmp    ac8 <pipe1+0x88>
+     ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ac0:	38 90 a0 9a 00 00    	cmp    %dl,0x9aa0(%eax)
+     ac6:	75 1c                	jne    ae4 <pipe1+0xa4>
+     ac8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     acb:	83 c0 01             	add    $0x1,%eax
+     ace:	39 c1                	cmp    %eax,%ecx
+     ad0:	75 ee                	jne    ac0 <pipe1+0x80>
+      cc = cc * 2;
+     ad2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ad4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ad9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     adb:	89 d6                	mov    %edx,%esi
+     add:	39 c7                	cmp    %eax,%edi
+     adf:	0f 4f f8             	cmovg  %eax,%edi
+     ae2:	eb a3                	jmp    a87 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ae4:	83 ec 08             	sub    $0x8,%esp
+     ae7:	68 6e 4f 00 00       	push   $0x4f6e
+     aec:	6a 01                	push   $0x1
+     aee:	e8 fd 3d 00 00       	call   48f0 <printf>
+     af3:	83 c4 10             	add    $0x10,%esp
+}
+     af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     af9:	5b                   	pop    %ebx
+     afa:	5e                   	pop    %esi
+     afb:	5f                   	pop    %edi
+     afc:	5d                   	pop    %ebp
+     afd:	c3                   	ret
+    close(fds[0]);
+     afe:	83 ec 0c             	sub    $0xc,%esp
+     b01:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b04:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b06:	e8 8d 3b 00 00       	call   4698 <close>
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b10:	31 c0                	xor    %eax,%eax
+     b12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b18:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b1b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b1e:	88 90 9f 9a 00 00    	mov    %dl,0x9a9f(%eax)
+      for(i = 0; i < 1033; i++)
+     b24:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b29:	75 ed                	jne    b18 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b2b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b2e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b34:	68 09 04 00 00       	push   $0x409
+     b39:	68 a0 9a 00 00       	push   $0x9aa0
+     b3e:	ff 75 e4             	push   -0x1c(%ebp)
+     b41:	e8 43 3b 00 00       	call   4689 <write>
+     b46:	83 c4 10             	add    $0x10,%esp
+     b49:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b4e:	75 74                	jne    bc4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b50:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b56:	75 b8                	jne    b10 <pipe1+0xd0>
+    exit();
+     b58:	e8 f0 3a 00 00       	call   464d <exit>
+    if(total != 5 * 1033){
+     b5d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b63:	75 26                	jne    b8b <pipe1+0x14b>
+    close(fds[0]);
+     b65:	83 ec 0c             	sub    $0xc,%esp
+     b68:	ff 75 e0             	push   -0x20(%ebp)
+     b6b:	e8 28 3b 00 00       	call   4698 <close>
+    wait();
+     b70:	e8 e7 3a 00 00       	call   465c <wait>
+  printf(1, "pipe1 ok\n");
+     b75:	5a                   	pop    %edx
+     b76:	59                   	pop    %ecx
+     b77:	68 93 4f 00 00       	push   $0x4f93
+     b7c:	6a 01                	push   $0x1
+     b7e:	e8 6d 3d 00 00       	call   48f0 <printf>
+     b83:	83 c4 10             	add    $0x10,%esp
+     b86:	e9 6b ff ff ff       	jmp    af6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b8b:	56                   	push   %esi
+     b8c:	53                   	push   %ebx
+     b8d:	68 7c 4f 00 00       	push   $0x4f7c
+     b92:	6a 01                	push   $0x1
+     b94:	e8 57 3d 00 00       	call   48f0 <printf>
+      exit();
+     b99:	e8 af 3a 00 00       	call   464d <exit>
+    printf(1, "pipe() failed\n");
+     b9e:	50                   	push   %eax
+     b9f:	50                   	push   %eax
+     ba0:	68 51 4f 00 00       	push   $0x4f51
+     ba5:	6a 01                	push   $0x1
+     ba7:	e8 44 3d 00 00       	call   48f0 <printf>
+    exit();
+     bac:	e8 9c 3a 00 00       	call   464d <exit>
+    printf(1, "fork() failed\n");
+     bb1:	50                   	push   %eax
+     bb2:	50                   	push   %eax
+     bb3:	68 9d 4f 00 00       	push   $0x4f9d
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 31 3d 00 00       	call   48f0 <printf>
+    exit();
+     bbf:	e8 89 3a 00 00       	call   464d <exit>
+        printf(1, "pipe1 oops 1\n");
+     bc4:	57                   	push   %edi
+     bc5:	57                   	push   %edi
+     bc6:	68 60 4f 00 00       	push   $0x4f60
+     bcb:	6a 01                	push   $0x1
+     bcd:	e8 1e 3d 00 00       	call   48f0 <printf>
+        exit();
+     bd2:	e8 76 3a 00 00       	call   464d <exit>
+     bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <preempt>:
+{
+     be0:	55                   	push   %ebp
+     be1:	89 e5                	mov    %esp,%ebp
+     be3:	57                   	push   %edi
+     be4:	56                   	push   %esi
+     be5:	53                   	push   %ebx
+     be6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     be9:	68 ac 4f 00 00       	push   $0x4fac
+     bee:	6a 01                	push   $0x1
+     bf0:	e8 fb 3c 00 00       	call   48f0 <printf>
+  pid1 = fork();
+     bf5:	e8 44 3a 00 00       	call   463e <fork>
+  if(pid1 == 0)
+     bfa:	83 c4 10             	add    $0x10,%esp
+     bfd:	85 c0                	test   %eax,%eax
+     bff:	75 07                	jne    c08 <preempt+0x28>
+    for(;;)
+     c01:	eb fe                	jmp    c01 <preempt+0x21>
+     c03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c07:	90                   	nop
+     c08:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     c0a:	e8 2f 3a 00 00       	call   463e <fork>
+     c0f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c11:	85 c0                	test   %eax,%eax
+     c13:	75 0b                	jne    c20 <preempt+0x40>
+    for(;;)
+     c15:	eb fe                	jmp    c15 <preempt+0x35>
+     c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c1e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c20:	83 ec 0c             	sub    $0xc,%esp
+     c23:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c26:	50                   	push   %eax
+     c27:	e8 3f 3a 00 00       	call   466b <pipe>
+  pid3 = fork();
+     c2c:	e8 0d 3a 00 00       	call   463e <fork>
+  if(pid3 == 0){
+     c31:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c34:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c36:	85 c0                	test   %eax,%eax
+     c38:	75 3e                	jne    c78 <preempt+0x98>
+    close(pfds[0]);
+     c3a:	83 ec 0c             	sub    $0xc,%esp
+     c3d:	ff 75 e0             	push   -0x20(%ebp)
+     c40:	e8 53 3a 00 00       	call   4698 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c45:	83 c4 0c             	add    $0xc,%esp
+     c48:	6a 01                	push   $0x1
+     c4a:	68 71 55 00 00       	push   $0x5571
+     c4f:	ff 75 e4             	push   -0x1c(%ebp)
+     c52:	e8 32 3a 00 00       	call   4689 <write>
+     c57:	83 c4 10             	add    $0x10,%esp
+     c5a:	83 f8 01             	cmp    $0x1,%eax
+     c5d:	0f 85 b8 00 00 00    	jne    d1b <preempt+0x13b>
+    close(pfds[1]);
+     c63:	83 ec 0c             	sub    $0xc,%esp
+     c66:	ff 75 e4             	push   -0x1c(%ebp)
+     c69:	e8 2a 3a 00 00       	call   4698 <close>
+     c6e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c71:	eb fe                	jmp    c71 <preempt+0x91>
+     c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c77:	90                   	nop
+  close(pfds[1]);
+     c78:	83 ec 0c             	sub    $0xc,%esp
+     c7b:	ff 75 e4             	push   -0x1c(%ebp)
+     c7e:	e8 15 3a 00 00       	call   4698 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c83:	83 c4 0c             	add    $0xc,%esp
+     c86:	68 00 20 00 00       	push   $0x2000
+     c8b:	68 a0 9a 00 00       	push   $0x9aa0
+     c90:	ff 75 e0             	push   -0x20(%ebp)
+     c93:	e8 e2 39 00 00       	call   467a <read>
+     c98:	83 c4 10             	add    $0x10,%esp
+     c9b:	83 f8 01             	cmp    $0x1,%eax
+     c9e:	75 67                	jne    d07 <preempt+0x127>
+  close(pfds[0]);
+     ca0:	83 ec 0c             	sub    $0xc,%esp
+     ca3:	ff 75 e0             	push   -0x20(%ebp)
+     ca6:	e8 ed 39 00 00       	call   4698 <close>
+  printf(1, "kill... ");
+     cab:	58                   	pop    %eax
+     cac:	5a                   	pop    %edx
+     cad:	68 dd 4f 00 00       	push   $0x4fdd
+     cb2:	6a 01                	push   $0x1
+     cb4:	e8 37 3c 00 00       	call   48f0 <printf>
+  kill(pid1);
+     cb9:	89 1c 24             	mov    %ebx,(%esp)
+     cbc:	e8 e6 39 00 00       	call   46a7 <kill>
+  kill(pid2);
+     cc1:	89 34 24             	mov    %esi,(%esp)
+     cc4:	e8 de 39 00 00       	call   46a7 <kill>
+  kill(pid3);
+     cc9:	89 3c 24             	mov    %edi,(%esp)
+     ccc:	e8 d6 39 00 00       	call   46a7 <kill>
+  printf(1, "wait... ");
+     cd1:	59                   	pop    %ecx
+     cd2:	5b                   	pop    %ebx
+     cd3:	68 e6 4f 00 00       	push   $0x4fe6
+     cd8:	6a 01                	push   $0x1
+     cda:	e8 11 3c 00 00       	call   48f0 <printf>
+  wait();
+     cdf:	e8 78 39 00 00       	call   465c <wait>
+  wait();
+     ce4:	e8 73 39 00 00       	call   465c <wait>
+  wait();
+     ce9:	e8 6e 39 00 00       	call   465c <wait>
+  printf(1, "preempt ok\n");
+     cee:	5e                   	pop    %esi
+     cef:	5f                   	pop    %edi
+     cf0:	68 ef 4f 00 00       	push   $0x4fef
+     cf5:	6a 01                	push   $0x1
+     cf7:	e8 f4 3b 00 00       	call   48f0 <printf>
+     cfc:	83 c4 10             	add    $0x10,%esp
+}
+     cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d02:	5b                   	pop    %ebx
+     d03:	5e                   	pop    %esi
+     d04:	5f                   	pop    %edi
+     d05:	5d                   	pop    %ebp
+     d06:	c3                   	ret
+    printf(1, "preempt read error");
+     d07:	83 ec 08             	sub    $0x8,%esp
+     d0a:	68 ca 4f 00 00       	push   $0x4fca
+     d0f:	6a 01                	push   $0x1
+     d11:	e8 da 3b 00 00       	call   48f0 <printf>
+     d16:	83 c4 10             	add    $0x10,%esp
+     d19:	eb e4                	jmp    cff <preempt+0x11f>
+      printf(1, "preempt write error");
+     d1b:	83 ec 08             	sub    $0x8,%esp
+     d1e:	68 b6 4f 00 00       	push   $0x4fb6
+     d23:	6a 01                	push   $0x1
+     d25:	e8 c6 3b 00 00       	call   48f0 <printf>
+     d2a:	83 c4 10             	add    $0x10,%esp
+     d2d:	e9 31 ff ff ff       	jmp    c63 <preempt+0x83>
+     d32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d40 <mlfqtest>:
+}
+     d40:	c3                   	ret
+     d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+
+00000d50 <exitwait>:
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	be 64 00 00 00       	mov    $0x64,%esi
+     d59:	53                   	push   %ebx
+     d5a:	eb 14                	jmp    d70 <exitwait+0x20>
+     d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d60:	74 68                	je     dca <exitwait+0x7a>
+      if(wait() != pid){
+     d62:	e8 f5 38 00 00       	call   465c <wait>
+     d67:	39 d8                	cmp    %ebx,%eax
+     d69:	75 2d                	jne    d98 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d6b:	83 ee 01             	sub    $0x1,%esi
+     d6e:	74 41                	je     db1 <exitwait+0x61>
+    pid = fork();
+     d70:	e8 c9 38 00 00       	call   463e <fork>
+     d75:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d77:	85 c0                	test   %eax,%eax
+     d79:	79 e5                	jns    d60 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d7b:	83 ec 08             	sub    $0x8,%esp
+     d7e:	68 04 5f 00 00       	push   $0x5f04
+     d83:	6a 01                	push   $0x1
+     d85:	e8 66 3b 00 00       	call   48f0 <printf>
+      return;
+     d8a:	83 c4 10             	add    $0x10,%esp
+}
+     d8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d90:	5b                   	pop    %ebx
+     d91:	5e                   	pop    %esi
+     d92:	5d                   	pop    %ebp
+     d93:	c3                   	ret
+     d94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d98:	83 ec 08             	sub    $0x8,%esp
+     d9b:	68 fb 4f 00 00       	push   $0x4ffb
+     da0:	6a 01                	push   $0x1
+     da2:	e8 49 3b 00 00       	call   48f0 <printf>
+        return;
+     da7:	83 c4 10             	add    $0x10,%esp
+}
+     daa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dad:	5b                   	pop    %ebx
+     dae:	5e                   	pop    %esi
+     daf:	5d                   	pop    %ebp
+     db0:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     db1:	83 ec 08             	sub    $0x8,%esp
+     db4:	68 0b 50 00 00       	push   $0x500b
+     db9:	6a 01                	push   $0x1
+     dbb:	e8 30 3b 00 00       	call   48f0 <printf>
+     dc0:	83 c4 10             	add    $0x10,%esp
+}
+     dc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dc6:	5b                   	pop    %ebx
+     dc7:	5e                   	pop    %esi
+     dc8:	5d                   	pop    %ebp
+     dc9:	c3                   	ret
+      exit();
+     dca:	e8 7e 38 00 00       	call   464d <exit>
+     dcf:	90                   	nop
+
+00000dd0 <mem>:
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	56                   	push   %esi
+     dd4:	31 f6                	xor    %esi,%esi
+     dd6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     dd7:	83 ec 08             	sub    $0x8,%esp
+     dda:	68 18 50 00 00       	push   $0x5018
+     ddf:	6a 01                	push   $0x1
+     de1:	e8 0a 3b 00 00       	call   48f0 <printf>
+  ppid = getpid();
+     de6:	e8 b5 37 00 00       	call   45a0 <getpid>
+     deb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     ded:	e8 4c 38 00 00       	call   463e <fork>
+     df2:	83 c4 10             	add    $0x10,%esp
+     df5:	85 c0                	test   %eax,%eax
+     df7:	74 0b                	je     e04 <mem+0x34>
+     df9:	e9 8a 00 00 00       	jmp    e88 <mem+0xb8>
+     dfe:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     e00:	89 30                	mov    %esi,(%eax)
+     e02:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     e04:	83 ec 0c             	sub    $0xc,%esp
+     e07:	68 11 27 00 00       	push   $0x2711
+     e0c:	e8 1f 3d 00 00       	call   4b30 <malloc>
+     e11:	83 c4 10             	add    $0x10,%esp
+     e14:	85 c0                	test   %eax,%eax
+     e16:	75 e8                	jne    e00 <mem+0x30>
+    while(m1){
+     e18:	85 f6                	test   %esi,%esi
+     e1a:	74 18                	je     e34 <mem+0x64>
+     e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     e20:	89 f0                	mov    %esi,%eax
+      free(m1);
+     e22:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e25:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     e27:	50                   	push   %eax
+     e28:	e8 73 3c 00 00       	call   4aa0 <free>
+    while(m1){
+     e2d:	83 c4 10             	add    $0x10,%esp
+     e30:	85 f6                	test   %esi,%esi
+     e32:	75 ec                	jne    e20 <mem+0x50>
+    m1 = malloc(1024*20);
+     e34:	83 ec 0c             	sub    $0xc,%esp
+     e37:	68 00 50 00 00       	push   $0x5000
+     e3c:	e8 ef 3c 00 00       	call   4b30 <malloc>
+    if(m1 == 0){
+     e41:	83 c4 10             	add    $0x10,%esp
+     e44:	85 c0                	test   %eax,%eax
+     e46:	74 20                	je     e68 <mem+0x98>
+    free(m1);
+     e48:	83 ec 0c             	sub    $0xc,%esp
+     e4b:	50                   	push   %eax
+     e4c:	e8 4f 3c 00 00       	call   4aa0 <free>
+    printf(1, "mem ok\n");
+     e51:	58                   	pop    %eax
+     e52:	5a                   	pop    %edx
+     e53:	68 3c 50 00 00       	push   $0x503c
+     e58:	6a 01                	push   $0x1
+     e5a:	e8 91 3a 00 00       	call   48f0 <printf>
+    exit();
+     e5f:	e8 e9 37 00 00       	call   464d <exit>
+     e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e68:	83 ec 08             	sub    $0x8,%esp
+     e6b:	68 22 50 00 00       	push   $0x5022
+     e70:	6a 01                	push   $0x1
+     e72:	e8 79 3a 00 00       	call   48f0 <printf>
+      kill(ppid);
+     e77:	89 1c 24             	mov    %ebx,(%esp)
+     e7a:	e8 28 38 00 00       	call   46a7 <kill>
+      exit();
+     e7f:	e8 c9 37 00 00       	call   464d <exit>
+     e84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e88:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e8b:	5b                   	pop    %ebx
+     e8c:	5e                   	pop    %esi
+     e8d:	5d                   	pop    %ebp
+    wait();
+     e8e:	e9 c9 37 00 00       	jmp    465c <wait>
+     e93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ea0 <sharedfd>:
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+     ea3:	57                   	push   %edi
+     ea4:	56                   	push   %esi
+     ea5:	53                   	push   %ebx
+     ea6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     ea9:	68 44 50 00 00       	push   $0x5044
+     eae:	6a 01                	push   $0x1
+     eb0:	e8 3b 3a 00 00       	call   48f0 <printf>
+  unlink("sharedfd");
+     eb5:	c7 04 24 53 50 00 00 	movl   $0x5053,(%esp)
+     ebc:	e8 22 38 00 00       	call   46e3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     ec1:	5b                   	pop    %ebx
+     ec2:	5e                   	pop    %esi
+     ec3:	68 02 02 00 00       	push   $0x202
+     ec8:	68 53 50 00 00       	push   $0x5053
+     ecd:	e8 f3 37 00 00       	call   46c5 <open>
+  if(fd < 0){
+     ed2:	83 c4 10             	add    $0x10,%esp
+     ed5:	85 c0                	test   %eax,%eax
+     ed7:	0f 88 2a 01 00 00    	js     1007 <sharedfd+0x167>
+     edd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     edf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     ee2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     ee7:	e8 52 37 00 00       	call   463e <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     eec:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     eef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ef2:	19 c0                	sbb    %eax,%eax
+     ef4:	83 ec 04             	sub    $0x4,%esp
+     ef7:	83 e0 f3             	and    $0xfffffff3,%eax
+     efa:	6a 0a                	push   $0xa
+     efc:	83 c0 70             	add    $0x70,%eax
+     eff:	50                   	push   %eax
+     f00:	56                   	push   %esi
+     f01:	e8 ca 34 00 00       	call   43d0 <memset>
+     f06:	83 c4 10             	add    $0x10,%esp
+     f09:	eb 0a                	jmp    f15 <sharedfd+0x75>
+     f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     f10:	83 eb 01             	sub    $0x1,%ebx
+     f13:	74 26                	je     f3b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     f15:	83 ec 04             	sub    $0x4,%esp
+     f18:	6a 0a                	push   $0xa
+     f1a:	56                   	push   %esi
+     f1b:	57                   	push   %edi
+     f1c:	e8 68 37 00 00       	call   4689 <write>
+     f21:	83 c4 10             	add    $0x10,%esp
+     f24:	83 f8 0a             	cmp    $0xa,%eax
+     f27:	74 e7                	je     f10 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     f29:	83 ec 08             	sub    $0x8,%esp
+     f2c:	68 ec 60 00 00       	push   $0x60ec
+     f31:	6a 01                	push   $0x1
+     f33:	e8 b8 39 00 00       	call   48f0 <printf>
+      break;
+     f38:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f3b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f3e:	85 c9                	test   %ecx,%ecx
+     f40:	0f 84 f5 00 00 00    	je     103b <sharedfd+0x19b>
+    wait();
+     f46:	e8 11 37 00 00       	call   465c <wait>
+  close(fd);
+     f4b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f4e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f50:	57                   	push   %edi
+     f51:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f54:	e8 3f 37 00 00       	call   4698 <close>
+  fd = open("sharedfd", 0);
+     f59:	58                   	pop    %eax
+     f5a:	5a                   	pop    %edx
+     f5b:	6a 00                	push   $0x0
+     f5d:	68 53 50 00 00       	push   $0x5053
+     f62:	e8 5e 37 00 00       	call   46c5 <open>
+  if(fd < 0){
+     f67:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f6a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f6c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f6f:	85 c0                	test   %eax,%eax
+     f71:	0f 88 aa 00 00 00    	js     1021 <sharedfd+0x181>
+     f77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f80:	83 ec 04             	sub    $0x4,%esp
+     f83:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f86:	6a 0a                	push   $0xa
+     f88:	56                   	push   %esi
+     f89:	ff 75 d0             	push   -0x30(%ebp)
+     f8c:	e8 e9 36 00 00       	call   467a <read>
+     f91:	83 c4 10             	add    $0x10,%esp
+     f94:	85 c0                	test   %eax,%eax
+     f96:	7e 28                	jle    fc0 <sharedfd+0x120>
+     f98:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f9b:	89 f0                	mov    %esi,%eax
+     f9d:	eb 13                	jmp    fb2 <sharedfd+0x112>
+     f9f:	90                   	nop
+        np++;
+     fa0:	80 f9 70             	cmp    $0x70,%cl
+     fa3:	0f 94 c1             	sete   %cl
+     fa6:	0f b6 c9             	movzbl %cl,%ecx
+     fa9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     fab:	83 c0 01             	add    $0x1,%eax
+     fae:	39 f8                	cmp    %edi,%eax
+     fb0:	74 ce                	je     f80 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     fb2:	0f b6 08             	movzbl (%eax),%ecx
+     fb5:	80 f9 63             	cmp    $0x63,%cl
+     fb8:	75 e6                	jne    fa0 <sharedfd+0x100>
+        nc++;
+     fba:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     fbd:	eb ec                	jmp    fab <sharedfd+0x10b>
+     fbf:	90                   	nop
+  close(fd);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	ff 75 d0             	push   -0x30(%ebp)
+     fc6:	e8 cd 36 00 00       	call   4698 <close>
+  unlink("sharedfd");
+     fcb:	c7 04 24 53 50 00 00 	movl   $0x5053,(%esp)
+     fd2:	e8 0c 37 00 00       	call   46e3 <unlink>
+  if(nc == 10000 && np == 10000){
+     fd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     fda:	83 c4 10             	add    $0x10,%esp
+     fdd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fe3:	75 5b                	jne    1040 <sharedfd+0x1a0>
+     fe5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     feb:	75 53                	jne    1040 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fed:	83 ec 08             	sub    $0x8,%esp
+     ff0:	68 5c 50 00 00       	push   $0x505c
+     ff5:	6a 01                	push   $0x1
+     ff7:	e8 f4 38 00 00       	call   48f0 <printf>
+     ffc:	83 c4 10             	add    $0x10,%esp
+}
+     fff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1002:	5b                   	pop    %ebx
+    1003:	5e                   	pop    %esi
+    1004:	5f                   	pop    %edi
+    1005:	5d                   	pop    %ebp
+    1006:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1007:	83 ec 08             	sub    $0x8,%esp
+    100a:	68 c0 60 00 00       	push   $0x60c0
+    100f:	6a 01                	push   $0x1
+    1011:	e8 da 38 00 00       	call   48f0 <printf>
+    return;
+    1016:	83 c4 10             	add    $0x10,%esp
+}
+    1019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    101c:	5b                   	pop    %ebx
+    101d:	5e                   	pop    %esi
+    101e:	5f                   	pop    %edi
+    101f:	5d                   	pop    %ebp
+    1020:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1021:	83 ec 08             	sub    $0x8,%esp
+    1024:	68 0c 61 00 00       	push   $0x610c
+    1029:	6a 01                	push   $0x1
+    102b:	e8 c0 38 00 00       	call   48f0 <printf>
+    return;
+    1030:	83 c4 10             	add    $0x10,%esp
+}
+    1033:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1036:	5b                   	pop    %ebx
+    1037:	5e                   	pop    %esi
+    1038:	5f                   	pop    %edi
+    1039:	5d                   	pop    %ebp
+    103a:	c3                   	ret
+    exit();
+    103b:	e8 0d 36 00 00       	call   464d <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1040:	53                   	push   %ebx
+    1041:	52                   	push   %edx
+    1042:	68 69 50 00 00       	push   $0x5069
+    1047:	6a 01                	push   $0x1
+    1049:	e8 a2 38 00 00       	call   48f0 <printf>
+    exit();
+    104e:	e8 fa 35 00 00       	call   464d <exit>
+    1053:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001060 <fourfiles>:
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1066:	31 db                	xor    %ebx,%ebx
+{
+    1068:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    106b:	c7 45 d8 7e 50 00 00 	movl   $0x507e,-0x28(%ebp)
+    1072:	c7 45 dc c7 51 00 00 	movl   $0x51c7,-0x24(%ebp)
+    1079:	c7 45 e0 cb 51 00 00 	movl   $0x51cb,-0x20(%ebp)
+    1080:	c7 45 e4 81 50 00 00 	movl   $0x5081,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1087:	68 84 50 00 00       	push   $0x5084
+    108c:	6a 01                	push   $0x1
+    108e:	e8 5d 38 00 00       	call   48f0 <printf>
+    1093:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1096:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    109a:	83 ec 0c             	sub    $0xc,%esp
+    109d:	56                   	push   %esi
+    109e:	e8 40 36 00 00       	call   46e3 <unlink>
+    pid = fork();
+    10a3:	e8 96 35 00 00       	call   463e <fork>
+    if(pid < 0){
+    10a8:	83 c4 10             	add    $0x10,%esp
+    10ab:	85 c0                	test   %eax,%eax
+    10ad:	0f 88 65 01 00 00    	js     1218 <fourfiles+0x1b8>
+    if(pid == 0){
+    10b3:	0f 84 eb 00 00 00    	je     11a4 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    10b9:	83 c3 01             	add    $0x1,%ebx
+    10bc:	83 fb 04             	cmp    $0x4,%ebx
+    10bf:	75 d5                	jne    1096 <fourfiles+0x36>
+    wait();
+    10c1:	e8 96 35 00 00       	call   465c <wait>
+  for(i = 0; i < 2; i++){
+    10c6:	31 f6                	xor    %esi,%esi
+    wait();
+    10c8:	e8 8f 35 00 00       	call   465c <wait>
+    10cd:	e8 8a 35 00 00       	call   465c <wait>
+    10d2:	e8 85 35 00 00       	call   465c <wait>
+    fname = names[i];
+    10d7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    10db:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    10de:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10e0:	6a 00                	push   $0x0
+    10e2:	53                   	push   %ebx
+    10e3:	e8 dd 35 00 00       	call   46c5 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10e8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10eb:	83 c4 10             	add    $0x10,%esp
+    10ee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10f8:	83 ec 04             	sub    $0x4,%esp
+    10fb:	68 00 20 00 00       	push   $0x2000
+    1100:	68 a0 9a 00 00       	push   $0x9aa0
+    1105:	ff 75 d4             	push   -0x2c(%ebp)
+    1108:	e8 6d 35 00 00       	call   467a <read>
+    110d:	83 c4 10             	add    $0x10,%esp
+    1110:	89 c3                	mov    %eax,%ebx
+    1112:	85 c0                	test   %eax,%eax
+    1114:	7e 28                	jle    113e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1116:	31 c0                	xor    %eax,%eax
+    1118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    111f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1120:	83 fe 01             	cmp    $0x1,%esi
+    1123:	0f be 88 a0 9a 00 00 	movsbl 0x9aa0(%eax),%ecx
+    112a:	19 d2                	sbb    %edx,%edx
+    112c:	83 c2 31             	add    $0x31,%edx
+    112f:	39 d1                	cmp    %edx,%ecx
+    1131:	75 5d                	jne    1190 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1133:	83 c0 01             	add    $0x1,%eax
+    1136:	39 c3                	cmp    %eax,%ebx
+    1138:	75 e6                	jne    1120 <fourfiles+0xc0>
+      total += n;
+    113a:	01 df                	add    %ebx,%edi
+    113c:	eb ba                	jmp    10f8 <fourfiles+0x98>
+    close(fd);
+    113e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1141:	83 ec 0c             	sub    $0xc,%esp
+    1144:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1147:	51                   	push   %ecx
+    1148:	e8 4b 35 00 00       	call   4698 <close>
+    if(total != 12*500){
+    114d:	83 c4 10             	add    $0x10,%esp
+    1150:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1156:	0f 85 d0 00 00 00    	jne    122c <fourfiles+0x1cc>
+    unlink(fname);
+    115c:	83 ec 0c             	sub    $0xc,%esp
+    115f:	53                   	push   %ebx
+    1160:	e8 7e 35 00 00       	call   46e3 <unlink>
+  for(i = 0; i < 2; i++){
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	85 f6                	test   %esi,%esi
+    116a:	75 0a                	jne    1176 <fourfiles+0x116>
+    116c:	be 01 00 00 00       	mov    $0x1,%esi
+    1171:	e9 61 ff ff ff       	jmp    10d7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1176:	83 ec 08             	sub    $0x8,%esp
+    1179:	68 c2 50 00 00       	push   $0x50c2
+    117e:	6a 01                	push   $0x1
+    1180:	e8 6b 37 00 00       	call   48f0 <printf>
+}
+    1185:	83 c4 10             	add    $0x10,%esp
+    1188:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    118b:	5b                   	pop    %ebx
+    118c:	5e                   	pop    %esi
+    118d:	5f                   	pop    %edi
+    118e:	5d                   	pop    %ebp
+    118f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1190:	83 ec 08             	sub    $0x8,%esp
+    1193:	68 a5 50 00 00       	push   $0x50a5
+    1198:	6a 01                	push   $0x1
+    119a:	e8 51 37 00 00       	call   48f0 <printf>
+          exit();
+    119f:	e8 a9 34 00 00       	call   464d <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    11a4:	83 ec 08             	sub    $0x8,%esp
+    11a7:	68 02 02 00 00       	push   $0x202
+    11ac:	56                   	push   %esi
+    11ad:	e8 13 35 00 00       	call   46c5 <open>
+      if(fd < 0){
+    11b2:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    11b5:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    11b7:	85 c0                	test   %eax,%eax
+    11b9:	78 45                	js     1200 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    11bb:	83 ec 04             	sub    $0x4,%esp
+    11be:	83 c3 30             	add    $0x30,%ebx
+    11c1:	68 00 02 00 00       	push   $0x200
+    11c6:	53                   	push   %ebx
+    11c7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    11cc:	68 a0 9a 00 00       	push   $0x9aa0
+    11d1:	e8 fa 31 00 00       	call   43d0 <memset>
+    11d6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    11d9:	83 ec 04             	sub    $0x4,%esp
+    11dc:	68 f4 01 00 00       	push   $0x1f4
+    11e1:	68 a0 9a 00 00       	push   $0x9aa0
+    11e6:	56                   	push   %esi
+    11e7:	e8 9d 34 00 00       	call   4689 <write>
+    11ec:	83 c4 10             	add    $0x10,%esp
+    11ef:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11f4:	75 49                	jne    123f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11f6:	83 eb 01             	sub    $0x1,%ebx
+    11f9:	75 de                	jne    11d9 <fourfiles+0x179>
+      exit();
+    11fb:	e8 4d 34 00 00       	call   464d <exit>
+        printf(1, "create failed\n");
+    1200:	51                   	push   %ecx
+    1201:	51                   	push   %ecx
+    1202:	68 1f 53 00 00       	push   $0x531f
+    1207:	6a 01                	push   $0x1
+    1209:	e8 e2 36 00 00       	call   48f0 <printf>
+        exit();
+    120e:	e8 3a 34 00 00       	call   464d <exit>
+    1213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1217:	90                   	nop
+      printf(1, "fork failed\n");
+    1218:	83 ec 08             	sub    $0x8,%esp
+    121b:	68 04 5f 00 00       	push   $0x5f04
+    1220:	6a 01                	push   $0x1
+    1222:	e8 c9 36 00 00       	call   48f0 <printf>
+      exit();
+    1227:	e8 21 34 00 00       	call   464d <exit>
+      printf(1, "wrong length %d\n", total);
+    122c:	50                   	push   %eax
+    122d:	57                   	push   %edi
+    122e:	68 b1 50 00 00       	push   $0x50b1
+    1233:	6a 01                	push   $0x1
+    1235:	e8 b6 36 00 00       	call   48f0 <printf>
+      exit();
+    123a:	e8 0e 34 00 00       	call   464d <exit>
+          printf(1, "write failed %d\n", n);
+    123f:	52                   	push   %edx
+    1240:	50                   	push   %eax
+    1241:	68 94 50 00 00       	push   $0x5094
+    1246:	6a 01                	push   $0x1
+    1248:	e8 a3 36 00 00       	call   48f0 <printf>
+          exit();
+    124d:	e8 fb 33 00 00       	call   464d <exit>
+    1252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001260 <createdelete>:
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1265:	31 f6                	xor    %esi,%esi
+{
+    1267:	53                   	push   %ebx
+    1268:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    126b:	68 d0 50 00 00       	push   $0x50d0
+    1270:	6a 01                	push   $0x1
+    1272:	e8 79 36 00 00       	call   48f0 <printf>
+    1277:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    127a:	e8 bf 33 00 00       	call   463e <fork>
+    127f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1281:	85 c0                	test   %eax,%eax
+    1283:	0f 88 ac 01 00 00    	js     1435 <createdelete+0x1d5>
+    if(pid == 0){
+    1289:	0f 84 01 01 00 00    	je     1390 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    128f:	83 c6 01             	add    $0x1,%esi
+    1292:	83 fe 04             	cmp    $0x4,%esi
+    1295:	75 e3                	jne    127a <createdelete+0x1a>
+    wait();
+    1297:	e8 c0 33 00 00       	call   465c <wait>
+  for(i = 0; i < N; i++){
+    129c:	31 ff                	xor    %edi,%edi
+    129e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    12a1:	e8 b6 33 00 00       	call   465c <wait>
+    12a6:	e8 b1 33 00 00       	call   465c <wait>
+    12ab:	e8 ac 33 00 00       	call   465c <wait>
+  name[0] = name[1] = name[2] = 0;
+    12b0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    12b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    12b8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    12ba:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    12bd:	bb 70 00 00 00       	mov    $0x70,%ebx
+    12c2:	0f 94 c2             	sete   %dl
+    12c5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    12c8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    12cb:	0f 9f c0             	setg   %al
+    12ce:	09 c2                	or     %eax,%edx
+    12d0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    12d3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    12d7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    12da:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    12dd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12e0:	6a 00                	push   $0x0
+    12e2:	56                   	push   %esi
+    12e3:	e8 dd 33 00 00       	call   46c5 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12e8:	83 c4 10             	add    $0x10,%esp
+    12eb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12ef:	74 7f                	je     1370 <createdelete+0x110>
+    12f1:	85 c0                	test   %eax,%eax
+    12f3:	0f 88 27 01 00 00    	js     1420 <createdelete+0x1c0>
+        close(fd);
+    12f9:	83 ec 0c             	sub    $0xc,%esp
+    12fc:	50                   	push   %eax
+    12fd:	e8 96 33 00 00       	call   4698 <close>
+    1302:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1305:	83 c3 01             	add    $0x1,%ebx
+    1308:	80 fb 74             	cmp    $0x74,%bl
+    130b:	75 c6                	jne    12d3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    130d:	83 c7 01             	add    $0x1,%edi
+    1310:	83 ff 14             	cmp    $0x14,%edi
+    1313:	75 a3                	jne    12b8 <createdelete+0x58>
+    1315:	bf 70 00 00 00       	mov    $0x70,%edi
+    131a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1320:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1323:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1328:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    132b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    132d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1330:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1333:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1337:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    133a:	56                   	push   %esi
+    133b:	e8 a3 33 00 00       	call   46e3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1340:	83 c4 10             	add    $0x10,%esp
+    1343:	83 eb 01             	sub    $0x1,%ebx
+    1346:	75 e3                	jne    132b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1348:	83 c7 01             	add    $0x1,%edi
+    134b:	89 f8                	mov    %edi,%eax
+    134d:	3c 84                	cmp    $0x84,%al
+    134f:	75 cf                	jne    1320 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1351:	83 ec 08             	sub    $0x8,%esp
+    1354:	68 e3 50 00 00       	push   $0x50e3
+    1359:	6a 01                	push   $0x1
+    135b:	e8 90 35 00 00       	call   48f0 <printf>
+}
+    1360:	83 c4 10             	add    $0x10,%esp
+    1363:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1366:	5b                   	pop    %ebx
+    1367:	5e                   	pop    %esi
+    1368:	5f                   	pop    %edi
+    1369:	5d                   	pop    %ebp
+    136a:	c3                   	ret
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1370:	85 c0                	test   %eax,%eax
+    1372:	78 91                	js     1305 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1374:	50                   	push   %eax
+    1375:	56                   	push   %esi
+    1376:	68 5c 61 00 00       	push   $0x615c
+    137b:	6a 01                	push   $0x1
+    137d:	e8 6e 35 00 00       	call   48f0 <printf>
+        exit();
+    1382:	e8 c6 32 00 00       	call   464d <exit>
+    1387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1390:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1393:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1397:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    139a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    139d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    13a0:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    13a3:	8d 43 30             	lea    0x30(%ebx),%eax
+    13a6:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    13a9:	68 02 02 00 00       	push   $0x202
+    13ae:	56                   	push   %esi
+    13af:	e8 11 33 00 00       	call   46c5 <open>
+        if(fd < 0){
+    13b4:	83 c4 10             	add    $0x10,%esp
+    13b7:	85 c0                	test   %eax,%eax
+    13b9:	0f 88 8a 00 00 00    	js     1449 <createdelete+0x1e9>
+        close(fd);
+    13bf:	83 ec 0c             	sub    $0xc,%esp
+    13c2:	50                   	push   %eax
+    13c3:	e8 d0 32 00 00       	call   4698 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    13c8:	83 c4 10             	add    $0x10,%esp
+    13cb:	85 db                	test   %ebx,%ebx
+    13cd:	74 19                	je     13e8 <createdelete+0x188>
+    13cf:	f6 c3 01             	test   $0x1,%bl
+    13d2:	74 1b                	je     13ef <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    13d4:	83 c3 01             	add    $0x1,%ebx
+    13d7:	83 fb 14             	cmp    $0x14,%ebx
+    13da:	75 c4                	jne    13a0 <createdelete+0x140>
+      exit();
+    13dc:	e8 6c 32 00 00       	call   464d <exit>
+    13e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13e8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13ed:	eb b1                	jmp    13a0 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13ef:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13f1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13f4:	d1 f8                	sar    %eax
+    13f6:	83 c0 30             	add    $0x30,%eax
+    13f9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13fc:	56                   	push   %esi
+    13fd:	e8 e1 32 00 00       	call   46e3 <unlink>
+    1402:	83 c4 10             	add    $0x10,%esp
+    1405:	85 c0                	test   %eax,%eax
+    1407:	79 cb                	jns    13d4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1409:	52                   	push   %edx
+    140a:	52                   	push   %edx
+    140b:	68 d1 4c 00 00       	push   $0x4cd1
+    1410:	6a 01                	push   $0x1
+    1412:	e8 d9 34 00 00       	call   48f0 <printf>
+            exit();
+    1417:	e8 31 32 00 00       	call   464d <exit>
+    141c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1420:	83 ec 04             	sub    $0x4,%esp
+    1423:	56                   	push   %esi
+    1424:	68 38 61 00 00       	push   $0x6138
+    1429:	6a 01                	push   $0x1
+    142b:	e8 c0 34 00 00       	call   48f0 <printf>
+        exit();
+    1430:	e8 18 32 00 00       	call   464d <exit>
+      printf(1, "fork failed\n");
+    1435:	83 ec 08             	sub    $0x8,%esp
+    1438:	68 04 5f 00 00       	push   $0x5f04
+    143d:	6a 01                	push   $0x1
+    143f:	e8 ac 34 00 00       	call   48f0 <printf>
+      exit();
+    1444:	e8 04 32 00 00       	call   464d <exit>
+          printf(1, "create failed\n");
+    1449:	83 ec 08             	sub    $0x8,%esp
+    144c:	68 1f 53 00 00       	push   $0x531f
+    1451:	6a 01                	push   $0x1
+    1453:	e8 98 34 00 00       	call   48f0 <printf>
+          exit();
+    1458:	e8 f0 31 00 00       	call   464d <exit>
+    145d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001460 <unlinkread>:
+{
+    1460:	55                   	push   %ebp
+    1461:	89 e5                	mov    %esp,%ebp
+    1463:	56                   	push   %esi
+    1464:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1465:	83 ec 08             	sub    $0x8,%esp
+    1468:	68 f4 50 00 00       	push   $0x50f4
+    146d:	6a 01                	push   $0x1
+    146f:	e8 7c 34 00 00       	call   48f0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1474:	5b                   	pop    %ebx
+    1475:	5e                   	pop    %esi
+    1476:	68 02 02 00 00       	push   $0x202
+    147b:	68 05 51 00 00       	push   $0x5105
+    1480:	e8 40 32 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1485:	83 c4 10             	add    $0x10,%esp
+    1488:	85 c0                	test   %eax,%eax
+    148a:	0f 88 e6 00 00 00    	js     1576 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1490:	83 ec 04             	sub    $0x4,%esp
+    1493:	89 c3                	mov    %eax,%ebx
+    1495:	6a 05                	push   $0x5
+    1497:	68 2a 51 00 00       	push   $0x512a
+    149c:	50                   	push   %eax
+    149d:	e8 e7 31 00 00       	call   4689 <write>
+  close(fd);
+    14a2:	89 1c 24             	mov    %ebx,(%esp)
+    14a5:	e8 ee 31 00 00       	call   4698 <close>
+  fd = open("unlinkread", O_RDWR);
+    14aa:	58                   	pop    %eax
+    14ab:	5a                   	pop    %edx
+    14ac:	6a 02                	push   $0x2
+    14ae:	68 05 51 00 00       	push   $0x5105
+    14b3:	e8 0d 32 00 00       	call   46c5 <open>
+  if(fd < 0){
+    14b8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    14bb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    14bd:	85 c0                	test   %eax,%eax
+    14bf:	0f 88 10 01 00 00    	js     15d5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    14c5:	83 ec 0c             	sub    $0xc,%esp
+    14c8:	68 05 51 00 00       	push   $0x5105
+    14cd:	e8 11 32 00 00       	call   46e3 <unlink>
+    14d2:	83 c4 10             	add    $0x10,%esp
+    14d5:	85 c0                	test   %eax,%eax
+    14d7:	0f 85 e5 00 00 00    	jne    15c2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14dd:	83 ec 08             	sub    $0x8,%esp
+    14e0:	68 02 02 00 00       	push   $0x202
+    14e5:	68 05 51 00 00       	push   $0x5105
+    14ea:	e8 d6 31 00 00       	call   46c5 <open>
+  write(fd1, "yyy", 3);
+    14ef:	83 c4 0c             	add    $0xc,%esp
+    14f2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14f4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14f6:	68 62 51 00 00       	push   $0x5162
+    14fb:	50                   	push   %eax
+    14fc:	e8 88 31 00 00       	call   4689 <write>
+  close(fd1);
+    1501:	89 34 24             	mov    %esi,(%esp)
+    1504:	e8 8f 31 00 00       	call   4698 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1509:	83 c4 0c             	add    $0xc,%esp
+    150c:	68 00 20 00 00       	push   $0x2000
+    1511:	68 a0 9a 00 00       	push   $0x9aa0
+    1516:	53                   	push   %ebx
+    1517:	e8 5e 31 00 00       	call   467a <read>
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	83 f8 05             	cmp    $0x5,%eax
+    1522:	0f 85 87 00 00 00    	jne    15af <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1528:	80 3d a0 9a 00 00 68 	cmpb   $0x68,0x9aa0
+    152f:	75 6b                	jne    159c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1531:	83 ec 04             	sub    $0x4,%esp
+    1534:	6a 0a                	push   $0xa
+    1536:	68 a0 9a 00 00       	push   $0x9aa0
+    153b:	53                   	push   %ebx
+    153c:	e8 48 31 00 00       	call   4689 <write>
+    1541:	83 c4 10             	add    $0x10,%esp
+    1544:	83 f8 0a             	cmp    $0xa,%eax
+    1547:	75 40                	jne    1589 <unlinkread+0x129>
+  close(fd);
+    1549:	83 ec 0c             	sub    $0xc,%esp
+    154c:	53                   	push   %ebx
+    154d:	e8 46 31 00 00       	call   4698 <close>
+  unlink("unlinkread");
+    1552:	c7 04 24 05 51 00 00 	movl   $0x5105,(%esp)
+    1559:	e8 85 31 00 00       	call   46e3 <unlink>
+  printf(1, "unlinkread ok\n");
+    155e:	58                   	pop    %eax
+    155f:	5a                   	pop    %edx
+    1560:	68 ad 51 00 00       	push   $0x51ad
+    1565:	6a 01                	push   $0x1
+    1567:	e8 84 33 00 00       	call   48f0 <printf>
+}
+    156c:	83 c4 10             	add    $0x10,%esp
+    156f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1572:	5b                   	pop    %ebx
+    1573:	5e                   	pop    %esi
+    1574:	5d                   	pop    %ebp
+    1575:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1576:	51                   	push   %ecx
+    1577:	51                   	push   %ecx
+    1578:	68 10 51 00 00       	push   $0x5110
+    157d:	6a 01                	push   $0x1
+    157f:	e8 6c 33 00 00       	call   48f0 <printf>
+    exit();
+    1584:	e8 c4 30 00 00       	call   464d <exit>
+    printf(1, "unlinkread write failed\n");
+    1589:	51                   	push   %ecx
+    158a:	51                   	push   %ecx
+    158b:	68 94 51 00 00       	push   $0x5194
+    1590:	6a 01                	push   $0x1
+    1592:	e8 59 33 00 00       	call   48f0 <printf>
+    exit();
+    1597:	e8 b1 30 00 00       	call   464d <exit>
+    printf(1, "unlinkread wrong data\n");
+    159c:	53                   	push   %ebx
+    159d:	53                   	push   %ebx
+    159e:	68 7d 51 00 00       	push   $0x517d
+    15a3:	6a 01                	push   $0x1
+    15a5:	e8 46 33 00 00       	call   48f0 <printf>
+    exit();
+    15aa:	e8 9e 30 00 00       	call   464d <exit>
+    printf(1, "unlinkread read failed");
+    15af:	56                   	push   %esi
+    15b0:	56                   	push   %esi
+    15b1:	68 66 51 00 00       	push   $0x5166
+    15b6:	6a 01                	push   $0x1
+    15b8:	e8 33 33 00 00       	call   48f0 <printf>
+    exit();
+    15bd:	e8 8b 30 00 00       	call   464d <exit>
+    printf(1, "unlink unlinkread failed\n");
+    15c2:	50                   	push   %eax
+    15c3:	50                   	push   %eax
+    15c4:	68 48 51 00 00       	push   $0x5148
+    15c9:	6a 01                	push   $0x1
+    15cb:	e8 20 33 00 00       	call   48f0 <printf>
+    exit();
+    15d0:	e8 78 30 00 00       	call   464d <exit>
+    printf(1, "open unlinkread failed\n");
+    15d5:	50                   	push   %eax
+    15d6:	50                   	push   %eax
+    15d7:	68 30 51 00 00       	push   $0x5130
+    15dc:	6a 01                	push   $0x1
+    15de:	e8 0d 33 00 00       	call   48f0 <printf>
+    exit();
+    15e3:	e8 65 30 00 00       	call   464d <exit>
+    15e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ef:	90                   	nop
+
+000015f0 <linktest>:
+{
+    15f0:	55                   	push   %ebp
+    15f1:	89 e5                	mov    %esp,%ebp
+    15f3:	53                   	push   %ebx
+    15f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15f7:	68 bc 51 00 00       	push   $0x51bc
+    15fc:	6a 01                	push   $0x1
+    15fe:	e8 ed 32 00 00       	call   48f0 <printf>
+  unlink("lf1");
+    1603:	c7 04 24 c6 51 00 00 	movl   $0x51c6,(%esp)
+    160a:	e8 d4 30 00 00       	call   46e3 <unlink>
+  unlink("lf2");
+    160f:	c7 04 24 ca 51 00 00 	movl   $0x51ca,(%esp)
+    1616:	e8 c8 30 00 00       	call   46e3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    161b:	58                   	pop    %eax
+    161c:	5a                   	pop    %edx
+    161d:	68 02 02 00 00       	push   $0x202
+    1622:	68 c6 51 00 00       	push   $0x51c6
+    1627:	e8 99 30 00 00       	call   46c5 <open>
+  if(fd < 0){
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	85 c0                	test   %eax,%eax
+    1631:	0f 88 1e 01 00 00    	js     1755 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1637:	83 ec 04             	sub    $0x4,%esp
+    163a:	89 c3                	mov    %eax,%ebx
+    163c:	6a 05                	push   $0x5
+    163e:	68 2a 51 00 00       	push   $0x512a
+    1643:	50                   	push   %eax
+    1644:	e8 40 30 00 00       	call   4689 <write>
+    1649:	83 c4 10             	add    $0x10,%esp
+    164c:	83 f8 05             	cmp    $0x5,%eax
+    164f:	0f 85 98 01 00 00    	jne    17ed <linktest+0x1fd>
+  close(fd);
+    1655:	83 ec 0c             	sub    $0xc,%esp
+    1658:	53                   	push   %ebx
+    1659:	e8 3a 30 00 00       	call   4698 <close>
+  if(link("lf1", "lf2") < 0){
+    165e:	5b                   	pop    %ebx
+    165f:	58                   	pop    %eax
+    1660:	68 ca 51 00 00       	push   $0x51ca
+    1665:	68 c6 51 00 00       	push   $0x51c6
+    166a:	e8 92 30 00 00       	call   4701 <link>
+    166f:	83 c4 10             	add    $0x10,%esp
+    1672:	85 c0                	test   %eax,%eax
+    1674:	0f 88 60 01 00 00    	js     17da <linktest+0x1ea>
+  unlink("lf1");
+    167a:	83 ec 0c             	sub    $0xc,%esp
+    167d:	68 c6 51 00 00       	push   $0x51c6
+    1682:	e8 5c 30 00 00       	call   46e3 <unlink>
+  if(open("lf1", 0) >= 0){
+    1687:	58                   	pop    %eax
+    1688:	5a                   	pop    %edx
+    1689:	6a 00                	push   $0x0
+    168b:	68 c6 51 00 00       	push   $0x51c6
+    1690:	e8 30 30 00 00       	call   46c5 <open>
+    1695:	83 c4 10             	add    $0x10,%esp
+    1698:	85 c0                	test   %eax,%eax
+    169a:	0f 89 27 01 00 00    	jns    17c7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    16a0:	83 ec 08             	sub    $0x8,%esp
+    16a3:	6a 00                	push   $0x0
+    16a5:	68 ca 51 00 00       	push   $0x51ca
+    16aa:	e8 16 30 00 00       	call   46c5 <open>
+  if(fd < 0){
+    16af:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    16b2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    16b4:	85 c0                	test   %eax,%eax
+    16b6:	0f 88 f8 00 00 00    	js     17b4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    16bc:	83 ec 04             	sub    $0x4,%esp
+    16bf:	68 00 20 00 00       	push   $0x2000
+    16c4:	68 a0 9a 00 00       	push   $0x9aa0
+    16c9:	50                   	push   %eax
+    16ca:	e8 ab 2f 00 00       	call   467a <read>
+    16cf:	83 c4 10             	add    $0x10,%esp
+    16d2:	83 f8 05             	cmp    $0x5,%eax
+    16d5:	0f 85 c6 00 00 00    	jne    17a1 <linktest+0x1b1>
+  close(fd);
+    16db:	83 ec 0c             	sub    $0xc,%esp
+    16de:	53                   	push   %ebx
+    16df:	e8 b4 2f 00 00       	call   4698 <close>
+  if(link("lf2", "lf2") >= 0){
+    16e4:	58                   	pop    %eax
+    16e5:	5a                   	pop    %edx
+    16e6:	68 ca 51 00 00       	push   $0x51ca
+    16eb:	68 ca 51 00 00       	push   $0x51ca
+    16f0:	e8 0c 30 00 00       	call   4701 <link>
+    16f5:	83 c4 10             	add    $0x10,%esp
+    16f8:	85 c0                	test   %eax,%eax
+    16fa:	0f 89 8e 00 00 00    	jns    178e <linktest+0x19e>
+  unlink("lf2");
+    1700:	83 ec 0c             	sub    $0xc,%esp
+    1703:	68 ca 51 00 00       	push   $0x51ca
+    1708:	e8 d6 2f 00 00       	call   46e3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    170d:	59                   	pop    %ecx
+    170e:	5b                   	pop    %ebx
+    170f:	68 c6 51 00 00       	push   $0x51c6
+    1714:	68 ca 51 00 00       	push   $0x51ca
+    1719:	e8 e3 2f 00 00       	call   4701 <link>
+    171e:	83 c4 10             	add    $0x10,%esp
+    1721:	85 c0                	test   %eax,%eax
+    1723:	79 56                	jns    177b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1725:	83 ec 08             	sub    $0x8,%esp
+    1728:	68 c6 51 00 00       	push   $0x51c6
+    172d:	68 8e 54 00 00       	push   $0x548e
+    1732:	e8 ca 2f 00 00       	call   4701 <link>
+    1737:	83 c4 10             	add    $0x10,%esp
+    173a:	85 c0                	test   %eax,%eax
+    173c:	79 2a                	jns    1768 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    173e:	83 ec 08             	sub    $0x8,%esp
+    1741:	68 64 52 00 00       	push   $0x5264
+    1746:	6a 01                	push   $0x1
+    1748:	e8 a3 31 00 00       	call   48f0 <printf>
+}
+    174d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1750:	83 c4 10             	add    $0x10,%esp
+    1753:	c9                   	leave
+    1754:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1755:	50                   	push   %eax
+    1756:	50                   	push   %eax
+    1757:	68 ce 51 00 00       	push   $0x51ce
+    175c:	6a 01                	push   $0x1
+    175e:	e8 8d 31 00 00       	call   48f0 <printf>
+    exit();
+    1763:	e8 e5 2e 00 00       	call   464d <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1768:	50                   	push   %eax
+    1769:	50                   	push   %eax
+    176a:	68 48 52 00 00       	push   $0x5248
+    176f:	6a 01                	push   $0x1
+    1771:	e8 7a 31 00 00       	call   48f0 <printf>
+    exit();
+    1776:	e8 d2 2e 00 00       	call   464d <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    177b:	52                   	push   %edx
+    177c:	52                   	push   %edx
+    177d:	68 a4 61 00 00       	push   $0x61a4
+    1782:	6a 01                	push   $0x1
+    1784:	e8 67 31 00 00       	call   48f0 <printf>
+    exit();
+    1789:	e8 bf 2e 00 00       	call   464d <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    178e:	50                   	push   %eax
+    178f:	50                   	push   %eax
+    1790:	68 2a 52 00 00       	push   $0x522a
+    1795:	6a 01                	push   $0x1
+    1797:	e8 54 31 00 00       	call   48f0 <printf>
+    exit();
+    179c:	e8 ac 2e 00 00       	call   464d <exit>
+    printf(1, "read lf2 failed\n");
+    17a1:	51                   	push   %ecx
+    17a2:	51                   	push   %ecx
+    17a3:	68 19 52 00 00       	push   $0x5219
+    17a8:	6a 01                	push   $0x1
+    17aa:	e8 41 31 00 00       	call   48f0 <printf>
+    exit();
+    17af:	e8 99 2e 00 00       	call   464d <exit>
+    printf(1, "open lf2 failed\n");
+    17b4:	53                   	push   %ebx
+    17b5:	53                   	push   %ebx
+    17b6:	68 08 52 00 00       	push   $0x5208
+    17bb:	6a 01                	push   $0x1
+    17bd:	e8 2e 31 00 00       	call   48f0 <printf>
+    exit();
+    17c2:	e8 86 2e 00 00       	call   464d <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    17c7:	50                   	push   %eax
+    17c8:	50                   	push   %eax
+    17c9:	68 7c 61 00 00       	push   $0x617c
+    17ce:	6a 01                	push   $0x1
+    17d0:	e8 1b 31 00 00       	call   48f0 <printf>
+    exit();
+    17d5:	e8 73 2e 00 00       	call   464d <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    17da:	51                   	push   %ecx
+    17db:	51                   	push   %ecx
+    17dc:	68 f3 51 00 00       	push   $0x51f3
+    17e1:	6a 01                	push   $0x1
+    17e3:	e8 08 31 00 00       	call   48f0 <printf>
+    exit();
+    17e8:	e8 60 2e 00 00       	call   464d <exit>
+    printf(1, "write lf1 failed\n");
+    17ed:	50                   	push   %eax
+    17ee:	50                   	push   %eax
+    17ef:	68 e1 51 00 00       	push   $0x51e1
+    17f4:	6a 01                	push   $0x1
+    17f6:	e8 f5 30 00 00       	call   48f0 <printf>
+    exit();
+    17fb:	e8 4d 2e 00 00       	call   464d <exit>
+
+00001800 <concreate>:
+{
+    1800:	55                   	push   %ebp
+    1801:	89 e5                	mov    %esp,%ebp
+    1803:	57                   	push   %edi
+    1804:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1805:	31 f6                	xor    %esi,%esi
+{
+    1807:	53                   	push   %ebx
+    1808:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    180b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    180e:	68 71 52 00 00       	push   $0x5271
+    1813:	6a 01                	push   $0x1
+    1815:	e8 d6 30 00 00       	call   48f0 <printf>
+  file[0] = 'C';
+    181a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    181e:	83 c4 10             	add    $0x10,%esp
+    1821:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1825:	eb 4c                	jmp    1873 <concreate+0x73>
+    1827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    182e:	66 90                	xchg   %ax,%ax
+    1830:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1836:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    183b:	0f 83 8f 00 00 00    	jae    18d0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1841:	83 ec 08             	sub    $0x8,%esp
+    1844:	68 02 02 00 00       	push   $0x202
+    1849:	53                   	push   %ebx
+    184a:	e8 76 2e 00 00       	call   46c5 <open>
+      if(fd < 0){
+    184f:	83 c4 10             	add    $0x10,%esp
+    1852:	85 c0                	test   %eax,%eax
+    1854:	78 63                	js     18b9 <concreate+0xb9>
+      close(fd);
+    1856:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1859:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    185c:	50                   	push   %eax
+    185d:	e8 36 2e 00 00       	call   4698 <close>
+    1862:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1865:	e8 f2 2d 00 00       	call   465c <wait>
+  for(i = 0; i < 40; i++){
+    186a:	83 fe 28             	cmp    $0x28,%esi
+    186d:	0f 84 7f 00 00 00    	je     18f2 <concreate+0xf2>
+    unlink(file);
+    1873:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1876:	8d 46 30             	lea    0x30(%esi),%eax
+    1879:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    187c:	53                   	push   %ebx
+    187d:	e8 61 2e 00 00       	call   46e3 <unlink>
+    pid = fork();
+    1882:	e8 b7 2d 00 00       	call   463e <fork>
+    if(pid && (i % 3) == 1){
+    1887:	83 c4 10             	add    $0x10,%esp
+    188a:	85 c0                	test   %eax,%eax
+    188c:	75 a2                	jne    1830 <concreate+0x30>
+      link("C0", file);
+    188e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1894:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    189a:	0f 83 d0 00 00 00    	jae    1970 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    18a0:	83 ec 08             	sub    $0x8,%esp
+    18a3:	68 02 02 00 00       	push   $0x202
+    18a8:	53                   	push   %ebx
+    18a9:	e8 17 2e 00 00       	call   46c5 <open>
+      if(fd < 0){
+    18ae:	83 c4 10             	add    $0x10,%esp
+    18b1:	85 c0                	test   %eax,%eax
+    18b3:	0f 89 ea 01 00 00    	jns    1aa3 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    18b9:	83 ec 04             	sub    $0x4,%esp
+    18bc:	53                   	push   %ebx
+    18bd:	68 84 52 00 00       	push   $0x5284
+    18c2:	6a 01                	push   $0x1
+    18c4:	e8 27 30 00 00       	call   48f0 <printf>
+        exit();
+    18c9:	e8 7f 2d 00 00       	call   464d <exit>
+    18ce:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    18d0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    18d3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    18d6:	53                   	push   %ebx
+    18d7:	68 81 52 00 00       	push   $0x5281
+    18dc:	e8 20 2e 00 00       	call   4701 <link>
+    18e1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18e4:	e8 73 2d 00 00       	call   465c <wait>
+  for(i = 0; i < 40; i++){
+    18e9:	83 fe 28             	cmp    $0x28,%esi
+    18ec:	0f 85 81 ff ff ff    	jne    1873 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18f2:	83 ec 04             	sub    $0x4,%esp
+    18f5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18f8:	6a 28                	push   $0x28
+    18fa:	6a 00                	push   $0x0
+    18fc:	50                   	push   %eax
+    18fd:	e8 ce 2a 00 00       	call   43d0 <memset>
+  fd = open(".", 0);
+    1902:	5e                   	pop    %esi
+    1903:	5f                   	pop    %edi
+    1904:	6a 00                	push   $0x0
+    1906:	68 8e 54 00 00       	push   $0x548e
+    190b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    190e:	e8 b2 2d 00 00       	call   46c5 <open>
+  n = 0;
+    1913:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    191a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    191d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    191f:	90                   	nop
+    1920:	83 ec 04             	sub    $0x4,%esp
+    1923:	6a 10                	push   $0x10
+    1925:	57                   	push   %edi
+    1926:	56                   	push   %esi
+    1927:	e8 4e 2d 00 00       	call   467a <read>
+    192c:	83 c4 10             	add    $0x10,%esp
+    192f:	85 c0                	test   %eax,%eax
+    1931:	7e 5d                	jle    1990 <concreate+0x190>
+    if(de.inum == 0)
+    1933:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1938:	74 e6                	je     1920 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    193a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    193e:	75 e0                	jne    1920 <concreate+0x120>
+    1940:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1944:	75 da                	jne    1920 <concreate+0x120>
+      i = de.name[1] - '0';
+    1946:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    194a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    194d:	83 f8 27             	cmp    $0x27,%eax
+    1950:	0f 87 5e 01 00 00    	ja     1ab4 <concreate+0x2b4>
+      if(fa[i]){
+    1956:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    195b:	0f 85 7e 01 00 00    	jne    1adf <concreate+0x2df>
+      n++;
+    1961:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1965:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    196a:	eb b4                	jmp    1920 <concreate+0x120>
+    196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1970:	83 ec 08             	sub    $0x8,%esp
+    1973:	53                   	push   %ebx
+    1974:	68 81 52 00 00       	push   $0x5281
+    1979:	e8 83 2d 00 00       	call   4701 <link>
+    197e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1981:	e8 c7 2c 00 00       	call   464d <exit>
+    1986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    198d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1990:	83 ec 0c             	sub    $0xc,%esp
+    1993:	56                   	push   %esi
+    1994:	e8 ff 2c 00 00       	call   4698 <close>
+  if(n != 40){
+    1999:	83 c4 10             	add    $0x10,%esp
+    199c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    19a0:	0f 85 26 01 00 00    	jne    1acc <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    19a6:	31 f6                	xor    %esi,%esi
+    19a8:	eb 48                	jmp    19f2 <concreate+0x1f2>
+    19aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    19b0:	85 ff                	test   %edi,%edi
+    19b2:	74 05                	je     19b9 <concreate+0x1b9>
+    19b4:	83 f8 01             	cmp    $0x1,%eax
+    19b7:	74 68                	je     1a21 <concreate+0x221>
+      unlink(file);
+    19b9:	83 ec 0c             	sub    $0xc,%esp
+    19bc:	53                   	push   %ebx
+    19bd:	e8 21 2d 00 00       	call   46e3 <unlink>
+      unlink(file);
+    19c2:	89 1c 24             	mov    %ebx,(%esp)
+    19c5:	e8 19 2d 00 00       	call   46e3 <unlink>
+      unlink(file);
+    19ca:	89 1c 24             	mov    %ebx,(%esp)
+    19cd:	e8 11 2d 00 00       	call   46e3 <unlink>
+      unlink(file);
+    19d2:	89 1c 24             	mov    %ebx,(%esp)
+    19d5:	e8 09 2d 00 00       	call   46e3 <unlink>
+    19da:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    19dd:	85 ff                	test   %edi,%edi
+    19df:	74 a0                	je     1981 <concreate+0x181>
+      wait();
+    19e1:	e8 76 2c 00 00       	call   465c <wait>
+  for(i = 0; i < 40; i++){
+    19e6:	83 c6 01             	add    $0x1,%esi
+    19e9:	83 fe 28             	cmp    $0x28,%esi
+    19ec:	0f 84 86 00 00 00    	je     1a78 <concreate+0x278>
+    file[1] = '0' + i;
+    19f2:	8d 46 30             	lea    0x30(%esi),%eax
+    19f5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19f8:	e8 41 2c 00 00       	call   463e <fork>
+    19fd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19ff:	85 c0                	test   %eax,%eax
+    1a01:	0f 88 88 00 00 00    	js     1a8f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1a07:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1a0c:	f7 e6                	mul    %esi
+    1a0e:	89 d0                	mov    %edx,%eax
+    1a10:	83 e2 fe             	and    $0xfffffffe,%edx
+    1a13:	d1 e8                	shr    %eax
+    1a15:	01 c2                	add    %eax,%edx
+    1a17:	89 f0                	mov    %esi,%eax
+    1a19:	29 d0                	sub    %edx,%eax
+    1a1b:	89 c1                	mov    %eax,%ecx
+    1a1d:	09 f9                	or     %edi,%ecx
+    1a1f:	75 8f                	jne    19b0 <concreate+0x1b0>
+      close(open(file, 0));
+    1a21:	83 ec 08             	sub    $0x8,%esp
+    1a24:	6a 00                	push   $0x0
+    1a26:	53                   	push   %ebx
+    1a27:	e8 99 2c 00 00       	call   46c5 <open>
+    1a2c:	89 04 24             	mov    %eax,(%esp)
+    1a2f:	e8 64 2c 00 00       	call   4698 <close>
+      close(open(file, 0));
+    1a34:	58                   	pop    %eax
+    1a35:	5a                   	pop    %edx
+    1a36:	6a 00                	push   $0x0
+    1a38:	53                   	push   %ebx
+    1a39:	e8 87 2c 00 00       	call   46c5 <open>
+    1a3e:	89 04 24             	mov    %eax,(%esp)
+    1a41:	e8 52 2c 00 00       	call   4698 <close>
+      close(open(file, 0));
+    1a46:	59                   	pop    %ecx
+    1a47:	58                   	pop    %eax
+    1a48:	6a 00                	push   $0x0
+    1a4a:	53                   	push   %ebx
+    1a4b:	e8 75 2c 00 00       	call   46c5 <open>
+    1a50:	89 04 24             	mov    %eax,(%esp)
+    1a53:	e8 40 2c 00 00       	call   4698 <close>
+      close(open(file, 0));
+    1a58:	58                   	pop    %eax
+    1a59:	5a                   	pop    %edx
+    1a5a:	6a 00                	push   $0x0
+    1a5c:	53                   	push   %ebx
+    1a5d:	e8 63 2c 00 00       	call   46c5 <open>
+    1a62:	89 04 24             	mov    %eax,(%esp)
+    1a65:	e8 2e 2c 00 00       	call   4698 <close>
+    1a6a:	83 c4 10             	add    $0x10,%esp
+    1a6d:	e9 6b ff ff ff       	jmp    19dd <concreate+0x1dd>
+    1a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a78:	83 ec 08             	sub    $0x8,%esp
+    1a7b:	68 d6 52 00 00       	push   $0x52d6
+    1a80:	6a 01                	push   $0x1
+    1a82:	e8 69 2e 00 00       	call   48f0 <printf>
+}
+    1a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a8a:	5b                   	pop    %ebx
+    1a8b:	5e                   	pop    %esi
+    1a8c:	5f                   	pop    %edi
+    1a8d:	5d                   	pop    %ebp
+    1a8e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a8f:	83 ec 08             	sub    $0x8,%esp
+    1a92:	68 04 5f 00 00       	push   $0x5f04
+    1a97:	6a 01                	push   $0x1
+    1a99:	e8 52 2e 00 00       	call   48f0 <printf>
+      exit();
+    1a9e:	e8 aa 2b 00 00       	call   464d <exit>
+      close(fd);
+    1aa3:	83 ec 0c             	sub    $0xc,%esp
+    1aa6:	50                   	push   %eax
+    1aa7:	e8 ec 2b 00 00       	call   4698 <close>
+    1aac:	83 c4 10             	add    $0x10,%esp
+    1aaf:	e9 cd fe ff ff       	jmp    1981 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1ab4:	83 ec 04             	sub    $0x4,%esp
+    1ab7:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1aba:	50                   	push   %eax
+    1abb:	68 a0 52 00 00       	push   $0x52a0
+    1ac0:	6a 01                	push   $0x1
+    1ac2:	e8 29 2e 00 00       	call   48f0 <printf>
+        exit();
+    1ac7:	e8 81 2b 00 00       	call   464d <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1acc:	51                   	push   %ecx
+    1acd:	51                   	push   %ecx
+    1ace:	68 c8 61 00 00       	push   $0x61c8
+    1ad3:	6a 01                	push   $0x1
+    1ad5:	e8 16 2e 00 00       	call   48f0 <printf>
+    exit();
+    1ada:	e8 6e 2b 00 00       	call   464d <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1adf:	83 ec 04             	sub    $0x4,%esp
+    1ae2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ae5:	50                   	push   %eax
+    1ae6:	68 b9 52 00 00       	push   $0x52b9
+    1aeb:	6a 01                	push   $0x1
+    1aed:	e8 fe 2d 00 00       	call   48f0 <printf>
+        exit();
+    1af2:	e8 56 2b 00 00       	call   464d <exit>
+    1af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1afe:	66 90                	xchg   %ax,%ax
+
+00001b00 <linkunlink>:
+{
+    1b00:	55                   	push   %ebp
+    1b01:	89 e5                	mov    %esp,%ebp
+    1b03:	57                   	push   %edi
+    1b04:	56                   	push   %esi
+    1b05:	53                   	push   %ebx
+    1b06:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1b09:	68 e4 52 00 00       	push   $0x52e4
+    1b0e:	6a 01                	push   $0x1
+    1b10:	e8 db 2d 00 00       	call   48f0 <printf>
+  unlink("x");
+    1b15:	c7 04 24 71 55 00 00 	movl   $0x5571,(%esp)
+    1b1c:	e8 c2 2b 00 00       	call   46e3 <unlink>
+  pid = fork();
+    1b21:	e8 18 2b 00 00       	call   463e <fork>
+  if(pid < 0){
+    1b26:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1b29:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1b2c:	85 c0                	test   %eax,%eax
+    1b2e:	0f 88 b6 00 00 00    	js     1bea <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b34:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b38:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b3d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b42:	19 ff                	sbb    %edi,%edi
+    1b44:	83 e7 60             	and    $0x60,%edi
+    1b47:	83 c7 01             	add    $0x1,%edi
+    1b4a:	eb 1e                	jmp    1b6a <linkunlink+0x6a>
+    1b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b50:	83 f8 01             	cmp    $0x1,%eax
+    1b53:	74 7b                	je     1bd0 <linkunlink+0xd0>
+      unlink("x");
+    1b55:	83 ec 0c             	sub    $0xc,%esp
+    1b58:	68 71 55 00 00       	push   $0x5571
+    1b5d:	e8 81 2b 00 00       	call   46e3 <unlink>
+    1b62:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b65:	83 eb 01             	sub    $0x1,%ebx
+    1b68:	74 41                	je     1bab <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b6a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b70:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b76:	89 f8                	mov    %edi,%eax
+    1b78:	f7 e6                	mul    %esi
+    1b7a:	89 d0                	mov    %edx,%eax
+    1b7c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b7f:	d1 e8                	shr    %eax
+    1b81:	01 c2                	add    %eax,%edx
+    1b83:	89 f8                	mov    %edi,%eax
+    1b85:	29 d0                	sub    %edx,%eax
+    1b87:	75 c7                	jne    1b50 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b89:	83 ec 08             	sub    $0x8,%esp
+    1b8c:	68 02 02 00 00       	push   $0x202
+    1b91:	68 71 55 00 00       	push   $0x5571
+    1b96:	e8 2a 2b 00 00       	call   46c5 <open>
+    1b9b:	89 04 24             	mov    %eax,(%esp)
+    1b9e:	e8 f5 2a 00 00       	call   4698 <close>
+    1ba3:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1ba6:	83 eb 01             	sub    $0x1,%ebx
+    1ba9:	75 bf                	jne    1b6a <linkunlink+0x6a>
+  if(pid)
+    1bab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bae:	85 c0                	test   %eax,%eax
+    1bb0:	74 4b                	je     1bfd <linkunlink+0xfd>
+    wait();
+    1bb2:	e8 a5 2a 00 00       	call   465c <wait>
+  printf(1, "linkunlink ok\n");
+    1bb7:	83 ec 08             	sub    $0x8,%esp
+    1bba:	68 f9 52 00 00       	push   $0x52f9
+    1bbf:	6a 01                	push   $0x1
+    1bc1:	e8 2a 2d 00 00       	call   48f0 <printf>
+}
+    1bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bc9:	5b                   	pop    %ebx
+    1bca:	5e                   	pop    %esi
+    1bcb:	5f                   	pop    %edi
+    1bcc:	5d                   	pop    %ebp
+    1bcd:	c3                   	ret
+    1bce:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1bd0:	83 ec 08             	sub    $0x8,%esp
+    1bd3:	68 71 55 00 00       	push   $0x5571
+    1bd8:	68 f5 52 00 00       	push   $0x52f5
+    1bdd:	e8 1f 2b 00 00       	call   4701 <link>
+    1be2:	83 c4 10             	add    $0x10,%esp
+    1be5:	e9 7b ff ff ff       	jmp    1b65 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1bea:	52                   	push   %edx
+    1beb:	52                   	push   %edx
+    1bec:	68 04 5f 00 00       	push   $0x5f04
+    1bf1:	6a 01                	push   $0x1
+    1bf3:	e8 f8 2c 00 00       	call   48f0 <printf>
+    exit();
+    1bf8:	e8 50 2a 00 00       	call   464d <exit>
+    exit();
+    1bfd:	e8 4b 2a 00 00       	call   464d <exit>
+    1c02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c10 <bigdir>:
+{
+    1c10:	55                   	push   %ebp
+    1c11:	89 e5                	mov    %esp,%ebp
+    1c13:	57                   	push   %edi
+    1c14:	56                   	push   %esi
+    1c15:	53                   	push   %ebx
+    1c16:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1c19:	68 08 53 00 00       	push   $0x5308
+    1c1e:	6a 01                	push   $0x1
+    1c20:	e8 cb 2c 00 00       	call   48f0 <printf>
+  unlink("bd");
+    1c25:	c7 04 24 15 53 00 00 	movl   $0x5315,(%esp)
+    1c2c:	e8 b2 2a 00 00       	call   46e3 <unlink>
+  fd = open("bd", O_CREATE);
+    1c31:	5a                   	pop    %edx
+    1c32:	59                   	pop    %ecx
+    1c33:	68 00 02 00 00       	push   $0x200
+    1c38:	68 15 53 00 00       	push   $0x5315
+    1c3d:	e8 83 2a 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1c42:	83 c4 10             	add    $0x10,%esp
+    1c45:	85 c0                	test   %eax,%eax
+    1c47:	0f 88 de 00 00 00    	js     1d2b <bigdir+0x11b>
+  close(fd);
+    1c4d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c50:	31 f6                	xor    %esi,%esi
+    1c52:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c55:	50                   	push   %eax
+    1c56:	e8 3d 2a 00 00       	call   4698 <close>
+    1c5b:	83 c4 10             	add    $0x10,%esp
+    1c5e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c60:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c62:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c65:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c69:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c6c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c70:	83 c0 30             	add    $0x30,%eax
+    1c73:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c76:	89 f0                	mov    %esi,%eax
+    1c78:	83 e0 3f             	and    $0x3f,%eax
+    1c7b:	83 c0 30             	add    $0x30,%eax
+    1c7e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c81:	57                   	push   %edi
+    1c82:	68 15 53 00 00       	push   $0x5315
+    1c87:	e8 75 2a 00 00       	call   4701 <link>
+    1c8c:	83 c4 10             	add    $0x10,%esp
+    1c8f:	89 c3                	mov    %eax,%ebx
+    1c91:	85 c0                	test   %eax,%eax
+    1c93:	75 6e                	jne    1d03 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c95:	83 c6 01             	add    $0x1,%esi
+    1c98:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c9e:	75 c0                	jne    1c60 <bigdir+0x50>
+  unlink("bd");
+    1ca0:	83 ec 0c             	sub    $0xc,%esp
+    1ca3:	68 15 53 00 00       	push   $0x5315
+    1ca8:	e8 36 2a 00 00       	call   46e3 <unlink>
+    1cad:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1cb0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1cb2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1cb5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1cb9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1cbc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1cc0:	83 c0 30             	add    $0x30,%eax
+    1cc3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1cc6:	89 d8                	mov    %ebx,%eax
+    1cc8:	83 e0 3f             	and    $0x3f,%eax
+    1ccb:	83 c0 30             	add    $0x30,%eax
+    1cce:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1cd1:	57                   	push   %edi
+    1cd2:	e8 0c 2a 00 00       	call   46e3 <unlink>
+    1cd7:	83 c4 10             	add    $0x10,%esp
+    1cda:	85 c0                	test   %eax,%eax
+    1cdc:	75 39                	jne    1d17 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1cde:	83 c3 01             	add    $0x1,%ebx
+    1ce1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1ce7:	75 c7                	jne    1cb0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1ce9:	83 ec 08             	sub    $0x8,%esp
+    1cec:	68 57 53 00 00       	push   $0x5357
+    1cf1:	6a 01                	push   $0x1
+    1cf3:	e8 f8 2b 00 00       	call   48f0 <printf>
+    1cf8:	83 c4 10             	add    $0x10,%esp
+}
+    1cfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cfe:	5b                   	pop    %ebx
+    1cff:	5e                   	pop    %esi
+    1d00:	5f                   	pop    %edi
+    1d01:	5d                   	pop    %ebp
+    1d02:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1d03:	83 ec 08             	sub    $0x8,%esp
+    1d06:	68 2e 53 00 00       	push   $0x532e
+    1d0b:	6a 01                	push   $0x1
+    1d0d:	e8 de 2b 00 00       	call   48f0 <printf>
+      exit();
+    1d12:	e8 36 29 00 00       	call   464d <exit>
+      printf(1, "bigdir unlink failed");
+    1d17:	83 ec 08             	sub    $0x8,%esp
+    1d1a:	68 42 53 00 00       	push   $0x5342
+    1d1f:	6a 01                	push   $0x1
+    1d21:	e8 ca 2b 00 00       	call   48f0 <printf>
+      exit();
+    1d26:	e8 22 29 00 00       	call   464d <exit>
+    printf(1, "bigdir create failed\n");
+    1d2b:	50                   	push   %eax
+    1d2c:	50                   	push   %eax
+    1d2d:	68 18 53 00 00       	push   $0x5318
+    1d32:	6a 01                	push   $0x1
+    1d34:	e8 b7 2b 00 00       	call   48f0 <printf>
+    exit();
+    1d39:	e8 0f 29 00 00       	call   464d <exit>
+    1d3e:	66 90                	xchg   %ax,%ax
+
+00001d40 <subdir>:
+{
+    1d40:	55                   	push   %ebp
+    1d41:	89 e5                	mov    %esp,%ebp
+    1d43:	53                   	push   %ebx
+    1d44:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1d47:	68 62 53 00 00       	push   $0x5362
+    1d4c:	6a 01                	push   $0x1
+    1d4e:	e8 9d 2b 00 00       	call   48f0 <printf>
+  unlink("ff");
+    1d53:	c7 04 24 eb 53 00 00 	movl   $0x53eb,(%esp)
+    1d5a:	e8 84 29 00 00       	call   46e3 <unlink>
+  if(mkdir("dd") != 0){
+    1d5f:	c7 04 24 88 54 00 00 	movl   $0x5488,(%esp)
+    1d66:	e8 a5 29 00 00       	call   4710 <mkdir>
+    1d6b:	83 c4 10             	add    $0x10,%esp
+    1d6e:	85 c0                	test   %eax,%eax
+    1d70:	0f 85 b3 05 00 00    	jne    2329 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d76:	83 ec 08             	sub    $0x8,%esp
+    1d79:	68 02 02 00 00       	push   $0x202
+    1d7e:	68 c1 53 00 00       	push   $0x53c1
+    1d83:	e8 3d 29 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1d88:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d8b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d8d:	85 c0                	test   %eax,%eax
+    1d8f:	0f 88 81 05 00 00    	js     2316 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1d95:	83 ec 04             	sub    $0x4,%esp
+    1d98:	6a 02                	push   $0x2
+    1d9a:	68 eb 53 00 00       	push   $0x53eb
+    1d9f:	50                   	push   %eax
+    1da0:	e8 e4 28 00 00       	call   4689 <write>
+  close(fd);
+    1da5:	89 1c 24             	mov    %ebx,(%esp)
+    1da8:	e8 eb 28 00 00       	call   4698 <close>
+  if(unlink("dd") >= 0){
+    1dad:	c7 04 24 88 54 00 00 	movl   $0x5488,(%esp)
+    1db4:	e8 2a 29 00 00       	call   46e3 <unlink>
+    1db9:	83 c4 10             	add    $0x10,%esp
+    1dbc:	85 c0                	test   %eax,%eax
+    1dbe:	0f 89 3f 05 00 00    	jns    2303 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1dc4:	83 ec 0c             	sub    $0xc,%esp
+    1dc7:	68 9c 53 00 00       	push   $0x539c
+    1dcc:	e8 3f 29 00 00       	call   4710 <mkdir>
+    1dd1:	83 c4 10             	add    $0x10,%esp
+    1dd4:	85 c0                	test   %eax,%eax
+    1dd6:	0f 85 14 05 00 00    	jne    22f0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1ddc:	83 ec 08             	sub    $0x8,%esp
+    1ddf:	68 02 02 00 00       	push   $0x202
+    1de4:	68 be 53 00 00       	push   $0x53be
+    1de9:	e8 d7 28 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1dee:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1df1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1df3:	85 c0                	test   %eax,%eax
+    1df5:	0f 88 24 04 00 00    	js     221f <subdir+0x4df>
+  write(fd, "FF", 2);
+    1dfb:	83 ec 04             	sub    $0x4,%esp
+    1dfe:	6a 02                	push   $0x2
+    1e00:	68 df 53 00 00       	push   $0x53df
+    1e05:	50                   	push   %eax
+    1e06:	e8 7e 28 00 00       	call   4689 <write>
+  close(fd);
+    1e0b:	89 1c 24             	mov    %ebx,(%esp)
+    1e0e:	e8 85 28 00 00       	call   4698 <close>
+  fd = open("dd/dd/../ff", 0);
+    1e13:	58                   	pop    %eax
+    1e14:	5a                   	pop    %edx
+    1e15:	6a 00                	push   $0x0
+    1e17:	68 e2 53 00 00       	push   $0x53e2
+    1e1c:	e8 a4 28 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1e21:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1e24:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e26:	85 c0                	test   %eax,%eax
+    1e28:	0f 88 de 03 00 00    	js     220c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1e2e:	83 ec 04             	sub    $0x4,%esp
+    1e31:	68 00 20 00 00       	push   $0x2000
+    1e36:	68 a0 9a 00 00       	push   $0x9aa0
+    1e3b:	50                   	push   %eax
+    1e3c:	e8 39 28 00 00       	call   467a <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1e41:	83 c4 10             	add    $0x10,%esp
+    1e44:	83 f8 02             	cmp    $0x2,%eax
+    1e47:	0f 85 3a 03 00 00    	jne    2187 <subdir+0x447>
+    1e4d:	80 3d a0 9a 00 00 66 	cmpb   $0x66,0x9aa0
+    1e54:	0f 85 2d 03 00 00    	jne    2187 <subdir+0x447>
+  close(fd);
+    1e5a:	83 ec 0c             	sub    $0xc,%esp
+    1e5d:	53                   	push   %ebx
+    1e5e:	e8 35 28 00 00       	call   4698 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1e63:	59                   	pop    %ecx
+    1e64:	5b                   	pop    %ebx
+    1e65:	68 22 54 00 00       	push   $0x5422
+    1e6a:	68 be 53 00 00       	push   $0x53be
+    1e6f:	e8 8d 28 00 00       	call   4701 <link>
+    1e74:	83 c4 10             	add    $0x10,%esp
+    1e77:	85 c0                	test   %eax,%eax
+    1e79:	0f 85 c6 03 00 00    	jne    2245 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1e7f:	83 ec 0c             	sub    $0xc,%esp
+    1e82:	68 be 53 00 00       	push   $0x53be
+    1e87:	e8 57 28 00 00       	call   46e3 <unlink>
+    1e8c:	83 c4 10             	add    $0x10,%esp
+    1e8f:	85 c0                	test   %eax,%eax
+    1e91:	0f 85 16 03 00 00    	jne    21ad <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1e97:	83 ec 08             	sub    $0x8,%esp
+    1e9a:	6a 00                	push   $0x0
+    1e9c:	68 be 53 00 00       	push   $0x53be
+    1ea1:	e8 1f 28 00 00       	call   46c5 <open>
+    1ea6:	83 c4 10             	add    $0x10,%esp
+    1ea9:	85 c0                	test   %eax,%eax
+    1eab:	0f 89 2c 04 00 00    	jns    22dd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1eb1:	83 ec 0c             	sub    $0xc,%esp
+    1eb4:	68 88 54 00 00       	push   $0x5488
+    1eb9:	e8 61 28 00 00       	call   471f <chdir>
+    1ebe:	83 c4 10             	add    $0x10,%esp
+    1ec1:	85 c0                	test   %eax,%eax
+    1ec3:	0f 85 01 04 00 00    	jne    22ca <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1ec9:	83 ec 0c             	sub    $0xc,%esp
+    1ecc:	68 56 54 00 00       	push   $0x5456
+    1ed1:	e8 49 28 00 00       	call   471f <chdir>
+    1ed6:	83 c4 10             	add    $0x10,%esp
+    1ed9:	85 c0                	test   %eax,%eax
+    1edb:	0f 85 b9 02 00 00    	jne    219a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1ee1:	83 ec 0c             	sub    $0xc,%esp
+    1ee4:	68 7c 54 00 00       	push   $0x547c
+    1ee9:	e8 31 28 00 00       	call   471f <chdir>
+    1eee:	83 c4 10             	add    $0x10,%esp
+    1ef1:	85 c0                	test   %eax,%eax
+    1ef3:	0f 85 a1 02 00 00    	jne    219a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1ef9:	83 ec 0c             	sub    $0xc,%esp
+    1efc:	68 8b 54 00 00       	push   $0x548b
+    1f01:	e8 19 28 00 00       	call   471f <chdir>
+    1f06:	83 c4 10             	add    $0x10,%esp
+    1f09:	85 c0                	test   %eax,%eax
+    1f0b:	0f 85 21 03 00 00    	jne    2232 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1f11:	83 ec 08             	sub    $0x8,%esp
+    1f14:	6a 00                	push   $0x0
+    1f16:	68 22 54 00 00       	push   $0x5422
+    1f1b:	e8 a5 27 00 00       	call   46c5 <open>
+  if(fd < 0){
+    1f20:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1f23:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f25:	85 c0                	test   %eax,%eax
+    1f27:	0f 88 e0 04 00 00    	js     240d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1f2d:	83 ec 04             	sub    $0x4,%esp
+    1f30:	68 00 20 00 00       	push   $0x2000
+    1f35:	68 a0 9a 00 00       	push   $0x9aa0
+    1f3a:	50                   	push   %eax
+    1f3b:	e8 3a 27 00 00       	call   467a <read>
+    1f40:	83 c4 10             	add    $0x10,%esp
+    1f43:	83 f8 02             	cmp    $0x2,%eax
+    1f46:	0f 85 ae 04 00 00    	jne    23fa <subdir+0x6ba>
+  close(fd);
+    1f4c:	83 ec 0c             	sub    $0xc,%esp
+    1f4f:	53                   	push   %ebx
+    1f50:	e8 43 27 00 00       	call   4698 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f55:	58                   	pop    %eax
+    1f56:	5a                   	pop    %edx
+    1f57:	6a 00                	push   $0x0
+    1f59:	68 be 53 00 00       	push   $0x53be
+    1f5e:	e8 62 27 00 00       	call   46c5 <open>
+    1f63:	83 c4 10             	add    $0x10,%esp
+    1f66:	85 c0                	test   %eax,%eax
+    1f68:	0f 89 65 02 00 00    	jns    21d3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1f6e:	83 ec 08             	sub    $0x8,%esp
+    1f71:	68 02 02 00 00       	push   $0x202
+    1f76:	68 d6 54 00 00       	push   $0x54d6
+    1f7b:	e8 45 27 00 00       	call   46c5 <open>
+    1f80:	83 c4 10             	add    $0x10,%esp
+    1f83:	85 c0                	test   %eax,%eax
+    1f85:	0f 89 35 02 00 00    	jns    21c0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1f8b:	83 ec 08             	sub    $0x8,%esp
+    1f8e:	68 02 02 00 00       	push   $0x202
+    1f93:	68 fb 54 00 00       	push   $0x54fb
+    1f98:	e8 28 27 00 00       	call   46c5 <open>
+    1f9d:	83 c4 10             	add    $0x10,%esp
+    1fa0:	85 c0                	test   %eax,%eax
+    1fa2:	0f 89 0f 03 00 00    	jns    22b7 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1fa8:	83 ec 08             	sub    $0x8,%esp
+    1fab:	68 00 02 00 00       	push   $0x200
+    1fb0:	68 88 54 00 00       	push   $0x5488
+    1fb5:	e8 0b 27 00 00       	call   46c5 <open>
+    1fba:	83 c4 10             	add    $0x10,%esp
+    1fbd:	85 c0                	test   %eax,%eax
+    1fbf:	0f 89 df 02 00 00    	jns    22a4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1fc5:	83 ec 08             	sub    $0x8,%esp
+    1fc8:	6a 02                	push   $0x2
+    1fca:	68 88 54 00 00       	push   $0x5488
+    1fcf:	e8 f1 26 00 00       	call   46c5 <open>
+    1fd4:	83 c4 10             	add    $0x10,%esp
+    1fd7:	85 c0                	test   %eax,%eax
+    1fd9:	0f 89 b2 02 00 00    	jns    2291 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    1fdf:	83 ec 08             	sub    $0x8,%esp
+    1fe2:	6a 01                	push   $0x1
+    1fe4:	68 88 54 00 00       	push   $0x5488
+    1fe9:	e8 d7 26 00 00       	call   46c5 <open>
+    1fee:	83 c4 10             	add    $0x10,%esp
+    1ff1:	85 c0                	test   %eax,%eax
+    1ff3:	0f 89 85 02 00 00    	jns    227e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1ff9:	83 ec 08             	sub    $0x8,%esp
+    1ffc:	68 6a 55 00 00       	push   $0x556a
+    2001:	68 d6 54 00 00       	push   $0x54d6
+    2006:	e8 f6 26 00 00       	call   4701 <link>
+    200b:	83 c4 10             	add    $0x10,%esp
+    200e:	85 c0                	test   %eax,%eax
+    2010:	0f 84 55 02 00 00    	je     226b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2016:	83 ec 08             	sub    $0x8,%esp
+    2019:	68 6a 55 00 00       	push   $0x556a
+    201e:	68 fb 54 00 00       	push   $0x54fb
+    2023:	e8 d9 26 00 00       	call   4701 <link>
+    2028:	83 c4 10             	add    $0x10,%esp
+    202b:	85 c0                	test   %eax,%eax
+    202d:	0f 84 25 02 00 00    	je     2258 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2033:	83 ec 08             	sub    $0x8,%esp
+    2036:	68 22 54 00 00       	push   $0x5422
+    203b:	68 c1 53 00 00       	push   $0x53c1
+    2040:	e8 bc 26 00 00       	call   4701 <link>
+    2045:	83 c4 10             	add    $0x10,%esp
+    2048:	85 c0                	test   %eax,%eax
+    204a:	0f 84 a9 01 00 00    	je     21f9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2050:	83 ec 0c             	sub    $0xc,%esp
+    2053:	68 d6 54 00 00       	push   $0x54d6
+    2058:	e8 b3 26 00 00       	call   4710 <mkdir>
+    205d:	83 c4 10             	add    $0x10,%esp
+    2060:	85 c0                	test   %eax,%eax
+    2062:	0f 84 7e 01 00 00    	je     21e6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2068:	83 ec 0c             	sub    $0xc,%esp
+    206b:	68 fb 54 00 00       	push   $0x54fb
+    2070:	e8 9b 26 00 00       	call   4710 <mkdir>
+    2075:	83 c4 10             	add    $0x10,%esp
+    2078:	85 c0                	test   %eax,%eax
+    207a:	0f 84 67 03 00 00    	je     23e7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2080:	83 ec 0c             	sub    $0xc,%esp
+    2083:	68 22 54 00 00       	push   $0x5422
+    2088:	e8 83 26 00 00       	call   4710 <mkdir>
+    208d:	83 c4 10             	add    $0x10,%esp
+    2090:	85 c0                	test   %eax,%eax
+    2092:	0f 84 3c 03 00 00    	je     23d4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2098:	83 ec 0c             	sub    $0xc,%esp
+    209b:	68 fb 54 00 00       	push   $0x54fb
+    20a0:	e8 3e 26 00 00       	call   46e3 <unlink>
+    20a5:	83 c4 10             	add    $0x10,%esp
+    20a8:	85 c0                	test   %eax,%eax
+    20aa:	0f 84 11 03 00 00    	je     23c1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	68 d6 54 00 00       	push   $0x54d6
+    20b8:	e8 26 26 00 00       	call   46e3 <unlink>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	0f 84 e6 02 00 00    	je     23ae <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    20c8:	83 ec 0c             	sub    $0xc,%esp
+    20cb:	68 c1 53 00 00       	push   $0x53c1
+    20d0:	e8 4a 26 00 00       	call   471f <chdir>
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	85 c0                	test   %eax,%eax
+    20da:	0f 84 bb 02 00 00    	je     239b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	68 6d 55 00 00       	push   $0x556d
+    20e8:	e8 32 26 00 00       	call   471f <chdir>
+    20ed:	83 c4 10             	add    $0x10,%esp
+    20f0:	85 c0                	test   %eax,%eax
+    20f2:	0f 84 90 02 00 00    	je     2388 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	68 22 54 00 00       	push   $0x5422
+    2100:	e8 de 25 00 00       	call   46e3 <unlink>
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	85 c0                	test   %eax,%eax
+    210a:	0f 85 9d 00 00 00    	jne    21ad <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2110:	83 ec 0c             	sub    $0xc,%esp
+    2113:	68 c1 53 00 00       	push   $0x53c1
+    2118:	e8 c6 25 00 00       	call   46e3 <unlink>
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	85 c0                	test   %eax,%eax
+    2122:	0f 85 4d 02 00 00    	jne    2375 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2128:	83 ec 0c             	sub    $0xc,%esp
+    212b:	68 88 54 00 00       	push   $0x5488
+    2130:	e8 ae 25 00 00       	call   46e3 <unlink>
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 84 22 02 00 00    	je     2362 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2140:	83 ec 0c             	sub    $0xc,%esp
+    2143:	68 9d 53 00 00       	push   $0x539d
+    2148:	e8 96 25 00 00       	call   46e3 <unlink>
+    214d:	83 c4 10             	add    $0x10,%esp
+    2150:	85 c0                	test   %eax,%eax
+    2152:	0f 88 f7 01 00 00    	js     234f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2158:	83 ec 0c             	sub    $0xc,%esp
+    215b:	68 88 54 00 00       	push   $0x5488
+    2160:	e8 7e 25 00 00       	call   46e3 <unlink>
+    2165:	83 c4 10             	add    $0x10,%esp
+    2168:	85 c0                	test   %eax,%eax
+    216a:	0f 88 cc 01 00 00    	js     233c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2170:	83 ec 08             	sub    $0x8,%esp
+    2173:	68 6a 56 00 00       	push   $0x566a
+    2178:	6a 01                	push   $0x1
+    217a:	e8 71 27 00 00       	call   48f0 <printf>
+}
+    217f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2182:	83 c4 10             	add    $0x10,%esp
+    2185:	c9                   	leave
+    2186:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2187:	50                   	push   %eax
+    2188:	50                   	push   %eax
+    2189:	68 07 54 00 00       	push   $0x5407
+    218e:	6a 01                	push   $0x1
+    2190:	e8 5b 27 00 00       	call   48f0 <printf>
+    exit();
+    2195:	e8 b3 24 00 00       	call   464d <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    219a:	50                   	push   %eax
+    219b:	50                   	push   %eax
+    219c:	68 62 54 00 00       	push   $0x5462
+    21a1:	6a 01                	push   $0x1
+    21a3:	e8 48 27 00 00       	call   48f0 <printf>
+    exit();
+    21a8:	e8 a0 24 00 00       	call   464d <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    21ad:	50                   	push   %eax
+    21ae:	50                   	push   %eax
+    21af:	68 2d 54 00 00       	push   $0x542d
+    21b4:	6a 01                	push   $0x1
+    21b6:	e8 35 27 00 00       	call   48f0 <printf>
+    exit();
+    21bb:	e8 8d 24 00 00       	call   464d <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    21c0:	51                   	push   %ecx
+    21c1:	51                   	push   %ecx
+    21c2:	68 df 54 00 00       	push   $0x54df
+    21c7:	6a 01                	push   $0x1
+    21c9:	e8 22 27 00 00       	call   48f0 <printf>
+    exit();
+    21ce:	e8 7a 24 00 00       	call   464d <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    21d3:	53                   	push   %ebx
+    21d4:	53                   	push   %ebx
+    21d5:	68 6c 62 00 00       	push   $0x626c
+    21da:	6a 01                	push   $0x1
+    21dc:	e8 0f 27 00 00       	call   48f0 <printf>
+    exit();
+    21e1:	e8 67 24 00 00       	call   464d <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    21e6:	51                   	push   %ecx
+    21e7:	51                   	push   %ecx
+    21e8:	68 73 55 00 00       	push   $0x5573
+    21ed:	6a 01                	push   $0x1
+    21ef:	e8 fc 26 00 00       	call   48f0 <printf>
+    exit();
+    21f4:	e8 54 24 00 00       	call   464d <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    21f9:	53                   	push   %ebx
+    21fa:	53                   	push   %ebx
+    21fb:	68 dc 62 00 00       	push   $0x62dc
+    2200:	6a 01                	push   $0x1
+    2202:	e8 e9 26 00 00       	call   48f0 <printf>
+    exit();
+    2207:	e8 41 24 00 00       	call   464d <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    220c:	50                   	push   %eax
+    220d:	50                   	push   %eax
+    220e:	68 ee 53 00 00       	push   $0x53ee
+    2213:	6a 01                	push   $0x1
+    2215:	e8 d6 26 00 00       	call   48f0 <printf>
+    exit();
+    221a:	e8 2e 24 00 00       	call   464d <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    221f:	51                   	push   %ecx
+    2220:	51                   	push   %ecx
+    2221:	68 c7 53 00 00       	push   $0x53c7
+    2226:	6a 01                	push   $0x1
+    2228:	e8 c3 26 00 00       	call   48f0 <printf>
+    exit();
+    222d:	e8 1b 24 00 00       	call   464d <exit>
+    printf(1, "chdir ./.. failed\n");
+    2232:	50                   	push   %eax
+    2233:	50                   	push   %eax
+    2234:	68 90 54 00 00       	push   $0x5490
+    2239:	6a 01                	push   $0x1
+    223b:	e8 b0 26 00 00       	call   48f0 <printf>
+    exit();
+    2240:	e8 08 24 00 00       	call   464d <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2245:	52                   	push   %edx
+    2246:	52                   	push   %edx
+    2247:	68 24 62 00 00       	push   $0x6224
+    224c:	6a 01                	push   $0x1
+    224e:	e8 9d 26 00 00       	call   48f0 <printf>
+    exit();
+    2253:	e8 f5 23 00 00       	call   464d <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2258:	50                   	push   %eax
+    2259:	50                   	push   %eax
+    225a:	68 b8 62 00 00       	push   $0x62b8
+    225f:	6a 01                	push   $0x1
+    2261:	e8 8a 26 00 00       	call   48f0 <printf>
+    exit();
+    2266:	e8 e2 23 00 00       	call   464d <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    226b:	50                   	push   %eax
+    226c:	50                   	push   %eax
+    226d:	68 94 62 00 00       	push   $0x6294
+    2272:	6a 01                	push   $0x1
+    2274:	e8 77 26 00 00       	call   48f0 <printf>
+    exit();
+    2279:	e8 cf 23 00 00       	call   464d <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    227e:	50                   	push   %eax
+    227f:	50                   	push   %eax
+    2280:	68 4f 55 00 00       	push   $0x554f
+    2285:	6a 01                	push   $0x1
+    2287:	e8 64 26 00 00       	call   48f0 <printf>
+    exit();
+    228c:	e8 bc 23 00 00       	call   464d <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2291:	50                   	push   %eax
+    2292:	50                   	push   %eax
+    2293:	68 36 55 00 00       	push   $0x5536
+    2298:	6a 01                	push   $0x1
+    229a:	e8 51 26 00 00       	call   48f0 <printf>
+    exit();
+    229f:	e8 a9 23 00 00       	call   464d <exit>
+    printf(1, "create dd succeeded!\n");
+    22a4:	50                   	push   %eax
+    22a5:	50                   	push   %eax
+    22a6:	68 20 55 00 00       	push   $0x5520
+    22ab:	6a 01                	push   $0x1
+    22ad:	e8 3e 26 00 00       	call   48f0 <printf>
+    exit();
+    22b2:	e8 96 23 00 00       	call   464d <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    22b7:	52                   	push   %edx
+    22b8:	52                   	push   %edx
+    22b9:	68 04 55 00 00       	push   $0x5504
+    22be:	6a 01                	push   $0x1
+    22c0:	e8 2b 26 00 00       	call   48f0 <printf>
+    exit();
+    22c5:	e8 83 23 00 00       	call   464d <exit>
+    printf(1, "chdir dd failed\n");
+    22ca:	50                   	push   %eax
+    22cb:	50                   	push   %eax
+    22cc:	68 45 54 00 00       	push   $0x5445
+    22d1:	6a 01                	push   $0x1
+    22d3:	e8 18 26 00 00       	call   48f0 <printf>
+    exit();
+    22d8:	e8 70 23 00 00       	call   464d <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    22dd:	50                   	push   %eax
+    22de:	50                   	push   %eax
+    22df:	68 48 62 00 00       	push   $0x6248
+    22e4:	6a 01                	push   $0x1
+    22e6:	e8 05 26 00 00       	call   48f0 <printf>
+    exit();
+    22eb:	e8 5d 23 00 00       	call   464d <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    22f0:	53                   	push   %ebx
+    22f1:	53                   	push   %ebx
+    22f2:	68 a3 53 00 00       	push   $0x53a3
+    22f7:	6a 01                	push   $0x1
+    22f9:	e8 f2 25 00 00       	call   48f0 <printf>
+    exit();
+    22fe:	e8 4a 23 00 00       	call   464d <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2303:	50                   	push   %eax
+    2304:	50                   	push   %eax
+    2305:	68 fc 61 00 00       	push   $0x61fc
+    230a:	6a 01                	push   $0x1
+    230c:	e8 df 25 00 00       	call   48f0 <printf>
+    exit();
+    2311:	e8 37 23 00 00       	call   464d <exit>
+    printf(1, "create dd/ff failed\n");
+    2316:	50                   	push   %eax
+    2317:	50                   	push   %eax
+    2318:	68 87 53 00 00       	push   $0x5387
+    231d:	6a 01                	push   $0x1
+    231f:	e8 cc 25 00 00       	call   48f0 <printf>
+    exit();
+    2324:	e8 24 23 00 00       	call   464d <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2329:	50                   	push   %eax
+    232a:	50                   	push   %eax
+    232b:	68 6f 53 00 00       	push   $0x536f
+    2330:	6a 01                	push   $0x1
+    2332:	e8 b9 25 00 00       	call   48f0 <printf>
+    exit();
+    2337:	e8 11 23 00 00       	call   464d <exit>
+    printf(1, "unlink dd failed\n");
+    233c:	50                   	push   %eax
+    233d:	50                   	push   %eax
+    233e:	68 58 56 00 00       	push   $0x5658
+    2343:	6a 01                	push   $0x1
+    2345:	e8 a6 25 00 00       	call   48f0 <printf>
+    exit();
+    234a:	e8 fe 22 00 00       	call   464d <exit>
+    printf(1, "unlink dd/dd failed\n");
+    234f:	52                   	push   %edx
+    2350:	52                   	push   %edx
+    2351:	68 43 56 00 00       	push   $0x5643
+    2356:	6a 01                	push   $0x1
+    2358:	e8 93 25 00 00       	call   48f0 <printf>
+    exit();
+    235d:	e8 eb 22 00 00       	call   464d <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2362:	51                   	push   %ecx
+    2363:	51                   	push   %ecx
+    2364:	68 00 63 00 00       	push   $0x6300
+    2369:	6a 01                	push   $0x1
+    236b:	e8 80 25 00 00       	call   48f0 <printf>
+    exit();
+    2370:	e8 d8 22 00 00       	call   464d <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2375:	53                   	push   %ebx
+    2376:	53                   	push   %ebx
+    2377:	68 2e 56 00 00       	push   $0x562e
+    237c:	6a 01                	push   $0x1
+    237e:	e8 6d 25 00 00       	call   48f0 <printf>
+    exit();
+    2383:	e8 c5 22 00 00       	call   464d <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2388:	50                   	push   %eax
+    2389:	50                   	push   %eax
+    238a:	68 16 56 00 00       	push   $0x5616
+    238f:	6a 01                	push   $0x1
+    2391:	e8 5a 25 00 00       	call   48f0 <printf>
+    exit();
+    2396:	e8 b2 22 00 00       	call   464d <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    239b:	50                   	push   %eax
+    239c:	50                   	push   %eax
+    239d:	68 fe 55 00 00       	push   $0x55fe
+    23a2:	6a 01                	push   $0x1
+    23a4:	e8 47 25 00 00       	call   48f0 <printf>
+    exit();
+    23a9:	e8 9f 22 00 00       	call   464d <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    23ae:	50                   	push   %eax
+    23af:	50                   	push   %eax
+    23b0:	68 e2 55 00 00       	push   $0x55e2
+    23b5:	6a 01                	push   $0x1
+    23b7:	e8 34 25 00 00       	call   48f0 <printf>
+    exit();
+    23bc:	e8 8c 22 00 00       	call   464d <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    23c1:	50                   	push   %eax
+    23c2:	50                   	push   %eax
+    23c3:	68 c6 55 00 00       	push   $0x55c6
+    23c8:	6a 01                	push   $0x1
+    23ca:	e8 21 25 00 00       	call   48f0 <printf>
+    exit();
+    23cf:	e8 79 22 00 00       	call   464d <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    23d4:	50                   	push   %eax
+    23d5:	50                   	push   %eax
+    23d6:	68 a9 55 00 00       	push   $0x55a9
+    23db:	6a 01                	push   $0x1
+    23dd:	e8 0e 25 00 00       	call   48f0 <printf>
+    exit();
+    23e2:	e8 66 22 00 00       	call   464d <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    23e7:	52                   	push   %edx
+    23e8:	52                   	push   %edx
+    23e9:	68 8e 55 00 00       	push   $0x558e
+    23ee:	6a 01                	push   $0x1
+    23f0:	e8 fb 24 00 00       	call   48f0 <printf>
+    exit();
+    23f5:	e8 53 22 00 00       	call   464d <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    23fa:	51                   	push   %ecx
+    23fb:	51                   	push   %ecx
+    23fc:	68 bb 54 00 00       	push   $0x54bb
+    2401:	6a 01                	push   $0x1
+    2403:	e8 e8 24 00 00       	call   48f0 <printf>
+    exit();
+    2408:	e8 40 22 00 00       	call   464d <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    240d:	53                   	push   %ebx
+    240e:	53                   	push   %ebx
+    240f:	68 a3 54 00 00       	push   $0x54a3
+    2414:	6a 01                	push   $0x1
+    2416:	e8 d5 24 00 00       	call   48f0 <printf>
+    exit();
+    241b:	e8 2d 22 00 00       	call   464d <exit>
+
+00002420 <bigwrite>:
+{
+    2420:	55                   	push   %ebp
+    2421:	89 e5                	mov    %esp,%ebp
+    2423:	56                   	push   %esi
+    2424:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2425:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    242a:	83 ec 08             	sub    $0x8,%esp
+    242d:	68 75 56 00 00       	push   $0x5675
+    2432:	6a 01                	push   $0x1
+    2434:	e8 b7 24 00 00       	call   48f0 <printf>
+  unlink("bigwrite");
+    2439:	c7 04 24 84 56 00 00 	movl   $0x5684,(%esp)
+    2440:	e8 9e 22 00 00       	call   46e3 <unlink>
+    2445:	83 c4 10             	add    $0x10,%esp
+    2448:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    244f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2450:	83 ec 08             	sub    $0x8,%esp
+    2453:	68 02 02 00 00       	push   $0x202
+    2458:	68 84 56 00 00       	push   $0x5684
+    245d:	e8 63 22 00 00       	call   46c5 <open>
+    if(fd < 0){
+    2462:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2465:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2467:	85 c0                	test   %eax,%eax
+    2469:	78 7e                	js     24e9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    246b:	83 ec 04             	sub    $0x4,%esp
+    246e:	53                   	push   %ebx
+    246f:	68 a0 9a 00 00       	push   $0x9aa0
+    2474:	50                   	push   %eax
+    2475:	e8 0f 22 00 00       	call   4689 <write>
+      if(cc != sz){
+    247a:	83 c4 10             	add    $0x10,%esp
+    247d:	39 d8                	cmp    %ebx,%eax
+    247f:	75 55                	jne    24d6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2481:	83 ec 04             	sub    $0x4,%esp
+    2484:	53                   	push   %ebx
+    2485:	68 a0 9a 00 00       	push   $0x9aa0
+    248a:	56                   	push   %esi
+    248b:	e8 f9 21 00 00       	call   4689 <write>
+      if(cc != sz){
+    2490:	83 c4 10             	add    $0x10,%esp
+    2493:	39 c3                	cmp    %eax,%ebx
+    2495:	75 3f                	jne    24d6 <bigwrite+0xb6>
+    close(fd);
+    2497:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    249a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    24a0:	56                   	push   %esi
+    24a1:	e8 f2 21 00 00       	call   4698 <close>
+    unlink("bigwrite");
+    24a6:	c7 04 24 84 56 00 00 	movl   $0x5684,(%esp)
+    24ad:	e8 31 22 00 00       	call   46e3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    24b2:	83 c4 10             	add    $0x10,%esp
+    24b5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    24bb:	75 93                	jne    2450 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    24bd:	83 ec 08             	sub    $0x8,%esp
+    24c0:	68 b7 56 00 00       	push   $0x56b7
+    24c5:	6a 01                	push   $0x1
+    24c7:	e8 24 24 00 00       	call   48f0 <printf>
+}
+    24cc:	83 c4 10             	add    $0x10,%esp
+    24cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24d2:	5b                   	pop    %ebx
+    24d3:	5e                   	pop    %esi
+    24d4:	5d                   	pop    %ebp
+    24d5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    24d6:	50                   	push   %eax
+    24d7:	53                   	push   %ebx
+    24d8:	68 a5 56 00 00       	push   $0x56a5
+    24dd:	6a 01                	push   $0x1
+    24df:	e8 0c 24 00 00       	call   48f0 <printf>
+        exit();
+    24e4:	e8 64 21 00 00       	call   464d <exit>
+      printf(1, "cannot create bigwrite\n");
+    24e9:	83 ec 08             	sub    $0x8,%esp
+    24ec:	68 8d 56 00 00       	push   $0x568d
+    24f1:	6a 01                	push   $0x1
+    24f3:	e8 f8 23 00 00       	call   48f0 <printf>
+      exit();
+    24f8:	e8 50 21 00 00       	call   464d <exit>
+    24fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002500 <bigfile>:
+{
+    2500:	55                   	push   %ebp
+    2501:	89 e5                	mov    %esp,%ebp
+    2503:	57                   	push   %edi
+    2504:	56                   	push   %esi
+    2505:	53                   	push   %ebx
+    2506:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2509:	68 c4 56 00 00       	push   $0x56c4
+    250e:	6a 01                	push   $0x1
+    2510:	e8 db 23 00 00       	call   48f0 <printf>
+  unlink("bigfile");
+    2515:	c7 04 24 e0 56 00 00 	movl   $0x56e0,(%esp)
+    251c:	e8 c2 21 00 00       	call   46e3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2521:	58                   	pop    %eax
+    2522:	5a                   	pop    %edx
+    2523:	68 02 02 00 00       	push   $0x202
+    2528:	68 e0 56 00 00       	push   $0x56e0
+    252d:	e8 93 21 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2532:	83 c4 10             	add    $0x10,%esp
+    2535:	85 c0                	test   %eax,%eax
+    2537:	0f 88 5e 01 00 00    	js     269b <bigfile+0x19b>
+    253d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    253f:	31 db                	xor    %ebx,%ebx
+    2541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2548:	83 ec 04             	sub    $0x4,%esp
+    254b:	68 58 02 00 00       	push   $0x258
+    2550:	53                   	push   %ebx
+    2551:	68 a0 9a 00 00       	push   $0x9aa0
+    2556:	e8 75 1e 00 00       	call   43d0 <memset>
+    if(write(fd, buf, 600) != 600){
+    255b:	83 c4 0c             	add    $0xc,%esp
+    255e:	68 58 02 00 00       	push   $0x258
+    2563:	68 a0 9a 00 00       	push   $0x9aa0
+    2568:	56                   	push   %esi
+    2569:	e8 1b 21 00 00       	call   4689 <write>
+    256e:	83 c4 10             	add    $0x10,%esp
+    2571:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2576:	0f 85 f8 00 00 00    	jne    2674 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    257c:	83 c3 01             	add    $0x1,%ebx
+    257f:	83 fb 14             	cmp    $0x14,%ebx
+    2582:	75 c4                	jne    2548 <bigfile+0x48>
+  close(fd);
+    2584:	83 ec 0c             	sub    $0xc,%esp
+    2587:	56                   	push   %esi
+    2588:	e8 0b 21 00 00       	call   4698 <close>
+  fd = open("bigfile", 0);
+    258d:	5e                   	pop    %esi
+    258e:	5f                   	pop    %edi
+    258f:	6a 00                	push   $0x0
+    2591:	68 e0 56 00 00       	push   $0x56e0
+    2596:	e8 2a 21 00 00       	call   46c5 <open>
+  if(fd < 0){
+    259b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    259e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    25a0:	85 c0                	test   %eax,%eax
+    25a2:	0f 88 e0 00 00 00    	js     2688 <bigfile+0x188>
+  total = 0;
+    25a8:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    25aa:	31 ff                	xor    %edi,%edi
+    25ac:	eb 30                	jmp    25de <bigfile+0xde>
+    25ae:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    25b0:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    25b5:	0f 85 91 00 00 00    	jne    264c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    25bb:	89 fa                	mov    %edi,%edx
+    25bd:	0f be 05 a0 9a 00 00 	movsbl 0x9aa0,%eax
+    25c4:	d1 fa                	sar    %edx
+    25c6:	39 d0                	cmp    %edx,%eax
+    25c8:	75 6e                	jne    2638 <bigfile+0x138>
+    25ca:	0f be 15 cb 9b 00 00 	movsbl 0x9bcb,%edx
+    25d1:	39 d0                	cmp    %edx,%eax
+    25d3:	75 63                	jne    2638 <bigfile+0x138>
+    total += cc;
+    25d5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    25db:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    25de:	83 ec 04             	sub    $0x4,%esp
+    25e1:	68 2c 01 00 00       	push   $0x12c
+    25e6:	68 a0 9a 00 00       	push   $0x9aa0
+    25eb:	56                   	push   %esi
+    25ec:	e8 89 20 00 00       	call   467a <read>
+    if(cc < 0){
+    25f1:	83 c4 10             	add    $0x10,%esp
+    25f4:	85 c0                	test   %eax,%eax
+    25f6:	78 68                	js     2660 <bigfile+0x160>
+    if(cc == 0)
+    25f8:	75 b6                	jne    25b0 <bigfile+0xb0>
+  close(fd);
+    25fa:	83 ec 0c             	sub    $0xc,%esp
+    25fd:	56                   	push   %esi
+    25fe:	e8 95 20 00 00       	call   4698 <close>
+  if(total != 20*600){
+    2603:	83 c4 10             	add    $0x10,%esp
+    2606:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    260c:	0f 85 9c 00 00 00    	jne    26ae <bigfile+0x1ae>
+  unlink("bigfile");
+    2612:	83 ec 0c             	sub    $0xc,%esp
+    2615:	68 e0 56 00 00       	push   $0x56e0
+    261a:	e8 c4 20 00 00       	call   46e3 <unlink>
+  printf(1, "bigfile test ok\n");
+    261f:	58                   	pop    %eax
+    2620:	5a                   	pop    %edx
+    2621:	68 6f 57 00 00       	push   $0x576f
+    2626:	6a 01                	push   $0x1
+    2628:	e8 c3 22 00 00       	call   48f0 <printf>
+}
+    262d:	83 c4 10             	add    $0x10,%esp
+    2630:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2633:	5b                   	pop    %ebx
+    2634:	5e                   	pop    %esi
+    2635:	5f                   	pop    %edi
+    2636:	5d                   	pop    %ebp
+    2637:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2638:	83 ec 08             	sub    $0x8,%esp
+    263b:	68 3c 57 00 00       	push   $0x573c
+    2640:	6a 01                	push   $0x1
+    2642:	e8 a9 22 00 00       	call   48f0 <printf>
+      exit();
+    2647:	e8 01 20 00 00       	call   464d <exit>
+      printf(1, "short read bigfile\n");
+    264c:	83 ec 08             	sub    $0x8,%esp
+    264f:	68 28 57 00 00       	push   $0x5728
+    2654:	6a 01                	push   $0x1
+    2656:	e8 95 22 00 00       	call   48f0 <printf>
+      exit();
+    265b:	e8 ed 1f 00 00       	call   464d <exit>
+      printf(1, "read bigfile failed\n");
+    2660:	83 ec 08             	sub    $0x8,%esp
+    2663:	68 13 57 00 00       	push   $0x5713
+    2668:	6a 01                	push   $0x1
+    266a:	e8 81 22 00 00       	call   48f0 <printf>
+      exit();
+    266f:	e8 d9 1f 00 00       	call   464d <exit>
+      printf(1, "write bigfile failed\n");
+    2674:	83 ec 08             	sub    $0x8,%esp
+    2677:	68 e8 56 00 00       	push   $0x56e8
+    267c:	6a 01                	push   $0x1
+    267e:	e8 6d 22 00 00       	call   48f0 <printf>
+      exit();
+    2683:	e8 c5 1f 00 00       	call   464d <exit>
+    printf(1, "cannot open bigfile\n");
+    2688:	53                   	push   %ebx
+    2689:	53                   	push   %ebx
+    268a:	68 fe 56 00 00       	push   $0x56fe
+    268f:	6a 01                	push   $0x1
+    2691:	e8 5a 22 00 00       	call   48f0 <printf>
+    exit();
+    2696:	e8 b2 1f 00 00       	call   464d <exit>
+    printf(1, "cannot create bigfile");
+    269b:	50                   	push   %eax
+    269c:	50                   	push   %eax
+    269d:	68 d2 56 00 00       	push   $0x56d2
+    26a2:	6a 01                	push   $0x1
+    26a4:	e8 47 22 00 00       	call   48f0 <printf>
+    exit();
+    26a9:	e8 9f 1f 00 00       	call   464d <exit>
+    printf(1, "read bigfile wrong total\n");
+    26ae:	51                   	push   %ecx
+    26af:	51                   	push   %ecx
+    26b0:	68 55 57 00 00       	push   $0x5755
+    26b5:	6a 01                	push   $0x1
+    26b7:	e8 34 22 00 00       	call   48f0 <printf>
+    exit();
+    26bc:	e8 8c 1f 00 00       	call   464d <exit>
+    26c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26cf:	90                   	nop
+
+000026d0 <inlinetest>:
+{
+    26d0:	55                   	push   %ebp
+    26d1:	89 e5                	mov    %esp,%ebp
+    26d3:	57                   	push   %edi
+    26d4:	56                   	push   %esi
+    26d5:	53                   	push   %ebx
+    26d6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "inline test\n");
+    26d9:	68 80 57 00 00       	push   $0x5780
+    26de:	6a 01                	push   $0x1
+    26e0:	e8 0b 22 00 00       	call   48f0 <printf>
+  unlink("inlinef");
+    26e5:	c7 04 24 8d 57 00 00 	movl   $0x578d,(%esp)
+    26ec:	e8 f2 1f 00 00       	call   46e3 <unlink>
+  fd = open("inlinef", O_CREATE | O_RDWR);
+    26f1:	58                   	pop    %eax
+    26f2:	5a                   	pop    %edx
+    26f3:	68 02 02 00 00       	push   $0x202
+    26f8:	68 8d 57 00 00       	push   $0x578d
+    26fd:	e8 c3 1f 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2702:	83 c4 10             	add    $0x10,%esp
+    2705:	85 c0                	test   %eax,%eax
+    2707:	0f 88 16 01 00 00    	js     2823 <inlinetest+0x153>
+    270d:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 100; i++){
+    270f:	31 ff                	xor    %edi,%edi
+    buf[0] = 'a' + i % 26;
+    2711:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    2716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    271d:	8d 76 00             	lea    0x0(%esi),%esi
+    2720:	89 f8                	mov    %edi,%eax
+    if(write(fd, buf, 1) != 1){
+    2722:	83 ec 04             	sub    $0x4,%esp
+    buf[0] = 'a' + i % 26;
+    2725:	f7 e6                	mul    %esi
+    2727:	89 f8                	mov    %edi,%eax
+    2729:	c1 ea 03             	shr    $0x3,%edx
+    272c:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    272f:	29 d0                	sub    %edx,%eax
+    2731:	83 c0 61             	add    $0x61,%eax
+    2734:	a2 a0 9a 00 00       	mov    %al,0x9aa0
+    if(write(fd, buf, 1) != 1){
+    2739:	6a 01                	push   $0x1
+    273b:	68 a0 9a 00 00       	push   $0x9aa0
+    2740:	53                   	push   %ebx
+    2741:	e8 43 1f 00 00       	call   4689 <write>
+    2746:	83 c4 10             	add    $0x10,%esp
+    2749:	83 f8 01             	cmp    $0x1,%eax
+    274c:	0f 85 a8 00 00 00    	jne    27fa <inlinetest+0x12a>
+  for(i = 0; i < 100; i++){
+    2752:	83 c7 01             	add    $0x1,%edi
+    2755:	83 ff 64             	cmp    $0x64,%edi
+    2758:	75 c6                	jne    2720 <inlinetest+0x50>
+  close(fd);
+    275a:	83 ec 0c             	sub    $0xc,%esp
+    275d:	53                   	push   %ebx
+    275e:	e8 35 1f 00 00       	call   4698 <close>
+  fd = open("inlinef", 0);
+    2763:	5e                   	pop    %esi
+    2764:	5f                   	pop    %edi
+    2765:	6a 00                	push   $0x0
+    2767:	68 8d 57 00 00       	push   $0x578d
+    276c:	e8 54 1f 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2771:	83 c4 10             	add    $0x10,%esp
+  fd = open("inlinef", 0);
+    2774:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2776:	85 c0                	test   %eax,%eax
+    2778:	0f 88 cb 00 00 00    	js     2849 <inlinetest+0x179>
+  if(read(fd, buf, sizeof(buf)) != 100){
+    277e:	83 ec 04             	sub    $0x4,%esp
+    2781:	68 00 20 00 00       	push   $0x2000
+    2786:	68 a0 9a 00 00       	push   $0x9aa0
+    278b:	50                   	push   %eax
+    278c:	e8 e9 1e 00 00       	call   467a <read>
+    2791:	83 c4 10             	add    $0x10,%esp
+    2794:	83 f8 64             	cmp    $0x64,%eax
+    2797:	0f 85 99 00 00 00    	jne    2836 <inlinetest+0x166>
+  for(i = 0; i < 100; i++){
+    279d:	31 c9                	xor    %ecx,%ecx
+    if(buf[i] != 'a' + i % 26){
+    279f:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+    27a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    27a8:	89 c8                	mov    %ecx,%eax
+    27aa:	0f be 99 a0 9a 00 00 	movsbl 0x9aa0(%ecx),%ebx
+    27b1:	f7 e6                	mul    %esi
+    27b3:	89 c8                	mov    %ecx,%eax
+    27b5:	c1 ea 03             	shr    $0x3,%edx
+    27b8:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    27bb:	29 d0                	sub    %edx,%eax
+    27bd:	83 c0 61             	add    $0x61,%eax
+    27c0:	39 c3                	cmp    %eax,%ebx
+    27c2:	75 4a                	jne    280e <inlinetest+0x13e>
+  for(i = 0; i < 100; i++){
+    27c4:	83 c1 01             	add    $0x1,%ecx
+    27c7:	83 f9 64             	cmp    $0x64,%ecx
+    27ca:	75 dc                	jne    27a8 <inlinetest+0xd8>
+  close(fd);
+    27cc:	83 ec 0c             	sub    $0xc,%esp
+    27cf:	57                   	push   %edi
+    27d0:	e8 c3 1e 00 00       	call   4698 <close>
+  unlink("inlinef");
+    27d5:	c7 04 24 8d 57 00 00 	movl   $0x578d,(%esp)
+    27dc:	e8 02 1f 00 00       	call   46e3 <unlink>
+  printf(1, "inline test ok\n");
+    27e1:	58                   	pop    %eax
+    27e2:	5a                   	pop    %edx
+    27e3:	68 f0 57 00 00       	push   $0x57f0
+    27e8:	6a 01                	push   $0x1
+    27ea:	e8 01 21 00 00       	call   48f0 <printf>
+}
+    27ef:	83 c4 10             	add    $0x10,%esp
+    27f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    27f5:	5b                   	pop    %ebx
+    27f6:	5e                   	pop    %esi
+    27f7:	5f                   	pop    %edi
+    27f8:	5d                   	pop    %ebp
+    27f9:	c3                   	ret
+      printf(1, "write inlinef failed\n");
+    27fa:	83 ec 08             	sub    $0x8,%esp
+    27fd:	68 ac 57 00 00       	push   $0x57ac
+    2802:	6a 01                	push   $0x1
+    2804:	e8 e7 20 00 00       	call   48f0 <printf>
+      exit();
+    2809:	e8 3f 1e 00 00       	call   464d <exit>
+      printf(1, "read inlinef wrong data at %d\n", i);
+    280e:	83 ec 04             	sub    $0x4,%esp
+    2811:	51                   	push   %ecx
+    2812:	68 20 63 00 00       	push   $0x6320
+    2817:	6a 01                	push   $0x1
+    2819:	e8 d2 20 00 00       	call   48f0 <printf>
+      exit();
+    281e:	e8 2a 1e 00 00       	call   464d <exit>
+    printf(1, "cannot create inlinef\n");
+    2823:	50                   	push   %eax
+    2824:	50                   	push   %eax
+    2825:	68 95 57 00 00       	push   $0x5795
+    282a:	6a 01                	push   $0x1
+    282c:	e8 bf 20 00 00       	call   48f0 <printf>
+    exit();
+    2831:	e8 17 1e 00 00       	call   464d <exit>
+    printf(1, "read inlinef wrong size\n");
+    2836:	51                   	push   %ecx
+    2837:	51                   	push   %ecx
+    2838:	68 d7 57 00 00       	push   $0x57d7
+    283d:	6a 01                	push   $0x1
+    283f:	e8 ac 20 00 00       	call   48f0 <printf>
+    exit();
+    2844:	e8 04 1e 00 00       	call   464d <exit>
+    printf(1, "cannot open inlinef\n");
+    2849:	53                   	push   %ebx
+    284a:	53                   	push   %ebx
+    284b:	68 c2 57 00 00       	push   $0x57c2
+    2850:	6a 01                	push   $0x1
+    2852:	e8 99 20 00 00       	call   48f0 <printf>
+    exit();
+    2857:	e8 f1 1d 00 00       	call   464d <exit>
+    285c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002860 <fallocatetest>:
+{
+    2860:	55                   	push   %ebp
+    2861:	89 e5                	mov    %esp,%ebp
+    2863:	56                   	push   %esi
+    2864:	53                   	push   %ebx
+    2865:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "fallocate test\n");
+    2868:	68 00 58 00 00       	push   $0x5800
+    286d:	6a 01                	push   $0x1
+    286f:	e8 7c 20 00 00       	call   48f0 <printf>
+  unlink("falloc");
+    2874:	c7 04 24 10 58 00 00 	movl   $0x5810,(%esp)
+    287b:	e8 63 1e 00 00       	call   46e3 <unlink>
+  fd = open("falloc", O_CREATE | O_RDWR);
+    2880:	59                   	pop    %ecx
+    2881:	5b                   	pop    %ebx
+    2882:	68 02 02 00 00       	push   $0x202
+    2887:	68 10 58 00 00       	push   $0x5810
+    288c:	e8 34 1e 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2891:	83 c4 10             	add    $0x10,%esp
+    2894:	85 c0                	test   %eax,%eax
+    2896:	0f 88 bd 01 00 00    	js     2a59 <fallocatetest+0x1f9>
+  memset(buf, 'x', 600);
+    289c:	83 ec 04             	sub    $0x4,%esp
+    289f:	89 c6                	mov    %eax,%esi
+    28a1:	68 58 02 00 00       	push   $0x258
+    28a6:	6a 78                	push   $0x78
+    28a8:	68 a0 9a 00 00       	push   $0x9aa0
+    28ad:	e8 1e 1b 00 00       	call   43d0 <memset>
+  if(write(fd, buf, 10) != 10){
+    28b2:	83 c4 0c             	add    $0xc,%esp
+    28b5:	6a 0a                	push   $0xa
+    28b7:	68 a0 9a 00 00       	push   $0x9aa0
+    28bc:	56                   	push   %esi
+    28bd:	e8 c7 1d 00 00       	call   4689 <write>
+    28c2:	83 c4 10             	add    $0x10,%esp
+    28c5:	83 f8 0a             	cmp    $0xa,%eax
+    28c8:	0f 85 78 01 00 00    	jne    2a46 <fallocatetest+0x1e6>
+  if(fallocate(fd, 0, 3000) != 0){
+    28ce:	83 ec 04             	sub    $0x4,%esp
+    28d1:	68 b8 0b 00 00       	push   $0xbb8
+    28d6:	6a 00                	push   $0x0
+    28d8:	56                   	push   %esi
+    28d9:	e8 7d 1e 00 00       	call   475b <fallocate>
+    28de:	83 c4 10             	add    $0x10,%esp
+    28e1:	89 c3                	mov    %eax,%ebx
+    28e3:	85 c0                	test   %eax,%eax
+    28e5:	0f 85 48 01 00 00    	jne    2a33 <fallocatetest+0x1d3>
+  if(fstat(fd, &st) < 0 || st.size != 3000){
+    28eb:	83 ec 08             	sub    $0x8,%esp
+    28ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    28f1:	50                   	push   %eax
+    28f2:	56                   	push   %esi
+    28f3:	e8 fa 1d 00 00       	call   46f2 <fstat>
+    28f8:	83 c4 10             	add    $0x10,%esp
+    28fb:	85 c0                	test   %eax,%eax
+    28fd:	0f 88 1d 01 00 00    	js     2a20 <fallocatetest+0x1c0>
+    2903:	81 7d f4 b8 0b 00 00 	cmpl   $0xbb8,-0xc(%ebp)
+    290a:	0f 85 10 01 00 00    	jne    2a20 <fallocatetest+0x1c0>
+  if(write(fd, buf, 600) != 600){
+    2910:	83 ec 04             	sub    $0x4,%esp
+    2913:	68 58 02 00 00       	push   $0x258
+    2918:	68 a0 9a 00 00       	push   $0x9aa0
+    291d:	56                   	push   %esi
+    291e:	e8 66 1d 00 00       	call   4689 <write>
+    2923:	83 c4 10             	add    $0x10,%esp
+    2926:	3d 58 02 00 00       	cmp    $0x258,%eax
+    292b:	0f 85 dc 00 00 00    	jne    2a0d <fallocatetest+0x1ad>
+  close(fd);
+    2931:	83 ec 0c             	sub    $0xc,%esp
+    2934:	56                   	push   %esi
+    2935:	e8 5e 1d 00 00       	call   4698 <close>
+  fd = open("falloc", 0);
+    293a:	5e                   	pop    %esi
+    293b:	58                   	pop    %eax
+    293c:	6a 00                	push   $0x0
+    293e:	68 10 58 00 00       	push   $0x5810
+    2943:	e8 7d 1d 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2948:	83 c4 10             	add    $0x10,%esp
+  fd = open("falloc", 0);
+    294b:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    294d:	85 c0                	test   %eax,%eax
+    294f:	0f 88 a5 00 00 00    	js     29fa <fallocatetest+0x19a>
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    2955:	83 ec 04             	sub    $0x4,%esp
+    2958:	68 00 20 00 00       	push   $0x2000
+    295d:	68 a0 9a 00 00       	push   $0x9aa0
+    2962:	50                   	push   %eax
+    2963:	e8 12 1d 00 00       	call   467a <read>
+    2968:	83 c4 10             	add    $0x10,%esp
+    296b:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2970:	75 75                	jne    29e7 <fallocatetest+0x187>
+    2972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(buf[i] != (i < 610 ? 'x' : 0)){
+    2978:	0f be 83 a0 9a 00 00 	movsbl 0x9aa0(%ebx),%eax
+    297f:	81 fb 61 02 00 00    	cmp    $0x261,%ebx
+    2985:	7e 41                	jle    29c8 <fallocatetest+0x168>
+    2987:	85 c0                	test   %eax,%eax
+    2989:	75 47                	jne    29d2 <fallocatetest+0x172>
+  for(i = 0; i < 3000; i++){
+    298b:	83 c3 01             	add    $0x1,%ebx
+    298e:	81 fb b8 0b 00 00    	cmp    $0xbb8,%ebx
+    2994:	75 e2                	jne    2978 <fallocatetest+0x118>
+  close(fd);
+    2996:	83 ec 0c             	sub    $0xc,%esp
+    2999:	56                   	push   %esi
+    299a:	e8 f9 1c 00 00       	call   4698 <close>
+  unlink("falloc");
+    299f:	c7 04 24 10 58 00 00 	movl   $0x5810,(%esp)
+    29a6:	e8 38 1d 00 00       	call   46e3 <unlink>
+  printf(1, "fallocate test ok\n");
+    29ab:	58                   	pop    %eax
+    29ac:	5a                   	pop    %edx
+    29ad:	68 b4 58 00 00       	push   $0x58b4
+    29b2:	6a 01                	push   $0x1
+    29b4:	e8 37 1f 00 00       	call   48f0 <printf>
+}
+    29b9:	83 c4 10             	add    $0x10,%esp
+    29bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    29bf:	5b                   	pop    %ebx
+    29c0:	5e                   	pop    %esi
+    29c1:	5d                   	pop    %ebp
+    29c2:	c3                   	ret
+    29c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    29c7:	90                   	nop
+    if(buf[i] != (i < 610 ? 'x' : 0)){
+    29c8:	83 f8 78             	cmp    $0x78,%eax
+    29cb:	75 05                	jne    29d2 <fallocatetest+0x172>
+  for(i = 0; i < 3000; i++){
+    29cd:	83 c3 01             	add    $0x1,%ebx
+    29d0:	eb a6                	jmp    2978 <fallocatetest+0x118>
+      printf(1, "read falloc wrong data at %d\n", i);
+    29d2:	83 ec 04             	sub    $0x4,%esp
+    29d5:	53                   	push   %ebx
+    29d6:	68 96 58 00 00       	push   $0x5896
+    29db:	6a 01                	push   $0x1
+    29dd:	e8 0e 1f 00 00       	call   48f0 <printf>
+      exit();
+    29e2:	e8 66 1c 00 00       	call   464d <exit>
+    printf(1, "read falloc wrong size\n");
+    29e7:	51                   	push   %ecx
+    29e8:	51                   	push   %ecx
+    29e9:	68 7e 58 00 00       	push   $0x587e
+    29ee:	6a 01                	push   $0x1
+    29f0:	e8 fb 1e 00 00       	call   48f0 <printf>
+    exit();
+    29f5:	e8 53 1c 00 00       	call   464d <exit>
+    printf(1, "cannot open falloc\n");
+    29fa:	53                   	push   %ebx
+    29fb:	53                   	push   %ebx
+    29fc:	68 6a 58 00 00       	push   $0x586a
+    2a01:	6a 01                	push   $0x1
+    2a03:	e8 e8 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a08:	e8 40 1c 00 00       	call   464d <exit>
+    printf(1, "write into fallocated blocks failed\n");
+    2a0d:	50                   	push   %eax
+    2a0e:	50                   	push   %eax
+    2a0f:	68 40 63 00 00       	push   $0x6340
+    2a14:	6a 01                	push   $0x1
+    2a16:	e8 d5 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a1b:	e8 2d 1c 00 00       	call   464d <exit>
+    printf(1, "fallocate wrong size\n");
+    2a20:	50                   	push   %eax
+    2a21:	50                   	push   %eax
+    2a22:	68 54 58 00 00       	push   $0x5854
+    2a27:	6a 01                	push   $0x1
+    2a29:	e8 c2 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a2e:	e8 1a 1c 00 00       	call   464d <exit>
+    printf(1, "fallocate failed\n");
+    2a33:	50                   	push   %eax
+    2a34:	50                   	push   %eax
+    2a35:	68 42 58 00 00       	push   $0x5842
+    2a3a:	6a 01                	push   $0x1
+    2a3c:	e8 af 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a41:	e8 07 1c 00 00       	call   464d <exit>
+    printf(1, "write falloc failed\n");
+    2a46:	50                   	push   %eax
+    2a47:	50                   	push   %eax
+    2a48:	68 2d 58 00 00       	push   $0x582d
+    2a4d:	6a 01                	push   $0x1
+    2a4f:	e8 9c 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a54:	e8 f4 1b 00 00       	call   464d <exit>
+    printf(1, "cannot create falloc\n");
+    2a59:	52                   	push   %edx
+    2a5a:	52                   	push   %edx
+    2a5b:	68 17 58 00 00       	push   $0x5817
+    2a60:	6a 01                	push   $0x1
+    2a62:	e8 89 1e 00 00       	call   48f0 <printf>
+    exit();
+    2a67:	e8 e1 1b 00 00       	call   464d <exit>
+    2a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002a70 <uiovtest>:
+{
+    2a70:	55                   	push   %ebp
+    2a71:	89 e5                	mov    %esp,%ebp
+    2a73:	56                   	push   %esi
+    2a74:	53                   	push   %ebx
+    2a75:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "pread/readv test\n");
+    2a78:	68 c7 58 00 00       	push   $0x58c7
+    2a7d:	6a 01                	push   $0x1
+    2a7f:	e8 6c 1e 00 00       	call   48f0 <printf>
+  unlink("uiov");
+    2a84:	c7 04 24 d9 58 00 00 	movl   $0x58d9,(%esp)
+    2a8b:	e8 53 1c 00 00       	call   46e3 <unlink>
+  fd = open("uiov", O_CREATE | O_RDWR);
+    2a90:	58                   	pop    %eax
+    2a91:	5a                   	pop    %edx
+    2a92:	68 02 02 00 00       	push   $0x202
+    2a97:	68 d9 58 00 00       	push   $0x58d9
+    2a9c:	e8 24 1c 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2aa1:	83 c4 10             	add    $0x10,%esp
+    2aa4:	85 c0                	test   %eax,%eax
+    2aa6:	0f 88 61 02 00 00    	js     2d0d <uiovtest+0x29d>
+  if(write(fd, "aaaaaaaaaa", 10) != 10 || pwrite(fd, "bb", 2, 4) != 2){
+    2aac:	83 ec 04             	sub    $0x4,%esp
+    2aaf:	89 c3                	mov    %eax,%ebx
+    2ab1:	6a 0a                	push   $0xa
+    2ab3:	68 9c 4d 00 00       	push   $0x4d9c
+    2ab8:	50                   	push   %eax
+    2ab9:	e8 cb 1b 00 00       	call   4689 <write>
+    2abe:	83 c4 10             	add    $0x10,%esp
+    2ac1:	83 f8 0a             	cmp    $0xa,%eax
+    2ac4:	0f 85 e4 01 00 00    	jne    2cae <uiovtest+0x23e>
+    2aca:	6a 04                	push   $0x4
+    2acc:	6a 02                	push   $0x2
+    2ace:	68 66 59 00 00       	push   $0x5966
+    2ad3:	53                   	push   %ebx
+    2ad4:	e8 a0 1c 00 00       	call   4779 <pwrite>
+    2ad9:	83 c4 10             	add    $0x10,%esp
+    2adc:	83 f8 02             	cmp    $0x2,%eax
+    2adf:	0f 85 c9 01 00 00    	jne    2cae <uiovtest+0x23e>
+  if(writev(fd, iov, 2) != 3){
+    2ae5:	83 ec 04             	sub    $0x4,%esp
+    2ae8:	8d 75 e8             	lea    -0x18(%ebp),%esi
+  iov[0].iov_base = "cd";
+    2aeb:	c7 45 e8 06 59 00 00 	movl   $0x5906,-0x18(%ebp)
+  iov[0].iov_len = 2;
+    2af2:	c7 45 ec 02 00 00 00 	movl   $0x2,-0x14(%ebp)
+  iov[1].iov_base = "e";
+    2af9:	c7 45 f0 86 59 00 00 	movl   $0x5986,-0x10(%ebp)
+  iov[1].iov_len = 1;
+    2b00:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  if(writev(fd, iov, 2) != 3){
+    2b07:	6a 02                	push   $0x2
+    2b09:	56                   	push   %esi
+    2b0a:	53                   	push   %ebx
+    2b0b:	e8 87 1c 00 00       	call   4797 <writev>
+    2b10:	83 c4 10             	add    $0x10,%esp
+    2b13:	83 f8 03             	cmp    $0x3,%eax
+    2b16:	0f 85 04 02 00 00    	jne    2d20 <uiovtest+0x2b0>
+  if(pread(fd, buf, 4, 3) != 4 || memcmp(buf, "abba", 4) != 0){
+    2b1c:	6a 03                	push   $0x3
+    2b1e:	6a 04                	push   $0x4
+    2b20:	68 a0 9a 00 00       	push   $0x9aa0
+    2b25:	53                   	push   %ebx
+    2b26:	e8 3f 1c 00 00       	call   476a <pread>
+    2b2b:	83 c4 10             	add    $0x10,%esp
+    2b2e:	83 f8 04             	cmp    $0x4,%eax
+    2b31:	0f 85 c3 01 00 00    	jne    2cfa <uiovtest+0x28a>
+    2b37:	83 ec 04             	sub    $0x4,%esp
+    2b3a:	6a 04                	push   $0x4
+    2b3c:	68 34 59 00 00       	push   $0x5934
+    2b41:	68 a0 9a 00 00       	push   $0x9aa0
+    2b46:	e8 05 1a 00 00       	call   4550 <memcmp>
+    2b4b:	83 c4 10             	add    $0x10,%esp
+    2b4e:	85 c0                	test   %eax,%eax
+    2b50:	0f 85 a4 01 00 00    	jne    2cfa <uiovtest+0x28a>
+  close(fd);
+    2b56:	83 ec 0c             	sub    $0xc,%esp
+    2b59:	53                   	push   %ebx
+    2b5a:	e8 39 1b 00 00       	call   4698 <close>
+  fd = open("uiov", 0);
+    2b5f:	58                   	pop    %eax
+    2b60:	5a                   	pop    %edx
+    2b61:	6a 00                	push   $0x0
+    2b63:	68 d9 58 00 00       	push   $0x58d9
+    2b68:	e8 58 1b 00 00       	call   46c5 <open>
+  if(fd < 0){
+    2b6d:	83 c4 10             	add    $0x10,%esp
+  fd = open("uiov", 0);
+    2b70:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2b72:	85 c0                	test   %eax,%eax
+    2b74:	0f 88 cc 01 00 00    	js     2d46 <uiovtest+0x2d6>
+  if(readv(fd, iov, 2) != 13){
+    2b7a:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = buf;
+    2b7d:	c7 45 e8 a0 9a 00 00 	movl   $0x9aa0,-0x18(%ebp)
+  iov[0].iov_len = 6;
+    2b84:	c7 45 ec 06 00 00 00 	movl   $0x6,-0x14(%ebp)
+  iov[1].iov_base = buf + 100;
+    2b8b:	c7 45 f0 04 9b 00 00 	movl   $0x9b04,-0x10(%ebp)
+  iov[1].iov_len = 50;
+    2b92:	c7 45 f4 32 00 00 00 	movl   $0x32,-0xc(%ebp)
+  if(readv(fd, iov, 2) != 13){
+    2b99:	6a 02                	push   $0x2
+    2b9b:	56                   	push   %esi
+    2b9c:	50                   	push   %eax
+    2b9d:	e8 e6 1b 00 00       	call   4788 <readv>
+    2ba2:	83 c4 10             	add    $0x10,%esp
+    2ba5:	83 f8 0d             	cmp    $0xd,%eax
+    2ba8:	0f 85 85 01 00 00    	jne    2d33 <uiovtest+0x2c3>
+  if(memcmp(buf, "aaaabb", 6) != 0 || memcmp(buf + 100, "aaaacde", 7) != 0){
+    2bae:	83 ec 04             	sub    $0x4,%esp
+    2bb1:	6a 06                	push   $0x6
+    2bb3:	68 62 59 00 00       	push   $0x5962
+    2bb8:	68 a0 9a 00 00       	push   $0x9aa0
+    2bbd:	e8 8e 19 00 00       	call   4550 <memcmp>
+    2bc2:	83 c4 10             	add    $0x10,%esp
+    2bc5:	85 c0                	test   %eax,%eax
+    2bc7:	0f 85 1a 01 00 00    	jne    2ce7 <uiovtest+0x277>
+    2bcd:	83 ec 04             	sub    $0x4,%esp
+    2bd0:	6a 07                	push   $0x7
+    2bd2:	68 80 59 00 00       	push   $0x5980
+    2bd7:	68 04 9b 00 00       	push   $0x9b04
+    2bdc:	e8 6f 19 00 00       	call   4550 <memcmp>
+    2be1:	83 c4 10             	add    $0x10,%esp
+    2be4:	85 c0                	test   %eax,%eax
+    2be6:	0f 85 fb 00 00 00    	jne    2ce7 <uiovtest+0x277>
+  close(fd);
+    2bec:	83 ec 0c             	sub    $0xc,%esp
+    2bef:	53                   	push   %ebx
+    2bf0:	e8 a3 1a 00 00       	call   4698 <close>
+  unlink("uiov");
+    2bf5:	c7 04 24 d9 58 00 00 	movl   $0x58d9,(%esp)
+    2bfc:	e8 e2 1a 00 00       	call   46e3 <unlink>
+  if(pipe(p) != 0 || write(p[1], "0123456789", 10) != 10){
+    2c01:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2c04:	89 04 24             	mov    %eax,(%esp)
+    2c07:	e8 5f 1a 00 00       	call   466b <pipe>
+    2c0c:	83 c4 10             	add    $0x10,%esp
+    2c0f:	85 c0                	test   %eax,%eax
+    2c11:	0f 85 bd 00 00 00    	jne    2cd4 <uiovtest+0x264>
+    2c17:	83 ec 04             	sub    $0x4,%esp
+    2c1a:	6a 0a                	push   $0xa
+    2c1c:	68 9a 59 00 00       	push   $0x599a
+    2c21:	ff 75 e4             	push   -0x1c(%ebp)
+    2c24:	e8 60 1a 00 00       	call   4689 <write>
+    2c29:	83 c4 10             	add    $0x10,%esp
+    2c2c:	83 f8 0a             	cmp    $0xa,%eax
+    2c2f:	0f 85 9f 00 00 00    	jne    2cd4 <uiovtest+0x264>
+  if(readv(p[0], iov, 2) != 10 || memcmp(buf, "0123456789", 10) != 0){
+    2c35:	83 ec 04             	sub    $0x4,%esp
+  iov[0].iov_base = buf;
+    2c38:	c7 45 e8 a0 9a 00 00 	movl   $0x9aa0,-0x18(%ebp)
+  iov[0].iov_len = 10;
+    2c3f:	c7 45 ec 0a 00 00 00 	movl   $0xa,-0x14(%ebp)
+  iov[1].iov_base = buf + 100;
+    2c46:	c7 45 f0 04 9b 00 00 	movl   $0x9b04,-0x10(%ebp)
+  iov[1].iov_len = 10;
+    2c4d:	c7 45 f4 0a 00 00 00 	movl   $0xa,-0xc(%ebp)
+  if(readv(p[0], iov, 2) != 10 || memcmp(buf, "0123456789", 10) != 0){
+    2c54:	6a 02                	push   $0x2
+    2c56:	56                   	push   %esi
+    2c57:	ff 75 e0             	push   -0x20(%ebp)
+    2c5a:	e8 29 1b 00 00       	call   4788 <readv>
+    2c5f:	83 c4 10             	add    $0x10,%esp
+    2c62:	83 f8 0a             	cmp    $0xa,%eax
+    2c65:	75 5a                	jne    2cc1 <uiovtest+0x251>
+    2c67:	83 ec 04             	sub    $0x4,%esp
+    2c6a:	6a 0a                	push   $0xa
+    2c6c:	68 9a 59 00 00       	push   $0x599a
+    2c71:	68 a0 9a 00 00       	push   $0x9aa0
+    2c76:	e8 d5 18 00 00       	call   4550 <memcmp>
+    2c7b:	83 c4 10             	add    $0x10,%esp
+    2c7e:	85 c0                	test   %eax,%eax
+    2c80:	75 3f                	jne    2cc1 <uiovtest+0x251>
+  close(p[0]);
+    2c82:	83 ec 0c             	sub    $0xc,%esp
+    2c85:	ff 75 e0             	push   -0x20(%ebp)
+    2c88:	e8 0b 1a 00 00       	call   4698 <close>
+  close(p[1]);
+    2c8d:	58                   	pop    %eax
+    2c8e:	ff 75 e4             	push   -0x1c(%ebp)
+    2c91:	e8 02 1a 00 00       	call   4698 <close>
+  printf(1, "pread/readv test ok\n");
+    2c96:	5a                   	pop    %edx
+    2c97:	59                   	pop    %ecx
+    2c98:	68 bc 59 00 00       	push   $0x59bc
+    2c9d:	6a 01                	push   $0x1
+    2c9f:	e8 4c 1c 00 00       	call   48f0 <printf>
+}
+    2ca4:	83 c4 10             	add    $0x10,%esp
+    2ca7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2caa:	5b                   	pop    %ebx
+    2cab:	5e                   	pop    %esi
+    2cac:	5d                   	pop    %ebp
+    2cad:	c3                   	ret
+    printf(1, "pwrite uiov failed\n");
+    2cae:	56                   	push   %esi
+    2caf:	56                   	push   %esi
+    2cb0:	68 f2 58 00 00       	push   $0x58f2
+    2cb5:	6a 01                	push   $0x1
+    2cb7:	e8 34 1c 00 00       	call   48f0 <printf>
+    exit();
+    2cbc:	e8 8c 19 00 00       	call   464d <exit>
+    printf(1, "readv pipe wrong data\n");
+    2cc1:	53                   	push   %ebx
+    2cc2:	53                   	push   %ebx
+    2cc3:	68 a5 59 00 00       	push   $0x59a5
+    2cc8:	6a 01                	push   $0x1
+    2cca:	e8 21 1c 00 00       	call   48f0 <printf>
+    exit();
+    2ccf:	e8 79 19 00 00       	call   464d <exit>
+    printf(1, "uiov pipe failed\n");
+    2cd4:	56                   	push   %esi
+    2cd5:	56                   	push   %esi
+    2cd6:	68 88 59 00 00       	push   $0x5988
+    2cdb:	6a 01                	push   $0x1
+    2cdd:	e8 0e 1c 00 00       	call   48f0 <printf>
+    exit();
+    2ce2:	e8 66 19 00 00       	call   464d <exit>
+    printf(1, "readv uiov wrong data\n");
+    2ce7:	50                   	push   %eax
+    2ce8:	50                   	push   %eax
+    2ce9:	68 69 59 00 00       	push   $0x5969
+    2cee:	6a 01                	push   $0x1
+    2cf0:	e8 fb 1b 00 00       	call   48f0 <printf>
+    exit();
+    2cf5:	e8 53 19 00 00       	call   464d <exit>
+    printf(1, "pread uiov wrong data\n");
+    2cfa:	51                   	push   %ecx
+    2cfb:	51                   	push   %ecx
+    2cfc:	68 1d 59 00 00       	push   $0x591d
+    2d01:	6a 01                	push   $0x1
+    2d03:	e8 e8 1b 00 00       	call   48f0 <printf>
+    exit();
+    2d08:	e8 40 19 00 00       	call   464d <exit>
+    printf(1, "cannot create uiov\n");
+    2d0d:	50                   	push   %eax
+    2d0e:	50                   	push   %eax
+    2d0f:	68 de 58 00 00       	push   $0x58de
+    2d14:	6a 01                	push   $0x1
+    2d16:	e8 d5 1b 00 00       	call   48f0 <printf>
+    exit();
+    2d1b:	e8 2d 19 00 00       	call   464d <exit>
+    printf(1, "writev uiov failed\n");
+    2d20:	53                   	push   %ebx
+    2d21:	53                   	push   %ebx
+    2d22:	68 09 59 00 00       	push   $0x5909
+    2d27:	6a 01                	push   $0x1
+    2d29:	e8 c2 1b 00 00       	call   48f0 <printf>
+    exit();
+    2d2e:	e8 1a 19 00 00       	call   464d <exit>
+    printf(1, "readv uiov wrong size\n");
+    2d33:	50                   	push   %eax
+    2d34:	50                   	push   %eax
+    2d35:	68 4b 59 00 00       	push   $0x594b
+    2d3a:	6a 01                	push   $0x1
+    2d3c:	e8 af 1b 00 00       	call   48f0 <printf>
+    exit();
+    2d41:	e8 07 19 00 00       	call   464d <exit>
+    printf(1, "cannot open uiov\n");
+    2d46:	50                   	push   %eax
+    2d47:	50                   	push   %eax
+    2d48:	68 39 59 00 00       	push   $0x5939
+    2d4d:	6a 01                	push   $0x1
+    2d4f:	e8 9c 1b 00 00       	call   48f0 <printf>
+    exit();
+    2d54:	e8 f4 18 00 00       	call   464d <exit>
+    2d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002d60 <splicetest>:
+{
+    2d60:	55                   	push   %ebp
+    2d61:	89 e5                	mov    %esp,%ebp
+    2d63:	57                   	push   %edi
+    2d64:	56                   	push   %esi
+    2d65:	53                   	push   %ebx
+    2d66:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "splice test\n");
+    2d69:	68 d1 59 00 00       	push   $0x59d1
+    2d6e:	6a 01                	push   $0x1
+    2d70:	e8 7b 1b 00 00       	call   48f0 <printf>
+  unlink("splice0");
+    2d75:	c7 04 24 de 59 00 00 	movl   $0x59de,(%esp)
+    2d7c:	e8 62 19 00 00       	call   46e3 <unlink>
+  unlink("splice1");
+    2d81:	c7 04 24 e6 59 00 00 	movl   $0x59e6,(%esp)
+    2d88:	e8 56 19 00 00       	call   46e3 <unlink>
+  fd = open("splice0", O_CREATE | O_RDWR);
+    2d8d:	5e                   	pop    %esi
+    2d8e:	5f                   	pop    %edi
+    2d8f:	68 02 02 00 00       	push   $0x202
+    2d94:	68 de 59 00 00       	push   $0x59de
+    2d99:	e8 27 19 00 00       	call   46c5 <open>
+    2d9e:	89 c6                	mov    %eax,%esi
+  fd1 = open("splice1", O_CREATE | O_RDWR);
+    2da0:	58                   	pop    %eax
+    2da1:	5a                   	pop    %edx
+    2da2:	68 02 02 00 00       	push   $0x202
+    2da7:	68 e6 59 00 00       	push   $0x59e6
+    2dac:	e8 14 19 00 00       	call   46c5 <open>
+  if(fd < 0 || fd1 < 0 || pipe(p) != 0){
+    2db1:	83 c4 10             	add    $0x10,%esp
+  fd1 = open("splice1", O_CREATE | O_RDWR);
+    2db4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0 || fd1 < 0 || pipe(p) != 0){
+    2db6:	89 f0                	mov    %esi,%eax
+    2db8:	09 d8                	or     %ebx,%eax
+    2dba:	0f 88 21 02 00 00    	js     2fe1 <splicetest+0x281>
+    2dc0:	83 ec 0c             	sub    $0xc,%esp
+    2dc3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2dc6:	50                   	push   %eax
+    2dc7:	e8 9f 18 00 00       	call   466b <pipe>
+    2dcc:	83 c4 10             	add    $0x10,%esp
+    2dcf:	89 c1                	mov    %eax,%ecx
+    2dd1:	85 c0                	test   %eax,%eax
+    2dd3:	0f 85 08 02 00 00    	jne    2fe1 <splicetest+0x281>
+    buf[i] = 'a' + i % 26;
+    2dd9:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+    2dde:	66 90                	xchg   %ax,%ax
+    2de0:	89 c8                	mov    %ecx,%eax
+    2de2:	f7 e7                	mul    %edi
+    2de4:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < 3000; i++)
+    2de6:	83 c1 01             	add    $0x1,%ecx
+    buf[i] = 'a' + i % 26;
+    2de9:	c1 ea 03             	shr    $0x3,%edx
+    2dec:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2def:	29 d0                	sub    %edx,%eax
+    2df1:	83 c0 61             	add    $0x61,%eax
+    2df4:	88 81 9f 9a 00 00    	mov    %al,0x9a9f(%ecx)
+  for(i = 0; i < 3000; i++)
+    2dfa:	81 f9 b8 0b 00 00    	cmp    $0xbb8,%ecx
+    2e00:	75 de                	jne    2de0 <splicetest+0x80>
+  if(write(fd, buf, 3000) != 3000){
+    2e02:	83 ec 04             	sub    $0x4,%esp
+    2e05:	68 b8 0b 00 00       	push   $0xbb8
+    2e0a:	68 a0 9a 00 00       	push   $0x9aa0
+    2e0f:	56                   	push   %esi
+    2e10:	e8 74 18 00 00       	call   4689 <write>
+    2e15:	83 c4 10             	add    $0x10,%esp
+    2e18:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2e1d:	0f 85 ab 01 00 00    	jne    2fce <splicetest+0x26e>
+  close(fd);
+    2e23:	83 ec 0c             	sub    $0xc,%esp
+    2e26:	56                   	push   %esi
+    2e27:	e8 6c 18 00 00       	call   4698 <close>
+  fd = open("splice0", 0);
+    2e2c:	58                   	pop    %eax
+    2e2d:	5a                   	pop    %edx
+    2e2e:	6a 00                	push   $0x0
+    2e30:	68 de 59 00 00       	push   $0x59de
+    2e35:	e8 8b 18 00 00       	call   46c5 <open>
+  if(splice(fd, p[1], 5000) != 3000 || splice(fd, p[1], 5000) != 0){
+    2e3a:	83 c4 0c             	add    $0xc,%esp
+    2e3d:	68 88 13 00 00       	push   $0x1388
+  fd = open("splice0", 0);
+    2e42:	89 c7                	mov    %eax,%edi
+  if(splice(fd, p[1], 5000) != 3000 || splice(fd, p[1], 5000) != 0){
+    2e44:	ff 75 e4             	push   -0x1c(%ebp)
+    2e47:	50                   	push   %eax
+    2e48:	e8 59 19 00 00       	call   47a6 <splice>
+    2e4d:	83 c4 10             	add    $0x10,%esp
+    2e50:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2e55:	0f 85 60 01 00 00    	jne    2fbb <splicetest+0x25b>
+    2e5b:	83 ec 04             	sub    $0x4,%esp
+    2e5e:	68 88 13 00 00       	push   $0x1388
+    2e63:	ff 75 e4             	push   -0x1c(%ebp)
+    2e66:	57                   	push   %edi
+    2e67:	e8 3a 19 00 00       	call   47a6 <splice>
+    2e6c:	83 c4 10             	add    $0x10,%esp
+    2e6f:	85 c0                	test   %eax,%eax
+    2e71:	0f 85 44 01 00 00    	jne    2fbb <splicetest+0x25b>
+  close(p[1]);
+    2e77:	83 ec 0c             	sub    $0xc,%esp
+    2e7a:	ff 75 e4             	push   -0x1c(%ebp)
+    2e7d:	e8 16 18 00 00       	call   4698 <close>
+  if(splice(p[0], fd1, 5000) != 3000 || splice(p[0], fd1, 5000) != 0){
+    2e82:	83 c4 0c             	add    $0xc,%esp
+    2e85:	68 88 13 00 00       	push   $0x1388
+    2e8a:	53                   	push   %ebx
+    2e8b:	ff 75 e0             	push   -0x20(%ebp)
+    2e8e:	e8 13 19 00 00       	call   47a6 <splice>
+    2e93:	83 c4 10             	add    $0x10,%esp
+    2e96:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2e9b:	0f 85 07 01 00 00    	jne    2fa8 <splicetest+0x248>
+    2ea1:	83 ec 04             	sub    $0x4,%esp
+    2ea4:	68 88 13 00 00       	push   $0x1388
+    2ea9:	53                   	push   %ebx
+    2eaa:	ff 75 e0             	push   -0x20(%ebp)
+    2ead:	e8 f4 18 00 00       	call   47a6 <splice>
+    2eb2:	83 c4 10             	add    $0x10,%esp
+    2eb5:	89 c6                	mov    %eax,%esi
+    2eb7:	85 c0                	test   %eax,%eax
+    2eb9:	0f 85 e9 00 00 00    	jne    2fa8 <splicetest+0x248>
+  close(p[0]);
+    2ebf:	83 ec 0c             	sub    $0xc,%esp
+    2ec2:	ff 75 e0             	push   -0x20(%ebp)
+    2ec5:	e8 ce 17 00 00       	call   4698 <close>
+  close(fd);
+    2eca:	89 3c 24             	mov    %edi,(%esp)
+    2ecd:	e8 c6 17 00 00       	call   4698 <close>
+  close(fd1);
+    2ed2:	89 1c 24             	mov    %ebx,(%esp)
+    2ed5:	e8 be 17 00 00       	call   4698 <close>
+  fd = open("splice1", 0);
+    2eda:	5b                   	pop    %ebx
+    2edb:	5f                   	pop    %edi
+    2edc:	6a 00                	push   $0x0
+    2ede:	68 e6 59 00 00       	push   $0x59e6
+    2ee3:	e8 dd 17 00 00       	call   46c5 <open>
+  memset(buf, 0, 3000);
+    2ee8:	83 c4 0c             	add    $0xc,%esp
+    2eeb:	68 b8 0b 00 00       	push   $0xbb8
+  fd = open("splice1", 0);
+    2ef0:	89 c3                	mov    %eax,%ebx
+  memset(buf, 0, 3000);
+    2ef2:	6a 00                	push   $0x0
+    2ef4:	68 a0 9a 00 00       	push   $0x9aa0
+    2ef9:	e8 d2 14 00 00       	call   43d0 <memset>
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    2efe:	83 c4 0c             	add    $0xc,%esp
+    2f01:	68 00 20 00 00       	push   $0x2000
+    2f06:	68 a0 9a 00 00       	push   $0x9aa0
+    2f0b:	53                   	push   %ebx
+    2f0c:	e8 69 17 00 00       	call   467a <read>
+    2f11:	83 c4 10             	add    $0x10,%esp
+    2f14:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    2f19:	75 7a                	jne    2f95 <splicetest+0x235>
+    if(buf[i] != 'a' + i % 26){
+    2f1b:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+    2f20:	89 f0                	mov    %esi,%eax
+    2f22:	0f be 8e a0 9a 00 00 	movsbl 0x9aa0(%esi),%ecx
+    2f29:	f7 e7                	mul    %edi
+    2f2b:	89 f0                	mov    %esi,%eax
+    2f2d:	c1 ea 03             	shr    $0x3,%edx
+    2f30:	6b d2 1a             	imul   $0x1a,%edx,%edx
+    2f33:	29 d0                	sub    %edx,%eax
+    2f35:	83 c0 61             	add    $0x61,%eax
+    2f38:	39 c1                	cmp    %eax,%ecx
+    2f3a:	75 45                	jne    2f81 <splicetest+0x221>
+  for(i = 0; i < 3000; i++){
+    2f3c:	83 c6 01             	add    $0x1,%esi
+    2f3f:	81 fe b8 0b 00 00    	cmp    $0xbb8,%esi
+    2f45:	75 d9                	jne    2f20 <splicetest+0x1c0>
+  close(fd);
+    2f47:	83 ec 0c             	sub    $0xc,%esp
+    2f4a:	53                   	push   %ebx
+    2f4b:	e8 48 17 00 00       	call   4698 <close>
+  unlink("splice0");
+    2f50:	c7 04 24 de 59 00 00 	movl   $0x59de,(%esp)
+    2f57:	e8 87 17 00 00       	call   46e3 <unlink>
+  unlink("splice1");
+    2f5c:	c7 04 24 e6 59 00 00 	movl   $0x59e6,(%esp)
+    2f63:	e8 7b 17 00 00       	call   46e3 <unlink>
+  printf(1, "splice test ok\n");
+    2f68:	58                   	pop    %eax
+    2f69:	5a                   	pop    %edx
+    2f6a:	68 79 5a 00 00       	push   $0x5a79
+    2f6f:	6a 01                	push   $0x1
+    2f71:	e8 7a 19 00 00       	call   48f0 <printf>
+}
+    2f76:	83 c4 10             	add    $0x10,%esp
+    2f79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2f7c:	5b                   	pop    %ebx
+    2f7d:	5e                   	pop    %esi
+    2f7e:	5f                   	pop    %edi
+    2f7f:	5d                   	pop    %ebp
+    2f80:	c3                   	ret
+      printf(1, "splice1 wrong data\n");
+    2f81:	83 ec 08             	sub    $0x8,%esp
+    2f84:	68 65 5a 00 00       	push   $0x5a65
+    2f89:	6a 01                	push   $0x1
+    2f8b:	e8 60 19 00 00       	call   48f0 <printf>
+      exit();
+    2f90:	e8 b8 16 00 00       	call   464d <exit>
+    printf(1, "splice1 wrong size\n");
+    2f95:	51                   	push   %ecx
+    2f96:	51                   	push   %ecx
+    2f97:	68 51 5a 00 00       	push   $0x5a51
+    2f9c:	6a 01                	push   $0x1
+    2f9e:	e8 4d 19 00 00       	call   48f0 <printf>
+    exit();
+    2fa3:	e8 a5 16 00 00       	call   464d <exit>
+    printf(1, "splice pipe to file failed\n");
+    2fa8:	50                   	push   %eax
+    2fa9:	50                   	push   %eax
+    2faa:	68 35 5a 00 00       	push   $0x5a35
+    2faf:	6a 01                	push   $0x1
+    2fb1:	e8 3a 19 00 00       	call   48f0 <printf>
+    exit();
+    2fb6:	e8 92 16 00 00       	call   464d <exit>
+    printf(1, "splice file to pipe failed\n");
+    2fbb:	50                   	push   %eax
+    2fbc:	50                   	push   %eax
+    2fbd:	68 19 5a 00 00       	push   $0x5a19
+    2fc2:	6a 01                	push   $0x1
+    2fc4:	e8 27 19 00 00       	call   48f0 <printf>
+    exit();
+    2fc9:	e8 7f 16 00 00       	call   464d <exit>
+    printf(1, "write splice0 failed\n");
+    2fce:	51                   	push   %ecx
+    2fcf:	51                   	push   %ecx
+    2fd0:	68 03 5a 00 00       	push   $0x5a03
+    2fd5:	6a 01                	push   $0x1
+    2fd7:	e8 14 19 00 00       	call   48f0 <printf>
+    exit();
+    2fdc:	e8 6c 16 00 00       	call   464d <exit>
+    printf(1, "splice setup failed\n");
+    2fe1:	53                   	push   %ebx
+    2fe2:	53                   	push   %ebx
+    2fe3:	68 ee 59 00 00       	push   $0x59ee
+    2fe8:	6a 01                	push   $0x1
+    2fea:	e8 01 19 00 00       	call   48f0 <printf>
+    exit();
+    2fef:	e8 59 16 00 00       	call   464d <exit>
+    2ff4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ffb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2fff:	90                   	nop
+
+00003000 <nanosleeptest>:
+{
+    3000:	55                   	push   %ebp
+    3001:	89 e5                	mov    %esp,%ebp
+    3003:	56                   	push   %esi
+    3004:	53                   	push   %ebx
+  if(nanosleep(&ts) != -1){
+    3005:	8d 75 e8             	lea    -0x18(%ebp),%esi
+{
+    3008:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "nanosleep test\n");
+    300b:	68 89 5a 00 00       	push   $0x5a89
+    3010:	6a 01                	push   $0x1
+    3012:	e8 d9 18 00 00       	call   48f0 <printf>
+  ts.tv_sec = 0;
+    3017:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  ts.tv_nsec = 1000000000;
+    301e:	c7 45 ec 00 ca 9a 3b 	movl   $0x3b9aca00,-0x14(%ebp)
+  if(nanosleep(&ts) != -1){
+    3025:	89 34 24             	mov    %esi,(%esp)
+    3028:	e8 0f 18 00 00       	call   483c <nanosleep>
+    302d:	83 c4 10             	add    $0x10,%esp
+    3030:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3033:	0f 85 c0 00 00 00    	jne    30f9 <nanosleeptest+0xf9>
+  ts.tv_nsec = 50000000;
+    3039:	c7 45 ec 80 f0 fa 02 	movl   $0x2faf080,-0x14(%ebp)
+  t0 = uptime();
+    3040:	e8 6b 15 00 00       	call   45b0 <uptime>
+  if(nanosleep(&ts) != 0){
+    3045:	83 ec 0c             	sub    $0xc,%esp
+    3048:	56                   	push   %esi
+  t0 = uptime();
+    3049:	89 c3                	mov    %eax,%ebx
+  if(nanosleep(&ts) != 0){
+    304b:	e8 ec 17 00 00       	call   483c <nanosleep>
+    3050:	83 c4 10             	add    $0x10,%esp
+    3053:	85 c0                	test   %eax,%eax
+    3055:	0f 85 35 01 00 00    	jne    3190 <nanosleeptest+0x190>
+  t1 = uptime();
+    305b:	e8 50 15 00 00       	call   45b0 <uptime>
+  if(t1 - t0 < 4 || t1 - t0 > 50){
+    3060:	29 d8                	sub    %ebx,%eax
+    3062:	8d 50 fc             	lea    -0x4(%eax),%edx
+    3065:	83 fa 2e             	cmp    $0x2e,%edx
+    3068:	0f 87 0f 01 00 00    	ja     317d <nanosleeptest+0x17d>
+  if(pipe(p) < 0){
+    306e:	83 ec 0c             	sub    $0xc,%esp
+    3071:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3074:	50                   	push   %eax
+    3075:	e8 f1 15 00 00       	call   466b <pipe>
+    307a:	83 c4 10             	add    $0x10,%esp
+    307d:	85 c0                	test   %eax,%eax
+    307f:	0f 88 e5 00 00 00    	js     316a <nanosleeptest+0x16a>
+  pid = fork();
+    3085:	e8 b4 15 00 00       	call   463e <fork>
+    308a:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    308c:	85 c0                	test   %eax,%eax
+    308e:	0f 88 c3 00 00 00    	js     3157 <nanosleeptest+0x157>
+  if(pid == 0){
+    3094:	0f 84 85 00 00 00    	je     311f <nanosleeptest+0x11f>
+  close(p[1]);
+    309a:	83 ec 0c             	sub    $0xc,%esp
+    309d:	ff 75 f4             	push   -0xc(%ebp)
+    30a0:	e8 f3 15 00 00       	call   4698 <close>
+  sleep(5);
+    30a5:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+    30ac:	e8 9b 16 00 00       	call   474c <sleep>
+  kill(pid);
+    30b1:	89 1c 24             	mov    %ebx,(%esp)
+    30b4:	e8 ee 15 00 00       	call   46a7 <kill>
+  wait();
+    30b9:	e8 9e 15 00 00       	call   465c <wait>
+  if(read(p[0], &c, 1) != 0){
+    30be:	83 c4 0c             	add    $0xc,%esp
+    30c1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    30c4:	6a 01                	push   $0x1
+    30c6:	50                   	push   %eax
+    30c7:	ff 75 f0             	push   -0x10(%ebp)
+    30ca:	e8 ab 15 00 00       	call   467a <read>
+    30cf:	83 c4 10             	add    $0x10,%esp
+    30d2:	85 c0                	test   %eax,%eax
+    30d4:	75 36                	jne    310c <nanosleeptest+0x10c>
+  close(p[0]);
+    30d6:	83 ec 0c             	sub    $0xc,%esp
+    30d9:	ff 75 f0             	push   -0x10(%ebp)
+    30dc:	e8 b7 15 00 00       	call   4698 <close>
+  printf(1, "nanosleep ok\n");
+    30e1:	58                   	pop    %eax
+    30e2:	5a                   	pop    %edx
+    30e3:	68 c9 5a 00 00       	push   $0x5ac9
+    30e8:	6a 01                	push   $0x1
+    30ea:	e8 01 18 00 00       	call   48f0 <printf>
+}
+    30ef:	83 c4 10             	add    $0x10,%esp
+    30f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    30f5:	5b                   	pop    %ebx
+    30f6:	5e                   	pop    %esi
+    30f7:	5d                   	pop    %ebp
+    30f8:	c3                   	ret
+    printf(1, "nanosleep accepted bad tv_nsec\n");
+    30f9:	53                   	push   %ebx
+    30fa:	53                   	push   %ebx
+    30fb:	68 68 63 00 00       	push   $0x6368
+    3100:	6a 01                	push   $0x1
+    3102:	e8 e9 17 00 00       	call   48f0 <printf>
+    exit();
+    3107:	e8 41 15 00 00       	call   464d <exit>
+    printf(1, "nanosleep with huge tv_sec returned\n");
+    310c:	51                   	push   %ecx
+    310d:	51                   	push   %ecx
+    310e:	68 88 63 00 00       	push   $0x6388
+    3113:	6a 01                	push   $0x1
+    3115:	e8 d6 17 00 00       	call   48f0 <printf>
+    exit();
+    311a:	e8 2e 15 00 00       	call   464d <exit>
+    close(p[0]);
+    311f:	83 ec 0c             	sub    $0xc,%esp
+    3122:	ff 75 f0             	push   -0x10(%ebp)
+    3125:	e8 6e 15 00 00       	call   4698 <close>
+    ts.tv_sec = 0xffffffff;
+    312a:	c7 45 e8 ff ff ff ff 	movl   $0xffffffff,-0x18(%ebp)
+    ts.tv_nsec = 999999999;
+    3131:	c7 45 ec ff c9 9a 3b 	movl   $0x3b9ac9ff,-0x14(%ebp)
+    nanosleep(&ts);
+    3138:	89 34 24             	mov    %esi,(%esp)
+    313b:	e8 fc 16 00 00       	call   483c <nanosleep>
+    write(p[1], "x", 1);
+    3140:	83 c4 0c             	add    $0xc,%esp
+    3143:	6a 01                	push   $0x1
+    3145:	68 71 55 00 00       	push   $0x5571
+    314a:	ff 75 f4             	push   -0xc(%ebp)
+    314d:	e8 37 15 00 00       	call   4689 <write>
+    exit();
+    3152:	e8 f6 14 00 00       	call   464d <exit>
+    printf(1, "fork failed\n");
+    3157:	53                   	push   %ebx
+    3158:	53                   	push   %ebx
+    3159:	68 04 5f 00 00       	push   $0x5f04
+    315e:	6a 01                	push   $0x1
+    3160:	e8 8b 17 00 00       	call   48f0 <printf>
+    exit();
+    3165:	e8 e3 14 00 00       	call   464d <exit>
+    printf(1, "pipe failed\n");
+    316a:	56                   	push   %esi
+    316b:	56                   	push   %esi
+    316c:	68 28 5a 00 00       	push   $0x5a28
+    3171:	6a 01                	push   $0x1
+    3173:	e8 78 17 00 00       	call   48f0 <printf>
+    exit();
+    3178:	e8 d0 14 00 00       	call   464d <exit>
+    printf(1, "nanosleep 50ms took %d ticks\n", t1 - t0);
+    317d:	52                   	push   %edx
+    317e:	50                   	push   %eax
+    317f:	68 ab 5a 00 00       	push   $0x5aab
+    3184:	6a 01                	push   $0x1
+    3186:	e8 65 17 00 00       	call   48f0 <printf>
+    exit();
+    318b:	e8 bd 14 00 00       	call   464d <exit>
+    printf(1, "nanosleep failed\n");
+    3190:	51                   	push   %ecx
+    3191:	51                   	push   %ecx
+    3192:	68 99 5a 00 00       	push   $0x5a99
+    3197:	6a 01                	push   $0x1
+    3199:	e8 52 17 00 00       	call   48f0 <printf>
+    exit();
+    319e:	e8 aa 14 00 00       	call   464d <exit>
+    31a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000031b0 <sysentertest>:
+{
+    31b0:	55                   	push   %ebp
+    31b1:	89 e5                	mov    %esp,%ebp
+    31b3:	53                   	push   %ebx
+    31b4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "sysenter TF test\n");
+    31b7:	68 d7 5a 00 00       	push   $0x5ad7
+    31bc:	6a 01                	push   $0x1
+    31be:	e8 2d 17 00 00       	call   48f0 <printf>
+  asm volatile("movl %%esp, %%ecx\n\t"
+    31c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    31c8:	89 e1                	mov    %esp,%ecx
+    31ca:	ba da 31 00 00       	mov    $0x31da,%edx
+    31cf:	9c                   	pushf
+    31d0:	81 0c 24 00 01 00 00 	orl    $0x100,(%esp)
+    31d7:	9d                   	popf
+    31d8:	0f 34                	sysenter
+    31da:	89 c3                	mov    %eax,%ebx
+  if(r != getpid()){
+    31dc:	e8 bf 13 00 00       	call   45a0 <getpid>
+    31e1:	83 c4 10             	add    $0x10,%esp
+    31e4:	39 d8                	cmp    %ebx,%eax
+    31e6:	75 17                	jne    31ff <sysentertest+0x4f>
+  printf(1, "sysenter TF ok\n");
+    31e8:	83 ec 08             	sub    $0x8,%esp
+    31eb:	68 07 5b 00 00       	push   $0x5b07
+    31f0:	6a 01                	push   $0x1
+    31f2:	e8 f9 16 00 00       	call   48f0 <printf>
+}
+    31f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    31fa:	83 c4 10             	add    $0x10,%esp
+    31fd:	c9                   	leave
+    31fe:	c3                   	ret
+    printf(1, "sysenter with TF returned %d\n", r);
+    31ff:	50                   	push   %eax
+    3200:	53                   	push   %ebx
+    3201:	68 e9 5a 00 00       	push   $0x5ae9
+    3206:	6a 01                	push   $0x1
+    3208:	e8 e3 16 00 00       	call   48f0 <printf>
+    exit();
+    320d:	e8 3b 14 00 00       	call   464d <exit>
+    3212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003220 <vdsotest>:
+{
+    3220:	55                   	push   %ebp
+    3221:	89 e5                	mov    %esp,%ebp
+    3223:	56                   	push   %esi
+    3224:	53                   	push   %ebx
+    3225:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "vdso test\n");
+    3228:	68 17 5b 00 00       	push   $0x5b17
+    322d:	6a 01                	push   $0x1
+    322f:	e8 bc 16 00 00       	call   48f0 <printf>
+  if(pipe(fd) != 0){
+    3234:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3237:	89 04 24             	mov    %eax,(%esp)
+    323a:	e8 2c 14 00 00       	call   466b <pipe>
+    323f:	83 c4 10             	add    $0x10,%esp
+    3242:	85 c0                	test   %eax,%eax
+    3244:	0f 85 ad 00 00 00    	jne    32f7 <vdsotest+0xd7>
+  pid = fork();
+    324a:	e8 ef 13 00 00       	call   463e <fork>
+    324f:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    3251:	85 c0                	test   %eax,%eax
+    3253:	0f 88 cd 00 00 00    	js     3326 <vdsotest+0x106>
+  if(pid == 0){
+    3259:	0f 84 ab 00 00 00    	je     330a <vdsotest+0xea>
+  if(read(fd[0], &kpid, sizeof(kpid)) != sizeof(kpid) || kpid != pid){
+    325f:	83 ec 04             	sub    $0x4,%esp
+    3262:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    3265:	6a 04                	push   $0x4
+    3267:	50                   	push   %eax
+    3268:	ff 75 f0             	push   -0x10(%ebp)
+    326b:	e8 0a 14 00 00       	call   467a <read>
+    3270:	83 c4 10             	add    $0x10,%esp
+    3273:	83 f8 04             	cmp    $0x4,%eax
+    3276:	75 57                	jne    32cf <vdsotest+0xaf>
+    3278:	39 5d ec             	cmp    %ebx,-0x14(%ebp)
+    327b:	75 52                	jne    32cf <vdsotest+0xaf>
+  wait();
+    327d:	e8 da 13 00 00       	call   465c <wait>
+  close(fd[0]);
+    3282:	83 ec 0c             	sub    $0xc,%esp
+    3285:	ff 75 f0             	push   -0x10(%ebp)
+    3288:	e8 0b 14 00 00       	call   4698 <close>
+  close(fd[1]);
+    328d:	58                   	pop    %eax
+    328e:	ff 75 f4             	push   -0xc(%ebp)
+    3291:	e8 02 14 00 00       	call   4698 <close>
+  t0 = uptime();
+    3296:	e8 15 13 00 00       	call   45b0 <uptime>
+    329b:	89 c6                	mov    %eax,%esi
+  asm volatile("int %1" : "=a" (t1) : "n" (T_SYSCALL), "0" (SYS_uptime));
+    329d:	b8 0e 00 00 00       	mov    $0xe,%eax
+    32a2:	cd 40                	int    $0x40
+    32a4:	89 c3                	mov    %eax,%ebx
+  if(t1 < t0 || t1 > uptime()){
+    32a6:	83 c4 10             	add    $0x10,%esp
+    32a9:	39 c6                	cmp    %eax,%esi
+    32ab:	7f 37                	jg     32e4 <vdsotest+0xc4>
+    32ad:	e8 fe 12 00 00       	call   45b0 <uptime>
+    32b2:	39 d8                	cmp    %ebx,%eax
+    32b4:	7c 2e                	jl     32e4 <vdsotest+0xc4>
+  printf(1, "vdso ok\n");
+    32b6:	83 ec 08             	sub    $0x8,%esp
+    32b9:	68 22 5b 00 00       	push   $0x5b22
+    32be:	6a 01                	push   $0x1
+    32c0:	e8 2b 16 00 00       	call   48f0 <printf>
+}
+    32c5:	83 c4 10             	add    $0x10,%esp
+    32c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    32cb:	5b                   	pop    %ebx
+    32cc:	5e                   	pop    %esi
+    32cd:	5d                   	pop    %ebp
+    32ce:	c3                   	ret
+    printf(1, "child's getpid() is %d, not %d\n", kpid, pid);
+    32cf:	53                   	push   %ebx
+    32d0:	ff 75 ec             	push   -0x14(%ebp)
+    32d3:	68 b0 63 00 00       	push   $0x63b0
+    32d8:	6a 01                	push   $0x1
+    32da:	e8 11 16 00 00       	call   48f0 <printf>
+    exit();
+    32df:	e8 69 13 00 00       	call   464d <exit>
+    printf(1, "uptime() %d but kernel says %d\n", t0, t1);
+    32e4:	53                   	push   %ebx
+    32e5:	56                   	push   %esi
+    32e6:	68 d0 63 00 00       	push   $0x63d0
+    32eb:	6a 01                	push   $0x1
+    32ed:	e8 fe 15 00 00       	call   48f0 <printf>
+    exit();
+    32f2:	e8 56 13 00 00       	call   464d <exit>
+    printf(1, "pipe() failed\n");
+    32f7:	53                   	push   %ebx
+    32f8:	53                   	push   %ebx
+    32f9:	68 51 4f 00 00       	push   $0x4f51
+    32fe:	6a 01                	push   $0x1
+    3300:	e8 eb 15 00 00       	call   48f0 <printf>
+    exit();
+    3305:	e8 43 13 00 00       	call   464d <exit>
+    kpid = getpid();
+    330a:	e8 91 12 00 00       	call   45a0 <getpid>
+    330f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    write(fd[1], &kpid, sizeof(kpid));
+    3312:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    3315:	52                   	push   %edx
+    3316:	6a 04                	push   $0x4
+    3318:	50                   	push   %eax
+    3319:	ff 75 f4             	push   -0xc(%ebp)
+    331c:	e8 68 13 00 00       	call   4689 <write>
+    exit();
+    3321:	e8 27 13 00 00       	call   464d <exit>
+    printf(1, "fork failed\n");
+    3326:	51                   	push   %ecx
+    3327:	51                   	push   %ecx
+    3328:	68 04 5f 00 00       	push   $0x5f04
+    332d:	6a 01                	push   $0x1
+    332f:	e8 bc 15 00 00       	call   48f0 <printf>
+    exit();
+    3334:	e8 14 13 00 00       	call   464d <exit>
+    3339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003340 <fourteen>:
+{
+    3340:	55                   	push   %ebp
+    3341:	89 e5                	mov    %esp,%ebp
+    3343:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    3346:	68 2b 5b 00 00       	push   $0x5b2b
+    334b:	6a 01                	push   $0x1
+    334d:	e8 9e 15 00 00       	call   48f0 <printf>
+  if(mkdir("12345678901234") != 0){
+    3352:	c7 04 24 66 5b 00 00 	movl   $0x5b66,(%esp)
+    3359:	e8 b2 13 00 00       	call   4710 <mkdir>
+    335e:	83 c4 10             	add    $0x10,%esp
+    3361:	85 c0                	test   %eax,%eax
+    3363:	0f 85 97 00 00 00    	jne    3400 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    3369:	83 ec 0c             	sub    $0xc,%esp
+    336c:	68 f0 63 00 00       	push   $0x63f0
+    3371:	e8 9a 13 00 00       	call   4710 <mkdir>
+    3376:	83 c4 10             	add    $0x10,%esp
+    3379:	85 c0                	test   %eax,%eax
+    337b:	0f 85 de 00 00 00    	jne    345f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3381:	83 ec 08             	sub    $0x8,%esp
+    3384:	68 00 02 00 00       	push   $0x200
+    3389:	68 40 64 00 00       	push   $0x6440
+    338e:	e8 32 13 00 00       	call   46c5 <open>
+  if(fd < 0){
+    3393:	83 c4 10             	add    $0x10,%esp
+    3396:	85 c0                	test   %eax,%eax
+    3398:	0f 88 ae 00 00 00    	js     344c <fourteen+0x10c>
+  close(fd);
+    339e:	83 ec 0c             	sub    $0xc,%esp
+    33a1:	50                   	push   %eax
+    33a2:	e8 f1 12 00 00       	call   4698 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    33a7:	58                   	pop    %eax
+    33a8:	5a                   	pop    %edx
+    33a9:	6a 00                	push   $0x0
+    33ab:	68 b0 64 00 00       	push   $0x64b0
+    33b0:	e8 10 13 00 00       	call   46c5 <open>
+  if(fd < 0){
+    33b5:	83 c4 10             	add    $0x10,%esp
+    33b8:	85 c0                	test   %eax,%eax
+    33ba:	78 7d                	js     3439 <fourteen+0xf9>
+  close(fd);
+    33bc:	83 ec 0c             	sub    $0xc,%esp
+    33bf:	50                   	push   %eax
+    33c0:	e8 d3 12 00 00       	call   4698 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    33c5:	c7 04 24 57 5b 00 00 	movl   $0x5b57,(%esp)
+    33cc:	e8 3f 13 00 00       	call   4710 <mkdir>
+    33d1:	83 c4 10             	add    $0x10,%esp
+    33d4:	85 c0                	test   %eax,%eax
+    33d6:	74 4e                	je     3426 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    33d8:	83 ec 0c             	sub    $0xc,%esp
+    33db:	68 4c 65 00 00       	push   $0x654c
+    33e0:	e8 2b 13 00 00       	call   4710 <mkdir>
+    33e5:	83 c4 10             	add    $0x10,%esp
+    33e8:	85 c0                	test   %eax,%eax
+    33ea:	74 27                	je     3413 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    33ec:	83 ec 08             	sub    $0x8,%esp
+    33ef:	68 75 5b 00 00       	push   $0x5b75
+    33f4:	6a 01                	push   $0x1
+    33f6:	e8 f5 14 00 00       	call   48f0 <printf>
+}
+    33fb:	83 c4 10             	add    $0x10,%esp
+    33fe:	c9                   	leave
+    33ff:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    3400:	50                   	push   %eax
+    3401:	50                   	push   %eax
+    3402:	68 3a 5b 00 00       	push   $0x5b3a
+    3407:	6a 01                	push   $0x1
+    3409:	e8 e2 14 00 00       	call   48f0 <printf>
+    exit();
+    340e:	e8 3a 12 00 00       	call   464d <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3413:	50                   	push   %eax
+    3414:	50                   	push   %eax
+    3415:	68 6c 65 00 00       	push   $0x656c
+    341a:	6a 01                	push   $0x1
+    341c:	e8 cf 14 00 00       	call   48f0 <printf>
+    exit();
+    3421:	e8 27 12 00 00       	call   464d <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    3426:	52                   	push   %edx
+    3427:	52                   	push   %edx
+    3428:	68 1c 65 00 00       	push   $0x651c
+    342d:	6a 01                	push   $0x1
+    342f:	e8 bc 14 00 00       	call   48f0 <printf>
+    exit();
+    3434:	e8 14 12 00 00       	call   464d <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    3439:	51                   	push   %ecx
+    343a:	51                   	push   %ecx
+    343b:	68 e0 64 00 00       	push   $0x64e0
+    3440:	6a 01                	push   $0x1
+    3442:	e8 a9 14 00 00       	call   48f0 <printf>
+    exit();
+    3447:	e8 01 12 00 00       	call   464d <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    344c:	51                   	push   %ecx
+    344d:	51                   	push   %ecx
+    344e:	68 70 64 00 00       	push   $0x6470
+    3453:	6a 01                	push   $0x1
+    3455:	e8 96 14 00 00       	call   48f0 <printf>
+    exit();
+    345a:	e8 ee 11 00 00       	call   464d <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    345f:	50                   	push   %eax
+    3460:	50                   	push   %eax
+    3461:	68 10 64 00 00       	push   $0x6410
+    3466:	6a 01                	push   $0x1
+    3468:	e8 83 14 00 00       	call   48f0 <printf>
+    exit();
+    346d:	e8 db 11 00 00       	call   464d <exit>
+    3472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003480 <rmdot>:
+{
+    3480:	55                   	push   %ebp
+    3481:	89 e5                	mov    %esp,%ebp
+    3483:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    3486:	68 82 5b 00 00       	push   $0x5b82
+    348b:	6a 01                	push   $0x1
+    348d:	e8 5e 14 00 00       	call   48f0 <printf>
+  if(mkdir("dots") != 0){
+    3492:	c7 04 24 8e 5b 00 00 	movl   $0x5b8e,(%esp)
+    3499:	e8 72 12 00 00       	call   4710 <mkdir>
+    349e:	83 c4 10             	add    $0x10,%esp
+    34a1:	85 c0                	test   %eax,%eax
+    34a3:	0f 85 b0 00 00 00    	jne    3559 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    34a9:	83 ec 0c             	sub    $0xc,%esp
+    34ac:	68 8e 5b 00 00       	push   $0x5b8e
+    34b1:	e8 69 12 00 00       	call   471f <chdir>
+    34b6:	83 c4 10             	add    $0x10,%esp
+    34b9:	85 c0                	test   %eax,%eax
+    34bb:	0f 85 1d 01 00 00    	jne    35de <rmdot+0x15e>
+  if(unlink(".") == 0){
+    34c1:	83 ec 0c             	sub    $0xc,%esp
+    34c4:	68 8e 54 00 00       	push   $0x548e
+    34c9:	e8 15 12 00 00       	call   46e3 <unlink>
+    34ce:	83 c4 10             	add    $0x10,%esp
+    34d1:	85 c0                	test   %eax,%eax
+    34d3:	0f 84 f2 00 00 00    	je     35cb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    34d9:	83 ec 0c             	sub    $0xc,%esp
+    34dc:	68 8d 54 00 00       	push   $0x548d
+    34e1:	e8 fd 11 00 00       	call   46e3 <unlink>
+    34e6:	83 c4 10             	add    $0x10,%esp
+    34e9:	85 c0                	test   %eax,%eax
+    34eb:	0f 84 c7 00 00 00    	je     35b8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    34f1:	83 ec 0c             	sub    $0xc,%esp
+    34f4:	68 61 4c 00 00       	push   $0x4c61
+    34f9:	e8 21 12 00 00       	call   471f <chdir>
+    34fe:	83 c4 10             	add    $0x10,%esp
+    3501:	85 c0                	test   %eax,%eax
+    3503:	0f 85 9c 00 00 00    	jne    35a5 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    3509:	83 ec 0c             	sub    $0xc,%esp
+    350c:	68 d6 5b 00 00       	push   $0x5bd6
+    3511:	e8 cd 11 00 00       	call   46e3 <unlink>
+    3516:	83 c4 10             	add    $0x10,%esp
+    3519:	85 c0                	test   %eax,%eax
+    351b:	74 75                	je     3592 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    351d:	83 ec 0c             	sub    $0xc,%esp
+    3520:	68 f4 5b 00 00       	push   $0x5bf4
+    3525:	e8 b9 11 00 00       	call   46e3 <unlink>
+    352a:	83 c4 10             	add    $0x10,%esp
+    352d:	85 c0                	test   %eax,%eax
+    352f:	74 4e                	je     357f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    3531:	83 ec 0c             	sub    $0xc,%esp
+    3534:	68 8e 5b 00 00       	push   $0x5b8e
+    3539:	e8 a5 11 00 00       	call   46e3 <unlink>
+    353e:	83 c4 10             	add    $0x10,%esp
+    3541:	85 c0                	test   %eax,%eax
+    3543:	75 27                	jne    356c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    3545:	83 ec 08             	sub    $0x8,%esp
+    3548:	68 29 5c 00 00       	push   $0x5c29
+    354d:	6a 01                	push   $0x1
+    354f:	e8 9c 13 00 00       	call   48f0 <printf>
+}
+    3554:	83 c4 10             	add    $0x10,%esp
+    3557:	c9                   	leave
+    3558:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    3559:	50                   	push   %eax
+    355a:	50                   	push   %eax
+    355b:	68 93 5b 00 00       	push   $0x5b93
+    3560:	6a 01                	push   $0x1
+    3562:	e8 89 13 00 00       	call   48f0 <printf>
+    exit();
+    3567:	e8 e1 10 00 00       	call   464d <exit>
+    printf(1, "unlink dots failed!\n");
+    356c:	50                   	push   %eax
+    356d:	50                   	push   %eax
+    356e:	68 14 5c 00 00       	push   $0x5c14
+    3573:	6a 01                	push   $0x1
+    3575:	e8 76 13 00 00       	call   48f0 <printf>
+    exit();
+    357a:	e8 ce 10 00 00       	call   464d <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    357f:	52                   	push   %edx
+    3580:	52                   	push   %edx
+    3581:	68 fc 5b 00 00       	push   $0x5bfc
+    3586:	6a 01                	push   $0x1
+    3588:	e8 63 13 00 00       	call   48f0 <printf>
+    exit();
+    358d:	e8 bb 10 00 00       	call   464d <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3592:	51                   	push   %ecx
+    3593:	51                   	push   %ecx
+    3594:	68 dd 5b 00 00       	push   $0x5bdd
+    3599:	6a 01                	push   $0x1
+    359b:	e8 50 13 00 00       	call   48f0 <printf>
+    exit();
+    35a0:	e8 a8 10 00 00       	call   464d <exit>
+    printf(1, "chdir / failed\n");
+    35a5:	50                   	push   %eax
+    35a6:	50                   	push   %eax
+    35a7:	68 63 4c 00 00       	push   $0x4c63
+    35ac:	6a 01                	push   $0x1
+    35ae:	e8 3d 13 00 00       	call   48f0 <printf>
+    exit();
+    35b3:	e8 95 10 00 00       	call   464d <exit>
+    printf(1, "rm .. worked!\n");
+    35b8:	50                   	push   %eax
+    35b9:	50                   	push   %eax
+    35ba:	68 c7 5b 00 00       	push   $0x5bc7
+    35bf:	6a 01                	push   $0x1
+    35c1:	e8 2a 13 00 00       	call   48f0 <printf>
+    exit();
+    35c6:	e8 82 10 00 00       	call   464d <exit>
+    printf(1, "rm . worked!\n");
+    35cb:	50                   	push   %eax
+    35cc:	50                   	push   %eax
+    35cd:	68 b9 5b 00 00       	push   $0x5bb9
+    35d2:	6a 01                	push   $0x1
+    35d4:	e8 17 13 00 00       	call   48f0 <printf>
+    exit();
+    35d9:	e8 6f 10 00 00       	call   464d <exit>
+    printf(1, "chdir dots failed\n");
+    35de:	50                   	push   %eax
+    35df:	50                   	push   %eax
+    35e0:	68 a6 5b 00 00       	push   $0x5ba6
+    35e5:	6a 01                	push   $0x1
+    35e7:	e8 04 13 00 00       	call   48f0 <printf>
+    exit();
+    35ec:	e8 5c 10 00 00       	call   464d <exit>
+    35f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    35ff:	90                   	nop
+
+00003600 <dirfile>:
+{
+    3600:	55                   	push   %ebp
+    3601:	89 e5                	mov    %esp,%ebp
+    3603:	53                   	push   %ebx
+    3604:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3607:	68 33 5c 00 00       	push   $0x5c33
+    360c:	6a 01                	push   $0x1
+    360e:	e8 dd 12 00 00       	call   48f0 <printf>
+  fd = open("dirfile", O_CREATE);
+    3613:	5b                   	pop    %ebx
+    3614:	58                   	pop    %eax
+    3615:	68 00 02 00 00       	push   $0x200
+    361a:	68 40 5c 00 00       	push   $0x5c40
+    361f:	e8 a1 10 00 00       	call   46c5 <open>
+  if(fd < 0){
+    3624:	83 c4 10             	add    $0x10,%esp
+    3627:	85 c0                	test   %eax,%eax
+    3629:	0f 88 43 01 00 00    	js     3772 <dirfile+0x172>
+  close(fd);
+    362f:	83 ec 0c             	sub    $0xc,%esp
+    3632:	50                   	push   %eax
+    3633:	e8 60 10 00 00       	call   4698 <close>
+  if(chdir("dirfile") == 0){
+    3638:	c7 04 24 40 5c 00 00 	movl   $0x5c40,(%esp)
+    363f:	e8 db 10 00 00       	call   471f <chdir>
+    3644:	83 c4 10             	add    $0x10,%esp
+    3647:	85 c0                	test   %eax,%eax
+    3649:	0f 84 10 01 00 00    	je     375f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    364f:	83 ec 08             	sub    $0x8,%esp
+    3652:	6a 00                	push   $0x0
+    3654:	68 79 5c 00 00       	push   $0x5c79
+    3659:	e8 67 10 00 00       	call   46c5 <open>
+  if(fd >= 0){
+    365e:	83 c4 10             	add    $0x10,%esp
+    3661:	85 c0                	test   %eax,%eax
+    3663:	0f 89 e3 00 00 00    	jns    374c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    3669:	83 ec 08             	sub    $0x8,%esp
+    366c:	68 00 02 00 00       	push   $0x200
+    3671:	68 79 5c 00 00       	push   $0x5c79
+    3676:	e8 4a 10 00 00       	call   46c5 <open>
+  if(fd >= 0){
+    367b:	83 c4 10             	add    $0x10,%esp
+    367e:	85 c0                	test   %eax,%eax
+    3680:	0f 89 c6 00 00 00    	jns    374c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3686:	83 ec 0c             	sub    $0xc,%esp
+    3689:	68 79 5c 00 00       	push   $0x5c79
+    368e:	e8 7d 10 00 00       	call   4710 <mkdir>
+    3693:	83 c4 10             	add    $0x10,%esp
+    3696:	85 c0                	test   %eax,%eax
+    3698:	0f 84 46 01 00 00    	je     37e4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    369e:	83 ec 0c             	sub    $0xc,%esp
+    36a1:	68 79 5c 00 00       	push   $0x5c79
+    36a6:	e8 38 10 00 00       	call   46e3 <unlink>
+    36ab:	83 c4 10             	add    $0x10,%esp
+    36ae:	85 c0                	test   %eax,%eax
+    36b0:	0f 84 1b 01 00 00    	je     37d1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    36b6:	83 ec 08             	sub    $0x8,%esp
+    36b9:	68 79 5c 00 00       	push   $0x5c79
+    36be:	68 dd 5c 00 00       	push   $0x5cdd
+    36c3:	e8 39 10 00 00       	call   4701 <link>
+    36c8:	83 c4 10             	add    $0x10,%esp
+    36cb:	85 c0                	test   %eax,%eax
+    36cd:	0f 84 eb 00 00 00    	je     37be <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    36d3:	83 ec 0c             	sub    $0xc,%esp
+    36d6:	68 40 5c 00 00       	push   $0x5c40
+    36db:	e8 03 10 00 00       	call   46e3 <unlink>
+    36e0:	83 c4 10             	add    $0x10,%esp
+    36e3:	85 c0                	test   %eax,%eax
+    36e5:	0f 85 c0 00 00 00    	jne    37ab <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    36eb:	83 ec 08             	sub    $0x8,%esp
+    36ee:	6a 02                	push   $0x2
+    36f0:	68 8e 54 00 00       	push   $0x548e
+    36f5:	e8 cb 0f 00 00       	call   46c5 <open>
+  if(fd >= 0){
+    36fa:	83 c4 10             	add    $0x10,%esp
+    36fd:	85 c0                	test   %eax,%eax
+    36ff:	0f 89 93 00 00 00    	jns    3798 <dirfile+0x198>
+  fd = open(".", 0);
+    3705:	83 ec 08             	sub    $0x8,%esp
+    3708:	6a 00                	push   $0x0
+    370a:	68 8e 54 00 00       	push   $0x548e
+    370f:	e8 b1 0f 00 00       	call   46c5 <open>
+  if(write(fd, "x", 1) > 0){
+    3714:	83 c4 0c             	add    $0xc,%esp
+    3717:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    3719:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    371b:	68 71 55 00 00       	push   $0x5571
+    3720:	50                   	push   %eax
+    3721:	e8 63 0f 00 00       	call   4689 <write>
+    3726:	83 c4 10             	add    $0x10,%esp
+    3729:	85 c0                	test   %eax,%eax
+    372b:	7f 58                	jg     3785 <dirfile+0x185>
+  close(fd);
+    372d:	83 ec 0c             	sub    $0xc,%esp
+    3730:	53                   	push   %ebx
+    3731:	e8 62 0f 00 00       	call   4698 <close>
+  printf(1, "dir vs file OK\n");
+    3736:	58                   	pop    %eax
+    3737:	5a                   	pop    %edx
+    3738:	68 10 5d 00 00       	push   $0x5d10
+    373d:	6a 01                	push   $0x1
+    373f:	e8 ac 11 00 00       	call   48f0 <printf>
+}
+    3744:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3747:	83 c4 10             	add    $0x10,%esp
+    374a:	c9                   	leave
+    374b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    374c:	50                   	push   %eax
+    374d:	50                   	push   %eax
+    374e:	68 84 5c 00 00       	push   $0x5c84
+    3753:	6a 01                	push   $0x1
+    3755:	e8 96 11 00 00       	call   48f0 <printf>
+    exit();
+    375a:	e8 ee 0e 00 00       	call   464d <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    375f:	52                   	push   %edx
+    3760:	52                   	push   %edx
+    3761:	68 5f 5c 00 00       	push   $0x5c5f
+    3766:	6a 01                	push   $0x1
+    3768:	e8 83 11 00 00       	call   48f0 <printf>
+    exit();
+    376d:	e8 db 0e 00 00       	call   464d <exit>
+    printf(1, "create dirfile failed\n");
+    3772:	51                   	push   %ecx
+    3773:	51                   	push   %ecx
+    3774:	68 48 5c 00 00       	push   $0x5c48
+    3779:	6a 01                	push   $0x1
+    377b:	e8 70 11 00 00       	call   48f0 <printf>
+    exit();
+    3780:	e8 c8 0e 00 00       	call   464d <exit>
+    printf(1, "write . succeeded!\n");
+    3785:	51                   	push   %ecx
+    3786:	51                   	push   %ecx
+    3787:	68 fc 5c 00 00       	push   $0x5cfc
+    378c:	6a 01                	push   $0x1
+    378e:	e8 5d 11 00 00       	call   48f0 <printf>
+    exit();
+    3793:	e8 b5 0e 00 00       	call   464d <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3798:	53                   	push   %ebx
+    3799:	53                   	push   %ebx
+    379a:	68 c0 65 00 00       	push   $0x65c0
+    379f:	6a 01                	push   $0x1
+    37a1:	e8 4a 11 00 00       	call   48f0 <printf>
+    exit();
+    37a6:	e8 a2 0e 00 00       	call   464d <exit>
+    printf(1, "unlink dirfile failed!\n");
+    37ab:	50                   	push   %eax
+    37ac:	50                   	push   %eax
+    37ad:	68 e4 5c 00 00       	push   $0x5ce4
+    37b2:	6a 01                	push   $0x1
+    37b4:	e8 37 11 00 00       	call   48f0 <printf>
+    exit();
+    37b9:	e8 8f 0e 00 00       	call   464d <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    37be:	50                   	push   %eax
+    37bf:	50                   	push   %eax
+    37c0:	68 a0 65 00 00       	push   $0x65a0
+    37c5:	6a 01                	push   $0x1
+    37c7:	e8 24 11 00 00       	call   48f0 <printf>
+    exit();
+    37cc:	e8 7c 0e 00 00       	call   464d <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    37d1:	50                   	push   %eax
+    37d2:	50                   	push   %eax
+    37d3:	68 bf 5c 00 00       	push   $0x5cbf
+    37d8:	6a 01                	push   $0x1
+    37da:	e8 11 11 00 00       	call   48f0 <printf>
+    exit();
+    37df:	e8 69 0e 00 00       	call   464d <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    37e4:	50                   	push   %eax
+    37e5:	50                   	push   %eax
+    37e6:	68 a2 5c 00 00       	push   $0x5ca2
+    37eb:	6a 01                	push   $0x1
+    37ed:	e8 fe 10 00 00       	call   48f0 <printf>
+    exit();
+    37f2:	e8 56 0e 00 00       	call   464d <exit>
+    37f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37fe:	66 90                	xchg   %ax,%ax
+
+00003800 <iref>:
+{
+    3800:	55                   	push   %ebp
+    3801:	89 e5                	mov    %esp,%ebp
+    3803:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3804:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3809:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    380c:	68 20 5d 00 00       	push   $0x5d20
+    3811:	6a 01                	push   $0x1
+    3813:	e8 d8 10 00 00       	call   48f0 <printf>
+    3818:	83 c4 10             	add    $0x10,%esp
+    381b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    381f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3820:	83 ec 0c             	sub    $0xc,%esp
+    3823:	68 31 5d 00 00       	push   $0x5d31
+    3828:	e8 e3 0e 00 00       	call   4710 <mkdir>
+    382d:	83 c4 10             	add    $0x10,%esp
+    3830:	85 c0                	test   %eax,%eax
+    3832:	0f 85 bb 00 00 00    	jne    38f3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3838:	83 ec 0c             	sub    $0xc,%esp
+    383b:	68 31 5d 00 00       	push   $0x5d31
+    3840:	e8 da 0e 00 00       	call   471f <chdir>
+    3845:	83 c4 10             	add    $0x10,%esp
+    3848:	85 c0                	test   %eax,%eax
+    384a:	0f 85 b7 00 00 00    	jne    3907 <iref+0x107>
+    mkdir("");
+    3850:	83 ec 0c             	sub    $0xc,%esp
+    3853:	68 3b 50 00 00       	push   $0x503b
+    3858:	e8 b3 0e 00 00       	call   4710 <mkdir>
+    link("README", "");
+    385d:	59                   	pop    %ecx
+    385e:	58                   	pop    %eax
+    385f:	68 3b 50 00 00       	push   $0x503b
+    3864:	68 dd 5c 00 00       	push   $0x5cdd
+    3869:	e8 93 0e 00 00       	call   4701 <link>
+    fd = open("", O_CREATE);
+    386e:	58                   	pop    %eax
+    386f:	5a                   	pop    %edx
+    3870:	68 00 02 00 00       	push   $0x200
+    3875:	68 3b 50 00 00       	push   $0x503b
+    387a:	e8 46 0e 00 00       	call   46c5 <open>
+    if(fd >= 0)
+    387f:	83 c4 10             	add    $0x10,%esp
+    3882:	85 c0                	test   %eax,%eax
+    3884:	78 0c                	js     3892 <iref+0x92>
+      close(fd);
+    3886:	83 ec 0c             	sub    $0xc,%esp
+    3889:	50                   	push   %eax
+    388a:	e8 09 0e 00 00       	call   4698 <close>
+    388f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3892:	83 ec 08             	sub    $0x8,%esp
+    3895:	68 00 02 00 00       	push   $0x200
+    389a:	68 70 55 00 00       	push   $0x5570
+    389f:	e8 21 0e 00 00       	call   46c5 <open>
+    if(fd >= 0)
+    38a4:	83 c4 10             	add    $0x10,%esp
+    38a7:	85 c0                	test   %eax,%eax
+    38a9:	78 0c                	js     38b7 <iref+0xb7>
+      close(fd);
+    38ab:	83 ec 0c             	sub    $0xc,%esp
+    38ae:	50                   	push   %eax
+    38af:	e8 e4 0d 00 00       	call   4698 <close>
+    38b4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    38b7:	83 ec 0c             	sub    $0xc,%esp
+    38ba:	68 70 55 00 00       	push   $0x5570
+    38bf:	e8 1f 0e 00 00       	call   46e3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    38c4:	83 c4 10             	add    $0x10,%esp
+    38c7:	83 eb 01             	sub    $0x1,%ebx
+    38ca:	0f 85 50 ff ff ff    	jne    3820 <iref+0x20>
+  chdir("/");
+    38d0:	83 ec 0c             	sub    $0xc,%esp
+    38d3:	68 61 4c 00 00       	push   $0x4c61
+    38d8:	e8 42 0e 00 00       	call   471f <chdir>
+  printf(1, "empty file name OK\n");
+    38dd:	58                   	pop    %eax
+    38de:	5a                   	pop    %edx
+    38df:	68 5f 5d 00 00       	push   $0x5d5f
+    38e4:	6a 01                	push   $0x1
+    38e6:	e8 05 10 00 00       	call   48f0 <printf>
+}
+    38eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38ee:	83 c4 10             	add    $0x10,%esp
+    38f1:	c9                   	leave
+    38f2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    38f3:	83 ec 08             	sub    $0x8,%esp
+    38f6:	68 37 5d 00 00       	push   $0x5d37
+    38fb:	6a 01                	push   $0x1
+    38fd:	e8 ee 0f 00 00       	call   48f0 <printf>
+      exit();
+    3902:	e8 46 0d 00 00       	call   464d <exit>
+      printf(1, "chdir irefd failed\n");
+    3907:	83 ec 08             	sub    $0x8,%esp
+    390a:	68 4b 5d 00 00       	push   $0x5d4b
+    390f:	6a 01                	push   $0x1
+    3911:	e8 da 0f 00 00       	call   48f0 <printf>
+      exit();
+    3916:	e8 32 0d 00 00       	call   464d <exit>
+    391b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    391f:	90                   	nop
+
+00003920 <forktest>:
+{
+    3920:	55                   	push   %ebp
+    3921:	89 e5                	mov    %esp,%ebp
+    3923:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3924:	31 db                	xor    %ebx,%ebx
+{
+    3926:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3929:	68 73 5d 00 00       	push   $0x5d73
+    392e:	6a 01                	push   $0x1
+    3930:	e8 bb 0f 00 00       	call   48f0 <printf>
+    3935:	83 c4 10             	add    $0x10,%esp
+    3938:	eb 13                	jmp    394d <forktest+0x2d>
+    393a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3940:	74 4d                	je     398f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    3942:	83 c3 01             	add    $0x1,%ebx
+    3945:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    394b:	74 6e                	je     39bb <forktest+0x9b>
+    pid = fork();
+    394d:	e8 ec 0c 00 00       	call   463e <fork>
+    if(pid < 0)
+    3952:	85 c0                	test   %eax,%eax
+    3954:	79 ea                	jns    3940 <forktest+0x20>
+  for(; n > 0; n--){
+    3956:	85 db                	test   %ebx,%ebx
+    3958:	74 14                	je     396e <forktest+0x4e>
+    395a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    3960:	e8 f7 0c 00 00       	call   465c <wait>
+    3965:	85 c0                	test   %eax,%eax
+    3967:	78 2b                	js     3994 <forktest+0x74>
+  for(; n > 0; n--){
+    3969:	83 eb 01             	sub    $0x1,%ebx
+    396c:	75 f2                	jne    3960 <forktest+0x40>
+  if(wait() != -1){
+    396e:	e8 e9 0c 00 00       	call   465c <wait>
+    3973:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3976:	75 30                	jne    39a8 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    3978:	83 ec 08             	sub    $0x8,%esp
+    397b:	68 a5 5d 00 00       	push   $0x5da5
+    3980:	6a 01                	push   $0x1
+    3982:	e8 69 0f 00 00       	call   48f0 <printf>
+}
+    3987:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    398a:	83 c4 10             	add    $0x10,%esp
+    398d:	c9                   	leave
+    398e:	c3                   	ret
+      exit();
+    398f:	e8 b9 0c 00 00       	call   464d <exit>
+      printf(1, "wait stopped early\n");
+    3994:	83 ec 08             	sub    $0x8,%esp
+    3997:	68 7e 5d 00 00       	push   $0x5d7e
+    399c:	6a 01                	push   $0x1
+    399e:	e8 4d 0f 00 00       	call   48f0 <printf>
+      exit();
+    39a3:	e8 a5 0c 00 00       	call   464d <exit>
+    printf(1, "wait got too many\n");
+    39a8:	50                   	push   %eax
+    39a9:	50                   	push   %eax
+    39aa:	68 92 5d 00 00       	push   $0x5d92
+    39af:	6a 01                	push   $0x1
+    39b1:	e8 3a 0f 00 00       	call   48f0 <printf>
+    exit();
+    39b6:	e8 92 0c 00 00       	call   464d <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    39bb:	52                   	push   %edx
+    39bc:	52                   	push   %edx
+    39bd:	68 e0 65 00 00       	push   $0x65e0
+    39c2:	6a 01                	push   $0x1
+    39c4:	e8 27 0f 00 00       	call   48f0 <printf>
+    exit();
+    39c9:	e8 7f 0c 00 00       	call   464d <exit>
+    39ce:	66 90                	xchg   %ax,%ax
+
+000039d0 <sbrktest>:
+{
+    39d0:	55                   	push   %ebp
+    39d1:	89 e5                	mov    %esp,%ebp
+    39d3:	57                   	push   %edi
+    39d4:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    39d5:	31 f6                	xor    %esi,%esi
+{
+    39d7:	53                   	push   %ebx
+    39d8:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    39db:	68 b3 5d 00 00       	push   $0x5db3
+    39e0:	ff 35 58 73 00 00    	push   0x7358
+    39e6:	e8 05 0f 00 00       	call   48f0 <printf>
+  oldbrk = sbrk(0);
+    39eb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    39f2:	e8 46 0d 00 00       	call   473d <sbrk>
+    39f7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    39fa:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3a01:	e8 37 0d 00 00       	call   473d <sbrk>
+    3a06:	83 c4 10             	add    $0x10,%esp
+    3a09:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    3a0b:	eb 05                	jmp    3a12 <sbrktest+0x42>
+    3a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3a10:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3a12:	83 ec 0c             	sub    $0xc,%esp
+    3a15:	6a 01                	push   $0x1
+    3a17:	e8 21 0d 00 00       	call   473d <sbrk>
+    if(b != a){
+    3a1c:	83 c4 10             	add    $0x10,%esp
+    3a1f:	39 d8                	cmp    %ebx,%eax
+    3a21:	0f 85 9c 02 00 00    	jne    3cc3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3a27:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    3a2a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    3a2d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3a30:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3a36:	75 d8                	jne    3a10 <sbrktest+0x40>
+  pid = fork();
+    3a38:	e8 01 0c 00 00       	call   463e <fork>
+    3a3d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    3a3f:	85 c0                	test   %eax,%eax
+    3a41:	0f 88 02 03 00 00    	js     3d49 <sbrktest+0x379>
+  c = sbrk(1);
+    3a47:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    3a4a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    3a4d:	6a 01                	push   $0x1
+    3a4f:	e8 e9 0c 00 00       	call   473d <sbrk>
+  c = sbrk(1);
+    3a54:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3a5b:	e8 dd 0c 00 00       	call   473d <sbrk>
+  if(c != a + 1){
+    3a60:	83 c4 10             	add    $0x10,%esp
+    3a63:	39 c3                	cmp    %eax,%ebx
+    3a65:	0f 85 3b 03 00 00    	jne    3da6 <sbrktest+0x3d6>
+  if(pid == 0)
+    3a6b:	85 f6                	test   %esi,%esi
+    3a6d:	0f 84 2e 03 00 00    	je     3da1 <sbrktest+0x3d1>
+  wait();
+    3a73:	e8 e4 0b 00 00       	call   465c <wait>
+  a = sbrk(0);
+    3a78:	83 ec 0c             	sub    $0xc,%esp
+    3a7b:	6a 00                	push   $0x0
+    3a7d:	e8 bb 0c 00 00       	call   473d <sbrk>
+    3a82:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3a84:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3a89:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    3a8b:	89 04 24             	mov    %eax,(%esp)
+    3a8e:	e8 aa 0c 00 00       	call   473d <sbrk>
+  if (p != a) {
+    3a93:	83 c4 10             	add    $0x10,%esp
+    3a96:	39 c3                	cmp    %eax,%ebx
+    3a98:	0f 85 94 02 00 00    	jne    3d32 <sbrktest+0x362>
+  a = sbrk(0);
+    3a9e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3aa1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3aa8:	6a 00                	push   $0x0
+    3aaa:	e8 8e 0c 00 00       	call   473d <sbrk>
+  c = sbrk(-4096);
+    3aaf:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3ab6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3ab8:	e8 80 0c 00 00       	call   473d <sbrk>
+  if(c == (char*)0xffffffff){
+    3abd:	83 c4 10             	add    $0x10,%esp
+    3ac0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3ac3:	0f 84 22 03 00 00    	je     3deb <sbrktest+0x41b>
+  c = sbrk(0);
+    3ac9:	83 ec 0c             	sub    $0xc,%esp
+    3acc:	6a 00                	push   $0x0
+    3ace:	e8 6a 0c 00 00       	call   473d <sbrk>
+  if(c != a - 4096){
+    3ad3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3ad9:	83 c4 10             	add    $0x10,%esp
+    3adc:	39 d0                	cmp    %edx,%eax
+    3ade:	0f 85 f0 02 00 00    	jne    3dd4 <sbrktest+0x404>
+  a = sbrk(0);
+    3ae4:	83 ec 0c             	sub    $0xc,%esp
+    3ae7:	6a 00                	push   $0x0
+    3ae9:	e8 4f 0c 00 00       	call   473d <sbrk>
+  c = sbrk(4096);
+    3aee:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3af5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3af7:	e8 41 0c 00 00       	call   473d <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3afc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3aff:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3b01:	39 c3                	cmp    %eax,%ebx
+    3b03:	0f 85 b4 02 00 00    	jne    3dbd <sbrktest+0x3ed>
+    3b09:	83 ec 0c             	sub    $0xc,%esp
+    3b0c:	6a 00                	push   $0x0
+    3b0e:	e8 2a 0c 00 00       	call   473d <sbrk>
+    3b13:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3b19:	83 c4 10             	add    $0x10,%esp
+    3b1c:	39 c2                	cmp    %eax,%edx
+    3b1e:	0f 85 99 02 00 00    	jne    3dbd <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3b24:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3b2b:	0f 84 2f 02 00 00    	je     3d60 <sbrktest+0x390>
+  a = sbrk(0);
+    3b31:	83 ec 0c             	sub    $0xc,%esp
+    3b34:	6a 00                	push   $0x0
+    3b36:	e8 02 0c 00 00       	call   473d <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b3b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3b42:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3b44:	e8 f4 0b 00 00       	call   473d <sbrk>
+    3b49:	89 c2                	mov    %eax,%edx
+    3b4b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3b4e:	29 d0                	sub    %edx,%eax
+    3b50:	89 04 24             	mov    %eax,(%esp)
+    3b53:	e8 e5 0b 00 00       	call   473d <sbrk>
+  if(c != a){
+    3b58:	83 c4 10             	add    $0x10,%esp
+    3b5b:	39 c3                	cmp    %eax,%ebx
+    3b5d:	0f 85 b8 01 00 00    	jne    3d1b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b63:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b6f:	90                   	nop
+    ppid = getpid();
+    3b70:	e8 2b 0a 00 00       	call   45a0 <getpid>
+    3b75:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3b77:	e8 c2 0a 00 00       	call   463e <fork>
+    if(pid < 0){
+    3b7c:	85 c0                	test   %eax,%eax
+    3b7e:	0f 88 5d 01 00 00    	js     3ce1 <sbrktest+0x311>
+    if(pid == 0){
+    3b84:	0f 84 6f 01 00 00    	je     3cf9 <sbrktest+0x329>
+    wait();
+    3b8a:	e8 cd 0a 00 00       	call   465c <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3b8f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3b95:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    3b9b:	75 d3                	jne    3b70 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    3b9d:	83 ec 0c             	sub    $0xc,%esp
+    3ba0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3ba3:	50                   	push   %eax
+    3ba4:	e8 c2 0a 00 00       	call   466b <pipe>
+    3ba9:	83 c4 10             	add    $0x10,%esp
+    3bac:	85 c0                	test   %eax,%eax
+    3bae:	0f 85 da 01 00 00    	jne    3d8e <sbrktest+0x3be>
+    3bb4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3bb7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    3bba:	89 df                	mov    %ebx,%edi
+    3bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3bc0:	e8 79 0a 00 00       	call   463e <fork>
+    3bc5:	89 07                	mov    %eax,(%edi)
+    3bc7:	85 c0                	test   %eax,%eax
+    3bc9:	0f 84 91 00 00 00    	je     3c60 <sbrktest+0x290>
+    if(pids[i] != -1)
+    3bcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bd2:	74 14                	je     3be8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3bd4:	83 ec 04             	sub    $0x4,%esp
+    3bd7:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    3bda:	6a 01                	push   $0x1
+    3bdc:	50                   	push   %eax
+    3bdd:	ff 75 b8             	push   -0x48(%ebp)
+    3be0:	e8 95 0a 00 00       	call   467a <read>
+    3be5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3be8:	83 c7 04             	add    $0x4,%edi
+    3beb:	39 f7                	cmp    %esi,%edi
+    3bed:	75 d1                	jne    3bc0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    3bef:	83 ec 0c             	sub    $0xc,%esp
+    3bf2:	68 00 10 00 00       	push   $0x1000
+    3bf7:	e8 41 0b 00 00       	call   473d <sbrk>
+    3bfc:	83 c4 10             	add    $0x10,%esp
+    3bff:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3c08:	8b 03                	mov    (%ebx),%eax
+    3c0a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3c0d:	74 11                	je     3c20 <sbrktest+0x250>
+    kill(pids[i]);
+    3c0f:	83 ec 0c             	sub    $0xc,%esp
+    3c12:	50                   	push   %eax
+    3c13:	e8 8f 0a 00 00       	call   46a7 <kill>
+    wait();
+    3c18:	e8 3f 0a 00 00       	call   465c <wait>
+    3c1d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3c20:	83 c3 04             	add    $0x4,%ebx
+    3c23:	39 f3                	cmp    %esi,%ebx
+    3c25:	75 e1                	jne    3c08 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3c27:	83 ff ff             	cmp    $0xffffffff,%edi
+    3c2a:	0f 84 47 01 00 00    	je     3d77 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3c30:	83 ec 0c             	sub    $0xc,%esp
+    3c33:	6a 00                	push   $0x0
+    3c35:	e8 03 0b 00 00       	call   473d <sbrk>
+    3c3a:	83 c4 10             	add    $0x10,%esp
+    3c3d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3c40:	72 60                	jb     3ca2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3c42:	83 ec 08             	sub    $0x8,%esp
+    3c45:	68 5b 5e 00 00       	push   $0x5e5b
+    3c4a:	ff 35 58 73 00 00    	push   0x7358
+    3c50:	e8 9b 0c 00 00       	call   48f0 <printf>
+}
+    3c55:	83 c4 10             	add    $0x10,%esp
+    3c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c5b:	5b                   	pop    %ebx
+    3c5c:	5e                   	pop    %esi
+    3c5d:	5f                   	pop    %edi
+    3c5e:	5d                   	pop    %ebp
+    3c5f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3c60:	83 ec 0c             	sub    $0xc,%esp
+    3c63:	6a 00                	push   $0x0
+    3c65:	e8 d3 0a 00 00       	call   473d <sbrk>
+    3c6a:	89 c2                	mov    %eax,%edx
+    3c6c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3c71:	29 d0                	sub    %edx,%eax
+    3c73:	89 04 24             	mov    %eax,(%esp)
+    3c76:	e8 c2 0a 00 00       	call   473d <sbrk>
+      write(fds[1], "x", 1);
+    3c7b:	83 c4 0c             	add    $0xc,%esp
+    3c7e:	6a 01                	push   $0x1
+    3c80:	68 71 55 00 00       	push   $0x5571
+    3c85:	ff 75 bc             	push   -0x44(%ebp)
+    3c88:	e8 fc 09 00 00       	call   4689 <write>
+    3c8d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3c90:	83 ec 0c             	sub    $0xc,%esp
+    3c93:	68 e8 03 00 00       	push   $0x3e8
+    3c98:	e8 af 0a 00 00       	call   474c <sleep>
+    3c9d:	83 c4 10             	add    $0x10,%esp
+    3ca0:	eb ee                	jmp    3c90 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3ca2:	83 ec 0c             	sub    $0xc,%esp
+    3ca5:	6a 00                	push   $0x0
+    3ca7:	e8 91 0a 00 00       	call   473d <sbrk>
+    3cac:	89 c2                	mov    %eax,%edx
+    3cae:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3cb1:	29 d0                	sub    %edx,%eax
+    3cb3:	89 04 24             	mov    %eax,(%esp)
+    3cb6:	e8 82 0a 00 00       	call   473d <sbrk>
+    3cbb:	83 c4 10             	add    $0x10,%esp
+    3cbe:	e9 7f ff ff ff       	jmp    3c42 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3cc3:	83 ec 0c             	sub    $0xc,%esp
+    3cc6:	50                   	push   %eax
+    3cc7:	53                   	push   %ebx
+    3cc8:	56                   	push   %esi
+    3cc9:	68 be 5d 00 00       	push   $0x5dbe
+    3cce:	ff 35 58 73 00 00    	push   0x7358
+    3cd4:	e8 17 0c 00 00       	call   48f0 <printf>
+      exit();
+    3cd9:	83 c4 20             	add    $0x20,%esp
+    3cdc:	e8 6c 09 00 00       	call   464d <exit>
+      printf(stdout, "fork failed\n");
+    3ce1:	83 ec 08             	sub    $0x8,%esp
+    3ce4:	68 04 5f 00 00       	push   $0x5f04
+    3ce9:	ff 35 58 73 00 00    	push   0x7358
+    3cef:	e8 fc 0b 00 00       	call   48f0 <printf>
+      exit();
+    3cf4:	e8 54 09 00 00       	call   464d <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3cf9:	0f be 03             	movsbl (%ebx),%eax
+    3cfc:	50                   	push   %eax
+    3cfd:	53                   	push   %ebx
+    3cfe:	68 27 5e 00 00       	push   $0x5e27
+    3d03:	ff 35 58 73 00 00    	push   0x7358
+    3d09:	e8 e2 0b 00 00       	call   48f0 <printf>
+      kill(ppid);
+    3d0e:	89 34 24             	mov    %esi,(%esp)
+    3d11:	e8 91 09 00 00       	call   46a7 <kill>
+      exit();
+    3d16:	e8 32 09 00 00       	call   464d <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3d1b:	50                   	push   %eax
+    3d1c:	53                   	push   %ebx
+    3d1d:	68 d4 66 00 00       	push   $0x66d4
+    3d22:	ff 35 58 73 00 00    	push   0x7358
+    3d28:	e8 c3 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d2d:	e8 1b 09 00 00       	call   464d <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3d32:	56                   	push   %esi
+    3d33:	56                   	push   %esi
+    3d34:	68 04 66 00 00       	push   $0x6604
+    3d39:	ff 35 58 73 00 00    	push   0x7358
+    3d3f:	e8 ac 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d44:	e8 04 09 00 00       	call   464d <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3d49:	50                   	push   %eax
+    3d4a:	50                   	push   %eax
+    3d4b:	68 d9 5d 00 00       	push   $0x5dd9
+    3d50:	ff 35 58 73 00 00    	push   0x7358
+    3d56:	e8 95 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d5b:	e8 ed 08 00 00       	call   464d <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3d60:	51                   	push   %ecx
+    3d61:	51                   	push   %ecx
+    3d62:	68 a4 66 00 00       	push   $0x66a4
+    3d67:	ff 35 58 73 00 00    	push   0x7358
+    3d6d:	e8 7e 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d72:	e8 d6 08 00 00       	call   464d <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3d77:	50                   	push   %eax
+    3d78:	50                   	push   %eax
+    3d79:	68 40 5e 00 00       	push   $0x5e40
+    3d7e:	ff 35 58 73 00 00    	push   0x7358
+    3d84:	e8 67 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d89:	e8 bf 08 00 00       	call   464d <exit>
+    printf(1, "pipe() failed\n");
+    3d8e:	52                   	push   %edx
+    3d8f:	52                   	push   %edx
+    3d90:	68 51 4f 00 00       	push   $0x4f51
+    3d95:	6a 01                	push   $0x1
+    3d97:	e8 54 0b 00 00       	call   48f0 <printf>
+    exit();
+    3d9c:	e8 ac 08 00 00       	call   464d <exit>
+    exit();
+    3da1:	e8 a7 08 00 00       	call   464d <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3da6:	57                   	push   %edi
+    3da7:	57                   	push   %edi
+    3da8:	68 f0 5d 00 00       	push   $0x5df0
+    3dad:	ff 35 58 73 00 00    	push   0x7358
+    3db3:	e8 38 0b 00 00       	call   48f0 <printf>
+    exit();
+    3db8:	e8 90 08 00 00       	call   464d <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3dbd:	56                   	push   %esi
+    3dbe:	53                   	push   %ebx
+    3dbf:	68 7c 66 00 00       	push   $0x667c
+    3dc4:	ff 35 58 73 00 00    	push   0x7358
+    3dca:	e8 21 0b 00 00       	call   48f0 <printf>
+    exit();
+    3dcf:	e8 79 08 00 00       	call   464d <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3dd4:	50                   	push   %eax
+    3dd5:	53                   	push   %ebx
+    3dd6:	68 44 66 00 00       	push   $0x6644
+    3ddb:	ff 35 58 73 00 00    	push   0x7358
+    3de1:	e8 0a 0b 00 00       	call   48f0 <printf>
+    exit();
+    3de6:	e8 62 08 00 00       	call   464d <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    3deb:	53                   	push   %ebx
+    3dec:	53                   	push   %ebx
+    3ded:	68 0c 5e 00 00       	push   $0x5e0c
+    3df2:	ff 35 58 73 00 00    	push   0x7358
+    3df8:	e8 f3 0a 00 00       	call   48f0 <printf>
+    exit();
+    3dfd:	e8 4b 08 00 00       	call   464d <exit>
+    3e02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003e10 <validateint>:
+}
+    3e10:	c3                   	ret
+    3e11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e1f:	90                   	nop
+
+00003e20 <validatetest>:
+{
+    3e20:	55                   	push   %ebp
+    3e21:	89 e5                	mov    %esp,%ebp
+    3e23:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e24:	31 f6                	xor    %esi,%esi
+{
+    3e26:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3e27:	83 ec 08             	sub    $0x8,%esp
+    3e2a:	68 69 5e 00 00       	push   $0x5e69
+    3e2f:	ff 35 58 73 00 00    	push   0x7358
+    3e35:	e8 b6 0a 00 00       	call   48f0 <printf>
+    3e3a:	83 c4 10             	add    $0x10,%esp
+    3e3d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3e40:	e8 f9 07 00 00       	call   463e <fork>
+    3e45:	89 c3                	mov    %eax,%ebx
+    3e47:	85 c0                	test   %eax,%eax
+    3e49:	74 63                	je     3eae <validatetest+0x8e>
+    sleep(0);
+    3e4b:	83 ec 0c             	sub    $0xc,%esp
+    3e4e:	6a 00                	push   $0x0
+    3e50:	e8 f7 08 00 00       	call   474c <sleep>
+    sleep(0);
+    3e55:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3e5c:	e8 eb 08 00 00       	call   474c <sleep>
+    kill(pid);
+    3e61:	89 1c 24             	mov    %ebx,(%esp)
+    3e64:	e8 3e 08 00 00       	call   46a7 <kill>
+    wait();
+    3e69:	e8 ee 07 00 00       	call   465c <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3e6e:	58                   	pop    %eax
+    3e6f:	5a                   	pop    %edx
+    3e70:	56                   	push   %esi
+    3e71:	68 78 5e 00 00       	push   $0x5e78
+    3e76:	e8 86 08 00 00       	call   4701 <link>
+    3e7b:	83 c4 10             	add    $0x10,%esp
+    3e7e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e81:	75 30                	jne    3eb3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e83:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3e89:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3e8f:	75 af                	jne    3e40 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3e91:	83 ec 08             	sub    $0x8,%esp
+    3e94:	68 9c 5e 00 00       	push   $0x5e9c
+    3e99:	ff 35 58 73 00 00    	push   0x7358
+    3e9f:	e8 4c 0a 00 00       	call   48f0 <printf>
+}
+    3ea4:	83 c4 10             	add    $0x10,%esp
+    3ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3eaa:	5b                   	pop    %ebx
+    3eab:	5e                   	pop    %esi
+    3eac:	5d                   	pop    %ebp
+    3ead:	c3                   	ret
+      exit();
+    3eae:	e8 9a 07 00 00       	call   464d <exit>
+      printf(stdout, "link should not succeed\n");
+    3eb3:	83 ec 08             	sub    $0x8,%esp
+    3eb6:	68 83 5e 00 00       	push   $0x5e83
+    3ebb:	ff 35 58 73 00 00    	push   0x7358
+    3ec1:	e8 2a 0a 00 00       	call   48f0 <printf>
+      exit();
+    3ec6:	e8 82 07 00 00       	call   464d <exit>
+    3ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ecf:	90                   	nop
+
+00003ed0 <bsstest>:
+{
+    3ed0:	55                   	push   %ebp
+    3ed1:	89 e5                	mov    %esp,%ebp
+    3ed3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3ed6:	68 a9 5e 00 00       	push   $0x5ea9
+    3edb:	ff 35 58 73 00 00    	push   0x7358
+    3ee1:	e8 0a 0a 00 00       	call   48f0 <printf>
+    3ee6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3ee9:	31 c0                	xor    %eax,%eax
+    3eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3eef:	90                   	nop
+    if(uninit[i] != '\0'){
+    3ef0:	80 b8 80 73 00 00 00 	cmpb   $0x0,0x7380(%eax)
+    3ef7:	75 22                	jne    3f1b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3ef9:	83 c0 01             	add    $0x1,%eax
+    3efc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3f01:	75 ed                	jne    3ef0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3f03:	83 ec 08             	sub    $0x8,%esp
+    3f06:	68 c4 5e 00 00       	push   $0x5ec4
+    3f0b:	ff 35 58 73 00 00    	push   0x7358
+    3f11:	e8 da 09 00 00       	call   48f0 <printf>
+}
+    3f16:	83 c4 10             	add    $0x10,%esp
+    3f19:	c9                   	leave
+    3f1a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3f1b:	83 ec 08             	sub    $0x8,%esp
+    3f1e:	68 b3 5e 00 00       	push   $0x5eb3
+    3f23:	ff 35 58 73 00 00    	push   0x7358
+    3f29:	e8 c2 09 00 00       	call   48f0 <printf>
+      exit();
+    3f2e:	e8 1a 07 00 00       	call   464d <exit>
+    3f33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003f40 <bigargtest>:
+{
+    3f40:	55                   	push   %ebp
+    3f41:	89 e5                	mov    %esp,%ebp
+    3f43:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3f46:	68 d1 5e 00 00       	push   $0x5ed1
+    3f4b:	e8 93 07 00 00       	call   46e3 <unlink>
+  pid = fork();
+    3f50:	e8 e9 06 00 00       	call   463e <fork>
+  if(pid == 0){
+    3f55:	83 c4 10             	add    $0x10,%esp
+    3f58:	85 c0                	test   %eax,%eax
+    3f5a:	74 44                	je     3fa0 <bigargtest+0x60>
+  } else if(pid < 0){
+    3f5c:	0f 88 c3 00 00 00    	js     4025 <bigargtest+0xe5>
+  wait();
+    3f62:	e8 f5 06 00 00       	call   465c <wait>
+  fd = open("bigarg-ok", 0);
+    3f67:	83 ec 08             	sub    $0x8,%esp
+    3f6a:	6a 00                	push   $0x0
+    3f6c:	68 d1 5e 00 00       	push   $0x5ed1
+    3f71:	e8 4f 07 00 00       	call   46c5 <open>
+  if(fd < 0){
+    3f76:	83 c4 10             	add    $0x10,%esp
+    3f79:	85 c0                	test   %eax,%eax
+    3f7b:	0f 88 8d 00 00 00    	js     400e <bigargtest+0xce>
+  close(fd);
+    3f81:	83 ec 0c             	sub    $0xc,%esp
+    3f84:	50                   	push   %eax
+    3f85:	e8 0e 07 00 00       	call   4698 <close>
+  unlink("bigarg-ok");
+    3f8a:	c7 04 24 d1 5e 00 00 	movl   $0x5ed1,(%esp)
+    3f91:	e8 4d 07 00 00       	call   46e3 <unlink>
+}
+    3f96:	83 c4 10             	add    $0x10,%esp
+    3f99:	c9                   	leave
+    3f9a:	c3                   	ret
+    3f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f9f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3fa0:	c7 04 85 a0 ba 00 00 	movl   $0x66f8,0xbaa0(,%eax,4)
+    3fa7:	f8 66 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3fab:	83 c0 01             	add    $0x1,%eax
+    3fae:	83 f8 1f             	cmp    $0x1f,%eax
+    3fb1:	75 ed                	jne    3fa0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3fb3:	31 c9                	xor    %ecx,%ecx
+    3fb5:	89 0d 1c bb 00 00    	mov    %ecx,0xbb1c
+    printf(stdout, "bigarg test\n");
+    3fbb:	50                   	push   %eax
+    3fbc:	50                   	push   %eax
+    3fbd:	68 db 5e 00 00       	push   $0x5edb
+    3fc2:	ff 35 58 73 00 00    	push   0x7358
+    3fc8:	e8 23 09 00 00       	call   48f0 <printf>
+    exec("echo", args);
+    3fcd:	58                   	pop    %eax
+    3fce:	5a                   	pop    %edx
+    3fcf:	68 a0 ba 00 00       	push   $0xbaa0
+    3fd4:	68 fd 4c 00 00       	push   $0x4cfd
+    3fd9:	e8 d8 06 00 00       	call   46b6 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3fde:	59                   	pop    %ecx
+    3fdf:	58                   	pop    %eax
+    3fe0:	68 e8 5e 00 00       	push   $0x5ee8
+    3fe5:	ff 35 58 73 00 00    	push   0x7358
+    3feb:	e8 00 09 00 00       	call   48f0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3ff0:	58                   	pop    %eax
+    3ff1:	5a                   	pop    %edx
+    3ff2:	68 00 02 00 00       	push   $0x200
+    3ff7:	68 d1 5e 00 00       	push   $0x5ed1
+    3ffc:	e8 c4 06 00 00       	call   46c5 <open>
+    close(fd);
+    4001:	89 04 24             	mov    %eax,(%esp)
+    4004:	e8 8f 06 00 00       	call   4698 <close>
+    exit();
+    4009:	e8 3f 06 00 00       	call   464d <exit>
+    printf(stdout, "bigarg test failed!\n");
+    400e:	50                   	push   %eax
+    400f:	50                   	push   %eax
+    4010:	68 11 5f 00 00       	push   $0x5f11
+    4015:	ff 35 58 73 00 00    	push   0x7358
+    401b:	e8 d0 08 00 00       	call   48f0 <printf>
+    exit();
+    4020:	e8 28 06 00 00       	call   464d <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4025:	52                   	push   %edx
+    4026:	52                   	push   %edx
+    4027:	68 f8 5e 00 00       	push   $0x5ef8
+    402c:	ff 35 58 73 00 00    	push   0x7358
+    4032:	e8 b9 08 00 00       	call   48f0 <printf>
+    exit();
+    4037:	e8 11 06 00 00       	call   464d <exit>
+    403c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004040 <fsfull>:
+{
+    4040:	55                   	push   %ebp
+    4041:	89 e5                	mov    %esp,%ebp
+    4043:	57                   	push   %edi
+    4044:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4045:	31 f6                	xor    %esi,%esi
+{
+    4047:	53                   	push   %ebx
+    4048:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    404b:	68 26 5f 00 00       	push   $0x5f26
+    4050:	6a 01                	push   $0x1
+    4052:	e8 99 08 00 00       	call   48f0 <printf>
+    4057:	83 c4 10             	add    $0x10,%esp
+    405a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4060:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4065:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    406a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    406d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4071:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4073:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4077:	c1 ea 06             	shr    $0x6,%edx
+    407a:	8d 42 30             	lea    0x30(%edx),%eax
+    407d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4080:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4086:	89 f2                	mov    %esi,%edx
+    4088:	29 c2                	sub    %eax,%edx
+    408a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    408f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4091:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4096:	c1 ea 05             	shr    $0x5,%edx
+    4099:	83 c2 30             	add    $0x30,%edx
+    409c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    409f:	f7 e6                	mul    %esi
+    40a1:	c1 ea 05             	shr    $0x5,%edx
+    40a4:	6b c2 64             	imul   $0x64,%edx,%eax
+    40a7:	89 f2                	mov    %esi,%edx
+    40a9:	29 c2                	sub    %eax,%edx
+    40ab:	89 d0                	mov    %edx,%eax
+    40ad:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    40af:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    40b1:	c1 ea 03             	shr    $0x3,%edx
+    40b4:	83 c2 30             	add    $0x30,%edx
+    40b7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    40ba:	f7 e1                	mul    %ecx
+    40bc:	89 f0                	mov    %esi,%eax
+    40be:	c1 ea 03             	shr    $0x3,%edx
+    40c1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    40c4:	01 d2                	add    %edx,%edx
+    40c6:	29 d0                	sub    %edx,%eax
+    40c8:	83 c0 30             	add    $0x30,%eax
+    40cb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    40ce:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40d1:	50                   	push   %eax
+    40d2:	68 33 5f 00 00       	push   $0x5f33
+    40d7:	6a 01                	push   $0x1
+    40d9:	e8 12 08 00 00       	call   48f0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    40de:	58                   	pop    %eax
+    40df:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40e2:	5a                   	pop    %edx
+    40e3:	68 02 02 00 00       	push   $0x202
+    40e8:	50                   	push   %eax
+    40e9:	e8 d7 05 00 00       	call   46c5 <open>
+    if(fd < 0){
+    40ee:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    40f1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    40f3:	85 c0                	test   %eax,%eax
+    40f5:	78 4f                	js     4146 <fsfull+0x106>
+    int total = 0;
+    40f7:	31 db                	xor    %ebx,%ebx
+    40f9:	eb 07                	jmp    4102 <fsfull+0xc2>
+    40fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    40ff:	90                   	nop
+      total += cc;
+    4100:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4102:	83 ec 04             	sub    $0x4,%esp
+    4105:	68 00 02 00 00       	push   $0x200
+    410a:	68 a0 9a 00 00       	push   $0x9aa0
+    410f:	57                   	push   %edi
+    4110:	e8 74 05 00 00       	call   4689 <write>
+      if(cc < 512)
+    4115:	83 c4 10             	add    $0x10,%esp
+    4118:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    411d:	7f e1                	jg     4100 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    411f:	83 ec 04             	sub    $0x4,%esp
+    4122:	53                   	push   %ebx
+    4123:	68 4f 5f 00 00       	push   $0x5f4f
+    4128:	6a 01                	push   $0x1
+    412a:	e8 c1 07 00 00       	call   48f0 <printf>
+    close(fd);
+    412f:	89 3c 24             	mov    %edi,(%esp)
+    4132:	e8 61 05 00 00       	call   4698 <close>
+    if(total == 0)
+    4137:	83 c4 10             	add    $0x10,%esp
+    413a:	85 db                	test   %ebx,%ebx
+    413c:	74 1e                	je     415c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    413e:	83 c6 01             	add    $0x1,%esi
+    4141:	e9 1a ff ff ff       	jmp    4060 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4146:	83 ec 04             	sub    $0x4,%esp
+    4149:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    414c:	50                   	push   %eax
+    414d:	68 3f 5f 00 00       	push   $0x5f3f
+    4152:	6a 01                	push   $0x1
+    4154:	e8 97 07 00 00       	call   48f0 <printf>
+      break;
+    4159:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    415c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4161:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    416d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4170:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4172:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4175:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4179:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    417b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    417f:	c1 ea 06             	shr    $0x6,%edx
+    4182:	8d 42 30             	lea    0x30(%edx),%eax
+    4185:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4188:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    418e:	89 f2                	mov    %esi,%edx
+    4190:	29 c2                	sub    %eax,%edx
+    4192:	89 d0                	mov    %edx,%eax
+    4194:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    4196:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4198:	c1 ea 05             	shr    $0x5,%edx
+    419b:	83 c2 30             	add    $0x30,%edx
+    419e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    41a1:	f7 e3                	mul    %ebx
+    41a3:	c1 ea 05             	shr    $0x5,%edx
+    41a6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    41a9:	89 f2                	mov    %esi,%edx
+    41ab:	29 ca                	sub    %ecx,%edx
+    41ad:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    41b2:	89 d0                	mov    %edx,%eax
+    41b4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    41b6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41b8:	c1 ea 03             	shr    $0x3,%edx
+    41bb:	83 c2 30             	add    $0x30,%edx
+    41be:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    41c1:	f7 e1                	mul    %ecx
+    41c3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    41c5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    41c8:	c1 ea 03             	shr    $0x3,%edx
+    41cb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    41ce:	01 d2                	add    %edx,%edx
+    41d0:	29 d0                	sub    %edx,%eax
+    41d2:	83 c0 30             	add    $0x30,%eax
+    41d5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    41d8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    41db:	50                   	push   %eax
+    41dc:	e8 02 05 00 00       	call   46e3 <unlink>
+  while(nfiles >= 0){
+    41e1:	83 c4 10             	add    $0x10,%esp
+    41e4:	83 fe ff             	cmp    $0xffffffff,%esi
+    41e7:	75 87                	jne    4170 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    41e9:	83 ec 08             	sub    $0x8,%esp
+    41ec:	68 5f 5f 00 00       	push   $0x5f5f
+    41f1:	6a 01                	push   $0x1
+    41f3:	e8 f8 06 00 00       	call   48f0 <printf>
+}
+    41f8:	83 c4 10             	add    $0x10,%esp
+    41fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    41fe:	5b                   	pop    %ebx
+    41ff:	5e                   	pop    %esi
+    4200:	5f                   	pop    %edi
+    4201:	5d                   	pop    %ebp
+    4202:	c3                   	ret
+    4203:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    420a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004210 <uio>:
+{
+    4210:	55                   	push   %ebp
+    4211:	89 e5                	mov    %esp,%ebp
+    4213:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4216:	68 75 5f 00 00       	push   $0x5f75
+    421b:	6a 01                	push   $0x1
+    421d:	e8 ce 06 00 00       	call   48f0 <printf>
+  pid = fork();
+    4222:	e8 17 04 00 00       	call   463e <fork>
+  if(pid == 0){
+    4227:	83 c4 10             	add    $0x10,%esp
+    422a:	85 c0                	test   %eax,%eax
+    422c:	74 1b                	je     4249 <uio+0x39>
+  } else if(pid < 0){
+    422e:	78 3d                	js     426d <uio+0x5d>
+  wait();
+    4230:	e8 27 04 00 00       	call   465c <wait>
+  printf(1, "uio test done\n");
+    4235:	83 ec 08             	sub    $0x8,%esp
+    4238:	68 7f 5f 00 00       	push   $0x5f7f
+    423d:	6a 01                	push   $0x1
+    423f:	e8 ac 06 00 00       	call   48f0 <printf>
+}
+    4244:	83 c4 10             	add    $0x10,%esp
+    4247:	c9                   	leave
+    4248:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4249:	b8 09 00 00 00       	mov    $0x9,%eax
+    424e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4253:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4254:	ba 71 00 00 00       	mov    $0x71,%edx
+    4259:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    425a:	52                   	push   %edx
+    425b:	52                   	push   %edx
+    425c:	68 d8 67 00 00       	push   $0x67d8
+    4261:	6a 01                	push   $0x1
+    4263:	e8 88 06 00 00       	call   48f0 <printf>
+    exit();
+    4268:	e8 e0 03 00 00       	call   464d <exit>
+    printf (1, "fork failed\n");
+    426d:	50                   	push   %eax
+    426e:	50                   	push   %eax
+    426f:	68 04 5f 00 00       	push   $0x5f04
+    4274:	6a 01                	push   $0x1
+    4276:	e8 75 06 00 00       	call   48f0 <printf>
+    exit();
+    427b:	e8 cd 03 00 00       	call   464d <exit>
+
+00004280 <argptest>:
+{
+    4280:	55                   	push   %ebp
+    4281:	89 e5                	mov    %esp,%ebp
+    4283:	53                   	push   %ebx
+    4284:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4287:	6a 00                	push   $0x0
+    4289:	68 8e 5f 00 00       	push   $0x5f8e
+    428e:	e8 32 04 00 00       	call   46c5 <open>
+  if (fd < 0) {
+    4293:	83 c4 10             	add    $0x10,%esp
+    4296:	85 c0                	test   %eax,%eax
+    4298:	78 39                	js     42d3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    429a:	83 ec 0c             	sub    $0xc,%esp
+    429d:	89 c3                	mov    %eax,%ebx
+    429f:	6a 00                	push   $0x0
+    42a1:	e8 97 04 00 00       	call   473d <sbrk>
+    42a6:	83 c4 0c             	add    $0xc,%esp
+    42a9:	83 e8 01             	sub    $0x1,%eax
+    42ac:	6a ff                	push   $0xffffffff
+    42ae:	50                   	push   %eax
+    42af:	53                   	push   %ebx
+    42b0:	e8 c5 03 00 00       	call   467a <read>
+  close(fd);
+    42b5:	89 1c 24             	mov    %ebx,(%esp)
+    42b8:	e8 db 03 00 00       	call   4698 <close>
+  printf(1, "arg test passed\n");
+    42bd:	58                   	pop    %eax
+    42be:	5a                   	pop    %edx
+    42bf:	68 a0 5f 00 00       	push   $0x5fa0
+    42c4:	6a 01                	push   $0x1
+    42c6:	e8 25 06 00 00       	call   48f0 <printf>
+}
+    42cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42ce:	83 c4 10             	add    $0x10,%esp
+    42d1:	c9                   	leave
+    42d2:	c3                   	ret
+    printf(2, "open failed\n");
+    42d3:	51                   	push   %ecx
+    42d4:	51                   	push   %ecx
+    42d5:	68 93 5f 00 00       	push   $0x5f93
+    42da:	6a 02                	push   $0x2
+    42dc:	e8 0f 06 00 00       	call   48f0 <printf>
+    exit();
+    42e1:	e8 67 03 00 00       	call   464d <exit>
+    42e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000042f0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    42f0:	69 05 54 73 00 00 0d 	imul   $0x19660d,0x7354,%eax
+    42f7:	66 19 00 
+    42fa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    42ff:	a3 54 73 00 00       	mov    %eax,0x7354
+}
+    4304:	c3                   	ret
+    4305:	66 90                	xchg   %ax,%ax
+    4307:	66 90                	xchg   %ax,%ax
+    4309:	66 90                	xchg   %ax,%ax
+    430b:	66 90                	xchg   %ax,%ax
+    430d:	66 90                	xchg   %ax,%ax
+    430f:	90                   	nop
+
+00004310 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+    4310:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4311:	31 c0                	xor    %eax,%eax
+{
+    4313:	89 e5                	mov    %esp,%ebp
+    4315:	53                   	push   %ebx
+    4316:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4319:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    431c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4320:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4324:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4327:	83 c0 01             	add    $0x1,%eax
+    432a:	84 d2                	test   %dl,%dl
+    432c:	75 f2                	jne    4320 <strcpy+0x10>
+    ;
+  return os;
+}
+    432e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4331:	89 c8                	mov    %ecx,%eax
+    4333:	c9                   	leave
+    4334:	c3                   	ret
+    4335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    433c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004340 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4340:	55                   	push   %ebp
+    4341:	89 e5                	mov    %esp,%ebp
+    4343:	53                   	push   %ebx
+    4344:	8b 55 08             	mov    0x8(%ebp),%edx
+    4347:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    434a:	0f b6 02             	movzbl (%edx),%eax
+    434d:	84 c0                	test   %al,%al
+    434f:	75 17                	jne    4368 <strcmp+0x28>
+    4351:	eb 3a                	jmp    438d <strcmp+0x4d>
+    4353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4357:	90                   	nop
+    4358:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    435c:	83 c2 01             	add    $0x1,%edx
+    435f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4362:	84 c0                	test   %al,%al
+    4364:	74 1a                	je     4380 <strcmp+0x40>
+    p++, q++;
+    4366:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4368:	0f b6 19             	movzbl (%ecx),%ebx
+    436b:	38 c3                	cmp    %al,%bl
+    436d:	74 e9                	je     4358 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    436f:	29 d8                	sub    %ebx,%eax
+}
+    4371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4374:	c9                   	leave
+    4375:	c3                   	ret
+    4376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    437d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4380:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4384:	31 c0                	xor    %eax,%eax
+    4386:	29 d8                	sub    %ebx,%eax
+}
+    4388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    438b:	c9                   	leave
+    438c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    438d:	0f b6 19             	movzbl (%ecx),%ebx
+    4390:	31 c0                	xor    %eax,%eax
+    4392:	eb db                	jmp    436f <strcmp+0x2f>
+    4394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    439b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    439f:	90                   	nop
+
+000043a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    43a0:	55                   	push   %ebp
+    43a1:	89 e5                	mov    %esp,%ebp
+    43a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    43a6:	80 3a 00             	cmpb   $0x0,(%edx)
+    43a9:	74 15                	je     43c0 <strlen+0x20>
+    43ab:	31 c0                	xor    %eax,%eax
+    43ad:	8d 76 00             	lea    0x0(%esi),%esi
+    43b0:	83 c0 01             	add    $0x1,%eax
+    43b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    43b7:	89 c1                	mov    %eax,%ecx
+    43b9:	75 f5                	jne    43b0 <strlen+0x10>
+    ;
+  return n;
+}
+    43bb:	89 c8                	mov    %ecx,%eax
+    43bd:	5d                   	pop    %ebp
+    43be:	c3                   	ret
+    43bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    43c0:	31 c9                	xor    %ecx,%ecx
+}
+    43c2:	5d                   	pop    %ebp
+    43c3:	89 c8                	mov    %ecx,%eax
+    43c5:	c3                   	ret
+    43c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000043d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    43d0:	55                   	push   %ebp
+    43d1:	89 e5                	mov    %esp,%ebp
+    43d3:	57                   	push   %edi
+    43d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    43d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    43da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43dd:	89 d7                	mov    %edx,%edi
+    43df:	fc                   	cld
+    43e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    43e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    43e5:	89 d0                	mov    %edx,%eax
+    43e7:	c9                   	leave
+    43e8:	c3                   	ret
+    43e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000043f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    43f0:	55                   	push   %ebp
+    43f1:	89 e5                	mov    %esp,%ebp
+    43f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    43f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    43fa:	0f b6 10             	movzbl (%eax),%edx
+    43fd:	84 d2                	test   %dl,%dl
+    43ff:	75 12                	jne    4413 <strchr+0x23>
+    4401:	eb 1d                	jmp    4420 <strchr+0x30>
+    4403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4407:	90                   	nop
+    4408:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    440c:	83 c0 01             	add    $0x1,%eax
+    440f:	84 d2                	test   %dl,%dl
+    4411:	74 0d                	je     4420 <strchr+0x30>
+    if(*s == c)
+    4413:	38 d1                	cmp    %dl,%cl
+    4415:	75 f1                	jne    4408 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4417:	5d                   	pop    %ebp
+    4418:	c3                   	ret
+    4419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4420:	31 c0                	xor    %eax,%eax
+}
+    4422:	5d                   	pop    %ebp
+    4423:	c3                   	ret
+    4424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    442b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    442f:	90                   	nop
+
+00004430 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4430:	55                   	push   %ebp
+    4431:	89 e5                	mov    %esp,%ebp
+    4433:	57                   	push   %edi
+    4434:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4435:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4438:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4439:	31 db                	xor    %ebx,%ebx
+{
+    443b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    443e:	eb 27                	jmp    4467 <gets+0x37>
+    cc = read(0, &c, 1);
+    4440:	83 ec 04             	sub    $0x4,%esp
+    4443:	6a 01                	push   $0x1
+    4445:	56                   	push   %esi
+    4446:	6a 00                	push   $0x0
+    4448:	e8 2d 02 00 00       	call   467a <read>
+    if(cc < 1)
+    444d:	83 c4 10             	add    $0x10,%esp
+    4450:	85 c0                	test   %eax,%eax
+    4452:	7e 1d                	jle    4471 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4454:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4458:	8b 55 08             	mov    0x8(%ebp),%edx
+    445b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    445f:	3c 0a                	cmp    $0xa,%al
+    4461:	74 10                	je     4473 <gets+0x43>
+    4463:	3c 0d                	cmp    $0xd,%al
+    4465:	74 0c                	je     4473 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4467:	89 df                	mov    %ebx,%edi
+    4469:	83 c3 01             	add    $0x1,%ebx
+    446c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    446f:	7c cf                	jl     4440 <gets+0x10>
+    4471:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4473:	8b 45 08             	mov    0x8(%ebp),%eax
+    4476:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    447a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    447d:	5b                   	pop    %ebx
+    447e:	5e                   	pop    %esi
+    447f:	5f                   	pop    %edi
+    4480:	5d                   	pop    %ebp
+    4481:	c3                   	ret
+    4482:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004490 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4490:	55                   	push   %ebp
+    4491:	89 e5                	mov    %esp,%ebp
+    4493:	56                   	push   %esi
+    4494:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4495:	83 ec 08             	sub    $0x8,%esp
+    4498:	6a 00                	push   $0x0
+    449a:	ff 75 08             	push   0x8(%ebp)
+    449d:	e8 23 02 00 00       	call   46c5 <open>
+  if(fd < 0)
+    44a2:	83 c4 10             	add    $0x10,%esp
+    44a5:	85 c0                	test   %eax,%eax
+    44a7:	78 27                	js     44d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    44a9:	83 ec 08             	sub    $0x8,%esp
+    44ac:	ff 75 0c             	push   0xc(%ebp)
+    44af:	89 c3                	mov    %eax,%ebx
+    44b1:	50                   	push   %eax
+    44b2:	e8 3b 02 00 00       	call   46f2 <fstat>
+  close(fd);
+    44b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    44ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    44bc:	e8 d7 01 00 00       	call   4698 <close>
+  return r;
+    44c1:	83 c4 10             	add    $0x10,%esp
+}
+    44c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    44c7:	89 f0                	mov    %esi,%eax
+    44c9:	5b                   	pop    %ebx
+    44ca:	5e                   	pop    %esi
+    44cb:	5d                   	pop    %ebp
+    44cc:	c3                   	ret
+    44cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    44d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    44d5:	eb ed                	jmp    44c4 <stat+0x34>
+    44d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44de:	66 90                	xchg   %ax,%ax
+
+000044e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    44e0:	55                   	push   %ebp
+    44e1:	89 e5                	mov    %esp,%ebp
+    44e3:	53                   	push   %ebx
+    44e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    44e7:	0f be 02             	movsbl (%edx),%eax
+    44ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    44ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    44f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    44f5:	77 1e                	ja     4515 <atoi+0x35>
+    44f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4500:	83 c2 01             	add    $0x1,%edx
+    4503:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4506:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    450a:	0f be 02             	movsbl (%edx),%eax
+    450d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4510:	80 fb 09             	cmp    $0x9,%bl
+    4513:	76 eb                	jbe    4500 <atoi+0x20>
+  return n;
+}
+    4515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4518:	89 c8                	mov    %ecx,%eax
+    451a:	c9                   	leave
+    451b:	c3                   	ret
+    451c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004520 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4520:	55                   	push   %ebp
+    4521:	89 e5                	mov    %esp,%ebp
+    4523:	57                   	push   %edi
+    4524:	56                   	push   %esi
+    4525:	8b 45 10             	mov    0x10(%ebp),%eax
+    4528:	8b 55 08             	mov    0x8(%ebp),%edx
+    452b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    452e:	85 c0                	test   %eax,%eax
+    4530:	7e 13                	jle    4545 <memmove+0x25>
+    4532:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4534:	89 d7                	mov    %edx,%edi
+    4536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    453d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4540:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4541:	39 f8                	cmp    %edi,%eax
+    4543:	75 fb                	jne    4540 <memmove+0x20>
+  return vdst;
+}
+    4545:	5e                   	pop    %esi
+    4546:	89 d0                	mov    %edx,%eax
+    4548:	5f                   	pop    %edi
+    4549:	5d                   	pop    %ebp
+    454a:	c3                   	ret
+    454b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    454f:	90                   	nop
+
+00004550 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    4550:	55                   	push   %ebp
+    4551:	89 e5                	mov    %esp,%ebp
+    4553:	56                   	push   %esi
+    4554:	53                   	push   %ebx
+    4555:	8b 75 10             	mov    0x10(%ebp),%esi
+    4558:	8b 55 08             	mov    0x8(%ebp),%edx
+    455b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+    455e:	85 f6                	test   %esi,%esi
+    4560:	74 2e                	je     4590 <memcmp+0x40>
+    4562:	01 c6                	add    %eax,%esi
+    4564:	eb 14                	jmp    457a <memcmp+0x2a>
+    4566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    456d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+    4570:	83 c0 01             	add    $0x1,%eax
+    4573:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+    4576:	39 f0                	cmp    %esi,%eax
+    4578:	74 16                	je     4590 <memcmp+0x40>
+    if(*s1 != *s2)
+    457a:	0f b6 0a             	movzbl (%edx),%ecx
+    457d:	0f b6 18             	movzbl (%eax),%ebx
+    4580:	38 d9                	cmp    %bl,%cl
+    4582:	74 ec                	je     4570 <memcmp+0x20>
+      return *s1 - *s2;
+    4584:	0f b6 c1             	movzbl %cl,%eax
+    4587:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    4589:	5b                   	pop    %ebx
+    458a:	5e                   	pop    %esi
+    458b:	5d                   	pop    %ebp
+    458c:	c3                   	ret
+    458d:	8d 76 00             	lea    0x0(%esi),%esi
+    4590:	5b                   	pop    %ebx
+  return 0;
+    4591:	31 c0                	xor    %eax,%eax
+}
+    4593:	5e                   	pop    %esi
+    4594:	5d                   	pop    %ebp
+    4595:	c3                   	ret
+    4596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    459d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000045a0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+    45a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    45a5:	c3                   	ret
+    45a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000045b0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+    45b0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+    45b2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+    45b8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+    45be:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+    45c4:	c3                   	ret
+    45c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000045d0 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+    45d0:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+    45d2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+    45d8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+    45de:	c3                   	ret
+    45df:	90                   	nop
+
+000045e0 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+    45e0:	55                   	push   %ebp
+    45e1:	89 e5                	mov    %esp,%ebp
+    45e3:	57                   	push   %edi
+    45e4:	56                   	push   %esi
+    45e5:	53                   	push   %ebx
+    45e6:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+    45e8:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+    45ed:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+    45f3:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+    45f9:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+    45ff:	89 c6                	mov    %eax,%esi
+    4601:	f7 f7                	div    %edi
+    4603:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+    4605:	f7 e3                	mul    %ebx
+    4607:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+    460a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+    460d:	89 d3                	mov    %edx,%ebx
+    460f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+    4612:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+    4614:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+    4616:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+    461c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    4621:	f7 e6                	mul    %esi
+    4623:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+    4629:	29 d9                	sub    %ebx,%ecx
+    462b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+    4631:	01 c1                	add    %eax,%ecx
+    4633:	8b 45 08             	mov    0x8(%ebp),%eax
+    4636:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+    4639:	5b                   	pop    %ebx
+    463a:	5e                   	pop    %esi
+    463b:	5f                   	pop    %edi
+    463c:	5d                   	pop    %ebp
+    463d:	c3                   	ret
+
+0000463e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+    463e:	b8 01 00 00 00       	mov    $0x1,%eax
+    4643:	89 e1                	mov    %esp,%ecx
+    4645:	ba 4c 46 00 00       	mov    $0x464c,%edx
+    464a:	0f 34                	sysenter
+    464c:	c3                   	ret
+
+0000464d <exit>:
+SYSCALL(exit)
+    464d:	b8 02 00 00 00       	mov    $0x2,%eax
+    4652:	89 e1                	mov    %esp,%ecx
+    4654:	ba 5b 46 00 00       	mov    $0x465b,%edx
+    4659:	0f 34                	sysenter
+    465b:	c3                   	ret
+
+0000465c <wait>:
+SYSCALL(wait)
+    465c:	b8 03 00 00 00       	mov    $0x3,%eax
+    4661:	89 e1                	mov    %esp,%ecx
+    4663:	ba 6a 46 00 00       	mov    $0x466a,%edx
+    4668:	0f 34                	sysenter
+    466a:	c3                   	ret
+
+0000466b <pipe>:
+SYSCALL(pipe)
+    466b:	b8 04 00 00 00       	mov    $0x4,%eax
+    4670:	89 e1                	mov    %esp,%ecx
+    4672:	ba 79 46 00 00       	mov    $0x4679,%edx
+    4677:	0f 34                	sysenter
+    4679:	c3                   	ret
+
+0000467a <read>:
+SYSCALL(read)
+    467a:	b8 05 00 00 00       	mov    $0x5,%eax
+    467f:	89 e1                	mov    %esp,%ecx
+    4681:	ba 88 46 00 00       	mov    $0x4688,%edx
+    4686:	0f 34                	sysenter
+    4688:	c3                   	ret
+
+00004689 <write>:
+SYSCALL(write)
+    4689:	b8 10 00 00 00       	mov    $0x10,%eax
+    468e:	89 e1                	mov    %esp,%ecx
+    4690:	ba 97 46 00 00       	mov    $0x4697,%edx
+    4695:	0f 34                	sysenter
+    4697:	c3                   	ret
+
+00004698 <close>:
+SYSCALL(close)
+    4698:	b8 15 00 00 00       	mov    $0x15,%eax
+    469d:	89 e1                	mov    %esp,%ecx
+    469f:	ba a6 46 00 00       	mov    $0x46a6,%edx
+    46a4:	0f 34                	sysenter
+    46a6:	c3                   	ret
+
+000046a7 <kill>:
+SYSCALL(kill)
+    46a7:	b8 06 00 00 00       	mov    $0x6,%eax
+    46ac:	89 e1                	mov    %esp,%ecx
+    46ae:	ba b5 46 00 00       	mov    $0x46b5,%edx
+    46b3:	0f 34                	sysenter
+    46b5:	c3                   	ret
+
+000046b6 <exec>:
+SYSCALL(exec)
+    46b6:	b8 07 00 00 00       	mov    $0x7,%eax
+    46bb:	89 e1                	mov    %esp,%ecx
+    46bd:	ba c4 46 00 00       	mov    $0x46c4,%edx
+    46c2:	0f 34                	sysenter
+    46c4:	c3                   	ret
+
+000046c5 <open>:
+SYSCALL(open)
+    46c5:	b8 0f 00 00 00       	mov    $0xf,%eax
+    46ca:	89 e1                	mov    %esp,%ecx
+    46cc:	ba d3 46 00 00       	mov    $0x46d3,%edx
+    46d1:	0f 34                	sysenter
+    46d3:	c3                   	ret
+
+000046d4 <mknod>:
+SYSCALL(mknod)
+    46d4:	b8 11 00 00 00       	mov    $0x11,%eax
+    46d9:	89 e1                	mov    %esp,%ecx
+    46db:	ba e2 46 00 00       	mov    $0x46e2,%edx
+    46e0:	0f 34                	sysenter
+    46e2:	c3                   	ret
+
+000046e3 <unlink>:
+SYSCALL(unlink)
+    46e3:	b8 12 00 00 00       	mov    $0x12,%eax
+    46e8:	89 e1                	mov    %esp,%ecx
+    46ea:	ba f1 46 00 00       	mov    $0x46f1,%edx
+    46ef:	0f 34                	sysenter
+    46f1:	c3                   	ret
+
+000046f2 <fstat>:
+SYSCALL(fstat)
+    46f2:	b8 08 00 00 00       	mov    $0x8,%eax
+    46f7:	89 e1                	mov    %esp,%ecx
+    46f9:	ba 00 47 00 00       	mov    $0x4700,%edx
+    46fe:	0f 34                	sysenter
+    4700:	c3                   	ret
+
+00004701 <link>:
+SYSCALL(link)
+    4701:	b8 13 00 00 00       	mov    $0x13,%eax
+    4706:	89 e1                	mov    %esp,%ecx
+    4708:	ba 0f 47 00 00       	mov    $0x470f,%edx
+    470d:	0f 34                	sysenter
+    470f:	c3                   	ret
+
+00004710 <mkdir>:
+SYSCALL(mkdir)
+    4710:	b8 14 00 00 00       	mov    $0x14,%eax
+    4715:	89 e1                	mov    %esp,%ecx
+    4717:	ba 1e 47 00 00       	mov    $0x471e,%edx
+    471c:	0f 34                	sysenter
+    471e:	c3                   	ret
+
+0000471f <chdir>:
+SYSCALL(chdir)
+    471f:	b8 09 00 00 00       	mov    $0x9,%eax
+    4724:	89 e1                	mov    %esp,%ecx
+    4726:	ba 2d 47 00 00       	mov    $0x472d,%edx
+    472b:	0f 34                	sysenter
+    472d:	c3                   	ret
+
+0000472e <dup>:
+SYSCALL(dup)
+    472e:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4733:	89 e1                	mov    %esp,%ecx
+    4735:	ba 3c 47 00 00       	mov    $0x473c,%edx
+    473a:	0f 34                	sysenter
+    473c:	c3                   	ret
+
+0000473d <sbrk>:
+SYSCALL(sbrk)
+    473d:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4742:	89 e1                	mov    %esp,%ecx
+    4744:	ba 4b 47 00 00       	mov    $0x474b,%edx
+    4749:	0f 34                	sysenter
+    474b:	c3                   	ret
+
+0000474c <sleep>:
+SYSCALL(sleep)
+    474c:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4751:	89 e1                	mov    %esp,%ecx
+    4753:	ba 5a 47 00 00       	mov    $0x475a,%edx
+    4758:	0f 34                	sysenter
+    475a:	c3                   	ret
+
+0000475b <fallocate>:
+SYSCALL(fallocate)
+    475b:	b8 16 00 00 00       	mov    $0x16,%eax
+    4760:	89 e1                	mov    %esp,%ecx
+    4762:	ba 69 47 00 00       	mov    $0x4769,%edx
+    4767:	0f 34                	sysenter
+    4769:	c3                   	ret
+
+0000476a <pread>:
+SYSCALL(pread)
+    476a:	b8 17 00 00 00       	mov    $0x17,%eax
+    476f:	89 e1                	mov    %esp,%ecx
+    4771:	ba 78 47 00 00       	mov    $0x4778,%edx
+    4776:	0f 34                	sysenter
+    4778:	c3                   	ret
+
+00004779 <pwrite>:
+SYSCALL(pwrite)
+    4779:	b8 18 00 00 00       	mov    $0x18,%eax
+    477e:	89 e1                	mov    %esp,%ecx
+    4780:	ba 87 47 00 00       	mov    $0x4787,%edx
+    4785:	0f 34                	sysenter
+    4787:	c3                   	ret
+
+00004788 <readv>:
+SYSCALL(readv)
+    4788:	b8 19 00 00 00       	mov    $0x19,%eax
+    478d:	89 e1                	mov    %esp,%ecx
+    478f:	ba 96 47 00 00       	mov    $0x4796,%edx
+    4794:	0f 34                	sysenter
+    4796:	c3                   	ret
+
+00004797 <writev>:
+SYSCALL(writev)
+    4797:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    479c:	89 e1                	mov    %esp,%ecx
+    479e:	ba a5 47 00 00       	mov    $0x47a5,%edx
+    47a3:	0f 34                	sysenter
+    47a5:	c3                   	ret
+
+000047a6 <splice>:
+SYSCALL(splice)
+    47a6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    47ab:	89 e1                	mov    %esp,%ecx
+    47ad:	ba b4 47 00 00       	mov    $0x47b4,%edx
+    47b2:	0f 34                	sysenter
+    47b4:	c3                   	ret
+
+000047b5 <setpriority>:
+SYSCALL(setpriority)
+    47b5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    47ba:	89 e1                	mov    %esp,%ecx
+    47bc:	ba c3 47 00 00       	mov    $0x47c3,%edx
+    47c1:	0f 34                	sysenter
+    47c3:	c3                   	ret
+
+000047c4 <setaffinity>:
+SYSCALL(setaffinity)
+    47c4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    47c9:	89 e1                	mov    %esp,%ecx
+    47cb:	ba d2 47 00 00       	mov    $0x47d2,%edx
+    47d0:	0f 34                	sysenter
+    47d2:	c3                   	ret
+
+000047d3 <lockstress>:
+SYSCALL(lockstress)
+    47d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    47d8:	89 e1                	mov    %esp,%ecx
+    47da:	ba e1 47 00 00       	mov    $0x47e1,%edx
+    47df:	0f 34                	sysenter
+    47e1:	c3                   	ret
+
+000047e2 <lockstat>:
+SYSCALL(lockstat)
+    47e2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    47e7:	89 e1                	mov    %esp,%ecx
+    47e9:	ba f0 47 00 00       	mov    $0x47f0,%edx
+    47ee:	0f 34                	sysenter
+    47f0:	c3                   	ret
+
+000047f1 <profctl>:
+SYSCALL(profctl)
+    47f1:	b8 20 00 00 00       	mov    $0x20,%eax
+    47f6:	89 e1                	mov    %esp,%ecx
+    47f8:	ba ff 47 00 00       	mov    $0x47ff,%edx
+    47fd:	0f 34                	sysenter
+    47ff:	c3                   	ret
+
+00004800 <profread>:
+SYSCALL(profread)
+    4800:	b8 21 00 00 00       	mov    $0x21,%eax
+    4805:	89 e1                	mov    %esp,%ecx
+    4807:	ba 0e 48 00 00       	mov    $0x480e,%edx
+    480c:	0f 34                	sysenter
+    480e:	c3                   	ret
+
+0000480f <getrusage>:
+SYSCALL(getrusage)
+    480f:	b8 22 00 00 00       	mov    $0x22,%eax
+    4814:	89 e1                	mov    %esp,%ecx
+    4816:	ba 1d 48 00 00       	mov    $0x481d,%edx
+    481b:	0f 34                	sysenter
+    481d:	c3                   	ret
+
+0000481e <tracectl>:
+SYSCALL(tracectl)
+    481e:	b8 23 00 00 00       	mov    $0x23,%eax
+    4823:	89 e1                	mov    %esp,%ecx
+    4825:	ba 2c 48 00 00       	mov    $0x482c,%edx
+    482a:	0f 34                	sysenter
+    482c:	c3                   	ret
+
+0000482d <traceread>:
+SYSCALL(traceread)
+    482d:	b8 24 00 00 00       	mov    $0x24,%eax
+    4832:	89 e1                	mov    %esp,%ecx
+    4834:	ba 3b 48 00 00       	mov    $0x483b,%edx
+    4839:	0f 34                	sysenter
+    483b:	c3                   	ret
+
+0000483c <nanosleep>:
+SYSCALL(nanosleep)
+    483c:	b8 25 00 00 00       	mov    $0x25,%eax
+    4841:	89 e1                	mov    %esp,%ecx
+    4843:	ba 4a 48 00 00       	mov    $0x484a,%edx
+    4848:	0f 34                	sysenter
+    484a:	c3                   	ret
+    484b:	66 90                	xchg   %ax,%ax
+    484d:	66 90                	xchg   %ax,%ax
+    484f:	90                   	nop
+
+00004850 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4850:	55                   	push   %ebp
+    4851:	89 e5                	mov    %esp,%ebp
+    4853:	57                   	push   %edi
+    4854:	56                   	push   %esi
+    4855:	53                   	push   %ebx
+    4856:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4858:	89 d1                	mov    %edx,%ecx
+{
+    485a:	83 ec 3c             	sub    $0x3c,%esp
+    485d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4860:	85 d2                	test   %edx,%edx
+    4862:	0f 89 80 00 00 00    	jns    48e8 <printint+0x98>
+    4868:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    486c:	74 7a                	je     48e8 <printint+0x98>
+    x = -xx;
+    486e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4870:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4875:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4878:	31 f6                	xor    %esi,%esi
+    487a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4880:	89 c8                	mov    %ecx,%eax
+    4882:	31 d2                	xor    %edx,%edx
+    4884:	89 f7                	mov    %esi,%edi
+    4886:	f7 f3                	div    %ebx
+    4888:	8d 76 01             	lea    0x1(%esi),%esi
+    488b:	0f b6 92 88 68 00 00 	movzbl 0x6888(%edx),%edx
+    4892:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4896:	89 ca                	mov    %ecx,%edx
+    4898:	89 c1                	mov    %eax,%ecx
+    489a:	39 da                	cmp    %ebx,%edx
+    489c:	73 e2                	jae    4880 <printint+0x30>
+  if(neg)
+    489e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    48a1:	85 c0                	test   %eax,%eax
+    48a3:	74 07                	je     48ac <printint+0x5c>
+    buf[i++] = '-';
+    48a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    48aa:	89 f7                	mov    %esi,%edi
+    48ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    48af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    48b2:	01 df                	add    %ebx,%edi
+    48b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    48b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    48bb:	83 ec 04             	sub    $0x4,%esp
+    48be:	88 45 d7             	mov    %al,-0x29(%ebp)
+    48c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    48c4:	6a 01                	push   $0x1
+    48c6:	50                   	push   %eax
+    48c7:	56                   	push   %esi
+    48c8:	e8 bc fd ff ff       	call   4689 <write>
+  while(--i >= 0)
+    48cd:	89 f8                	mov    %edi,%eax
+    48cf:	83 c4 10             	add    $0x10,%esp
+    48d2:	83 ef 01             	sub    $0x1,%edi
+    48d5:	39 d8                	cmp    %ebx,%eax
+    48d7:	75 df                	jne    48b8 <printint+0x68>
+}
+    48d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    48dc:	5b                   	pop    %ebx
+    48dd:	5e                   	pop    %esi
+    48de:	5f                   	pop    %edi
+    48df:	5d                   	pop    %ebp
+    48e0:	c3                   	ret
+    48e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    48e8:	31 c0                	xor    %eax,%eax
+    48ea:	eb 89                	jmp    4875 <printint+0x25>
+    48ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000048f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    48f0:	55                   	push   %ebp
+    48f1:	89 e5                	mov    %esp,%ebp
+    48f3:	57                   	push   %edi
+    48f4:	56                   	push   %esi
+    48f5:	53                   	push   %ebx
+    48f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    48f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    48fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    48ff:	0f b6 1e             	movzbl (%esi),%ebx
+    4902:	83 c6 01             	add    $0x1,%esi
+    4905:	84 db                	test   %bl,%bl
+    4907:	74 67                	je     4970 <printf+0x80>
+    4909:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    490c:	31 d2                	xor    %edx,%edx
+    490e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4911:	eb 34                	jmp    4947 <printf+0x57>
+    4913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4917:	90                   	nop
+    4918:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    491b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4920:	83 f8 25             	cmp    $0x25,%eax
+    4923:	74 18                	je     493d <printf+0x4d>
+  write(fd, &c, 1);
+    4925:	83 ec 04             	sub    $0x4,%esp
+    4928:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    492b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    492e:	6a 01                	push   $0x1
+    4930:	50                   	push   %eax
+    4931:	57                   	push   %edi
+    4932:	e8 52 fd ff ff       	call   4689 <write>
+    4937:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    493a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    493d:	0f b6 1e             	movzbl (%esi),%ebx
+    4940:	83 c6 01             	add    $0x1,%esi
+    4943:	84 db                	test   %bl,%bl
+    4945:	74 29                	je     4970 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4947:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    494a:	85 d2                	test   %edx,%edx
+    494c:	74 ca                	je     4918 <printf+0x28>
+      }
+    } else if(state == '%'){
+    494e:	83 fa 25             	cmp    $0x25,%edx
+    4951:	75 ea                	jne    493d <printf+0x4d>
+      if(c == 'd'){
+    4953:	83 f8 25             	cmp    $0x25,%eax
+    4956:	0f 84 24 01 00 00    	je     4a80 <printf+0x190>
+    495c:	83 e8 63             	sub    $0x63,%eax
+    495f:	83 f8 15             	cmp    $0x15,%eax
+    4962:	77 1c                	ja     4980 <printf+0x90>
+    4964:	ff 24 85 30 68 00 00 	jmp    *0x6830(,%eax,4)
+    496b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    496f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4970:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4973:	5b                   	pop    %ebx
+    4974:	5e                   	pop    %esi
+    4975:	5f                   	pop    %edi
+    4976:	5d                   	pop    %ebp
+    4977:	c3                   	ret
+    4978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    497f:	90                   	nop
+  write(fd, &c, 1);
+    4980:	83 ec 04             	sub    $0x4,%esp
+    4983:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4986:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    498a:	6a 01                	push   $0x1
+    498c:	52                   	push   %edx
+    498d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4990:	57                   	push   %edi
+    4991:	e8 f3 fc ff ff       	call   4689 <write>
+    4996:	83 c4 0c             	add    $0xc,%esp
+    4999:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    499c:	6a 01                	push   $0x1
+    499e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    49a1:	52                   	push   %edx
+    49a2:	57                   	push   %edi
+    49a3:	e8 e1 fc ff ff       	call   4689 <write>
+        putc(fd, c);
+    49a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    49ab:	31 d2                	xor    %edx,%edx
+    49ad:	eb 8e                	jmp    493d <printf+0x4d>
+    49af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    49b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    49b3:	83 ec 0c             	sub    $0xc,%esp
+    49b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    49bb:	8b 13                	mov    (%ebx),%edx
+    49bd:	6a 00                	push   $0x0
+    49bf:	89 f8                	mov    %edi,%eax
+        ap++;
+    49c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    49c4:	e8 87 fe ff ff       	call   4850 <printint>
+        ap++;
+    49c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    49cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    49cf:	31 d2                	xor    %edx,%edx
+    49d1:	e9 67 ff ff ff       	jmp    493d <printf+0x4d>
+    49d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    49e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    49e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    49e5:	83 c0 04             	add    $0x4,%eax
+    49e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    49eb:	85 db                	test   %ebx,%ebx
+    49ed:	0f 84 9d 00 00 00    	je     4a90 <printf+0x1a0>
+        while(*s != 0){
+    49f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    49f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    49f8:	84 c0                	test   %al,%al
+    49fa:	0f 84 3d ff ff ff    	je     493d <printf+0x4d>
+    4a00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4a03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4a06:	89 de                	mov    %ebx,%esi
+    4a08:	89 d3                	mov    %edx,%ebx
+    4a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4a10:	83 ec 04             	sub    $0x4,%esp
+    4a13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4a16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4a19:	6a 01                	push   $0x1
+    4a1b:	53                   	push   %ebx
+    4a1c:	57                   	push   %edi
+    4a1d:	e8 67 fc ff ff       	call   4689 <write>
+        while(*s != 0){
+    4a22:	0f b6 06             	movzbl (%esi),%eax
+    4a25:	83 c4 10             	add    $0x10,%esp
+    4a28:	84 c0                	test   %al,%al
+    4a2a:	75 e4                	jne    4a10 <printf+0x120>
+      state = 0;
+    4a2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4a2f:	31 d2                	xor    %edx,%edx
+    4a31:	e9 07 ff ff ff       	jmp    493d <printf+0x4d>
+    4a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4a43:	83 ec 0c             	sub    $0xc,%esp
+    4a46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4a4b:	8b 13                	mov    (%ebx),%edx
+    4a4d:	6a 01                	push   $0x1
+    4a4f:	e9 6b ff ff ff       	jmp    49bf <printf+0xcf>
+    4a54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4a58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4a5b:	83 ec 04             	sub    $0x4,%esp
+    4a5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4a61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4a63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4a66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4a69:	6a 01                	push   $0x1
+    4a6b:	52                   	push   %edx
+    4a6c:	57                   	push   %edi
+    4a6d:	e8 17 fc ff ff       	call   4689 <write>
+        ap++;
+    4a72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4a75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4a78:	31 d2                	xor    %edx,%edx
+    4a7a:	e9 be fe ff ff       	jmp    493d <printf+0x4d>
+    4a7f:	90                   	nop
+  write(fd, &c, 1);
+    4a80:	83 ec 04             	sub    $0x4,%esp
+    4a83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4a86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4a89:	6a 01                	push   $0x1
+    4a8b:	e9 11 ff ff ff       	jmp    49a1 <printf+0xb1>
+    4a90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4a95:	bb 26 68 00 00       	mov    $0x6826,%ebx
+    4a9a:	e9 61 ff ff ff       	jmp    4a00 <printf+0x110>
+    4a9f:	90                   	nop
+
+00004aa0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4aa0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4aa1:	a1 20 bb 00 00       	mov    0xbb20,%eax
+{
+    4aa6:	89 e5                	mov    %esp,%ebp
+    4aa8:	57                   	push   %edi
+    4aa9:	56                   	push   %esi
+    4aaa:	53                   	push   %ebx
+    4aab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4aae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ab8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4aba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4abc:	39 ca                	cmp    %ecx,%edx
+    4abe:	73 30                	jae    4af0 <free+0x50>
+    4ac0:	39 c1                	cmp    %eax,%ecx
+    4ac2:	72 04                	jb     4ac8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4ac4:	39 c2                	cmp    %eax,%edx
+    4ac6:	72 f0                	jb     4ab8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4ac8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4acb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4ace:	39 f8                	cmp    %edi,%eax
+    4ad0:	74 2e                	je     4b00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4ad2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4ad5:	8b 42 04             	mov    0x4(%edx),%eax
+    4ad8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4adb:	39 f1                	cmp    %esi,%ecx
+    4add:	74 38                	je     4b17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4adf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4ae1:	5b                   	pop    %ebx
+  freep = p;
+    4ae2:	89 15 20 bb 00 00    	mov    %edx,0xbb20
+}
+    4ae8:	5e                   	pop    %esi
+    4ae9:	5f                   	pop    %edi
+    4aea:	5d                   	pop    %ebp
+    4aeb:	c3                   	ret
+    4aec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4af0:	39 c1                	cmp    %eax,%ecx
+    4af2:	72 d0                	jb     4ac4 <free+0x24>
+    4af4:	eb c2                	jmp    4ab8 <free+0x18>
+    4af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4afd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4b00:	03 70 04             	add    0x4(%eax),%esi
+    4b03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4b06:	8b 02                	mov    (%edx),%eax
+    4b08:	8b 00                	mov    (%eax),%eax
+    4b0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4b0d:	8b 42 04             	mov    0x4(%edx),%eax
+    4b10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4b13:	39 f1                	cmp    %esi,%ecx
+    4b15:	75 c8                	jne    4adf <free+0x3f>
+    p->s.size += bp->s.size;
+    4b17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4b1a:	89 15 20 bb 00 00    	mov    %edx,0xbb20
+    p->s.size += bp->s.size;
+    4b20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4b23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4b26:	89 0a                	mov    %ecx,(%edx)
+}
+    4b28:	5b                   	pop    %ebx
+    4b29:	5e                   	pop    %esi
+    4b2a:	5f                   	pop    %edi
+    4b2b:	5d                   	pop    %ebp
+    4b2c:	c3                   	ret
+    4b2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004b30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4b30:	55                   	push   %ebp
+    4b31:	89 e5                	mov    %esp,%ebp
+    4b33:	57                   	push   %edi
+    4b34:	56                   	push   %esi
+    4b35:	53                   	push   %ebx
+    4b36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4b3c:	8b 15 20 bb 00 00    	mov    0xbb20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b42:	8d 78 07             	lea    0x7(%eax),%edi
+    4b45:	c1 ef 03             	shr    $0x3,%edi
+    4b48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4b4b:	85 d2                	test   %edx,%edx
+    4b4d:	0f 84 8d 00 00 00    	je     4be0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b55:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b58:	39 f9                	cmp    %edi,%ecx
+    4b5a:	73 64                	jae    4bc0 <malloc+0x90>
+  if(nu < 4096)
+    4b5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4b61:	39 df                	cmp    %ebx,%edi
+    4b63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4b66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4b6d:	eb 0a                	jmp    4b79 <malloc+0x49>
+    4b6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b72:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b75:	39 f9                	cmp    %edi,%ecx
+    4b77:	73 47                	jae    4bc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4b79:	89 c2                	mov    %eax,%edx
+    4b7b:	39 05 20 bb 00 00    	cmp    %eax,0xbb20
+    4b81:	75 ed                	jne    4b70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4b83:	83 ec 0c             	sub    $0xc,%esp
+    4b86:	56                   	push   %esi
+    4b87:	e8 b1 fb ff ff       	call   473d <sbrk>
+  if(p == (char*)-1)
+    4b8c:	83 c4 10             	add    $0x10,%esp
+    4b8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4b92:	74 1c                	je     4bb0 <malloc+0x80>
+  hp->s.size = nu;
+    4b94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4b97:	83 ec 0c             	sub    $0xc,%esp
+    4b9a:	83 c0 08             	add    $0x8,%eax
+    4b9d:	50                   	push   %eax
+    4b9e:	e8 fd fe ff ff       	call   4aa0 <free>
+  return freep;
+    4ba3:	8b 15 20 bb 00 00    	mov    0xbb20,%edx
+      if((p = morecore(nunits)) == 0)
+    4ba9:	83 c4 10             	add    $0x10,%esp
+    4bac:	85 d2                	test   %edx,%edx
+    4bae:	75 c0                	jne    4b70 <malloc+0x40>
+        return 0;
+  }
+}
+    4bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4bb3:	31 c0                	xor    %eax,%eax
+}
+    4bb5:	5b                   	pop    %ebx
+    4bb6:	5e                   	pop    %esi
+    4bb7:	5f                   	pop    %edi
+    4bb8:	5d                   	pop    %ebp
+    4bb9:	c3                   	ret
+    4bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4bc0:	39 cf                	cmp    %ecx,%edi
+    4bc2:	74 4c                	je     4c10 <malloc+0xe0>
+        p->s.size -= nunits;
+    4bc4:	29 f9                	sub    %edi,%ecx
+    4bc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4bc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4bcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4bcf:	89 15 20 bb 00 00    	mov    %edx,0xbb20
+}
+    4bd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4bd8:	83 c0 08             	add    $0x8,%eax
+}
+    4bdb:	5b                   	pop    %ebx
+    4bdc:	5e                   	pop    %esi
+    4bdd:	5f                   	pop    %edi
+    4bde:	5d                   	pop    %ebp
+    4bdf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4be0:	c7 05 20 bb 00 00 24 	movl   $0xbb24,0xbb20
+    4be7:	bb 00 00 
+    base.s.size = 0;
+    4bea:	b8 24 bb 00 00       	mov    $0xbb24,%eax
+    base.s.ptr = freep = prevp = &base;
+    4bef:	c7 05 24 bb 00 00 24 	movl   $0xbb24,0xbb24
+    4bf6:	bb 00 00 
+    base.s.size = 0;
+    4bf9:	c7 05 28 bb 00 00 00 	movl   $0x0,0xbb28
+    4c00:	00 00 00 
+    if(p->s.size >= nunits){
+    4c03:	e9 54 ff ff ff       	jmp    4b5c <malloc+0x2c>
+    4c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4c10:	8b 08                	mov    (%eax),%ecx
+    4c12:	89 0a                	mov    %ecx,(%edx)
+    4c14:	eb b9                	jmp    4bcf <malloc+0x9f>
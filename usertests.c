@@ -7,6 +7,8 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "uio.h"
+#include "date.h"
 
 char buf[8192];
 char name[3];
@@ -400,6 +402,51 @@ preempt(void)
   printf(1, "preempt ok\n");
 }
 
+// Under SCHED_MLFQ, a CPU-bound process drops below its nice
+// level as it uses up time slices, and a boost brings it back.
+void
+mlfqtest(void)
+{
+#ifdef SCHED_MLFQ
+  int pid, prio, demoted, t0;
+
+  printf(1, "mlfq test\n");
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0)
+    for(;;)
+      ;
+  if(setpriority(pid, 2) != 0){
+    printf(1, "setpriority failed\n");
+    exit();
+  }
+
+  // Look each tick until the child has been demoted and boosted.
+  demoted = 0;
+  t0 = uptime();
+  do {
+    sleep(1);
+    prio = setpriority(pid, -1);
+    if(prio < 2)
+      break;
+    if(prio > 2)
+      demoted = 1;
+  } while((!demoted || prio != 2) && uptime() - t0 < 4*BOOSTTICKS);
+  kill(pid);
+  wait();
+  if(!demoted || prio != 2){
+    printf(1, "mlfq: %s, level %d\n",
+           demoted ? "not boosted" : "not demoted", prio);
+    exit();
+  }
+
+  printf(1, "mlfq ok\n");
+#endif
+}
+
 // try to find any races between exit and wait
 void
 exitwait(void)
@@ -1200,6 +1247,363 @@ bigfile(void)
   printf(1, "bigfile test ok\n");
 }
 
+// small files live in the inode; do they survive
+// growing into a data block?
+void
+inlinetest(void)
+{
+  int fd, i;
+
+  printf(1, "inline test\n");
+
+  unlink("inlinef");
+  fd = open("inlinef", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create inlinef\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    buf[0] = 'a' + i % 26;
+    if(write(fd, buf, 1) != 1){
+      printf(1, "write inlinef failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("inlinef", 0);
+  if(fd < 0){
+    printf(1, "cannot open inlinef\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 100){
+    printf(1, "read inlinef wrong size\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    if(buf[i] != 'a' + i % 26){
+      printf(1, "read inlinef wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("inlinef");
+
+  printf(1, "inline test ok\n");
+}
+
+// fallocate() reserves blocks that read as zeroes
+// until they are written.
+void
+fallocatetest(void)
+{
+  int fd, i;
+  struct stat st;
+
+  printf(1, "fallocate test\n");
+
+  unlink("falloc");
+  fd = open("falloc", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create falloc\n");
+    exit();
+  }
+  memset(buf, 'x', 600);
+  if(write(fd, buf, 10) != 10){
+    printf(1, "write falloc failed\n");
+    exit();
+  }
+  if(fallocate(fd, 0, 3000) != 0){
+    printf(1, "fallocate failed\n");
+    exit();
+  }
+  if(fstat(fd, &st) < 0 || st.size != 3000){
+    printf(1, "fallocate wrong size\n");
+    exit();
+  }
+  if(write(fd, buf, 600) != 600){
+    printf(1, "write into fallocated blocks failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("falloc", 0);
+  if(fd < 0){
+    printf(1, "cannot open falloc\n");
+    exit();
+  }
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(1, "read falloc wrong size\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if(buf[i] != (i < 610 ? 'x' : 0)){
+      printf(1, "read falloc wrong data at %d\n", i);
+      exit();
+    }
+  }
+  close(fd);
+  unlink("falloc");
+
+  printf(1, "fallocate test ok\n");
+}
+
+// pread/pwrite leave the file offset alone;
+// readv/writev handle several buffers at once.
+void
+uiovtest(void)
+{
+  int fd, p[2];
+  struct iovec iov[2];
+
+  printf(1, "pread/readv test\n");
+
+  unlink("uiov");
+  fd = open("uiov", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create uiov\n");
+    exit();
+  }
+  if(write(fd, "aaaaaaaaaa", 10) != 10 || pwrite(fd, "bb", 2, 4) != 2){
+    printf(1, "pwrite uiov failed\n");
+    exit();
+  }
+  iov[0].iov_base = "cd";
+  iov[0].iov_len = 2;
+  iov[1].iov_base = "e";
+  iov[1].iov_len = 1;
+  if(writev(fd, iov, 2) != 3){
+    printf(1, "writev uiov failed\n");
+    exit();
+  }
+  if(pread(fd, buf, 4, 3) != 4 || memcmp(buf, "abba", 4) != 0){
+    printf(1, "pread uiov wrong data\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("uiov", 0);
+  if(fd < 0){
+    printf(1, "cannot open uiov\n");
+    exit();
+  }
+  iov[0].iov_base = buf;
+  iov[0].iov_len = 6;
+  iov[1].iov_base = buf + 100;
+  iov[1].iov_len = 50;
+  if(readv(fd, iov, 2) != 13){
+    printf(1, "readv uiov wrong size\n");
+    exit();
+  }
+  if(memcmp(buf, "aaaabb", 6) != 0 || memcmp(buf + 100, "aaaacde", 7) != 0){
+    printf(1, "readv uiov wrong data\n");
+    exit();
+  }
+  close(fd);
+  unlink("uiov");
+
+  // Filling iov[0] exactly from a pipe mustn't then wait for more.
+  if(pipe(p) != 0 || write(p[1], "0123456789", 10) != 10){
+    printf(1, "uiov pipe failed\n");
+    exit();
+  }
+  iov[0].iov_base = buf;
+  iov[0].iov_len = 10;
+  iov[1].iov_base = buf + 100;
+  iov[1].iov_len = 10;
+  if(readv(p[0], iov, 2) != 10 || memcmp(buf, "0123456789", 10) != 0){
+    printf(1, "readv pipe wrong data\n");
+    exit();
+  }
+  close(p[0]);
+  close(p[1]);
+
+  printf(1, "pread/readv test ok\n");
+}
+
+// move a file through a pipe into another file with splice()
+void
+splicetest(void)
+{
+  int fd, fd1, i, p[2];
+
+  printf(1, "splice test\n");
+
+  unlink("splice0");
+  unlink("splice1");
+  fd = open("splice0", O_CREATE | O_RDWR);
+  fd1 = open("splice1", O_CREATE | O_RDWR);
+  if(fd < 0 || fd1 < 0 || pipe(p) != 0){
+    printf(1, "splice setup failed\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++)
+    buf[i] = 'a' + i % 26;
+  if(write(fd, buf, 3000) != 3000){
+    printf(1, "write splice0 failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("splice0", 0);
+  if(splice(fd, p[1], 5000) != 3000 || splice(fd, p[1], 5000) != 0){
+    printf(1, "splice file to pipe failed\n");
+    exit();
+  }
+  close(p[1]);
+  if(splice(p[0], fd1, 5000) != 3000 || splice(p[0], fd1, 5000) != 0){
+    printf(1, "splice pipe to file failed\n");
+    exit();
+  }
+  close(p[0]);
+  close(fd);
+  close(fd1);
+
+  fd = open("splice1", 0);
+  memset(buf, 0, 3000);
+  if(read(fd, buf, sizeof(buf)) != 3000){
+    printf(1, "splice1 wrong size\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++){
+    if(buf[i] != 'a' + i % 26){
+      printf(1, "splice1 wrong data\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("splice0");
+  unlink("splice1");
+
+  printf(1, "splice test ok\n");
+}
+
+// nanosleep() sleeps about as long as asked, and rejects
+// nonsense. A sleep longer than the TSC can count lasts until
+// the sleeper is killed.
+void
+nanosleeptest(void)
+{
+  struct timespec ts;
+  int t0, t1, pid, p[2];
+  char c;
+
+  printf(1, "nanosleep test\n");
+
+  ts.tv_sec = 0;
+  ts.tv_nsec = 1000000000;
+  if(nanosleep(&ts) != -1){
+    printf(1, "nanosleep accepted bad tv_nsec\n");
+    exit();
+  }
+  ts.tv_nsec = 50000000;
+  t0 = uptime();
+  if(nanosleep(&ts) != 0){
+    printf(1, "nanosleep failed\n");
+    exit();
+  }
+  t1 = uptime();
+  if(t1 - t0 < 4 || t1 - t0 > 50){
+    printf(1, "nanosleep 50ms took %d ticks\n", t1 - t0);
+    exit();
+  }
+
+  if(pipe(p) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(p[0]);
+    ts.tv_sec = 0xffffffff;
+    ts.tv_nsec = 999999999;
+    nanosleep(&ts);
+    write(p[1], "x", 1);
+    exit();
+  }
+  close(p[1]);
+  sleep(5);
+  kill(pid);
+  wait();
+  if(read(p[0], &c, 1) != 0){
+    printf(1, "nanosleep with huge tv_sec returned\n");
+    exit();
+  }
+  close(p[0]);
+
+  printf(1, "nanosleep ok\n");
+}
+
+// A system call made by sysenter with the trap flag set single-
+// steps into the kernel, which must turn the flag off rather than
+// panic.
+void
+sysentertest(void)
+{
+  int r;
+
+  printf(1, "sysenter TF test\n");
+  asm volatile("movl %%esp, %%ecx\n\t"
+               "movl $1f, %%edx\n\t"
+               "pushfl\n\t"
+               "orl $0x100, (%%esp)\n\t"
+               "popfl\n\t"
+               "sysenter\n"
+               "1:"
+               : "=a" (r) : "0" (SYS_getpid) : "ecx", "edx", "memory", "cc");
+  if(r != getpid()){
+    printf(1, "sysenter with TF returned %d\n", r);
+    exit();
+  }
+  printf(1, "sysenter TF ok\n");
+}
+
+// getpid() and uptime() read the vdso page; check that a child
+// gets its own pid there, and that the clock agrees with the
+// kernel's.
+void
+vdsotest(void)
+{
+  int fd[2], pid, kpid, t0, t1;
+
+  printf(1, "vdso test\n");
+
+  if(pipe(fd) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    kpid = getpid();
+    write(fd[1], &kpid, sizeof(kpid));
+    exit();
+  }
+  if(read(fd[0], &kpid, sizeof(kpid)) != sizeof(kpid) || kpid != pid){
+    printf(1, "child's getpid() is %d, not %d\n", kpid, pid);
+    exit();
+  }
+  wait();
+  close(fd[0]);
+  close(fd[1]);
+
+  t0 = uptime();
+  asm volatile("int %1" : "=a" (t1) : "n" (T_SYSCALL), "0" (SYS_uptime));
+  if(t1 < t0 || t1 > uptime()){
+    printf(1, "uptime() %d but kernel says %d\n", t0, t1);
+    exit();
+  }
+
+  printf(1, "vdso ok\n");
+}
+
 void
 fourteen(void)
 {
@@ -1782,10 +2186,18 @@ main(int argc, char *argv[])
   mem();
   pipe1();
   preempt();
+  mlfqtest();
   exitwait();
 
   rmdot();
   fourteen();
+  inlinetest();
+  fallocatetest();
+  uiovtest();
+  splicetest();
+  nanosleeptest();
+  sysentertest();
+  vdsotest();
   bigfile();
   subdir();
   linktest();
@@ -0,0 +1,12 @@
+// The vdso page: read-only data the kernel maps at VDSO in every
+// process, so that ulib.c can answer getpid() and uptime(), and
+// tell the time to a cycle, without entering the kernel.
+// Each process has its own copy, made by exec() and fork().
+// The clock is the TSC, as in timer.c: ticks is
+// (rdtsc() - tsc0) / tickcycles, exactly as the kernel reckons it.
+struct vdso {
+  int pid;
+  uint tickcycles;  // TSC cycles per clock tick
+  uint tsckhz;      // TSC cycles per millisecond
+  uint64 tsc0;      // TSC when ticks was 0
+};
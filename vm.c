@@ -4,8 +4,10 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "vdso.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // pointer to global page dir that will replace entrypgdir
@@ -17,18 +19,32 @@ void
 seginit(void)
 {
   struct cpu *c;
+  int apicid;
+
+  // mycpu() reads %gs, which this sets up, so look for this
+  // CPU's struct by its local APIC ID instead.
+  apicid = lapicid();
+  for(c = cpus; c < cpus+ncpu-1 && c->apicid != apicid; c++)
+    ;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
   // Note: 0xffffffff = 4 GB
-  c = &cpus[cpuid()];
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+
+  // Map cpu and proc -- these are private per cpu.
+  c->gdt[SEG_KCPU] = SEG(STA_W, &c->cpu, 8, 0);
   lgdt(c->gdt, sizeof(c->gdt));
+  loadgs(SEG_KCPU << 3);
+
+  // Initialize cpu-local storage.
+  c->cpu = c;
+  c->proc = 0;
 }
 
 // Returns a ptr to the PTE in page table pgdir
@@ -217,6 +233,8 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+  // sysenter has no TSS to find the stack in, so tell it too.
+  wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
   lcr3(V2P(p->pgdir));  // switch to process's address space
 
   // Enable interrupts
@@ -281,8 +299,8 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  // Sanity check: don't grow into kernel space
-  if (newsz >= KERNBASE)
+  // Sanity check: don't grow into the vdso page or kernel space
+  if (newsz > VDSO)
     return 0;
 
   // Sanity check: newsz should be at least oldsz
@@ -315,6 +333,26 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Give the process with the given pid its vdso page in pgdir,
+// read-only to the user. It is freed with the rest of the user
+// pages by freevm(). Returns 0, or -1 if out of memory.
+int
+mapvdso(pde_t *pgdir, int pid)
+{
+  struct vdso *v;
+
+  if ((v = (struct vdso*) kalloc()) == 0)
+    return -1;
+  memset(v, 0, PGSIZE);
+  v->pid = pid;
+  timervdso(v);
+  if (mappages(pgdir, (char*) VDSO, PGSIZE, V2P(v), PTE_U) < 0) {
+    kfree((char*) v);
+    return -1;
+  }
+  return 0;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
@@ -0,0 +1,1427 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 48 03 00 00       	call   35e <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 48 04 00 00       	call   46c <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 41 03 00 00       	call   36d <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+// The kernel keeps the vdso page up to date for us, read-only.
+#define vdso ((struct vdso*)VDSO)
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 2d 02 00 00       	call   39a <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 23 02 00 00       	call   3e5 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 3b 02 00 00       	call   412 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 d7 01 00 00       	call   3b8 <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+ 275:	8b 75 10             	mov    0x10(%ebp),%esi
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+ 27e:	85 f6                	test   %esi,%esi
+ 280:	74 2e                	je     2b0 <memcmp+0x40>
+ 282:	01 c6                	add    %eax,%esi
+ 284:	eb 14                	jmp    29a <memcmp+0x2a>
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+ 296:	39 f0                	cmp    %esi,%eax
+ 298:	74 16                	je     2b0 <memcmp+0x40>
+    if(*s1 != *s2)
+ 29a:	0f b6 0a             	movzbl (%edx),%ecx
+ 29d:	0f b6 18             	movzbl (%eax),%ebx
+ 2a0:	38 d9                	cmp    %bl,%cl
+ 2a2:	74 ec                	je     290 <memcmp+0x20>
+      return *s1 - *s2;
+ 2a4:	0f b6 c1             	movzbl %cl,%eax
+ 2a7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 2b0:	5b                   	pop    %ebx
+  return 0;
+ 2b1:	31 c0                	xor    %eax,%eax
+}
+ 2b3:	5e                   	pop    %esi
+ 2b4:	5d                   	pop    %ebp
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <getpid>:
+// system calls, which matters to programs that time things.
+int
+getpid(void)
+{
+  return vdso->pid;
+}
+ 2c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <uptime>:
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 2d0:	0f 31                	rdtsc
+
+// Clock ticks since boot.
+int
+uptime(void)
+{
+  return divl(rdtsc() - vdso->tsc0, vdso->tickcycles);
+ 2d2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 2d8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 2de:	f7 35 04 f0 ff 7f    	divl   0x7ffff004
+}
+ 2e4:	c3                   	ret
+ 2e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <cycles>:
+  asm volatile("rdtsc" : "=A" (t));
+ 2f0:	0f 31                	rdtsc
+
+// TSC cycles since boot.
+uint64
+cycles(void)
+{
+  return rdtsc() - vdso->tsc0;
+ 2f2:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 2f8:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+}
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+
+00000300 <nanouptime>:
+
+// Time since boot, to the resolution of the TSC.
+void
+nanouptime(struct timespec *ts)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	53                   	push   %ebx
+ 306:	0f 31                	rdtsc
+  uint ms, rest;
+
+  t = rdtsc() - vdso->tsc0;
+  ms = divl(t, vdso->tsckhz);
+  rest = t - (uint64)ms * vdso->tsckhz;
+  ts->tv_sec = ms / 1000;
+ 308:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  t = rdtsc() - vdso->tsc0;
+ 30d:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+  ms = divl(t, vdso->tsckhz);
+ 313:	8b 3d 08 f0 ff 7f    	mov    0x7ffff008,%edi
+  t = rdtsc() - vdso->tsc0;
+ 319:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "0" ((uint)n), "1" ((uint)(n >> 32)),
+ 31f:	89 c6                	mov    %eax,%esi
+ 321:	f7 f7                	div    %edi
+ 323:	89 c1                	mov    %eax,%ecx
+  ts->tv_sec = ms / 1000;
+ 325:	f7 e3                	mul    %ebx
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 32a:	0f af f9             	imul   %ecx,%edi
+  ts->tv_sec = ms / 1000;
+ 32d:	89 d3                	mov    %edx,%ebx
+ 32f:	c1 eb 06             	shr    $0x6,%ebx
+  rest = t - (uint64)ms * vdso->tsckhz;
+ 332:	29 fe                	sub    %edi,%esi
+  ts->tv_sec = ms / 1000;
+ 334:	89 18                	mov    %ebx,(%eax)
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 336:	69 db e8 03 00 00    	imul   $0x3e8,%ebx,%ebx
+                divl((uint64)rest * 1000000, vdso->tsckhz);
+ 33c:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+ 341:	f7 e6                	mul    %esi
+ 343:	f7 35 08 f0 ff 7f    	divl   0x7ffff008
+  ts->tv_nsec = (ms % 1000) * 1000000 +
+ 349:	29 d9                	sub    %ebx,%ecx
+ 34b:	69 c9 40 42 0f 00    	imul   $0xf4240,%ecx,%ecx
+ 351:	01 c1                	add    %eax,%ecx
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	89 48 04             	mov    %ecx,0x4(%eax)
+}
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5f                   	pop    %edi
+ 35c:	5d                   	pop    %ebp
+ 35d:	c3                   	ret
+
+0000035e <fork>:
+    movl $1f, %edx; \
+    sysenter; \
+  1: \
+    ret
+
+SYSCALL(fork)
+ 35e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 363:	89 e1                	mov    %esp,%ecx
+ 365:	ba 6c 03 00 00       	mov    $0x36c,%edx
+ 36a:	0f 34                	sysenter
+ 36c:	c3                   	ret
+
+0000036d <exit>:
+SYSCALL(exit)
+ 36d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 372:	89 e1                	mov    %esp,%ecx
+ 374:	ba 7b 03 00 00       	mov    $0x37b,%edx
+ 379:	0f 34                	sysenter
+ 37b:	c3                   	ret
+
+0000037c <wait>:
+SYSCALL(wait)
+ 37c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 381:	89 e1                	mov    %esp,%ecx
+ 383:	ba 8a 03 00 00       	mov    $0x38a,%edx
+ 388:	0f 34                	sysenter
+ 38a:	c3                   	ret
+
+0000038b <pipe>:
+SYSCALL(pipe)
+ 38b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 390:	89 e1                	mov    %esp,%ecx
+ 392:	ba 99 03 00 00       	mov    $0x399,%edx
+ 397:	0f 34                	sysenter
+ 399:	c3                   	ret
+
+0000039a <read>:
+SYSCALL(read)
+ 39a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 39f:	89 e1                	mov    %esp,%ecx
+ 3a1:	ba a8 03 00 00       	mov    $0x3a8,%edx
+ 3a6:	0f 34                	sysenter
+ 3a8:	c3                   	ret
+
+000003a9 <write>:
+SYSCALL(write)
+ 3a9:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ae:	89 e1                	mov    %esp,%ecx
+ 3b0:	ba b7 03 00 00       	mov    $0x3b7,%edx
+ 3b5:	0f 34                	sysenter
+ 3b7:	c3                   	ret
+
+000003b8 <close>:
+SYSCALL(close)
+ 3b8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3bd:	89 e1                	mov    %esp,%ecx
+ 3bf:	ba c6 03 00 00       	mov    $0x3c6,%edx
+ 3c4:	0f 34                	sysenter
+ 3c6:	c3                   	ret
+
+000003c7 <kill>:
+SYSCALL(kill)
+ 3c7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3cc:	89 e1                	mov    %esp,%ecx
+ 3ce:	ba d5 03 00 00       	mov    $0x3d5,%edx
+ 3d3:	0f 34                	sysenter
+ 3d5:	c3                   	ret
+
+000003d6 <exec>:
+SYSCALL(exec)
+ 3d6:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3db:	89 e1                	mov    %esp,%ecx
+ 3dd:	ba e4 03 00 00       	mov    $0x3e4,%edx
+ 3e2:	0f 34                	sysenter
+ 3e4:	c3                   	ret
+
+000003e5 <open>:
+SYSCALL(open)
+ 3e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3ea:	89 e1                	mov    %esp,%ecx
+ 3ec:	ba f3 03 00 00       	mov    $0x3f3,%edx
+ 3f1:	0f 34                	sysenter
+ 3f3:	c3                   	ret
+
+000003f4 <mknod>:
+SYSCALL(mknod)
+ 3f4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f9:	89 e1                	mov    %esp,%ecx
+ 3fb:	ba 02 04 00 00       	mov    $0x402,%edx
+ 400:	0f 34                	sysenter
+ 402:	c3                   	ret
+
+00000403 <unlink>:
+SYSCALL(unlink)
+ 403:	b8 12 00 00 00       	mov    $0x12,%eax
+ 408:	89 e1                	mov    %esp,%ecx
+ 40a:	ba 11 04 00 00       	mov    $0x411,%edx
+ 40f:	0f 34                	sysenter
+ 411:	c3                   	ret
+
+00000412 <fstat>:
+SYSCALL(fstat)
+ 412:	b8 08 00 00 00       	mov    $0x8,%eax
+ 417:	89 e1                	mov    %esp,%ecx
+ 419:	ba 20 04 00 00       	mov    $0x420,%edx
+ 41e:	0f 34                	sysenter
+ 420:	c3                   	ret
+
+00000421 <link>:
+SYSCALL(link)
+ 421:	b8 13 00 00 00       	mov    $0x13,%eax
+ 426:	89 e1                	mov    %esp,%ecx
+ 428:	ba 2f 04 00 00       	mov    $0x42f,%edx
+ 42d:	0f 34                	sysenter
+ 42f:	c3                   	ret
+
+00000430 <mkdir>:
+SYSCALL(mkdir)
+ 430:	b8 14 00 00 00       	mov    $0x14,%eax
+ 435:	89 e1                	mov    %esp,%ecx
+ 437:	ba 3e 04 00 00       	mov    $0x43e,%edx
+ 43c:	0f 34                	sysenter
+ 43e:	c3                   	ret
+
+0000043f <chdir>:
+SYSCALL(chdir)
+ 43f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 444:	89 e1                	mov    %esp,%ecx
+ 446:	ba 4d 04 00 00       	mov    $0x44d,%edx
+ 44b:	0f 34                	sysenter
+ 44d:	c3                   	ret
+
+0000044e <dup>:
+SYSCALL(dup)
+ 44e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 453:	89 e1                	mov    %esp,%ecx
+ 455:	ba 5c 04 00 00       	mov    $0x45c,%edx
+ 45a:	0f 34                	sysenter
+ 45c:	c3                   	ret
+
+0000045d <sbrk>:
+SYSCALL(sbrk)
+ 45d:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 462:	89 e1                	mov    %esp,%ecx
+ 464:	ba 6b 04 00 00       	mov    $0x46b,%edx
+ 469:	0f 34                	sysenter
+ 46b:	c3                   	ret
+
+0000046c <sleep>:
+SYSCALL(sleep)
+ 46c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 471:	89 e1                	mov    %esp,%ecx
+ 473:	ba 7a 04 00 00       	mov    $0x47a,%edx
+ 478:	0f 34                	sysenter
+ 47a:	c3                   	ret
+
+0000047b <fallocate>:
+SYSCALL(fallocate)
+ 47b:	b8 16 00 00 00       	mov    $0x16,%eax
+ 480:	89 e1                	mov    %esp,%ecx
+ 482:	ba 89 04 00 00       	mov    $0x489,%edx
+ 487:	0f 34                	sysenter
+ 489:	c3                   	ret
+
+0000048a <pread>:
+SYSCALL(pread)
+ 48a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 48f:	89 e1                	mov    %esp,%ecx
+ 491:	ba 98 04 00 00       	mov    $0x498,%edx
+ 496:	0f 34                	sysenter
+ 498:	c3                   	ret
+
+00000499 <pwrite>:
+SYSCALL(pwrite)
+ 499:	b8 18 00 00 00       	mov    $0x18,%eax
+ 49e:	89 e1                	mov    %esp,%ecx
+ 4a0:	ba a7 04 00 00       	mov    $0x4a7,%edx
+ 4a5:	0f 34                	sysenter
+ 4a7:	c3                   	ret
+
+000004a8 <readv>:
+SYSCALL(readv)
+ 4a8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4ad:	89 e1                	mov    %esp,%ecx
+ 4af:	ba b6 04 00 00       	mov    $0x4b6,%edx
+ 4b4:	0f 34                	sysenter
+ 4b6:	c3                   	ret
+
+000004b7 <writev>:
+SYSCALL(writev)
+ 4b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4bc:	89 e1                	mov    %esp,%ecx
+ 4be:	ba c5 04 00 00       	mov    $0x4c5,%edx
+ 4c3:	0f 34                	sysenter
+ 4c5:	c3                   	ret
+
+000004c6 <splice>:
+SYSCALL(splice)
+ 4c6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4cb:	89 e1                	mov    %esp,%ecx
+ 4cd:	ba d4 04 00 00       	mov    $0x4d4,%edx
+ 4d2:	0f 34                	sysenter
+ 4d4:	c3                   	ret
+
+000004d5 <setpriority>:
+SYSCALL(setpriority)
+ 4d5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4da:	89 e1                	mov    %esp,%ecx
+ 4dc:	ba e3 04 00 00       	mov    $0x4e3,%edx
+ 4e1:	0f 34                	sysenter
+ 4e3:	c3                   	ret
+
+000004e4 <setaffinity>:
+SYSCALL(setaffinity)
+ 4e4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e9:	89 e1                	mov    %esp,%ecx
+ 4eb:	ba f2 04 00 00       	mov    $0x4f2,%edx
+ 4f0:	0f 34                	sysenter
+ 4f2:	c3                   	ret
+
+000004f3 <lockstress>:
+SYSCALL(lockstress)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	89 e1                	mov    %esp,%ecx
+ 4fa:	ba 01 05 00 00       	mov    $0x501,%edx
+ 4ff:	0f 34                	sysenter
+ 501:	c3                   	ret
+
+00000502 <lockstat>:
+SYSCALL(lockstat)
+ 502:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 507:	89 e1                	mov    %esp,%ecx
+ 509:	ba 10 05 00 00       	mov    $0x510,%edx
+ 50e:	0f 34                	sysenter
+ 510:	c3                   	ret
+
+00000511 <profctl>:
+SYSCALL(profctl)
+ 511:	b8 20 00 00 00       	mov    $0x20,%eax
+ 516:	89 e1                	mov    %esp,%ecx
+ 518:	ba 1f 05 00 00       	mov    $0x51f,%edx
+ 51d:	0f 34                	sysenter
+ 51f:	c3                   	ret
+
+00000520 <profread>:
+SYSCALL(profread)
+ 520:	b8 21 00 00 00       	mov    $0x21,%eax
+ 525:	89 e1                	mov    %esp,%ecx
+ 527:	ba 2e 05 00 00       	mov    $0x52e,%edx
+ 52c:	0f 34                	sysenter
+ 52e:	c3                   	ret
+
+0000052f <getrusage>:
+SYSCALL(getrusage)
+ 52f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 534:	89 e1                	mov    %esp,%ecx
+ 536:	ba 3d 05 00 00       	mov    $0x53d,%edx
+ 53b:	0f 34                	sysenter
+ 53d:	c3                   	ret
+
+0000053e <tracectl>:
+SYSCALL(tracectl)
+ 53e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 543:	89 e1                	mov    %esp,%ecx
+ 545:	ba 4c 05 00 00       	mov    $0x54c,%edx
+ 54a:	0f 34                	sysenter
+ 54c:	c3                   	ret
+
+0000054d <traceread>:
+SYSCALL(traceread)
+ 54d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 552:	89 e1                	mov    %esp,%ecx
+ 554:	ba 5b 05 00 00       	mov    $0x55b,%edx
+ 559:	0f 34                	sysenter
+ 55b:	c3                   	ret
+
+0000055c <nanosleep>:
+SYSCALL(nanosleep)
+ 55c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 561:	89 e1                	mov    %esp,%ecx
+ 563:	ba 6a 05 00 00       	mov    $0x56a,%edx
+ 568:	0f 34                	sysenter
+ 56a:	c3                   	ret
+ 56b:	66 90                	xchg   %ax,%ax
+ 56d:	66 90                	xchg   %ax,%ax
+ 56f:	90                   	nop
+
+00000570 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	53                   	push   %ebx
+ 576:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 578:	89 d1                	mov    %edx,%ecx
+{
+ 57a:	83 ec 3c             	sub    $0x3c,%esp
+ 57d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 580:	85 d2                	test   %edx,%edx
+ 582:	0f 89 80 00 00 00    	jns    608 <printint+0x98>
+ 588:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 58c:	74 7a                	je     608 <printint+0x98>
+    x = -xx;
+ 58e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 590:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 595:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 598:	31 f6                	xor    %esi,%esi
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5a0:	89 c8                	mov    %ecx,%eax
+ 5a2:	31 d2                	xor    %edx,%edx
+ 5a4:	89 f7                	mov    %esi,%edi
+ 5a6:	f7 f3                	div    %ebx
+ 5a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5ab:	0f b6 92 98 09 00 00 	movzbl 0x998(%edx),%edx
+ 5b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5b6:	89 ca                	mov    %ecx,%edx
+ 5b8:	89 c1                	mov    %eax,%ecx
+ 5ba:	39 da                	cmp    %ebx,%edx
+ 5bc:	73 e2                	jae    5a0 <printint+0x30>
+  if(neg)
+ 5be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5c1:	85 c0                	test   %eax,%eax
+ 5c3:	74 07                	je     5cc <printint+0x5c>
+    buf[i++] = '-';
+ 5c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ca:	89 f7                	mov    %esi,%edi
+ 5cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5d2:	01 df                	add    %ebx,%edi
+ 5d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5db:	83 ec 04             	sub    $0x4,%esp
+ 5de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5e4:	6a 01                	push   $0x1
+ 5e6:	50                   	push   %eax
+ 5e7:	56                   	push   %esi
+ 5e8:	e8 bc fd ff ff       	call   3a9 <write>
+  while(--i >= 0)
+ 5ed:	89 f8                	mov    %edi,%eax
+ 5ef:	83 c4 10             	add    $0x10,%esp
+ 5f2:	83 ef 01             	sub    $0x1,%edi
+ 5f5:	39 d8                	cmp    %ebx,%eax
+ 5f7:	75 df                	jne    5d8 <printint+0x68>
+}
+ 5f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fc:	5b                   	pop    %ebx
+ 5fd:	5e                   	pop    %esi
+ 5fe:	5f                   	pop    %edi
+ 5ff:	5d                   	pop    %ebp
+ 600:	c3                   	ret
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 608:	31 c0                	xor    %eax,%eax
+ 60a:	eb 89                	jmp    595 <printint+0x25>
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000610 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 619:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 61c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 61f:	0f b6 1e             	movzbl (%esi),%ebx
+ 622:	83 c6 01             	add    $0x1,%esi
+ 625:	84 db                	test   %bl,%bl
+ 627:	74 67                	je     690 <printf+0x80>
+ 629:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 62c:	31 d2                	xor    %edx,%edx
+ 62e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 631:	eb 34                	jmp    667 <printf+0x57>
+ 633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 637:	90                   	nop
+ 638:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 63b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 640:	83 f8 25             	cmp    $0x25,%eax
+ 643:	74 18                	je     65d <printf+0x4d>
+  write(fd, &c, 1);
+ 645:	83 ec 04             	sub    $0x4,%esp
+ 648:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 64b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 64e:	6a 01                	push   $0x1
+ 650:	50                   	push   %eax
+ 651:	57                   	push   %edi
+ 652:	e8 52 fd ff ff       	call   3a9 <write>
+ 657:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 65a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 65d:	0f b6 1e             	movzbl (%esi),%ebx
+ 660:	83 c6 01             	add    $0x1,%esi
+ 663:	84 db                	test   %bl,%bl
+ 665:	74 29                	je     690 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 667:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 66a:	85 d2                	test   %edx,%edx
+ 66c:	74 ca                	je     638 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 66e:	83 fa 25             	cmp    $0x25,%edx
+ 671:	75 ea                	jne    65d <printf+0x4d>
+      if(c == 'd'){
+ 673:	83 f8 25             	cmp    $0x25,%eax
+ 676:	0f 84 24 01 00 00    	je     7a0 <printf+0x190>
+ 67c:	83 e8 63             	sub    $0x63,%eax
+ 67f:	83 f8 15             	cmp    $0x15,%eax
+ 682:	77 1c                	ja     6a0 <printf+0x90>
+ 684:	ff 24 85 40 09 00 00 	jmp    *0x940(,%eax,4)
+ 68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 693:	5b                   	pop    %ebx
+ 694:	5e                   	pop    %esi
+ 695:	5f                   	pop    %edi
+ 696:	5d                   	pop    %ebp
+ 697:	c3                   	ret
+ 698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6aa:	6a 01                	push   $0x1
+ 6ac:	52                   	push   %edx
+ 6ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6b0:	57                   	push   %edi
+ 6b1:	e8 f3 fc ff ff       	call   3a9 <write>
+ 6b6:	83 c4 0c             	add    $0xc,%esp
+ 6b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6bc:	6a 01                	push   $0x1
+ 6be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6c1:	52                   	push   %edx
+ 6c2:	57                   	push   %edi
+ 6c3:	e8 e1 fc ff ff       	call   3a9 <write>
+        putc(fd, c);
+ 6c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cb:	31 d2                	xor    %edx,%edx
+ 6cd:	eb 8e                	jmp    65d <printf+0x4d>
+ 6cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 00                	push   $0x0
+ 6df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6e4:	e8 87 fe ff ff       	call   570 <printint>
+        ap++;
+ 6e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ef:	31 d2                	xor    %edx,%edx
+ 6f1:	e9 67 ff ff ff       	jmp    65d <printf+0x4d>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 700:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 703:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 705:	83 c0 04             	add    $0x4,%eax
+ 708:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 70b:	85 db                	test   %ebx,%ebx
+ 70d:	0f 84 9d 00 00 00    	je     7b0 <printf+0x1a0>
+        while(*s != 0){
+ 713:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 716:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 718:	84 c0                	test   %al,%al
+ 71a:	0f 84 3d ff ff ff    	je     65d <printf+0x4d>
+ 720:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 723:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 726:	89 de                	mov    %ebx,%esi
+ 728:	89 d3                	mov    %edx,%ebx
+ 72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 736:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	53                   	push   %ebx
+ 73c:	57                   	push   %edi
+ 73d:	e8 67 fc ff ff       	call   3a9 <write>
+        while(*s != 0){
+ 742:	0f b6 06             	movzbl (%esi),%eax
+ 745:	83 c4 10             	add    $0x10,%esp
+ 748:	84 c0                	test   %al,%al
+ 74a:	75 e4                	jne    730 <printf+0x120>
+      state = 0;
+ 74c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 07 ff ff ff       	jmp    65d <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 76b:	8b 13                	mov    (%ebx),%edx
+ 76d:	6a 01                	push   $0x1
+ 76f:	e9 6b ff ff ff       	jmp    6df <printf+0xcf>
+ 774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 778:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 77b:	83 ec 04             	sub    $0x4,%esp
+ 77e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 781:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 783:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 786:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	52                   	push   %edx
+ 78c:	57                   	push   %edi
+ 78d:	e8 17 fc ff ff       	call   3a9 <write>
+        ap++;
+ 792:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 795:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 798:	31 d2                	xor    %edx,%edx
+ 79a:	e9 be fe ff ff       	jmp    65d <printf+0x4d>
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	e9 11 ff ff ff       	jmp    6c1 <printf+0xb1>
+ 7b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7b5:	bb 38 09 00 00       	mov    $0x938,%ebx
+ 7ba:	e9 61 ff ff ff       	jmp    720 <printf+0x110>
+ 7bf:	90                   	nop
+
+000007c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	a1 d0 0c 00 00       	mov    0xcd0,%eax
+{
+ 7c6:	89 e5                	mov    %esp,%ebp
+ 7c8:	57                   	push   %edi
+ 7c9:	56                   	push   %esi
+ 7ca:	53                   	push   %ebx
+ 7cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7dc:	39 ca                	cmp    %ecx,%edx
+ 7de:	73 30                	jae    810 <free+0x50>
+ 7e0:	39 c1                	cmp    %eax,%ecx
+ 7e2:	72 04                	jb     7e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7e4:	39 c2                	cmp    %eax,%edx
+ 7e6:	72 f0                	jb     7d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ee:	39 f8                	cmp    %edi,%eax
+ 7f0:	74 2e                	je     820 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7fb:	39 f1                	cmp    %esi,%ecx
+ 7fd:	74 38                	je     837 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 801:	5b                   	pop    %ebx
+  freep = p;
+ 802:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+}
+ 808:	5e                   	pop    %esi
+ 809:	5f                   	pop    %edi
+ 80a:	5d                   	pop    %ebp
+ 80b:	c3                   	ret
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 d0                	jb     7e4 <free+0x24>
+ 814:	eb c2                	jmp    7d8 <free+0x18>
+ 816:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 820:	03 70 04             	add    0x4(%eax),%esi
+ 823:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 826:	8b 02                	mov    (%edx),%eax
+ 828:	8b 00                	mov    (%eax),%eax
+ 82a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 82d:	8b 42 04             	mov    0x4(%edx),%eax
+ 830:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 833:	39 f1                	cmp    %esi,%ecx
+ 835:	75 c8                	jne    7ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 837:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 83a:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+    p->s.size += bp->s.size;
+ 840:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 843:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 846:	89 0a                	mov    %ecx,(%edx)
+}
+ 848:	5b                   	pop    %ebx
+ 849:	5e                   	pop    %esi
+ 84a:	5f                   	pop    %edi
+ 84b:	5d                   	pop    %ebp
+ 84c:	c3                   	ret
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000850 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 859:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 85c:	8b 15 d0 0c 00 00    	mov    0xcd0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 862:	8d 78 07             	lea    0x7(%eax),%edi
+ 865:	c1 ef 03             	shr    $0x3,%edi
+ 868:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 86b:	85 d2                	test   %edx,%edx
+ 86d:	0f 84 8d 00 00 00    	je     900 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 873:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 875:	8b 48 04             	mov    0x4(%eax),%ecx
+ 878:	39 f9                	cmp    %edi,%ecx
+ 87a:	73 64                	jae    8e0 <malloc+0x90>
+  if(nu < 4096)
+ 87c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 881:	39 df                	cmp    %ebx,%edi
+ 883:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 886:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 88d:	eb 0a                	jmp    899 <malloc+0x49>
+ 88f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 890:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 892:	8b 48 04             	mov    0x4(%eax),%ecx
+ 895:	39 f9                	cmp    %edi,%ecx
+ 897:	73 47                	jae    8e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 899:	89 c2                	mov    %eax,%edx
+ 89b:	39 05 d0 0c 00 00    	cmp    %eax,0xcd0
+ 8a1:	75 ed                	jne    890 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8a3:	83 ec 0c             	sub    $0xc,%esp
+ 8a6:	56                   	push   %esi
+ 8a7:	e8 b1 fb ff ff       	call   45d <sbrk>
+  if(p == (char*)-1)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+ 8af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8b2:	74 1c                	je     8d0 <malloc+0x80>
+  hp->s.size = nu;
+ 8b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8b7:	83 ec 0c             	sub    $0xc,%esp
+ 8ba:	83 c0 08             	add    $0x8,%eax
+ 8bd:	50                   	push   %eax
+ 8be:	e8 fd fe ff ff       	call   7c0 <free>
+  return freep;
+ 8c3:	8b 15 d0 0c 00 00    	mov    0xcd0,%edx
+      if((p = morecore(nunits)) == 0)
+ 8c9:	83 c4 10             	add    $0x10,%esp
+ 8cc:	85 d2                	test   %edx,%edx
+ 8ce:	75 c0                	jne    890 <malloc+0x40>
+        return 0;
+  }
+}
+ 8d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8d3:	31 c0                	xor    %eax,%eax
+}
+ 8d5:	5b                   	pop    %ebx
+ 8d6:	5e                   	pop    %esi
+ 8d7:	5f                   	pop    %edi
+ 8d8:	5d                   	pop    %ebp
+ 8d9:	c3                   	ret
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8e0:	39 cf                	cmp    %ecx,%edi
+ 8e2:	74 4c                	je     930 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8e4:	29 f9                	sub    %edi,%ecx
+ 8e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ef:	89 15 d0 0c 00 00    	mov    %edx,0xcd0
+}
+ 8f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8f8:	83 c0 08             	add    $0x8,%eax
+}
+ 8fb:	5b                   	pop    %ebx
+ 8fc:	5e                   	pop    %esi
+ 8fd:	5f                   	pop    %edi
+ 8fe:	5d                   	pop    %ebp
+ 8ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 900:	c7 05 d0 0c 00 00 d4 	movl   $0xcd4,0xcd0
+ 907:	0c 00 00 
+    base.s.size = 0;
+ 90a:	b8 d4 0c 00 00       	mov    $0xcd4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 90f:	c7 05 d4 0c 00 00 d4 	movl   $0xcd4,0xcd4
+ 916:	0c 00 00 
+    base.s.size = 0;
+ 919:	c7 05 d8 0c 00 00 00 	movl   $0x0,0xcd8
+ 920:	00 00 00 
+    if(p->s.size >= nunits){
+ 923:	e9 54 ff ff ff       	jmp    87c <malloc+0x2c>
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 930:	8b 08                	mov    (%eax),%ecx
+ 932:	89 0a                	mov    %ecx,(%edx)
+ 934:	eb b9                	jmp    8ef <malloc+0x9f>